@@ -21,10 +21,12 @@
 #include <Reaktoro/Common/ArraySerialization.hpp>
 #include <Reaktoro/Common/ArrayStream.hpp>
 #include <Reaktoro/Common/AutoDiff.hpp>
+#include <Reaktoro/Common/BinaryStream.hpp>
 #include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/ConvertUtils.hpp>
 #include <Reaktoro/Common/Enumerate.hpp>
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/HashIndex.hpp>
 #include <Reaktoro/Common/Index.hpp>
 #include <Reaktoro/Common/InterpolationUtils.hpp>
 #include <Reaktoro/Common/Matrix.hpp>
@@ -34,8 +36,10 @@
 #include <Reaktoro/Common/MoleFractionUtils.hpp>
 #include <Reaktoro/Common/NamingUtils.hpp>
 #include <Reaktoro/Common/ParseUtils.hpp>
+#include <Reaktoro/Common/Profiler.hpp>
 #include <Reaktoro/Common/Profiling.hpp>
 #include <Reaktoro/Common/Real.hpp>
+#include <Reaktoro/Common/SlotMap.hpp>
 #include <Reaktoro/Common/StringList.hpp>
 #include <Reaktoro/Common/StringUtils.hpp>
 #include <Reaktoro/Common/Table.hpp>
@@ -45,6 +49,7 @@
 #include <Reaktoro/Common/TypeOp.hpp>
 #include <Reaktoro/Common/Types.hpp>
 #include <Reaktoro/Common/Units.hpp>
+#include <Reaktoro/Common/WorkScheduler.hpp>
 
 /// @defgroup Common Common
 /// The module in Reaktoro in which methods and classes commonly used in other modules are implemented.
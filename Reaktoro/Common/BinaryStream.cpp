@@ -0,0 +1,269 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "BinaryStream.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <utility>
+
+// Platform includes
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Reaktoro {
+
+//=================================================================================================
+//
+// BinaryWriter
+//
+//=================================================================================================
+
+BinaryWriter::BinaryWriter()
+{}
+
+BinaryWriter::BinaryWriter(String const& filename, Index buffersize)
+: mbuffer(std::max<Index>(buffersize, 64))
+{
+    open(filename);
+}
+
+BinaryWriter::BinaryWriter(BinaryWriter&& other)
+{
+    *this = std::move(other);
+}
+
+BinaryWriter::~BinaryWriter()
+{
+    if(isOpen())
+    {
+        // Do not throw from destructor; errors are reported on explicit calls to method close.
+        if(mused) std::fwrite(mbuffer.data(), 1, mused, mfile);
+        std::fclose(mfile);
+    }
+}
+
+auto BinaryWriter::operator=(BinaryWriter&& other) -> BinaryWriter&
+{
+    if(this != &other)
+    {
+        close();
+        mfile = std::exchange(other.mfile, nullptr);
+        mbuffer = std::move(other.mbuffer);
+        mused = std::exchange(other.mused, 0);
+        mwritten = std::exchange(other.mwritten, 0);
+    }
+    return *this;
+}
+
+auto BinaryWriter::open(String const& filename) -> void
+{
+    close();
+    mfile = std::fopen(filename.c_str(), "wb");
+    errorif(mfile == nullptr, "Could not open file `", filename, "` for writing binary data.");
+    std::setvbuf(mfile, nullptr, _IONBF, 0); // data is already buffered in mbuffer, so that flush makes it visible to readers immediately
+    if(mbuffer.empty())
+        mbuffer.resize(1 << 20);
+    mused = 0;
+    mwritten = 0;
+}
+
+auto BinaryWriter::close() -> void
+{
+    if(!isOpen())
+        return;
+    flush();
+    std::fclose(mfile);
+    mfile = nullptr;
+}
+
+auto BinaryWriter::isOpen() const -> bool
+{
+    return mfile != nullptr;
+}
+
+auto BinaryWriter::flush() -> void
+{
+    errorif(!isOpen(), "Cannot flush a BinaryWriter object not associated with an open file.");
+    if(mused == 0)
+        return;
+    const auto count = std::fwrite(mbuffer.data(), 1, mused, mfile);
+    errorif(count != mused, "Could not write binary data to file (disk full?).");
+    mwritten += mused;
+    mused = 0;
+}
+
+auto BinaryWriter::offset() const -> Index
+{
+    return mwritten + mused;
+}
+
+auto BinaryWriter::write(void const* data, Index size) -> void
+{
+    errorif(!isOpen(), "Cannot write with a BinaryWriter object not associated with an open file.");
+    auto const* bytes = static_cast<char const*>(data);
+    if(mused + size > mbuffer.size())
+    {
+        flush();
+        if(size >= mbuffer.size()) // write large blocks directly, bypassing the buffer
+        {
+            const auto count = std::fwrite(bytes, 1, size, mfile);
+            errorif(count != size, "Could not write binary data to file (disk full?).");
+            mwritten += size;
+            return;
+        }
+    }
+    std::memcpy(mbuffer.data() + mused, bytes, size);
+    mused += size;
+}
+
+auto BinaryWriter::writeString(String const& str) -> void
+{
+    write<std::uint64_t>(str.size());
+    write(str.data(), str.size());
+    align();
+}
+
+auto BinaryWriter::align(Index alignment) -> void
+{
+    const char zeros[64] = {};
+    const auto rem = offset() % alignment;
+    if(rem) write(zeros, alignment - rem);
+}
+
+//=================================================================================================
+//
+// MemoryMappedFile
+//
+//=================================================================================================
+
+MemoryMappedFile::MemoryMappedFile()
+{}
+
+MemoryMappedFile::MemoryMappedFile(String const& filename)
+{
+    open(filename);
+}
+
+MemoryMappedFile::MemoryMappedFile(MemoryMappedFile&& other)
+{
+    *this = std::move(other);
+}
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+    close();
+}
+
+auto MemoryMappedFile::operator=(MemoryMappedFile&& other) -> MemoryMappedFile&
+{
+    if(this != &other)
+    {
+        close();
+        mdata = std::exchange(other.mdata, nullptr);
+        msize = std::exchange(other.msize, 0);
+        mhandles[0] = std::exchange(other.mhandles[0], nullptr);
+        mhandles[1] = std::exchange(other.mhandles[1], nullptr);
+    }
+    return *this;
+}
+
+#ifdef _WIN32
+
+auto MemoryMappedFile::open(String const& filename) -> void
+{
+    close();
+    HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    errorif(file == INVALID_HANDLE_VALUE, "Could not open file `", filename, "` for reading binary data.");
+    LARGE_INTEGER size;
+    GetFileSizeEx(file, &size);
+    msize = size.QuadPart;
+    mhandles[0] = file;
+    if(msize == 0)
+        return;
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    errorif(mapping == nullptr, "Could not map file `", filename, "` into memory.");
+    mhandles[1] = mapping;
+    mdata = static_cast<char const*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    errorif(mdata == nullptr, "Could not map file `", filename, "` into memory.");
+}
+
+auto MemoryMappedFile::close() -> void
+{
+    if(mdata) UnmapViewOfFile(mdata);
+    if(mhandles[1]) CloseHandle(mhandles[1]);
+    if(mhandles[0]) CloseHandle(mhandles[0]);
+    mdata = nullptr;
+    msize = 0;
+    mhandles[0] = mhandles[1] = nullptr;
+}
+
+#else
+
+auto MemoryMappedFile::open(String const& filename) -> void
+{
+    close();
+    const int fd = ::open(filename.c_str(), O_RDONLY);
+    errorif(fd < 0, "Could not open file `", filename, "` for reading binary data.");
+    struct stat info;
+    if(::fstat(fd, &info) != 0)
+    {
+        ::close(fd);
+        errorif(true, "Could not determine the size of file `", filename, "`.");
+    }
+    msize = info.st_size;
+    if(msize > 0)
+    {
+        void* ptr = ::mmap(nullptr, msize, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        errorif(ptr == MAP_FAILED, "Could not map file `", filename, "` into memory.");
+        mdata = static_cast<char const*>(ptr);
+    }
+    else ::close(fd);
+}
+
+auto MemoryMappedFile::close() -> void
+{
+    if(mdata) ::munmap(const_cast<char*>(mdata), msize);
+    mdata = nullptr;
+    msize = 0;
+}
+
+#endif
+
+auto MemoryMappedFile::isOpen() const -> bool
+{
+    return mdata != nullptr;
+}
+
+auto MemoryMappedFile::data() const -> char const*
+{
+    return mdata;
+}
+
+auto MemoryMappedFile::size() const -> Index
+{
+    return msize;
+}
+
+} // namespace Reaktoro
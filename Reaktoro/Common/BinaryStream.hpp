@@ -0,0 +1,323 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <type_traits>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+/// Used to write binary data sequentially to a file using an internal buffer.
+/// The data is written in the native byte order of the machine. Arrays and
+/// strings can be aligned to 8-byte boundaries with method @ref align so that
+/// they can later be accessed directly from a memory-mapped file (see
+/// MemoryMappedFile and BinaryReader) without copying.
+class BinaryWriter
+{
+public:
+    /// Construct a default BinaryWriter object not associated with a file.
+    BinaryWriter();
+
+    /// Construct a BinaryWriter object that writes to a given file.
+    /// @param filename The path to the file (overwritten if existent)
+    /// @param buffersize The size of the internal buffer (in bytes)
+    explicit BinaryWriter(String const& filename, Index buffersize = 1 << 20);
+
+    /// Construct a BinaryWriter object by moving another.
+    BinaryWriter(BinaryWriter&& other);
+
+    /// Destroy this BinaryWriter object after writing any buffered data to the file.
+    ~BinaryWriter();
+
+    /// Assign a BinaryWriter object to this by moving it.
+    auto operator=(BinaryWriter&& other) -> BinaryWriter&;
+
+    /// Open a file for writing (overwritten if existent).
+    auto open(String const& filename) -> void;
+
+    /// Write any buffered data to the file and close it.
+    auto close() -> void;
+
+    /// Return true if the writer is associated with an open file.
+    auto isOpen() const -> bool;
+
+    /// Write any buffered data to the file.
+    auto flush() -> void;
+
+    /// Return the number of bytes written so far, including buffered ones.
+    auto offset() const -> Index;
+
+    /// Write a given number of bytes.
+    auto write(void const* data, Index size) -> void;
+
+    /// Write a value of a trivially copyable type.
+    template<typename T>
+    auto write(T const& value) -> void
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "BinaryWriter::write requires a trivially copyable type.");
+        write(static_cast<void const*>(&value), sizeof(T));
+    }
+
+    /// Write an array of values of a trivially copyable type.
+    template<typename T>
+    auto write(T const* values, Index size) -> void
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "BinaryWriter::write requires a trivially copyable type.");
+        write(static_cast<void const*>(values), size * sizeof(T));
+    }
+
+    /// Write a string as its length (as a 64-bit integer) followed by its characters and zero padding to an 8-byte boundary.
+    auto writeString(String const& str) -> void;
+
+    /// Write zero bytes until the offset is a multiple of `alignment`.
+    auto align(Index alignment = 8) -> void;
+
+private:
+    /// The file to which data is written.
+    std::FILE* mfile = nullptr;
+
+    /// The buffer of data not yet written to the file.
+    Vec<char> mbuffer;
+
+    /// The number of bytes currently in the buffer.
+    Index mused = 0;
+
+    /// The number of bytes already written to the file.
+    Index mwritten = 0;
+};
+
+/// Used to write binary data sequentially to a block of memory.
+/// This class has the same writing methods as BinaryWriter, but the data is
+/// appended to a buffer in memory instead of a file (e.g., to exchange data
+/// between processes). The data can be read back with BinaryReader.
+/// @see BinaryWriter, BinaryReader
+class BinaryMemoryWriter
+{
+public:
+    /// Construct a BinaryMemoryWriter object that writes to a given buffer.
+    /// The buffer is cleared, but its allocated memory is reused.
+    explicit BinaryMemoryWriter(Vec<char>& buffer)
+    : mbuffer(buffer)
+    {
+        mbuffer.clear();
+    }
+
+    /// Return the number of bytes written so far.
+    auto offset() const -> Index { return mbuffer.size(); }
+
+    /// Write a given number of bytes.
+    auto write(void const* data, Index size) -> void
+    {
+        auto const* bytes = static_cast<char const*>(data);
+        mbuffer.insert(mbuffer.end(), bytes, bytes + size);
+    }
+
+    /// Write a value of a trivially copyable type.
+    template<typename T>
+    auto write(T const& value) -> void
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "BinaryMemoryWriter::write requires a trivially copyable type.");
+        write(static_cast<void const*>(&value), sizeof(T));
+    }
+
+    /// Write an array of values of a trivially copyable type.
+    template<typename T>
+    auto write(T const* values, Index size) -> void
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "BinaryMemoryWriter::write requires a trivially copyable type.");
+        write(static_cast<void const*>(values), size * sizeof(T));
+    }
+
+    /// Write a string as its length (as a 64-bit integer) followed by its characters and zero padding to an 8-byte boundary.
+    auto writeString(String const& str) -> void
+    {
+        write<std::uint64_t>(str.size());
+        write(str.data(), str.size());
+        align();
+    }
+
+    /// Write zero bytes until the offset is a multiple of `alignment`.
+    auto align(Index alignment = 8) -> void
+    {
+        const auto rem = offset() % alignment;
+        if(rem) mbuffer.resize(mbuffer.size() + alignment - rem, 0);
+    }
+
+private:
+    /// The buffer to which data is written.
+    Vec<char>& mbuffer;
+};
+
+/// Used to map a file into memory in read-only mode.
+/// The file contents are accessed directly from the operating system page
+/// cache, so that data needed is only loaded on demand and never copied.
+class MemoryMappedFile
+{
+public:
+    /// Construct a default MemoryMappedFile object not associated with a file.
+    MemoryMappedFile();
+
+    /// Construct a MemoryMappedFile object mapping a given file.
+    explicit MemoryMappedFile(String const& filename);
+
+    /// Construct a MemoryMappedFile object by moving another.
+    MemoryMappedFile(MemoryMappedFile&& other);
+
+    /// Destroy this MemoryMappedFile object, unmapping the file.
+    ~MemoryMappedFile();
+
+    /// Assign a MemoryMappedFile object to this by moving it.
+    auto operator=(MemoryMappedFile&& other) -> MemoryMappedFile&;
+
+    /// Map a file into memory.
+    auto open(String const& filename) -> void;
+
+    /// Unmap the file.
+    auto close() -> void;
+
+    /// Return true if a file is currently mapped.
+    auto isOpen() const -> bool;
+
+    /// Return a pointer to the beginning of the mapped file.
+    auto data() const -> char const*;
+
+    /// Return the size of the mapped file (in bytes).
+    auto size() const -> Index;
+
+private:
+    /// The pointer to the beginning of the mapped file.
+    char const* mdata = nullptr;
+
+    /// The size of the mapped file (in bytes).
+    Index msize = 0;
+
+    /// The operating system handles of the file and its mapping.
+    void* mhandles[2] = { nullptr, nullptr };
+};
+
+/// Used to read binary data sequentially from a contiguous block of memory without copying.
+/// @see BinaryWriter, MemoryMappedFile
+class BinaryReader
+{
+public:
+    /// Construct a default BinaryReader object.
+    BinaryReader() = default;
+
+    /// Construct a BinaryReader object for a given block of memory.
+    BinaryReader(char const* data, Index size)
+    : mdata(data), msize(size)
+    {}
+
+    /// Return the current offset of the reader (in bytes).
+    auto offset() const -> Index { return moffset; }
+
+    /// Return the total size of the block of memory (in bytes).
+    auto size() const -> Index { return msize; }
+
+    /// Return the number of bytes not yet read.
+    auto remaining() const -> Index { return msize - moffset; }
+
+    /// Set the current offset of the reader (in bytes).
+    auto seek(Index offset) -> void
+    {
+        errorif(offset > msize, "Cannot move the binary reader to offset ", offset, " beyond the size of the data (", msize, " bytes).");
+        moffset = offset;
+    }
+
+    /// Skip a given number of bytes.
+    auto skip(Index size) -> void
+    {
+        errorif(size > remaining(), "Cannot skip ", size, " bytes of binary data with only ", remaining(), " bytes remaining (truncated or corrupted data?).");
+        moffset += size;
+    }
+
+    /// Read a value of a trivially copyable type.
+    template<typename T>
+    auto read() -> T
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "BinaryReader::read requires a trivially copyable type.");
+        T value;
+        std::memcpy(&value, bytes(sizeof(T)), sizeof(T));
+        return value;
+    }
+
+    /// Return a pointer to an array of values of a trivially copyable type and advance the reader past it.
+    /// The pointer refers directly to the underlying memory and no data is copied.
+    template<typename T>
+    auto view(Index size) -> T const*
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "BinaryReader::view requires a trivially copyable type.");
+        errorif(reinterpret_cast<std::uintptr_t>(mdata + moffset) % alignof(T) != 0, "Cannot view misaligned binary data at offset ", moffset, ".");
+        errorif(size > remaining() / sizeof(T), "Cannot read ", size, " values of ", sizeof(T), " bytes from binary data with only ", remaining(), " bytes remaining (truncated or corrupted data?).");
+        return reinterpret_cast<T const*>(bytes(size * sizeof(T)));
+    }
+
+    /// Read the number of items in a sequence whose items occupy at least `itemsize` bytes each.
+    /// An error is raised if the remaining data cannot hold that many items, so that the
+    /// returned count can be used to allocate memory before the items are read.
+    auto readCount(Index itemsize) -> Index
+    {
+        const auto count = read<std::uint64_t>();
+        errorif(itemsize != 0 && count > remaining() / itemsize, "Cannot read ", count, " items of at least ", itemsize, " bytes from binary data with only ", remaining(), " bytes remaining (truncated or corrupted data?).");
+        return count;
+    }
+
+    /// Read a string written with BinaryWriter::writeString.
+    auto readString() -> String
+    {
+        const auto length = read<std::uint64_t>();
+        String str(bytes(length), length);
+        align();
+        return str;
+    }
+
+    /// Skip bytes until the offset is a multiple of `alignment`.
+    auto align(Index alignment = 8) -> void
+    {
+        const auto rem = moffset % alignment;
+        if(rem) skip(alignment - rem);
+    }
+
+private:
+    /// Return a pointer to the next `size` bytes and advance the reader past them.
+    auto bytes(Index size) -> char const*
+    {
+        errorif(size > remaining(), "Cannot read ", size, " bytes from binary data with only ", remaining(), " bytes remaining (truncated or corrupted data?).");
+        auto const* ptr = mdata + moffset;
+        moffset += size;
+        return ptr;
+    }
+
+    /// The pointer to the beginning of the block of memory.
+    char const* mdata = nullptr;
+
+    /// The size of the block of memory (in bytes).
+    Index msize = 0;
+
+    /// The current offset of the reader (in bytes).
+    Index moffset = 0;
+};
+
+} // namespace Reaktoro
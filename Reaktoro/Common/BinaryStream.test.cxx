@@ -0,0 +1,150 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <cstdio>
+#include <limits>
+
+// Reaktoro includes
+#include <Reaktoro/Common/BinaryStream.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing BinaryWriter, MemoryMappedFile and BinaryReader", "[BinaryStream]")
+{
+    const String filename = "reaktoro-binarystream-test.bin";
+
+    const Vec<double> values = { 1.0, 2.0, 3.0, 4.0, 5.0 };
+
+    {
+        BinaryWriter writer(filename, 64); // use a small buffer to exercise flushing
+
+        writer.write<std::uint32_t>(42);
+        writer.align();
+
+        CHECK( writer.offset() == 8 );
+
+        writer.writeString("Calcite");
+
+        CHECK( writer.offset() == 24 ); // 8 bytes for length and 7 characters padded to 8 bytes
+
+        writer.write<std::uint64_t>(values.size());
+        writer.write(values.data(), values.size());
+
+        Vec<double> large(100, 7.0); // larger than the internal buffer
+        writer.write(large.data(), large.size());
+
+        writer.close();
+
+        CHECK( writer.isOpen() == false );
+    }
+
+    MemoryMappedFile file(filename);
+
+    REQUIRE( file.isOpen() );
+    CHECK( file.size() == 24 + 8 + 5*8 + 100*8 );
+
+    BinaryReader reader(file.data(), file.size());
+
+    CHECK( reader.read<std::uint32_t>() == 42 );
+    reader.align();
+    CHECK( reader.readString() == "Calcite" );
+
+    const auto size = reader.read<std::uint64_t>();
+    REQUIRE( size == values.size() );
+
+    auto const* view = reader.view<double>(size);
+
+    for(auto i = 0; i < size; ++i)
+        CHECK( view[i] == values[i] );
+
+    auto const* large = reader.view<double>(100);
+
+    CHECK( large[0] == 7.0 );
+    CHECK( large[99] == 7.0 );
+    CHECK( reader.remaining() == 0 );
+
+    CHECK_THROWS( reader.read<double>() ); // no more data to read
+
+    file.close();
+
+    std::remove(filename.c_str());
+}
+
+TEST_CASE("Testing BinaryMemoryWriter and BinaryReader", "[BinaryStream]")
+{
+    Vec<char> buffer = { 'x', 'y', 'z' }; // existing contents are discarded
+
+    BinaryMemoryWriter writer(buffer);
+
+    CHECK( writer.offset() == 0 );
+
+    const Vec<double> values = { 1.0, 2.0, 3.0 };
+
+    writer.write<std::uint32_t>(42);
+    writer.align();
+    writer.writeString("Calcite");
+    writer.write(values.data(), values.size());
+
+    CHECK( buffer.size() == 8 + 16 + 3*8 );
+
+    BinaryReader reader(buffer.data(), buffer.size());
+
+    CHECK( reader.read<std::uint32_t>() == 42 );
+    reader.align();
+    CHECK( reader.readString() == "Calcite" );
+
+    auto const* view = reader.view<double>(3);
+
+    CHECK( view[0] == 1.0 );
+    CHECK( view[1] == 2.0 );
+    CHECK( view[2] == 3.0 );
+    CHECK( reader.remaining() == 0 );
+}
+
+TEST_CASE("Testing BinaryReader with corrupted sizes", "[BinaryStream]")
+{
+    Vec<char> buffer;
+
+    BinaryMemoryWriter writer(buffer);
+
+    const auto huge = std::numeric_limits<std::uint64_t>::max() / sizeof(double) + 2; // huge * sizeof(double) wraps around to 8
+    writer.write<std::uint64_t>(huge);
+    writer.write<double>(1.0);
+
+    BinaryReader reader(buffer.data(), buffer.size());
+
+    reader.seek(8);
+    CHECK_THROWS( reader.view<double>(huge) );
+    CHECK_THROWS( reader.skip(std::numeric_limits<Index>::max()) );
+
+    reader.seek(0);
+    CHECK_THROWS( reader.readCount(sizeof(double)) );
+
+    Vec<char> valid;
+
+    BinaryMemoryWriter validwriter(valid);
+    validwriter.write<std::uint64_t>(1);
+    validwriter.write<double>(1.0);
+
+    BinaryReader validreader(valid.data(), valid.size());
+
+    CHECK( validreader.readCount(sizeof(double)) == 1 );
+    CHECK( validreader.view<double>(1)[0] == 1.0 );
+}
@@ -0,0 +1,136 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <atomic>
+#include <mutex>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+/// Used to find the index of the first item in a list with a given key in constant time.
+/// The hash table mapping keys to indices is only built on the first lookup
+/// in a list with at least @ref minsize items (smaller lists are scanned
+/// linearly, which is faster) and is thread-safe to build. The owner of a
+/// HashIndex object must call @ref reset whenever its list changes or
+/// grants non-const access to its items, since the keys may then change. If
+/// items are only appended, @ref append updates the hash table instead.
+/// Copies of a HashIndex object start empty and are rebuilt when needed.
+template<typename Key>
+class HashIndex
+{
+public:
+    /// The minimum number of items in a list for which a hash table is built.
+    static constexpr Index minsize = 16;
+
+    /// Construct a default HashIndex object.
+    HashIndex()
+    {}
+
+    /// Construct a copy of a HashIndex object (the hash table is not copied).
+    HashIndex(HashIndex const&)
+    {}
+
+    /// Assign a HashIndex object to this (the hash table is not copied).
+    auto operator=(HashIndex const&) -> HashIndex&
+    {
+        reset();
+        return *this;
+    }
+
+    /// Discard the hash table so that it is rebuilt on the next lookup.
+    auto reset() -> void
+    {
+        if(mbuilt.load(std::memory_order_relaxed))
+        {
+            mtable.clear();
+            mbuilt.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    /// Update the hash table (if already built) with a new item appended to the list.
+    /// @param i The index of the new item in the list.
+    /// @param keyfn The function returning the key of the item with given index.
+    template<typename KeyFn>
+    auto append(Index i, KeyFn const& keyfn) -> void
+    {
+        if(mbuilt.load(std::memory_order_relaxed))
+            mtable.emplace(keyfn(i), i);
+    }
+
+    /// Return the index of the first item with given key or `size` if there is none.
+    /// @param key The key of the item to be found.
+    /// @param size The number of items in the list.
+    /// @param keyfn The function returning the key of the item with given index.
+    template<typename KeyFn>
+    auto find(Key const& key, Index size, KeyFn const& keyfn) const -> Index
+    {
+        if(size < minsize)
+            return scan(key, size, keyfn);
+
+        if(!mbuilt.load(std::memory_order_acquire))
+        {
+            std::lock_guard<std::mutex> lock(mmutex);
+            if(!mbuilt.load(std::memory_order_relaxed))
+            {
+                mtable.clear();
+                mtable.reserve(size);
+                for(Index i = 0; i < size; ++i)
+                    mtable.emplace(keyfn(i), i); // emplace keeps the first index of repeated keys
+                mbuilt.store(true, std::memory_order_release);
+            }
+        }
+
+        const auto it = mtable.find(key);
+
+        if(it == mtable.end())
+            return size;
+
+        // Items obtained by non-const reference before the hash table was
+        // built can still be changed afterwards, so confirm the key found.
+        if(it->second < size && keyfn(it->second) == key)
+            return it->second;
+
+        return scan(key, size, keyfn);
+    }
+
+private:
+    /// The hash table mapping the key of each item to its index.
+    mutable Map<Key, Index> mtable;
+
+    /// The flag indicating whether the hash table has been built.
+    mutable std::atomic<bool> mbuilt = false;
+
+    /// The mutex used to build the hash table in one thread only.
+    mutable std::mutex mmutex;
+
+    /// Return the index of the first item with given key using a linear scan.
+    template<typename KeyFn>
+    static auto scan(Key const& key, Index size, KeyFn const& keyfn) -> Index
+    {
+        for(Index i = 0; i < size; ++i)
+            if(keyfn(i) == key)
+                return i;
+        return size;
+    }
+};
+
+} // namespace Reaktoro
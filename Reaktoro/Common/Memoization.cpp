@@ -17,15 +17,79 @@
 
 #include "Memoization.hpp"
 
+// C++ includes
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <mutex>
+
 namespace Reaktoro {
 
-auto getMemoizationStatus() -> bool&
+auto getMemoizationStatus() -> std::atomic<bool>&
 {
     /// The global variable that holds status if memoization is currently enabled or disabled.
-    static bool memoization_active = true;
+    static std::atomic<bool> memoization_active = true;
     return memoization_active;
 }
 
+/// The global registry of the counters of memoized functions.
+struct MemoizationRegistry
+{
+    /// The mutex used to synchronize access to the registry.
+    std::mutex mutex;
+
+    /// The counters of the registered memoized functions (expired ones are removed as new ones are registered).
+    Vec<std::weak_ptr<detail::MemoizationCounters>> counters;
+
+    /// The number of registered counters above which expired ones are removed (doubled after each removal, so that registration has amortized constant cost).
+    Index threshold = 16;
+};
+
+/// Return the sums of the hits, misses and evictions of a memoized function in all threads.
+auto sumMemoizationCounters(detail::MemoizationCounters& counters) -> std::array<Index, 3>
+{
+    std::array<Index, 3> sums = {};
+    std::lock_guard<std::mutex> lock(counters.mutex);
+    for(auto const& local : counters.locals)
+    {
+        sums[0] += local.hits.load(std::memory_order_relaxed);
+        sums[1] += local.misses.load(std::memory_order_relaxed);
+        sums[2] += local.evictions.load(std::memory_order_relaxed);
+    }
+    return sums;
+}
+
+auto getMemoizationRegistry() -> MemoizationRegistry&
+{
+    static MemoizationRegistry registry;
+    return registry;
+}
+
+namespace detail {
+
+auto newMemoizationId() -> Index
+{
+    static std::atomic<Index> counter = 0;
+    return counter++;
+}
+
+auto registerMemoizationCounters(String const& name, Index capacity) -> SharedPtr<MemoizationCounters>
+{
+    auto counters = std::make_shared<MemoizationCounters>(name, capacity);
+    auto& registry = getMemoizationRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    auto& entries = registry.counters;
+    if(entries.size() >= registry.threshold)
+    {
+        entries.erase(std::remove_if(entries.begin(), entries.end(), [](auto const& entry) { return entry.expired(); }), entries.end());
+        registry.threshold = std::max<Index>(16, 2 * entries.size());
+    }
+    entries.push_back(counters);
+    return counters;
+}
+
+} // namespace detail
+
 auto Memoization::isEnabled() -> bool
 {
     return getMemoizationStatus();
@@ -46,4 +110,43 @@ auto Memoization::disable() -> void
     getMemoizationStatus() = false;
 }
 
+auto Memoization::stats() -> Vec<MemoizationStats>
+{
+    auto& registry = getMemoizationRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    Vec<MemoizationStats> res;
+    for(auto const& entry : registry.counters)
+    {
+        if(auto counters = entry.lock())
+        {
+            const auto [hits, misses, evictions] = sumMemoizationCounters(*counters);
+            MemoizationStats stats;
+            stats.name = counters->name;
+            stats.capacity = counters->capacity;
+            stats.hits = hits - counters->hits0;
+            stats.misses = misses - counters->misses0;
+            stats.evictions = evictions - counters->evictions0;
+            res.push_back(stats);
+        }
+    }
+    return res;
+}
+
+auto Memoization::resetStats() -> void
+{
+    auto& registry = getMemoizationRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for(auto const& entry : registry.counters)
+    {
+        if(auto counters = entry.lock())
+        {
+            // The counters of the threads are only written by their owner threads, so the current sums are stored and subtracted in Memoization::stats
+            const auto [hits, misses, evictions] = sumMemoizationCounters(*counters);
+            counters->hits0 = hits;
+            counters->misses0 = misses;
+            counters->evictions0 = evictions;
+        }
+    }
+}
+
 } // namespace Reaktoro
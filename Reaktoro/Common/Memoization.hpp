@@ -17,7 +17,17 @@
 
 #pragma once
 
+// C++ includes
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <list>
+#include <map>
+#include <mutex>
+#include <tuple>
+
 // Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Common/Meta.hpp>
 #include <Reaktoro/Common/TraitsUtils.hpp>
 #include <Reaktoro/Common/Types.hpp>
@@ -126,8 +136,243 @@ auto assignValues(Tuple1& tuple1, const Tuple2& tuple2)
 template<typename T>
 using CacheType = typename MemoizationTraits<Decay<T>>::CacheType;
 
+/// Return a new identifier for a memoized function that is never reused during the execution of the application.
+auto newMemoizationId() -> Index;
+
+/// Used to store the cache of a memoized function separately for each thread calling it.
+/// A memoized function (and all of its copies) owns a single PerThreadCache object. Each thread
+/// calling the memoized function gets its own cache object of type `Cache`, created on first use
+/// and kept in thread-local storage. Thus, memoized functions (e.g., the ones in the Model objects
+/// of the species in a ChemicalSystem object) can be shared among threads without data races.
+/// The cache objects are looked up first in a small thread-local table of slots indexed by the
+/// identifier of the memoized function. Since identifiers are consecutive, memoized functions
+/// that are called alternately (e.g., the standard thermodynamic models of the species in a
+/// phase) keep their own slots and their lookups do not require a search in the map of entries.
+template<typename Cache>
+class PerThreadCache
+{
+public:
+    /// Construct a PerThreadCache object.
+    PerThreadCache()
+    : id(newMemoizationId()), token(std::make_shared<char>())
+    {}
+
+    /// Return the cache object of the calling thread.
+    auto local() const -> Cache&
+    {
+        thread_local Map<Index, Entry> entries;
+        thread_local Slot slots[numslots];
+
+        auto& slot = slots[id % numslots];
+
+        if(slot.id == id)
+            return *slot.cache;
+
+        auto it = entries.find(id);
+
+        if(it == entries.end())
+        {
+            prune(entries);
+            it = entries.emplace(id, Entry{ token, Cache() }).first;
+        }
+
+        slot.id = id;
+        slot.cache = &it->second.cache;
+
+        return *slot.cache;
+    }
+
+private:
+    /// The number of slots in the thread-local table used to look up the cache objects.
+    static constexpr Index numslots = 64;
+
+    /// The cache object of a memoized function in the calling thread recently looked up in the map of entries.
+    /// The pointer remains valid after insertions into the map, and it is never
+    /// used after its entry is pruned since identifiers are never reused.
+    struct Slot
+    {
+        /// The identifier of the memoized function.
+        Index id = -1;
+
+        /// The cache object of the memoized function.
+        Cache* cache = nullptr;
+    };
+
+    /// The cache object of a memoized function in the calling thread.
+    struct Entry
+    {
+        /// The token of the PerThreadCache object owning this entry, used to know if the memoized function still exists.
+        std::weak_ptr<char> owner;
+
+        /// The cache object of the memoized function.
+        Cache cache;
+    };
+
+    /// Remove the entries of memoized functions that no longer exist (performed only when the number of entries has doubled since the last removal).
+    static auto prune(Map<Index, Entry>& entries) -> void
+    {
+        thread_local Index threshold = 16;
+        if(entries.size() < threshold)
+            return;
+        for(auto it = entries.begin(); it != entries.end();)
+            it = it->second.owner.expired() ? entries.erase(it) : std::next(it);
+        threshold = std::max<Index>(16, 2 * entries.size());
+    }
+
+    /// The unique identifier of the memoized function owning this PerThreadCache object.
+    const Index id;
+
+    /// The token whose lifetime tells the threads if the memoized function still exists.
+    const SharedPtr<char> token;
+};
+
+/// Used to count the hits, misses and evictions of a memoized function in all threads calling it.
+/// Each thread calling the memoized function counts in its own Local object, so that
+/// no atomic read-modify-write operation on memory shared among threads is performed
+/// in calls to the memoized function. The counts of all threads are summed in Memoization::stats.
+struct MemoizationCounters
+{
+    /// The counters of a memoized function in one thread, aligned to a cache line so that threads do not write to the same one.
+    /// Only the owner thread writes to these counters. They are atomic only so that Memoization::stats can read them concurrently.
+    struct alignas(64) Local
+    {
+        /// The number of calls in the thread that returned a cached result.
+        std::atomic<Index> hits = 0;
+
+        /// The number of calls in the thread that required evaluation of the original function.
+        std::atomic<Index> misses = 0;
+
+        /// The number of cached results in the thread removed to respect the capacity of the cache.
+        std::atomic<Index> evictions = 0;
+    };
+
+    /// The name of the memoized function.
+    const String name;
+
+    /// The maximum number of cached results per thread (zero if unbounded).
+    const Index capacity;
+
+    /// The mutex used to synchronize the creation of Local objects with Memoization::stats and Memoization::resetStats.
+    std::mutex mutex;
+
+    /// The counters of each thread that has called the memoized function (a list so that their addresses never change).
+    std::list<Local> locals;
+
+    /// The sums of the counters of all threads when Memoization::resetStats was last called.
+    Index hits0 = 0, misses0 = 0, evictions0 = 0;
+
+    /// Construct a MemoizationCounters object.
+    MemoizationCounters(String const& name, Index capacity) : name(name), capacity(capacity) {}
+
+    /// Return new counters for the calling thread (called once per thread, when its cache is created).
+    auto newLocal() -> Local&
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return locals.emplace_back();
+    }
+};
+
+/// Used to store the cache of a memoized function in a thread together with the counters of the thread.
+template<typename Cache>
+struct CountedCache
+{
+    /// The cache of the memoized function in the thread.
+    Cache cache;
+
+    /// The counters of the memoized function in the thread (created on first use).
+    MemoizationCounters::Local* counters = nullptr;
+};
+
+/// Return a new MemoizationCounters object for a memoized function registered in the global registry used by Memoization::stats.
+auto registerMemoizationCounters(String const& name, Index capacity) -> SharedPtr<MemoizationCounters>;
+
+/// Return the counters of the calling thread stored in a CountedCache object, creating them on first use.
+template<typename Cache>
+auto localCounters(CountedCache<Cache>& local, MemoizationCounters& counters) -> MemoizationCounters::Local&
+{
+    if(local.counters == nullptr)
+        local.counters = &counters.newLocal();
+    return *local.counters;
+}
+
+/// Increment a counter of a memoized function in the calling thread.
+/// Only the calling thread writes to the counter, so a relaxed load and store
+/// suffice (instead of an atomic read-modify-write operation).
+inline auto increment(std::atomic<Index>& counter) -> void
+{
+    counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+/// Used to check if a value of type `T` used as argument of a memoized function can be hashed with memoizationHash.
+template<typename T>
+constexpr auto isMemoizationHashable = std::is_same_v<T, real> || std::is_default_constructible_v<std::hash<T>>;
+
+/// Return the hash of a value used as argument of a memoized function.
+template<typename T>
+auto memoizationHash(const T& val) -> std::size_t
+{
+    if constexpr(std::is_same_v<T, real>)
+        return std::hash<double>{}(val.val());
+    else return std::hash<T>{}(val);
+}
+
+/// Used to hash the tuple of arguments of a memoized function.
+struct MemoizationTupleHash
+{
+    template<typename... Ts>
+    auto operator()(const Tuple<Ts...>& args) const -> std::size_t
+    {
+        std::size_t seed = 0;
+        std::apply([&](const auto&... x) { ((seed ^= memoizationHash(x) + 0x9e3779b9 + (seed << 6) + (seed >> 2)), ...); }, args);
+        return seed;
+    }
+};
+
+/// Used to map the tuples of arguments of a memoized function to values.
+/// A hash map is used if all arguments can be hashed with memoizationHash
+/// (i.e., `std::hash` is specialized for their types or they are `real`).
+/// Otherwise, an ordered map is used, which requires `operator<` for all
+/// arguments (e.g., `Vec<double>` and `Param` arguments).
+template<typename Value, typename... Args>
+using MemoizationMap = std::conditional_t<(isMemoizationHashable<Args> && ...),
+    std::unordered_map<Tuple<Args...>, Value, MemoizationTupleHash>,
+    std::map<Tuple<Args...>, Value>>;
+
+/// Used to store the results of a memoized function for the least recently used arguments up to a maximum capacity.
+template<typename Ret, typename... Args>
+struct MemoizeLRUCache
+{
+    /// The type of the tuple of arguments used as key in the cache.
+    using Key = Tuple<Decay<Args>...>;
+
+    /// The cached arguments and results, ordered from the most to the least recently used.
+    std::list<Pair<Key, Ret>> items;
+
+    /// The positions of the cached items for each tuple of arguments.
+    MemoizationMap<typename std::list<Pair<Key, Ret>>::iterator, Decay<Args>...> positions;
+};
+
 } // namespace detail
 
+/// Used to report the usage statistics of a memoized function.
+struct MemoizationStats
+{
+    /// The name of the memoized function.
+    String name;
+
+    /// The maximum number of cached results per thread (zero if unbounded).
+    Index capacity = 0;
+
+    /// The number of calls that returned a cached result.
+    Index hits = 0;
+
+    /// The number of calls that required evaluation of the original function.
+    Index misses = 0;
+
+    /// The number of cached results removed to respect the capacity of the cache.
+    Index evictions = 0;
+};
+
 /// The class used to control memoization in the application.
 class Memoization
 {
@@ -144,106 +389,231 @@ public:
     /// Disable memoization optimization.
     static auto disable() -> void;
 
+    /// Return the usage statistics of the existing memoized functions created with @ref memoize, @ref memoizeLRU, @ref memoizeLast or @ref memoizeLastUsingRef.
+    static auto stats() -> Vec<MemoizationStats>;
+
+    /// Reset the usage statistics of the existing memoized functions created with @ref memoize, @ref memoizeLRU, @ref memoizeLast or @ref memoizeLastUsingRef.
+    static auto resetStats() -> void;
+
     /// Deleted default constructor.
     Memoization() = delete;
 };
 
-/// Return a memoized version of given function `f`.
+/// Return a memoized version of given function `f` that caches the results of all distinct arguments.
+/// @note Each thread calling the memoized function (or any of its copies) uses its own cache.
+/// @note The cache grows without bound. Use @ref memoizeLRU if the arguments vary continuously.
+/// @note The arguments must either be hashable with `std::hash` (or be `real`) or comparable with `operator<` (see detail::MemoizationMap).
+/// @param f The function to be memoized.
+/// @param name The name of the memoized function used in @ref Memoization::stats.
 template<typename Ret, typename... Args>
-auto memoize(Fn<Ret(Args...)> f) -> Fn<Ret(Args...)>
+auto memoize(Fn<Ret(Args...)> f, String const& name = "memoize") -> Fn<Ret(Args...)>
 {
-    auto cache = std::make_shared<Map<Tuple<Args...>, Ret>>();
-    return [=](Args... args) mutable -> Ret
+    using Key = Tuple<Decay<Args>...>;
+    using Cache = detail::MemoizationMap<Ret, Decay<Args>...>;
+    auto caches = std::make_shared<detail::PerThreadCache<detail::CountedCache<Cache>>>();
+    auto counters = detail::registerMemoizationCounters(name, 0);
+    return [=](Args... args) -> Ret
     {
         if(Memoization::isDisabled())
             return f(args...);
-        Tuple<Args...> t(args...);
-        if(cache->find(t) == cache->end())
-            (*cache)[t] = f(args...);
-        return (*cache)[t];
+        auto& local = caches->local();
+        auto& cache = local.cache;
+        auto& counts = detail::localCounters(local, *counters);
+        Key key(args...);
+        auto it = cache.find(key);
+        if(it != cache.end())
+        {
+            detail::increment(counts.hits);
+            return it->second;
+        }
+        detail::increment(counts.misses);
+        return cache.emplace(std::move(key), f(args...)).first->second;
     };
 }
 
-/// Return a memoized version of given function `f`.
+/// Return a memoized version of given function `f` that caches the results of all distinct arguments.
 template<typename Fun, Requires<!isFunction<Fun>> = true>
-auto memoize(Fun f)
+auto memoize(Fun f, String const& name = "memoize")
 {
-    return memoize(asFunction(f));
+    return memoize(asFunction(f), name);
 }
 
-/// Return a memoized version of given function `f` that caches only the arguments used in the last call.
+/// Return a memoized version of given function `f` that caches the results of the least recently used arguments.
+/// At most `capacity` results are cached. When a result for new arguments needs
+/// to be cached and the cache is full, the result of the least recently used
+/// arguments is removed. A hit requires a single lookup of the arguments.
+/// @note Each thread calling the memoized function (or any of its copies) uses its own cache.
+/// @note The arguments must either be hashable with `std::hash` (or be `real`) or comparable with `operator<` (see detail::MemoizationMap).
+/// @param f The function to be memoized.
+/// @param capacity The maximum number of cached results (per thread).
+/// @param name The name of the memoized function used in @ref Memoization::stats.
 template<typename Ret, typename... Args>
-auto memoizeLast(Fn<Ret(Args...)> f) -> Fn<Ret(Args...)>
+auto memoizeLRU(Fn<Ret(Args...)> f, Index capacity, String const& name = "memoizeLRU") -> Fn<Ret(Args...)>
 {
-    Tuple<detail::CacheType<Args>...> cache;
+    errorif(capacity == 0, "Expecting a positive capacity for the cache of memoized function `", name, "`.");
+    using Cache = detail::MemoizeLRUCache<Ret, Args...>;
+    using Key = typename Cache::Key;
+    auto caches = std::make_shared<detail::PerThreadCache<detail::CountedCache<Cache>>>();
+    auto counters = detail::registerMemoizationCounters(name, capacity);
+    return [=](Args... args) -> Ret
+    {
+        if(Memoization::isDisabled())
+            return f(args...);
+        auto& local = caches->local();
+        auto& cache = local.cache;
+        auto& counts = detail::localCounters(local, *counters);
+        Key key(args...);
+        auto it = cache.positions.find(key);
+        if(it != cache.positions.end())
+        {
+            detail::increment(counts.hits);
+            cache.items.splice(cache.items.begin(), cache.items, it->second); // move the item to the front as the most recently used
+            return it->second->second;
+        }
+        detail::increment(counts.misses);
+        if(cache.items.size() == capacity)
+        {
+            cache.positions.erase(cache.items.back().first);
+            cache.items.pop_back();
+            detail::increment(counts.evictions);
+        }
+        cache.items.emplace_front(key, f(args...));
+        cache.positions.emplace(std::move(key), cache.items.begin());
+        return cache.items.front().second;
+    };
+}
+
+/// Return a memoized version of given function `f` that caches the results of the least recently used arguments.
+template<typename Fun, Requires<!isFunction<Fun>> = true>
+auto memoizeLRU(Fun f, Index capacity, String const& name = "memoizeLRU")
+{
+    return memoizeLRU(asFunction(f), capacity, name);
+}
+
+namespace detail {
+
+/// Used to store the arguments and result of the last call of a memoized function.
+template<typename Ret, typename... Args>
+struct MemoizeLastCache
+{
+    /// The arguments used in the last call.
+    Tuple<CacheType<Args>...> args;
+
+    /// The result of the last call.
     Ret result = Ret();
-    auto firsttime = true;
-    return [=](Args... args) mutable -> Ret
+
+    /// True if the memoized function has not yet been called.
+    bool firsttime = true;
+};
+
+} // namespace detail
+
+namespace detail {
+
+/// Return the cached result of the last call of a memoized function in the calling thread if its arguments are the same, or `nullptr` otherwise.
+/// The hits, misses and evictions of the memoized function in the calling thread are counted.
+template<typename Ret, typename... Args, typename... Ts>
+auto memoizeLastLookup(CountedCache<MemoizeLastCache<Ret, Args...>>& local, MemoizationCounters& counters, Ts const&... args) -> Ret const*
+{
+    auto& cache = local.cache;
+    auto& counts = localCounters(local, counters);
+    if(!cache.firsttime && sameValues(cache.args, std::tie(args...)))
+    {
+        increment(counts.hits);
+        return &cache.result;
+    }
+    increment(counts.misses);
+    if(!cache.firsttime)
+        increment(counts.evictions);
+    return nullptr;
+}
+
+} // namespace detail
+
+/// Return a memoized version of given function `f` that caches only the arguments used in the last call.
+/// @note Each thread calling the memoized function (or any of its copies) uses its own cache.
+/// @param f The function to be memoized.
+/// @param name The name of the memoized function used in @ref Memoization::stats.
+template<typename Ret, typename... Args>
+auto memoizeLast(Fn<Ret(Args...)> f, String const& name = "memoizeLast") -> Fn<Ret(Args...)>
+{
+    using Cache = detail::MemoizeLastCache<Ret, Args...>;
+    auto caches = std::make_shared<detail::PerThreadCache<detail::CountedCache<Cache>>>();
+    auto counters = detail::registerMemoizationCounters(name, 1);
+    return [=](Args... args) -> Ret
     {
         if(Memoization::isDisabled())
             return f(args...);
-        if(detail::sameValues(cache, std::tie(args...)) && !firsttime)
-            return Ret(result);
-        detail::assignValues(cache, std::tie(args...));
-        firsttime = false;
-        return result = f(args...);
+        auto& local = caches->local();
+        if(auto cached = detail::memoizeLastLookup(local, *counters, args...))
+            return Ret(*cached);
+        auto& cache = local.cache;
+        cache.result = f(args...);
+        detail::assignValues(cache.args, std::tie(args...));
+        cache.firsttime = false;
+        return Ret(cache.result);
     };
 }
 
 /// Return a memoized version of given function `f` that caches only the arguments used in the last call.
 template<typename Fun, Requires<!isFunction<Fun>> = true>
-auto memoizeLast(Fun f)
+auto memoizeLast(Fun f, String const& name = "memoizeLast")
 {
-    return memoizeLast(asFunction(f));
+    return memoizeLast(asFunction(f), name);
 }
 
 /// Return a memoized version of given function `f` that caches only the arguments used in the last call.
+/// @note Each thread calling the memoized function (or any of its copies) uses its own cache.
+/// @param f The function to be memoized.
+/// @param name The name of the memoized function used in @ref Memoization::stats.
 template<typename Ret, typename RetRef, typename... Args>
-auto memoizeLastUsingRef(Fn<void(RetRef, Args...)> f) -> Fn<void(RetRef, Args...)>
+auto memoizeLastUsingRef(Fn<void(RetRef, Args...)> f, String const& name = "memoizeLastUsingRef") -> Fn<void(RetRef, Args...)>
 {
-    Tuple<detail::CacheType<Args>...> cache;
-    Ret result = Ret();
-    auto firsttime = true;
-    return [=](RetRef res, Args... args) mutable -> void
+    using Cache = detail::MemoizeLastCache<Ret, Args...>;
+    auto caches = std::make_shared<detail::PerThreadCache<detail::CountedCache<Cache>>>();
+    auto counters = detail::registerMemoizationCounters(name, 1);
+    return [=](RetRef res, Args... args) -> void
     {
         if(Memoization::isDisabled())
-            f(res, args...);
-        else if(detail::sameValues(cache, std::tie(args...)) && !firsttime)
-            res = result;
+            return f(res, args...);
+        auto& local = caches->local();
+        if(auto cached = detail::memoizeLastLookup(local, *counters, args...))
+            res = *cached;
         else
         {
+            auto& cache = local.cache;
             f(res, args...);
-            result = res;
-            detail::assignValues(cache, std::tie(args...));
+            cache.result = res;
+            detail::assignValues(cache.args, std::tie(args...));
+            cache.firsttime = false;
         }
-        firsttime = false;
     };
 }
 
-/// Return a memoized version of given function `f` that caches only the arguments used in the last call./// Return a memoized version of given function `f` that caches only the arguments used in the last call.
+/// Return a memoized version of given function `f` that caches only the arguments used in the last call.
 /// This overload is used when `f` is a lambda function or free function.
 /// Use `memoizeLastUsingRef<Ret>(f)` to explicitly specify the `Ret` type.
 template<typename Ret, typename Fun, Requires<!isFunction<Fun>> = true>
-auto memoizeLastUsingRef(Fun f)
+auto memoizeLastUsingRef(Fun f, String const& name = "memoizeLastUsingRef")
 {
-    return memoizeLastUsingRef<Ret>(asFunction(f));
+    return memoizeLastUsingRef<Ret>(asFunction(f), name);
 }
 
 /// Return a memoized version of given function `f` that caches only the arguments used in the last call.
 /// This overload assumes that `RetRef = Ret&`.
 template<typename Ret, typename... Args>
-auto memoizeLastUsingRef(Fn<void(Ret&, Args...)> f) -> Fn<void(Ret&, Args...)>
+auto memoizeLastUsingRef(Fn<void(Ret&, Args...)> f, String const& name = "memoizeLastUsingRef") -> Fn<void(Ret&, Args...)>
 {
-    return memoizeLastUsingRef<Ret, Ret&>(f);
+    return memoizeLastUsingRef<Ret, Ret&>(f, name);
 }
 
 /// Return a memoized version of given function `f` that caches only the arguments used in the last call.
 /// This overload is used when `f` is a lambda function or free function.
 /// Use `memoizeLastUsingRef(f)` to implicitly specify that `RetRef` is `Ret&`.
 template<typename Fun, Requires<!isFunction<Fun>> = true>
-auto memoizeLastUsingRef(Fun f)
+auto memoizeLastUsingRef(Fun f, String const& name = "memoizeLastUsingRef")
 {
-    return memoizeLastUsingRef(asFunction(f));
+    return memoizeLastUsingRef(asFunction(f), name);
 }
 
 } // namespace Reaktoro
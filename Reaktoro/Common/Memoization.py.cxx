@@ -24,10 +24,21 @@ using namespace Reaktoro;
 
 void exportMemoization(py::module& m)
 {
+    py::class_<MemoizationStats>(m, "MemoizationStats")
+        .def(py::init<>())
+        .def_readwrite("name", &MemoizationStats::name)
+        .def_readwrite("capacity", &MemoizationStats::capacity)
+        .def_readwrite("hits", &MemoizationStats::hits)
+        .def_readwrite("misses", &MemoizationStats::misses)
+        .def_readwrite("evictions", &MemoizationStats::evictions)
+        ;
+
     py::class_<Memoization>(m, "Memoization")
         .def_static("isEnabled", &Memoization::isEnabled, "Return true if memoization is currently enabled.")
         .def_static("isDisabled", &Memoization::isDisabled, "Return true if memoization is currently disabled.")
         .def_static("enable" , &Memoization::enable , "Enable memoization optimization.")
         .def_static("disable", &Memoization::disable, "Disable memoization optimization.")
+        .def_static("stats", &Memoization::stats, "Return the usage statistics of the existing memoized functions created with memoize, memoizeLRU, memoizeLast or memoizeLastUsingRef.")
+        .def_static("resetStats", &Memoization::resetStats, "Reset the usage statistics of the existing memoized functions created with memoize, memoizeLRU, memoizeLast or memoizeLastUsingRef.")
         ;
 }
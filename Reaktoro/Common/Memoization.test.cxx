@@ -15,6 +15,10 @@
 // You should have received a copy of the GNU Lesser General Public License
 // along with this library. If not, see <http://www.gnu.org/licenses/>.
 
+// C++ includes
+#include <atomic>
+#include <thread>
+
 // Catch includes
 #include <catch2/catch.hpp>
 
@@ -126,3 +130,235 @@ TEST_CASE("Testing Memoization - memoizeLast without return", "[Memoization]")
 
     CHECK( counter == 5 ); // two increments above, in f1 and f2, because of different arguments
 }
+
+TEST_CASE("Testing Memoization - memoizeLast with multiple threads", "[Memoization]")
+{
+    std::atomic<int> counter = 0; // a counter for how many times f1 below has been fully evaluated
+
+    auto f1 = [&](double x) -> double
+    {
+        ++counter;
+        return 2.0 * x;
+    };
+
+    const auto f2 = memoizeLast(f1); // f2 is the memoized version of f1 shared by all threads below
+    const auto f3 = f2; // f3 is a copy of f2 and thus shares its per-thread caches
+
+    const auto numthreads = 4;
+    const auto numcalls = 1000;
+
+    std::atomic<int> failures = 0;
+
+    auto work = [&](int ithread)
+    {
+        const double x = ithread; // each thread uses a different argument
+        for(auto i = 0; i < numcalls; ++i)
+            if(f2(x) != 2.0 * x || f3(x) != 2.0 * x)
+                ++failures;
+    };
+
+    Vec<std::thread> threads;
+    for(auto i = 0; i < numthreads; ++i)
+        threads.emplace_back(work, i);
+    for(auto& thread : threads)
+        thread.join();
+
+    CHECK( failures == 0 );
+    CHECK( counter == numthreads ); // each thread has its own cache and evaluates f1 only once, even with interleaved calls from other threads
+
+    f2(-1.0); // change the cache of the main thread
+    f3(-1.0); // same argument with the copy - no new evaluation
+
+    CHECK( counter == numthreads + 1 );
+}
+
+TEST_CASE("Testing Memoization - memoizeLast with alternating memoized functions", "[Memoization]")
+{
+    int counter = 0; // a counter for how many times the functions below have been fully evaluated
+
+    const auto numfuncs = 100; // more memoized functions than slots used for looking up their caches
+
+    Vec<Fn<double(double)>> funcs;
+    for(auto k = 0; k < numfuncs; ++k)
+        funcs.push_back(memoizeLast([&counter, k](double x) { ++counter; return k * x; }));
+
+    for(auto i = 0; i < 3; ++i)
+        for(auto k = 0; k < numfuncs; ++k)
+            CHECK( funcs[k](2.0) == 2.0 * k ); // each memoized function is evaluated only in the first pass
+
+    CHECK( counter == numfuncs );
+
+    for(auto k = 0; k < numfuncs; ++k)
+        CHECK( funcs[k](3.0) == 3.0 * k ); // new argument for all memoized functions
+
+    CHECK( counter == 2 * numfuncs );
+}
+
+TEST_CASE("Testing Memoization - memoized functions with statistics", "[Memoization]")
+{
+    int counter = 0; // a counter for how many times f1 below has been fully evaluated
+
+    auto f1 = [&](double x, int y) -> double
+    {
+        ++counter;
+        return x * y;
+    };
+
+    auto findStats = [](String const& name)
+    {
+        for(auto const& stats : Memoization::stats())
+            if(stats.name == name)
+                return stats;
+        return MemoizationStats{};
+    };
+
+    SECTION("Using memoize")
+    {
+        auto f2 = memoize(f1, "TestingMemoize");
+
+        CHECK( f2(2.0, 3) == 6.0 );
+        CHECK( f2(4.0, 3) == 12.0 );
+        CHECK( f2(2.0, 3) == 6.0 );
+        CHECK( f2(4.0, 3) == 12.0 );
+
+        CHECK( counter == 2 );
+
+        const auto stats = findStats("TestingMemoize");
+
+        CHECK( stats.capacity == 0 );
+        CHECK( stats.hits == 2 );
+        CHECK( stats.misses == 2 );
+        CHECK( stats.evictions == 0 );
+    }
+
+    SECTION("Using memoizeLRU")
+    {
+        auto f2 = memoizeLRU(f1, 2, "TestingMemoizeLRU");
+
+        CHECK( f2(1.0, 1) == 1.0 ); // miss: cache is [(1,1)]
+        CHECK( f2(2.0, 1) == 2.0 ); // miss: cache is [(2,1), (1,1)]
+        CHECK( f2(1.0, 1) == 1.0 ); // hit:  cache is [(1,1), (2,1)]
+        CHECK( f2(3.0, 1) == 3.0 ); // miss: (2,1) is evicted and cache is [(3,1), (1,1)]
+        CHECK( f2(1.0, 1) == 1.0 ); // hit:  cache is [(1,1), (3,1)]
+        CHECK( f2(2.0, 1) == 2.0 ); // miss: (3,1) is evicted and cache is [(2,1), (1,1)]
+
+        CHECK( counter == 4 );
+
+        auto stats = findStats("TestingMemoizeLRU");
+
+        CHECK( stats.capacity == 2 );
+        CHECK( stats.hits == 2 );
+        CHECK( stats.misses == 4 );
+        CHECK( stats.evictions == 2 );
+
+        Memoization::resetStats();
+
+        stats = findStats("TestingMemoizeLRU");
+
+        CHECK( stats.hits == 0 );
+        CHECK( stats.misses == 0 );
+        CHECK( stats.evictions == 0 );
+    }
+
+    SECTION("Using memoizeLast and memoizeLastUsingRef")
+    {
+        auto f2 = memoizeLast(f1, "TestingMemoizeLast");
+
+        CHECK( f2(1.0, 1) == 1.0 ); // miss
+        CHECK( f2(1.0, 1) == 1.0 ); // hit
+        CHECK( f2(2.0, 1) == 2.0 ); // miss: (1,1) is evicted
+        CHECK( f2(2.0, 1) == 2.0 ); // hit
+        CHECK( f2(2.0, 1) == 2.0 ); // hit
+
+        auto stats = findStats("TestingMemoizeLast");
+
+        CHECK( stats.capacity == 1 );
+        CHECK( stats.hits == 3 );
+        CHECK( stats.misses == 2 );
+        CHECK( stats.evictions == 1 );
+
+        Memoization::resetStats();
+
+        CHECK( f2(2.0, 1) == 2.0 ); // hit
+
+        stats = findStats("TestingMemoizeLast");
+
+        CHECK( stats.hits == 1 );
+        CHECK( stats.misses == 0 );
+        CHECK( stats.evictions == 0 );
+
+        auto g1 = [&](double& res, double x) { ++counter; res = 2.0 * x; };
+        auto g2 = memoizeLastUsingRef<double>(g1, "TestingMemoizeLastUsingRef");
+
+        double res = 0.0;
+        g2(res, 1.0); // miss
+        g2(res, 1.0); // hit
+
+        CHECK( res == 2.0 );
+
+        stats = findStats("TestingMemoizeLastUsingRef");
+
+        CHECK( stats.hits == 1 );
+        CHECK( stats.misses == 1 );
+    }
+
+    SECTION("Using memoizeLast with multiple threads")
+    {
+        const auto f2 = memoizeLast(asFunction([](double x, int y) { return x * y; }), "TestingMemoizeLastThreads");
+
+        const auto numthreads = 4;
+        const auto numcalls = 1000;
+
+        auto work = [&](int ithread)
+        {
+            for(auto i = 0; i < numcalls; ++i)
+                f2(ithread, 1); // one miss in the first call of each thread and hits afterwards
+        };
+
+        Vec<std::thread> threads;
+        for(auto i = 0; i < numthreads; ++i)
+            threads.emplace_back(work, i);
+        for(auto& thread : threads)
+            thread.join();
+
+        const auto stats = findStats("TestingMemoizeLastThreads"); // the counts of all threads are summed
+
+        CHECK( stats.hits == numthreads * (numcalls - 1) );
+        CHECK( stats.misses == numthreads );
+        CHECK( stats.evictions == 0 );
+    }
+
+    SECTION("Using memoize and memoizeLRU with arguments without std::hash")
+    {
+        // Arguments of type Vec<double> cannot be hashed, so the caches use ordered maps instead
+        static_assert(isSame<detail::MemoizationMap<double, double, int>, std::unordered_map<Tuple<double, int>, double, detail::MemoizationTupleHash>>);
+        static_assert(isSame<detail::MemoizationMap<double, Vec<double>, int>, std::map<Tuple<Vec<double>, int>, double>>);
+
+        auto g1 = [&](Vec<double> const& x, int y) -> double
+        {
+            ++counter;
+            return x.front() * y;
+        };
+
+        auto g2 = memoize(g1);
+        auto g3 = memoizeLRU(g1, 1);
+
+        CHECK( g2(Vec<double>{2.0}, 3) == 6.0 );
+        CHECK( g2(Vec<double>{2.0}, 3) == 6.0 );
+        CHECK( g3(Vec<double>{4.0}, 3) == 12.0 );
+        CHECK( g3(Vec<double>{4.0}, 3) == 12.0 );
+
+        CHECK( counter == 2 );
+    }
+
+    SECTION("Checking memoized functions that no longer exist are not reported")
+    {
+        {
+            auto f2 = memoizeLRU(f1, 4, "TestingMemoizeLRUTemporary");
+            f2(1.0, 1);
+            CHECK( findStats("TestingMemoizeLRUTemporary").misses == 1 );
+        }
+
+        CHECK( findStats("TestingMemoizeLRUTemporary").name.empty() );
+    }
+}
@@ -0,0 +1,367 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "Profiler.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+
+// Platform includes
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define REAKTORO_PROFILER_USE_TSC
+#elif defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#define REAKTORO_PROFILER_USE_TSC
+#endif
+
+namespace Reaktoro {
+namespace detail {
+
+/// The index used to denote the absence of a node in the call tree.
+const auto nonode = static_cast<Index>(-1);
+
+/// A counter in the call tree of a thread, updated by the thread and read by others with relaxed atomic operations.
+template<typename T>
+struct ProfilerCounter
+{
+    /// The value of the counter.
+    std::atomic<T> value = 0;
+
+    /// Construct a default ProfilerCounter object.
+    ProfilerCounter() = default;
+
+    /// Construct a copy of a ProfilerCounter object (only when the call tree grows, under the mutex of its buffer).
+    ProfilerCounter(ProfilerCounter const& other) : value(other.load()) {}
+
+    /// Return the value of the counter.
+    auto load() const -> T { return value.load(std::memory_order_relaxed); }
+
+    /// Add to the value of the counter.
+    auto add(T x) -> void { value.fetch_add(x, std::memory_order_relaxed); }
+
+    /// Set the value of the counter to zero.
+    auto reset() -> void { value.store(0, std::memory_order_relaxed); }
+};
+
+/// A node in the call tree of the profiling zones of a thread.
+struct ProfilerNode
+{
+    /// The name of the zone.
+    Chars name = "";
+
+    /// The index of the enclosing zone.
+    Index parent = nonode;
+
+    /// The index of the first zone nested in this zone.
+    Index firstchild = nonode;
+
+    /// The index of the next zone nested in the same enclosing zone.
+    Index nextsibling = nonode;
+
+    /// The number of times the zone was entered.
+    ProfilerCounter<Index> calls;
+
+    /// The accumulated ticks spent in the zone.
+    ProfilerCounter<std::uint64_t> inclusive;
+
+    /// The accumulated ticks spent in the zones nested in this zone.
+    ProfilerCounter<std::uint64_t> children;
+};
+
+struct ProfilerThreadBuffer
+{
+    /// The mutex used to synchronize the growth of the call tree with the collection of statistics.
+    std::mutex mutex;
+
+    /// The nodes of the call tree of the thread (the first node is the root of the tree).
+    Vec<ProfilerNode> nodes = { ProfilerNode{} };
+
+    /// The index of the zone the thread is currently in.
+    Index current = 0;
+};
+
+} // namespace detail
+
+namespace {
+
+using detail::nonode;
+using detail::ProfilerNode;
+using detail::ProfilerThreadBuffer;
+
+/// Return the current time stamp in clock ticks.
+inline auto ticks() -> std::uint64_t
+{
+#ifdef REAKTORO_PROFILER_USE_TSC
+    return __rdtsc();
+#else
+    const auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+#endif
+}
+
+/// The time stamps at program start used to convert clock ticks into seconds.
+const auto reference_ticks = ticks();
+const auto reference_time = std::chrono::steady_clock::now();
+
+/// Return the duration of a clock tick (in s).
+auto secondsPerTick() -> double
+{
+#ifdef REAKTORO_PROFILER_USE_TSC
+    const auto dticks = ticks() - reference_ticks;
+    const auto dtime = std::chrono::duration<double>(std::chrono::steady_clock::now() - reference_time).count();
+    return dticks ? dtime / dticks : 0.0;
+#else
+    return 1e-9;
+#endif
+}
+
+/// Return the global status of the profiler.
+auto getProfilerStatus() -> std::atomic<bool>&
+{
+    static std::atomic<bool> profiler_active = false;
+    return profiler_active;
+}
+
+/// The global registry of the profiling buffers of all threads (including those that have finished).
+struct ProfilerRegistry
+{
+    /// The mutex used to synchronize access to the registry.
+    std::mutex mutex;
+
+    /// The profiling buffers of the threads.
+    Vec<SharedPtr<ProfilerThreadBuffer>> buffers;
+};
+
+auto getProfilerRegistry() -> ProfilerRegistry&
+{
+    static ProfilerRegistry registry;
+    return registry;
+}
+
+/// Return the profiling buffer of the current thread, registering it on first use.
+auto getProfilerThreadBuffer() -> ProfilerThreadBuffer&
+{
+    // The buffer is owned by the registry so that it outlives the thread and
+    // the pointer below is trivially initialized (no thread_local guard check).
+    thread_local ProfilerThreadBuffer* buffer = nullptr;
+    if(!buffer)
+    {
+        auto& registry = getProfilerRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.buffers.push_back(std::make_shared<ProfilerThreadBuffer>());
+        buffer = registry.buffers.back().get();
+    }
+    return *buffer;
+}
+
+/// A node in the call tree of the profiling zones merged across all threads.
+struct MergedNode
+{
+    String name;
+    Index calls = 0;
+    std::uint64_t inclusive = 0;
+    std::uint64_t children = 0;
+    Vec<Index> nested;
+};
+
+/// Merge the subtree of a thread's call tree rooted at node `inode` into the merged tree node `imerged`.
+auto mergeProfilerNodes(Vec<ProfilerNode> const& nodes, Index inode, Vec<MergedNode>& merged, Index imerged) -> void
+{
+    for(auto ichild = nodes[inode].firstchild; ichild != nonode; ichild = nodes[ichild].nextsibling)
+    {
+        auto const& child = nodes[ichild];
+        auto const& nested = merged[imerged].nested;
+        auto it = std::find_if(nested.begin(), nested.end(), [&](Index i) { return merged[i].name == child.name; });
+        Index imchild = merged.size();
+        if(it == nested.end())
+        {
+            merged.push_back(MergedNode{ child.name });
+            merged[imerged].nested.push_back(imchild);
+        }
+        else imchild = *it;
+        merged[imchild].calls += child.calls.load();
+        merged[imchild].inclusive += child.inclusive.load();
+        merged[imchild].children += child.children.load();
+        mergeProfilerNodes(nodes, ichild, merged, imchild);
+    }
+}
+
+/// Collect the statistics of the merged tree in depth-first order with siblings in decreasing order of inclusive time.
+auto collectProfilerStats(Vec<MergedNode>& merged, Index imerged, String const& path, Index depth, double spt, Vec<ProfilerZoneStats>& stats) -> void
+{
+    auto nested = merged[imerged].nested;
+    std::stable_sort(nested.begin(), nested.end(), [&](Index i, Index j) { return merged[i].inclusive > merged[j].inclusive; });
+    for(auto i : nested)
+    {
+        auto const& node = merged[i];
+        if(node.calls == 0)
+            continue;
+        ProfilerZoneStats zone;
+        zone.name = node.name;
+        zone.path = path.empty() ? node.name : path + "/" + node.name;
+        zone.depth = depth;
+        zone.calls = node.calls;
+        zone.inclusive = node.inclusive * spt;
+        zone.exclusive = (node.inclusive - std::min(node.children, node.inclusive)) * spt;
+        stats.push_back(zone);
+        collectProfilerStats(merged, i, zone.path, depth + 1, spt, stats);
+    }
+}
+
+} // namespace
+
+auto ProfilerZone::enter(Chars name) -> void
+{
+    if(!getProfilerStatus().load(std::memory_order_relaxed))
+        return;
+
+    auto& buffer = getProfilerThreadBuffer();
+    auto& nodes = buffer.nodes;
+    const auto parent = buffer.current;
+
+    // Find the zone among those nested in the current zone (zone names are compared by address only)
+    auto last = nonode;
+    auto node = nodes[parent].firstchild;
+    while(node != nonode && nodes[node].name != name)
+    {
+        last = node;
+        node = nodes[node].nextsibling;
+    }
+
+    // Create the zone in the call tree if this is the first time it is entered from the current zone
+    if(node == nonode)
+    {
+        std::lock_guard<std::mutex> lock(buffer.mutex);
+        node = nodes.size();
+        nodes.push_back(ProfilerNode{ name, parent });
+        if(last == nonode)
+            nodes[parent].firstchild = node;
+        else nodes[last].nextsibling = node;
+    }
+
+    buffer.current = node;
+    mbuffer = &buffer;
+    mnode = node;
+    mstart = ticks();
+}
+
+auto ProfilerZone::leave() -> void
+{
+    const auto elapsed = ticks() - mstart;
+    auto& nodes = mbuffer->nodes;
+    auto& node = nodes[mnode];
+    node.calls.add(1);
+    node.inclusive.add(elapsed);
+    nodes[node.parent].children.add(elapsed);
+    mbuffer->current = node.parent;
+}
+
+auto Profiler::isEnabled() -> bool
+{
+    return getProfilerStatus().load();
+}
+
+auto Profiler::isDisabled() -> bool
+{
+    return !isEnabled();
+}
+
+auto Profiler::enable() -> void
+{
+    getProfilerStatus().store(true);
+}
+
+auto Profiler::disable() -> void
+{
+    getProfilerStatus().store(false);
+}
+
+auto Profiler::stats() -> Vec<ProfilerZoneStats>
+{
+    Vec<MergedNode> merged = { MergedNode{} };
+    auto& registry = getProfilerRegistry();
+    {
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        for(auto const& buffer : registry.buffers)
+        {
+            std::lock_guard<std::mutex> lock(buffer->mutex);
+            mergeProfilerNodes(buffer->nodes, 0, merged, 0);
+        }
+    }
+    Vec<ProfilerZoneStats> stats;
+    collectProfilerStats(merged, 0, "", 0, secondsPerTick(), stats);
+    return stats;
+}
+
+auto Profiler::resetStats() -> void
+{
+    // The call trees are kept so that zones currently entered remain valid.
+    auto& registry = getProfilerRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for(auto const& buffer : registry.buffers)
+    {
+        std::lock_guard<std::mutex> lock(buffer->mutex);
+        for(auto& node : buffer->nodes)
+        {
+            node.calls.reset();
+            node.inclusive.reset();
+            node.children.reset();
+        }
+    }
+}
+
+auto Profiler::report() -> String
+{
+    const auto stats = Profiler::stats();
+
+    auto total = 0.0;
+    auto width = String("Zone").size();
+    for(auto const& zone : stats)
+    {
+        if(zone.depth == 0)
+            total += zone.inclusive;
+        width = std::max(width, 2*zone.depth + zone.name.size());
+    }
+
+    std::stringstream ss;
+    ss << std::left << std::setw(width) << "Zone" << std::right
+       << std::setw(12) << "Calls"
+       << std::setw(18) << "Inclusive (s)"
+       << std::setw(18) << "Exclusive (s)"
+       << std::setw(14) << "Inclusive (%)" << "\n";
+    ss << String(width + 12 + 18 + 18 + 14, '-') << "\n";
+    for(auto const& zone : stats)
+    {
+        const auto percent = total > 0.0 ? 100.0 * zone.inclusive / total : 0.0;
+        ss << std::left << std::setw(width) << (String(2*zone.depth, ' ') + zone.name) << std::right
+           << std::setw(12) << zone.calls
+           << std::scientific << std::setprecision(6)
+           << std::setw(18) << zone.inclusive
+           << std::setw(18) << zone.exclusive
+           << std::fixed << std::setprecision(2)
+           << std::setw(14) << percent << "\n";
+    }
+    return ss.str();
+}
+
+} // namespace Reaktoro
@@ -0,0 +1,143 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <cstdint>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+/// Used to report the aggregated timing statistics of a profiling zone.
+/// The statistics of zones with the same name and the same chain of
+/// enclosing zones are merged across all threads.
+struct ProfilerZoneStats
+{
+    /// The name of the profiling zone.
+    String name;
+
+    /// The names of the enclosing zones and of this zone separated by `/`.
+    String path;
+
+    /// The nesting level of the zone in the call tree (zero for top-level zones).
+    Index depth = 0;
+
+    /// The number of times the zone was entered.
+    Index calls = 0;
+
+    /// The total time spent in the zone, including its nested zones (in s).
+    double inclusive = 0.0;
+
+    /// The total time spent in the zone, excluding its nested zones (in s).
+    double exclusive = 0.0;
+};
+
+/// The class used to control the collection of profiling data in the application.
+/// Profiling zones are declared with macro @ref RKT_PROFILE_ZONE and their
+/// timings are only collected while the profiler is enabled (it is disabled
+/// by default). Define `REAKTORO_DISABLE_PROFILING` to compile all zones out.
+class Profiler
+{
+public:
+    /// Return true if the profiler is currently collecting timing data.
+    static auto isEnabled() -> bool;
+
+    /// Return true if the profiler is currently not collecting timing data.
+    static auto isDisabled() -> bool;
+
+    /// Enable the collection of timing data in the profiling zones.
+    static auto enable() -> void;
+
+    /// Disable the collection of timing data in the profiling zones.
+    static auto disable() -> void;
+
+    /// Return the statistics of the profiling zones in depth-first order of the call tree.
+    /// This method should be called while no other thread is inside a profiling zone.
+    static auto stats() -> Vec<ProfilerZoneStats>;
+
+    /// Reset the statistics of all profiling zones in all threads.
+    /// This method should be called while no other thread is inside a profiling zone.
+    static auto resetStats() -> void;
+
+    /// Return a report with the call tree of the profiling zones and their statistics.
+    static auto report() -> String;
+
+    /// Deleted default constructor.
+    Profiler() = delete;
+};
+
+namespace detail {
+
+/// The buffer in which a thread accumulates the timings of its profiling zones.
+struct ProfilerThreadBuffer;
+
+} // namespace detail
+
+/// Used to measure the execution time of its enclosing scope as a profiling zone.
+/// Prefer macro @ref RKT_PROFILE_ZONE to instances of this class.
+class ProfilerZone
+{
+public:
+    /// Construct a ProfilerZone object and enter the zone if profiling is enabled.
+    /// @param name The name of the zone (must be a string with static storage duration, such as a string literal).
+    explicit ProfilerZone(Chars name) { enter(name); }
+
+    /// Destroy this ProfilerZone object and leave the zone if it was entered.
+    ~ProfilerZone() { if(mbuffer) leave(); }
+
+    /// Deleted copy constructor.
+    ProfilerZone(ProfilerZone const&) = delete;
+
+    /// Deleted copy assignment operator.
+    auto operator=(ProfilerZone const&) -> ProfilerZone& = delete;
+
+private:
+    /// Enter the zone in the call tree of the current thread.
+    auto enter(Chars name) -> void;
+
+    /// Leave the zone and accumulate its elapsed time.
+    auto leave() -> void;
+
+    /// The buffer of the thread that entered the zone (`nullptr` if profiling was disabled).
+    detail::ProfilerThreadBuffer* mbuffer = nullptr;
+
+    /// The index of the zone in the call tree of the thread.
+    Index mnode = 0;
+
+    /// The time stamp (in clock ticks) at which the zone was entered.
+    std::uint64_t mstart = 0;
+};
+
+#define RKT_PROFILE_ZONE_CONCAT_(a, b) a##b
+#define RKT_PROFILE_ZONE_CONCAT(a, b) RKT_PROFILE_ZONE_CONCAT_(a, b)
+
+#ifdef REAKTORO_DISABLE_PROFILING
+
+/// Macro to profile the execution of the enclosing scope as a zone with given name.
+#define RKT_PROFILE_ZONE(name)
+
+#else
+
+/// Macro to profile the execution of the enclosing scope as a zone with given name.
+#define RKT_PROFILE_ZONE(name) Reaktoro::ProfilerZone RKT_PROFILE_ZONE_CONCAT(__rkt_profiler_zone_, __LINE__)(name);
+
+#endif // REAKTORO_DISABLE_PROFILING
+
+} // namespace Reaktoro
@@ -0,0 +1,46 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// pybind11 includes
+#include <Reaktoro/pybind11.hxx>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Profiler.hpp>
+using namespace Reaktoro;
+
+void exportProfiler(py::module& m)
+{
+    py::class_<ProfilerZoneStats>(m, "ProfilerZoneStats")
+        .def(py::init<>())
+        .def_readwrite("name", &ProfilerZoneStats::name)
+        .def_readwrite("path", &ProfilerZoneStats::path)
+        .def_readwrite("depth", &ProfilerZoneStats::depth)
+        .def_readwrite("calls", &ProfilerZoneStats::calls)
+        .def_readwrite("inclusive", &ProfilerZoneStats::inclusive)
+        .def_readwrite("exclusive", &ProfilerZoneStats::exclusive)
+        ;
+
+    py::class_<Profiler>(m, "Profiler")
+        .def_static("isEnabled", &Profiler::isEnabled, "Return true if the profiler is currently collecting timing data.")
+        .def_static("isDisabled", &Profiler::isDisabled, "Return true if the profiler is currently not collecting timing data.")
+        .def_static("enable", &Profiler::enable, "Enable the collection of timing data in the profiling zones.")
+        .def_static("disable", &Profiler::disable, "Disable the collection of timing data in the profiling zones.")
+        .def_static("stats", &Profiler::stats, "Return the statistics of the profiling zones in depth-first order of the call tree.")
+        .def_static("resetStats", &Profiler::resetStats, "Reset the statistics of all profiling zones in all threads.")
+        .def_static("report", &Profiler::report, "Return a report with the call tree of the profiling zones and their statistics.")
+        ;
+}
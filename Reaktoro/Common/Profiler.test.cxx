@@ -0,0 +1,140 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// C++ includes
+#include <chrono>
+#include <thread>
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Profiler.hpp>
+using namespace Reaktoro;
+
+namespace {
+
+auto profiledInner() -> void
+{
+    RKT_PROFILE_ZONE("inner");
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+}
+
+auto profiledOuter() -> void
+{
+    RKT_PROFILE_ZONE("outer");
+    profiledInner();
+    profiledInner();
+}
+
+} // namespace
+
+TEST_CASE("Testing Profiler", "[Profiler]")
+{
+    Profiler::resetStats();
+
+    SECTION("When the profiler is disabled")
+    {
+        Profiler::disable();
+
+        CHECK( Profiler::isDisabled() );
+
+        profiledOuter();
+
+        CHECK( Profiler::stats().empty() );
+    }
+
+#ifndef REAKTORO_DISABLE_PROFILING
+    SECTION("When the profiler is enabled")
+    {
+        Profiler::enable();
+
+        CHECK( Profiler::isEnabled() );
+
+        profiledOuter();
+
+        std::thread thread(profiledOuter);
+        thread.join();
+
+        Profiler::disable();
+
+        const auto stats = Profiler::stats();
+
+        REQUIRE( stats.size() == 2 );
+
+        CHECK( stats[0].name == "outer" );
+        CHECK( stats[0].path == "outer" );
+        CHECK( stats[0].depth == 0 );
+        CHECK( stats[0].calls == 2 ); // one call in each thread
+
+        CHECK( stats[1].name == "inner" );
+        CHECK( stats[1].path == "outer/inner" );
+        CHECK( stats[1].depth == 1 );
+        CHECK( stats[1].calls == 4 );
+
+        CHECK( stats[1].inclusive > 0.0 );
+        CHECK( stats[1].exclusive == stats[1].inclusive ); // no zones nested in inner
+        CHECK( stats[0].inclusive >= stats[1].inclusive );
+        CHECK( stats[0].exclusive == Approx(stats[0].inclusive - stats[1].inclusive) );
+
+        const auto report = Profiler::report();
+
+        CHECK( report.find("outer") != String::npos );
+        CHECK( report.find("  inner") != String::npos );
+
+        Profiler::resetStats();
+
+        CHECK( Profiler::stats().empty() );
+    }
+
+    SECTION("When statistics are collected and reset while other threads are profiled")
+    {
+        Profiler::enable();
+
+        auto profiledLoop = []()
+        {
+            for(auto i = 0; i < 100000; ++i)
+            {
+                RKT_PROFILE_ZONE("loop");
+            }
+        };
+
+        std::thread thread1(profiledLoop);
+        std::thread thread2(profiledLoop);
+
+        for(auto i = 0; i < 100; ++i)
+        {
+            Profiler::stats();
+            Profiler::resetStats();
+        }
+
+        thread1.join();
+        thread2.join();
+
+        Profiler::disable();
+
+        const auto stats = Profiler::stats();
+
+        REQUIRE( stats.size() <= 1 );
+
+        if(stats.size() == 1)
+            CHECK( stats[0].calls <= 200000 );
+
+        Profiler::resetStats();
+    }
+#endif
+}
@@ -18,10 +18,15 @@
 #pragma once
 
 // Reaktoro includes
+#include <Reaktoro/Common/Profiler.hpp>
 #include <Reaktoro/Common/TimeUtils.hpp>
 
 namespace Reaktoro {
 
+// The macros below time individual steps whose durations are reported in
+// result objects (e.g., SmartEquilibriumResult::timing). Use macro
+// RKT_PROFILE_ZONE in Profiler.hpp to find where time goes in a call tree.
+
 #ifdef REAKTORO_DISABLE_PROFILING
 
 /// Macro to start timing of a sequence of statements.
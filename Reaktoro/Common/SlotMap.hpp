@@ -0,0 +1,131 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+namespace detail {
+
+/// Return a new unique integer identifier for a SlotKey object (thread-safe).
+auto createSlotId() -> Index;
+
+} // namespace detail
+
+/// The key of a slot in a SlotMap object containing an object of type `T`.
+/// Each SlotKey object is given a unique integer identifier when constructed,
+/// which is the index of its slot in every SlotMap object. Create SlotKey
+/// objects only once (e.g., as global constants) and reuse them, so that
+/// access to slots in SlotMap objects requires no hashing or type erasure.
+/// @see SlotMap
+template<typename T>
+class SlotKey
+{
+public:
+    /// Construct a SlotKey object with a new unique identifier.
+    SlotKey()
+    : mid(detail::createSlotId())
+    {}
+
+    /// Return the unique identifier of this key.
+    auto id() const -> Index
+    {
+        return mid;
+    }
+
+private:
+    /// The unique identifier of this key (also the index of its slot in SlotMap objects).
+    Index mid;
+};
+
+/// Used to store shared objects of different types in slots accessed with integer keys.
+/// This is used, for example, in chained activity models, in which one
+/// activity model exports objects (e.g., the state of an aqueous mixture) that
+/// are needed by other activity models in the chain. Since each SlotKey object
+/// has the type of the object in its slot and the index of this slot, setting
+/// and getting these objects amounts to a vector indexing and a pointer cast.
+/// @see SlotKey
+class SlotMap
+{
+public:
+    /// Set the shared object in the slot with given key.
+    /// The object is not copied, only its shared pointer.
+    template<typename T>
+    auto set(SlotKey<T> const& key, SharedPtr<T> const& object) -> void
+    {
+        const auto i = key.id();
+        if(i >= mslots.size())
+            mslots.resize(i + 1);
+        if(mslots[i].get() != object.get())
+            mslots[i] = object;
+    }
+
+    /// Return a pointer to the object in the slot with given key or `nullptr` if this slot is empty.
+    template<typename T>
+    auto get(SlotKey<T> const& key) const -> T const*
+    {
+        const auto i = key.id();
+        return i < mslots.size() ? static_cast<T const*>(mslots[i].get()) : nullptr;
+    }
+
+    /// Return the object in the slot with given key or raise an error if this slot is empty.
+    template<typename T>
+    auto at(SlotKey<T> const& key) const -> T const&
+    {
+        auto const* object = get(key);
+        errorif(object == nullptr, "Expecting an object in the slot with identifier ", key.id(), " of a SlotMap object, but this slot is empty.");
+        return *object;
+    }
+
+    /// Return true if the slot with given key is not empty.
+    template<typename T>
+    auto has(SlotKey<T> const& key) const -> bool
+    {
+        return get(key) != nullptr;
+    }
+
+    /// Empty the slot with given key.
+    template<typename T>
+    auto reset(SlotKey<T> const& key) -> void
+    {
+        if(key.id() < mslots.size())
+            mslots[key.id()].reset();
+    }
+
+    /// Empty all slots.
+    auto clear() -> void
+    {
+        mslots.clear();
+    }
+
+    /// Return true if all slots are empty.
+    auto empty() const -> bool
+    {
+        for(auto const& slot : mslots)
+            if(slot) return false;
+        return true;
+    }
+
+private:
+    /// The shared objects in the slots (with their types known only by the keys of the slots).
+    Vec<SharedPtr<void>> mslots;
+};
+
+} // namespace Reaktoro
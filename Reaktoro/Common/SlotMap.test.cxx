@@ -0,0 +1,76 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Common/SlotMap.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing SlotMap", "[SlotMap]")
+{
+    const SlotKey<double> key1;
+    const SlotKey<String> key2;
+    const SlotKey<double> key3;
+
+    CHECK( key1.id() != key2.id() );
+    CHECK( key1.id() != key3.id() );
+    CHECK( key2.id() != key3.id() );
+
+    SlotMap slots;
+
+    CHECK( slots.empty() );
+    CHECK( slots.get(key1) == nullptr );
+    CHECK( slots.get(key2) == nullptr );
+    CHECK_FALSE( slots.has(key3) );
+    CHECK_THROWS( slots.at(key1) );
+
+    auto x = std::make_shared<double>(1.5);
+    auto s = std::make_shared<String>("abc");
+
+    slots.set(key1, x);
+    slots.set(key2, s);
+
+    CHECK_FALSE( slots.empty() );
+    CHECK( slots.get(key1) == x.get() );
+    CHECK( slots.get(key2) == s.get() );
+    CHECK( slots.at(key1) == 1.5 );
+    CHECK( slots.at(key2) == "abc" );
+    CHECK( slots.has(key1) );
+    CHECK( slots.has(key2) );
+    CHECK_FALSE( slots.has(key3) );
+
+    // Changes in the shared objects are seen through the slots (no copies are made)
+    *x = 2.5;
+    CHECK( slots.at(key1) == 2.5 );
+
+    // Copies of SlotMap objects share the objects in their slots
+    SlotMap copy = slots;
+    CHECK( copy.get(key1) == x.get() );
+    CHECK( copy.get(key2) == s.get() );
+
+    slots.reset(key1);
+    CHECK_FALSE( slots.has(key1) );
+    CHECK( slots.has(key2) );
+    CHECK( copy.has(key1) );
+
+    slots.clear();
+    CHECK( slots.empty() );
+    CHECK( slots.get(key2) == nullptr );
+    CHECK_FALSE( copy.empty() );
+}
@@ -18,12 +18,14 @@
 #include "Table.hpp"
 
 // C++ includes
+#include <charconv>
 #include <sstream>
 #include <fstream>
 #include <iomanip>
 
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
+#include <Reaktoro/Common/BinaryStream.hpp>
 #include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/Enumerate.hpp>
 
@@ -67,7 +69,7 @@ auto appendNewValue(Any& data, DataType& datatype, T const& value, Chars strvalu
 {
     if(!data.has_value())
     {
-        data = Deque<T>();
+        data = Vec<T>();
         datatype = type;
     }
 
@@ -76,7 +78,7 @@ auto appendNewValue(Any& data, DataType& datatype, T const& value, Chars strvalu
         "Make sure that after inserting the first value into a table column, the **same value type** is used for all subsequent inserts. "
         "Note that integer values can be stored as floating-point values in a table column of floats. No other conversion is supported.");
 
-    auto& deque = std::any_cast<Deque<T>&>(data);
+    auto& deque = std::any_cast<Vec<T>&>(data);
     deque.push_back(value);
 }
 
@@ -97,12 +99,25 @@ auto stringfyTableColumn(String colname, TableColumn const& column, Table::Outpu
     ss << std::showpoint;
     ss << std::setprecision(precision);
 
-    for(auto i = 0; i < column.rows(); ++i)
+    const auto stringfy = [&](auto const& values)
     {
-        ss.str("");
-        std::visit([&](auto arg){ ss << arg; }, column[i]);
-        rows.push_back(ss.str());
+        for(auto const& value : values)
+        {
+            ss.str("");
+            ss << value;
+            rows.push_back(ss.str());
+        }
+    };
+
+    switch(column.dataType())
+    {
+        case DataType::Float:   stringfy(column.floats()); break;
+        case DataType::Integer: stringfy(column.integers()); break;
+        case DataType::String:  stringfy(column.strings()); break;
+        case DataType::Boolean: stringfy(column.booleans()); break;
+        default: break;
     }
+
     return rows;
 }
 
@@ -144,6 +159,67 @@ auto outputTable(Stream& stream, Table const& table, Table::OutputOptions const&
     }
 }
 
+/// Append a string to a row of a CSV file, in quotes if it contains the delimiter, quotes or line breaks.
+auto appendCSVString(String& row, String const& str, String const& delimiter) -> void
+{
+    const auto quoted = str.find(delimiter) != String::npos || str.find_first_of("\"\n\r") != String::npos;
+    if(!quoted)
+    {
+        row += str;
+        return;
+    }
+    row += '"';
+    for(auto c : str)
+    {
+        if(c == '"') row += '"'; // quotes are escaped by doubling them
+        row += c;
+    }
+    row += '"';
+}
+
+/// Append a floating-point value to a row of a CSV file with its shortest exact representation.
+auto appendCSVFloat(String& row, double value) -> void
+{
+    char chars[32];
+#if defined(__cpp_lib_to_chars)
+    const auto end = std::to_chars(chars, chars + sizeof(chars), value).ptr;
+    row.append(chars, end);
+#else
+    const auto length = std::snprintf(chars, sizeof(chars), "%.17g", value); // fallback for standard libraries without std::to_chars for floating-point values
+    row.append(chars, length);
+#endif
+}
+
+/// Append an integer value to a row of a CSV file.
+auto appendCSVInteger(String& row, long value) -> void
+{
+    char chars[24];
+    const auto end = std::to_chars(chars, chars + sizeof(chars), value).ptr;
+    row.append(chars, end);
+}
+
+// The layout of a binary Table file is a header followed by the columns of
+// the table. Each column consists of its name (as written by
+// BinaryWriter::writeString), its data type as a one-byte value, its number
+// of rows as a 64-bit integer, and its values. Floating-point and integer
+// values are written as arrays of doubles and 64-bit integers starting at
+// 8-byte boundaries, strings one after another, and booleans as one byte each.
+//
+// Header:
+//     char[8]  magic     ("RKTTABLE")
+//     uint32   version
+//     uint32   byteorder (0x01020304 in the byte order of the writer)
+//     uint64   number of columns
+
+/// The characters identifying a binary Table file.
+const char TableBinaryMagic[8] = { 'R', 'K', 'T', 'T', 'A', 'B', 'L', 'E' };
+
+/// The current version of the binary Table format.
+const std::uint32_t TableBinaryVersion = 1;
+
+/// The marker used to detect binary Table files written in a different byte order.
+const std::uint32_t TableBinaryByteOrder = 0x01020304;
+
 } // anonymous namespace
 
 TableColumn::TableColumn()
@@ -178,52 +254,52 @@ auto TableColumn::dataType() const -> DataType
     return datatype;
 }
 
-auto TableColumn::floats() const -> Deque<double> const&
+auto TableColumn::floats() const -> Vec<double> const&
 {
     errorif(datatype != DataType::Float, "You cannot convert a table column with values of ", strColumnDataType(datatype), " type to values a list of of floating-point type.");
-    return std::any_cast<Deque<double> const&>(data);
+    return std::any_cast<Vec<double> const&>(data);
 }
 
-auto TableColumn::floats() -> Deque<double>&
+auto TableColumn::floats() -> Vec<double>&
 {
     errorif(datatype != DataType::Float, "You cannot convert a table column with values of ", strColumnDataType(datatype), " type to values a list of of floating-point type.");
-    return std::any_cast<Deque<double>&>(data);
+    return std::any_cast<Vec<double>&>(data);
 }
 
-auto TableColumn::integers() const -> Deque<long> const&
+auto TableColumn::integers() const -> Vec<long> const&
 {
     errorif(datatype != DataType::Integer, "You cannot convert a table column with values of ", strColumnDataType(datatype), " type to a list of values of integer type.");
-    return std::any_cast<Deque<long> const&>(data);
+    return std::any_cast<Vec<long> const&>(data);
 }
 
-auto TableColumn::integers() -> Deque<long>&
+auto TableColumn::integers() -> Vec<long>&
 {
     errorif(datatype != DataType::Integer, "You cannot convert a table column with values of ", strColumnDataType(datatype), " type to a list of values of integer type.");
-    return std::any_cast<Deque<long>&>(data);
+    return std::any_cast<Vec<long>&>(data);
 }
 
-auto TableColumn::strings() const -> Deque<String> const&
+auto TableColumn::strings() const -> Vec<String> const&
 {
     errorif(datatype != DataType::String, "You cannot convert a table column with values of ", strColumnDataType(datatype), " type to a list of values of string type.");
-    return std::any_cast<Deque<String> const&>(data);
+    return std::any_cast<Vec<String> const&>(data);
 }
 
-auto TableColumn::strings() -> Deque<String>&
+auto TableColumn::strings() -> Vec<String>&
 {
     errorif(datatype != DataType::String, "You cannot convert a table column with values of ", strColumnDataType(datatype), " type to a list of values of string type.");
-    return std::any_cast<Deque<String>&>(data);
+    return std::any_cast<Vec<String>&>(data);
 }
 
-auto TableColumn::booleans() const -> Deque<bool> const&
+auto TableColumn::booleans() const -> Vec<bool> const&
 {
     errorif(datatype != DataType::Boolean, "You cannot convert a table column with values of ", strColumnDataType(datatype), " type to a list of values of boolean type.");
-    return std::any_cast<Deque<bool> const&>(data);
+    return std::any_cast<Vec<bool> const&>(data);
 }
 
-auto TableColumn::booleans() -> Deque<bool>&
+auto TableColumn::booleans() -> Vec<bool>&
 {
     errorif(datatype != DataType::Boolean, "You cannot convert a table column with values of ", strColumnDataType(datatype), " type to a list of values of boolean type.");
-    return std::any_cast<Deque<bool>&>(data);
+    return std::any_cast<Vec<bool>&>(data);
 }
 
 auto TableColumn::rows() const -> Index
@@ -236,10 +312,10 @@ auto TableColumn::operator[](Index row) const -> std::variant<double, long, Stri
     errorifnot(row < mrows, "Given row index, ", row, ", is greater than number of rows in the table column, ", mrows, ".");
     switch(datatype)
     {
-        case DataType::Float:     return std::any_cast<Deque<double> const&>(data)[row];
-        case DataType::Integer:   return std::any_cast<Deque<long> const&>(data)[row];
-        case DataType::String:    return std::any_cast<Deque<String> const&>(data)[row];
-        case DataType::Boolean:   return std::any_cast<Deque<bool> const&>(data)[row];
+        case DataType::Float:     return std::any_cast<Vec<double> const&>(data)[row];
+        case DataType::Integer:   return std::any_cast<Vec<long> const&>(data)[row];
+        case DataType::String:    return std::any_cast<Vec<String> const&>(data)[row];
+        case DataType::Boolean:   return std::any_cast<Vec<bool> const&>(data)[row];
         default: return NaN;
     }
 }
@@ -266,7 +342,7 @@ auto Table::column(String const& columnname) -> TableColumn&
     return mcolumns[columnname];
 }
 
-auto Table::operator[](String const& columnname) const -> Deque<double> const&
+auto Table::operator[](String const& columnname) const -> Vec<double> const&
 {
     auto& col = column(columnname);
     auto const& datatype = col.dataType();
@@ -276,9 +352,9 @@ auto Table::operator[](String const& columnname) const -> Deque<double> const&
     return col.floats();
 }
 
-auto Table::operator[](String const& columnname) -> Deque<double>&
+auto Table::operator[](String const& columnname) -> Vec<double>&
 {
-    return const_cast<Deque<double>&>(std::as_const(*this)[columnname]);
+    return const_cast<Vec<double>&>(std::as_const(*this)[columnname]);
 }
 
 auto Table::rows() const -> Index
@@ -307,6 +383,161 @@ auto Table::save(String const& filepath, OutputOptions const& outputopts) const
     outputTable(file, *this, outputopts);
 }
 
+auto Table::saveCSV(String const& filepath, String const& delimiter) const -> void
+{
+    BinaryWriter writer(filepath);
+
+    const auto numrows = rows();
+
+    String row;
+
+    for(auto const& [j, pair] : enumerate(mcolumns))
+    {
+        if(j > 0) row += delimiter;
+        appendCSVString(row, pair.first, delimiter);
+    }
+
+    for(auto i = 0; i < numrows; ++i)
+    {
+        row += '\n';
+        for(auto const& [j, pair] : enumerate(mcolumns))
+        {
+            auto const& column = pair.second;
+            if(j > 0) row += delimiter;
+            if(i >= column.rows())
+                continue;
+            switch(column.dataType())
+            {
+                case DataType::Float:   appendCSVFloat(row, column.floats()[i]); break;
+                case DataType::Integer: appendCSVInteger(row, column.integers()[i]); break;
+                case DataType::String:  appendCSVString(row, column.strings()[i], delimiter); break;
+                case DataType::Boolean: row += column.booleans()[i] ? '1' : '0'; break;
+                default: break;
+            }
+        }
+        writer.write(row.data(), row.size()); // the writer buffers the rows before writing them to the file
+        row.clear();
+    }
+
+    row += '\n';
+    writer.write(row.data(), row.size());
+    writer.close();
+}
+
+auto Table::saveBinary(String const& filepath) const -> void
+{
+    BinaryWriter writer(filepath);
+    writer.write(TableBinaryMagic, sizeof(TableBinaryMagic));
+    writer.write<std::uint32_t>(TableBinaryVersion);
+    writer.write<std::uint32_t>(TableBinaryByteOrder);
+    writer.write<std::uint64_t>(cols());
+
+    for(auto const& [name, column] : mcolumns)
+    {
+        writer.writeString(name);
+        writer.write<std::uint8_t>(static_cast<std::uint8_t>(column.dataType()));
+        writer.write<std::uint64_t>(column.rows());
+        writer.align();
+
+        switch(column.dataType())
+        {
+            case DataType::Float:
+                writer.write(column.floats().data(), column.rows());
+                break;
+            case DataType::Integer:
+                if constexpr(sizeof(long) == sizeof(std::int64_t))
+                    writer.write(column.integers().data(), column.rows());
+                else for(auto value : column.integers())
+                    writer.write<std::int64_t>(value);
+                break;
+            case DataType::String:
+                for(auto const& value : column.strings())
+                    writer.writeString(value);
+                break;
+            case DataType::Boolean:
+                for(bool value : column.booleans())
+                    writer.write<std::uint8_t>(value);
+                writer.align();
+                break;
+            default:
+                break;
+        }
+    }
+
+    writer.close();
+}
+
+auto Table::loadBinary(String const& filepath) -> Table
+{
+    MemoryMappedFile file(filepath);
+    BinaryReader reader(file.data(), file.size());
+
+    errorif(file.size() < sizeof(TableBinaryMagic) || std::memcmp(reader.view<char>(sizeof(TableBinaryMagic)), TableBinaryMagic, sizeof(TableBinaryMagic)) != 0,
+        "The file `", filepath, "` is not a binary file written with Table::saveBinary.");
+
+    const auto version = reader.read<std::uint32_t>();
+    errorif(version > TableBinaryVersion, "The binary Table file `", filepath, "` has version ", version, ", which is newer than the supported version ", TableBinaryVersion, ".");
+
+    const auto byteorder = reader.read<std::uint32_t>();
+    errorif(byteorder != TableBinaryByteOrder, "The binary Table file `", filepath, "` was written on a machine with a different byte order.");
+
+    Table table;
+
+    const auto numcols = reader.readCount(sizeof(std::uint64_t));
+
+    for(auto j = 0; j < numcols; ++j)
+    {
+        const auto name = reader.readString();
+        const auto datatype = static_cast<DataType>(reader.read<std::uint8_t>());
+        const auto rowsize = datatype == DataType::Undefined ? 0 : datatype == DataType::Boolean ? 1 : sizeof(std::uint64_t); // the least number of bytes of a row (strings start with their length)
+        const auto numrows = reader.readCount(rowsize);
+        errorif(rowsize == 0 && numrows != 0, "The binary Table file `", filepath, "` contains column `", name, "` without a data type but with ", numrows, " rows (corrupted file?).");
+        reader.align();
+
+        auto& column = table.column(name);
+
+        switch(datatype)
+        {
+            case DataType::Float:
+            {
+                auto const* values = reader.view<double>(numrows);
+                column.data = Vec<double>(values, values + numrows);
+                break;
+            }
+            case DataType::Integer:
+            {
+                auto const* values = reader.view<std::int64_t>(numrows);
+                column.data = Vec<long>(values, values + numrows);
+                break;
+            }
+            case DataType::String:
+            {
+                Vec<String> values(numrows);
+                for(auto& value : values)
+                    value = reader.readString();
+                column.data = std::move(values);
+                break;
+            }
+            case DataType::Boolean:
+            {
+                auto const* values = reader.view<std::uint8_t>(numrows);
+                column.data = Vec<bool>(values, values + numrows);
+                reader.align();
+                break;
+            }
+            case DataType::Undefined:
+                break;
+            default:
+                errorif(true, "The binary Table file `", filepath, "` contains column `", name, "` with an unknown data type (corrupted file?).");
+        }
+
+        column.datatype = datatype;
+        column.mrows = numrows;
+    }
+
+    return table;
+}
+
 Table::OutputOptions::OutputOptions()
 : delimiter(" | "), precision(6), scientific(false), fixed(false)
 {}
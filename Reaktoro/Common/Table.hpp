@@ -17,6 +17,9 @@
 
 #pragma once
 
+// C++ includes
+#include <utility>
+
 // Reaktoro includes
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Common/TraitsUtils.hpp>
@@ -25,6 +28,14 @@
 namespace Reaktoro {
 
 /// Used to represent the data stored in a table column.
+/// The values in a column are stored contiguously in memory (e.g., in a `Vec<double>`
+/// object for a column of floating-point values), so that they can be written to
+/// files and exposed to other libraries (e.g., NumPy) without copying.
+/// @note The methods floats, integers, strings, booleans and cast return
+/// references to `Vec<T>` objects (they returned `Deque<T>` objects before).
+/// Code using these methods should use `Vec<T>` or `auto` for the returned
+/// references. Appending values to a column may reallocate its values, so
+/// references, pointers and iterators to them are invalidated after this.
 /// @see Table
 class TableColumn
 {
@@ -61,37 +72,37 @@ public:
     /// Get the data type of the column.
     auto dataType() const -> DataType;
 
-    /// Convert this TableColumn object to a constant reference to its underlying `Deque<double>` object.
+    /// Convert this TableColumn object to a constant reference to its underlying `Vec<double>` object.
     /// @warning If the column data type is not DataType::Float, a runtime error is thrown.
-    auto floats() const -> Deque<double> const&;
+    auto floats() const -> Vec<double> const&;
 
-    /// Convert this TableColumn object to a mutable reference to its underlying `Deque<double>` object.
+    /// Convert this TableColumn object to a mutable reference to its underlying `Vec<double>` object.
     /// @warning If the column data type is not DataType::Float, a runtime error is thrown.
-    auto floats() -> Deque<double>&; // TODO: These methods in Table that return Deque<T>& are dangerous in which the user can change its length, and this will not be reflected in mrows. Replace this by std::span when migrating to C++20.
+    auto floats() -> Vec<double>&; // TODO: These methods in Table that return Vec<T>& are dangerous in which the user can change its length, and this will not be reflected in mrows. Replace this by std::span when migrating to C++20.
 
-    /// Convert this TableColumn object to a constant reference to its underlying `Deque<long>` object.
+    /// Convert this TableColumn object to a constant reference to its underlying `Vec<long>` object.
     /// @warning If the column data type is not DataType::Integer, a runtime error is thrown.
-    auto integers() const -> Deque<long> const&;
+    auto integers() const -> Vec<long> const&;
 
-    /// Convert this TableColumn object to a mutable reference to its underlying `Deque<long>` object.
+    /// Convert this TableColumn object to a mutable reference to its underlying `Vec<long>` object.
     /// @warning If the column data type is not DataType::Integer, a runtime error is thrown.
-    auto integers() -> Deque<long>&;
+    auto integers() -> Vec<long>&;
 
-    /// Convert this TableColumn object to a constant reference to its underlying `Deque<String>` object.
+    /// Convert this TableColumn object to a constant reference to its underlying `Vec<String>` object.
     /// @warning If the column data type is not DataType::String, a runtime error is thrown.
-    auto strings() const -> Deque<String> const&;
+    auto strings() const -> Vec<String> const&;
 
-    /// Convert this TableColumn object to a mutable reference to its underlying `Deque<String>` object.
+    /// Convert this TableColumn object to a mutable reference to its underlying `Vec<String>` object.
     /// @warning If the column data type is not DataType::String, a runtime error is thrown.
-    auto strings() -> Deque<String>&;
+    auto strings() -> Vec<String>&;
 
-    /// Convert this TableColumn object to a constant reference to its underlying `Deque<bool>` object.
+    /// Convert this TableColumn object to a constant reference to its underlying `Vec<bool>` object.
     /// @warning If the column data type is not DataType::Bool, a runtime error is thrown.
-    auto booleans() const -> Deque<bool> const&;
+    auto booleans() const -> Vec<bool> const&;
 
-    /// Convert this TableColumn object to a mutable reference to its underlying `Deque<bool>` object.
+    /// Convert this TableColumn object to a mutable reference to its underlying `Vec<bool>` object.
     /// @warning If the column data type is not DataType::Bool, a runtime error is thrown.
-    auto booleans() -> Deque<bool>&;
+    auto booleans() -> Vec<bool>&;
 
     /// Get the number of rows in the column.
     auto rows() const -> Index;
@@ -142,14 +153,14 @@ public:
 
     /// Cast this TableColumn object to a mutable reference to a list of values with type compatible with given one.
     template<typename T>
-    auto cast() -> Deque<T>&
+    auto cast() -> Vec<T>&
     {
-        return const_cast<Deque<T>&>(std::as_const(*this).cast<T>());
+        return const_cast<Vec<T>&>(std::as_const(*this).cast<T>());
     }
 
     /// Cast this TableColumn object to a constant reference to a list of values with type compatible with given one.
     template<typename T>
-    auto cast() const -> Deque<T> const&
+    auto cast() const -> Vec<T> const&
     {
         if constexpr(isSame<T, bool>)
             return booleans();
@@ -163,7 +174,9 @@ public:
     }
 
 private:
-    /// The values stored in this table column (e.g., `Deque<double>`, `Deque<long>`, `Deque<String>`, `Deque<bool>`).
+    friend class Table;
+
+    /// The values stored in this table column (e.g., `Vec<double>`, `Vec<long>`, `Vec<String>`, `Vec<bool>`).
     Any data;
 
     /// The number of rows in the column.
@@ -190,10 +203,10 @@ public:
     auto column(String const& columnname) -> TableColumn&;
 
     /// Get a constant reference to a column in the table with given name.
-    auto operator[](String const& columnname) const -> Deque<double> const&;
+    auto operator[](String const& columnname) const -> Vec<double> const&;
 
     /// Get a mutable reference to a column in the table with given name.
-    auto operator[](String const& columnname) -> Deque<double>&;
+    auto operator[](String const& columnname) -> Vec<double>&;
 
     /// Get the number of rows in the table (i.e., the length of the longest column in the table).
     auto rows() const -> Index;
@@ -230,6 +243,25 @@ public:
     /// @warning Ensure that the path given exists; no directories are created in this method call.
     auto save(String const& filepath, OutputOptions const& outputopts = {}) const -> void;
 
+    /// Save the Table object to a file in CSV format.
+    /// Unlike @ref save, the values are streamed row by row into the file
+    /// without column alignment, and floating-point values are written with
+    /// the shortest representation that reproduces them exactly when read.
+    /// @param filepath The path to the file that will be created, including its file name (e.g., `table.csv`).
+    /// @param delimiter The symbol used to separate column values on a table row.
+    /// @warning Ensure that the path given exists; no directories are created in this method call.
+    auto saveCSV(String const& filepath, String const& delimiter = ",") const -> void;
+
+    /// Save the Table object to a file in a compact binary format with data stored column by column.
+    /// The file can be loaded with @ref loadBinary on machines with the same byte order.
+    /// @param filepath The path to the file that will be created, including its file name (e.g., `table.rkt`).
+    /// @warning Ensure that the path given exists; no directories are created in this method call.
+    auto saveBinary(String const& filepath) const -> void;
+
+    /// Load a Table object from a file written with @ref saveBinary.
+    /// @param filepath The path to the file.
+    static auto loadBinary(String const& filepath) -> Table;
+
 private:
     /// The named columns and their stored values in the table.
     Dict<String, TableColumn> mcolumns;
@@ -225,6 +225,37 @@ def testTable():
     assert table.column("Strings").strings()   == ["Hello", "World", "!"]
     assert table.column("Booleans").booleans() == [True, False]
 
+    #----------------------------------------------------------------------------------------------------
+    # Checking method TableColumn.array
+    #----------------------------------------------------------------------------------------------------
+
+    assert list(table.column("Floats").array())   == [10.0, 20.0, 30.0, 40.0, 50.0, 60.0, 70.0]
+    assert list(table.column("Integers").array()) == [1, 2, 3, 4, 5]
+    assert list(table.column("Booleans").array()) == [True, False]
+
+    with pytest.raises(Exception): table.column("Strings").array()
+
+    floats = table.column("Floats").array()
+    view = table.column("Floats").array(copy=False)
+
+    floats[0] = -1.0  # the default array is a copy
+    assert table.column("Floats").floats()[0] == 10.0
+
+    view[0] = -1.0  # the array with copy=False is a view of the column values
+    assert table.column("Floats").floats()[0] == -1.0
+
+    view[0] = 10.0
+
+    #----------------------------------------------------------------------------------------------------
+    # Checking methods Table.saveBinary and Table.loadBinary
+    #----------------------------------------------------------------------------------------------------
+
+    table.saveBinary("reaktoro-table-test.rkt")
+    loaded = Table.loadBinary("reaktoro-table-test.rkt")
+    os.remove("reaktoro-table-test.rkt")
+
+    assert loaded.dump() == table.dump()
+
     #----------------------------------------------------------------------------------------------------
     # Checking method TableColumn.dump
     #----------------------------------------------------------------------------------------------------
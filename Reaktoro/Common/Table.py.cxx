@@ -15,6 +15,10 @@
 // You should have received a copy of the GNU Lesser General Public License
 // along with this library. If not, see <http://www.gnu.org/licenses/>.
 
+// C++ includes
+#include <algorithm>
+#include <cstdint>
+
 // pybind11 includes
 #include <Reaktoro/pybind11.hxx>
 
@@ -50,15 +54,46 @@ void exportTable(py::module& m)
         .def("appendString", &TableColumn::appendString, "Append a new string value to the TableColumn object.")
         .def("appendBoolean", &TableColumn::appendBoolean, "Append a new boolean value to the TableColumn object.")
         .def("dataType", &TableColumn::dataType, "Get the data type of the column.")
-        .def("floats", py::overload_cast<>(&TableColumn::floats, py::const_), return_internal_ref, "Convert this TableColumn object to a constant reference to its underlying `Deque<double>` object.")
-        .def("floats", py::overload_cast<>(&TableColumn::floats), return_internal_ref, "Convert this TableColumn object to a mutable reference to its underlying `Deque<double>` object.")
-        .def("integers", py::overload_cast<>(&TableColumn::integers, py::const_), return_internal_ref, "Convert this TableColumn object to a constant reference to its underlying `Deque<long>` object.")
-        .def("integers", py::overload_cast<>(&TableColumn::integers), return_internal_ref, "Convert this TableColumn object to a mutable reference to its underlying `Deque<long>` object.")
-        .def("strings", py::overload_cast<>(&TableColumn::strings, py::const_), return_internal_ref, "Convert this TableColumn object to a constant reference to its underlying `Deque<String>` object.")
-        .def("strings", py::overload_cast<>(&TableColumn::strings), return_internal_ref, "Convert this TableColumn object to a mutable reference to its underlying `Deque<String>` object.")
-        .def("booleans", py::overload_cast<>(&TableColumn::booleans, py::const_), return_internal_ref, "Convert this TableColumn object to a constant reference to its underlying `Deque<bool>` object.")
-        .def("booleans", py::overload_cast<>(&TableColumn::booleans), return_internal_ref, "Convert this TableColumn object to a mutable reference to its underlying `Deque<bool>` object.")
+        .def("floats", py::overload_cast<>(&TableColumn::floats, py::const_), return_internal_ref, "Convert this TableColumn object to a constant reference to its underlying `Vec<double>` object.")
+        .def("floats", py::overload_cast<>(&TableColumn::floats), return_internal_ref, "Convert this TableColumn object to a mutable reference to its underlying `Vec<double>` object.")
+        .def("integers", py::overload_cast<>(&TableColumn::integers, py::const_), return_internal_ref, "Convert this TableColumn object to a constant reference to its underlying `Vec<long>` object.")
+        .def("integers", py::overload_cast<>(&TableColumn::integers), return_internal_ref, "Convert this TableColumn object to a mutable reference to its underlying `Vec<long>` object.")
+        .def("strings", py::overload_cast<>(&TableColumn::strings, py::const_), return_internal_ref, "Convert this TableColumn object to a constant reference to its underlying `Vec<String>` object.")
+        .def("strings", py::overload_cast<>(&TableColumn::strings), return_internal_ref, "Convert this TableColumn object to a mutable reference to its underlying `Vec<String>` object.")
+        .def("booleans", py::overload_cast<>(&TableColumn::booleans, py::const_), return_internal_ref, "Convert this TableColumn object to a constant reference to its underlying `Vec<bool>` object.")
+        .def("booleans", py::overload_cast<>(&TableColumn::booleans), return_internal_ref, "Convert this TableColumn object to a mutable reference to its underlying `Vec<bool>` object.")
         .def("rows", &TableColumn::rows, "Get the number of rows in the column.")
+        .def("array", [](py::object self, bool copy) -> py::array
+        {
+            auto& column = self.cast<TableColumn&>();
+            const auto rows = column.rows();
+            switch(column.dataType())
+            {
+                case TableColumn::DataType::Float:
+                {
+                    auto const& values = column.floats();
+                    if(!copy) return py::array_t<double>(rows, values.data(), self); // no copy; array is valid until the column changes
+                    return py::array_t<double>(rows, values.data());
+                }
+                case TableColumn::DataType::Integer:
+                {
+                    auto const& values = column.integers();
+                    if constexpr(sizeof(long) == sizeof(std::int64_t))
+                        if(!copy) return py::array_t<std::int64_t>(rows, reinterpret_cast<std::int64_t const*>(values.data()), self); // no copy; array is valid until the column changes
+                    py::array_t<std::int64_t> array(rows);
+                    std::copy(values.begin(), values.end(), array.mutable_data()); // also when long is not a 64-bit integer (e.g., on Windows)
+                    return array;
+                }
+                case TableColumn::DataType::Boolean:
+                {
+                    py::array_t<bool> array(rows);
+                    std::copy(column.booleans().begin(), column.booleans().end(), array.mutable_data()); // bool values are always copied since Vec<bool> is not stored as an array of bool
+                    return array;
+                }
+                default: errorif(true, "Cannot convert a table column of strings or without values to a NumPy array.");
+            }
+            return py::array();
+        }, "Return a NumPy array with the values of a column of floats, integers or booleans. If `copy` is `False`, floats and integers are not copied, and the array must not be used after new values are appended to the column.", py::arg("copy") = true)
         .def("__getitem__", [](TableColumn const& self, int irow) { return self[irow]; } )
         .def("append", [](TableColumn& self, bool value) { self.append(value); }, "Append a new value to the TableColumn object.")
         .def("append", [](TableColumn& self, double value) { self.append(value); }, "Append a new value to the TableColumn object.")
@@ -92,6 +127,9 @@ void exportTable(py::module& m)
         .def("cols", &Table::cols, "Get the number of columns in the table.")
         .def("dump", &Table::dump, "Assemble a string representation of the Table object.", "outputopts"_a = Table::OutputOptions())
         .def("save", &Table::save, "Save the Table object to a file.", "filepath"_a, "outputopts"_a = Table::OutputOptions())
+        .def("saveCSV", &Table::saveCSV, "Save the Table object to a file in CSV format.", "filepath"_a, "delimiter"_a = ",")
+        .def("saveBinary", &Table::saveBinary, "Save the Table object to a file in a compact binary format with data stored column by column.", "filepath"_a)
+        .def_static("loadBinary", &Table::loadBinary, "Load a Table object from a file written with method saveBinary.", "filepath"_a)
         .def("__str__", [](Table const& self) { return self.dump(); })
         ;
 }
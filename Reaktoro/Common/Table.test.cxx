@@ -15,6 +15,12 @@
 // You should have received a copy of the GNU Lesser General Public License
 // along with this library. If not, see <http://www.gnu.org/licenses/>.
 
+// C++ includes
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
 // Catch includes
 #include <catch2/catch.hpp>
 
@@ -80,10 +86,10 @@ TEST_CASE("Testing class Table", "[Table]")
         // Checking conversion methods TableColumn::floats|integers|strings|booleans
         //----------------------------------------------------------------------------------------------------
 
-        CHECK( table.column("Floats").floats()     == Deque<double>{0.0, 1.0, 2.0, 3.0, 4.0} );
-        CHECK( table.column("Integers").integers() == Deque<long>{2, 3, 4, 5} );
-        CHECK( table.column("Strings").strings()   == Deque<String>{"Hello", "World", "!"} );
-        CHECK( table.column("Booleans").booleans() == Deque<bool>{true, false} );
+        CHECK( table.column("Floats").floats()     == Vec<double>{0.0, 1.0, 2.0, 3.0, 4.0} );
+        CHECK( table.column("Integers").integers() == Vec<long>{2, 3, 4, 5} );
+        CHECK( table.column("Strings").strings()   == Vec<String>{"Hello", "World", "!"} );
+        CHECK( table.column("Booleans").booleans() == Vec<bool>{true, false} );
 
         CHECK_THROWS( table.column("Floats").integers() );
         CHECK_THROWS( table.column("Floats").strings() );
@@ -212,10 +218,10 @@ TEST_CASE("Testing class Table", "[Table]")
         CHECK( table.column("Strings").dataType()  == TableColumn::DataType::String );
         CHECK( table.column("Booleans").dataType() == TableColumn::DataType::Boolean );
 
-        CHECK( table.column("Floats").floats()     == Deque<double>{10.0, 20.0, 30.0, 40.0, 50.0, 60.0, 70.0} );
-        CHECK( table.column("Integers").integers() == Deque<long>{1, 2, 3, 4, 5} );
-        CHECK( table.column("Strings").strings()   == Deque<String>{"Hello", "World", "!"} );
-        CHECK( table.column("Booleans").booleans() == Deque<bool>{true, false} );
+        CHECK( table.column("Floats").floats()     == Vec<double>{10.0, 20.0, 30.0, 40.0, 50.0, 60.0, 70.0} );
+        CHECK( table.column("Integers").integers() == Vec<long>{1, 2, 3, 4, 5} );
+        CHECK( table.column("Strings").strings()   == Vec<String>{"Hello", "World", "!"} );
+        CHECK( table.column("Booleans").booleans() == Vec<bool>{true, false} );
 
         //----------------------------------------------------------------------------------------------------
         // Checking method TableColumn::dump
@@ -233,4 +239,83 @@ TEST_CASE("Testing class Table", "[Table]")
             "70.0000 |          |         |         ");
 #endif
     }
+
+    SECTION("Testing methods Table::saveCSV, Table::saveBinary and Table::loadBinary")
+    {
+        Table table;
+
+        table.column("Floats") << 0.5 << 1.0 << -2.25;
+        table.column("Integers") << 1 << -2;
+        table.column("Strings") << "Hello" << "Hello, World" << "Say \"Hi\"";
+        table.column("Booleans") << true;
+
+        const String filename = "reaktoro-table-test.rkt";
+
+        //----------------------------------------------------------------------------------------------------
+        // Checking method Table::saveCSV
+        //----------------------------------------------------------------------------------------------------
+        table.saveCSV(filename);
+
+        std::stringstream csv;
+        csv << std::ifstream(filename).rdbuf();
+
+        CHECK( csv.str() ==
+            "Floats,Integers,Strings,Booleans\n"
+            "0.5,1,Hello,1\n"
+            "1,-2,\"Hello, World\",\n"
+            "-2.25,,\"Say \"\"Hi\"\"\",\n" );
+
+        //----------------------------------------------------------------------------------------------------
+        // Checking methods Table::saveBinary and Table::loadBinary
+        //----------------------------------------------------------------------------------------------------
+        table.saveBinary(filename);
+
+        const Table loaded = Table::loadBinary(filename);
+
+        CHECK( loaded.rows() == 3 );
+        CHECK( loaded.cols() == 4 );
+
+        CHECK( loaded.column("Floats").floats()     == Vec<double>{0.5, 1.0, -2.25} );
+        CHECK( loaded.column("Integers").integers() == Vec<long>{1, -2} );
+        CHECK( loaded.column("Strings").strings()   == Vec<String>{"Hello", "Hello, World", "Say \"Hi\""} );
+        CHECK( loaded.column("Booleans").booleans() == Vec<bool>{true} );
+
+        CHECK( loaded.dump() == table.dump() );
+
+        // A corrupted number of rows is rejected before memory is allocated for the rows
+        Table strings;
+        strings.column("Strings") << "Hello";
+        strings.saveBinary(filename);
+
+        {
+            const auto numrows = std::numeric_limits<std::uint64_t>::max() / 2;
+            std::fstream file(filename, std::ios::in | std::ios::out | std::ios::binary);
+            file.seekp(41); // magic (8), version (4), byte order (4), number of columns (8), name (8 + 8) and data type (1)
+            file.write(reinterpret_cast<char const*>(&numrows), sizeof(numrows));
+        }
+
+        CHECK_THROWS( Table::loadBinary(filename) );
+
+        // Also for a column without a data type, whose rows occupy no bytes in the file
+        Table empty;
+        empty.column("Empty");
+        empty.saveBinary(filename);
+
+        CHECK( Table::loadBinary(filename).column("Empty").rows() == 0 );
+
+        {
+            const auto numrows = std::numeric_limits<std::uint64_t>::max();
+            std::fstream file(filename, std::ios::in | std::ios::out | std::ios::binary);
+            file.seekp(41); // same layout as above for a name with less than 8 characters
+            file.write(reinterpret_cast<char const*>(&numrows), sizeof(numrows));
+        }
+
+        CHECK_THROWS( Table::loadBinary(filename) );
+
+        table.saveCSV(filename);
+
+        CHECK_THROWS( Table::loadBinary(filename) ); // not a binary Table file
+
+        std::remove(filename.c_str());
+    }
 }
@@ -15,14 +15,19 @@
 // You should have received a copy of the GNU Lesser General Public License
 // along with this library. If not, see <http://www.gnu.org/licenses/>.
 
+#include "Units.hpp"
+
 // C++ includes
 #include <algorithm>
 #include <cmath>
 #include <iostream>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <vector>
 using std::endl;
 using std::pow;
@@ -604,9 +609,56 @@ DerivedUnit parseUnit(const string& symbol)
     return derivedUnit;
 }
 
-inline void checkConvertibleUnits(const DerivedUnit& from, const DerivedUnit& to, const string& strfrom, const string& strto)
+/// The conversion factor and dimension of a parsed unit string.
+struct ParsedUnit
+{
+    double factor;
+    map<string, int> dimension;
+};
+
+/// Return the parsed unit with given unit string (each unit string is parsed only once and cached).
+/// Each thread keeps its own table of the parsed units it has used, so that
+/// repeated lookups of a unit string require no lock. The shared table is only
+/// consulted (with a shared lock) the first time a thread uses a unit string.
+const ParsedUnit& parsedUnit(const string& symbol)
+{
+    thread_local std::unordered_map<string, const ParsedUnit*> local;
+
+    auto it = local.find(symbol);
+    if(it != local.end())
+        return *it->second;
+
+    static std::shared_mutex mutex;
+    static std::unordered_map<string, ParsedUnit> cache; // references to its elements remain valid after insertions
+
+    const ParsedUnit* parsed = nullptr;
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        auto iter = cache.find(symbol);
+        if(iter != cache.end())
+            parsed = &iter->second;
+    }
+
+    if(parsed == nullptr)
+    {
+        const auto derivedUnit = parseUnit(symbol); // an invalid unit string throws here and is not cached
+        ParsedUnit unit{ factor(derivedUnit), dimension(derivedUnit) };
+        std::unique_lock<std::shared_mutex> lock(mutex);
+        parsed = &cache.emplace(symbol, std::move(unit)).first->second; // no effect if another thread has just added the same unit string
+    }
+
+    local.emplace(symbol, parsed);
+    return *parsed;
+}
+
+inline bool isTemperatureConversion(const string& from, const string& to)
+{
+    return temperatureUnitsMap.count(from) && temperatureUnitsMap.count(to);
+}
+
+inline void checkConvertibleUnits(const ParsedUnit& from, const ParsedUnit& to, const string& strfrom, const string& strto)
 {
-    if(dimension(from) != dimension(to))
+    if(from.dimension != to.dimension)
     {
         stringstream error; error << "*** Error *** the dimensions of the units " << strfrom << " and " << strto << " do not match.";
         throw std::runtime_error(error.str());
@@ -617,28 +669,51 @@ inline void checkConvertibleUnits(const DerivedUnit& from, const DerivedUnit& to
 
 auto slope(const std::string& from, const std::string& to) -> double
 {
-    if(internal::temperatureUnitsMap.count(from) && internal::temperatureUnitsMap.count(to))
+    if(internal::isTemperatureConversion(from, to))
         return internal::convertTemperature(1.0, from, to) - internal::convertTemperature(0.0, from, to);
-    auto parsed_from = internal::parseUnit(from);
-    auto parsed_to   = internal::parseUnit(to);
+    const auto& parsed_from = internal::parsedUnit(from);
+    const auto& parsed_to   = internal::parsedUnit(to);
     internal::checkConvertibleUnits(parsed_from, parsed_to, from, to);
-    return internal::factor(parsed_from)/internal::factor(parsed_to);
+    return parsed_from.factor/parsed_to.factor;
 }
 
 auto intercept(const std::string& from, const std::string& to) -> double
 {
-    if(internal::temperatureUnitsMap.count(from) && internal::temperatureUnitsMap.count(to))
+    if(internal::isTemperatureConversion(from, to))
         return internal::convertTemperature(0.0, from, to);
     return 0.0;
 }
 
 bool convertible(const std::string& from, const std::string& to)
 {
-    if(internal::temperatureUnitsMap.count(from) && internal::temperatureUnitsMap.count(to))
+    if(internal::isTemperatureConversion(from, to))
         return true;
-    auto parsed_from = internal::parseUnit(from);
-    auto parsed_to   = internal::parseUnit(to);
-    return dimension(parsed_from) == dimension(parsed_to);
+    return internal::parsedUnit(from).dimension == internal::parsedUnit(to).dimension;
+}
+
+Converter::Converter()
+{}
+
+Converter::Converter(const std::string& from, const std::string& to)
+{
+    if(from == to)
+        return;
+    if(internal::isTemperatureConversion(from, to))
+    {
+        m_intercept = internal::convertTemperature(0.0, from, to);
+        m_slope = internal::convertTemperature(1.0, from, to) - m_intercept;
+    }
+    else m_slope = units::slope(from, to);
+}
+
+auto Converter::slope() const -> double
+{
+    return m_slope;
+}
+
+auto Converter::intercept() const -> double
+{
+    return m_intercept;
 }
 
 } // namespace units
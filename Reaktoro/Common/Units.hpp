@@ -39,6 +39,41 @@ auto intercept(const std::string& from, const std::string& to) -> double;
 /// @return True if they are convertible, false otherwise
 auto convertible(const std::string& from, const std::string& to) -> bool;
 
+/// Used to convert numeric values from a unit to another using precomputed slope and intercept.
+/// Unit strings are parsed only once and cached, so constructing a Converter
+/// object is cheap, but hot loops should construct it once and reuse it.
+class Converter
+{
+public:
+    /// Construct a default Converter object (an identity conversion).
+    Converter();
+
+    /// Construct a Converter object from a unit to another.
+    /// @param from The string representing the unit from which the conversion is done
+    /// @param to The string representing the unit to which the conversion is done
+    Converter(const std::string& from, const std::string& to);
+
+    /// Return the slope factor in the linear function of this conversion.
+    auto slope() const -> double;
+
+    /// Return the intercept term in the linear function of this conversion.
+    auto intercept() const -> double;
+
+    /// Convert a numeric value.
+    template<typename T>
+    auto operator()(const T& value) const -> T
+    {
+        return value * m_slope + m_intercept;
+    }
+
+private:
+    /// The slope factor in the linear function of this conversion.
+    double m_slope = 1.0;
+
+    /// The intercept term in the linear function of this conversion.
+    double m_intercept = 0.0;
+};
+
 /// Convert a numeric value from a unit to another
 /// @param value The value
 /// @param from The string representing the unit from which the conversion is done
@@ -47,7 +82,7 @@ auto convertible(const std::string& from, const std::string& to) -> bool;
 template<typename T>
 auto convert(const T& value, const std::string& from, const std::string& to) -> T
 {
-    return (from == to) ? value : value * slope(from, to) + intercept(from, to);
+    return (from == to) ? value : Converter(from, to)(value);
 }
 
 /// Convenience function to convert a value from a time unit to seconds.
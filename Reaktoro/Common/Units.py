@@ -26,3 +26,8 @@ def testUnits():
 
     assert units.convert(100.0, "celsius", "kelvin") == pytest.approx(100.0 + 273.15)
     assert units.convert(1000.0, "Pa", "kPa") == pytest.approx(1.0)
+
+    converter = units.Converter("celsius", "kelvin")
+    assert converter.slope() == pytest.approx(1.0)
+    assert converter.intercept() == pytest.approx(273.15)
+    assert converter(100.0) == pytest.approx(100.0 + 273.15)
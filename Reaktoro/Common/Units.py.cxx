@@ -26,6 +26,15 @@ void exportUnits(py::module& m)
 {
     auto sub = m.def_submodule("units");
 
+    py::class_<units::Converter>(sub, "Converter")
+        .def(py::init<>())
+        .def(py::init<const std::string&, const std::string&>())
+        .def("slope", &units::Converter::slope)
+        .def("intercept", &units::Converter::intercept)
+        .def("__call__", &units::Converter::operator()<double>)
+        .def("__call__", &units::Converter::operator()<real>)
+        ;
+
     sub.def("convertible", &units::convertible);
 
     sub.def("convert", &units::convert<double>);
@@ -15,6 +15,11 @@
 // You should have received a copy of the GNU Lesser General Public License
 // along with this library. If not, see <http://www.gnu.org/licenses/>.
 
+// C++ includes
+#include <atomic>
+#include <thread>
+#include <vector>
+
 // Catch includes
 #include <catch2/catch.hpp>
 
@@ -68,6 +73,27 @@ TEST_CASE("Testing Units module", "[Units]")
     REQUIRE( units::convert(x, "ftH2O"  , "Pa") == Approx(x * 249.08891 * 12)  );
     REQUIRE( units::convert(x, "pascal" , "Pa") == Approx(x * 1.0)             );
 
+    //-------------------------------------------------------------------------
+    // CONVERTER CLASS
+    //-------------------------------------------------------------------------
+    units::Converter degC_to_degF("degC", "degF");
+
+    REQUIRE( degC_to_degF.slope() == Approx(1.8) );
+    REQUIRE( degC_to_degF.intercept() == Approx(32.0) );
+    REQUIRE( degC_to_degF(x) == Approx(units::convert(x, "degC", "degF")) );
+
+    units::Converter mmolcc_to_molm3("mmol/cc", "mol/m3");
+
+    REQUIRE( mmolcc_to_molm3.slope() == Approx(1.0e+3) );
+    REQUIRE( mmolcc_to_molm3.intercept() == 0.0 );
+    REQUIRE( mmolcc_to_molm3(x) == Approx(units::convert(x, "mmol/cc", "mol/m3")) );
+
+    REQUIRE( units::Converter()(x) == x );
+    REQUIRE( units::Converter("kPa", "kPa")(x) == x );
+
+    REQUIRE_THROWS( units::Converter("kPa", "mol") );
+    REQUIRE_THROWS( units::convert(x, "kPa", "mol") ); // the same error is thrown again with units already cached
+
     //-------------------------------------------------------------------------
     // CONVENIENCE FUNCTIONS
     //-------------------------------------------------------------------------
@@ -75,3 +101,28 @@ TEST_CASE("Testing Units module", "[Units]")
     REQUIRE( units::seconds(1.23, "year") == units::convert(1.23, "year", "s") );
     REQUIRE( units::seconds(2.34, "minute") == units::convert(2.34, "minute", "s") );
 }
+
+TEST_CASE("Testing Units module with multiple threads", "[Units]")
+{
+    const auto numthreads = 4;
+    const auto numcalls = 1000;
+
+    std::atomic<int> failures = 0;
+
+    auto work = [&](int ithread)
+    {
+        const auto from = ithread % 2 ? "mmol/cc" : "mol/cm3"; // unit strings parsed concurrently by different threads
+        const auto factor = ithread % 2 ? 1.0e+3 : 1.0e+6;
+        for(auto i = 0; i < numcalls; ++i)
+            if(units::convert(1.0 * i, from, "mol/m3") != Approx(factor * i))
+                ++failures;
+    };
+
+    std::vector<std::thread> threads;
+    for(auto i = 0; i < numthreads; ++i)
+        threads.emplace_back(work, i);
+    for(auto& thread : threads)
+        thread.join();
+
+    CHECK( failures == 0 );
+}
@@ -0,0 +1,394 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "WorkScheduler.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <numeric>
+#include <thread>
+
+// Reaktoro includes
+#include <Reaktoro/Common/TimeUtils.hpp>
+
+namespace Reaktoro {
+namespace {
+
+/// Return the number of threads to be used for given options.
+auto determineNumThreads(WorkSchedulerOptions const& options) -> Index
+{
+    if(options.threads > 0)
+        return options.threads;
+    return std::max<Index>(std::thread::hardware_concurrency(), 1);
+}
+
+} // namespace
+
+struct WorkScheduler::Impl
+{
+    /// The queue of tasks of a thread, represented by a range of positions in the dispatch order.
+    /// The owner thread takes tasks from the front of the range and other threads steal from its back.
+    struct alignas(64) Queue
+    {
+        std::mutex mutex;
+        Index begin = 0;
+        Index end = 0;
+    };
+
+    /// The counters of a thread in the current run, aligned to a cache line so that threads do not write to the same one.
+    struct alignas(64) Counters
+    {
+        /// The number of tasks executed by the thread.
+        Index ntasks = 0;
+
+        /// The time the thread spent executing tasks.
+        double busy = 0.0;
+    };
+
+    /// The options of the scheduler.
+    WorkSchedulerOptions options;
+
+    /// The number of threads used by the scheduler (including the calling thread).
+    Index nthreads = 1;
+
+    /// The costs of the tasks returned in the last run.
+    ArrayXd costs;
+
+    /// The order in which tasks are dispatched, partitioned into contiguous segments, one per thread.
+    Indices order;
+
+    /// The queues of tasks of each thread.
+    Ptr<Queue[]> queues;
+
+    /// The worker threads (the calling thread of method run acts as thread 0).
+    Vec<std::thread> workers;
+
+    /// The mutex and condition variables used to synchronize the calling thread and the worker threads.
+    std::mutex mutex;
+    std::condition_variable cvstart;
+    std::condition_variable cvdone;
+
+    /// The counter incremented every time a new run is started.
+    Index generation = 0;
+
+    /// The number of worker threads that have not yet finished the current run.
+    Index pending = 0;
+
+    /// The boolean flag that indicates the worker threads should terminate.
+    bool stopping = false;
+
+    /// The task being executed in the current run.
+    Task const* task = nullptr;
+
+    /// The boolean flag that indicates a task has failed in the current run.
+    std::atomic<bool> failed = false;
+
+    /// The exception thrown by the first failed task in the current run.
+    std::exception_ptr exception;
+
+    /// The number of steals in the current run.
+    std::atomic<Index> steals = 0;
+
+    /// The counters of each thread in the current run.
+    Ptr<Counters[]> counters;
+
+    /// Construct a WorkScheduler::Impl object with given options.
+    Impl(WorkSchedulerOptions const& options)
+    {
+        start(options);
+    }
+
+    /// Destroy this WorkScheduler::Impl object.
+    ~Impl()
+    {
+        stop();
+    }
+
+    /// Start the worker threads for given options.
+    auto start(WorkSchedulerOptions const& opts) -> void
+    {
+        options = opts;
+        options.chunksize = std::max<Index>(options.chunksize, 1);
+        nthreads = determineNumThreads(options);
+        queues.reset(new Queue[nthreads]);
+        counters.reset(new Counters[nthreads]);
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = false;
+        for(Index t = 1; t < nthreads; ++t)
+            workers.emplace_back([this, t, seen = generation]() { loop(t, seen); });
+    }
+
+    /// Stop the worker threads.
+    auto stop() -> void
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        cvstart.notify_all();
+        for(auto& worker : workers)
+            worker.join();
+        workers.clear();
+    }
+
+    /// Set the options of the scheduler, restarting the worker threads if the number of threads changes.
+    auto setOptions(WorkSchedulerOptions const& opts) -> void
+    {
+        if(determineNumThreads(opts) == nthreads)
+        {
+            options = opts;
+            options.chunksize = std::max<Index>(options.chunksize, 1);
+            return;
+        }
+        stop();
+        start(opts);
+    }
+
+    /// The loop executed by worker thread `t` waiting for new runs.
+    /// @param t The index of the worker thread
+    /// @param seen The generation of the last run started before the worker thread was created
+    auto loop(Index t, Index seen) -> void
+    {
+        while(true)
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            cvstart.wait(lock, [&]() { return stopping || generation != seen; });
+            if(stopping)
+                return;
+            seen = generation;
+            lock.unlock();
+
+            work(t);
+
+            lock.lock();
+            if(--pending == 0)
+                cvdone.notify_one();
+        }
+    }
+
+    /// Take the next chunk of tasks, as a range of positions in `order`, from the queue of thread `t`.
+    auto pop(Index t, Index& begin, Index& end) -> bool
+    {
+        auto& queue = queues[t];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if(queue.begin == queue.end)
+            return false;
+        begin = queue.begin;
+        end = std::min(queue.begin + options.chunksize, queue.end);
+        queue.begin = end;
+        return true;
+    }
+
+    /// Steal half of the remaining tasks of another thread into the (empty) queue of thread `t`.
+    auto steal(Index t) -> bool
+    {
+        for(Index k = 1; k < nthreads; ++k)
+        {
+            auto& victim = queues[(t + k) % nthreads];
+            Index begin, end;
+            {
+                std::lock_guard<std::mutex> lock(victim.mutex);
+                auto const remaining = victim.end - victim.begin;
+                if(remaining == 0)
+                    continue;
+                end = victim.end;
+                begin = end - (remaining + 1) / 2;
+                victim.end = begin;
+            }
+            auto& queue = queues[t];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            queue.begin = begin;
+            queue.end = end;
+            steals.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+        return false;
+    }
+
+    /// Execute tasks in thread `t` until there is no task left in any queue.
+    auto work(Index t) -> void
+    {
+        Index begin, end;
+        while(!failed.load(std::memory_order_relaxed))
+        {
+            if(!pop(t, begin, end))
+            {
+                if(steal(t)) continue;
+                else break;
+            }
+
+            const auto start = time();
+
+            for(auto k = begin; k < end; ++k)
+            {
+                const auto i = order[k];
+                try
+                {
+                    costs[i] = (*task)(i, t);
+                }
+                catch(...)
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if(!exception)
+                        exception = std::current_exception();
+                    failed = true;
+                    break;
+                }
+                ++counters[t].ntasks;
+            }
+
+            counters[t].busy += elapsed(start);
+        }
+    }
+
+    /// Determine the dispatch order of the tasks and distribute them among the threads.
+    auto distribute(Index size) -> void
+    {
+        Indices sorted(size);
+        std::iota(sorted.begin(), sorted.end(), 0);
+
+        if(options.order_by_cost && Index(costs.size()) == size)
+            std::stable_sort(sorted.begin(), sorted.end(), [&](Index a, Index b) { return costs[a] > costs[b]; });
+
+        // Deal the sorted tasks to the threads in round-robin so that each
+        // thread gets a fair share of the expensive tasks, which are stored
+        // in decreasing order of cost in the segment of `order` owned by the thread.
+        order.resize(size);
+        Index pos = 0;
+        for(Index t = 0; t < nthreads; ++t)
+        {
+            queues[t].begin = pos;
+            for(auto k = t; k < size; k += nthreads)
+                order[pos++] = sorted[k];
+            queues[t].end = pos;
+        }
+
+        if(Index(costs.size()) != size)
+            costs.setZero(size);
+    }
+
+    /// Execute tasks with indices 0, 1, ..., `size` - 1 in parallel.
+    auto run(Index size, Task const& fn) -> WorkSchedulerResult
+    {
+        WorkSchedulerResult result;
+
+        const auto start = time();
+
+        distribute(size);
+
+        task = &fn;
+        failed = false;
+        exception = nullptr;
+        steals = 0;
+        for(Index t = 0; t < nthreads; ++t)
+            counters[t] = Counters();
+
+        if(nthreads > 1)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                pending = nthreads - 1;
+                ++generation;
+            }
+            cvstart.notify_all();
+        }
+
+        work(0);
+
+        if(nthreads > 1)
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            cvdone.wait(lock, [&]() { return pending == 0; });
+        }
+
+        task = nullptr;
+
+        if(exception)
+            std::rethrow_exception(exception);
+
+        result.time = elapsed(start);
+        result.steals = steals;
+        result.tasks.resize(nthreads);
+        result.busy.resize(nthreads);
+        for(Index t = 0; t < nthreads; ++t)
+        {
+            result.tasks[t] = counters[t].ntasks;
+            result.busy[t] = counters[t].busy;
+        }
+
+        return result;
+    }
+};
+
+WorkScheduler::WorkScheduler()
+: WorkScheduler(WorkSchedulerOptions{})
+{}
+
+WorkScheduler::WorkScheduler(WorkSchedulerOptions const& options)
+: pimpl(new Impl(options))
+{}
+
+WorkScheduler::WorkScheduler(WorkScheduler const& other)
+: pimpl(new Impl(other.pimpl->options))
+{
+    pimpl->costs = other.pimpl->costs;
+}
+
+WorkScheduler::~WorkScheduler()
+{}
+
+auto WorkScheduler::operator=(WorkScheduler other) -> WorkScheduler&
+{
+    pimpl = std::move(other.pimpl);
+    return *this;
+}
+
+auto WorkScheduler::setOptions(WorkSchedulerOptions const& options) -> void
+{
+    pimpl->setOptions(options);
+}
+
+auto WorkScheduler::options() const -> WorkSchedulerOptions const&
+{
+    return pimpl->options;
+}
+
+auto WorkScheduler::numThreads() const -> Index
+{
+    return pimpl->nthreads;
+}
+
+auto WorkScheduler::setCosts(ArrayXdConstRef costs) -> void
+{
+    pimpl->costs = costs;
+}
+
+auto WorkScheduler::costs() const -> ArrayXdConstRef
+{
+    return pimpl->costs;
+}
+
+auto WorkScheduler::run(Index size, Task const& task) -> WorkSchedulerResult
+{
+    return pimpl->run(size, task);
+}
+
+} // namespace Reaktoro
@@ -0,0 +1,170 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Matrix.hpp>
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+/// The options for the work-stealing scheduler of per-cell calculations.
+/// @see WorkScheduler
+struct WorkSchedulerOptions
+{
+    /// The number of threads used to execute the tasks (zero means all hardware threads available).
+    Index threads = 0;
+
+    /// The number of tasks a thread takes at once from its own queue of tasks.
+    Index chunksize = 1;
+
+    /// The boolean flag that indicates whether tasks are dispatched in decreasing order of their cost in the previous run.
+    /// If true, the costs returned by the tasks in the last call to @ref WorkScheduler::run
+    /// are used to start the most expensive tasks (e.g. cells on a dissolution front)
+    /// first, which reduces the time threads stay idle at the end of the run.
+    bool order_by_cost = true;
+};
+
+/// Used to describe the result of executing tasks with a WorkScheduler object.
+struct WorkSchedulerResult
+{
+    /// The wall-clock time spent executing all tasks (in seconds).
+    double time = 0.0;
+
+    /// The number of times a thread stole tasks from another thread.
+    Index steals = 0;
+
+    /// The number of tasks executed by each thread.
+    Indices tasks;
+
+    /// The time each thread spent executing tasks (in seconds).
+    Vec<double> busy;
+};
+
+/// Used to execute heterogeneous per-cell calculations in parallel using work stealing.
+/// In a reactive transport simulation, the cost of the chemical calculation
+/// in each cell can vary considerably. Cells on a reaction front may require
+/// many Newton iterations, whereas cells far from it are quickly accepted by a
+/// smart predictor. A static partition of the cells among threads thus leaves
+/// some threads idle while others are still busy. This class assigns the cells
+/// to per-thread queues and lets idle threads steal half of the remaining
+/// tasks of another thread. The cost returned by each task is recorded and,
+/// if WorkSchedulerOptions::order_by_cost is true, used in the next run to
+/// dispatch the most expensive tasks first.
+///
+/// **Usage**
+/// ~~~{.cpp}
+/// WorkScheduler scheduler;
+/// Vec<EquilibriumSolver> solvers(scheduler.numThreads(), EquilibriumSolver(system));
+/// scheduler.run(states.size(), [&](Index icell, Index ithread)
+/// {
+///     auto result = solvers[ithread].solve(states[icell]);
+///     return result.iterations(); // or the timing of a smart solver, e.g. `result.timing.solve`
+/// });
+/// ~~~
+/// Note that the solvers are not thread-safe and one instance per thread
+/// should be used, selected with the thread index passed to the task. The
+/// solvers EquilibriumSolver, SmartEquilibriumSolver, KineticsSolver, and
+/// SmartKineticsSolver provide `solve` methods that accept a vector of
+/// chemical states and a WorkScheduler object and do exactly this.
+class WorkScheduler
+{
+public:
+    /// The type of the functions executed by the scheduler.
+    /// The first argument is the index of the task (e.g., a cell index), the
+    /// second is the index of the thread executing it (in the range [0, numThreads())).
+    /// The returned value is the cost of the task (e.g., number of iterations or elapsed time).
+    using Task = Fn<double(Index, Index)>;
+
+    /// Construct a default WorkScheduler object.
+    WorkScheduler();
+
+    /// Construct a WorkScheduler object with given options.
+    explicit WorkScheduler(WorkSchedulerOptions const& options);
+
+    /// Construct a copy of a WorkScheduler object.
+    WorkScheduler(WorkScheduler const& other);
+
+    /// Destroy this WorkScheduler object.
+    ~WorkScheduler();
+
+    /// Assign a copy of a WorkScheduler object to this.
+    auto operator=(WorkScheduler other) -> WorkScheduler&;
+
+    /// Set the options of the scheduler.
+    auto setOptions(WorkSchedulerOptions const& options) -> void;
+
+    /// Return the options of the scheduler.
+    auto options() const -> WorkSchedulerOptions const&;
+
+    /// Return the number of threads used by the scheduler.
+    auto numThreads() const -> Index;
+
+    /// Set the estimated costs of the tasks used to order them in the next run.
+    auto setCosts(ArrayXdConstRef costs) -> void;
+
+    /// Return the costs of the tasks returned in the last run.
+    auto costs() const -> ArrayXdConstRef;
+
+    /// Execute tasks with indices 0, 1, ..., `size` - 1 in parallel.
+    /// If a task throws an exception, the remaining tasks are skipped and the
+    /// exception is rethrown in the calling thread once all threads are idle.
+    /// @param size The number of tasks
+    /// @param task The function executed for every task index
+    auto run(Index size, Task const& task) -> WorkSchedulerResult;
+
+private:
+    struct Impl;
+
+    Ptr<Impl> pimpl;
+};
+
+/// Used to store the copies of a solver object used by the threads of a WorkScheduler object.
+/// Copying a PerThreadCopies object produces an empty one, so that a
+/// solver storing it as a member creates its own copies when copied.
+template<typename Solver>
+struct PerThreadCopies : Vec<Solver>
+{
+    PerThreadCopies() = default;
+    PerThreadCopies(PerThreadCopies const&) : Vec<Solver>() {}
+    auto operator=(PerThreadCopies const&) -> PerThreadCopies& { this->clear(); return *this; }
+};
+
+/// Execute the calculations of many cells in parallel using a solver object per thread.
+/// The calling thread uses `solver` and every other thread of the scheduler
+/// uses its own copy of it in `copies`, which is extended as needed. The
+/// copies should be kept by the caller for subsequent calls, so that they
+/// are created only once, and cleared whenever `solver` is reconfigured.
+/// @param scheduler The scheduler used to distribute the cells among threads
+/// @param solver The solver object used by the calling thread
+/// @param copies The copies of the solver object used by the other threads
+/// @param size The number of cells
+/// @param task The function `(Solver& solver, Index icell) -> double` executed for every cell, returning its cost
+template<typename Solver, typename Fun>
+auto runWithSolverPerThread(WorkScheduler& scheduler, Solver& solver, Vec<Solver>& copies, Index size, Fun const& task) -> WorkSchedulerResult
+{
+    copies.reserve(scheduler.numThreads() - 1);
+    while(copies.size() + 1 < scheduler.numThreads())
+        copies.push_back(solver);
+    return scheduler.run(size, [&](Index icell, Index ithread) -> double
+    {
+        return task(ithread == 0 ? solver : copies[ithread - 1], icell);
+    });
+}
+
+} // namespace Reaktoro
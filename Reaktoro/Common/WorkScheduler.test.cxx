@@ -0,0 +1,186 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <atomic>
+#include <stdexcept>
+
+// Reaktoro includes
+#include <Reaktoro/Common/WorkScheduler.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing WorkScheduler", "[WorkScheduler]")
+{
+    WorkSchedulerOptions options;
+    options.threads = 4;
+
+    WorkScheduler scheduler(options);
+
+    CHECK( scheduler.numThreads() == 4 );
+
+    const Index size = 1000;
+
+    SECTION("Checking all tasks are executed exactly once")
+    {
+        Vec<std::atomic<int>> counts(size);
+        Vec<Index> threads(size);
+
+        auto result = scheduler.run(size, [&](Index i, Index t)
+        {
+            ++counts[i];
+            threads[i] = t;
+            return double(i % 7);
+        });
+
+        for(Index i = 0; i < size; ++i)
+        {
+            CHECK( counts[i] == 1 );
+            CHECK( threads[i] < 4 );
+        }
+
+        CHECK( result.tasks.size() == 4 );
+        CHECK( result.busy.size() == 4 );
+        CHECK( result.tasks[0] + result.tasks[1] + result.tasks[2] + result.tasks[3] == size );
+
+        // The costs returned by the tasks are recorded for the next run
+        const auto costs = scheduler.costs();
+        REQUIRE( costs.size() == size );
+        for(Index i = 0; i < size; ++i)
+            CHECK( costs[i] == double(i % 7) );
+    }
+
+    SECTION("Checking tasks are dispatched in decreasing order of previous costs")
+    {
+        options.threads = 1;
+        scheduler.setOptions(options);
+
+        CHECK( scheduler.numThreads() == 1 );
+
+        ArrayXd costs = ArrayXd::LinSpaced(size, 0.0, 1.0);
+        scheduler.setCosts(costs);
+
+        Indices executed;
+        scheduler.run(size, [&](Index i, Index t) { executed.push_back(i); return 1.0; });
+
+        REQUIRE( executed.size() == size );
+        for(Index k = 0; k < size; ++k)
+            CHECK( executed[k] == size - 1 - k );
+    }
+
+    SECTION("Checking exceptions thrown in tasks are propagated")
+    {
+        auto task = [&](Index i, Index t) -> double
+        {
+            if(i == 500) throw std::runtime_error("task failed");
+            return 1.0;
+        };
+
+        CHECK_THROWS( scheduler.run(size, task) );
+
+        // The scheduler remains usable after a failed run
+        auto result = scheduler.run(size, [&](Index i, Index t) { return 1.0; });
+
+        CHECK( result.tasks[0] + result.tasks[1] + result.tasks[2] + result.tasks[3] == size );
+    }
+
+    SECTION("Checking runs after changing the number of threads")
+    {
+        Vec<std::atomic<int>> counts(size);
+
+        auto task = [&](Index i, Index t) { ++counts[i]; return 1.0; };
+
+        scheduler.run(size, task);
+
+        // New worker threads must not execute tasks of runs started before their creation
+        for(Index threads : { 8, 2, 4 })
+        {
+            options.threads = threads;
+            scheduler.setOptions(options);
+
+            CHECK( scheduler.numThreads() == threads );
+
+            auto result = scheduler.run(size, task);
+
+            Index total = 0;
+            for(auto n : result.tasks)
+                total += n;
+
+            CHECK( result.tasks.size() == threads );
+            CHECK( total == size );
+        }
+
+        for(Index i = 0; i < size; ++i)
+            CHECK( counts[i] == 4 );
+    }
+
+    SECTION("Checking a copy of the scheduler keeps its options and costs")
+    {
+        scheduler.run(size, [&](Index i, Index t) { return double(i); });
+
+        WorkScheduler copy(scheduler);
+
+        CHECK( copy.numThreads() == scheduler.numThreads() );
+        CHECK( copy.costs().isApprox(scheduler.costs()) );
+    }
+
+    SECTION("Checking a solver object per thread is used with runWithSolverPerThread")
+    {
+        // A solver that records the cells it computed and whose copies are counted
+        struct Solver
+        {
+            Index* ncopies = nullptr;
+            Vec<Index> cells;
+            Solver(Index* ncopies) : ncopies(ncopies) {}
+            Solver(Solver const& other) : ncopies(other.ncopies) { ++*ncopies; }
+        };
+
+        Index ncopies = 0;
+        Solver solver(&ncopies);
+        PerThreadCopies<Solver> copies;
+
+        for(auto irun = 0; irun < 3; ++irun)
+        {
+            solver.cells.clear();
+            for(auto& copy : copies)
+                copy.cells.clear();
+
+            auto result = runWithSolverPerThread(scheduler, solver, copies, size, [&](Solver& s, Index icell)
+            {
+                s.cells.push_back(icell);
+                return 1.0;
+            });
+
+            // The copies are created in the first run only and reused afterwards
+            CHECK( ncopies == 3 );
+            CHECK( copies.size() == 3 );
+
+            // Each thread uses its own solver object
+            CHECK( solver.cells.size() == result.tasks[0] );
+            for(Index t = 1; t < 4; ++t)
+                CHECK( copies[t - 1].cells.size() == result.tasks[t] );
+        }
+
+        // Copying the per-thread copies produces an empty container
+        PerThreadCopies<Solver> other(copies);
+
+        CHECK( other.empty() );
+        CHECK( ncopies == 3 );
+    }
+}
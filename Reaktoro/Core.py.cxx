@@ -22,12 +22,15 @@ void exportActivityModel(py::module& m);
 void exportActivityProps(py::module& m);
 void exportAggregateState(py::module& m);
 void exportChemicalFormula(py::module& m);
+void exportChemicalOutput(py::module& m);
 void exportChemicalProps(py::module& m);
 void exportChemicalPropsPhase(py::module& m);
+void exportChemicalQuantity(py::module& m);
 void exportChemicalState(py::module& m);
 void exportChemicalSystem(py::module& m);
 void exportData(py::module& m);
 void exportDatabase(py::module& m);
+void exportDatabaseCache(py::module& m);
 void exportElement(py::module& m);
 void exportElementalComposition(py::module& m);
 void exportElementList(py::module& m);
@@ -51,6 +54,7 @@ void exportSpecies(py::module& m);
 void exportSpeciesList(py::module& m);
 void exportSpeciesThermoProps(py::module& m);
 void exportStandardThermoModel(py::module& m);
+void exportStandardThermoModelBatch(py::module& m);
 void exportStandardThermoProps(py::module& m);
 void exportStateOfMatter(py::module& m);
 void exportSurface(py::module& m);
@@ -67,12 +71,15 @@ void exportCore(py::module& m)
     exportActivityProps(m);
     exportAggregateState(m);
     exportChemicalFormula(m);
+    exportChemicalOutput(m);
     exportChemicalProps(m);
     exportChemicalPropsPhase(m);
+    exportChemicalQuantity(m);
     exportChemicalState(m);
     exportChemicalSystem(m);
     exportData(m);
     exportDatabase(m);
+    exportDatabaseCache(m);
     exportElement(m);
     exportElementalComposition(m);
     exportElementList(m);
@@ -97,6 +104,7 @@ void exportCore(py::module& m)
     exportSpeciesThermoProps(m);
     exportStandardThermoProps(m);
     exportStandardThermoModel(m);
+    exportStandardThermoModelBatch(m);
     exportStateOfMatter(m);
     exportSurface(m);
     exportSurfaceAreaModel(m);
@@ -17,6 +17,12 @@
 
 #include "ChemicalFormula.hpp"
 
+// C++ includes
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <shared_mutex>
+
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
 #include <Reaktoro/Common/Constants.hpp>
@@ -37,6 +43,9 @@ struct ChemicalFormula::Impl
     /// The electric charge in the chemical formula (e.g., `-1` for `HCO3-`).
     double charge = {};
 
+    /// The precomputed molar mass of the chemical formula (NaN if not precomputed).
+    double molar_mass = NaN;
+
     /// Construct an object of type Impl.
     Impl()
     {}
@@ -72,8 +81,82 @@ struct ChemicalFormula::Impl
         return 0.0;
     }
 
+    /// Return the shared and immutable Impl object of a formula string, which is parsed only once while it is in use.
+    static auto intern(String const& formula) -> SharedPtr<Impl>
+    {
+        auto& stripe = internStripe(formula);
+
+        {
+            std::shared_lock<std::shared_mutex> lock(stripe.mutex);
+            auto it = stripe.interned.find(formula);
+            if(it != stripe.interned.end())
+                if(auto impl = it->second.lock())
+                    return impl;
+        }
+
+        SharedPtr<Impl> impl(new Impl(formula));
+
+        // Precompute the molar mass only if all element symbols are in the periodic
+        // table (otherwise, molarMass should still throw an error when called).
+        const auto known = [](auto const& pair) { return Elements::withSymbol(pair.first).has_value(); };
+        if(std::all_of(impl->elements.begin(), impl->elements.end(), known))
+            impl->molar_mass = impl->computeMolarMass();
+
+        std::unique_lock<std::shared_mutex> lock(stripe.mutex);
+
+        auto& entry = stripe.interned[formula];
+        if(auto existing = entry.lock()) // another thread has interned the same formula meanwhile
+            return existing;
+        entry = impl;
+
+        // Remove the entries of formulas no longer in use (only when the number of entries has doubled since the last removal)
+        if(stripe.interned.size() >= stripe.threshold)
+        {
+            for(auto it = stripe.interned.begin(); it != stripe.interned.end();)
+                it = it->second.expired() ? stripe.interned.erase(it) : std::next(it);
+            stripe.threshold = std::max<Index>(64, 2 * stripe.interned.size());
+        }
+
+        return impl;
+    }
+
+    /// Return the shared Impl object of a formula string if its parsed data is identical to given element symbols and charge, or a new Impl object otherwise.
+    static auto intern(String const& formula, Pairs<String, double> const& elements, double charge) -> SharedPtr<Impl>
+    {
+        auto impl = intern(formula);
+        if(impl->elements == elements && impl->charge == charge)
+            return impl;
+        return SharedPtr<Impl>(new Impl(formula, elements, charge));
+    }
+
+    /// Used to store part of the table of interned formulas, each part with its own lock, so that threads interning different formulas rarely wait for each other.
+    struct InternStripe
+    {
+        /// The mutex used to protect the interned formulas in this part of the table (shared for lookups).
+        std::shared_mutex mutex;
+
+        /// The Impl objects of the interned formulas (not kept alive by the table, so that unused formulas are eventually removed).
+        Map<String, std::weak_ptr<Impl>> interned;
+
+        /// The number of entries above which the entries of formulas no longer in use are removed.
+        Index threshold = 64;
+    };
+
+    /// Return the part of the table of interned formulas where a formula string is stored.
+    static auto internStripe(String const& formula) -> InternStripe&
+    {
+        static InternStripe stripes[16];
+        return stripes[std::hash<String>{}(formula) % 16];
+    }
+
     /// Return the molar mass of the chemical formula (in kg/mol).
     auto molarMass() const -> double
+    {
+        return std::isnan(molar_mass) ? computeMolarMass() : molar_mass;
+    }
+
+    /// Compute the molar mass of the chemical formula (in kg/mol).
+    auto computeMolarMass() const -> double
     {
         double res = 0.0;
         for(auto const& [symbol, coeff] : elements)
@@ -96,11 +179,11 @@ ChemicalFormula::ChemicalFormula(const char* formula)
 {}
 
 ChemicalFormula::ChemicalFormula(String formula)
-: pimpl(new Impl(formula))
+: pimpl(Impl::intern(formula))
 {}
 
 ChemicalFormula::ChemicalFormula(String formula, Pairs<String, double> symbols, double charge)
-: pimpl(new Impl(formula, symbols, charge))
+: pimpl(Impl::intern(formula, symbols, charge))
 {}
 
 auto ChemicalFormula::str() const -> const String&
@@ -140,6 +223,8 @@ auto ChemicalFormula::molarMass() const -> double
 
 auto ChemicalFormula::equivalent(const ChemicalFormula& other) const -> bool
 {
+    if(&elements() == &other.elements()) // both share the same interned formula
+        return true;
     return elements().size() == other.elements().size() &&
         contained(elements(), other.elements()) &&
         charge() == other.charge();
@@ -172,7 +257,7 @@ auto operator<(const ChemicalFormula& lhs, const ChemicalFormula& rhs) -> bool
 
 auto operator==(const ChemicalFormula& lhs, const ChemicalFormula& rhs) -> bool
 {
-    return lhs.str() == rhs.str();
+    return &lhs.str() == &rhs.str() || lhs.str() == rhs.str(); // formulas constructed from the same string share the same interned data
 }
 
 } // namespace Reaktoro
@@ -34,10 +34,15 @@ public:
     ChemicalFormula(const char* formula);
 
     /// Construct a ChemicalFormula object with given formula.
+    /// Formula strings are parsed only once while in use. ChemicalFormula objects
+    /// constructed from the same string share the same immutable parsed data, with
+    /// element symbols, coefficients, charge and molar mass computed in advance.
     /// @param formula The chemical formula of the species (e.g., `H2O`, `CaCO3`, `CO3--`, `CO3-2`).
     ChemicalFormula(String formula);
 
     /// Construct a ChemicalFormula object with given formula, element symbols, and charge.
+    /// The parsed data of @p formula is shared if it has the same element symbols,
+    /// coefficients (in the same order) and charge as given here.
     /// @param formula The chemical formula of the species (e.g., `HCO3-`).
     /// @param symbols The element symbols and their coefficients (e.g., `{{"H", 1}, {"C", 1}, {"O", 3}}` for `HCO3-`).
     /// @param charge The electric charge in the chemical formula (e.g., `-1` for `HCO3-`).
@@ -284,4 +284,28 @@ TEST_CASE("Testing ChemicalFormula class", "[ChemicalFormula]")
 
     CHECK(ChemicalFormula::equivalent("CO2", "CO2(g)"));
     CHECK(ChemicalFormula::equivalent("CO2", "COO"));
+
+    //-------------------------------------------------------------------------
+    // TESTING INTERNED FORMULAS
+    //-------------------------------------------------------------------------
+    ChemicalFormula f1("CaCO3");
+    ChemicalFormula f2("CaCO3");
+    ChemicalFormula f3("CaCO3", {{"Ca", 1}, {"C", 1}, {"O", 3}}, 0.0);
+    ChemicalFormula f4("CaCO3", {{"C", 1}, {"Ca", 1}, {"O", 3}}, 0.0);
+
+    CHECK( &f1.elements() == &f2.elements() ); // formulas with same string share their parsed data
+    CHECK( &f1.elements() == &f3.elements() ); // also with elements and charge identical to the parsed ones
+    CHECK( &f1.elements() != &f4.elements() );
+
+    CHECK( f1.equivalent(f4) );
+    CHECK( f4.elements()[0].first == "C" );
+
+    CHECK( f1 == f2 );
+    CHECK( f1 == f3 );
+    CHECK( f1.equivalent(f2) );
+    CHECK( f1.equivalent(f3) );
+    CHECK( f1.molarMass() == f3.molarMass() );
+
+    CHECK_THROWS( ChemicalFormula("XyZ").molarMass() );
+    CHECK_THROWS( ChemicalFormula("XyZ").molarMass() ); // also when the formula has been interned before
 }
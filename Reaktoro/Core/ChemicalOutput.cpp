@@ -1,325 +1,580 @@
-// // Reaktoro is a unified framework for modeling chemically reactive systems.
-// //
-// // Copyright © 2014-2022 Allan Leal
-// //
-// // This library is free software; you can redistribute it and/or
-// // modify it under the terms of the GNU Lesser General Public
-// // License as published by the Free Software Foundation; either
-// // version 2.1 of the License, or (at your option) any later version.
-// //
-// // This library is distributed in the hope that it will be useful,
-// // but WITHOUT ANY WARRANTY; without even the implied warranty of
-// // MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
-// // Lesser General Public License for more details.
-// //
-// // You should have received a copy of the GNU Lesser General Public License
-// // along with this library. If not, see <http://www.gnu.org/licenses/>.
-
-// #include "ChemicalOutput.hpp"
-
-// // C++ includes
-// #include <fstream>
-// #include <iomanip>
-// #include <iostream>
-// #include <cmath>
-
-// // Reaktoro includes
-// #include <Reaktoro/Common/Exception.hpp>
-// #include <Reaktoro/Common/StringList.hpp>
-// #include <Reaktoro/Common/StringUtils.hpp>
-// #include <Reaktoro/Common/Units.hpp>
-// #include <Reaktoro/Core/ChemicalQuantity.hpp>
-// #include <Reaktoro/Core/ChemicalState.hpp>
-// #include <Reaktoro/Core/ChemicalSystem.hpp>
-// #include <Reaktoro/Core/ReactionSystem.hpp>
-
-// namespace Reaktoro {
-
-// struct ChemicalOutput::Impl
-// {
-//     /// The chemical system instance
-//     ChemicalSystem system;
-
-//     /// The reaction system instance
-//     ReactionSystem reactions;
-
-//     /// The chemical quantity instance
-//     ChemicalQuantity quantity;
-
-//     /// The flag that indicates if output should be done at the terminal.
-//     bool terminal = false;
-
-//     /// The name of the output file.
-//     std::string filename;
-
-//     /// The base name of the output file.
-//     std::string basename;
-
-//     /// The extension name of the output file.
-//     std::string extension;
-
-//     /// The suffix word of the output file name.
-//     std::string suffix;
-
-//     /// The names of the quantities to be output.
-//     std::vector<std::string> data;
-
-//     /// The names of the quantities to appear as column header in the output.
-//     std::vector<std::string> headings;
-
-//     /// The floating-point precision in the output.
-//     int precision = 6;
-
-//     /// The flag that indicates if scientific format should be used.
-//     bool scientific = false;
-
-//     /// The output stream of the data file.
-//     std::ofstream datafile;
-
-//     /// The iteration number for every update call
-//     Index iteration = 0;
-
-//     /// The extra attachments to the output file.
-//     std::vector<std::string> attachments;
-
-//     /// The index of the active column
-//     Index icolumn = 0;
-
-//     /// The spacings between the columns
-//     std::vector<int> spacings;
-
-//     Impl()
-//     : quantity(system)
-//     {}
-
-//     Impl(const ChemicalSystem& system)
-//     : system(system), quantity(system)
-//     {}
-
-//     Impl(const ReactionSystem& reactions)
-//     : system(reactions.system()), reactions(reactions), quantity(reactions)
-//     {}
-
-//     ~Impl()
-//     {
-//         close();
-//     }
-
-//     auto spacing(std::string word) const -> std::size_t
-//     {
-//         return word.size() + std::max(5, 25 - static_cast<int>(word.size()));
-//     }
-
-//     auto open() -> void
-//     {
-//         // Ensure the output file is closed
-//         close();
-
-//         // Ensure output is done either to a file and/or terminal
-//         Assert(!filename.empty() || terminal,
-//             "Cannot open the ChemicalOutput instance for output.",
-//             "The instance has not been configured to output to the terminal or file.");
-
-//         // Make sure header is not empty
-//         if(headings.empty())
-//             headings = data;
-
-//         // Open the data file
-//         if(!filename.empty())
-//             datafile.open(filename, std::ofstream::out | std::ofstream::trunc);
-
-//         // Check if scientific format should be used
-//         if(scientific)
-//             datafile << std::scientific;
-
-//         // Set the floating-point precision in the output.
-//         datafile << std::setprecision(precision);
-
-//         // Determine the spacings between the columns
-//         spacings.clear();
-//         for(auto word : headings)
-//             spacings.push_back(spacing(word));
-
-//         // Output the header of the data file
-//         icolumn = 0;
-//         for(auto word : headings)
-//         {
-//             auto space = spacings[icolumn];
-//             if(datafile.is_open()) datafile << std::left << std::setw(space) << word;
-//             if(terminal)
-//             {
-//                 std::ios::fmtflags flags(std::cout.flags());
-//                 if(scientific) std::cout << std::scientific;
-//                 std::cout << std::setprecision(precision);
-//                 std::cout << std::left << std::setw(space) << word;
-//                 std::cout.flags(flags);
-//             }
-//             ++icolumn;
-//         }
-//     }
-
-//     auto close() -> void
-//     {
-//         datafile.close();
-//     }
-
-//     auto update(const ChemicalState& state, double t) -> void
-//     {
-//         // Output values on a new line
-//         if(datafile.is_open()) datafile << std::endl;
-//         if(terminal) std::cout << std::endl;
-
-//         // Output the current chemical state to the data file.
-//         quantity.update(state, t);
-
-//         // For each quantity, ouput its value on each column
-//         icolumn = 0;
-//         for(auto word : data)
-//         {
-//             auto space = spacings[icolumn];
-//             auto val = (word == "i") ? iteration : quantity.value(word);
-//             if(datafile.is_open()) datafile << std::left << std::setw(space) << val;
-//             if(terminal) std::cout << std::left << std::setw(space) << val;
-//             ++icolumn;
-//         }
-
-//         // Update the iteration number
-//         ++iteration;
-//     }
-
-//     template<typename ValueType>
-//     auto attach(ValueType value) -> void
-//     {
-//         auto space = spacings[icolumn];
-//         if(datafile.is_open()) datafile << std::left << std::setw(space) << value;
-//         if(terminal) std::cout << std::left << std::setw(space) << value;
-//         ++icolumn;
-//     }
-// };
-
-// ChemicalOutput::ChemicalOutput()
-// : pimpl(new Impl())
-// {}
-
-// ChemicalOutput::ChemicalOutput(const ChemicalSystem& system)
-// : pimpl(new Impl(system))
-// {}
-
-// ChemicalOutput::ChemicalOutput(const ReactionSystem& reactions)
-// : pimpl(new Impl(reactions))
-// {}
-
-// ChemicalOutput::~ChemicalOutput()
-// {}
-
-// auto ChemicalOutput::filename(std::string filename) -> void
-// {
-//     pimpl->filename = filename;
-//     pimpl->basename = filename.substr(0, filename.rfind('.'));
-//     pimpl->extension = filename.substr(filename.rfind('.'));
-// }
-
-// auto ChemicalOutput::filename() const -> std::string
-// {
-//     return pimpl->filename;
-// }
-
-// auto ChemicalOutput::suffix(std::string word) -> void
-// {
-//     pimpl->suffix = word;
-//     pimpl->filename = pimpl->basename + pimpl->suffix + pimpl->extension;
-// }
-
-// auto ChemicalOutput::suffix() const -> std::string
-// {
-//     return pimpl->suffix;
-// }
-
-// auto ChemicalOutput::basename() const -> std::string
-// {
-//     return pimpl->basename;
-// }
-
-// auto ChemicalOutput::extension() const -> std::string
-// {
-//     return pimpl->extension;
-// }
-
-// auto ChemicalOutput::add(std::string quantity) -> void
-// {
-//     add(quantity, quantity);
-// }
-
-// auto ChemicalOutput::add(std::string quantity, std::string label) -> void
-// {
-//     pimpl->headings.insert(pimpl->headings.end() - pimpl->attachments.size(), label);
-//     pimpl->data.push_back(quantity);
-// }
-
-// auto ChemicalOutput::attachments(std::vector<std::string> titles) -> void
-// {
-//     pimpl->headings.insert(pimpl->headings.end(), titles.begin(), titles.end());
-//     pimpl->attachments.insert(pimpl->attachments.end(), titles.begin(), titles.end());
-// }
-
-// auto ChemicalOutput::attach(int value) -> void
-// {
-//     pimpl->attach(value);
-// }
-
-// auto ChemicalOutput::attach(double value) -> void
-// {
-//     pimpl->attach(value);
-// }
-
-// auto ChemicalOutput::attach(std::string value) -> void
-// {
-//     pimpl->attach(value);
-// }
-
-// auto ChemicalOutput::precision(int val) -> void
-// {
-//     pimpl->precision = std::abs(val);
-// }
-
-// auto ChemicalOutput::scientific(bool enable) -> void
-// {
-//     pimpl->scientific = enable;
-// }
-
-// auto ChemicalOutput::terminal(bool enabled) -> void
-// {
-//     pimpl->terminal = enabled;
-// }
-
-// auto ChemicalOutput::quantities() const -> std::vector<std::string>
-// {
-//     return pimpl->data;
-// }
-
-// auto ChemicalOutput::headings() const -> std::vector<std::string>
-// {
-//     return pimpl->headings;
-// }
-
-// auto ChemicalOutput::open() -> void
-// {
-//     pimpl->open();
-// }
-
-// auto ChemicalOutput::update(const ChemicalState& state, double t) -> void
-// {
-//     pimpl->update(state, t);
-// }
-
-// auto ChemicalOutput::close() -> void
-// {
-//     pimpl->close();
-// }
-
-// ChemicalOutput::operator bool() const
-// {
-//     return pimpl->terminal || pimpl->filename.size();
-// }
-
-// } // namespace Reaktoro
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "ChemicalOutput.hpp"
+
+// C++ includes
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Algorithms.hpp>
+#include <Reaktoro/Common/BinaryStream.hpp>
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Core/ChemicalProps.hpp>
+#include <Reaktoro/Core/ChemicalQuantity.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+
+namespace Reaktoro {
+namespace {
+
+// The layout of an output file is a header followed by a sequence of blocks of
+// rows. Every field is 8 bytes long (or a string padded to a multiple of 8
+// bytes), so that the values in the file are always properly aligned for
+// direct access in mapped memory.
+//
+// Header:
+//     char[8]  magic     ("RKTOUT" plus two null characters)
+//     uint32   version
+//     uint32   byteorder (0x01020304 in the byte order of the writer)
+//     uint64   number of columns
+//     strings  headings of the columns
+//
+// Block (a sequence of rows):
+//     uint64   number of rows
+//     double   values of the rows in the first column, then in the second column, and so on
+//
+// A block at the end of the file that is incomplete (e.g., because the writer
+// is still running or was interrupted) is ignored by the reader.
+
+/// The characters identifying an output file.
+const char OutputMagic[8] = { 'R', 'K', 'T', 'O', 'U', 'T', '\0', '\0' };
+
+/// The current version of the output format.
+const std::uint32_t OutputVersion = 1;
+
+/// The marker used to detect output files written in a different byte order.
+const std::uint32_t OutputByteOrder = 0x01020304;
+
+} // namespace
+
+//=================================================================================================
+//
+// ChemicalOutput
+//
+//=================================================================================================
+
+struct ChemicalOutput::Impl
+{
+    /// The chemical system of the chemical states whose quantities are output.
+    ChemicalSystem system;
+
+    /// The options for the output.
+    ChemicalOutputOptions options;
+
+    /// The quantities to be output that are given as formatted strings.
+    ChemicalQuantity compiled;
+
+    /// The functions that evaluate the quantities to be output (empty for quantities given as formatted strings).
+    Vec<QuantityFn> quantities;
+
+    /// The indices of the quantities to be output in `compiled` (used only for quantities given as formatted strings).
+    Indices icompiled;
+
+    /// The headings of the columns in the output file (the tag variable, the quantities, and the attachments).
+    Strings headings = { "t" };
+
+    /// The number of attachments (the last columns in the output file).
+    Index nattachments = 0;
+
+    /// The name of the output file.
+    String filename;
+
+    /// The binary writer used by the background thread to write the output file.
+    BinaryWriter writer;
+
+    /// The values in the current block, stored column after column (each with `options.blocksize` entries).
+    Vec<double> block;
+
+    /// The number of rows in the current block.
+    Index nrows = 0;
+
+    /// The total number of rows output so far.
+    Index ntotal = 0;
+
+    /// The index of the next attachment in the current row.
+    Index iattachment = 0;
+
+    /// The blocks waiting to be written to the output file and their number of rows.
+    Deque<Pair<Vec<double>, Index>> pending;
+
+    /// The buffers of blocks already written to the output file that can be reused.
+    Vec<Vec<double>> available;
+
+    /// The boolean flag that indicates whether the background thread is writing a block.
+    bool writing = false;
+
+    /// The boolean flag that indicates whether the background thread should stop.
+    bool stopping = false;
+
+    /// The first exception thrown in the background thread.
+    std::exception_ptr error;
+
+    /// The mutex protecting the data shared with the background thread.
+    std::mutex mutex;
+
+    /// The condition variable used to notify the background thread of pending blocks.
+    std::condition_variable cvpending;
+
+    /// The condition variable used to notify that a block has been written.
+    std::condition_variable cvwritten;
+
+    /// The background thread writing the blocks to the output file.
+    std::thread thread;
+
+    /// Construct a ChemicalOutput::Impl object.
+    Impl(ChemicalSystem const& system, ChemicalOutputOptions const& options)
+    : system(system), options(options), compiled(system)
+    {}
+
+    /// Destroy this ChemicalOutput::Impl object after closing the output file.
+    ~Impl()
+    {
+        try { close(); } catch(...) {}
+    }
+
+    /// Return true if the output file is open.
+    auto isOpen() const -> bool
+    {
+        return thread.joinable();
+    }
+
+    /// Assert the output file is not open yet.
+    auto assertNotOpen(String const& action) const -> void
+    {
+        errorif(isOpen(), "Cannot ", action, " after the output file `", filename, "` has been opened.");
+    }
+
+    /// Open the output file and start the background thread.
+    auto open(String const& fname) -> void
+    {
+        close();
+
+        errorif(options.blocksize == 0, "Expecting a positive block size in the options of ChemicalOutput.");
+        errorif(options.maxpending == 0, "Expecting a positive maximum number of pending blocks in the options of ChemicalOutput.");
+
+        filename = fname;
+        writer.open(filename);
+        writer.write(OutputMagic, sizeof(OutputMagic));
+        writer.write<std::uint32_t>(OutputVersion);
+        writer.write<std::uint32_t>(OutputByteOrder);
+        writer.write<std::uint64_t>(headings.size());
+        for(auto const& heading : headings)
+            writer.writeString(heading);
+
+        block.assign(headings.size() * options.blocksize, 0.0);
+        nrows = 0;
+        ntotal = 0;
+        iattachment = nattachments;
+        stopping = false;
+        error = nullptr;
+
+        thread = std::thread([this] { run(); });
+    }
+
+    /// Write the pending blocks to the output file until asked to stop (executed in the background thread).
+    auto run() -> void
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        while(true)
+        {
+            cvpending.wait(lock, [&] { return !pending.empty() || stopping; });
+
+            if(pending.empty())
+                return;
+
+            auto [values, size] = std::move(pending.front());
+            pending.pop_front();
+            writing = true;
+            lock.unlock();
+
+            try { writeBlock(values, size); }
+            catch(...) { lock.lock(); if(!error) error = std::current_exception(); lock.unlock(); }
+
+            lock.lock();
+            available.push_back(std::move(values));
+            writing = false;
+            cvwritten.notify_all();
+        }
+    }
+
+    /// Write a block of rows to the output file (executed in the background thread).
+    auto writeBlock(Vec<double> const& values, Index size) -> void
+    {
+        const auto stride = options.blocksize;
+        writer.write<std::uint64_t>(size);
+        for(Index j = 0; j < headings.size(); ++j)
+            writer.write(values.data() + j * stride, size);
+    }
+
+    /// Rethrow in the calling thread the exception thrown in the background thread, if any.
+    auto rethrowIfError() -> void
+    {
+        if(error)
+            std::rethrow_exception(std::exchange(error, nullptr));
+    }
+
+    /// Hand the current block over to the background thread and start a new one.
+    auto dispatch() -> void
+    {
+        if(nrows == 0)
+            return;
+
+        std::unique_lock<std::mutex> lock(mutex);
+
+        cvwritten.wait(lock, [&] { return pending.size() < options.maxpending; });
+
+        rethrowIfError();
+
+        Vec<double> next;
+        if(available.empty())
+            next.resize(block.size());
+        else
+        {
+            next = std::move(available.back());
+            available.pop_back();
+        }
+
+        pending.emplace_back(std::move(block), nrows);
+        block = std::move(next);
+        nrows = 0;
+
+        cvpending.notify_one();
+    }
+
+    /// Output the quantities evaluated with given chemical properties in a new row.
+    auto update(ChemicalProps const& props, double t) -> void
+    {
+        errorif(!isOpen(), "Cannot update a ChemicalOutput object whose output file has not been opened.");
+
+        if(nrows == options.blocksize)
+            dispatch();
+
+        const auto stride = options.blocksize;
+        const auto nquantities = quantities.size();
+        const auto nan = std::numeric_limits<double>::quiet_NaN();
+
+        if(!compiled.quantities().empty())
+            compiled.update(props, t);
+
+        auto* row = block.data() + nrows;
+        row[0] = t;
+        for(Index j = 0; j < nquantities; ++j)
+            row[(j + 1) * stride] = quantities[j] ? double(quantities[j](props)) : compiled.value(icompiled[j]);
+        for(Index j = nquantities + 1; j < headings.size(); ++j)
+            row[j * stride] = nan;
+
+        ++nrows;
+        ++ntotal;
+        iattachment = 0;
+    }
+
+    /// Set the value of the next extra column in the row of the last update.
+    auto attach(double value) -> void
+    {
+        errorif(nrows == 0, "Cannot attach a value to the output before ChemicalOutput::update has been called.");
+        errorif(iattachment >= nattachments, "Cannot attach more values than the number of attachments (", nattachments, ") in the current row of the output.");
+        const auto j = headings.size() - nattachments + iattachment;
+        block[j * options.blocksize + nrows - 1] = value;
+        ++iattachment;
+    }
+
+    /// Write all rows output so far to the output file.
+    auto flush() -> void
+    {
+        if(!isOpen())
+            return;
+
+        dispatch();
+
+        std::unique_lock<std::mutex> lock(mutex);
+        cvwritten.wait(lock, [&] { return pending.empty() && !writing; });
+        rethrowIfError();
+        writer.flush();
+    }
+
+    /// Write all rows output so far to the output file, stop the background thread, and close the file.
+    auto close() -> void
+    {
+        if(!isOpen())
+            return;
+
+        std::exception_ptr failure;
+        try { dispatch(); }
+        catch(...) { failure = std::current_exception(); }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        cvpending.notify_one();
+        thread.join();
+
+        pending.clear();
+        available.clear();
+
+        try { writer.close(); }
+        catch(...) { if(!failure) failure = std::current_exception(); }
+
+        if(!failure)
+            failure = std::exchange(error, nullptr);
+
+        if(failure)
+            std::rethrow_exception(failure);
+    }
+};
+
+ChemicalOutput::ChemicalOutput(ChemicalSystem const& system)
+: pimpl(new Impl(system, {}))
+{}
+
+ChemicalOutput::ChemicalOutput(ChemicalSystem const& system, ChemicalOutputOptions const& options)
+: pimpl(new Impl(system, options))
+{}
+
+ChemicalOutput::~ChemicalOutput()
+{}
+
+auto ChemicalOutput::setOptions(ChemicalOutputOptions const& options) -> void
+{
+    pimpl->assertNotOpen("change the options of the output");
+    pimpl->options = options;
+}
+
+auto ChemicalOutput::options() const -> ChemicalOutputOptions const&
+{
+    return pimpl->options;
+}
+
+auto ChemicalOutput::system() const -> ChemicalSystem const&
+{
+    return pimpl->system;
+}
+
+auto ChemicalOutput::add(String const& quantity) -> void
+{
+    add(quantity, quantity);
+}
+
+auto ChemicalOutput::add(String const& heading, String const& quantity) -> void
+{
+    pimpl->assertNotOpen("add a quantity to the output");
+    const auto i = pimpl->compiled.add(quantity);
+    auto& headings = pimpl->headings;
+    headings.insert(headings.end() - pimpl->nattachments, heading);
+    pimpl->quantities.push_back({});
+    pimpl->icompiled.push_back(i);
+}
+
+auto ChemicalOutput::add(String const& heading, QuantityFn const& quantity) -> void
+{
+    pimpl->assertNotOpen("add a quantity to the output");
+    errorif(!quantity, "Cannot add quantity `", heading, "` to the output with an empty function.");
+    auto& headings = pimpl->headings;
+    headings.insert(headings.end() - pimpl->nattachments, heading);
+    pimpl->quantities.push_back(quantity);
+    pimpl->icompiled.push_back(-1);
+}
+
+auto ChemicalOutput::attachments(Strings const& headings) -> void
+{
+    pimpl->assertNotOpen("add attachments to the output");
+    pimpl->headings.insert(pimpl->headings.end(), headings.begin(), headings.end());
+    pimpl->nattachments += headings.size();
+}
+
+auto ChemicalOutput::attach(double value) -> void
+{
+    pimpl->attach(value);
+}
+
+auto ChemicalOutput::headings() const -> Strings const&
+{
+    return pimpl->headings;
+}
+
+auto ChemicalOutput::open(String const& filename) -> void
+{
+    pimpl->open(filename);
+}
+
+auto ChemicalOutput::filename() const -> String const&
+{
+    return pimpl->filename;
+}
+
+auto ChemicalOutput::isOpen() const -> bool
+{
+    return pimpl->isOpen();
+}
+
+auto ChemicalOutput::update(ChemicalProps const& props, double t) -> void
+{
+    pimpl->update(props, t);
+}
+
+auto ChemicalOutput::update(ChemicalState const& state, double t) -> void
+{
+    pimpl->update(state.props(), t);
+}
+
+auto ChemicalOutput::numRows() const -> Index
+{
+    return pimpl->ntotal;
+}
+
+auto ChemicalOutput::flush() -> void
+{
+    pimpl->flush();
+}
+
+auto ChemicalOutput::close() -> void
+{
+    pimpl->close();
+}
+
+ChemicalOutput::operator bool() const
+{
+    return pimpl->isOpen();
+}
+
+//=================================================================================================
+//
+// ChemicalOutputReader
+//
+//=================================================================================================
+
+struct ChemicalOutputReader::Impl
+{
+    /// The memory-mapped output file.
+    MemoryMappedFile file;
+
+    /// The version of the format of the output file.
+    Index version = 0;
+
+    /// The headings of the columns in the output file.
+    Strings headings;
+
+    /// The offsets of the values in each complete block of the output file and their number of rows.
+    Pairs<Index, Index> blocks;
+
+    /// The total number of rows in the complete blocks of the output file.
+    Index nrows = 0;
+
+    /// Construct a ChemicalOutputReader::Impl object.
+    Impl(String const& filename)
+    : file(filename)
+    {
+        BinaryReader reader(file.data(), file.size());
+
+        errorif(file.size() < sizeof(OutputMagic) || std::memcmp(reader.view<char>(sizeof(OutputMagic)), OutputMagic, sizeof(OutputMagic)) != 0,
+            "The file `", filename, "` is not a Reaktoro output file.");
+
+        version = reader.read<std::uint32_t>();
+        errorif(version > OutputVersion, "The output file `", filename, "` has version ", version, ", which is newer than the supported version ", OutputVersion, ".");
+
+        const auto byteorder = reader.read<std::uint32_t>();
+        errorif(byteorder != OutputByteOrder, "The output file `", filename, "` was written on a machine with a different byte order.");
+
+        headings.resize(reader.readCount(sizeof(std::uint64_t)));
+        for(auto& heading : headings)
+            heading = reader.readString();
+
+        const auto ncols = headings.size();
+
+        while(reader.remaining() >= sizeof(std::uint64_t))
+        {
+            const auto size = reader.read<std::uint64_t>();
+            if(ncols != 0 && size > reader.remaining() / sizeof(double) / ncols)
+                break; // an incomplete block still being written or interrupted
+            const auto bytes = size * ncols * sizeof(double);
+            blocks.emplace_back(reader.offset(), size);
+            reader.skip(bytes);
+            nrows += size;
+        }
+    }
+
+    /// Copy the values in the column with given index into a given array.
+    auto column(Index icolumn, double* values) const -> void
+    {
+        errorif(icolumn >= headings.size(), "Cannot read column with index ", icolumn, " from an output file with only ", headings.size(), " columns.");
+        for(auto const& [offset, size] : blocks)
+        {
+            auto const* begin = reinterpret_cast<double const*>(file.data() + offset) + icolumn * size;
+            std::copy(begin, begin + size, values);
+            values += size;
+        }
+    }
+};
+
+ChemicalOutputReader::ChemicalOutputReader(String const& filename)
+: pimpl(new Impl(filename))
+{}
+
+ChemicalOutputReader::~ChemicalOutputReader()
+{}
+
+auto ChemicalOutputReader::version() const -> Index
+{
+    return pimpl->version;
+}
+
+auto ChemicalOutputReader::headings() const -> Strings const&
+{
+    return pimpl->headings;
+}
+
+auto ChemicalOutputReader::numRows() const -> Index
+{
+    return pimpl->nrows;
+}
+
+auto ChemicalOutputReader::numColumns() const -> Index
+{
+    return pimpl->headings.size();
+}
+
+auto ChemicalOutputReader::column(Index icolumn) const -> ArrayXd
+{
+    ArrayXd values(pimpl->nrows);
+    pimpl->column(icolumn, values.data());
+    return values;
+}
+
+auto ChemicalOutputReader::column(String const& heading) const -> ArrayXd
+{
+    const auto icolumn = index(pimpl->headings, heading);
+    errorif(icolumn >= pimpl->headings.size(), "There is no column with heading `", heading, "` in the output file.");
+    return column(icolumn);
+}
+
+auto ChemicalOutputReader::data() const -> MatrixXd
+{
+    MatrixXd values(pimpl->nrows, pimpl->headings.size());
+    for(Index j = 0; j < pimpl->headings.size(); ++j)
+        pimpl->column(j, values.col(j).data());
+    return values;
+}
+
+} // namespace Reaktoro
@@ -1,122 +1,211 @@
-// // Reaktoro is a unified framework for modeling chemically reactive systems.
-// //
-// // Copyright © 2014-2022 Allan Leal
-// //
-// // This library is free software; you can redistribute it and/or
-// // modify it under the terms of the GNU Lesser General Public
-// // License as published by the Free Software Foundation; either
-// // version 2.1 of the License, or (at your option) any later version.
-// //
-// // This library is distributed in the hope that it will be useful,
-// // but WITHOUT ANY WARRANTY; without even the implied warranty of
-// // MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
-// // Lesser General Public License for more details.
-// //
-// // You should have received a copy of the GNU Lesser General Public License
-// // along with this library. If not, see <http://www.gnu.org/licenses/>.
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Matrix.hpp>
+#include <Reaktoro/Common/Real.hpp>
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+// Forward declarations
+class ChemicalProps;
+class ChemicalState;
+class ChemicalSystem;
+
+/// The options for the output of chemical quantities with ChemicalOutput.
+struct ChemicalOutputOptions
+{
+    /// The number of rows accumulated in memory before they are written to the output file as a block.
+    Index blocksize = 1024;
+
+    /// The maximum number of blocks waiting to be written to the output file by the background thread.
+    /// When this number is reached, ChemicalOutput::update waits until the
+    /// background thread has written one of these blocks.
+    Index maxpending = 4;
+};
+
+/// Used to output chemical quantities of a sequence of chemical states to a binary file.
+/// The output file is organized in columns, one for the tag variable `t`
+/// given in each call to @ref update (e.g., time or iteration number), one for
+/// each added quantity, and one for each attachment. The values of these
+/// columns are accumulated in memory in blocks of rows and each block is
+/// written to the file, one column after another, by a background thread, so
+/// that output does not delay the calculations. Values are written in binary
+/// form, without any formatting, and the file can only be appended. A
+/// ChemicalOutputReader object can be used to read the output file, even if it
+/// is still being written.
+///
+/// The quantities can be given as formatted strings, which are compiled
+/// once with ChemicalQuantity, or as functions of the chemical properties of
+/// the system. In the example below, the amount of species Calcite, the pH of
+/// the aqueous solution, and the density of the system are recorded at every
+/// time step of a simulation:
+///
+/// ~~~
+/// ChemicalOutput output(system);
+/// output.add("Calcite", "speciesAmount(Calcite units=mmol)");
+/// output.add("pH");
+/// output.add("density", [](ChemicalProps const& props) { return props.density(); });
+/// output.open("output.rkout");
+///
+/// for(auto i = 0; i < nsteps; ++i)
+/// {
+///     ...
+///     output.update(state, t);
+/// }
+///
+/// output.close();
+///
+/// ChemicalOutputReader reader("output.rkout");
+/// ArrayXd pH = reader.column("pH");
+/// ~~~
+///
+/// Copies of a ChemicalOutput object share the same output file.
+/// @see ChemicalOutputReader
+class ChemicalOutput
+{
+public:
+    /// The type of functions that evaluate a chemical quantity using the chemical properties of the system.
+    using QuantityFn = Fn<real(ChemicalProps const&)>;
+
+    /// Construct a ChemicalOutput object.
+    explicit ChemicalOutput(ChemicalSystem const& system);
+
+    /// Construct a ChemicalOutput object with given options.
+    ChemicalOutput(ChemicalSystem const& system, ChemicalOutputOptions const& options);
+
+    /// Destroy this ChemicalOutput object after closing its output file if this is its last copy.
+    ~ChemicalOutput();
+
+    /// Set the options for the output (before the output file is opened).
+    auto setOptions(ChemicalOutputOptions const& options) -> void;
+
+    /// Return the options for the output.
+    auto options() const -> ChemicalOutputOptions const&;
+
+    /// Return the chemical system of the chemical states whose quantities are output.
+    auto system() const -> ChemicalSystem const&;
+
+    /// Add a quantity to be output (before the output file is opened).
+    /// @param quantity The formatted string of the quantity, also used as heading (see ChemicalQuantity)
+    auto add(String const& quantity) -> void;
+
+    /// Add a quantity to be output (before the output file is opened).
+    /// @param heading The heading of the column of this quantity in the output file
+    /// @param quantity The formatted string of the quantity (see ChemicalQuantity)
+    auto add(String const& heading, String const& quantity) -> void;
+
+    /// Add a quantity to be output (before the output file is opened).
+    /// @param heading The heading of the column of this quantity in the output file
+    /// @param quantity The function that evaluates the quantity
+    auto add(String const& heading, QuantityFn const& quantity) -> void;
+
+    /// Add extra columns in the output file whose values are given with @ref attach (before the output file is opened).
+    auto attachments(Strings const& headings) -> void;
+
+    /// Set the value of the next extra column in the row of the last call to @ref update.
+    /// The extra columns whose values are not given are filled with NaN.
+    auto attach(double value) -> void;
+
+    /// Return the headings of the columns in the output file.
+    auto headings() const -> Strings const&;
+
+    /// Open the output file (overwritten if existent).
+    auto open(String const& filename) -> void;
+
+    /// Return the name of the output file.
+    auto filename() const -> String const&;
+
+    /// Return true if the output file is open.
+    auto isOpen() const -> bool;
+
+    /// Output the quantities evaluated with given chemical properties in a new row.
+    /// @param props The chemical properties of the system
+    /// @param t The value of the tag variable (e.g., time or iteration number)
+    auto update(ChemicalProps const& props, double t) -> void;
+
+    /// Output the quantities evaluated with the chemical properties of given chemical state in a new row.
+    /// Note that the chemical properties in the chemical state are used as
+    /// they are, which are up to date after a chemical equilibrium or kinetics
+    /// calculation. Otherwise, use `state.props().update(state)` beforehand.
+    /// @param state The chemical state
+    /// @param t The value of the tag variable (e.g., time or iteration number)
+    auto update(ChemicalState const& state, double t) -> void;
+
+    /// Return the number of rows output so far.
+    auto numRows() const -> Index;
+
+    /// Write all rows output so far to the output file.
+    auto flush() -> void;
+
+    /// Write all rows output so far to the output file and close it.
+    auto close() -> void;
+
+    /// Convert this ChemicalOutput object to bool (true if the output file is open).
+    operator bool() const;
+
+private:
+    struct Impl;
+
+    SharedPtr<Impl> pimpl;
+};
 
-// #pragma once
+/// Used to read output files written with ChemicalOutput.
+/// The output file is memory-mapped and only the blocks of rows completely
+/// written to the file at the moment this object is constructed are read.
+/// @see ChemicalOutput
+class ChemicalOutputReader
+{
+public:
+    /// Construct a ChemicalOutputReader object.
+    /// @param filename The path to the output file
+    explicit ChemicalOutputReader(String const& filename);
 
-// // C++ includes
-// #include <memory>
-// #include <vector>
-// #include <sstream>
-// #include <string>
+    /// Destroy this ChemicalOutputReader object.
+    ~ChemicalOutputReader();
 
-// namespace Reaktoro {
+    /// Return the version of the format of the output file.
+    auto version() const -> Index;
 
-// // Forward declarations
-// class ChemicalState;
-// class ChemicalSystem;
-// class ReactionSystem;
-// class StringList;
+    /// Return the headings of the columns in the output file.
+    auto headings() const -> Strings const&;
 
-// /// A type used to output sequence of chemical states to a file or terminal.
-// class ChemicalOutput
-// {
-// public:
-//     /// Construct a default ChemicalOutput instance.
-//     ChemicalOutput();
+    /// Return the number of rows in the output file.
+    auto numRows() const -> Index;
 
-//     /// Construct a ChemicalOutput instance with given ChemicalSystem instance.
-//     explicit ChemicalOutput(const ChemicalSystem& system);
+    /// Return the number of columns in the output file.
+    auto numColumns() const -> Index;
 
-//     /// Construct a ChemicalOutput instance with given ReactionSystem instance.
-//     explicit ChemicalOutput(const ReactionSystem& reactions);
+    /// Return the values in the column with given index.
+    auto column(Index icolumn) const -> ArrayXd;
 
-//     /// Destroy this ChemicalOutput instance.
-//     virtual ~ChemicalOutput();
+    /// Return the values in the column with given heading.
+    auto column(String const& heading) const -> ArrayXd;
 
-//     /// Set the name of the output file.
-//     auto filename(std::string filename) -> void;
+    /// Return all values in the output file as a matrix with one row per call to ChemicalOutput::update.
+    auto data() const -> MatrixXd;
 
-//     /// Return the name of the output file.
-//     auto filename() const -> std::string;
+private:
+    struct Impl;
 
-//     /// Set a sufix word to the output file name.
-//     auto suffix(std::string name) -> void;
+    Ptr<Impl> pimpl;
+};
 
-//     /// Return the suffix word of the output file name.
-//     auto suffix() const -> std::string;
-
-//     /// Return the base name of output file name.
-//     auto basename() const -> std::string;
-
-//     /// Return the extension name of output file name.
-//     auto extension() const -> std::string;
-
-//     /// Add a quantity to be output.
-//     /// @param quantity The quantity name.
-//     auto add(std::string quantity) -> void;
-
-//     /// Add a quantity to be output.
-//     /// @param quantity The quantity name.
-//     /// @param label The label to be used in the headings.
-//     auto add(std::string quantity, std::string label) -> void;
-
-//     /// Set the titles of extra columns in the output file.
-//     auto attachments(std::vector<std::string> titles) -> void;
-
-//     /// Attach value to extra column data in the output file.
-//     auto attach(int value) -> void;
-
-//     /// Attach extra column data in the output file.
-//     auto attach(double value) -> void;
-
-//     /// Attach extra column data in the output file.
-//     auto attach(std::string value) -> void;
-
-//     /// Set the floating-point precision in the output.
-//     auto precision(int val) -> void;
-
-//     /// Enable or disable output in scientific format.
-//     auto scientific(bool enable) -> void;
-
-//     /// Enable or disable the output to the terminal.
-//     auto terminal(bool enabled) -> void;
-
-//     /// Return the name of the quantities in the output file.
-//     auto quantities() const -> std::vector<std::string>;
-
-//     /// Return the headings of the output file.
-//     auto headings() const -> std::vector<std::string>;
-
-//     /// Open the output file.
-//     auto open() -> void;
-
-//     /// Update the output with a new chemical state and its tag.
-//     auto update(const ChemicalState& state, double t) -> void;
-
-//     /// Close the output file.
-//     auto close() -> void;
-
-//     /// Convert this ChemicalOutput instance to bool.
-//     operator bool() const;
-
-// private:
-//     struct Impl;
-
-//     std::shared_ptr<Impl> pimpl;
-// };
-
-// } // namespace Reaktoro
+} // namespace Reaktoro
@@ -0,0 +1,69 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// pybind11 includes
+#include <Reaktoro/pybind11.hxx>
+
+// Reaktoro includes
+#include <Reaktoro/Core/ChemicalOutput.hpp>
+#include <Reaktoro/Core/ChemicalProps.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+using namespace Reaktoro;
+
+void exportChemicalOutput(py::module& m)
+{
+    py::class_<ChemicalOutputOptions>(m, "ChemicalOutputOptions")
+        .def(py::init<>())
+        .def_readwrite("blocksize", &ChemicalOutputOptions::blocksize, "The number of rows accumulated in memory before they are written to the output file as a block.")
+        .def_readwrite("maxpending", &ChemicalOutputOptions::maxpending, "The maximum number of blocks waiting to be written to the output file by the background thread.")
+        ;
+
+    py::class_<ChemicalOutput>(m, "ChemicalOutput")
+        .def(py::init<ChemicalSystem const&>())
+        .def(py::init<ChemicalSystem const&, ChemicalOutputOptions const&>())
+        .def("setOptions", &ChemicalOutput::setOptions, "Set the options for the output (before the output file is opened).")
+        .def("options", &ChemicalOutput::options, return_internal_ref, "Return the options for the output.")
+        .def("system", &ChemicalOutput::system, return_internal_ref, "Return the chemical system of the chemical states whose quantities are output.")
+        .def("add", py::overload_cast<String const&>(&ChemicalOutput::add), "Add a quantity given as a formatted string to be output (before the output file is opened).")
+        .def("add", py::overload_cast<String const&, String const&>(&ChemicalOutput::add), "Add a quantity given as a formatted string to be output with given heading (before the output file is opened).")
+        .def("add", py::overload_cast<String const&, ChemicalOutput::QuantityFn const&>(&ChemicalOutput::add), "Add a quantity given as a function to be output with given heading (before the output file is opened).")
+        .def("attachments", &ChemicalOutput::attachments, "Add extra columns in the output file whose values are given with method attach (before the output file is opened).")
+        .def("attach", &ChemicalOutput::attach, "Set the value of the next extra column in the row of the last call to method update.")
+        .def("headings", &ChemicalOutput::headings, return_internal_ref, "Return the headings of the columns in the output file.")
+        .def("open", &ChemicalOutput::open, "Open the output file (overwritten if existent).")
+        .def("filename", &ChemicalOutput::filename, return_internal_ref, "Return the name of the output file.")
+        .def("isOpen", &ChemicalOutput::isOpen, "Return true if the output file is open.")
+        .def("update", py::overload_cast<ChemicalProps const&, double>(&ChemicalOutput::update), "Output the quantities evaluated with given chemical properties in a new row.")
+        .def("update", py::overload_cast<ChemicalState const&, double>(&ChemicalOutput::update), "Output the quantities evaluated with the chemical properties of given chemical state in a new row.")
+        .def("numRows", &ChemicalOutput::numRows, "Return the number of rows output so far.")
+        .def("flush", &ChemicalOutput::flush, "Write all rows output so far to the output file.")
+        .def("close", &ChemicalOutput::close, "Write all rows output so far to the output file and close it.")
+        .def("__bool__", [](ChemicalOutput const& self) { return bool(self); })
+        ;
+
+    py::class_<ChemicalOutputReader>(m, "ChemicalOutputReader")
+        .def(py::init<String const&>())
+        .def("version", &ChemicalOutputReader::version, "Return the version of the format of the output file.")
+        .def("headings", &ChemicalOutputReader::headings, return_internal_ref, "Return the headings of the columns in the output file.")
+        .def("numRows", &ChemicalOutputReader::numRows, "Return the number of rows in the output file.")
+        .def("numColumns", &ChemicalOutputReader::numColumns, "Return the number of columns in the output file.")
+        .def("column", py::overload_cast<Index>(&ChemicalOutputReader::column, py::const_), "Return the values in the column with given index.")
+        .def("column", py::overload_cast<String const&>(&ChemicalOutputReader::column, py::const_), "Return the values in the column with given heading.")
+        .def("data", &ChemicalOutputReader::data, "Return all values in the output file as a matrix with one row per call to ChemicalOutput::update.")
+        ;
+}
@@ -0,0 +1,131 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <cmath>
+#include <cstdio>
+
+// Reaktoro includes
+#include <Reaktoro/Core/ChemicalOutput.hpp>
+#include <Reaktoro/Core/ChemicalProps.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Extensions/Supcrt/SupcrtDatabase.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing ChemicalOutput and ChemicalOutputReader", "[ChemicalOutput]")
+{
+    const String filename = "reaktoro-chemical-output-test.rkout";
+
+    SupcrtDatabase db("supcrtbl");
+
+    ChemicalSystem system(db,
+        AqueousPhase("H2O(aq) H+ OH- Ca+2 HCO3- CO3-2 CO2(aq)"),
+        MineralPhase("Calcite"));
+
+    ChemicalState state(system);
+    state.set("H2O(aq)", 1.0, "kg");
+
+    ChemicalOutputOptions options;
+    options.blocksize = 3;
+    options.maxpending = 1;
+
+    ChemicalOutput output(system, options);
+    output.add("T", [](ChemicalProps const& props) { return props.temperature(); });
+    output.add("Calcite", [](ChemicalProps const& props) { return props.speciesAmount("Calcite"); });
+    output.attachments({ "step" });
+    output.add("TC", "temperature(units=celsius)");
+    output.add("speciesAmount(Calcite units=mmol)");
+
+    CHECK( output.headings() == Strings{ "t", "T", "Calcite", "TC", "speciesAmount(Calcite units=mmol)", "step" } );
+    CHECK_FALSE( output );
+
+    output.open(filename);
+
+    CHECK( output );
+    CHECK( output.filename() == filename );
+    CHECK_THROWS( output.add("P", [](ChemicalProps const& props) { return props.pressure(); }) );
+    CHECK_THROWS( output.attach(1.0) ); // no row yet
+
+    const auto nsteps = 11;
+
+    auto update = [&](Index i)
+    {
+        state.temperature(25.0 + i, "celsius");
+        state.set("Calcite", 0.1 * i, "mol");
+        state.props().update(state);
+        output.update(state, 2.0 * i);
+        if(i % 2 == 0)
+            output.attach(i);
+    };
+
+    // Output a few rows and read them back while the output file is still open
+    for(auto i = 0; i < 4; ++i)
+        update(i);
+
+    output.flush();
+
+    CHECK( ChemicalOutputReader(filename).numRows() == 4 );
+
+    for(auto i = 4; i < nsteps; ++i)
+        update(i);
+
+    CHECK_THROWS( output.attach(1.0) ); // only one attachment per row
+
+    CHECK( output.numRows() == nsteps );
+
+    output.close();
+
+    CHECK_FALSE( output );
+
+    ChemicalOutputReader reader(filename);
+
+    CHECK( reader.version() == 1 );
+    CHECK( reader.headings() == output.headings() );
+    CHECK( reader.numRows() == nsteps );
+    CHECK( reader.numColumns() == 6 );
+
+    const ArrayXd t = reader.column("t");
+    const ArrayXd T = reader.column("T");
+    const ArrayXd calcite = reader.column(2);
+    const ArrayXd TC = reader.column("TC");
+    const ArrayXd mmol = reader.column(4);
+    const ArrayXd step = reader.column("step");
+    const MatrixXd data = reader.data();
+
+    CHECK( data.rows() == nsteps );
+    CHECK( data.cols() == 6 );
+
+    for(auto i = 0; i < nsteps; ++i)
+    {
+        CHECK( t[i] == Approx(2.0 * i) );
+        CHECK( T[i] == Approx(298.15 + i) );
+        CHECK( calcite[i] == Approx(0.1 * i) );
+        CHECK( TC[i] == Approx(25.0 + i) );
+        CHECK( mmol[i] == Approx(100.0 * i) );
+        CHECK( (i % 2 == 0 ? step[i] == i : std::isnan(step[i])) );
+        CHECK( data(i, 1) == T[i] );
+    }
+
+    CHECK_THROWS( reader.column("pH") );
+    CHECK_THROWS( reader.column(6) );
+
+    std::remove(filename.c_str());
+}
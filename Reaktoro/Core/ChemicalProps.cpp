@@ -27,6 +27,7 @@ using namespace tabulate;
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
 #include <Reaktoro/Common/Enumerate.hpp>
+#include <Reaktoro/Common/Profiler.hpp>
 #include <Reaktoro/Core/ChemicalPropsPhase.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/Utils.hpp>
@@ -82,6 +83,8 @@ auto ChemicalProps::update(ChemicalState const& state) -> void
 
 auto ChemicalProps::update(real const& T0, real const& P0, ArrayXrConstRef n0) -> void
 {
+    RKT_PROFILE_ZONE("ChemicalProps::update");
+
     mstateid += 1;
 
     assert(T0 >= 0.0);
@@ -123,6 +126,8 @@ auto ChemicalProps::updateIdeal(ChemicalState const& state) -> void
 
 auto ChemicalProps::updateIdeal(real const& T0, real const& P0, ArrayXrConstRef n0) -> void
 {
+    RKT_PROFILE_ZONE("ChemicalProps::updateIdeal");
+
     mstateid += 1;
 
     assert(T0 >= 0.0);
@@ -212,7 +217,7 @@ auto ChemicalProps::phasePropsRef(StringOrIndex phaseid) -> ChemicalPropsPhaseRe
     });
 }
 
-auto ChemicalProps::extra() const -> const Map<String, Any>&
+auto ChemicalProps::extra() const -> const SlotMap&
 {
     return m_extra;
 }
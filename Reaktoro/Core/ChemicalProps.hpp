@@ -106,7 +106,7 @@ public:
     auto phaseProps(StringOrIndex phase) const -> ChemicalPropsPhaseConstRef;
 
     /// Return the extra data produced during the evaluation of activity models.
-    auto extra() const -> const Map<String, Any>&;
+    auto extra() const -> const SlotMap&;
 
     /// Return the temperature of the system (in K).
     auto temperature() const -> real;
@@ -553,7 +553,7 @@ private:
     /// The extra data produced during the evaluation of activity models. This
     /// extra data allows the activity model of a phase to reuse calculated
     /// data from the activity model of a previous phase if needed.
-    Map<String, Any> m_extra;
+    SlotMap m_extra;
 
     /// Return a mutable view to the chemical properties of a phase with given index.
     /// @param phase The name or index of the phase in the system.
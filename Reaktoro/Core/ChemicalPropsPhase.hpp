@@ -20,6 +20,7 @@
 // Reaktoro includes
 #include <Reaktoro/Common/ArrayStream.hpp>
 #include <Reaktoro/Common/Constants.hpp>
+#include <Reaktoro/Common/Profiler.hpp>
 #include <Reaktoro/Common/TypeOp.hpp>
 #include <Reaktoro/Core/Phase.hpp>
 #include <Reaktoro/Core/StateOfMatter.hpp>
@@ -211,7 +212,7 @@ public:
     /// @param P The pressure condition (in Pa)
     /// @param n The amounts of the species in the phase (in mol)
     /// @param extra The extra properties evaluated in the activity models
-    auto update(const real& T, const real& P, ArrayXrConstRef n, Map<String, Any>& extra)
+    auto update(const real& T, const real& P, ArrayXrConstRef n, SlotMap& extra)
     {
         _update<false>(T, P, n, extra);
     }
@@ -221,7 +222,7 @@ public:
     /// @param P The pressure condition (in Pa)
     /// @param n The amounts of the species in the phase (in mol)
     /// @param extra The extra properties evaluated in the activity models
-    auto updateIdeal(const real& T, const real& P, ArrayXrConstRef n, Map<String, Any>& extra)
+    auto updateIdeal(const real& T, const real& P, ArrayXrConstRef n, SlotMap& extra)
     {
         _update<true>(T, P, n, extra);
     }
@@ -613,8 +614,10 @@ private:
     /// @param n The amounts of the species in the phase (in mol)
     /// @param extra The extra data mapped to activity mode
     template<bool use_ideal_activity_model>
-    auto _update(const real& T, const real& P, ArrayXrConstRef n, Map<String, Any>& extra)
+    auto _update(const real& T, const real& P, ArrayXrConstRef n, SlotMap& extra)
     {
+        RKT_PROFILE_ZONE("ChemicalPropsPhase::update");
+
         mdata.T = T;
         mdata.P = P;
         mdata.n = n;
@@ -656,16 +659,9 @@ private:
         assert(    u.size() == N );
 
         // Compute the standard thermodynamic properties of the species in the phase.
-        StandardThermoProps aux;
-        for(auto i = 0; i < N; ++i)
         {
-            aux = species[i].standardThermoProps(T, P);
-            G0[i]  = aux.G0;
-            H0[i]  = aux.H0;
-            V0[i]  = aux.V0;
-            VT0[i] = aux.VT0;
-            VP0[i] = aux.VP0;
-            Cp0[i] = aux.Cp0;
+            RKT_PROFILE_ZONE("StandardThermoModel");
+            phase().standardThermoModelBatch().eval(T, P, G0, H0, V0, Cp0, VT0, VP0);
         }
 
         // Compute the amount of the phase
@@ -690,7 +686,11 @@ private:
             phase().idealActivityModel() : phase().activityModel();
 
         if(nsum == 0.0) aprops = 0.0;
-        else activity_model(aprops, args);
+        else
+        {
+            RKT_PROFILE_ZONE("ActivityModel");
+            activity_model(aprops, args);
+        }
 
         // Compute the chemical potentials of the species
         u = G0 + R*T*ln_a;
@@ -1,956 +1,543 @@
-// // Reaktoro is a unified framework for modeling chemically reactive systems.
-// //
-// // Copyright © 2014-2022 Allan Leal
-// //
-// // This library is free software; you can redistribute it and/or
-// // modify it under the terms of the GNU Lesser General Public
-// // License as published by the Free Software Foundation; either
-// // version 2.1 of the License, or (at your option) any later version.
-// //
-// // This library is distributed in the hope that it will be useful,
-// // but WITHOUT ANY WARRANTY; without even the implied warranty of
-// // MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
-// // Lesser General Public License for more details.
-// //
-// // You should have received a copy of the GNU Lesser General Public License
-// // along with this library. If not, see <http://www.gnu.org/licenses/>.
-
-// #include "ChemicalQuantity.hpp"
-
-// // C++ includes
-// #include <map>
-
-// // Reaktoro includes
-// #include <Reaktoro/Common/ConvertUtils.hpp>
-// #include <Reaktoro/Common/Exception.hpp>
-// #include <Reaktoro/Common/NamingUtils.hpp>
-// #include <Reaktoro/Common/StringUtils.hpp>
-// #include <Reaktoro/Common/Units.hpp>
-// #include <Reaktoro/Core/ChemicalProps.hpp>
-// #include <Reaktoro/Core/ChemicalProperty.hpp>
-// #include <Reaktoro/Core/ChemicalState.hpp>
-// #include <Reaktoro/Core/ChemicalSystem.hpp>
-// #include <Reaktoro/Core/Element.hpp>
-// #include <Reaktoro/Core/ReactionSystem.hpp>
-// #include <Reaktoro/Core/Species.hpp>
-// #include <Reaktoro/Water/WaterConstants.hpp>
-
-// namespace Reaktoro {
-
-// namespace detail {
-
-// /// Return the index of an element with given symbol in a list of elements or raise an exception with it does not exist.
-// auto indexElementWithError(const String& symbol, const ChemicalSystem& system, const String& method)
-// {
-//     const auto idx = system.elements().index(symbol);
-//     error(idx >= system.elements().size(), "Could not evaluate method ChemicalQuantity::", method, " with inexistent element with symbol ", symbol, ".");
-//     return idx;
-// }
-
-// /// Return the index of a species with given name in a list of species or raise an exception with it does not exist.
-// auto indexSpeciesWithError(const String& name, const ChemicalSystem& system, const String& method)
-// {
-//     const auto idx = system.species().index(name);
-//     error(idx >= system.species().size(), "Could not evaluate method ChemicalQuantity::", method, " with inexistent species with name ", name, ".");
-//     return idx;
-// }
-
-// /// Return the index of a phase with given name in a list of phases or raise an exception with it does not exist.
-// auto indexPhaseWithError(const String& name, const ChemicalSystem& system, const String& method)
-// {
-//     const auto idx = system.indexPhase(name);
-//     error(idx >= system.phases().size(), "Could not evaluate method ChemicalQuantity::", method, " with inexistent phase with name ", name, ".");
-//     return idx;
-// }
-
-// } // namespace detail
-
-// namespace quantity {
-
-// auto temperature(const ChemicalQuantity& quantity, std::string args) -> std::function<real()>;
-
-// auto pressure(const ChemicalQuantity& quantity, std::string args) -> std::function<real()>;
-
-// auto volume(const ChemicalQuantity& quantity, std::string args) -> std::function<real()>;
-
-// auto moleFraction(const ChemicalQuantity& quantity, std::string args) -> std::function<real()>;
-
-// auto activity(const ChemicalQuantity& quantity, std::string args) -> std::function<real()>;
-
-// auto activityCoefficient(const ChemicalQuantity& quantity, std::string args) -> std::function<real()>;
-
-// auto fugacity(const ChemicalQuantity& quantity, std::string args) -> std::function<real()>;
-
-// auto chemicalPotential(const ChemicalQuantity& quantity, std::string args) -> std::function<real()>;
-
-// auto elementAmount(const ChemicalQuantity& quantity, std::string args) -> std::function<real()>;
-
-// auto elementAmountInPhase(const ChemicalQuantity& quantity, std::string args) -> std::function<real()>;
-
-// auto elementMass(const ChemicalQuantity& quantity, std::string args) -> std::function<real()>;
-
-// auto elementMassInPhase(const ChemicalQuantity& quantity, std::string args) -> std::function<real()>;
-
-// auto elementMolality(const ChemicalQuantity& quantity, std::string args) -> std::function<real()>;
-
-// auto elementMolarity(const ChemicalQuantity& quantity, std::string args) -> std::function<real()>;
-
-// auto speciesAmount(const ChemicalQuantity& quantity, std::string args) -> std::function<real()>;
-
-// auto speciesMass(const ChemicalQuantity& quantity, std::string args) -> std::function<real()>;
-
-// auto speciesMolality(const ChemicalQuantity& quantity, std::string args) -> std::function<real()>;
-
-// auto speciesMolarity(const ChemicalQuantity& quantity, std::string args) -> std::function<real()>;
-
-// auto phaseAmount(const ChemicalQuantity& quantity, std::string args) -> std::function<real()>;
-
-// auto phaseMass(const ChemicalQuantity& quantity, std::string args) -> std::function<real()>;
-
-// auto phaseVolume(const ChemicalQuantity& quantity, std::string args) -> std::function<real()>;
-
-// auto pH(const ChemicalQuantity& quantity, std::string args) -> std::function<real()>;
-
-// auto pE(const ChemicalQuantity& quantity, std::string args) -> std::function<real()>;
-
-// auto Eh(const ChemicalQuantity& quantity, std::string args) -> std::function<real()>;
-
-// auto ionicStrength(const ChemicalQuantity& quantity, std::string args) -> std::function<real()>;
-
-// auto fluidVolume(const ChemicalQuantity& quantity, std::string args) -> std::function<real()>;
-
-// auto fluidVolumeFraction(const ChemicalQuantity& quantity, std::string args) -> std::function<real()>;
-
-// auto solidVolume(const ChemicalQuantity& quantity, std::string args) -> std::function<real()>;
-
-// auto solidVolumeFraction(const ChemicalQuantity& quantity, std::string args) -> std::function<real()>;
-
-// auto reactionRate(const ChemicalQuantity& quantity, std::string args) -> std::function<real()>;
-
-// auto reactionEquilibriumIndex(const ChemicalQuantity& quantity, std::string args) -> std::function<real()>;
-
-// auto tag(const ChemicalQuantity& quantity, std::string args) -> std::function<real()>;
-
-// using Function = std::function<decltype(temperature)>;
-
-// const std::map<std::string, Function> fndict =
-// {
-//     {"temperature"              , quantity::temperature},
-//     {"pressure"                 , quantity::pressure},
-//     {"volume"                   , quantity::volume},
-//     {"molefraction"             , quantity::moleFraction},
-//     {"activity"                 , quantity::activity},
-//     {"activitycoefficient"      , quantity::activityCoefficient},
-//     {"fugacity"                 , quantity::fugacity},
-//     {"chemicalpotential"        , quantity::chemicalPotential},
-//     {"elementamount"            , quantity::elementAmount},
-//     {"elementamountinphase"     , quantity::elementAmountInPhase},
-//     {"elementmass"              , quantity::elementMass},
-//     {"elementmassinphase"       , quantity::elementMassInPhase},
-//     {"elementmolality"          , quantity::elementMolality},
-//     {"elementmolarity"          , quantity::elementMolarity},
-//     {"speciesamount"            , quantity::speciesAmount},
-//     {"speciesmass"              , quantity::speciesMass},
-//     {"speciesmolality"          , quantity::speciesMolality},
-//     {"speciesmolarity"          , quantity::speciesMolarity},
-//     {"phaseamount"              , quantity::phaseAmount},
-//     {"phasemass"                , quantity::phaseMass},
-//     {"phasevolume"              , quantity::phaseVolume},
-//     {"ph"                       , quantity::pH},
-//     {"pe"                       , quantity::pE},
-//     {"eh"                       , quantity::Eh},
-//     {"ionicstrength"            , quantity::ionicStrength},
-//     {"fluidvolume"              , quantity::fluidVolume},
-//     {"fluidvolumefraction"      , quantity::fluidVolumeFraction},
-//     {"solidvolume"              , quantity::solidVolume},
-//     {"solidvolumefraction"      , quantity::solidVolumeFraction},
-//     {"reactionrate"             , quantity::reactionRate},
-//     {"reactionequilibriumindex" , quantity::reactionEquilibriumIndex},
-//     {"tag"                      , quantity::tag},
-//     {"t"                        , quantity::tag},
-//     {"time"                     , quantity::tag},
-//     {"progress"                 , quantity::tag},
-// };
-
-// auto function(std::string fname) -> Function;
-
-// } // namespace quantity
-
-// struct ChemicalQuantity::Impl
-// {
-//     /// The chemical system instance
-//     ChemicalSystem system;
-
-//     /// The reactions in the chemical system
-//     ReactionSystem reactions;
-
-//     /// The chemical state of the system
-//     ChemicalState state;
-
-//     /// The thermodynamic properties of the chemical system at (*T*, *P*, **n**)
-//     ChemicalProps props;
-
-//     /// The progress variable at which the chemical state is referred (if time, in units of s)
-//     real tag = {};
-
-//     /// The temperature of the chemical system (in units of K).
-//     real T = {};
-
-//     /// The pressure of the chemical system (in units of Pa).
-//     real P = {};
-
-//     /// The molar amounts of the species in the chemical system (in units of mol).
-//     VectorXr n;
-
-//     /// The rates of the reactions in the chemical system (in units of mol/s).
-//     VectorXr rates;
-
-//     /// All created chemical quantity functions from formatted strings
-//     std::map<std::string, Function> function_map;
-
-//     Impl() = delete;
-
-//     /// Construct a custom Impl instance with given ChemicalSystem object
-//     explicit Impl(const ChemicalSystem& system)
-//     : system(system), state(system), props(system)
-//     {
-//     }
-
-//     /// Construct a custom Impl instance with given ReactionSystem object
-//     Impl(const ReactionSystem& reactions)
-//     : system(reactions.system()),
-//       state(reactions.system()),
-//       props(reactions.system()),
-//       reactions(reactions)
-//     {
-//     }
-
-//     /// Update the state of the chemical quantity instance
-//     auto update(const ChemicalState& state) -> void
-//     {
-//         update(state, 0.0);
-//     }
-
-//     /// Update the state of the chemical quantity instance
-//     auto update(const ChemicalState& state_, real t_) -> void
-//     {
-//         // Update the chemical state of the system
-//         state = state_;
-
-//         // Update the progress variable
-//         tag = t_;
-
-//         // Update the temperature, pressure and molar composition of the system
-//         T = state.temperature();
-//         P = state.pressure();
-//         n = state.speciesAmounts();
-
-//         // Update the thermodynamic properties of the system
-//         props = state.props();
-
-//         // Update the rates of the reactions
-//         if(!reactions.reactions().empty())
-//             rates = reactions.rates(props);
-//     }
-
-//     auto function(const ChemicalQuantity& quantity, std::string str) -> const Function&
-//     {
-//         auto it = function_map.find(str);
-//         if(it != function_map.end())
-//             return it->second;
-
-//         str = trim(str);
-//         auto ibegin = str.find_first_of("(");
-//         auto iend = str.find_last_of(")");
-
-//         const std::string fname = lowercase(str.substr(0, ibegin));
-//         const std::string arguments = ibegin == std::string::npos ?
-//                 "" : str.substr(ibegin+1, iend-ibegin-1);
-
-//         Function newfunc = quantity::function(fname)(quantity, arguments);
-
-//         auto res = function_map.insert({str, newfunc});
-
-//         return res.first->second;
-//     }
-
-//     auto value(const ChemicalQuantity& quantity, std::string str) -> real
-//     {
-//         return function(quantity, str)();
-//     }
-// };
-
-// ChemicalQuantity::ChemicalQuantity(const ChemicalSystem& system)
-// : pimpl(new Impl(system))
-// {}
-
-// ChemicalQuantity::ChemicalQuantity(const ChemicalState& state)
-// : ChemicalQuantity(state.system())
-// {
-//     update(state);
-// }
-
-// ChemicalQuantity::ChemicalQuantity(const ReactionSystem& reactions)
-// : pimpl(new Impl(reactions))
-// {}
-
-// auto ChemicalQuantity::system() const -> const ChemicalSystem&
-// {
-//     return pimpl->system;
-// }
-
-// auto ChemicalQuantity::reactions() const -> const ReactionSystem&
-// {
-//     return pimpl->reactions;
-// }
-
-// auto ChemicalQuantity::state() const -> const ChemicalState&
-// {
-//     return pimpl->state;
-// }
-
-// auto ChemicalQuantity::props() const -> const ChemicalProps&
-// {
-//     return pimpl->props;
-// }
-
-// auto ChemicalQuantity::rates() const -> const VectorXr&
-// {
-//     return pimpl->rates;
-// }
-
-// auto ChemicalQuantity::tag() const -> real
-// {
-//     return pimpl->tag;
-// }
-
-// auto ChemicalQuantity::update(const ChemicalState& state) -> ChemicalQuantity&
-// {
-//     pimpl->update(state);
-//     return *this;
-// }
-
-// auto ChemicalQuantity::update(const ChemicalState& state, real t) -> ChemicalQuantity&
-// {
-//     pimpl->update(state, t);
-//     return *this;
-// }
-
-// auto ChemicalQuantity::value(std::string str) const -> real
-// {
-//     return pimpl->value(*this, str);
-// }
-
-// auto ChemicalQuantity::function(std::string str) const -> Function
-// {
-//     return pimpl->function(*this, str);
-// }
-
-// auto ChemicalQuantity::operator()(std::string str) const -> real
-// {
-//     return value(str);
-// }
-
-// namespace quantity {
-
-// /// A type used to describe the list of arguments for quantity querying.
-// struct Args
-// {
-//     /// Construct a default Args instance.
-//     Args()
-//     {}
-
-//     /// Construct a custom Args instance from a formatted string.
-//     Args(std::string arguments)
-//     : str(arguments)
-//     {
-//         auto words = split(str);
-//         for(auto word : words)
-//         {
-//             auto pair = split(word, "=");
-//             if(pair.size() == 2)
-//                 kwargs.insert({ pair[0], pair[1] });
-//             else args.push_back(word);
-//         }
-//     }
-
-//     /// Return the ith non-keyword argument.
-//     auto argument(Index i) const -> std::string
-//     {
-//         assert(i < args.size());
-//         return args[i];
-//     }
-
-//     /// Return the argument with given keyword.
-//     auto argument(std::string keyword, std::string ifnone = "") const -> std::string
-//     {
-//         auto iter = kwargs.find(keyword);
-//         if(iter != kwargs.end()) return iter->second;
-//         else return ifnone;
-//     }
-
-// private:
-//     /// The original formated string
-//     std::string str;
-
-//     /// The non-keyword arguments
-//     std::vector<std::string> args;
-
-//     /// The keyword arguments
-//     std::map<std::string, std::string> kwargs;
-// };
-
-// auto temperature(const ChemicalQuantity& quantity, std::string arguments) -> std::function<real()>
-// {
-//     const Args args(arguments);
-//     const auto units = args.argument("units", "K");
-//     auto func = [=]() -> real
-//     {
-//         const auto val = quantity.state().temperature();
-//         return units::convert(val, "K", units);
-//     };
-//     return func;
-// }
-
-// auto pressure(const ChemicalQuantity& quantity, std::string arguments) -> std::function<real()>
-// {
-//     const Args args(arguments);
-//     const auto units = args.argument("units", "Pa");
-//     auto func = [=]() -> real
-//     {
-//         const auto val = quantity.state().pressure();
-//         return units::convert(val, "Pa", units);
-//     };
-//     return func;
-// }
-
-// auto volume(const ChemicalQuantity& quantity, std::string arguments) -> std::function<real()>
-// {
-//     const Args args(arguments);
-//     const auto units = args.argument("units", "m3");
-//     const auto factor = units::convert(1.0, "m3", units);
-//     auto func = [=]() -> real
-//     {
-//         const ChemicalProps& props = quantity.props();
-//         const auto val = props.volume();
-//         return factor * val;
-//     };
-//     return func;
-// }
-
-// auto moleFraction(const ChemicalQuantity& quantity, std::string arguments) -> std::function<real()>
-// {
-//     const Args args(arguments);
-//     const ChemicalSystem& system = quantity.system();
-//     const std::string species = args.argument(0);
-//     const Index ispecies = system.species().index(species);
-//     error(ispecies > system.species().size(), "Could not evaluate ChemicalQuantity::moleFraction with inexistent species with name ", species, ".");
-//     auto func = [=]() -> real
-//     {
-//         const ChemicalProps& props = quantity.props();
-//         const auto xi = props.moleFractions()[ispecies];
-//         return xi;
-//     };
-//     return func;
-// }
-
-// auto activity(const ChemicalQuantity& quantity, std::string arguments) -> std::function<real()>
-// {
-//     const Args args(arguments);
-//     const ChemicalSystem& system = quantity.system();
-//     const std::string species = args.argument(0);
-//     const Index ispecies = system.species().index(species);
-//     error(ispecies > system.species().size(), "Could not evaluate ChemicalQuantity::activity with inexistent species with name ", species, ".");
-//     auto func = [=]() -> real
-//     {
-//         const ChemicalProps& props = quantity.props();
-//         const auto ln_ai = props.lnActivities()[ispecies];
-//         return std::exp(ln_ai);
-//     };
-//     return func;
-// }
-
-// auto activityCoefficient(const ChemicalQuantity& quantity, std::string arguments) -> std::function<real()>
-// {
-//     const Args args(arguments);
-//     const ChemicalSystem& system = quantity.system();
-//     const std::string species = args.argument(0);
-//     const Index ispecies = system.species().index(species);
-//     error(ispecies > system.species().size(), "Could not evaluate ChemicalQuantity::activityCoefficient with inexistent species with name ", species, ".");
-//     auto func = [=]() -> real
-//     {
-//         const ChemicalProps& props = quantity.props();
-//         const auto ln_gi = props.lnActivityCoefficients()[ispecies];
-//         return std::exp(ln_gi);
-//     };
-//     return func;
-// }
-
-// auto fugacity(const ChemicalQuantity& quantity, std::string arguments) -> std::function<real()>
-// {
-//     const Args args(arguments);
-//     const ChemicalSystem& system = quantity.system();
-//     const std::string species = args.argument(0);
-//     const Index ispecies = system.species().index(species);
-//     error(ispecies > system.species().size(), "Could not evaluate ChemicalQuantity::fugacity with inexistent species with name ", species, ".");
-//     const auto units = args.argument("units", "bar");
-//     const auto factor = units::convert(1.0, "bar", units);
-//     auto func = [=]() -> real
-//     {
-//         const ChemicalProps& props = quantity.props();
-//         const auto ln_ai = props.lnActivities()[ispecies];
-//         const auto val = std::exp(ln_ai);
-//         return factor * val;
-//     };
-//     return func;
-// }
-
-// auto chemicalPotential(const ChemicalQuantity& quantity, std::string arguments) -> std::function<real()>
-// {
-//     const Args args(arguments);
-//     const ChemicalSystem& system = quantity.system();
-//     const std::string species = args.argument(0);
-//     const Index ispecies = system.species().index(species);
-//     error(ispecies > system.species().size(), "Could not evaluate ChemicalQuantity::chemicalPotential with inexistent species with name ", species, ".");
-//     const auto units = args.argument("units", "J/mol");
-//     const auto factor = units::convert(1.0, "J/mol", units);
-//     auto func = [=]() -> real
-//     {
-//         const ChemicalProps& props = quantity.props();
-//         const auto val = props.chemicalPotentials()[ispecies];
-//         return factor * val;
-//     };
-//     return func;
-// }
-
-// auto elementAmount(const ChemicalQuantity& quantity, std::string arguments) -> std::function<real()>
-// {
-//     const Args args(arguments);
-//     const ChemicalSystem& system = quantity.system();
-//     const std::string element = args.argument(0);
-//     const auto units = args.argument("units", "mol");
-//     const auto factor = units::convert(1.0, "mol", units);
-//     const Index ielement = detail::indexElementWithError(element, system, "elementAmount");
-//     auto func = [=]() -> real
-//     {
-//         const ChemicalState& state = quantity.state();
-//         const auto val = state.elementAmount(ielement);
-//         return factor * val;
-//     };
-//     return func;
-// }
-
-// auto elementAmountInPhase(const ChemicalQuantity& quantity, std::string arguments) -> std::function<real()>
-// {
-//     const Args args(arguments);
-//     const ChemicalSystem& system = quantity.system();
-//     const std::string element = args.argument(0);
-//     const std::string phase = args.argument(1);
-//     const auto units = args.argument("units", "mol");
-//     const auto factor = units::convert(1.0, "mol", units);
-//     const Index ielement = detail::indexElementWithError(element, system, "elementAmountInPhase");
-//     const Index iphase = detail::indexPhaseWithError(phase, system, "elementAmountInPhase");
-//     auto func = [=]() -> real
-//     {
-//         const ChemicalState& state = quantity.state();
-//         const auto val = state.elementAmountInPhase(ielement, iphase);
-//         return factor * val;
-//     };
-//     return func;
-// }
-
-// auto elementMass(const ChemicalQuantity& quantity, std::string arguments) -> std::function<real()>
-// {
-//     const Args args(arguments);
-//     const ChemicalSystem& system = quantity.system();
-//     const std::string element = args.argument(0);
-//     const auto units = args.argument("units", "kg");
-//     const auto factor = units::convert(1.0, "kg", units);
-//     const Index ielement = detail::indexElementWithError(element, system, "elementMass");
-//     const real molar_mass = system.element(ielement).molarMass();
-//     auto func = [=]() -> real
-//     {
-//         const ChemicalState& state = quantity.state();
-//         const auto val = state.elementAmount(ielement);
-//         return factor * molar_mass * val;
-//     };
-//     return func;
-// }
-
-// auto elementMassInPhase(const ChemicalQuantity& quantity, std::string arguments) -> std::function<real()>
-// {
-//     const Args args(arguments);
-//     const ChemicalSystem& system = quantity.system();
-//     const std::string element = args.argument(0);
-//     const std::string phase = args.argument(1);
-//     const auto units = args.argument("units", "kg");
-//     const auto factor = units::convert(1.0, "kg", units);
-//     const Index ielement = detail::indexElementWithError(element, system, "elementMassInPhase");
-//     const Index iphase = detail::indexPhaseWithError(phase, system, "elementMassInPhase");
-//     const real molar_mass = system.element(ielement).molarMass();
-//     auto func = [=]() -> real
-//     {
-//         const ChemicalState& state = quantity.state();
-//         const auto val = state.elementAmountInPhase(ielement, iphase);
-//         return factor * molar_mass * val;
-//     };
-//     return func;
-// }
-
-// auto elementMolality(const ChemicalQuantity& quantity, std::string arguments) -> std::function<real()>
-// {
-//     const Args args(arguments);
-//     const ChemicalSystem& system = quantity.system();
-//     const std::string element = args.argument(0);
-//     const auto units = args.argument("units", "molal");
-//     const auto factor = units::convert(1.0, "molal", units);
-//     const Index ielement = detail::indexElementWithError(element, system, "elementMolality");
-//     const Index iphase = system.indexPhaseWithError("Aqueous");
-//     const Index iwater = system.indexSpeciesAny(alternativeWaterNames());
-//     auto func = [=]() -> real
-//     {
-//         const ChemicalState& state = quantity.state();
-//         const auto amount = state.elementAmountInPhase(ielement, iphase);
-//         const auto kgH2O = state.speciesAmount(iwater) * waterMolarMass;
-//         const auto mi = kgH2O ? amount/kgH2O : 0.0;
-//         return factor * mi;
-//     };
-//     return func;
-// }
-
-// auto elementMolarity(const ChemicalQuantity& quantity, std::string arguments) -> std::function<real()>
-// {
-//     const Args args(arguments);
-//     const ChemicalSystem& system = quantity.system();
-//     const std::string element = args.argument(0);
-//     const auto units = args.argument("units", "molar");
-//     const auto factor = units::convert(1.0, "molar", units);
-//     const Index ielement = detail::indexElementWithError(element, system, "elementMolarity");
-//     const Index iphase = system.indexPhaseWithError("Aqueous");
-//     auto func = [=]() -> real
-//     {
-//         const ChemicalProps& props = quantity.props();
-//         const ChemicalState& state = quantity.state();
-//         const auto amount = state.elementAmountInPhase(ielement, iphase);
-//         const auto volume = props.phaseProps(iphase).volume();
-//         const auto liter = convertCubicMeterToLiter(volume);
-//         const auto ci = liter ? amount/liter : 0.0;
-//         return factor * ci;
-//     };
-//     return func;
-// }
-
-// auto speciesAmount(const ChemicalQuantity& quantity, std::string arguments) -> std::function<real()>
-// {
-//     const Args args(arguments);
-//     const ChemicalSystem& system = quantity.system();
-//     const std::string species = args.argument(0);
-//     const Index ispecies = system.species().index(species);
-//     error(ispecies > system.species().size(), "Could not evaluate ChemicalQuantity::speciesAmount with inexistent species with name ", species, ".");
-//     const auto units = args.argument("units", "mol");
-//     const auto factor = units::convert(1.0, "mol", units);
-//     auto func = [=]() -> real
-//     {
-//         const ChemicalState& state = quantity.state();
-//         const auto val = state.speciesAmount(ispecies);
-//         return factor * val;
-//     };
-//     return func;
-// }
-
-// auto speciesMass(const ChemicalQuantity& quantity, std::string arguments) -> std::function<real()>
-// {
-//     const Args args(arguments);
-//     const ChemicalSystem& system = quantity.system();
-//     const std::string species = args.argument(0);
-//     const Index ispecies = system.species().index(species);
-//     error(ispecies > system.species().size(), "Could not evaluate ChemicalQuantity::speciesMass with inexistent species with name ", species, ".");
-//     const real molar_mass = system.species(ispecies).molarMass();
-//     const auto units = args.argument("units", "kg");
-//     const auto factor = units::convert(1.0, "kg", units);
-//     auto func = [=]() -> real
-//     {
-//         const ChemicalState& state = quantity.state();
-//         const auto val = state.speciesAmount(ispecies);
-//         return factor * molar_mass * val;
-//     };
-//     return func;
-// }
-
-// auto speciesMolality(const ChemicalQuantity& quantity, std::string arguments) -> std::function<real()>
-// {
-//     const Args args(arguments);
-//     const ChemicalSystem& system = quantity.system();
-//     const std::string species = args.argument(0);
-//     const auto units = args.argument("units", "molal");
-//     const auto factor = units::convert(1.0, "molal", units);
-//     const Index ispecies = system.species().index(species);
-//     error(ispecies > system.species().size(), "Could not evaluate ChemicalQuantity::speciesMolality with inexistent species with name ", species, ".");
-//     const Index iwater = system.indexSpeciesAny(alternativeWaterNames());
-//     auto func = [=]() -> real
-//     {
-//         const ChemicalState& state = quantity.state();
-//         const auto amount = state.speciesAmount(ispecies);
-//         const auto kgH2O = state.speciesAmount(iwater) * waterMolarMass;
-//         const auto mi = kgH2O ? amount/kgH2O : 0.0;
-//         return factor * mi;
-//     };
-//     return func;
-// }
-
-// auto speciesMolarity(const ChemicalQuantity& quantity, std::string arguments) -> std::function<real()>
-// {
-//     const Args args(arguments);
-//     const ChemicalSystem& system = quantity.system();
-//     const std::string species = args.argument(0);
-//     const auto units = args.argument("units", "molar");
-//     const auto factor = units::convert(1.0, "molar", units);
-//     const Index ispecies = system.species().index(species);
-//     error(ispecies > system.species().size(), "Could not evaluate ChemicalQuantity::speciesMolarity with inexistent species with name ", species, ".");
-//     const Index iphase = system.indexPhaseWithError("Aqueous");
-//     auto func = [=]() -> real
-//     {
-//         const ChemicalProps& props = quantity.props();
-//         const ChemicalState& state = quantity.state();
-//         const auto amount = state.speciesAmount(ispecies);
-//         const auto volume = props.phaseProps(iphase).volume();
-//         const auto liter = convertCubicMeterToLiter(volume);
-//         const auto ci = liter ? amount/liter : 0.0;
-//         return factor * ci;
-//     };
-//     return func;
-// }
-
-// auto phaseAmount(const ChemicalQuantity& quantity, std::string arguments) -> std::function<real()>
-// {
-//     const Args args(arguments);
-//     const ChemicalSystem& system = quantity.system();
-//     const std::string phase = args.argument(0);
-//     const Index iphase = detail::indexPhaseWithError(phase, system, "phaseAmount");
-//     const auto units = args.argument("units", "mol");
-//     const auto factor = units::convert(1.0, "mol", units);
-//     auto func = [=]() -> real
-//     {
-//         const ChemicalProps& props = quantity.props();
-//         const auto val = props.phaseProps(iphase).amount();
-//         return factor * val;
-//     };
-//     return func;
-// }
-
-// auto phaseMass(const ChemicalQuantity& quantity, std::string arguments) -> std::function<real()>
-// {
-//     const Args args(arguments);
-//     const ChemicalSystem& system = quantity.system();
-//     const std::string phase = args.argument(0);
-//     const Index iphase = detail::indexPhaseWithError(phase, system, "phaseMass");
-//     const auto units = args.argument("units", "kg");
-//     const auto factor = units::convert(1.0, "kg", units);
-//     auto func = [=]() -> real
-//     {
-//         const ChemicalProps& props = quantity.props();
-//         const auto val = props.phaseProps(iphase).mass();
-//         return factor * val;
-//     };
-//     return func;
-// }
-
-// auto phaseVolume(const ChemicalQuantity& quantity, std::string arguments) -> std::function<real()>
-// {
-//     const Args args(arguments);
-//     const ChemicalSystem& system = quantity.system();
-//     const std::string phase = args.argument(0);
-//     const Index iphase = detail::indexPhaseWithError(phase, system, "phaseVolume");
-//     const auto units = args.argument("units", "m3");
-//     const auto factor = units::convert(1.0, "m3", units);
-//     auto func = [=]() -> real
-//     {
-//         const ChemicalProps& props = quantity.props();
-//         const auto val = props.phaseProps(iphase).volume();
-//         return factor * val;
-//     };
-//     return func;
-// }
-
-// auto pH(const ChemicalQuantity& quantity, std::string arguments) -> std::function<real()>
-// {
-//     const Args args(arguments);
-//     auto pH = ChemicalProperty::pH(quantity.system());
-//     auto func = [=]() -> real
-//     {
-//         return pH(quantity.props());
-//     };
-//     return func;
-// }
-
-// auto pE(const ChemicalQuantity& quantity, std::string arguments) -> std::function<real()>
-// {
-//     const Args args(arguments);
-//     const auto pE = ChemicalProperty::pE(quantity.system());
-//     auto func = [=]() -> real
-//     {
-//         return pE(quantity.props());
-//     };
-//     return func;
-// }
-
-// auto Eh(const ChemicalQuantity& quantity, std::string arguments) -> std::function<real()>
-// {
-//     const Args args(arguments);
-//     const auto Eh = ChemicalProperty::Eh(quantity.system());
-//     const auto units = args.argument("units", "volt");
-//     const auto factor = units::convert(1.0, "volt", units);
-//     auto func = [=]() -> real
-//     {
-//         return factor * Eh(quantity.props());
-//     };
-//     return func;
-// }
-
-// auto ionicStrength(const ChemicalQuantity& quantity, std::string arguments) -> std::function<real()>
-// {
-//     const Args args(arguments);
-//     const auto I = ChemicalProperty::ionicStrength(quantity.system());
-//     const auto units = args.argument("units", "molal");
-//     const auto factor = units::convert(1.0, "molal", units);
-//     auto func = [=]() -> real
-//     {
-//         return factor * I(quantity.props());
-//     };
-//     return func;
-// }
-
-// auto fluidVolume(const ChemicalQuantity& quantity, std::string arguments) -> std::function<real()>
-// {
-//     const Args args(arguments);
-//     const auto units = args.argument("units", "m3");
-//     const auto factor = units::convert(1.0, "m3", units);
-//     auto func = [=]() -> real
-//     {
-//         const ChemicalProps& props = quantity.props();
-//         const auto val = props.fluidVolume();
-//         return factor * val;
-//     };
-//     return func;
-// }
-
-// auto fluidVolumeFraction(const ChemicalQuantity& quantity, std::string arguments) -> std::function<real()>
-// {
-//     const Args args(arguments);
-//     auto func = [=]() -> real
-//     {
-//         const ChemicalProps& props = quantity.props();
-//         const auto volume = props.volume();
-//         const auto fluid_volume = props.fluidVolume();
-//         return fluid_volume/volume;
-//     };
-//     return func;
-// }
-
-// auto solidVolume(const ChemicalQuantity& quantity, std::string arguments) -> std::function<real()>
-// {
-//     const Args args(arguments);
-//     const auto units = args.argument("units", "m3");
-//     const auto factor = units::convert(1.0, "m3", units);
-//     auto func = [=]() -> real
-//     {
-//         const ChemicalProps& props = quantity.props();
-//         const auto val = props.solidVolume();
-//         return factor * val;
-//     };
-//     return func;
-// }
-
-// auto solidVolumeFraction(const ChemicalQuantity& quantity, std::string arguments) -> std::function<real()>
-// {
-//     const Args args(arguments);
-//     auto func = [=]() -> real
-//     {
-//         const ChemicalProps& props = quantity.props();
-//         const auto volume = props.volume();
-//         const auto solid_volume = props.solidVolume();
-//         return solid_volume/volume;
-//     };
-//     return func;
-// }
-
-// auto reactionRate(const ChemicalQuantity& quantity, std::string arguments) -> std::function<real()>
-// {
-//     const Args args(arguments);
-//     const ReactionSystem& reactions = quantity.reactions();
-//     const std::string reaction = args.argument(0);
-//     const Index ireaction = reactions.indexReactionWithError(reaction);
-//     const auto units = args.argument("units", "mol/s");
-//     const auto factor = units::convert(1.0, "mol/s", units);
-//     auto func = [=]() -> real
-//     {
-//         const VectorXr& rates = quantity.rates();
-//         const auto val = rates[ireaction];
-//         return factor * val;
-//     };
-//     return func;
-// }
-
-// auto reactionEquilibriumIndex(const ChemicalQuantity& quantity, std::string arguments) -> std::function<real()>
-// {
-//     const Args args(arguments);
-//     const ReactionSystem& reactions = quantity.reactions();
-//     const std::string reaction = args.argument(0);
-//     const Index ireaction = reactions.indexReactionWithError(reaction);
-//     auto func = [=]() -> real
-//     {
-//         const ChemicalProps& props = quantity.props();
-//         const auto ln_omega = reactions.reaction(ireaction).lnEquilibriumIndex(props);
-//         return std::exp(ln_omega);
-//     };
-//     return func;
-// }
-
-// auto tag(const ChemicalQuantity& quantity, std::string arguments) -> std::function<real()>
-// {
-//     const Args args(arguments);
-//     const auto units = args.argument("units", "s");
-//     const auto factor = units::convert(1.0, "s", units);
-//     auto func = [=]() -> real
-//     {
-//         const auto val = quantity.tag();
-//         return factor * val;
-//     };
-//     return func;
-// }
-
-// auto function(std::string fname) -> Function
-// {
-//     bool isdelta = fname.substr(0, 5) == "delta";
-//     fname = isdelta ? fname.substr(5) : fname;
-//     auto iter = quantity::fndict.find(fname);
-//     Assert(iter != quantity::fndict.end(),
-//         "Could not create the quantity function with name `" + fname + "`.",
-//         "This function name has been misspelled or it is not supported.");
-//     Function func = iter->second;
-//     if(isdelta)
-//     {
-//         Function deltafunc = [=](const ChemicalQuantity& quantity, std::string arguments)
-//         {
-//             bool firstcall = true;
-//             real initialval = 0.0;
-//             std::function<real()> fn = func(quantity, arguments);
-//             std::function<real()> deltafn = [=]() mutable
-//             {
-//                 if(firstcall)
-//                 {
-//                     initialval = fn();
-//                     firstcall = false;
-//                     return 0.0;
-//                 }
-//                 else return fn() - initialval;
-//             };
-//             return deltafn;
-//         };
-//         return deltafunc;
-//     }
-//     return func;
-// }
-
-// } // namespace quantity
-// } // namespace Reaktoro
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "ChemicalQuantity.hpp"
+
+// C++ includes
+#include <cmath>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Algorithms.hpp>
+#include <Reaktoro/Common/Constants.hpp>
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/StringUtils.hpp>
+#include <Reaktoro/Common/Units.hpp>
+#include <Reaktoro/Core/ChemicalProps.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Core/Utils.hpp>
+#include <Reaktoro/Utils/AqueousProps.hpp>
+#include <Reaktoro/Water/WaterConstants.hpp>
+
+namespace Reaktoro {
+namespace {
+
+/// The codes of the operations into which chemical quantities are compiled.
+enum class OpCode
+{
+    Temperature,                // T
+    Pressure,                   // P
+    Volume,                     // V
+    Amount,                     // sum of all species amounts
+    Mass,                       // sum of all species masses
+    SpeciesAmount,              // n[i]
+    SpeciesMoleFraction,        // x[i]
+    SpeciesActivity,            // exp(ln_a[i])
+    SpeciesActivityLn,          // ln_a[i]
+    SpeciesActivityCoefficient, // exp(ln_g[i])
+    SpeciesChemicalPotential,   // u[i]
+    LinearAmounts,              // sum(c[k] * n[i[k]])
+    LinearMolalities,           // sum(c[k] * n[i[k]]) / kgH2O
+    PhaseVolume,                // volume of phase i
+    FluidVolume,                // sum of volumes of fluid phases
+    SolidVolume,                // sum of volumes of solid phases
+    FluidVolumeFraction,        // fluid volume / volume
+    SolidVolumeFraction,        // solid volume / volume
+    AqueousPE,                  // pE of the aqueous phase
+    AqueousEh,                  // Eh of the aqueous phase
+    SaturationIndex,            // saturation index of species i
+    ReactionRate,               // rate of reaction i
+    Tag,                        // t
+};
+
+/// An operation into which a chemical quantity is compiled.
+/// The value of the quantity is `factor * x + shift`, where `x` is the value
+/// computed according to the operation code, so that conversion of units and
+/// any constant scaling are applied together.
+struct Op
+{
+    /// The code of the operation.
+    OpCode code;
+
+    /// The index of the species, phase, or reaction in the operation (if any).
+    Index index = 0;
+
+    /// The index of the first term in the operation (for linear operations).
+    Index begin = 0;
+
+    /// The index past the last term in the operation (for linear operations).
+    Index end = 0;
+
+    /// The factor multiplying the value computed in the operation.
+    double factor = 1.0;
+
+    /// The term added to the value computed in the operation after multiplied by `factor`.
+    double shift = 0.0;
+};
+
+/// The arguments of a chemical quantity given as a formatted string.
+struct Args
+{
+    /// The name of the quantity in lowercase.
+    String name;
+
+    /// The non-keyword arguments.
+    Strings args;
+
+    /// The keyword arguments (e.g., `units=mol`).
+    Map<String, String> kwargs;
+};
+
+/// Return the name and arguments of a chemical quantity given as a formatted string.
+auto parseQuantity(String const& quantity) -> Args
+{
+    const auto str = trim(quantity);
+    const auto ibegin = str.find('(');
+    const auto iend = str.rfind(')');
+
+    errorif(str.empty(), "Expecting a non-empty chemical quantity.");
+    errorif(ibegin != String::npos && (iend == String::npos || iend < ibegin), "Missing closing parenthesis in chemical quantity `", quantity, "`.");
+
+    Args res;
+    res.name = lowercase(trim(str.substr(0, ibegin)));
+
+    if(ibegin == String::npos)
+        return res;
+
+    for(auto const& word : split(str.substr(ibegin + 1, iend - ibegin - 1), " "))
+    {
+        const auto pos = word.find('=');
+        if(pos == String::npos)
+            res.args.push_back(word);
+        else res.kwargs[word.substr(0, pos)] = word.substr(pos + 1);
+    }
+
+    return res;
+}
+
+} // namespace
+
+struct ChemicalQuantity::Impl
+{
+    /// The chemical system of the quantities.
+    ChemicalSystem system;
+
+    /// The formatted strings of the added quantities.
+    Strings quantities;
+
+    /// The compiled operations of the added quantities.
+    Vec<Op> ops;
+
+    /// The species (or phase) indices of the terms in the linear operations.
+    Indices tindices;
+
+    /// The coefficients of the terms in the linear operations.
+    Vec<double> tcoeffs;
+
+    /// The values of the quantities evaluated in the last update.
+    ArrayXd values;
+
+    /// The index of the first aqueous phase in the system (if needed by a quantity).
+    Index iaqueous = -1;
+
+    /// The index of the aqueous solvent species H2O in the system (if needed by a quantity).
+    Index iH2O = -1;
+
+    /// The index of the species H+ or H3O+ in the system (if needed by a quantity).
+    Index iH = -1;
+
+    /// The aqueous properties of the system (if needed by a quantity).
+    Optional<AqueousProps> aqprops;
+
+    /// Construct a ChemicalQuantity::Impl object.
+    Impl(ChemicalSystem const& system)
+    : system(system)
+    {}
+
+    /// Initialize the indices of the aqueous phase and its species H2O and H+ (or H3O+) if not yet initialized.
+    auto initAqueous(String const& quantity) -> void
+    {
+        if(iaqueous != Index(-1))
+            return;
+
+        const auto iphase = system.phases().findWithAggregateState(AggregateState::Aqueous);
+        errorif(iphase >= system.phases().size(), "Cannot evaluate chemical quantity `", quantity, "` because there is no aqueous phase in the chemical system.");
+
+        auto const& species = system.phase(iphase).species();
+        const auto offset = system.phases().numSpeciesUntilPhase(iphase);
+
+        const auto iwater = species.findWithFormula("H2O");
+        errorif(iwater >= species.size(), "Cannot evaluate chemical quantity `", quantity, "` because there is no species with formula H2O in the aqueous phase.");
+
+        auto ihydron = species.findWithFormula("H+");
+        if(ihydron >= species.size())
+            ihydron = species.findWithFormula("H3O+");
+
+        iaqueous = iphase;
+        iH2O = offset + iwater;
+        iH = ihydron < species.size() ? offset + ihydron : Index(-1);
+    }
+
+    /// Create the aqueous properties of the system if not yet created.
+    auto initAqueousProps(String const& quantity) -> void
+    {
+        initAqueous(quantity);
+        if(!aqprops)
+            aqprops.emplace(system);
+    }
+
+    /// Return the indices of the first species and past the last species of the aqueous phase in the system.
+    auto aqueousSpeciesRange() const -> Pair<Index, Index>
+    {
+        const auto begin = system.phases().numSpeciesUntilPhase(iaqueous);
+        return { begin, begin + system.phase(iaqueous).species().size() };
+    }
+
+    /// Add to a linear operation a term with given species (or phase) index and coefficient.
+    auto addTerm(Op& op, Index i, double coeff) -> void
+    {
+        if(coeff == 0.0)
+            return;
+        tindices.push_back(i);
+        tcoeffs.push_back(coeff);
+        op.end = tindices.size();
+    }
+
+    /// Compile a chemical quantity given as a formatted string into an operation.
+    auto compile(String const& quantity) -> Op
+    {
+        const auto args = parseQuantity(quantity);
+        auto const& name = args.name;
+
+        // Return the non-keyword argument with given index or raise an error if it does not exist
+        auto arg = [&](Index i) -> String const&
+        {
+            errorif(i >= args.args.size(), "Expecting at least ", i + 1, " argument(s) in chemical quantity `", quantity, "`.");
+            return args.args[i];
+        };
+
+        auto ispecies = [&](Index i) { return detail::resolveSpeciesIndexOrRaiseError(system, arg(i), "Cannot compile chemical quantity `" + quantity + "`."); };
+        auto ielement = [&](Index i) { return detail::resolveElementIndexOrRaiseError(system, arg(i), "Cannot compile chemical quantity `" + quantity + "`."); };
+        auto iphase   = [&](Index i) { return detail::resolvePhaseIndexOrRaiseError(system, arg(i), "Cannot compile chemical quantity `" + quantity + "`."); };
+
+        auto const& A = system.formulaMatrix();
+
+        // Return a linear operation over the species of a phase with coefficients given by a function of the species index
+        auto linearInPhase = [&](OpCode code, Index jphase, auto const& coeff)
+        {
+            Op op{code};
+            op.begin = op.end = tindices.size();
+            const auto begin = system.phases().numSpeciesUntilPhase(jphase);
+            const auto size = system.phase(jphase).species().size();
+            for(auto i = begin; i < begin + size; ++i)
+                addTerm(op, i, coeff(i));
+            return op;
+        };
+
+        // Return a linear operation over all species with coefficients given by a function of the species index
+        auto linearInSystem = [&](OpCode code, auto const& coeff)
+        {
+            Op op{code};
+            op.begin = op.end = tindices.size();
+            for(Index i = 0; i < system.species().size(); ++i)
+                addTerm(op, i, coeff(i));
+            return op;
+        };
+
+        // Return a linear operation over the aqueous species with coefficients given by a function of the species index
+        auto linearInAqueous = [&](auto const& coeff)
+        {
+            initAqueous(quantity);
+            return linearInPhase(OpCode::LinearMolalities, iaqueous, coeff);
+        };
+
+        Op op{OpCode::Tag};
+        String units; // the default units of the quantity (empty if dimensionless)
+
+        if(name == "temperature") { op = {OpCode::Temperature}; units = "K"; }
+        else if(name == "pressure") { op = {OpCode::Pressure}; units = "Pa"; }
+        else if(name == "volume") { op = {OpCode::Volume}; units = "m3"; }
+        else if(name == "amount") { op = {OpCode::Amount}; units = "mol"; }
+        else if(name == "mass") { op = {OpCode::Mass}; units = "kg"; }
+        else if(name == "speciesamount") { op = {OpCode::SpeciesAmount, ispecies(0)}; units = "mol"; }
+        else if(name == "speciesmass")
+        {
+            const auto i = ispecies(0);
+            op = {OpCode::SpeciesAmount, i};
+            op.factor = system.species(i).molarMass();
+            units = "kg";
+        }
+        else if(name == "speciesmolefraction" || name == "molefraction") { op = {OpCode::SpeciesMoleFraction, ispecies(0)}; }
+        else if(name == "speciesactivity" || name == "activity") { op = {OpCode::SpeciesActivity, ispecies(0)}; }
+        else if(name == "speciesactivitycoefficient" || name == "activitycoefficient") { op = {OpCode::SpeciesActivityCoefficient, ispecies(0)}; }
+        else if(name == "specieschemicalpotential" || name == "chemicalpotential") { op = {OpCode::SpeciesChemicalPotential, ispecies(0)}; units = "J/mol"; }
+        else if(name == "fugacity") { op = {OpCode::SpeciesActivity, ispecies(0)}; units = "bar"; }
+        else if(name == "speciesmolality")
+        {
+            const auto i = ispecies(0);
+            op = linearInAqueous([&](Index j) { return j == i ? 1.0 : 0.0; });
+            errorif(op.begin == op.end, "Cannot compile chemical quantity `", quantity, "` because species ", arg(0), " is not in the aqueous phase.");
+            units = "molal";
+        }
+        else if(name == "elementamount")
+        {
+            const auto ie = ielement(0);
+            op = linearInSystem(OpCode::LinearAmounts, [&](Index i) { return A(ie, i); });
+            units = "mol";
+        }
+        else if(name == "elementamountinphase")
+        {
+            const auto ie = ielement(0);
+            op = linearInPhase(OpCode::LinearAmounts, iphase(1), [&](Index i) { return A(ie, i); });
+            units = "mol";
+        }
+        else if(name == "elementmass")
+        {
+            const auto ie = ielement(0);
+            const auto molarmass = system.element(ie).molarMass();
+            op = linearInSystem(OpCode::LinearAmounts, [&](Index i) { return A(ie, i) * molarmass; });
+            units = "kg";
+        }
+        else if(name == "elementmassinphase")
+        {
+            const auto ie = ielement(0);
+            const auto molarmass = system.element(ie).molarMass();
+            op = linearInPhase(OpCode::LinearAmounts, iphase(1), [&](Index i) { return A(ie, i) * molarmass; });
+            units = "kg";
+        }
+        else if(name == "elementmolality")
+        {
+            const auto ie = ielement(0);
+            op = linearInAqueous([&](Index i) { return A(ie, i); });
+            units = "molal";
+        }
+        else if(name == "phaseamount")
+        {
+            op = linearInPhase(OpCode::LinearAmounts, iphase(0), [](Index) { return 1.0; });
+            units = "mol";
+        }
+        else if(name == "phasemass")
+        {
+            op = linearInPhase(OpCode::LinearAmounts, iphase(0), [&](Index i) { return system.species(i).molarMass(); });
+            units = "kg";
+        }
+        else if(name == "phasevolume") { op = {OpCode::PhaseVolume, iphase(0)}; units = "m3"; }
+        else if(name == "fluidvolume") { op = {OpCode::FluidVolume}; units = "m3"; }
+        else if(name == "solidvolume") { op = {OpCode::SolidVolume}; units = "m3"; }
+        else if(name == "fluidvolumefraction") { op = {OpCode::FluidVolumeFraction}; }
+        else if(name == "solidvolumefraction") { op = {OpCode::SolidVolumeFraction}; }
+        else if(name == "ph")
+        {
+            initAqueous(quantity);
+            errorif(iH == Index(-1), "Cannot compile chemical quantity `", quantity, "` because there is no species with formula H+ or H3O+ in the aqueous phase.");
+            op = {OpCode::SpeciesActivityLn, iH};
+            op.factor = -1.0/ln10;
+        }
+        else if(name == "pe") { initAqueousProps(quantity); op = {OpCode::AqueousPE}; }
+        else if(name == "eh") { initAqueousProps(quantity); op = {OpCode::AqueousEh}; units = "V"; }
+        else if(name == "ionicstrength")
+        {
+            op = linearInAqueous([&](Index i) { const auto z = system.species(i).charge(); return 0.5 * z * z; });
+            units = "molal";
+        }
+        else if(name == "saturationindex")
+        {
+            initAqueousProps(quantity);
+            const auto i = aqprops->saturationSpecies().find(arg(0));
+            errorif(i >= aqprops->saturationSpecies().size(), "Cannot compile chemical quantity `", quantity, "` because species ", arg(0), " is not a "
+                "non-aqueous species in the database composed of elements in the aqueous phase.");
+            op = {OpCode::SaturationIndex, i};
+        }
+        else if(name == "reactionrate")
+        {
+            op = {OpCode::ReactionRate, detail::resolveReactionIndexOrRaiseError(system, arg(0), "Cannot compile chemical quantity `" + quantity + "`.")};
+            units = "mol/s";
+        }
+        else if(name == "t" || name == "time") { op = {OpCode::Tag}; units = "s"; }
+        else if(name == "tag" || name == "progress") { op = {OpCode::Tag}; }
+        else errorif(true, "Cannot compile chemical quantity `", quantity, "` because `", name, "` is not a known quantity name (see the documentation of ChemicalQuantity for the supported ones).");
+
+        const auto iter = args.kwargs.find("units");
+        if(iter != args.kwargs.end())
+        {
+            errorif(units.empty(), "Cannot compile chemical quantity `", quantity, "` because it is dimensionless and does not accept units.");
+            errorif(!units::convertible(units, iter->second), "Cannot compile chemical quantity `", quantity, "` because units ", iter->second, " cannot be converted from ", units, ".");
+            const units::Converter converter(units, iter->second); // the conversion is computed once here and applied as a multiply-add in each evaluation
+            op.factor *= converter.slope();
+            op.shift = converter.intercept();
+        }
+
+        return op;
+    }
+
+    /// Compile and add a chemical quantity.
+    auto add(String const& quantity) -> Index
+    {
+        ops.push_back(compile(quantity));
+        quantities.push_back(quantity);
+        values.conservativeResize(ops.size());
+        values[ops.size() - 1] = 0.0;
+        return ops.size() - 1;
+    }
+
+    /// Return the sum of the volumes of the phases whose state of matter satisfies a given predicate.
+    template<typename Predicate>
+    static auto volumeOfPhases(ChemicalProps const& props, Predicate const& pred) -> double
+    {
+        double sum = 0.0;
+        const auto numphases = props.system().phases().size();
+        for(Index i = 0; i < numphases; ++i)
+        {
+            const auto phaseprops = props.phaseProps(i);
+            if(pred(phaseprops.stateOfMatter()))
+                sum += double(phaseprops.volume());
+        }
+        return sum;
+    }
+
+    /// Return the sum of the volumes of the fluid phases.
+    static auto fluidVolume(ChemicalProps const& props) -> double
+    {
+        return volumeOfPhases(props, [](StateOfMatter som) { return som == StateOfMatter::Liquid || som == StateOfMatter::Gas || som == StateOfMatter::Supercritical; });
+    }
+
+    /// Return the sum of the volumes of the solid phases.
+    static auto solidVolume(ChemicalProps const& props) -> double
+    {
+        return volumeOfPhases(props, [](StateOfMatter som) { return som == StateOfMatter::Solid; });
+    }
+
+    /// Evaluate the added quantities.
+    auto update(ChemicalProps const& props, double t) -> void
+    {
+        if(aqprops)
+            aqprops->update(props);
+
+        auto const& n = props.speciesAmounts();
+
+        // Return the sum of the terms of a linear operation
+        auto linear = [&](Op const& op)
+        {
+            double sum = 0.0;
+            for(auto k = op.begin; k < op.end; ++k)
+                sum += tcoeffs[k] * double(n[tindices[k]]);
+            return sum;
+        };
+
+        for(Index k = 0; k < ops.size(); ++k)
+        {
+            auto const& op = ops[k];
+            double x = 0.0;
+            switch(op.code)
+            {
+            case OpCode::Temperature: x = double(props.temperature()); break;
+            case OpCode::Pressure: x = double(props.pressure()); break;
+            case OpCode::Volume: x = double(props.volume()); break;
+            case OpCode::Amount: x = double(n.sum()); break;
+            case OpCode::Mass: x = double(props.mass()); break;
+            case OpCode::SpeciesAmount: x = double(n[op.index]); break;
+            case OpCode::SpeciesMoleFraction: x = double(props.speciesMoleFractions()[op.index]); break;
+            case OpCode::SpeciesActivity: x = std::exp(double(props.speciesActivitiesLn()[op.index])); break;
+            case OpCode::SpeciesActivityLn: x = double(props.speciesActivitiesLn()[op.index]); break;
+            case OpCode::SpeciesActivityCoefficient: x = std::exp(double(props.speciesActivityCoefficientsLn()[op.index])); break;
+            case OpCode::SpeciesChemicalPotential: x = double(props.speciesChemicalPotentials()[op.index]); break;
+            case OpCode::LinearAmounts: x = linear(op); break;
+            case OpCode::LinearMolalities: { const auto kgH2O = double(n[iH2O]) * waterMolarMass; x = kgH2O ? linear(op)/kgH2O : 0.0; break; }
+            case OpCode::PhaseVolume: x = double(props.phaseProps(op.index).volume()); break;
+            case OpCode::FluidVolume: x = fluidVolume(props); break;
+            case OpCode::SolidVolume: x = solidVolume(props); break;
+            case OpCode::FluidVolumeFraction: { const auto V = double(props.volume()); x = V ? fluidVolume(props)/V : 0.0; break; }
+            case OpCode::SolidVolumeFraction: { const auto V = double(props.volume()); x = V ? solidVolume(props)/V : 0.0; break; }
+            case OpCode::AqueousPE: x = double(aqprops->pE()); break;
+            case OpCode::AqueousEh: x = double(aqprops->Eh()); break;
+            case OpCode::SaturationIndex: x = double(aqprops->saturationIndex(op.index)); break;
+            case OpCode::ReactionRate: x = double(props.reactionRate(op.index)); break;
+            case OpCode::Tag: x = t; break;
+            }
+            values[k] = op.factor * x + op.shift;
+        }
+    }
+};
+
+ChemicalQuantity::ChemicalQuantity(ChemicalSystem const& system)
+: pimpl(new Impl(system))
+{}
+
+ChemicalQuantity::ChemicalQuantity(ChemicalSystem const& system, Strings const& quantities)
+: ChemicalQuantity(system)
+{
+    for(auto const& quantity : quantities)
+        add(quantity);
+}
+
+ChemicalQuantity::ChemicalQuantity(ChemicalQuantity const& other)
+: pimpl(new Impl(*other.pimpl))
+{}
+
+ChemicalQuantity::~ChemicalQuantity()
+{}
+
+auto ChemicalQuantity::operator=(ChemicalQuantity other) -> ChemicalQuantity&
+{
+    pimpl = std::move(other.pimpl);
+    return *this;
+}
+
+auto ChemicalQuantity::system() const -> ChemicalSystem const&
+{
+    return pimpl->system;
+}
+
+auto ChemicalQuantity::add(String const& quantity) -> Index
+{
+    return pimpl->add(quantity);
+}
+
+auto ChemicalQuantity::quantities() const -> Strings const&
+{
+    return pimpl->quantities;
+}
+
+auto ChemicalQuantity::update(ChemicalProps const& props, double t) -> void
+{
+    pimpl->update(props, t);
+}
+
+auto ChemicalQuantity::update(ChemicalState const& state, double t) -> void
+{
+    pimpl->update(state.props(), t);
+}
+
+auto ChemicalQuantity::values() const -> ArrayXdConstRef
+{
+    return pimpl->values;
+}
+
+auto ChemicalQuantity::value(Index iquantity) const -> double
+{
+    errorif(iquantity >= pimpl->values.size(), "Cannot return the value of the chemical quantity with index ", iquantity, " since only ", pimpl->values.size(), " quantities have been added.");
+    return pimpl->values[iquantity];
+}
+
+auto ChemicalQuantity::value(String const& quantity) const -> double
+{
+    const auto iquantity = index(pimpl->quantities, quantity);
+    errorif(iquantity >= pimpl->quantities.size(), "Cannot return the value of chemical quantity `", quantity, "` since it has not been added.");
+    return pimpl->values[iquantity];
+}
+
+} // namespace Reaktoro
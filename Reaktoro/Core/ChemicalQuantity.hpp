@@ -1,160 +1,166 @@
-// // Reaktoro is a unified framework for modeling chemically reactive systems.
-// //
-// // Copyright © 2014-2022 Allan Leal
-// //
-// // This library is free software; you can redistribute it and/or
-// // modify it under the terms of the GNU Lesser General Public
-// // License as published by the Free Software Foundation; either
-// // version 2.1 of the License, or (at your option) any later version.
-// //
-// // This library is distributed in the hope that it will be useful,
-// // but WITHOUT ANY WARRANTY; without even the implied warranty of
-// // MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
-// // Lesser General Public License for more details.
-// //
-// // You should have received a copy of the GNU Lesser General Public License
-// // along with this library. If not, see <http://www.gnu.org/licenses/>.
-
-// #pragma once
-
-// // C++ includes
-// #include <memory>
-// #include <string>
-
-// // Reaktoro includes
-// #include <Reaktoro/Common/Index.hpp>
-// #include <Reaktoro/Common/Matrix.hpp>
-// #include <Reaktoro/Common/Real.hpp>
-
-// namespace Reaktoro {
-
-// // Forward declarations
-// class ChemicalProps;
-// class ChemicalState;
-// class ChemicalSystem;
-// class ReactionSystem;
-
-// /// A class that provides a convenient way to retrieve chemical quantities.
-// /// Here the term chemical quantity is used in a broad sense. It means any
-// /// quantity for an element, species, or phase in a chemical system that
-// /// can be calculated at a chemical state whose temperature, pressure, and
-// /// mole amounts of all species are known.
-// ///
-// /// In the example below, the volume of a phase named Gaseous and the pH
-// /// of the aqueous phase (assuming both phases were defined in the chemical
-// /// system) are retrieved:
-// ///
-// /// ~~~
-// /// ChemicalQuantity q(state);
-// ///
-// /// const double vol = q["phaseVolume(Gaseous)"];
-// /// const double pH = q["pH"];
-// /// ~~~
-// ///
-// /// The table below shows all possible quantities that can be retrieved from
-// /// a ChemicalQuantity instance. The first column, **Quantity**, lists the
-// /// names of the quantities; the second column, **Units**, lists the default
-// /// units of the quantity; and the third column, **Example**, lists the
-// /// formatted strings needed to retrieve a quantity.
-// ///
-// /// | Quantity                 | Units  | Example                                    |
-// /// | --------                 | -----  | -------                                    |
-// /// | temperature              | kelvin | `"temperature(units=celsius)"`             |
-// /// | pressure                 | pascal | `"pressure(units=bar)"`                    |
-// /// | volume                   | m3     | `"volume(units=cm3)"`                      |
-// /// | activity                 | ---    | `"activity(CO2(aq))"`                      |
-// /// | activityCoefficient      | ---    | `"activityCoefficient(Na+)"`               |
-// /// | fugacity                 | bar    | `"fugacity(CO2(g))"`                       |
-// /// | chemicalPotential        | J/mol  | `"chemicalPotential(Cl-)"`                 |
-// /// | elementAmount            | mol    | `"elementAmount(Ca)"`                      |
-// /// | elementAmountInPhase     | mol    | `"elementAmountInPhase(Mg Aqueous)"`       |
-// /// | elementMass              | kg     | `"elementMass(Fe units=g)"`                |
-// /// | elementMassInPhase       | kg     | `"elementMassInPhase(C Gaseous)"`          |
-// /// | elementMolality          | molal  | `"elementMolality(Cl units=mmolal)"`       |
-// /// | elementMolarity          | molar  | `"elementMolarity(K units=mmolar)"`        |
-// /// | speciesAmount            | mol    | `"speciesAmount(H2O(l))"`                  |
-// /// | speciesMass              | kg     | `"speciesMass(Calcite units=g)"`           |
-// /// | speciesMoleFraction      | ---    | `"speciesMoleFraction(HCO3-)"`             |
-// /// | speciesMolality          | molal  | `"speciesMolality(Ca++)"`                  |
-// /// | speciesMolarity          | molar  | `"speciesMolarity(Mg++)"`                  |
-// /// | phaseAmount              | mol    | `"phaseAmount(Aqueous)"`                   |
-// /// | phaseMass                | kg     | `"phaseMass(Dolomite)"`                    |
-// /// | phaseVolume              | m3     | `"phaseVolume(Gaseous)"`                   |
-// /// | pH                       | ---    | `"pH"`                                     |
-// /// | pE                       | ---    | `"pE"`                                     |
-// /// | Eh                       | volt   | `"Eh"`                                     |
-// /// | ionicStrength            | molal  | `"ionicStrength"`                          |
-// /// | fluidVolume              | m3     | `"fluidVolume(units=liter)"`               |
-// /// | fluidVolumeFraction      | ---    | `"fluidVolumeFraction"`                    |
-// /// | solidVolume              | m3     | `"solidVolume(units=mm3)"`                 |
-// /// | solidVolumeFraction      | ---    | `"solidVolumeFraction"`                    |
-// /// | reactionRate             | mol/s  | `"reactionRate(Dolomite units=mmol/hour)"` |
-// /// | reactionEquilibriumIndex | ---    | `"reactionEquilibriumIndex(Quartz)"`       |
-// /// | tag                      | ---    | `"tag"`                                    |
-// /// | t                        | s      | `"t(units=minute)"`                        |
-// /// | time                     | s      | `"time(units=year)"`                       |
-// /// | progress                 | ---    | `"progress"`                               |
-// ///
-// class ChemicalQuantity
-// {
-// public:
-//     /// A type to describe a chemical quantity function.
-//     using Function = std::function<double()>;
-
-//     /// Disable the default ChemicalQuantity constructor.
-//     /// This is to enforce the initialization of ChemicalQuantity
-//     /// instance with a ChemicalSystem instance.
-//     ChemicalQuantity() = delete;
-
-//     /// Construct a ChemicalQuantity instance from a ChemicalSystem object.
-//     explicit ChemicalQuantity(const ChemicalSystem& system);
-
-//     /// Construct a ChemicalQuantity instance from a ReactionSystem object.
-//     explicit ChemicalQuantity(const ReactionSystem& reactions);
-
-//     /// Construct a ChemicalQuantity instance from a ChemicalState object.
-//     explicit ChemicalQuantity(const ChemicalState& state);
-
-//     /// Destroy this ChemicalQuantity instance.
-//     virtual ~ChemicalQuantity() = default;
-
-//     /// Return the chemical system of the ChemicalQuantity instance.
-//     auto system() const -> const ChemicalSystem&;
-
-//     /// Return the chemical reactions of the ChemicalQuantity instance.
-//     auto reactions() const -> const ReactionSystem&;
-
-//     /// Return the chemical state of the ChemicalQuantity instance.
-//     auto state() const -> const ChemicalState&;
-
-//     /// Return the chemical properties of the ChemicalQuantity instance.
-//     auto props() const -> const ChemicalProps&;
-
-//     /// Return the reaction rates of the ChemicalQuantity instance.
-//     auto rates() const -> const VectorXr&;
-
-//     /// Return the tag variable of the ChemicalQuantity instance.
-//     auto tag() const -> double;
-
-//     /// Update the state of this ChemicalQuantity instance.
-//     auto update(const ChemicalState& state) -> ChemicalQuantity&;
-
-//     /// Update the state of this ChemicalQuantity instance.
-//     auto update(const ChemicalState& state, double t) -> ChemicalQuantity&;
-
-//     /// Return the value of the quantity given as a formatted string.
-//     auto value(std::string str) const -> double;
-
-//     /// Return a created function that calculates the chemical quantity from a formatted string.
-//     auto function(std::string str) const -> Function;
-
-//     /// Return the value of the quantity given as a formatted string.
-//     auto operator()(std::string str) const -> double;
-
-// private:
-//     struct Impl;
-
-//     std::shared_ptr<Impl> pimpl;
-// };
-
-// } // namespace Reaktoro
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Matrix.hpp>
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+// Forward declarations
+class ChemicalProps;
+class ChemicalState;
+class ChemicalSystem;
+
+/// Used to evaluate chemical quantities given as formatted strings.
+/// Here the term chemical quantity is used in a broad sense. It means any
+/// quantity for an element, species, or phase in a chemical system that
+/// can be calculated at a chemical state whose temperature, pressure, and
+/// mole amounts of all species are known.
+///
+/// Each quantity is compiled only once, when it is added with @ref add, into
+/// an operation in which the indices of the elements, species, phases and
+/// reactions involved and the factors for unit conversion are resolved. The
+/// evaluation of all added quantities with @ref update is then a simple loop
+/// over these operations, without any string parsing or lookup.
+///
+/// In the example below, the volume of a phase named Gaseous and the pH
+/// of the aqueous phase (assuming both phases were defined in the chemical
+/// system) are evaluated:
+///
+/// ~~~
+/// ChemicalQuantity quantity(system);
+/// const auto ivol = quantity.add("phaseVolume(Gaseous units=cm3)");
+/// const auto ipH = quantity.add("pH");
+///
+/// quantity.update(state);
+///
+/// const double vol = quantity.value(ivol);
+/// const double pH = quantity.value(ipH);
+/// ~~~
+///
+/// The table below shows all possible quantities that can be evaluated with a
+/// ChemicalQuantity object. The first column, **Quantity**, lists the names of
+/// the quantities (case insensitive); the second column, **Units**, lists the
+/// default units of the quantity, which can be changed with the argument
+/// `units`; and the third column, **Example**, lists the formatted strings
+/// needed to evaluate a quantity.
+///
+/// | Quantity                   | Units  | Example                                    |
+/// | --------                   | -----  | -------                                    |
+/// | temperature                | K      | `"temperature(units=celsius)"`             |
+/// | pressure                   | Pa     | `"pressure(units=bar)"`                    |
+/// | volume                     | m3     | `"volume(units=cm3)"`                      |
+/// | amount                     | mol    | `"amount"`                                 |
+/// | mass                       | kg     | `"mass(units=g)"`                          |
+/// | speciesAmount              | mol    | `"speciesAmount(H2O(aq))"`                 |
+/// | speciesMass                | kg     | `"speciesMass(Calcite units=g)"`           |
+/// | speciesMoleFraction        | ---    | `"speciesMoleFraction(HCO3-)"`             |
+/// | speciesActivity            | ---    | `"speciesActivity(CO2(aq))"`               |
+/// | speciesActivityCoefficient | ---    | `"speciesActivityCoefficient(Na+)"`        |
+/// | speciesChemicalPotential   | J/mol  | `"speciesChemicalPotential(Cl-)"`          |
+/// | speciesMolality            | molal  | `"speciesMolality(Ca+2 units=mmolal)"`     |
+/// | fugacity                   | bar    | `"fugacity(CO2(g))"`                       |
+/// | elementAmount              | mol    | `"elementAmount(Ca)"`                      |
+/// | elementAmountInPhase       | mol    | `"elementAmountInPhase(Mg AqueousPhase)"`  |
+/// | elementMass                | kg     | `"elementMass(Fe units=g)"`                |
+/// | elementMassInPhase         | kg     | `"elementMassInPhase(C GaseousPhase)"`     |
+/// | elementMolality            | molal  | `"elementMolality(Cl units=mmolal)"`       |
+/// | phaseAmount                | mol    | `"phaseAmount(AqueousPhase)"`              |
+/// | phaseMass                  | kg     | `"phaseMass(Dolomite)"`                    |
+/// | phaseVolume                | m3     | `"phaseVolume(GaseousPhase)"`              |
+/// | fluidVolume                | m3     | `"fluidVolume(units=liter)"`               |
+/// | fluidVolumeFraction        | ---    | `"fluidVolumeFraction"`                    |
+/// | solidVolume                | m3     | `"solidVolume(units=mm3)"`                 |
+/// | solidVolumeFraction        | ---    | `"solidVolumeFraction"`                    |
+/// | pH                         | ---    | `"pH"`                                     |
+/// | pE                         | ---    | `"pE"`                                     |
+/// | Eh                         | V      | `"Eh(units=mV)"`                           |
+/// | ionicStrength              | molal  | `"ionicStrength"`                          |
+/// | saturationIndex            | ---    | `"saturationIndex(Calcite)"`               |
+/// | reactionRate               | mol/s  | `"reactionRate(Dolomite units=mmol/hour)"` |
+/// | t                          | s      | `"t(units=minute)"`                        |
+/// | time                       | s      | `"time(units=year)"`                       |
+/// | tag                        | ---    | `"tag"`                                    |
+/// | progress                   | ---    | `"progress"`                               |
+///
+/// The names `activity`, `activityCoefficient`, `chemicalPotential` and
+/// `moleFraction` are also accepted for the corresponding species quantities.
+/// The quantities `t`, `time`, `tag` and `progress` are the value of the tag
+/// variable given to @ref update. The aqueous quantities (e.g., `pH`,
+/// `speciesMolality`, `saturationIndex`) correspond to the first aqueous phase
+/// in the chemical system.
+class ChemicalQuantity
+{
+public:
+    /// Construct a ChemicalQuantity object.
+    explicit ChemicalQuantity(ChemicalSystem const& system);
+
+    /// Construct a ChemicalQuantity object with given quantities.
+    ChemicalQuantity(ChemicalSystem const& system, Strings const& quantities);
+
+    /// Construct a copy of a ChemicalQuantity object.
+    ChemicalQuantity(ChemicalQuantity const& other);
+
+    /// Destroy this ChemicalQuantity object.
+    ~ChemicalQuantity();
+
+    /// Assign a copy of a ChemicalQuantity object to this.
+    auto operator=(ChemicalQuantity other) -> ChemicalQuantity&;
+
+    /// Return the chemical system of the ChemicalQuantity object.
+    auto system() const -> ChemicalSystem const&;
+
+    /// Compile and add a quantity given as a formatted string to the list of quantities to be evaluated.
+    /// @param quantity The formatted string of the quantity (e.g., `"speciesAmount(Calcite units=mmol)"`)
+    /// @return The index of the quantity in the list of quantities
+    auto add(String const& quantity) -> Index;
+
+    /// Return the formatted strings of the added quantities.
+    auto quantities() const -> Strings const&;
+
+    /// Evaluate the added quantities using the chemical properties of the system.
+    /// @param props The chemical properties of the system
+    /// @param t The value of the tag variable (e.g., time or iteration number)
+    auto update(ChemicalProps const& props, double t = 0.0) -> void;
+
+    /// Evaluate the added quantities using the chemical properties of a chemical state.
+    /// Note that the chemical properties in the chemical state are used as
+    /// they are, which are up to date after a chemical equilibrium or kinetics
+    /// calculation. Otherwise, use `state.props().update(state)` beforehand.
+    /// @param state The chemical state
+    /// @param t The value of the tag variable (e.g., time or iteration number)
+    auto update(ChemicalState const& state, double t = 0.0) -> void;
+
+    /// Return the values of the added quantities evaluated in the last call to @ref update.
+    auto values() const -> ArrayXdConstRef;
+
+    /// Return the value of the quantity with given index evaluated in the last call to @ref update.
+    auto value(Index iquantity) const -> double;
+
+    /// Return the value of an added quantity evaluated in the last call to @ref update.
+    auto value(String const& quantity) const -> double;
+
+private:
+    struct Impl;
+
+    Ptr<Impl> pimpl;
+};
+
+} // namespace Reaktoro
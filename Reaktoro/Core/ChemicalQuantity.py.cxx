@@ -0,0 +1,44 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// pybind11 includes
+#include <Reaktoro/pybind11.hxx>
+
+// Reaktoro includes
+#include <Reaktoro/Core/ChemicalProps.hpp>
+#include <Reaktoro/Core/ChemicalQuantity.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+using namespace Reaktoro;
+
+void exportChemicalQuantity(py::module& m)
+{
+    py::class_<ChemicalQuantity>(m, "ChemicalQuantity")
+        .def(py::init<ChemicalSystem const&>())
+        .def(py::init<ChemicalSystem const&, Strings const&>())
+        .def(py::init<ChemicalQuantity const&>())
+        .def("clone", [](ChemicalQuantity const& self) { return ChemicalQuantity(self); })
+        .def("system", &ChemicalQuantity::system, return_internal_ref, "Return the chemical system of the ChemicalQuantity object.")
+        .def("add", &ChemicalQuantity::add, "Compile and add a quantity given as a formatted string to the list of quantities to be evaluated.")
+        .def("quantities", &ChemicalQuantity::quantities, return_internal_ref, "Return the formatted strings of the added quantities.")
+        .def("update", py::overload_cast<ChemicalProps const&, double>(&ChemicalQuantity::update), py::arg("props"), py::arg("t") = 0.0, "Evaluate the added quantities using the chemical properties of the system.")
+        .def("update", py::overload_cast<ChemicalState const&, double>(&ChemicalQuantity::update), py::arg("state"), py::arg("t") = 0.0, "Evaluate the added quantities using the chemical properties of a chemical state.")
+        .def("values", &ChemicalQuantity::values, return_internal_ref, "Return the values of the added quantities evaluated in the last call to method update.")
+        .def("value", py::overload_cast<Index>(&ChemicalQuantity::value, py::const_), "Return the value of the quantity with given index evaluated in the last call to method update.")
+        .def("value", py::overload_cast<String const&>(&ChemicalQuantity::value, py::const_), "Return the value of an added quantity evaluated in the last call to method update.")
+        ;
+}
@@ -0,0 +1,151 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Core/ChemicalProps.hpp>
+#include <Reaktoro/Core/ChemicalQuantity.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Utils/AqueousProps.hpp>
+using namespace Reaktoro;
+
+namespace test { extern auto createChemicalSystem() -> ChemicalSystem; }
+
+TEST_CASE("Testing ChemicalQuantity class", "[ChemicalQuantity]")
+{
+    ChemicalSystem system = test::createChemicalSystem();
+
+    ChemicalState state(system);
+    state.setTemperature(60.0, "celsius");
+    state.setPressure(10.0, "bar");
+    state.setSpeciesAmounts(ArrayXd::LinSpaced(system.species().size(), 1.0, 2.0));
+    state.props().update(state);
+
+    ChemicalProps const& props = state.props();
+
+    AqueousProps aqprops(props);
+
+    ChemicalQuantity quantity(system);
+
+    SECTION("Testing quantities of the system")
+    {
+        CHECK( quantity.add("temperature") == 0 );
+        CHECK( quantity.add("temperature(units=celsius)") == 1 );
+        CHECK( quantity.add("pressure(units=bar)") == 2 );
+        CHECK( quantity.add("volume(units=cm3)") == 3 );
+        CHECK( quantity.add("amount") == 4 );
+        CHECK( quantity.add("mass(units=g)") == 5 );
+        CHECK( quantity.add("t(units=minute)") == 6 );
+        CHECK( quantity.add("progress") == 7 );
+
+        quantity.update(state, 120.0);
+
+        CHECK( quantity.values().size() == 8 );
+        CHECK( quantity.value(0) == Approx(333.15) );
+        CHECK( quantity.value(1) == Approx(60.0) );
+        CHECK( quantity.value(2) == Approx(10.0) );
+        CHECK( quantity.value(3) == Approx(props.volume() * 1e6) );
+        CHECK( quantity.value(4) == Approx(props.amount()) );
+        CHECK( quantity.value(5) == Approx(props.mass() * 1e3) );
+        CHECK( quantity.value(6) == Approx(2.0) );
+        CHECK( quantity.value(7) == Approx(120.0) );
+        CHECK( quantity.value("pressure(units=bar)") == Approx(10.0) );
+    }
+
+    SECTION("Testing quantities of species, elements and phases")
+    {
+        quantity = ChemicalQuantity(system, {
+            "speciesAmount(CO2(g) units=mmol)",
+            "speciesMass(CaCO3(s))",
+            "speciesMoleFraction(Na+(aq))",
+            "activity(Ca++(aq))",
+            "speciesActivityCoefficient(Cl-(aq))",
+            "chemicalPotential(H2O(aq) units=kJ/mol)",
+            "elementAmount(C)",
+            "elementAmountInPhase(C GaseousPhase)",
+            "elementMass(Ca units=g)",
+            "elementMassInPhase(Na AqueousPhase)",
+            "phaseAmount(AqueousPhase)",
+            "phaseMass(GaseousPhase)",
+            "phaseVolume(Calcite units=cm3)",
+            "fluidVolume",
+            "solidVolumeFraction",
+        });
+
+        quantity.update(props);
+
+        CHECK( quantity.value(0) == Approx(props.speciesAmount("CO2(g)") * 1e3) );
+        CHECK( quantity.value(1) == Approx(props.speciesMass("CaCO3(s)")) );
+        CHECK( quantity.value(2) == Approx(props.speciesMoleFraction("Na+(aq)")) );
+        CHECK( quantity.value(3) == Approx(props.speciesActivity("Ca++(aq)")) );
+        CHECK( quantity.value(4) == Approx(props.speciesActivityCoefficient("Cl-(aq)")) );
+        CHECK( quantity.value(5) == Approx(props.speciesChemicalPotential("H2O(aq)") * 1e-3) );
+        CHECK( quantity.value(6) == Approx(props.elementAmount("C")) );
+        CHECK( quantity.value(7) == Approx(props.elementAmountInPhase("C", "GaseousPhase")) );
+        CHECK( quantity.value(8) == Approx(props.elementMass("Ca") * 1e3) );
+        CHECK( quantity.value(9) == Approx(props.elementMassInPhase("Na", "AqueousPhase")) );
+        CHECK( quantity.value(10) == Approx(props.phaseProps("AqueousPhase").amount()) );
+        CHECK( quantity.value(11) == Approx(props.phaseProps("GaseousPhase").mass()) );
+        CHECK( quantity.value(12) == Approx(props.phaseProps("Calcite").volume() * 1e6) );
+        CHECK( quantity.value(13) > 0.0 );
+        CHECK( quantity.value(14) > 0.0 );
+        CHECK( quantity.value(14) < 1.0 );
+    }
+
+    SECTION("Testing quantities of the aqueous phase")
+    {
+        quantity = ChemicalQuantity(system, {
+            "pH",
+            "pE",
+            "Eh(units=mV)",
+            "ionicStrength",
+            "speciesMolality(Ca++(aq) units=mmolal)",
+            "elementMolality(Cl)",
+            "saturationIndex(CaCO3(s))",
+        });
+
+        quantity.update(props);
+
+        CHECK( quantity.value(0) == Approx(aqprops.pH()) );
+        CHECK( quantity.value(1) == Approx(aqprops.pE()) );
+        CHECK( quantity.value(2) == Approx(aqprops.Eh() * 1e3) );
+        CHECK( quantity.value(3) == Approx(aqprops.ionicStrength()) );
+        CHECK( quantity.value(4) == Approx(aqprops.speciesMolality("Ca++(aq)") * 1e3) );
+        CHECK( quantity.value(5) == Approx(aqprops.elementMolality("Cl")) );
+        CHECK( quantity.value(6) == Approx(aqprops.saturationIndex("CaCO3(s)")) );
+    }
+
+    SECTION("Testing errors in the compilation of quantities")
+    {
+        CHECK_THROWS( quantity.add("") );
+        CHECK_THROWS( quantity.add("foo") );
+        CHECK_THROWS( quantity.add("speciesAmount") );
+        CHECK_THROWS( quantity.add("speciesAmount(Foo)") );
+        CHECK_THROWS( quantity.add("speciesAmount(H2O(aq) units=K)") );
+        CHECK_THROWS( quantity.add("speciesMolality(CO2(g))") );
+        CHECK_THROWS( quantity.add("elementAmount(Xy)") );
+        CHECK_THROWS( quantity.add("phaseVolume(Foo)") );
+        CHECK_THROWS( quantity.add("pH(units=mol)") );
+        CHECK_THROWS( quantity.add("saturationIndex(Foo)") );
+        CHECK( quantity.quantities().empty() );
+        CHECK_THROWS( quantity.value("pH") );
+        CHECK_THROWS( quantity.value(0) );
+    }
+}
@@ -101,7 +101,7 @@ struct ChemicalSystem::Impl
     Impl(Database const& database0, PhaseList const& phases0, ReactionList const& reactions0, SurfaceList const& surfaces0)
     : database(database0), phases(phases0), reactions(reactions0), surfaces(surfaces0)
     {
-        errorif(database.species().empty(), "Expecting at least one species in the Database object provided when creating a ChemicalSystem object.");
+        errorif(database.speciesRecords().empty(), "Expecting at least one species in the Database object provided when creating a ChemicalSystem object.");
         errorif(phases.empty(), "Expecting at least one phase when creating a ChemicalSystem object, but none was provided.");
 
         species = phases.species();
@@ -18,6 +18,7 @@
 #include "Data.hpp"
 
 // C++ includes
+#include <cstring>
 #include <fstream>
 
 // Third-party includes
@@ -28,6 +29,7 @@ using json = nlohmann::json;
 
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
+#include <Reaktoro/Common/BinaryStream.hpp>
 #include <Reaktoro/Common/Exception.hpp>
 
 namespace Reaktoro {
@@ -247,6 +249,139 @@ auto convertDataToJson(Data const& data) -> json
     return convertDataTo<json>(data);
 }
 
+// ==========================================================================================
+// METHODS TO CONVERT DATA TO AND FROM A BINARY FORMAT
+// ==========================================================================================
+
+// The layout of a binary Data file is a header followed by the tree of Data
+// nodes in depth-first order. Each node starts with a one-byte tag followed
+// by its value: nothing for null, one byte for booleans, a 32-bit integer,
+// a double, a string as written by BinaryWriter::writeString, a Param (value,
+// lower and upper bounds as doubles, a one-byte const flag and its id string),
+// or for dictionaries and lists a 64-bit count followed by the entries (each
+// preceded by its key string in case of dictionaries).
+//
+// Header:
+//     char[8]  magic     ("RKTDATA" plus a null character)
+//     uint32   version
+//     uint32   byteorder (0x01020304 in the byte order of the writer)
+
+/// The characters identifying a binary Data file.
+const char DataBinaryMagic[8] = { 'R', 'K', 'T', 'D', 'A', 'T', 'A', '\0' };
+
+/// The current version of the binary Data format.
+const std::uint32_t DataBinaryVersion = 1;
+
+/// The marker used to detect binary Data files written in a different byte order.
+const std::uint32_t DataBinaryByteOrder = 0x01020304;
+
+/// The tags identifying the type of each Data node in a binary Data file.
+enum : std::uint8_t { TagNull = 0, TagBoolean, TagString, TagInteger, TagFloat, TagParam, TagDict, TagList };
+
+auto writeDataBinary(BinaryWriter& writer, Data const& data) -> void
+{
+    if(data.isNull())
+    {
+        writer.write<std::uint8_t>(TagNull);
+    }
+    else if(data.isBoolean())
+    {
+        writer.write<std::uint8_t>(TagBoolean);
+        writer.write<std::uint8_t>(data.asBoolean());
+    }
+    else if(data.isString())
+    {
+        writer.write<std::uint8_t>(TagString);
+        writer.writeString(data.asString());
+    }
+    else if(data.isInteger())
+    {
+        writer.write<std::uint8_t>(TagInteger);
+        writer.write<std::int32_t>(data.asInteger());
+    }
+    else if(data.isFloat())
+    {
+        writer.write<std::uint8_t>(TagFloat);
+        writer.write<double>(data.asFloat());
+    }
+    else if(data.isParam())
+    {
+        auto const& param = data.asParam();
+        writer.write<std::uint8_t>(TagParam);
+        writer.write<double>(param.value().val());
+        writer.write<double>(param.lowerbound());
+        writer.write<double>(param.upperbound());
+        writer.write<std::uint8_t>(param.isconst());
+        writer.writeString(param.id());
+    }
+    else if(data.isDict())
+    {
+        auto const& dict = data.asDict();
+        writer.write<std::uint8_t>(TagDict);
+        writer.write<std::uint64_t>(dict.size());
+        for(auto const& [key, value] : dict)
+        {
+            writer.writeString(key);
+            writeDataBinary(writer, value);
+        }
+    }
+    else if(data.isList())
+    {
+        auto const& list = data.asList();
+        writer.write<std::uint8_t>(TagList);
+        writer.write<std::uint64_t>(list.size());
+        for(auto const& value : list)
+            writeDataBinary(writer, value);
+    }
+    else errorif(true, "Could not convert this Data object to binary format as the Data object is not in a valid state.");
+}
+
+auto readDataBinary(BinaryReader& reader) -> Data
+{
+    const auto tag = reader.read<std::uint8_t>();
+    switch(tag)
+    {
+        case TagNull: return {};
+        case TagBoolean: return reader.read<std::uint8_t>() != 0;
+        case TagString: return reader.readString();
+        case TagInteger: return static_cast<int>(reader.read<std::int32_t>());
+        case TagFloat: return reader.read<double>();
+        case TagParam:
+        {
+            Param param(reader.read<double>());
+            param.lowerbound(reader.read<double>());
+            param.upperbound(reader.read<double>());
+            param.isconst(reader.read<std::uint8_t>() != 0);
+            param.id(reader.readString());
+            return param;
+        }
+        case TagDict:
+        {
+            const auto size = reader.readCount(sizeof(std::uint64_t) + 1); // each entry has at least a key length and a node tag
+            Dict<String, Data> dict;
+            for(auto i = 0u; i < size; ++i)
+            {
+                auto key = reader.readString();
+                dict.emplace(std::move(key), readDataBinary(reader));
+            }
+            return dict;
+        }
+        case TagList:
+        {
+            const auto size = reader.readCount(1); // each item has at least a node tag
+            Vec<Data> list;
+            list.reserve(size);
+            for(auto i = 0u; i < size; ++i)
+                list.push_back(readDataBinary(reader));
+            return list;
+        }
+    }
+
+    errorif(true, "Could not read Data object from binary data with unknown node tag ", int(tag), " (corrupted data?).");
+
+    return {};
+}
+
 // ==========================================================================================
 // CLASS TO ENSURE A COMMON LOCALE IS KEPT WHEN DEALING WITH YAML AND JSON
 // ==========================================================================================
@@ -365,6 +500,23 @@ auto Data::loadJson(String const& path) -> Data
     return convertJsonToData(doc);
 }
 
+auto Data::loadBinary(String const& path) -> Data
+{
+    MemoryMappedFile file(path);
+    BinaryReader reader(file.data(), file.size());
+
+    errorif(file.size() < sizeof(DataBinaryMagic) || std::memcmp(reader.view<char>(sizeof(DataBinaryMagic)), DataBinaryMagic, sizeof(DataBinaryMagic)) != 0,
+        "The file `", path, "` is not a binary file written with Data::saveBinary.");
+
+    const auto version = reader.read<std::uint32_t>();
+    errorif(version > DataBinaryVersion, "The binary Data file `", path, "` has version ", version, ", which is newer than the supported version ", DataBinaryVersion, ".");
+
+    const auto byteorder = reader.read<std::uint32_t>();
+    errorif(byteorder != DataBinaryByteOrder, "The binary Data file `", path, "` was written on a machine with a different byte order.");
+
+    return readDataBinary(reader);
+}
+
 auto Data::asString() const -> String const&
 {
     errorif(!isString(), "Cannot convert this Data object to a String.");
@@ -589,7 +741,7 @@ auto Data::exists(String const& key) const -> bool
 {
     if(!isDict())
         return false;
-    auto obj = asDict();
+    auto const& obj = asDict();
     return obj.find(key) != obj.end();
 }
 
@@ -629,6 +781,16 @@ auto Data::saveJson(String const& filepath) const -> void
     file.close();
 }
 
+auto Data::saveBinary(String const& filepath) const -> void
+{
+    BinaryWriter writer(filepath);
+    writer.write(DataBinaryMagic, sizeof(DataBinaryMagic));
+    writer.write<std::uint32_t>(DataBinaryVersion);
+    writer.write<std::uint32_t>(DataBinaryByteOrder);
+    writeDataBinary(writer, *this);
+    writer.close();
+}
+
 auto Data::repr() const -> String
 {
     return dumpYaml();
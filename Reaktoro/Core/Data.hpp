@@ -80,6 +80,10 @@ public:
     /// Return a Data object by parsing a JSON formatted file at a given path.
     static auto loadJson(String const& path) -> Data;
 
+    /// Return a Data object from a binary file written with @ref saveBinary.
+    /// This is much faster than parsing an equivalent YAML or JSON file, since the file is memory-mapped and no text is converted.
+    static auto loadBinary(String const& path) -> Data;
+
     /// Return this Data object as a boolean value.
     auto asBoolean() const -> bool;
 
@@ -213,6 +217,10 @@ public:
     /// Save the state of this Data object into a JSON formatted file.
     auto saveJson(String const& filepath) const -> void;
 
+    /// Save this Data object to a file in a compact binary format (see @ref loadBinary).
+    /// Unlike YAML and JSON files, the binary file preserves the bounds, ids and const flags of Param objects.
+    auto saveBinary(String const& filepath) const -> void;
+
     /// Return a YAML formatted string representing the state of this Data object.
     auto repr() const -> String;
 
@@ -53,6 +53,7 @@ void exportData(py::module& m)
         .def_static("load", &Data::load, "Return a Data object by parsing either an YAML or JSON formatted file at a given path.")
         .def_static("loadYaml", &Data::loadYaml, "Return a Data object by parsing an YAML formatted file at a given path.")
         .def_static("loadJson", &Data::loadJson, "Return a Data object by parsing a JSON formatted file at a given path.")
+        .def_static("loadBinary", &Data::loadBinary, "Return a Data object from a binary file written with Data.saveBinary.")
         .def("asBoolean", &Data::asBoolean, "Return this Data object as a boolean value.")
         .def("asString", &Data::asString, return_internal_ref, "Return this Data object as a string.")
         .def("asInteger", &Data::asInteger, "Return this Data object as an integer number.")
@@ -89,6 +90,7 @@ void exportData(py::module& m)
         .def("save", &Data::save, "Save the state of this Data object into a YAML formatted file.")
         .def("saveYaml", &Data::saveYaml, "Save the state of this Data object into a YAML formatted file.")
         .def("saveJson", &Data::saveJson, "Save the state of this Data object into a JSON formatted file.")
+        .def("saveBinary", &Data::saveBinary, "Save this Data object to a file in a compact binary format.")
         .def("repr", &Data::repr, "Return a YAML formatted string representing the state of this Data object.")
         .def("__str__", &Data::repr, "Return a YAML formatted string representing the state of this Data object.")
         .def("__repr__", &Data::repr, "Return a YAML formatted string representing the state of this Data object.")
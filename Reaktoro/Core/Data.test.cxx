@@ -15,6 +15,9 @@
 // You should have received a copy of the GNU Lesser General Public License
 // along with this library. If not, see <http://www.gnu.org/licenses/>.
 
+// C++ includes
+#include <cstdio>
+
 // Catch includes
 #include <catch2/catch.hpp>
 
@@ -723,6 +726,48 @@ TEST_CASE("Testing Data class", "[Data]")
         // CHECK( data.dumpJson() == nlohmann::json::parse(json_testing_string).dump(2) ); // indent=2
     }
 
+    SECTION("Checking saving and loading of Data objects in binary format")
+    {
+        Data data = Data::parseYaml(yaml_testing_string);
+        data.add("Integer", 7);
+        data.add("Float", 1.5);
+        data.add("Null", nullptr);
+        data.add("Param", Param("x", 2.5).lowerbound(1.0).upperbound(3.0).isconst(true));
+
+        const String filename = "reaktoro-data-test.rkdata";
+
+        data.saveBinary(filename);
+
+        const Data loaded = Data::loadBinary(filename);
+
+        CHECK( loaded.dumpYaml() == data.dumpYaml() );
+
+        CHECK( loaded["Extra"]["SomeBoolean"].asBoolean() == true );
+        CHECK( loaded["Extra"]["SomeStrings"][1].asString() == "Hallo" );
+        CHECK( loaded["Species"][0]["StandardThermoModel"]["HollandPowell"]["Gf"].isParam() );
+        CHECK( loaded["Species"][0]["StandardThermoModel"]["HollandPowell"]["Gf"].asFloat() == -4937500.0 );
+        CHECK( loaded["Integer"].isInteger() );
+        CHECK( loaded["Integer"].asInteger() == 7 );
+        CHECK( loaded["Float"].isFloat() );
+        CHECK( loaded["Float"].asFloat() == 1.5 );
+        CHECK( loaded["Null"].isNull() );
+
+        const Param param = loaded["Param"].asParam();
+        CHECK( param.id() == "x" );
+        CHECK( param.value() == 2.5 );
+        CHECK( param.lowerbound() == 1.0 );
+        CHECK( param.upperbound() == 3.0 );
+        CHECK( param.isconst() == true );
+
+        std::remove(filename.c_str());
+
+        Data::parseJson(json_testing_string).saveJson(filename);
+
+        CHECK_THROWS( Data::loadBinary(filename) ); // not a binary Data file
+
+        std::remove(filename.c_str());
+    }
+
     SECTION("Checking encoding/decoding of custom types to/from Data objects")
     {
         const auto str = R"#(
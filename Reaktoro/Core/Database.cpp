@@ -19,20 +19,32 @@
 
 // C++ includes
 #include <fstream>
+#include <iterator>
+#include <mutex>
 
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Common/ParseUtils.hpp>
 #include <Reaktoro/Core/Data.hpp>
+#include <Reaktoro/Core/DatabaseCache.hpp>
 #include <Reaktoro/Core/Support/DatabaseParser.hpp>
 
 namespace Reaktoro {
 
 struct Database::Impl
 {
-    /// The Species objects in the database.
-    SpeciesList species;
+    /// The records of all species in the database (in the order they were added).
+    Vec<SpeciesRecord> records;
+
+    /// The Species objects of the records in the database (empty for those not yet created).
+    mutable Vec<Optional<Species>> created;
+
+    /// The Species objects of all records in the database (up-to-date only if its size is the number of records).
+    mutable SpeciesList species;
+
+    /// The mutex used to protect the creation of Species objects from species records.
+    SharedPtr<std::mutex> mutex = std::make_shared<std::mutex>();
 
     /// The Element objects in the database.
     ElementList elements;
@@ -43,11 +55,11 @@ struct Database::Impl
     /// The symbols of all elements already in the database.
     Set<String> element_symbols;
 
-    /// The names of all species already in the database.
-    Set<String> species_names;
+    /// The indices of the species records in the database with given names.
+    Map<String, Index> species_names;
 
-    /// The species in the database grouped in terms of their aggregate state
-    Map<AggregateState, SpeciesList> species_with_aggregate_state;
+    /// The indices of the species records in the database grouped in terms of their aggregate state
+    Map<AggregateState, Indices> species_with_aggregate_state;
 
     /// Add an element in the database.
     auto addElement(Element const& element) -> void
@@ -59,21 +71,44 @@ struct Database::Impl
         }
     }
 
-    /// Add a species in the database.
-    auto addSpecies(Species newspecies) -> void
+    /// Return a name for a new species that is unique in the database.
+    auto uniqueSpeciesName(String const& name) const -> String
     {
         // Ensure a unique name is used when storing this species!
-        auto name = newspecies.name();
         auto unique_name = name;
         while(species_names.find(unique_name) != species_names.end())
             unique_name = unique_name + "!"; // keep adding symbol ! to the name such as H2O, H2O!, H2O!!, H2O!!! if many H2O are given
 
+        warning(name != unique_name, "Species should have unique names in Database, but species ", name, " "
+            "violates this rule. The unique name ", unique_name, " has been assigned instead.");
+
+        return unique_name;
+    }
+
+    /// Add a species record in the database (with its Species object if already created).
+    auto addRecord(SpeciesRecord record, Optional<Species> newspecies) -> void
+    {
+        // Append the new Species object in the species container if this is up-to-date.
+        if(newspecies && species.size() == records.size())
+            species.append(*newspecies);
+
+        // Update the list of unique species names.
+        species_names.emplace(record.name, records.size());
+
+        // Add the new species in the group of species with same aggregate state
+        species_with_aggregate_state[record.aggregate_state].push_back(records.size());
+
+        records.push_back(std::move(record));
+        created.push_back(std::move(newspecies));
+    }
+
+    /// Add a species in the database.
+    auto addSpecies(Species newspecies) -> void
+    {
         // Replace name if not unique.
-        if(name != unique_name) {
+        const auto unique_name = uniqueSpeciesName(newspecies.name());
+        if(newspecies.name() != unique_name)
             newspecies = newspecies.withName(unique_name);
-            warning(true, "Species should have unique names in Database, but species ", name, " "
-                "violates this rule. The unique name ", unique_name, " has been assigned instead.");
-        }
 
         // Replace aggregate state to Aqueous if undefined. If this default
         // aggregate state option is not appropriate for a given scenario,
@@ -88,23 +123,106 @@ struct Database::Impl
         if(newspecies.aggregateState() == AggregateState::Undefined)
             newspecies = newspecies.withAggregateState(AggregateState::Aqueous);
 
-        // Append the new Species object in the species container
-        species.append(newspecies);
-
-        // Update the list of unique species names.
-        species_names.insert(newspecies.name());
-
         // Update the container of elements with the Element objects in this new species.
         for(auto&& [element, coeff] : newspecies.elements())
             addElement(element);
 
-        // Add the new species in the group of species with same aggregate state
-        species_with_aggregate_state[newspecies.aggregateState()].push_back(newspecies);
+        SpeciesRecord record;
+        record.name = newspecies.name();
+        record.formula = newspecies.formula().str();
+        record.elements = newspecies.elements().symbols();
+        record.aggregate_state = newspecies.aggregateState();
+        record.tags = newspecies.tags();
+
+        addRecord(std::move(record), std::move(newspecies));
+    }
+
+    /// Add a species record in the database whose Species object is created only when needed.
+    auto addSpeciesRecord(SpeciesRecord record) -> void
+    {
+        errorif(!record.create, "Expecting a species record with a function to create its Species object, but species ", record.name, " has none.");
+
+        record.name = uniqueSpeciesName(record.name);
+
+        // Replace aggregate state to Aqueous if undefined (see comments in method addSpecies).
+        if(record.aggregate_state == AggregateState::Undefined)
+            record.aggregate_state = AggregateState::Aqueous;
+
+        // Update the container of elements with default Element objects for elements not yet in the database.
+        for(auto const& symbol : record.elements)
+            if(element_symbols.find(symbol) == element_symbols.end())
+                addElement(Element(symbol));
+
+        addRecord(std::move(record), {});
+    }
+
+    /// Return the Species object of the species record with given index, creating it if needed (without locking the mutex).
+    auto create(Index i) const -> Species const&
+    {
+        if(!created[i])
+        {
+            auto const& record = records[i];
+            auto newspecies = record.create();
+            if(newspecies.name() != record.name)
+                newspecies = newspecies.withName(record.name);
+            if(newspecies.aggregateState() == AggregateState::Undefined)
+                newspecies = newspecies.withAggregateState(record.aggregate_state);
+            created[i] = newspecies;
+        }
+        return *created[i];
+    }
+
+    /// Return the Species object of the species record with given index, creating it if needed.
+    auto get(Index i) const -> Species const&
+    {
+        std::lock_guard<std::mutex> lock(*mutex);
+        return create(i);
+    }
+
+    /// Return the Species objects of all species in the database, creating those not yet created.
+    auto allSpecies() const -> SpeciesList const&
+    {
+        std::lock_guard<std::mutex> lock(*mutex);
+        if(species.size() != records.size())
+        {
+            Vec<Species> all;
+            all.reserve(records.size());
+            for(auto i = 0; i < records.size(); ++i)
+                all.push_back(create(i));
+            species = all;
+        }
+        return species;
+    }
+
+    /// Return the Species objects of the species records with given indices that satisfy a given filter.
+    auto speciesWithFilter(Indices const& irecords, Fn<bool(SpeciesRecord const&)> const& filter) const -> SpeciesList
+    {
+        std::lock_guard<std::mutex> lock(*mutex);
+        Vec<Species> selected;
+        for(auto const i : irecords)
+            if(!filter || filter(records[i]))
+                selected.push_back(create(i));
+        return selected;
+    }
+
+    /// Return the Species objects of the species records that satisfy a given filter.
+    auto speciesWithFilter(Fn<bool(SpeciesRecord const&)> const& filter) const -> SpeciesList
+    {
+        std::lock_guard<std::mutex> lock(*mutex);
+        Vec<Species> selected;
+        for(auto i = 0; i < records.size(); ++i)
+            if(filter(records[i]))
+                selected.push_back(create(i));
+        return selected;
     }
 
     /// Construct a reaction with given equation.
     auto reaction(String const& equation) const -> Reaction
     {
+        Set<String> names;
+        for(auto const& [name, coeff] : parseReactionEquation(equation))
+            names.insert(name);
+        const auto species = speciesWithFilter([&](SpeciesRecord const& record) { return names.count(record.name); });
         return Reaction().withEquation(ReactionEquation(equation, species));
     }
 };
@@ -163,6 +281,11 @@ auto Database::addSpecies(Vec<Species> const& species) -> void
         addSpecies(x);
 }
 
+auto Database::addSpeciesRecord(SpeciesRecord const& record) -> void
+{
+    pimpl->addSpeciesRecord(record);
+}
+
 auto Database::attachData(Any const& data) -> void
 {
     pimpl->attached_data = data;
@@ -173,8 +296,12 @@ auto Database::extend(Database const& other) -> void
     for(auto const& element : other.elements())
         addElement(element);
 
-    for(auto const& species : other.species())
-        addSpecies(species);
+    for(auto i = 0; i < other.pimpl->records.size(); ++i)
+    {
+        if(other.pimpl->created[i])
+            addSpecies(*other.pimpl->created[i]);
+        else addSpeciesRecord(other.pimpl->records[i]);
+    }
 
     // TODO: Replace Any by Map<String, Any> so that it becomes easier/more intuitive to unify different attached data to Database objects.
     // pimpl->attached_data = ???;
@@ -187,15 +314,30 @@ auto Database::elements() const -> ElementList const&
 
 auto Database::species() const -> SpeciesList const&
 {
-    return pimpl->species;
+    return pimpl->allSpecies();
+}
+
+auto Database::speciesRecords() const -> Vec<SpeciesRecord> const&
+{
+    return pimpl->records;
+}
+
+auto Database::speciesWithFilter(Fn<bool(SpeciesRecord const&)> const& filter) const -> SpeciesList
+{
+    return pimpl->speciesWithFilter(filter);
 }
 
 auto Database::speciesWithAggregateState(AggregateState option) const -> SpeciesList
+{
+    return speciesWithAggregateState(option, nullptr);
+}
+
+auto Database::speciesWithAggregateState(AggregateState option, Fn<bool(SpeciesRecord const&)> const& filter) const -> SpeciesList
 {
     auto it = pimpl->species_with_aggregate_state.find(option);
     if(it == pimpl->species_with_aggregate_state.end())
         return {};
-    return it->second;
+    return pimpl->speciesWithFilter(it->second, filter);
 }
 
 auto Database::element(String const& symbol) const -> Element const&
@@ -205,7 +347,10 @@ auto Database::element(String const& symbol) const -> Element const&
 
 auto Database::species(String const& name) const -> Species const&
 {
-    return species().getWithName(name);
+    auto const it = pimpl->species_names.find(name);
+    if(it != pimpl->species_names.end())
+        return pimpl->get(it->second);
+    return species().getWithName(name); // this raises the error for a species not found
 }
 
 auto Database::reaction(String const& equation) const -> Reaction
@@ -228,21 +373,23 @@ auto Database::fromFile(String const& path) -> Database
         "try a full path to the file (e.g., "
         "in Windows, `C:\\User\\username\\mydata\\mydatabase.yaml`, "
         "in Linux, `/home/username/mydata/mydatabase.yaml`).");
-    return fromStream(file);
+    const String contents(std::istreambuf_iterator<char>(file), {});
+    auto doc = DatabaseCache::parse(path, contents);
+    DatabaseParser dbparser(doc);
+    return dbparser;
 }
 
 auto Database::fromContents(String const& contents) -> Database
 {
-    auto doc = Data::parse(contents);
+    auto doc = DatabaseCache::parse("database", contents);
     DatabaseParser dbparser(doc);
     return dbparser;
 }
 
 auto Database::fromStream(std::istream& stream) -> Database
 {
-    auto doc = Data::parse(stream);
-    DatabaseParser dbparser(doc);
-    return dbparser;
+    const String contents(std::istreambuf_iterator<char>(stream), {});
+    return fromContents(contents);
 }
 
 } // namespace Reaktoro
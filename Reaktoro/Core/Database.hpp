@@ -25,6 +25,35 @@
 
 namespace Reaktoro {
 
+/// The basic data of a species in a Database object used to select it without creating its Species object.
+/// A species added with Database::addSpeciesRecord has its Species object
+/// created only when needed (e.g., when it is selected for a phase). This
+/// avoids the cost of creating the chemical formulas and standard
+/// thermodynamic models of the many species in large databases that are
+/// never used in a chemical system.
+/// @see Database
+/// @ingroup Core
+struct SpeciesRecord
+{
+    /// The name of the species.
+    String name;
+
+    /// The chemical formula of the species.
+    String formula;
+
+    /// The symbols of the elements composing the species.
+    Strings elements;
+
+    /// The aggregate state of the species.
+    AggregateState aggregate_state = AggregateState::Undefined;
+
+    /// The tags of the species.
+    Strings tags;
+
+    /// The function that creates the Species object (empty if the Species object is given directly).
+    Fn<Species()> create;
+};
+
 /// The class used to store and retrieve data of chemical species.
 /// @see Element, Species
 /// @ingroup Core
@@ -78,6 +107,13 @@ public:
     /// Add a list of species in the database.
     auto addSpecies(Vec<Species> const& species) -> void;
 
+    /// Add a species in the database whose Species object is created only when needed.
+    /// @note The elements in the species that do not exist in the database are
+    /// added with their default attributes (see Element::Element(String)). Use
+    /// @ref addElement beforehand if the species needs custom Element objects.
+    /// @note The same name uniqueness and default aggregate state rules of @ref addSpecies apply.
+    auto addSpeciesRecord(SpeciesRecord const& record) -> void;
+
     /// Attach data to this database whose type is known at runtime only.
     auto attachData(Any const& data) -> void;
 
@@ -88,11 +124,24 @@ public:
     auto elements() const -> ElementList const&;
 
     /// Return all species in the database.
+    /// @note This creates the Species objects of all species added with @ref addSpeciesRecord.
+    /// Prefer @ref speciesWithFilter or @ref speciesWithAggregateState to select only some species.
     auto species() const -> SpeciesList const&;
 
+    /// Return the records of all species in the database, in the same order as in @ref species.
+    auto speciesRecords() const -> Vec<SpeciesRecord> const&;
+
+    /// Return the species in the database whose records satisfy a given filter.
+    /// Only the Species objects of the selected species are created.
+    auto speciesWithFilter(Fn<bool(SpeciesRecord const&)> const& filter) const -> SpeciesList;
+
     /// Return all species in the database with given aggregate state.
     auto speciesWithAggregateState(AggregateState option) const -> SpeciesList;
 
+    /// Return the species in the database with given aggregate state whose records satisfy a given filter.
+    /// Only the Species objects of the selected species are created.
+    auto speciesWithAggregateState(AggregateState option, Fn<bool(SpeciesRecord const&)> const& filter) const -> SpeciesList;
+
     /// Return an element with given symbol in the database.
     /// @warning An exception is thrown if no element with given symbol exists.
     auto element(String const& symbol) const -> Element const&;
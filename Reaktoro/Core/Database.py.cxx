@@ -34,6 +34,16 @@ void exportDatabase(py::module& m)
         self.addSpecies(species);
     };
 
+    py::class_<SpeciesRecord>(m, "SpeciesRecord")
+        .def(py::init<>())
+        .def_readwrite("name", &SpeciesRecord::name)
+        .def_readwrite("formula", &SpeciesRecord::formula)
+        .def_readwrite("elements", &SpeciesRecord::elements)
+        .def_readwrite("aggregate_state", &SpeciesRecord::aggregate_state)
+        .def_readwrite("tags", &SpeciesRecord::tags)
+        .def_readwrite("create", &SpeciesRecord::create)
+        ;
+
     py::class_<Database>(m, "Database")
         .def(py::init<>())
         .def(py::init<const SpeciesList&>())
@@ -44,11 +54,15 @@ void exportDatabase(py::module& m)
         .def("addElement", &Database::addElement)
         .def("addSpecies", addSpecies1)
         .def("addSpecies", addSpecies2)
+        .def("addSpeciesRecord", &Database::addSpeciesRecord)
         .def("attachData", &Database::attachData)
         .def("extend", &Database::extend)
         .def("elements", &Database::elements)
         .def("species", py::overload_cast<>(&Database::species, py::const_))
-        .def("speciesWithAggregateState", &Database::speciesWithAggregateState)
+        .def("speciesRecords", &Database::speciesRecords, return_internal_ref)
+        .def("speciesWithFilter", &Database::speciesWithFilter)
+        .def("speciesWithAggregateState", py::overload_cast<AggregateState>(&Database::speciesWithAggregateState, py::const_))
+        .def("speciesWithAggregateState", py::overload_cast<AggregateState, Fn<bool(SpeciesRecord const&)> const&>(&Database::speciesWithAggregateState, py::const_))
         .def("element", &Database::element, return_internal_ref)
         .def("species", py::overload_cast<const String&>(&Database::species, py::const_), return_internal_ref)
         .def("reaction", &Database::reaction)
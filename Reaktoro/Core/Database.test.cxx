@@ -19,6 +19,7 @@
 #include <catch2/catch.hpp>
 
 // Reaktoro includes
+#include <Reaktoro/Common/Algorithms.hpp>
 #include <Reaktoro/Core/Database.hpp>
 using namespace Reaktoro;
 
@@ -281,3 +282,117 @@ TEST_CASE("Testing Database object creation using Database::fromContents", "[Dat
     CHECK(db.species().size() == 1);
     CHECK(db.species()[0].name() == "Akermanite");
 }
+
+TEST_CASE("Testing Database object with species created only when needed", "[Database]")
+{
+    Index numcreated = 0;
+
+    auto createRecord = [&](String const& name, Strings const& elements, AggregateState option)
+    {
+        SpeciesRecord record;
+        record.name = name;
+        record.formula = name;
+        record.elements = elements;
+        record.aggregate_state = option;
+        record.create = [&numcreated, name, option]() { ++numcreated; return Species(name).withAggregateState(option); };
+        return record;
+    };
+
+    Database db;
+    db.addSpeciesRecord(createRecord("H2O", {"H", "O"}, AggregateState::Aqueous));
+    db.addSpeciesRecord(createRecord("H+", {"H"}, AggregateState::Aqueous));
+    db.addSpeciesRecord(createRecord("Ca++", {"Ca"}, AggregateState::Aqueous));
+    db.addSpecies(Species("CO2").withAggregateState(AggregateState::Gas));
+    db.addSpeciesRecord(createRecord("CaCO3", {"Ca", "C", "O"}, AggregateState::Solid));
+    db.addSpeciesRecord(createRecord("H2O", {"H", "O"}, AggregateState::Gas)); // repeated name becomes H2O!
+
+    CHECK( numcreated == 0 );
+
+    CHECK( db.speciesRecords().size() == 6 );
+    CHECK( db.speciesRecords()[5].name == "H2O!" );
+    CHECK( db.elements().size() == 4 ); // H, O, Ca, C
+
+    auto aqueous = db.speciesWithAggregateState(AggregateState::Aqueous, [](SpeciesRecord const& record) { return contained(record.elements, Strings{"H", "O"}); });
+
+    CHECK( aqueous.size() == 2 );
+    CHECK( aqueous[0].name() == "H2O" );
+    CHECK( aqueous[1].name() == "H+" );
+    CHECK( numcreated == 2 );
+
+    CHECK( db.species("H2O").name() == "H2O" ); // already created
+    CHECK( numcreated == 2 );
+
+    CHECK( db.species("H2O!").name() == "H2O!" );
+    CHECK( db.species("H2O!").aggregateState() == AggregateState::Gas );
+    CHECK( numcreated == 3 );
+
+    CHECK( db.speciesWithAggregateState(AggregateState::Gas).size() == 2 ); // CO2 and H2O!
+    CHECK( numcreated == 3 );
+
+    CHECK( db.species().size() == 6 );
+    CHECK( db.species()[3].name() == "CO2" );
+    CHECK( db.species()[4].name() == "CaCO3" );
+    CHECK( numcreated == 5 );
+
+    Database other;
+    other.extend(db);
+
+    CHECK( other.species().size() == 6 );
+    CHECK( numcreated == 5 ); // species already created are reused
+
+    SECTION("Checking species in a YAML database are created only when needed")
+    {
+        String contents = R"#(
+            Species:
+              Akermanite:
+                Name: Akermanite
+                Formula: Ca2MgSi2O7
+                Elements: 2:Ca 1:Mg 2:Si 7:O
+                AggregateState: Solid
+                StandardThermoModel:
+                  MaierKelley:
+                    Gf: -3679250.6
+                    Hf: -3876463.4
+                    Sr: 209.32552
+                    Vr: 9.281e-05
+                    a: 251.41656
+                    b: 0.0476976
+                    c: -4769760.0
+                    Tmax: 1700.0
+              Quartz:
+                Name: Quartz
+                Formula: SiO2
+                Elements: 1:Si 2:O
+                AggregateState: Solid
+                StandardThermoModel:
+                  MaierKelley:
+                    Gf: -856238.8
+                    Hf: -910700.0
+                    Sr: 41.338
+                    Vr: 2.2688e-05
+                    a: 46.944
+                    b: 0.034309
+                    c: -1129680.0
+                    Tmax: 848.0
+            )#";
+
+        Database yamldb = Database::fromContents(contents);
+
+        CHECK( yamldb.speciesRecords().size() == 2 );
+        CHECK( yamldb.speciesRecords()[0].name == "Akermanite" );
+        CHECK( yamldb.speciesRecords()[0].formula == "Ca2MgSi2O7" );
+        CHECK( yamldb.speciesRecords()[0].elements == Strings{"Ca", "Mg", "Si", "O"} );
+        CHECK( yamldb.speciesRecords()[1].aggregate_state == AggregateState::Solid );
+        CHECK( yamldb.elements().size() == 4 );
+
+        const auto quartz = yamldb.speciesWithFilter([](SpeciesRecord const& record) { return contained(record.elements, Strings{"Si", "O"}); });
+
+        CHECK( quartz.size() == 1 );
+        CHECK( quartz[0].name() == "Quartz" );
+        CHECK( quartz[0].elements().symbols() == Strings{"Si", "O"} );
+        CHECK( quartz[0].standardThermoProps(298.15, 1e5).G0 == Approx(-856238.8) );
+
+        CHECK( yamldb.species().size() == 2 );
+        CHECK( yamldb.species()[1].name() == "Quartz" );
+    }
+}
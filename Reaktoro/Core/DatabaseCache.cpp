@@ -0,0 +1,225 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "DatabaseCache.hpp"
+
+// C++ includes
+#include <atomic>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <random>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+
+namespace Reaktoro {
+namespace {
+
+/// The state of the database cache shared by all threads.
+struct DatabaseCacheState
+{
+    /// The mutex used to protect the members below.
+    std::mutex mutex;
+
+    /// The parsed documents of databases keyed by name and hash of contents.
+    Map<String, Data> documents;
+
+    /// The directory where parsed documents are cached in binary files.
+    String directory;
+
+    /// Construct a DatabaseCacheState object with the cache directory given by environment variable `REAKTORO_DATABASE_CACHE_DIR`.
+    DatabaseCacheState()
+    {
+        if(auto const* dir = std::getenv("REAKTORO_DATABASE_CACHE_DIR"))
+            directory = dir;
+    }
+};
+
+/// The flag that indicates whether parsed database documents are cached.
+std::atomic<bool> enabled = true;
+
+/// Return the state of the database cache.
+auto state() -> DatabaseCacheState&
+{
+    static DatabaseCacheState instance;
+    return instance;
+}
+
+/// Return the 64-bit FNV-1a hash of a string.
+auto hashContents(String const& contents) -> std::uint64_t
+{
+    std::uint64_t hash = 14695981039346656037ull;
+    for(auto const c : contents)
+    {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+/// Return the key of a database document made of the file name of `name` (with unsafe characters replaced) and the hash of its contents.
+auto cacheKey(String const& name, std::uint64_t hash) -> String
+{
+    const auto pos = name.find_last_of("/\\");
+    String key = pos == String::npos ? name : name.substr(pos + 1);
+    for(auto& c : key)
+        if(!std::isalnum(static_cast<unsigned char>(c)) && c != '-' && c != '_' && c != '.')
+            c = '_';
+    char hex[17];
+    std::snprintf(hex, sizeof(hex), "%016llx", static_cast<unsigned long long>(hash));
+    return key + "-" + hex;
+}
+
+/// Return a copy of a Data object in which every Param object is cloned rather than shared.
+auto cloneData(Data const& data) -> Data
+{
+    if(data.isParam())
+        return data.asParam().clone();
+    if(data.isDict())
+    {
+        Dict<String, Data> dict;
+        for(auto const& [key, value] : data.asDict())
+            dict.emplace(key, cloneData(value));
+        return dict;
+    }
+    if(data.isList())
+    {
+        Vec<Data> list;
+        list.reserve(data.asList().size());
+        for(auto const& value : data.asList())
+            list.push_back(cloneData(value));
+        return list;
+    }
+    return data;
+}
+
+/// Return the parsed document in a cache file or null if this file does not exist or cannot be read.
+auto loadCacheFile(String const& path) -> Data
+{
+    if(auto* file = std::fopen(path.c_str(), "rb"))
+        std::fclose(file);
+    else return {};
+
+    try { return Data::loadBinary(path); }
+    catch(...) { return {}; } // a corrupted or outdated cache file is simply ignored and later overwritten
+}
+
+/// Save a parsed document in a cache file, ignoring any failures (e.g., read-only directory).
+auto saveCacheFile(String const& path, Data const& doc) -> void
+{
+    // Write to a temporary file first and then rename it, so that other
+    // processes never see a partially written cache file.
+    const auto tmppath = path + "." + std::to_string(std::random_device{}()) + ".tmp";
+    try
+    {
+        doc.saveBinary(tmppath);
+        if(std::rename(tmppath.c_str(), path.c_str()) != 0)
+            std::remove(tmppath.c_str());
+    }
+    catch(...)
+    {
+        std::remove(tmppath.c_str());
+    }
+}
+
+} // namespace
+
+auto DatabaseCache::parse(String const& name, String const& contents) -> Data
+{
+    if(!isEnabled())
+        return Data::parse(contents);
+
+    auto& cache = state();
+
+    const auto key = cacheKey(name, hashContents(contents));
+
+    String dir;
+
+    {
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        auto const it = cache.documents.find(key);
+        if(it != cache.documents.end())
+            return cloneData(it->second);
+        dir = cache.directory;
+    }
+
+    // Parse the document (or read it from its cache file) without holding the lock.
+    const auto path = dir.empty() ? String() : dir + "/" + key + ".rkdata";
+
+    Data doc = path.empty() ? Data() : loadCacheFile(path);
+
+    if(doc.isNull())
+    {
+        doc = Data::parse(contents);
+        if(!path.empty())
+            saveCacheFile(path, doc);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        cache.documents.emplace(key, doc);
+    }
+
+    return cloneData(doc);
+}
+
+auto DatabaseCache::enable() -> void
+{
+    enabled = true;
+}
+
+auto DatabaseCache::disable() -> void
+{
+    enabled = false;
+}
+
+auto DatabaseCache::isEnabled() -> bool
+{
+    return enabled;
+}
+
+auto DatabaseCache::setDirectory(String const& dir) -> void
+{
+    auto& cache = state();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    cache.directory = dir;
+}
+
+auto DatabaseCache::directory() -> String
+{
+    auto& cache = state();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    return cache.directory;
+}
+
+auto DatabaseCache::clear() -> void
+{
+    auto& cache = state();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    cache.documents.clear();
+}
+
+auto DatabaseCache::size() -> Index
+{
+    auto& cache = state();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    return cache.documents.size();
+}
+
+} // namespace Reaktoro
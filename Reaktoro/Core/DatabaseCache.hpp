@@ -0,0 +1,69 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Types.hpp>
+#include <Reaktoro/Core/Data.hpp>
+
+namespace Reaktoro {
+
+/// Used to avoid parsing the same YAML or JSON database document more than once.
+/// The document of a database is parsed only once per process and kept in
+/// memory, identified by the name of the database and a hash of its contents.
+/// If a cache directory is set (with @ref setDirectory or the environment
+/// variable `REAKTORO_DATABASE_CACHE_DIR`), the parsed document is also saved
+/// there in the binary format of Data::saveBinary, so that other processes
+/// loading the same database read this file instead of parsing the document.
+/// @note Each call to @ref parse returns a new Data object whose Param objects
+/// are not shared with any other, so that Database objects created from it can
+/// have their parameters changed independently.
+class DatabaseCache
+{
+public:
+    /// Return the parsed document of a database with given name and YAML or JSON formatted contents.
+    /// @param name The name of the database (used to identify its cache file)
+    /// @param contents The YAML or JSON formatted contents of the database
+    static auto parse(String const& name, String const& contents) -> Data;
+
+    /// Enable the caching of parsed database documents.
+    static auto enable() -> void;
+
+    /// Disable the caching of parsed database documents.
+    static auto disable() -> void;
+
+    /// Return true if the caching of parsed database documents is enabled.
+    static auto isEnabled() -> bool;
+
+    /// Set the directory where parsed database documents are cached in binary files (an empty string disables this).
+    static auto setDirectory(String const& dir) -> void;
+
+    /// Return the directory where parsed database documents are cached in binary files (an empty string if disabled).
+    static auto directory() -> String;
+
+    /// Remove all parsed database documents kept in memory (cache files are not removed).
+    static auto clear() -> void;
+
+    /// Return the number of parsed database documents kept in memory.
+    static auto size() -> Index;
+
+    /// Deleted default constructor.
+    DatabaseCache() = delete;
+};
+
+} // namespace Reaktoro
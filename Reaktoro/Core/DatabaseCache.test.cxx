@@ -0,0 +1,122 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// C++ includes
+#include <cstdio>
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Core/Database.hpp>
+#include <Reaktoro/Core/DatabaseCache.hpp>
+using namespace Reaktoro;
+
+namespace test {
+
+const auto contents = R"#(
+Species:
+  Akermanite:
+    Name: Akermanite
+    Formula: Ca2MgSi2O7
+    Elements: 2:Ca 1:Mg 2:Si 7:O
+    AggregateState: Solid
+    StandardThermoModel:
+      MaierKelley:
+        Gf: -3679250.6
+        Hf: -3876463.4
+        Sr: 209.32552
+        Vr: 9.281e-05
+        a: 251.41656
+        b: 0.0476976
+        c: -4769760.0
+        Tmax: 1700.0
+)#";
+
+} // namespace test
+
+TEST_CASE("Testing DatabaseCache", "[DatabaseCache]")
+{
+    DatabaseCache::clear();
+
+    const auto olddir = DatabaseCache::directory();
+
+    DatabaseCache::setDirectory("");
+
+    SECTION("Checking parsed documents are reused and their parameters are not shared")
+    {
+        Data doc1 = DatabaseCache::parse("test", test::contents);
+
+        CHECK( DatabaseCache::size() == 1 );
+
+        Data doc2 = DatabaseCache::parse("test", test::contents);
+
+        CHECK( DatabaseCache::size() == 1 );
+
+        CHECK( doc1.dumpYaml() == doc2.dumpYaml() );
+        CHECK( doc1.dumpYaml() == Data::parse(test::contents).dumpYaml() );
+
+        Param Gf1 = doc1["Species"]["Akermanite"]["StandardThermoModel"]["MaierKelley"]["Gf"].asParam();
+        Param Gf2 = doc2["Species"]["Akermanite"]["StandardThermoModel"]["MaierKelley"]["Gf"].asParam();
+
+        Gf1 = 1.0;
+
+        CHECK( Gf2.value() == -3679250.6 );
+        CHECK( DatabaseCache::parse("test", test::contents)["Species"]["Akermanite"]["StandardThermoModel"]["MaierKelley"]["Gf"].asFloat() == -3679250.6 );
+
+        DatabaseCache::parse("test", String(test::contents) + "\n# changed contents\n");
+
+        CHECK( DatabaseCache::size() == 2 );
+    }
+
+    SECTION("Checking parsed documents are saved in and read from the cache directory")
+    {
+        DatabaseCache::setDirectory(".");
+
+        Data doc1 = DatabaseCache::parse("reaktoro-databasecache-test", test::contents);
+
+        DatabaseCache::clear(); // force the next call to read the cache file
+
+        Data doc2 = DatabaseCache::parse("reaktoro-databasecache-test", test::contents);
+
+        CHECK( doc1.dumpYaml() == doc2.dumpYaml() );
+    }
+
+    SECTION("Checking Database objects created from the same contents are independent")
+    {
+        Database db1 = Database::fromContents(test::contents);
+        Database db2 = Database::fromContents(test::contents);
+
+        CHECK( db1.species().size() == 1 );
+        CHECK( db2.species().size() == 1 );
+        CHECK( db1.species()[0].name() == "Akermanite" );
+    }
+
+    SECTION("Checking the cache can be disabled")
+    {
+        DatabaseCache::disable();
+
+        DatabaseCache::parse("test", test::contents);
+
+        CHECK( DatabaseCache::size() == 0 );
+
+        DatabaseCache::enable();
+    }
+
+    DatabaseCache::clear();
+    DatabaseCache::setDirectory(olddir);
+}
@@ -38,6 +38,9 @@ ElementList::ElementList(const Vec<Element>& elements)
 auto ElementList::append(const Element& element) -> void
 {
     m_elements.push_back(element);
+    const auto i = m_elements.size() - 1;
+    m_symbols_index.append(i, [&](Index j) { return m_elements[j].symbol(); });
+    m_names_index.append(i, [&](Index j) { return m_elements[j].name(); });
 }
 
 auto ElementList::data() const -> const Vec<Element>&
@@ -67,12 +70,12 @@ auto ElementList::find(const String& symbol) const -> Index
 
 auto ElementList::findWithSymbol(const String& symbol) const -> Index
 {
-    return indexfn(m_elements, RKT_LAMBDA(e, e.symbol() == symbol));
+    return m_symbols_index.find(symbol, size(), [&](Index i) { return m_elements[i].symbol(); });
 }
 
 auto ElementList::findWithName(const String& name) const -> Index
 {
-    return indexfn(m_elements, RKT_LAMBDA(e, e.name() == name));
+    return m_names_index.find(name, size(), [&](Index i) { return m_elements[i].name(); });
 }
 
 auto ElementList::index(const String& symbol) const -> Index
@@ -141,6 +144,7 @@ auto ElementList::withoutTags(const StringList& tags) const -> ElementList
 
 ElementList::operator Vec<Element>&()
 {
+    resetIndices();
     return m_elements;
 }
 
@@ -149,6 +153,12 @@ ElementList::operator Vec<Element>const&() const
     return m_elements;
 }
 
+auto ElementList::resetIndices() -> void
+{
+    m_symbols_index.reset();
+    m_names_index.reset();
+}
+
 auto operator+(const ElementList& a, const ElementList& b) -> ElementList
 {
     return concatenate(a, b);
@@ -18,6 +18,7 @@
 #pragma once
 
 // Reaktoro includes
+#include <Reaktoro/Common/HashIndex.hpp>
 #include <Reaktoro/Common/Types.hpp>
 #include <Reaktoro/Core/Element.hpp>
 
@@ -106,29 +107,39 @@ private:
     /// The elements stored in the list.
     Vec<Element> m_elements;
 
+    /// The hash index of the element symbols.
+    HashIndex<String> m_symbols_index;
+
+    /// The hash index of the element names.
+    HashIndex<String> m_names_index;
+
+    /// Reset the hash indices used for lookups (needed whenever the items may change).
+    auto resetIndices() -> void;
+
 public:
     /// Construct an ElementList object with given begin and end iterators.
     template<typename InputIterator>
     ElementList(InputIterator begin, InputIterator end) : m_elements(begin, end) {}
 
     /// Return begin const iterator of this ElementList instance (for STL compatibility reasons).
+    /// @note Only const iterators are provided, so that iterating over the list keeps its hash indices (use the conversion to Vec<Element>& to change the elements).
     auto begin() const { return m_elements.begin(); }
 
-    /// Return begin iterator of this ElementList instance (for STL compatibility reasons).
-    auto begin() { return m_elements.begin(); }
-
     /// Return end const iterator of this ElementList instance (for STL compatibility reasons).
     auto end() const { return m_elements.end(); }
 
-    /// Return end iterator of this ElementList instance (for STL compatibility reasons).
-    auto end() { return m_elements.end(); }
+    /// Return begin const iterator of this ElementList instance (for STL compatibility reasons).
+    auto cbegin() const { return m_elements.cbegin(); }
+
+    /// Return end const iterator of this ElementList instance (for STL compatibility reasons).
+    auto cend() const { return m_elements.cend(); }
 
     /// Append a new Element at the back of the container (for STL compatibility reasons).
     auto push_back(const Element& elements) -> void { append(elements); }
 
     /// Insert a container of Element objects into this ElementList instance (for STL compatibility reasons).
     template<typename Iterator, typename InputIterator>
-    auto insert(Iterator pos, InputIterator begin, InputIterator end) -> void { m_elements.insert(pos, begin, end); }
+    auto insert(Iterator pos, InputIterator begin, InputIterator end) -> void { resetIndices(); m_elements.insert(pos, begin, end); }
 
     /// The type of the value stored in a ElementList (for STL compatibility reasons).
     using value_type = Element;
@@ -268,3 +268,30 @@ TEST_CASE("Testing ElementList", "[ElementList]")
     for(auto [i, element] : enumerate(elements))
         REQUIRE( element.name() == elements[i].name() );
 }
+
+TEST_CASE("Testing ElementList lookups using hash indices", "[ElementList]")
+{
+    // Lists with at least HashIndex::minsize elements are searched with hash tables
+    ElementList elements;
+    for(auto symbol : Strings{"H", "He", "Li", "Be", "B", "C", "N", "O", "F", "Ne", "Na", "Mg", "Al", "Si", "P", "S", "Cl", "Ar"})
+        elements.append(Element().withSymbol(symbol).withName("Name" + symbol));
+
+    REQUIRE( elements.size() >= HashIndex<String>::minsize );
+
+    CHECK( elements.findWithSymbol("H")  == 0 );
+    CHECK( elements.findWithSymbol("Ar") == 17 );
+    CHECK( elements.findWithSymbol("Xy") == elements.size() );
+
+    CHECK( elements.findWithName("NameCl") == 16 );
+    CHECK( elements.findWithName("NameXy") == elements.size() );
+
+    elements.append(Element().withSymbol("K").withName("Potassium"));
+
+    CHECK( elements.findWithSymbol("K") == 18 );
+    CHECK( elements.findWithName("Potassium") == 18 );
+
+    static_cast<Vec<Element>&>(elements)[0] = Element().withSymbol("D").withName("Deuterium"); // a non-const access to the elements resets the hash indices
+
+    CHECK( elements.findWithSymbol("D") == 0 );
+    CHECK( elements.findWithSymbol("H") == elements.size() );
+}
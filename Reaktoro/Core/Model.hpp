@@ -113,6 +113,8 @@ public:
     {}
 
     /// Return a new Model function object with memoization for the model calculator.
+    /// The memoization caches are kept per thread, so that the returned Model object (and its copies)
+    /// can be evaluated concurrently by multiple threads.
     auto withMemoization() const -> Model
     {
         Model copy = *this;
@@ -183,6 +185,23 @@ public:
         return m_serializerfn ? m_serializerfn() : Data{}; // evaluate m_serializerfn because Param objects may have changed
     }
 
+    /// Return a duplicate of this Model function object with new attached data whose type is known at runtime only.
+    /// The attached data can be used to identify the underlying model function and
+    /// its parameters (e.g., to evaluate the standard thermodynamic models of many
+    /// species at once, see createStandardThermoModelBatch).
+    auto withAttachedData(Any data) const -> Model
+    {
+        Model copy = *this;
+        copy.m_attacheddata = std::move(data);
+        return copy;
+    }
+
+    /// Return the attached data of this Model function object whose type is known at runtime only.
+    auto attachedData() const -> const Any&
+    {
+        return m_attacheddata;
+    }
+
     /// Return a constant Model function object.
     /// @param param The parameter with the constant value always returned by the Model function object.
     static auto Constant(const Param& param) -> Model
@@ -226,6 +245,9 @@ private:
     /// with the Param objects. By storing a function, the serialization can be
     /// computed at any point, say, after the changes in the Param objects.
     ModelSerializer m_serializerfn;
+
+    /// The attached data of the underlying model function whose type is known at runtime only.
+    Any m_attacheddata;
 };
 
 /// Return a reaction thermodynamic model resulting from chaining other models.
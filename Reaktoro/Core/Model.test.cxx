@@ -133,4 +133,37 @@ TEST_CASE("Testing Model class", "[Model]")
 
         CHECK( model(x, y) == Approx(5.0) );
     }
+
+    SECTION("Using Model::withMemoization")
+    {
+        auto counter = std::make_shared<int>(0); // a counter for how many times calcfn below has been fully evaluated
+
+        auto calcfn = [=](real x, real y)
+        {
+            ++(*counter);
+            return K*x*y;
+        };
+
+        auto model = Model<real(real, real)>(calcfn, params).withMemoization();
+
+        const auto x = 3.0;
+        const auto y = 7.0;
+
+        CHECK( model(x, y) == Approx(3.0 * x * y) );
+        CHECK( model(x, y) == Approx(3.0 * x * y) );
+        CHECK( *counter == 1 ); // second call used cached result
+
+        K = 5.0; // changing the parameter must invalidate the cached result
+
+        CHECK( model(x, y) == Approx(5.0 * x * y) );
+        CHECK( *counter == 2 );
+
+        K.value(5.0); // assigning the same value also renews the version of the parameter
+
+        CHECK( model(x, y) == Approx(5.0 * x * y) );
+        CHECK( *counter == 3 );
+
+        CHECK( model(x, y) == Approx(5.0 * x * y) );
+        CHECK( *counter == 3 );
+    }
 }
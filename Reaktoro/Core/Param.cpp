@@ -17,6 +17,9 @@
 
 #include "Param.hpp"
 
+// C++ includes
+#include <atomic>
+
 namespace Reaktoro {
 namespace {
 
@@ -31,6 +34,13 @@ auto warningIfOutOfBounds(const Param& param, const real& val) -> void
         "either its lower bound (", lb, ") or its upper bound (", ub, ").")
 }
 
+/// Return a new version number for a parameter whose value is changed.
+auto nextParamVersion() -> Index
+{
+    static std::atomic<Index> counter = 0;
+    return ++counter;
+}
+
 } // namespace
 
 /// The type containing the data members of the parameter.
@@ -50,6 +60,9 @@ struct Param::Impl
 
     /// The boolean flag that indicates if this parameter is constant.
     bool isconst = false;
+
+    /// The version of the parameter value (see Param::version).
+    Index version = nextParamVersion();
 };
 
 Param::Param()
@@ -72,12 +85,14 @@ auto Param::clone() const -> Param
 {
     Param param;
     *param.pimpl = *pimpl;
+    param.pimpl->version = nextParamVersion();
     return param;
 }
 
 auto Param::assign(const Param& other) -> Param&
 {
     *pimpl = *other.pimpl;
+    pimpl->version = nextParamVersion();
     return *this;
 }
 
@@ -85,6 +100,7 @@ auto Param::value(const real& val) -> Param&
 {
     warningIfOutOfBounds(*this, val);
     pimpl->value = val;
+    pimpl->version = nextParamVersion();
     return *this;
 }
 
@@ -98,6 +114,17 @@ auto Param::value() -> real&
     return pimpl->value;
 }
 
+auto Param::markModified() -> Param&
+{
+    pimpl->version = nextParamVersion();
+    return *this;
+}
+
+auto Param::version() const -> Index
+{
+    return pimpl->version;
+}
+
 auto Param::id(String id) -> Param&
 {
     pimpl->id = id;
@@ -56,8 +56,27 @@ public:
     auto value() const -> const real&;
 
     /// Return the value of the parameter.
+    /// The version of the parameter is not updated with this call. If the
+    /// returned mutable reference is used to change the value of the parameter
+    /// (e.g., when seeding it for automatic differentiation), call method
+    /// @ref markModified afterwards.
     auto value() -> real&;
 
+    /// Update the version of the parameter after its value was changed via a mutable reference.
+    auto markModified() -> Param&;
+
+    /// Return the version of the parameter value.
+    /// The version is a number assigned to the parameter each time its value
+    /// is changed with methods @ref value(const real&), @ref assign,
+    /// @ref clone, assignment operators, or @ref markModified. This number is
+    /// unique across all Param objects and increases with each new assignment,
+    /// so that a change in any of several parameters can be detected by
+    /// checking if their maximum version is greater than the one recorded
+    /// before. Note that, as with its value, the version of a parameter is not
+    /// synchronized across threads; a parameter must not be changed in one
+    /// thread while it is used in another.
+    auto version() const -> Index;
+
     /// Set the unique identifier of the parameter.
     auto id(String id) -> Param&;
 
@@ -91,7 +110,7 @@ public:
     /// Convert this Param object into its value type.
     operator const real&() const;
 
-    /// Convert this Param object into its value type.
+    /// Convert this Param object into its value type (call method @ref markModified if the value is changed via the returned reference).
     operator real&();
 
     /// Convert this Param object into its value type.
@@ -179,6 +198,42 @@ struct MemoizationTraits<Param>
     using CacheType = real;
 };
 
+/// Specialize MemoizationTraits for Vec<Param>.
+/// The versions of the parameters are cached instead of their values. Since a
+/// version number is unique across all Param objects and is renewed whenever a
+/// parameter value is changed, equal versions imply the same
+/// parameters with unchanged values. This avoids comparing and copying the
+/// values of the parameters in each call of a memoized function (e.g., the
+/// memoized Model objects in @ref Model::withMemoization), and also detects
+/// changes in the parameters made externally, which a cache of Param objects
+/// (sharing their data with the original ones) cannot do.
+template<>
+struct MemoizationTraits<Vec<Param>>
+{
+    using Type = Vec<Param>;
+
+    using CacheType = Vec<Index>;
+
+    /// Return true if the cached versions are the current versions of the parameters.
+    static auto equal(const CacheType& a, const Type& b)
+    {
+        if(a.size() != b.size())
+            return false;
+        for(Index i = 0; i < a.size(); ++i)
+            if(a[i] != b[i].version())
+                return false;
+        return true;
+    }
+
+    /// Cache the current versions of the parameters.
+    static auto assign(CacheType& a, const Type& b)
+    {
+        a.resize(b.size());
+        for(Index i = 0; i < b.size(); ++i)
+            a[i] = b[i].version();
+    }
+};
+
 } // namespace Reaktoro
 
 //======================================================================
@@ -191,6 +246,7 @@ template<size_t order, typename U>
 auto seed(Param& param, U&& seedval)
 {
     autodiff::detail::seed<order>(param.value(), seedval);
+    param.markModified();
 }
 
 } // namespace Reaktoro
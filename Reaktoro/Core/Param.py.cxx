@@ -39,6 +39,9 @@ void exportParam(py::module& m)
         .def("value", py::overload_cast<>(&Param::value, py::const_), return_internal_ref)
         .def("value", py::overload_cast<>(&Param::value), return_internal_ref)
 
+        .def("markModified", &Param::markModified, return_internal_ref)
+        .def("version", &Param::version)
+
         .def("id", py::overload_cast<String>(&Param::id), return_internal_ref)
         .def("id", py::overload_cast<>(&Param::id, py::const_), return_internal_ref)
 
@@ -18,6 +18,9 @@
 // Catch includes
 #include <catch2/catch.hpp>
 
+// C++ includes
+#include <utility>
+
 // Reaktoro includes
 #include <Reaktoro/Core/Param.hpp>
 using namespace Reaktoro;
@@ -98,4 +101,50 @@ TEST_CASE("Testing Param class", "[Param]")
     CHECK( x.isconst() == true );
 
     CHECK( autodiff::detail::Order<Param> == 1 );
+
+    //======================================================================
+    // Testing the version of the parameter value
+    //======================================================================
+
+    Param p(1.0);
+    Param q(2.0);
+
+    CHECK( p.version() != q.version() );
+
+    auto const pversion = std::as_const(p).version();
+    auto const qversion = std::as_const(q).version();
+
+    CHECK( std::as_const(p).value() == 1.0 );
+    CHECK( p.version() == pversion ); // reading the value of p does not change its version
+
+    p = 3.0;
+    CHECK( p.version() > pversion );
+    CHECK( p.version() > qversion ); // the most recently changed parameter has the greatest version
+
+    auto const pversion2 = p.version();
+    p.value(4.0);
+    CHECK( p.version() > pversion2 );
+
+    Param r = p; // r points to p
+    auto const pversion3 = p.version();
+    r.value(5.0);
+    CHECK( p.version() > pversion3 ); // changing r changes the version of p
+
+    auto const pversion4 = p.version();
+    CHECK( p.value() == 5.0 );
+    CHECK( static_cast<real&>(p) == 5.0 );
+    CHECK( p.version() == pversion4 ); // accessing a mutable reference to the value of p does not change its version
+
+    p.value() = 6.0;
+    p.markModified();
+    CHECK( p.version() > pversion4 );
+
+    auto const pversion5 = p.version();
+    seed<1>(p, 1.0); // seeding uses a mutable reference to the value of p and marks it as modified
+    CHECK( p.version() > pversion5 );
+
+    auto const qversion2 = q.version();
+    q.assign(p);
+    CHECK( q.version() > qversion2 );
+    CHECK( q.version() > p.version() );
 }
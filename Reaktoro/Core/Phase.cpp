@@ -60,6 +60,9 @@ struct Phase::Impl
 
     /// The molar masses of the species in the phase.
     ArrayXd species_molar_masses;
+
+    /// The function that computes the standard thermodynamic properties of all species in the phase at once.
+    StandardThermoModelBatch std_thermo_model_batch;
 };
 
 Phase::Phase()
@@ -87,6 +90,7 @@ auto Phase::withSpecies(SpeciesList species) -> Phase
     copy.pimpl->elements = species.elements();
     copy.pimpl->species = std::move(species);
     copy.pimpl->species_molar_masses = detail::molarMasses(copy.pimpl->species);
+    copy.pimpl->std_thermo_model_batch = createStandardThermoModelBatch(copy.pimpl->species);
     return copy;
 }
 
@@ -161,6 +165,11 @@ auto Phase::idealActivityModel() const -> const ActivityModel&
     return pimpl->ideal_activity_model;
 }
 
+auto Phase::standardThermoModelBatch() const -> const StandardThermoModelBatch&
+{
+    return pimpl->std_thermo_model_batch;
+}
+
 auto operator<(const Phase& lhs, const Phase& rhs) -> bool
 {
     return lhs.name() < rhs.name();
@@ -22,6 +22,7 @@
 #include <Reaktoro/Core/ActivityProps.hpp>
 #include <Reaktoro/Core/ActivityModel.hpp>
 #include <Reaktoro/Core/SpeciesList.hpp>
+#include <Reaktoro/Core/StandardThermoModelBatch.hpp>
 #include <Reaktoro/Core/StateOfMatter.hpp>
 
 namespace Reaktoro {
@@ -83,6 +84,10 @@ public:
     /// Return the function that computes ideal activity properties of the phase.
     auto idealActivityModel() const -> const ActivityModel&;
 
+    /// Return the function that computes the standard thermodynamic properties of all species in the phase at once.
+    /// @see createStandardThermoModelBatch
+    auto standardThermoModelBatch() const -> const StandardThermoModelBatch&;
+
 private:
     struct Impl;
 
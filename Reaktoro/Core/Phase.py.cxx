@@ -42,5 +42,6 @@ void exportPhase(py::module& m)
         .def("speciesMolarMasses", &Phase::speciesMolarMasses, return_internal_ref)
         .def("activityModel", &Phase::activityModel, return_internal_ref)
         .def("idealActivityModel", &Phase::idealActivityModel, return_internal_ref)
+        .def("standardThermoModelBatch", &Phase::standardThermoModelBatch, return_internal_ref)
         ;
 }
@@ -39,6 +39,7 @@ PhaseList::PhaseList(const Vec<Phase>& phases)
 auto PhaseList::append(const Phase& phase) -> void
 {
     m_phases.push_back(phase);
+    m_names_index.append(m_phases.size() - 1, [&](Index i) { return m_phases[i].name(); });
 }
 
 auto PhaseList::data() const -> const Vec<Phase>&
@@ -75,6 +76,7 @@ auto PhaseList::operator[](Index i) const -> const Phase&
 
 auto PhaseList::operator[](Index i) -> Phase&
 {
+    resetIndices();
     return m_phases[i];
 }
 
@@ -85,7 +87,7 @@ auto PhaseList::find(const String& name) const -> Index
 
 auto PhaseList::findWithName(const String& name) const -> Index
 {
-    return indexfn(m_phases, RKT_LAMBDA(p, p.name() == name));
+    return m_names_index.find(name, size(), [&](Index i) { return m_phases[i].name(); });
 }
 
 auto PhaseList::findWithSpecies(Index index) const -> Index
@@ -249,6 +251,7 @@ auto PhaseList::indicesSpeciesInPhases(const Indices& iphases) const -> Indices
 
 PhaseList::operator Vec<Phase>&()
 {
+    resetIndices();
     return m_phases;
 }
 
@@ -257,6 +260,11 @@ PhaseList::operator Vec<Phase>const&() const
     return m_phases;
 }
 
+auto PhaseList::resetIndices() -> void
+{
+    m_names_index.reset();
+}
+
 auto operator+(const PhaseList& a, const PhaseList& b) -> PhaseList
 {
     return concatenate(a, b);
@@ -18,6 +18,7 @@
 #pragma once
 
 // Reaktoro includes
+#include <Reaktoro/Common/HashIndex.hpp>
 #include <Reaktoro/Common/Types.hpp>
 #include <Reaktoro/Core/Phase.hpp>
 #include <Reaktoro/Core/SpeciesList.hpp>
@@ -137,29 +138,36 @@ private:
     /// The phases stored in the list.
     Vec<Phase> m_phases;
 
+    /// The hash index of the phase names.
+    HashIndex<String> m_names_index;
+
+    /// Reset the hash indices used for lookups (needed whenever the items may change).
+    auto resetIndices() -> void;
+
 public:
     /// Construct an PhaseList object with given begin and end iterators.
     template<typename InputIterator>
     PhaseList(InputIterator begin, InputIterator end) : m_phases(begin, end) {}
 
     /// Return begin const iterator of this PhaseList instance (for STL compatibility reasons).
+    /// @note Only const iterators are provided, so that iterating over the list keeps its hash indices (use operator[] to change a phase).
     auto begin() const { return m_phases.begin(); }
 
-    /// Return begin iterator of this PhaseList instance (for STL compatibility reasons).
-    auto begin() { return m_phases.begin(); }
-
     /// Return end const iterator of this PhaseList instance (for STL compatibility reasons).
     auto end() const { return m_phases.end(); }
 
-    /// Return end iterator of this PhaseList instance (for STL compatibility reasons).
-    auto end() { return m_phases.end(); }
+    /// Return begin const iterator of this PhaseList instance (for STL compatibility reasons).
+    auto cbegin() const { return m_phases.cbegin(); }
+
+    /// Return end const iterator of this PhaseList instance (for STL compatibility reasons).
+    auto cend() const { return m_phases.cend(); }
 
     /// Append a new Phase at the back of the container (for STL compatibility reasons).
     auto push_back(const Phase& species) -> void { append(species); }
 
     /// Insert a container of Phase objects into this PhaseList instance (for STL compatibility reasons).
     template<typename Iterator, typename InputIterator>
-    auto insert(Iterator pos, InputIterator begin, InputIterator end) -> void { m_phases.insert(pos, begin, end); }
+    auto insert(Iterator pos, InputIterator begin, InputIterator end) -> void { resetIndices(); m_phases.insert(pos, begin, end); }
 
     /// The type of the value stored in a PhaseList (for STL compatibility reasons).
     using value_type = Phase;
@@ -18,9 +18,24 @@
 #include "Phases.hpp"
 
 // Reaktoro includes
+#include <Reaktoro/Common/Algorithms.hpp>
 #include <Reaktoro/Common/Exception.hpp>
 
 namespace Reaktoro {
+namespace {
+
+/// Return a filter of species records with given names (if non-empty) or composed only of given elements otherwise.
+auto speciesCandidateFilter(Strings const& names, Strings const& symbols) -> Fn<bool(SpeciesRecord const&)>
+{
+    if(names.size())
+    {
+        const Set<String> nameset(names.begin(), names.end());
+        return [=](SpeciesRecord const& record) { return nameset.count(record.name) != 0; };
+    }
+    return [=](SpeciesRecord const& record) { return contained(record.elements, symbols); };
+}
+
+} // namespace
 
 auto speciate(const StringList& symbols) -> Speciate
 {
@@ -158,12 +173,15 @@ auto GeneralPhase::convert(const Database& db, const Strings& elements) const ->
         "GeneralPhase::convert requires an AggregateState value to be specified.\n"
         "Use method GeneralPhase::setAggregateState to fix this.");
 
-    auto species = db.speciesWithAggregateState(aggregatestate);
+    // Consider only species that can be selected below, so that species in the database not yet created are not created needlessly.
+    const auto candidate = speciesCandidateFilter(names, symbols.size() ? symbols : elements);
+
+    auto species = db.speciesWithAggregateState(aggregatestate, candidate);
 
     // If additional aggregate states provided, consider also other species in the database
     for(auto other_aggregate_state : other_aggregate_states)
     {
-        auto other_species = db.speciesWithAggregateState(other_aggregate_state);
+        auto other_species = db.speciesWithAggregateState(other_aggregate_state, candidate);
         if(other_species.size())
             species = concatenate(species, other_species);
     }
@@ -298,12 +316,15 @@ auto GeneralPhasesGenerator::convert(const Database& db, const Strings& elements
         "GeneralPhasesGenerator::convert requires an AggregateState value to be specified. "
         "Use method GeneralPhasesGenerator::set(AggregateState) to fix this.");
 
-    auto species = db.speciesWithAggregateState(aggregatestate);
+    // Consider only species that can be selected below, so that species in the database not yet created are not created needlessly.
+    const auto candidate = speciesCandidateFilter(names, symbols.size() ? symbols : elements);
+
+    auto species = db.speciesWithAggregateState(aggregatestate, candidate);
 
     // If additional aggregate states provided, consider also other species in the database
     for(auto other_aggregate_state : other_aggregate_states)
     {
-        auto other_species = db.speciesWithAggregateState(other_aggregate_state);
+        auto other_species = db.speciesWithAggregateState(other_aggregate_state, candidate);
         if(other_species.size())
             species = concatenate(species, other_species);
     }
@@ -379,7 +400,7 @@ auto Phases::convert() const -> Vec<Phase>
             if(phase.elements().size())
                 result = merge(result, phase.elements());
             if(phase.species().size())
-                for(auto&& s : db.species().withNames(phase.species()))
+                for(auto&& s : db.speciesWithFilter(speciesCandidateFilter(phase.species(), {})).withNames(phase.species()))
                     result = merge(result, s.elements().symbols());
             if(phase.aggregateState() == AggregateState::Aqueous)
                 result = merge(result, Strings{"H", "O"}); // ensure both H and O are considered in case there is aqueous phases
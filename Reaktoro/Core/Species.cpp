@@ -63,6 +63,9 @@ struct Species::Impl
     /// The chemical formula of the species such as `H2O`, `O2`, `H+`, `CO3--`, `CaMg(CO3)2`.
     String formula;
 
+    /// The chemical formula of the species with its elements and charge (interned at creation, see ChemicalFormula).
+    ChemicalFormula chemical_formula;
+
     /// The name of the species and its chemical formula if name does not contain it (e.g., `Calcite :: CaCO3`).
     String repr;
 
@@ -103,7 +106,9 @@ struct Species::Impl
       elements(formula.elements()),
       charge(formula.charge()),
       aggregate_state(identifyAggregateState(formula))
-    {}
+    {
+        updateChemicalFormula();
+    }
 
     /// Construct a Species::Impl instance with given attributes
     Impl(const Attribs& attribs)
@@ -132,6 +137,7 @@ struct Species::Impl
         charge = attribs.charge;
         aggregate_state = attribs.aggregate_state;
         tags = attribs.tags;
+        updateChemicalFormula();
         if(attribs.std_thermo_model.initialized())
         {
             propsfn = attribs.std_thermo_model;
@@ -144,6 +150,12 @@ struct Species::Impl
             propsfn = propsfn.withMemoization();
         }
     }
+
+    /// Update the chemical formula of the species after a change in its formula, elements or charge.
+    auto updateChemicalFormula() -> void
+    {
+        chemical_formula = ChemicalFormula(formula, elements, charge);
+    }
 };
 
 Species::Species()
@@ -178,6 +190,7 @@ auto Species::withFormula(String formula) const -> Species
     Species copy = clone();
     copy.pimpl->formula = std::move(formula);
     copy.pimpl->repr = detail::speciesNameFormula(copy.pimpl->name, copy.pimpl->formula);
+    copy.pimpl->updateChemicalFormula();
     return copy;
 }
 
@@ -192,6 +205,7 @@ auto Species::withElements(ElementalComposition elements) const -> Species
 {
     Species copy = clone();
     copy.pimpl->elements = std::move(elements);
+    copy.pimpl->updateChemicalFormula();
     return copy;
 }
 
@@ -199,6 +213,7 @@ auto Species::withCharge(double charge) const -> Species
 {
     Species copy = clone();
     copy.pimpl->charge = charge;
+    copy.pimpl->updateChemicalFormula();
     return copy;
 }
 
@@ -252,7 +267,7 @@ auto Species::name() const -> String
 
 auto Species::formula() const -> ChemicalFormula
 {
-    return ChemicalFormula(pimpl->formula, pimpl->elements, pimpl->charge);
+    return pimpl->chemical_formula;
 }
 
 auto Species::repr() const -> String
@@ -65,6 +65,9 @@ TEST_CASE("Testing Species class", "[Species]")
         CHECK( species.attachedData().has_value() );
         CHECK( species.attachedData().type() == typeid(String) );
         CHECK( std::any_cast<String>(species.attachedData()) == "SomeData" );
+        CHECK( species.formula().charge() == 2.0 );
+        CHECK( species.formula().elements().size() == 3 );
+        CHECK( &species.formula().elements() == &species.formula().elements() ); // the formula is created once, not at every call
     }
 
     SECTION("Testing the standard thermodynamic property functionality of the chemical species")
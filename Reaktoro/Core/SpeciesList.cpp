@@ -17,6 +17,9 @@
 
 #include "SpeciesList.hpp"
 
+// C++ includes
+#include <cstdio>
+
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
 #include <Reaktoro/Common/Exception.hpp>
@@ -25,6 +28,26 @@
 #include <Reaktoro/Core/ChemicalFormula.hpp>
 
 namespace Reaktoro {
+namespace {
+
+/// Return a string representation of a chemical formula that is the same for all equivalent formulas (see ChemicalFormula::equivalent).
+/// For example, formulas `Ca++` and `Ca+2` have the same canonical form.
+auto canonicalFormula(ChemicalFormula const& formula) -> String
+{
+    auto elements = formula.elements();
+    std::sort(elements.begin(), elements.end());
+    String res;
+    char number[32];
+    for(auto const& [symbol, coeff] : elements)
+    {
+        std::snprintf(number, sizeof(number), "%a", coeff + 0.0); // exact hexadecimal representation of coeff (with -0 as 0)
+        res += symbol + ":" + number + ";";
+    }
+    std::snprintf(number, sizeof(number), "%a", formula.charge() + 0.0);
+    return res + "Z:" + number;
+}
+
+} // namespace
 
 SpeciesList::SpeciesList()
 {}
@@ -44,6 +67,10 @@ SpeciesList::SpeciesList(const StringList& formulas)
 auto SpeciesList::append(const Species& species) -> void
 {
     m_species.push_back(species);
+    const auto i = m_species.size() - 1;
+    m_names_index.append(i, [&](Index j) { return m_species[j].name(); });
+    m_formulas_index.append(i, [&](Index j) { return canonicalFormula(m_species[j].formula()); });
+    m_substances_index.append(i, [&](Index j) { return m_species[j].substance(); });
 }
 
 auto SpeciesList::data() const -> const Vec<Species>&
@@ -80,6 +107,7 @@ auto SpeciesList::operator[](Index i) const -> const Species&
 
 auto SpeciesList::operator[](Index i) -> Species&
 {
+    resetIndices();
     return m_species[i];
 }
 
@@ -90,17 +118,19 @@ auto SpeciesList::find(const String& name) const -> Index
 
 auto SpeciesList::findWithName(const String& name) const -> Index
 {
-    return indexfn(m_species, RKT_LAMBDA(s, s.name() == name));
+    return m_names_index.find(name, size(), [&](Index i) { return m_species[i].name(); });
 }
 
 auto SpeciesList::findWithFormula(const ChemicalFormula& formula) const -> Index
 {
-    return indexfn(m_species, RKT_LAMBDA(s, formula.equivalent(s.formula())));
+    if(size() < HashIndex<String>::minsize)
+        return indexfn(m_species, RKT_LAMBDA(s, formula.equivalent(s.formula())));
+    return m_formulas_index.find(canonicalFormula(formula), size(), [&](Index i) { return canonicalFormula(m_species[i].formula()); });
 }
 
 auto SpeciesList::findWithSubstance(const String& substance) const -> Index
 {
-    return indexfn(m_species, RKT_LAMBDA(s, s.substance() == substance));
+    return m_substances_index.find(substance, size(), [&](Index i) { return m_species[i].substance(); });
 }
 
 auto SpeciesList::index(const String& name) const -> Index
@@ -217,6 +247,7 @@ auto SpeciesList::withElementsOf(const StringList& formulas) const -> SpeciesLis
 
 SpeciesList::operator Vec<Species>&()
 {
+    resetIndices();
     return m_species;
 }
 
@@ -225,6 +256,13 @@ SpeciesList::operator const Vec<Species>&() const
     return m_species;
 }
 
+auto SpeciesList::resetIndices() -> void
+{
+    m_names_index.reset();
+    m_formulas_index.reset();
+    m_substances_index.reset();
+}
+
 auto operator+(const SpeciesList& a, const SpeciesList& b) -> SpeciesList
 {
     return concatenate(a, b);
@@ -18,6 +18,7 @@
 #pragma once
 
 // Reaktoro includes
+#include <Reaktoro/Common/HashIndex.hpp>
 #include <Reaktoro/Common/Types.hpp>
 #include <Reaktoro/Core/ElementList.hpp>
 #include <Reaktoro/Core/Species.hpp>
@@ -169,29 +170,42 @@ private:
     /// The species stored in the list.
     Vec<Species> m_species;
 
+    /// The hash index of the species names.
+    HashIndex<String> m_names_index;
+
+    /// The hash index of the species formulas (in a canonical form, see findWithFormula).
+    HashIndex<String> m_formulas_index;
+
+    /// The hash index of the species substance names.
+    HashIndex<String> m_substances_index;
+
+    /// Reset the hash indices used for lookups (needed whenever the items may change).
+    auto resetIndices() -> void;
+
 public:
     /// Construct an SpeciesList object with given begin and end iterators.
     template<typename InputIterator>
     SpeciesList(InputIterator begin, InputIterator end) : m_species(begin, end) {}
 
     /// Return begin const iterator of this SpeciesList instance (for STL compatibility reasons).
+    /// @note Only const iterators are provided, so that iterating over the list keeps its hash indices (use operator[] to change a species).
     auto begin() const { return m_species.begin(); }
 
-    /// Return begin iterator of this SpeciesList instance (for STL compatibility reasons).
-    auto begin() { return m_species.begin(); }
-
     /// Return end const iterator of this SpeciesList instance (for STL compatibility reasons).
     auto end() const { return m_species.end(); }
 
-    /// Return end iterator of this SpeciesList instance (for STL compatibility reasons).
-    auto end() { return m_species.end(); }
+    /// Return begin const iterator of this SpeciesList instance (for STL compatibility reasons).
+    auto cbegin() const { return m_species.cbegin(); }
+
+    /// Return end const iterator of this SpeciesList instance (for STL compatibility reasons).
+    auto cend() const { return m_species.cend(); }
 
     /// Append a new Species at the back of the container (for STL compatibility reasons).
     auto push_back(const Species& species) -> void { append(species); }
 
     /// Insert a container of Species objects into this SpeciesList instance (for STL compatibility reasons).
     template<typename Iterator, typename InputIterator>
-    auto insert(Iterator pos, InputIterator begin, InputIterator end) -> void { m_species.insert(pos, begin, end); }
+    auto insert(Iterator pos, InputIterator begin, InputIterator end) -> void { resetIndices(); m_species.insert(pos, begin, end); }
 
     /// The type of the value stored in a SpeciesList (for STL compatibility reasons).
     using value_type = Species;
@@ -512,3 +512,40 @@ TEST_CASE("Testing SpeciesList", "[SpeciesList]")
     for(auto [i, species] : enumerate(specieslist))
         REQUIRE( species.name() == specieslist[i].name() );
 }
+
+TEST_CASE("Testing SpeciesList lookups using hash indices", "[SpeciesList]")
+{
+    // Lists with at least HashIndex::minsize species are searched with hash tables
+    SpeciesList specieslist = SpeciesList("H2O H+ OH- H2 O2 Na+ Cl- NaCl Ca++ Ca+2 Mg+2 CO2 HCO3- CO3-2 CH4 N2 NH3 SiO2");
+
+    REQUIRE( specieslist.size() >= HashIndex<String>::minsize );
+
+    CHECK( specieslist.findWithName("H2O")  == 0 );
+    CHECK( specieslist.findWithName("SiO2") == 17 );
+    CHECK( specieslist.findWithName("XyZ")  == specieslist.size() );
+
+    CHECK( specieslist.findWithSubstance("CO2") == 11 );
+
+    CHECK( specieslist.findWithFormula("Ca++") == 8 ); // the first of the equivalent formulas Ca++ and Ca+2
+    CHECK( specieslist.findWithFormula("Ca+2") == 8 );
+    CHECK( specieslist.findWithFormula("HCO3-") == 12 );
+    CHECK( specieslist.findWithFormula("OH") == specieslist.size() );
+
+    // Appending a species after the hash tables have been built
+    specieslist.append(Species("CaCO3").withName("Calcite"));
+
+    CHECK( specieslist.findWithName("Calcite") == 18 );
+    CHECK( specieslist.findWithFormula("CaCO3") == 18 );
+
+    // Changing a species through a non-const reference
+    specieslist[0] = Species("H2O").withName("Water");
+
+    CHECK( specieslist.findWithName("Water") == 0 );
+    CHECK( specieslist.findWithName("H2O") == specieslist.size() );
+
+    // Copies of the list have the same lookups
+    SpeciesList copy = specieslist;
+
+    CHECK( copy.findWithName("Calcite") == 18 );
+    CHECK( copy.findWithName("Water") == 0 );
+}
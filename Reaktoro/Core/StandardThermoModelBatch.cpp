@@ -0,0 +1,266 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "StandardThermoModelBatch.hpp"
+
+// C++ includes
+#include <atomic>
+#include <mutex>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/Memoization.hpp>
+#include <Reaktoro/Core/SpeciesList.hpp>
+#include <Reaktoro/Models/StandardThermoModels/StandardThermoModelHKF.hpp>
+#include <Reaktoro/Models/StandardThermoModels/StandardThermoModelHollandPowell.hpp>
+#include <Reaktoro/Models/StandardThermoModels/StandardThermoModelMaierKelley.hpp>
+#include <Reaktoro/Models/StandardThermoModels/StandardThermoModelNasa.hpp>
+
+namespace Reaktoro {
+namespace {
+
+/// Used to store the arguments and results of the last evaluation of a memoized StandardThermoModelBatch object.
+struct StandardThermoModelBatchCache
+{
+    /// The temperature, pressure and versions of the parameters used in the last evaluation.
+    Tuple<real, real, detail::CacheType<Vec<Param>>> args;
+
+    /// The standard thermodynamic properties of the species computed in the last evaluation.
+    ArrayXr G0, H0, V0, Cp0, VT0, VP0;
+
+    /// True if the memoized object has not yet been evaluated.
+    bool firsttime = true;
+};
+
+/// Collect the attached parameters of type `Params` of the standard thermodynamic models of consecutive species starting at index @p i.
+/// @param species The species whose standard thermodynamic models are checked
+/// @param[in,out] i The index of the first species, which is moved past the last species whose model has parameters of type `Params`
+template<typename Params>
+auto collectAttachedParams(const SpeciesList& species, Index& i) -> Vec<Params>
+{
+    Vec<Params> params;
+    for(; i < species.size(); ++i)
+    {
+        const auto* p = std::any_cast<Params>(&species[i].standardThermoModel().attachedData());
+        if(p == nullptr)
+            break;
+        params.push_back(*p);
+    }
+    return params;
+}
+
+} // namespace
+
+struct StandardThermoModelBatch::Impl
+{
+    /// The number of species in the batch.
+    Index size = 0;
+
+    /// The Param objects of all species in the batch.
+    Vec<Param> params;
+
+    /// The function that updates the values of the parameters used in #evalfn.
+    Fn<void()> updatefn;
+
+    /// The function that calculates the standard thermodynamic properties of all species in the batch.
+    StandardThermoModelBatchFn evalfn;
+
+    /// The largest version of the Param objects in #params when #updatefn was last called.
+    std::atomic<Index> versionlast = -1;
+
+    /// The mutex used to ensure #updatefn is called by a single thread at a time.
+    std::mutex mutex;
+
+    Impl()
+    {}
+
+    Impl(Index size, const Vec<Param>& params, const Fn<void()>& updatefn, const StandardThermoModelBatchFn& evalfn)
+    : size(size), params(params), updatefn(updatefn), evalfn(evalfn)
+    {
+        update();
+    }
+
+    /// Return the largest version of the Param objects in #params.
+    auto latestVersion() const -> Index
+    {
+        Index version = 0;
+        for(const auto& param : params)
+            version = std::max(version, param.version());
+        return version;
+    }
+
+    /// Update the values of the parameters used in #evalfn if any Param object has changed since the last update.
+    auto update() -> void
+    {
+        if(!updatefn)
+            return;
+
+        const auto version = latestVersion();
+
+        if(version == versionlast.load(std::memory_order_acquire))
+            return;
+
+        std::lock_guard<std::mutex> lock(mutex);
+
+        if(version == versionlast.load(std::memory_order_relaxed))
+            return;
+
+        updatefn();
+
+        versionlast.store(version, std::memory_order_release);
+    }
+};
+
+StandardThermoModelBatch::StandardThermoModelBatch()
+: pimpl(new Impl())
+{}
+
+StandardThermoModelBatch::StandardThermoModelBatch(Index size, const Vec<Param>& params, const Fn<void()>& updatefn, const StandardThermoModelBatchFn& evalfn)
+: pimpl(new Impl(size, params, updatefn, evalfn))
+{}
+
+auto StandardThermoModelBatch::withMemoization() const -> StandardThermoModelBatch
+{
+    const auto batch = *this;
+    auto caches = std::make_shared<detail::PerThreadCache<StandardThermoModelBatchCache>>();
+
+    auto evalfn = [batch, caches](const real& T, const real& P, ArrayXrRef G0, ArrayXrRef H0, ArrayXrRef V0, ArrayXrRef Cp0, ArrayXrRef VT0, ArrayXrRef VP0)
+    {
+        if(Memoization::isDisabled())
+            return batch.eval(T, P, G0, H0, V0, Cp0, VT0, VP0);
+
+        auto& cache = caches->local();
+        const auto args = std::tie(T, P, batch.params());
+
+        if(!cache.firsttime && detail::sameValues(cache.args, args))
+        {
+            G0  = cache.G0;
+            H0  = cache.H0;
+            V0  = cache.V0;
+            Cp0 = cache.Cp0;
+            VT0 = cache.VT0;
+            VP0 = cache.VP0;
+            return;
+        }
+
+        batch.eval(T, P, G0, H0, V0, Cp0, VT0, VP0);
+
+        cache.G0  = G0;
+        cache.H0  = H0;
+        cache.V0  = V0;
+        cache.Cp0 = Cp0;
+        cache.VT0 = VT0;
+        cache.VP0 = VP0;
+        detail::assignValues(cache.args, args);
+        cache.firsttime = false;
+    };
+
+    return StandardThermoModelBatch(size(), params(), {}, evalfn);
+}
+
+auto StandardThermoModelBatch::size() const -> Index
+{
+    return pimpl->size;
+}
+
+auto StandardThermoModelBatch::params() const -> const Vec<Param>&
+{
+    return pimpl->params;
+}
+
+auto StandardThermoModelBatch::eval(const real& T, const real& P, ArrayXrRef G0, ArrayXrRef H0, ArrayXrRef V0, ArrayXrRef Cp0, ArrayXrRef VT0, ArrayXrRef VP0) const -> void
+{
+    const auto size = pimpl->size;
+
+    errorif(G0.size() != size || H0.size() != size || V0.size() != size || Cp0.size() != size || VT0.size() != size || VP0.size() != size,
+        "Expecting arrays with ", size, " entries in StandardThermoModelBatch::eval.");
+
+    pimpl->update();
+
+    if(pimpl->evalfn)
+        pimpl->evalfn(T, P, G0, H0, V0, Cp0, VT0, VP0);
+}
+
+auto createStandardThermoModelBatch(const SpeciesList& species) -> StandardThermoModelBatch
+{
+    /// Used to represent consecutive species evaluated at once.
+    struct Segment
+    {
+        /// The index of the first species in the segment.
+        Index offset;
+
+        /// The object that evaluates the standard thermodynamic models of the species in the segment.
+        StandardThermoModelBatch batch;
+    };
+
+    const auto size = species.size();
+
+    Vec<Segment> segments;             // the groups of consecutive species evaluated at once
+    Indices others;                    // the indices of the species evaluated with their own models
+    Vec<StandardThermoModel> models;   // the standard thermodynamic models of the species in `others`
+    Vec<Param> params;                 // the Param objects of the standard thermodynamic models of all species
+
+    for(Index i = 0; i < size;)
+    {
+        const auto offset = i;
+
+        if(auto hkf = collectAttachedParams<StandardThermoModelParamsHKF>(species, i); !hkf.empty())
+            segments.push_back({ offset, StandardThermoModelHKFBatch(hkf) });
+        else if(auto hp = collectAttachedParams<StandardThermoModelParamsHollandPowell>(species, i); !hp.empty())
+            segments.push_back({ offset, StandardThermoModelHollandPowellBatch(hp) });
+        else if(auto mk = collectAttachedParams<StandardThermoModelParamsMaierKelley>(species, i); !mk.empty())
+            segments.push_back({ offset, StandardThermoModelMaierKelleyBatch(mk) });
+        else if(auto nasa = collectAttachedParams<StandardThermoModelParamsNasa>(species, i); !nasa.empty())
+            segments.push_back({ offset, StandardThermoModelNasaBatch(nasa) });
+        else
+        {
+            others.push_back(i);
+            models.push_back(species[i].standardThermoModel());
+            ++i;
+        }
+    }
+
+    for(const auto& s : species)
+        for(const auto& param : s.standardThermoModel().params())
+            params.push_back(param);
+
+    auto evalfn = [segments, others, models](const real& T, const real& P, ArrayXrRef G0, ArrayXrRef H0, ArrayXrRef V0, ArrayXrRef Cp0, ArrayXrRef VT0, ArrayXrRef VP0)
+    {
+        for(const auto& [offset, batch] : segments)
+        {
+            const auto n = batch.size();
+            batch.eval(T, P, G0.segment(offset, n), H0.segment(offset, n), V0.segment(offset, n), Cp0.segment(offset, n), VT0.segment(offset, n), VP0.segment(offset, n));
+        }
+
+        StandardThermoProps aux;
+        for(auto k = 0; k < others.size(); ++k)
+        {
+            const auto i = others[k];
+            aux = models[k](T, P);
+            G0[i]  = aux.G0;
+            H0[i]  = aux.H0;
+            V0[i]  = aux.V0;
+            Cp0[i] = aux.Cp0;
+            VT0[i] = aux.VT0;
+            VP0[i] = aux.VP0;
+        }
+    };
+
+    return StandardThermoModelBatch(size, params, {}, evalfn).withMemoization();
+}
+
+} // namespace Reaktoro
@@ -0,0 +1,101 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Matrix.hpp>
+#include <Reaktoro/Common/Types.hpp>
+#include <Reaktoro/Core/Param.hpp>
+
+namespace Reaktoro {
+
+// Forward declarations
+class SpeciesList;
+
+/// The function type for the calculation of standard thermodynamic properties of many species at once.
+/// @param T The temperature for the calculation (in K)
+/// @param P The pressure for the calculation (in Pa)
+/// @param[out] G0 The standard molar Gibbs energies of the species (in J/mol)
+/// @param[out] H0 The standard molar enthalpies of the species (in J/mol)
+/// @param[out] V0 The standard molar volumes of the species (in m³/mol)
+/// @param[out] Cp0 The standard molar isobaric heat capacities of the species (in J/(mol·K))
+/// @param[out] VT0 The temperature derivatives of the standard molar volumes of the species (in m³/(mol·K))
+/// @param[out] VP0 The pressure derivatives of the standard molar volumes of the species (in m³/(mol·Pa))
+using StandardThermoModelBatchFn = Fn<void(const real& T, const real& P, ArrayXrRef G0, ArrayXrRef H0, ArrayXrRef V0, ArrayXrRef Cp0, ArrayXrRef VT0, ArrayXrRef VP0)>;
+
+/// Used to calculate the standard thermodynamic properties of many species at once.
+/// A StandardThermoModelBatch object evaluates either a common model for many
+/// species (e.g., the HKF model for aqueous solutes) using the values of their
+/// parameters stored contiguously, or the standard thermodynamic models of all
+/// species in a phase (see createStandardThermoModelBatch). The Param objects
+/// of the species are shared, and the function that updates the stored values
+/// of the parameters is only called when one of them has changed (see Param::version).
+/// @ingroup Core
+class StandardThermoModelBatch
+{
+public:
+    /// Construct a default StandardThermoModelBatch object for no species.
+    StandardThermoModelBatch();
+
+    /// Construct a StandardThermoModelBatch object.
+    /// @param size The number of species in the batch
+    /// @param params The Param objects of all species in the batch
+    /// @param updatefn The function that updates the values of the parameters used in @p evalfn (called at construction and whenever @p params have changed)
+    /// @param evalfn The function that calculates the standard thermodynamic properties of all species in the batch
+    StandardThermoModelBatch(Index size, const Vec<Param>& params, const Fn<void()>& updatefn, const StandardThermoModelBatchFn& evalfn);
+
+    /// Return a new StandardThermoModelBatch object with memoization of its last evaluation.
+    /// The memoization caches are kept per thread, so that the returned object
+    /// (and its copies) can be evaluated concurrently by multiple threads.
+    auto withMemoization() const -> StandardThermoModelBatch;
+
+    /// Return the number of species in the batch.
+    auto size() const -> Index;
+
+    /// Return the Param objects of all species in the batch.
+    auto params() const -> const Vec<Param>&;
+
+    /// Calculate the standard thermodynamic properties of all species in the batch.
+    /// @param T The temperature for the calculation (in K)
+    /// @param P The pressure for the calculation (in Pa)
+    /// @param[out] G0 The standard molar Gibbs energies of the species (in J/mol)
+    /// @param[out] H0 The standard molar enthalpies of the species (in J/mol)
+    /// @param[out] V0 The standard molar volumes of the species (in m³/mol)
+    /// @param[out] Cp0 The standard molar isobaric heat capacities of the species (in J/(mol·K))
+    /// @param[out] VT0 The temperature derivatives of the standard molar volumes of the species (in m³/(mol·K))
+    /// @param[out] VP0 The pressure derivatives of the standard molar volumes of the species (in m³/(mol·Pa))
+    auto eval(const real& T, const real& P, ArrayXrRef G0, ArrayXrRef H0, ArrayXrRef V0, ArrayXrRef Cp0, ArrayXrRef VT0, ArrayXrRef VP0) const -> void;
+
+private:
+    struct Impl;
+
+    SharedPtr<Impl> pimpl;
+};
+
+/// Return a StandardThermoModelBatch object that calculates the standard thermodynamic properties of given species.
+/// Consecutive species whose standard thermodynamic models are of the same kind
+/// and support evaluation in batch (the HKF, Holland-Powell, Maier-Kelley and
+/// NASA models, see e.g. StandardThermoModelHKFBatch) are evaluated at once, so
+/// that the properties common to these species (e.g., the properties of water
+/// and the *g* function of the HKF model, or the powers of temperature) are
+/// computed only once. The other species are evaluated with their own models.
+/// The returned object is memoized (see StandardThermoModelBatch::withMemoization).
+/// @param species The species whose standard thermodynamic properties are calculated
+auto createStandardThermoModelBatch(const SpeciesList& species) -> StandardThermoModelBatch;
+
+} // namespace Reaktoro
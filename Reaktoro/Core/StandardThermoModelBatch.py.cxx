@@ -0,0 +1,38 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// pybind11 includes
+#include <Reaktoro/pybind11.hxx>
+
+// Reaktoro includes
+#include <Reaktoro/Core/SpeciesList.hpp>
+#include <Reaktoro/Core/StandardThermoModelBatch.hpp>
+using namespace Reaktoro;
+
+void exportStandardThermoModelBatch(py::module& m)
+{
+    py::class_<StandardThermoModelBatch>(m, "StandardThermoModelBatch")
+        .def(py::init<>())
+        .def(py::init<Index, const Vec<Param>&, const Fn<void()>&, const StandardThermoModelBatchFn&>())
+        .def("withMemoization", &StandardThermoModelBatch::withMemoization)
+        .def("size", &StandardThermoModelBatch::size)
+        .def("params", &StandardThermoModelBatch::params, return_internal_ref)
+        .def("eval", &StandardThermoModelBatch::eval)
+        ;
+
+    m.def("createStandardThermoModelBatch", createStandardThermoModelBatch);
+}
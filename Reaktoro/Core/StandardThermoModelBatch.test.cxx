@@ -0,0 +1,234 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Core/Phase.hpp>
+#include <Reaktoro/Core/StandardThermoModelBatch.hpp>
+#include <Reaktoro/Models/StandardThermoModels/StandardThermoModelHKF.hpp>
+#include <Reaktoro/Models/StandardThermoModels/StandardThermoModelMaierKelley.hpp>
+#include <Reaktoro/Models/StandardThermoModels/StandardThermoModelNasa.hpp>
+using namespace Reaktoro;
+
+namespace test {
+
+/// Return a StandardThermoModelParamsHKF object with given parameter values.
+auto createParamsHKF(Vec<double> const& values, double charge)
+{
+    StandardThermoModelParamsHKF params;
+    params.Gf     = values[0];
+    params.Hf     = values[1];
+    params.Sr     = values[2];
+    params.a1     = values[3];
+    params.a2     = values[4];
+    params.a3     = values[5];
+    params.a4     = values[6];
+    params.c1     = values[7];
+    params.c2     = values[8];
+    params.wref   = values[9];
+    params.charge = charge;
+    return params;
+}
+
+} // namespace test
+
+TEST_CASE("Testing StandardThermoModelBatch class", "[StandardThermoModelBatch]")
+{
+    ArrayXr G0(2), H0(2), V0(2), Cp0(2), VT0(2), VP0(2);
+
+    SECTION("Testing StandardThermoModelBatch with given update and evaluation functions")
+    {
+        Param A = 1.0;
+
+        ArrayXr values(2);
+        Index numupdates = 0;
+        Index numevals = 0;
+
+        auto updatefn = [&]()
+        {
+            values << A.value(), 2.0 * A.value();
+            ++numupdates;
+        };
+
+        auto evalfn = [&](const real& T, const real& P, ArrayXrRef G0, ArrayXrRef H0, ArrayXrRef V0, ArrayXrRef Cp0, ArrayXrRef VT0, ArrayXrRef VP0)
+        {
+            G0 = values * T;
+            H0 = values * P;
+            V0 = Cp0 = VT0 = VP0 = 0.0;
+            ++numevals;
+        };
+
+        StandardThermoModelBatch batch(2, { A }, updatefn, evalfn);
+
+        CHECK( batch.size() == 2 );
+        CHECK( batch.params().size() == 1 );
+        CHECK( numupdates == 1 );
+
+        batch.eval(300.0, 1.0e5, G0, H0, V0, Cp0, VT0, VP0);
+
+        CHECK( numupdates == 1 );
+        CHECK( G0[0] == 300.0 );
+        CHECK( G0[1] == 600.0 );
+        CHECK( H0[1] == 2.0e5 );
+
+        A = 3.0;
+
+        batch.eval(300.0, 1.0e5, G0, H0, V0, Cp0, VT0, VP0);
+
+        CHECK( numupdates == 2 );
+        CHECK( G0[0] == 900.0 );
+        CHECK( G0[1] == 1800.0 );
+
+        ArrayXr wrong(3);
+        CHECK_THROWS( batch.eval(300.0, 1.0e5, wrong, H0, V0, Cp0, VT0, VP0) );
+
+        const auto memoized = batch.withMemoization();
+
+        numevals = 0;
+
+        memoized.eval(300.0, 1.0e5, G0, H0, V0, Cp0, VT0, VP0);
+        memoized.eval(300.0, 1.0e5, G0, H0, V0, Cp0, VT0, VP0);
+
+        CHECK( numevals == 1 );
+        CHECK( G0[0] == 900.0 );
+
+        A = 4.0; // the memoized batch must notice the change in the parameter
+
+        memoized.eval(300.0, 1.0e5, G0, H0, V0, Cp0, VT0, VP0);
+
+        CHECK( numevals == 2 );
+        CHECK( G0[0] == 1200.0 );
+
+        memoized.eval(310.0, 1.0e5, G0, H0, V0, Cp0, VT0, VP0);
+
+        CHECK( numevals == 3 );
+        CHECK( G0[0] == 1240.0 );
+    }
+
+    SECTION("Testing StandardThermoModelBatch with no species")
+    {
+        StandardThermoModelBatch batch;
+
+        ArrayXr empty;
+
+        CHECK( batch.size() == 0 );
+        CHECK_NOTHROW( batch.eval(300.0, 1.0e5, empty, empty, empty, empty, empty, empty) );
+    }
+}
+
+TEST_CASE("Testing createStandardThermoModelBatch function", "[StandardThermoModelBatch]")
+{
+    // Parameters for CO2(aq), CO3-2, H+ and Mg+2 from slop98.dat (converted to SI units)
+    auto paramsCO2aq = test::createParamsHKF({ -385974.0, -413797.6, 117.5704, 2.6135774e-05, 3125.9082, 0.00011772102, -129197.74, 167.49598, 368208.74, -8368.0 }, 0.0);
+    auto paramsCO3   = test::createParamsHKF({ -527983.14, -675234.84, -49.9988, 1.1934442e-05, -1667.073, 0.00026837013, -109382.31, -13.89339, -719300.73, 1418961.8 }, -2.0);
+    auto paramsHp    = test::createParamsHKF({ 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 }, 1.0);
+    auto paramsMg    = test::createParamsHKF({ -453984.92, -465959.53, -138.072, -3.4379928e-06, -3597.8216, 0.0003510376, -99997.6, 87.0272, -246521.28, 643164.48 }, 2.0);
+
+    // The species below alternate between groups of species with HKF models and species with other models
+    SpeciesList species = {
+        Species("H2O(aq)").withStandardGibbsEnergy(-237181.72),
+        Species("CO2(aq)").withStandardThermoModel(StandardThermoModelHKF(paramsCO2aq)),
+        Species("CO3-2").withStandardThermoModel(StandardThermoModelHKF(paramsCO3)),
+        Species("H+").withStandardThermoModel(StandardThermoModelHKF(paramsHp)),
+        Species("O2(aq)").withStandardGibbsEnergy(16543.0),
+        Species("Mg+2").withStandardThermoModel(StandardThermoModelHKF(paramsMg)),
+    };
+
+    const auto size = species.size();
+
+    ArrayXr G0(size), H0(size), V0(size), Cp0(size), VT0(size), VP0(size);
+
+    // Check the evaluation of all species at once produces the same results as the evaluation of each species
+    auto checkBatchEvaluation = [&](StandardThermoModelBatch const& batch, real T, real P)
+    {
+        batch.eval(T, P, G0, H0, V0, Cp0, VT0, VP0);
+
+        for(auto i = 0; i < species.size(); ++i)
+        {
+            const auto props = species[i].standardThermoProps(T, P);
+
+            INFO("species = " << species[i].name() << ", T = " << T << ", P = " << P);
+            CHECK( G0[i]  == Approx(props.G0).scale(1.0)  );
+            CHECK( H0[i]  == Approx(props.H0).scale(1.0)  );
+            CHECK( V0[i]  == Approx(props.V0).scale(1.0)  );
+            CHECK( Cp0[i] == Approx(props.Cp0).scale(1.0) );
+            CHECK( VT0[i] == Approx(props.VT0).scale(1.0) );
+            CHECK( VP0[i] == Approx(props.VP0).scale(1.0) );
+        }
+    };
+
+    SECTION("Testing createStandardThermoModelBatch with species having HKF and other models")
+    {
+        const auto batch = createStandardThermoModelBatch(species);
+
+        CHECK( batch.size() == size );
+
+        checkBatchEvaluation(batch, 75.0 + 273.15, 1000.0e5);
+        checkBatchEvaluation(batch, 25.0 + 273.15, 1.0e5);
+        checkBatchEvaluation(batch, 25.0 + 273.15, 1.0e5); // same conditions as before, so the memoized result is used
+
+        // Check changes in the Param objects are taken into account (also for the memoized result at same conditions)
+        paramsCO3.Gf = 1234.0;
+        paramsMg.wref = 700000.0;
+
+        checkBatchEvaluation(batch, 25.0 + 273.15, 1.0e5);
+        checkBatchEvaluation(batch, 200.0 + 273.15, 500.0e5);
+    }
+
+    SECTION("Testing createStandardThermoModelBatch with species having Maier-Kelley and NASA models")
+    {
+        // Parameters for CO2(g) and NH3(g) from slop98.dat (converted to SI units)
+        StandardThermoModelParamsMaierKelley paramsCO2g{ -394358.74, -393509.38, 213.73964, 0.0, 44.22488, 0.0087864, -861904.0, 2500.0 };
+        StandardThermoModelParamsMaierKelley paramsNH3g{ -16451.488, -46111.864, 192.464, 0.0, 29.74824, 0.025104, -154808.0, 1800.0 };
+
+        // A species without temperature intervals in the NASA model, with just an assigned enthalpy
+        StandardThermoModelParamsNasa paramsAr;
+        paramsAr.H0 = 456.7;
+        paramsAr.T0 = 298.15;
+
+        species = SpeciesList{
+            Species("CO2(g)").withStandardThermoModel(StandardThermoModelMaierKelley(paramsCO2g)),
+            Species("NH3(g)").withStandardThermoModel(StandardThermoModelMaierKelley(paramsNH3g)),
+            Species("Ar(g)").withStandardThermoModel(StandardThermoModelNasa(paramsAr)),
+            Species("H2O(g)").withStandardGibbsEnergy(-228582.0),
+        };
+
+        const auto batch = createStandardThermoModelBatch(species);
+
+        CHECK( batch.size() == 4 );
+
+        G0.resize(4); H0.resize(4); V0.resize(4); Cp0.resize(4); VT0.resize(4); VP0.resize(4);
+
+        checkBatchEvaluation(batch, 25.0 + 273.15, 1.0e5);
+        checkBatchEvaluation(batch, 75.0 + 273.15, 1000.0e5);
+
+        paramsNH3g.Sr = 200.0;
+
+        checkBatchEvaluation(batch, 75.0 + 273.15, 1000.0e5);
+    }
+
+    SECTION("Testing Phase::standardThermoModelBatch")
+    {
+        const auto phase = Phase().withSpecies(species);
+
+        CHECK( phase.standardThermoModelBatch().size() == size );
+
+        checkBatchEvaluation(phase.standardThermoModelBatch(), 75.0 + 273.15, 1000.0e5);
+    }
+}
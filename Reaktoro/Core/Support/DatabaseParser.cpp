@@ -17,6 +17,9 @@
 
 #include "DatabaseParser.hpp"
 
+// C++ includes
+#include <mutex>
+
 // Reaktoro includes
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Common/ParseUtils.hpp>
@@ -29,22 +32,41 @@ namespace Reaktoro {
 
 struct DatabaseParser::Impl
 {
-    ///< The Species objects in the database.
+    ///< The Species objects in the database already created.
     SpeciesList species_list;
 
     ///< The Element objects in the database.
     ElementList element_list;
 
-    ///< The database contents parsed from YAML or JSON into a Data object.
-    Data doc;
+    ///< The contents of the `Elements` section of the database parsed from YAML or JSON into a Data object.
+    Data elements_data;
+
+    ///< The records of the species in the database with the Data objects of their attributes (released once their Species objects are created).
+    Vec<Pair<SpeciesRecord, Data>> records;
+
+    ///< The indices of the species records with given names (to skip species repeated in the database).
+    Map<String, Index> record_indices;
+
+    ///< The mutex used to protect the creation of Species objects (recursive because species may depend on others via formation reactions).
+    mutable std::recursive_mutex mutex;
 
     /// Construct a default DatabaseParser::Impl object.
     Impl()
     {}
 
+    /// Construct a copy of a DatabaseParser::Impl object.
+    Impl(const Impl& other)
+    {
+        std::lock_guard<std::recursive_mutex> lock(other.mutex);
+        species_list = other.species_list;
+        element_list = other.element_list;
+        elements_data = other.elements_data;
+        records = other.records;
+        record_indices = other.record_indices;
+    }
+
     /// Construct a DatabaseParser::Impl object with given Data object.
     Impl(const Data& doc)
-    : doc(doc)
     {
         errorif(!doc.isDict(), "Could not understand your YAML or JSON database file with content:\n", doc.repr(), "\n",
             "Repeating the error message here in case the above printed content is too long.\n",
@@ -52,16 +74,9 @@ struct DatabaseParser::Impl
             "Are you forgetting to add the list of chemical species inside a Species YAML or JSON map?\n",
             "Please check other Reaktoro's YAML or JSON databases to identify what is not conforming.");
 
-        // if(doc.exists("Elements"))
-        //     for(auto const& child : doc["Elements"].asDict())
-        //         addElement(child.first, child.second);
-
-        // if(doc.exists("Species"))
-        //     for(auto const& child : doc["Species"].asDict())
-        //         addSpecies(child.first, child.second);
-
         if(doc.exists("Elements"))
         {
+            elements_data = doc["Elements"];
             if(doc["Elements"].isDict())
                 for(auto const& child : doc["Elements"].asDict())
                     addElement(child.first, child.second);
@@ -71,34 +86,88 @@ struct DatabaseParser::Impl
             else errorif(true, "Expecting the `Elements` section in your YAML or JSON database to be either a list or dictionary. Please check other Reaktoro databases in either YAML or JSON format and replicate the structure.");
         }
 
+        // Only the records of the species are created here. Their Species
+        // objects (with chemical formulas, elemental compositions, formation
+        // reactions and standard thermodynamic models) are created only when
+        // needed, since most species in large databases are never used. Only
+        // the attributes of each species are kept (not the whole document),
+        // and these are released once the Species object has been created.
         if(doc.exists("Species"))
         {
             if(doc["Species"].isDict())
                 for(auto const& child : doc["Species"].asDict())
-                    addSpecies(child.first, child.second);
+                    addSpeciesRecord(child.first, child.second);
             else if(doc["Species"].isList())
                 for(auto const& child : doc["Species"].asList())
-                    addSpecies(child["Name"].asString(), child);
+                    addSpeciesRecord(child["Name"].asString(), child);
             else errorif(true, "Expecting the `Species` section in your YAML or JSON database to be either a list or dictionary. Please check other Reaktoro databases in either YAML or JSON format and replicate the structure.");
 
         }
     }
 
-    /// Return the Data object with the details of an element with given unique @p symbol.
-    auto getElementDetails(String const& symbol) -> Data
+    /// Add the record of a species with given `name` and `attributes` without creating its Species object.
+    auto addSpeciesRecord(String const& name, Data const& attributes) -> void
     {
-        if(doc.exists("Elements"))
-            if(doc["Elements"].exists(symbol))
-                return doc["Elements"][symbol];
-        return {};
+        checkSpeciesAttributes(attributes);
+        if(!record_indices.emplace(name, records.size()).second)
+            return; // Do not add a species that has already been added!
+        SpeciesRecord record;
+        record.name = name;
+        attributes.at("Formula").to(record.formula);
+        attributes.at("AggregateState").to(record.aggregate_state);
+        errorif(record.aggregate_state == AggregateState::Undefined,
+            "Unsupported AggregateState value `", attributes["AggregateState"].asString(), "` in:\n\n", attributes.repr(), "\n\n"
+            "The supported values are given below:\n\n", supportedAggregateStateValues());
+        if(!attributes.at("Elements").isNull())
+        {
+            for(auto const& [symbol, coeff] : parseNumberStringPairs(attributes["Elements"].asString()))
+            {
+                if(element_list.find(symbol) >= element_list.size())
+                    addElement(symbol); // ensure the Element objects in the database are the same as in the Species objects created later
+                record.elements.push_back(symbol);
+            }
+        }
+        record.tags = createTags(attributes);
+        records.emplace_back(record, attributes);
     }
 
-    /// Return the Data object with the details of a species with given unique @p name.
-    auto getSpeciesDetails(const String& name) -> Data
+    /// Return the Species object of the species record with given index, creating it if needed.
+    auto getSpecies(Index i) -> Species
     {
-        if(doc.exists("Species"))
-            if(doc["Species"].exists(name))
-                return doc["Species"][name];
+        std::lock_guard<std::recursive_mutex> lock(mutex);
+        auto& [record, attributes] = records[i];
+        const auto idx = species_list.find(record.name);
+        if(idx < species_list.size())
+            return species_list[idx];
+        const auto species = addSpecies(record.name, attributes);
+        attributes = Data(); // the attributes of the species are no longer needed
+        return species;
+    }
+
+    /// Return all Species objects in the database, creating those not yet created.
+    auto allSpecies() -> SpeciesList const&
+    {
+        for(auto i = 0; i < records.size(); ++i)
+            getSpecies(i);
+        return species_list;
+    }
+
+    /// Check the attributes of a species have all required entries.
+    auto checkSpeciesAttributes(Data const& attributes) -> void
+    {
+        errorif(!attributes.isDict(), "Expecting the attributes of a species as an object, but got instead:\n\n", attributes.repr());
+        errorif(!attributes.exists("Formula"), "Missing `Formula` specification in:\n\n", attributes.repr());
+        errorif(!attributes.exists("AggregateState"), "Missing `AggregateState` specification in:\n\n", attributes.repr());
+        errorif(!attributes.exists("Elements"), "Missing `Elements` specification in:\n\n", attributes.repr(), "\n",
+            "Please assign `Elements: null` if this species does not have chemical elements (e.g., e-, which may be represented with only `Charge: -1`).");
+        errorif(!attributes.exists("FormationReaction") && !attributes.exists("StandardThermoModel"), "Missing `FormationReaction` or `StandardThermoModel` specification in:\n\n", attributes.repr());
+    }
+
+    /// Return the Data object with the details of an element with given unique @p symbol.
+    auto getElementDetails(String const& symbol) -> Data
+    {
+        if(elements_data.exists(symbol))
+            return elements_data[symbol];
         return {};
     }
 
@@ -127,25 +196,20 @@ struct DatabaseParser::Impl
         return element;
     }
 
-    /// Add a new species with given unique @p name. A Data object for this species must exist.
+    /// Add a new species with given unique @p name. A record for this species must exist.
     auto addSpecies(String const& name) -> Species
     {
-        const auto attributes = getSpeciesDetails(name);
-        errorif(attributes.isNull(), "Could not create a Species object with "
+        const auto it = record_indices.find(name);
+        errorif(it == record_indices.end(), "Could not create a Species object with "
             "name `", name, "`, which does not seem to exist in the database. "
             "Are you sure this name is correct and there is a species with this name in the database?");
-        return addSpecies(name, attributes);
+        return getSpecies(it->second);
     }
 
     /// Add a new species with given `name` and `attributes`.
     auto addSpecies(String const& name, Data const& attributes) -> Species
     {
-        errorif(!attributes.isDict(), "Expecting the attributes of a species as an object, but got instead:\n\n", attributes.repr());
-        errorif(!attributes.exists("Formula"), "Missing `Formula` specification in:\n\n", attributes.repr());
-        errorif(!attributes.exists("AggregateState"), "Missing `AggregateState` specification in:\n\n", attributes.repr());
-        errorif(!attributes.exists("Elements"), "Missing `Elements` specification in:\n\n", attributes.repr(), "\n",
-            "Please assign `Elements: null` if this species does not have chemical elements (e.g., e-, which may be represented with only `Charge: -1`).");
-        errorif(!attributes.exists("FormationReaction") && !attributes.exists("StandardThermoModel"), "Missing `FormationReaction` or `StandardThermoModel` specification in:\n\n", attributes.repr());
+        checkSpeciesAttributes(attributes);
         const auto idx = species_list.find(name);
         if(idx < species_list.size())
             return species_list[idx]; // Do not add a species that has already been added! Return existing one.
@@ -284,12 +348,21 @@ auto DatabaseParser::elements() const -> const ElementList&
 
 auto DatabaseParser::species() const -> const SpeciesList&
 {
-    return pimpl->species_list;
+    return pimpl->allSpecies();
 }
 
 DatabaseParser::operator Database() const
 {
-    return Database(elements(), species());
+    Database db;
+    for(auto const& element : elements())
+        db.addElement(element);
+    for(auto i = 0; i < pimpl->records.size(); ++i)
+    {
+        auto record = pimpl->records[i].first;
+        record.create = [impl = pimpl, i]() { return impl->getSpecies(i); };
+        db.addSpeciesRecord(record);
+    }
+    return db;
 }
 
 } // namespace Reaktoro
@@ -50,6 +50,8 @@ public:
     auto elements() const -> const ElementList&;
 
     /// Return the parsed Species objects in the database file.
+    /// @note This creates the Species objects of all species in the database
+    /// file. A Database object converted from this parser creates them only when needed.
     auto species() const -> const SpeciesList&;
 
     /// Return the parsed Element objects in the database file.
@@ -58,7 +60,7 @@ public:
 private:
     struct Impl;
 
-    Ptr<Impl> pimpl;
+    SharedPtr<Impl> pimpl;
 };
 
 } // namespace Reaktoro
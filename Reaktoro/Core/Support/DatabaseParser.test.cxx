@@ -20,6 +20,7 @@
 
 // Reaktoro includes
 #include <Reaktoro/Core/Data.hpp>
+#include <Reaktoro/Core/Database.hpp>
 #include <Reaktoro/Core/Support/DatabaseParser.hpp>
 using namespace Reaktoro;
 
@@ -231,6 +232,27 @@ TEST_CASE("Testing DatabaseParser class", "[DatabaseParser]")
         CHECK( species[3].reaction().stoichiometry("A2B3(aq)") == 2 );
     }
 
+    SECTION("Testing copies of DatabaseParser objects and Database objects converted from them")
+    {
+        Database db;
+
+        {
+            DatabaseParser parser(Data::parse(doc_dict_based));
+            DatabaseParser copy(parser);
+
+            CHECK( copy.species().size() == 4 ); // all species are created in the copy, not in the original parser
+
+            db = parser; // the species in the Database object are created when needed, after the parser has been destroyed
+        }
+
+        const auto species = db.species("A6B7(aq)");
+
+        CHECK( species.formula() == "A6B7" );
+        CHECK( species.reaction().reactants().size() == 2 );
+        CHECK( species.reaction().stoichiometry("A2B(l)") == 1 );
+        CHECK( species.reaction().stoichiometry("A2B3(aq)") == 2 );
+    }
+
     SECTION("Testing non-conforming databases")
     {
         CHECK_THROWS(DatabaseParser(Data::parse(doc_elements_wrong)));
@@ -129,7 +129,10 @@ struct EquilibriumProps::Impl
         // Before updating the chemical properties, change the model parameters
         // that are input in the chemical equilibrium calculation.
         for(auto i = 0; i < params0.size(); ++i)
+        {
             params[i].value() = w[iparams[i]];
+            params[i].markModified();
+        }
 
         // Perform the update of the chemical properties of the system.
         // If there were model parameters changed above, the chemical
@@ -140,7 +143,10 @@ struct EquilibriumProps::Impl
 
         // Recover here the original state of the model parameters changed above.
         for(auto i = 0; i < params0.size(); ++i)
+        {
             params[i].value() = params0[i];
+            params[i].markModified();
+        }
     }
 
     /// Update the chemical properties of the chemical system.
@@ -21,6 +21,7 @@
 #include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/Enumerate.hpp>
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/Profiler.hpp>
 #include <Reaktoro/Core/ChemicalProps.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
@@ -172,6 +173,8 @@ struct EquilibriumSetup::Impl
 
     auto update(VectorXrConstRef xx, VectorXrConstRef pp, VectorXrConstRef ww) -> void
     {
+        RKT_PROFILE_ZONE("EquilibriumSetup::update");
+
         x = xx;
         n = xx.head(Nn);
         q = xx.tail(Nq);
@@ -29,6 +29,7 @@
 #include <Reaktoro/Common/ArrayStream.hpp>
 #include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/WorkScheduler.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumConditions.hpp>
@@ -90,6 +91,9 @@ struct EquilibriumSolver::Impl
     /// The array stream used to clean up autodiff seed values from the last ChemicalProps update step.
     ArrayStream<double> stream;
 
+    /// The copies of this solver used by the other threads when solving many chemical states in parallel.
+    PerThreadCopies<EquilibriumSolver> copies;
+
     /// Construct a Impl instance with given EquilibriumConditions object.
     Impl(EquilibriumSpecs const& specs)
     : system(specs.system()), specs(specs), dims(specs), xconditions(specs), xrestrictions(system), setup(specs)
@@ -137,6 +141,9 @@ struct EquilibriumSolver::Impl
 
         // Pass along the options used for the calculation to Optima::Solver object
         optsolver.setOptions(options.optima);
+
+        // Discard the copies of this solver so that they are recreated with the new options
+        copies.clear();
     }
 
     /// Update the optimization problem before a new equilibrium calculation.
@@ -451,6 +458,31 @@ auto EquilibriumSolver::solve(ChemicalState& state, EquilibriumSensitivity& sens
     return pimpl->solve(state, sensitivity, conditions, restrictions);
 }
 
+auto EquilibriumSolver::solve(Vec<ChemicalState>& states, WorkScheduler& scheduler) -> Vec<EquilibriumResult>
+{
+    Vec<EquilibriumResult> results(states.size());
+    runWithSolverPerThread(scheduler, *this, pimpl->copies, states.size(), [&](EquilibriumSolver& solver, Index icell)
+    {
+        auto& result = results[icell];
+        result = solver.solve(states[icell]);
+        return double(result.iterations());
+    });
+    return results;
+}
+
+auto EquilibriumSolver::solve(Vec<ChemicalState>& states, Vec<EquilibriumConditions> const& conditions, WorkScheduler& scheduler) -> Vec<EquilibriumResult>
+{
+    errorif(conditions.size() != states.size(), "Expecting as many EquilibriumConditions objects as ChemicalState objects, but got ", conditions.size(), " and ", states.size(), ".");
+    Vec<EquilibriumResult> results(states.size());
+    runWithSolverPerThread(scheduler, *this, pimpl->copies, states.size(), [&](EquilibriumSolver& solver, Index icell)
+    {
+        auto& result = results[icell];
+        result = solver.solve(states[icell], conditions[icell]);
+        return double(result.iterations());
+    });
+    return results;
+}
+
 auto EquilibriumSolver::setOptions(EquilibriumOptions const& options) -> void
 {
     pimpl->setOptions(options);
@@ -31,6 +31,7 @@ class EquilibriumConditions;
 class EquilibriumRestrictions;
 class EquilibriumSensitivity;
 class EquilibriumSpecs;
+class WorkScheduler;
 struct EquilibriumOptions;
 struct EquilibriumResult;
 
@@ -109,6 +110,33 @@ public:
     /// @param restrictions The reactivity restrictions on the amounts of selected species
     auto solve(ChemicalState& state, EquilibriumSensitivity& sensitivity, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> EquilibriumResult;
 
+    //=================================================================================================================
+    //
+    // CHEMICAL EQUILIBRIUM METHODS FOR MANY CHEMICAL STATES
+    //
+    //=================================================================================================================
+
+    /// Equilibrate many chemical states in parallel.
+    /// The chemical states are distributed among the threads of `scheduler`.
+    /// The calling thread uses this solver and every other thread uses its own
+    /// copy of it, created in the first call and kept for subsequent ones.
+    /// The number of iterations in each calculation is used as its cost to dispatch
+    /// the most expensive ones first in the next call.
+    /// @param[in,out] states The initial guesses for the calculations (in) and the computed equilibrium states (out)
+    /// @param scheduler The scheduler used to distribute the calculations among threads
+    auto solve(Vec<ChemicalState>& states, WorkScheduler& scheduler) -> Vec<EquilibriumResult>;
+
+    /// Equilibrate many chemical states in parallel respecting given constraint conditions.
+    /// The chemical states are distributed among the threads of `scheduler`.
+    /// The calling thread uses this solver and every other thread uses its own
+    /// copy of it, created in the first call and kept for subsequent ones.
+    /// The number of iterations in each calculation is used as its cost to dispatch
+    /// the most expensive ones first in the next call.
+    /// @param[in,out] states The initial guesses for the calculations (in) and the computed equilibrium states (out)
+    /// @param conditions The specified constraint conditions of each chemical state
+    /// @param scheduler The scheduler used to distribute the calculations among threads
+    auto solve(Vec<ChemicalState>& states, Vec<EquilibriumConditions> const& conditions, WorkScheduler& scheduler) -> Vec<EquilibriumResult>;
+
     //=================================================================================================================
     //
     // MISCELLANEOUS METHODS
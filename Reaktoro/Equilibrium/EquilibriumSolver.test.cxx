@@ -23,6 +23,7 @@
 
 // Reaktoro includes
 #include <Reaktoro/Common/TimeUtils.hpp>
+#include <Reaktoro/Common/WorkScheduler.hpp>
 #include <Reaktoro/Core/ChemicalProps.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
@@ -297,6 +298,66 @@ TEST_CASE("Testing EquilibriumSolver", "[EquilibriumSolver]")
         }
     }
 
+    SECTION("there are many aqueous solutions equilibrated in parallel")
+    {
+        Phases phases(db);
+        phases.add( AqueousPhase(speciate("H O Na Cl C Ca Mg Si")) );
+
+        ChemicalSystem system(phases);
+
+        const auto ncells = 20;
+
+        Vec<ChemicalState> states(ncells, ChemicalState(system));
+        for(auto i = 0; i < ncells; ++i)
+        {
+            states[i].setTemperature(T, "celsius");
+            states[i].setPressure(P, "bar");
+            states[i].setSpeciesAmount("H2O"   , 55.0 , "mol");
+            states[i].setSpeciesAmount("NaCl"  , 0.01 * (i + 1), "mol");
+            states[i].setSpeciesAmount("CO2"   , 10.0 , "mol");
+            states[i].setSpeciesAmount("CaCO3" , 0.01 , "mol");
+        }
+
+        Vec<ChemicalState> expected = states;
+
+        options.epsilon = 1e-16;
+
+        EquilibriumSolver solver(system);
+        solver.setOptions(options);
+
+        for(auto& state : expected)
+            REQUIRE( solver.solve(state).succeeded() );
+
+        WorkSchedulerOptions schedopts;
+        schedopts.threads = 4;
+
+        WorkScheduler scheduler(schedopts);
+
+        EquilibriumSolver psolver(system);
+        psolver.setOptions(options);
+
+        auto results = psolver.solve(states, scheduler);
+
+        REQUIRE( results.size() == ncells );
+
+        for(auto i = 0; i < ncells; ++i)
+        {
+            CHECK( results[i].succeeded() );
+            CHECK( scheduler.costs()[i] == results[i].iterations() );
+            CHECK( states[i].speciesAmounts().isApprox(expected[i].speciesAmounts()) );
+            checkChemicalEquilibriumStateHasZeroDerivativeValues(states[i]);
+        }
+
+        // Check a recalculation with the same solvers converges in 0 iterations
+        results = psolver.solve(states, scheduler);
+
+        for(auto i = 0; i < ncells; ++i)
+        {
+            CHECK( results[i].succeeded() );
+            CHECK( results[i].iterations() == 0 );
+        }
+    }
+
     SECTION("there is an aqueous solution and a gaseous solution")
     {
         Phases phases(db);
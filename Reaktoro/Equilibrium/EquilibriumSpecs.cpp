@@ -33,7 +33,8 @@ namespace {
 /// Return a Species object in a Database with given formula and aggregate state
 auto getSpecies(Database const& db, String const& formula, AggregateState aggstate) -> Species
 {
-    const auto selected = db.speciesWithAggregateState(aggstate);
+    const auto symbols = ChemicalFormula(formula).symbols();
+    const auto selected = db.speciesWithAggregateState(aggstate, [&](SpeciesRecord const& record) { return contained(record.elements, symbols); });
     const auto idx = selected.findWithFormula(formula);
     if(idx < selected.size()) return selected[idx];
     else return Species();
@@ -437,7 +438,7 @@ auto EquilibriumSpecs::lnActivity(Species const& species) -> void
 
 auto EquilibriumSpecs::lnActivity(String name) -> void
 {
-    const auto specieslist = m_system.database().species();
+    const auto specieslist = m_system.database().speciesWithFilter([&](SpeciesRecord const& record) { return record.name == name; });
     const auto idx = specieslist.findWithName(name);
     errorif(idx >= specieslist.size(),
         "Could not impose an activity constraint for species with name `", name, "` "
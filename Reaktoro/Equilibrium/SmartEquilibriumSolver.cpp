@@ -20,6 +20,7 @@
 // Reaktoro includes
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Common/Profiling.hpp>
+#include <Reaktoro/Common/WorkScheduler.hpp>
 #include <Reaktoro/Core/ChemicalProps.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
@@ -62,6 +63,9 @@ struct SmartEquilibriumSolver::Impl
     /// The temperature-pressure grid containing learned calculations for speficic temperature-pressure intervals.
     SmartEquilibriumSolver::Grid grid;
 
+    /// The copies of this solver used by the other threads when solving many chemical states in parallel.
+    PerThreadCopies<SmartEquilibriumSolver> copies;
+
     /// Construct a SmartEquilibriumSolver::Impl object with given equilibrium problem specifications.
     Impl(EquilibriumSpecs const& specs)
     : solver(specs), sensitivity(specs), conditions(specs)
@@ -168,6 +172,14 @@ struct SmartEquilibriumSolver::Impl
         //---------------------------------------------------------------------
         tic(STORAGE_STEP)
 
+        store(state, conditions, sensitivity);
+
+        result.timing.learning_storage = toc(STORAGE_STEP);
+    }
+
+    /// Store a chemical equilibrium state and its sensitivity derivatives in the knowledge database.
+    auto store(ChemicalState const& state, EquilibriumConditions const& conditions, EquilibriumSensitivity const& sensitivity) -> void
+    {
         // Create an equilibrium predictor object with computed equilibrium state and its sensitivities
         EquilibriumPredictor predictor(state, sensitivity);
 
@@ -206,8 +218,6 @@ struct SmartEquilibriumSolver::Impl
             cell.connectivity.extend();
             cell.priority.extend();
         }
-
-        result.timing.learning_storage = toc(STORAGE_STEP);
     }
 
     /// Perform a prediction operation in which a chemical equilibrium state is predicted using a first-order Taylor approximation.
@@ -396,6 +406,9 @@ struct SmartEquilibriumSolver::Impl
     {
         options = opts;
         solver.setOptions(opts.learning);
+
+        // Discard the copies of this solver so that they are recreated with the new options
+        copies.clear();
     }
 };
 
@@ -466,9 +479,44 @@ auto SmartEquilibriumSolver::solve(ChemicalState& state, EquilibriumSensitivity&
     return {};
 }
 
+auto SmartEquilibriumSolver::solve(Vec<ChemicalState>& states, WorkScheduler& scheduler) -> Vec<SmartEquilibriumResult>
+{
+    Vec<SmartEquilibriumResult> results(states.size());
+    runWithSolverPerThread(scheduler, *this, pimpl->copies, states.size(), [&](SmartEquilibriumSolver& solver, Index icell)
+    {
+        auto& result = results[icell];
+        result = solver.solve(states[icell]);
+        return result.timing.solve;
+    });
+    return results;
+}
+
+auto SmartEquilibriumSolver::solve(Vec<ChemicalState>& states, Vec<EquilibriumConditions> const& conditions, WorkScheduler& scheduler) -> Vec<SmartEquilibriumResult>
+{
+    errorif(conditions.size() != states.size(), "Expecting as many EquilibriumConditions objects as ChemicalState objects, but got ", conditions.size(), " and ", states.size(), ".");
+    Vec<SmartEquilibriumResult> results(states.size());
+    runWithSolverPerThread(scheduler, *this, pimpl->copies, states.size(), [&](SmartEquilibriumSolver& solver, Index icell)
+    {
+        auto& result = results[icell];
+        result = solver.solve(states[icell], conditions[icell]);
+        return result.timing.solve;
+    });
+    return results;
+}
+
 auto SmartEquilibriumSolver::setOptions(SmartEquilibriumOptions const& options) -> void
 {
     pimpl->setOptions(options);
 }
 
+auto SmartEquilibriumSolver::knowledgeBase() const -> Grid const&
+{
+    return pimpl->grid;
+}
+
+auto SmartEquilibriumSolver::store(ChemicalState const& state, EquilibriumConditions const& conditions, EquilibriumSensitivity const& sensitivity) -> void
+{
+    pimpl->store(state, conditions, sensitivity);
+}
+
 } // namespace Reaktoro
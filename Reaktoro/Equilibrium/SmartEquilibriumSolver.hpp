@@ -36,6 +36,7 @@ class ChemicalState;
 class ChemicalSystem;
 class EquilibriumRestrictions;
 class EquilibriumSpecs;
+class WorkScheduler;
 struct SmartEquilibriumOptions;
 struct SmartEquilibriumResult;
 
@@ -114,6 +115,37 @@ public:
     /// @param restrictions The reactivity restrictions on the amounts of selected species
     auto solve(ChemicalState& state, EquilibriumSensitivity& sensitivity, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> SmartEquilibriumResult;
 
+    //=================================================================================================================
+    //
+    // CHEMICAL EQUILIBRIUM METHODS FOR MANY CHEMICAL STATES
+    //
+    //=================================================================================================================
+
+    /// Equilibrate many chemical states in parallel.
+    /// The chemical states are distributed among the threads of `scheduler`.
+    /// The calling thread uses this solver and every other thread uses its own
+    /// copy of it, created in the first call and kept for subsequent ones.
+    /// The time spent in each calculation is used as its cost to dispatch
+    /// the most expensive ones first in the next call.
+    /// Note that each copy of the solver learns and stores its own equilibrium
+    /// calculations, so that a prediction in one thread cannot use a state learned in another.
+    /// @param[in,out] states The initial guesses for the calculations (in) and the computed equilibrium states (out)
+    /// @param scheduler The scheduler used to distribute the calculations among threads
+    auto solve(Vec<ChemicalState>& states, WorkScheduler& scheduler) -> Vec<SmartEquilibriumResult>;
+
+    /// Equilibrate many chemical states in parallel respecting given constraint conditions.
+    /// The chemical states are distributed among the threads of `scheduler`.
+    /// The calling thread uses this solver and every other thread uses its own
+    /// copy of it, created in the first call and kept for subsequent ones.
+    /// The time spent in each calculation is used as its cost to dispatch
+    /// the most expensive ones first in the next call.
+    /// Note that each copy of the solver learns and stores its own equilibrium
+    /// calculations, so that a prediction in one thread cannot use a state learned in another.
+    /// @param[in,out] states The initial guesses for the calculations (in) and the computed equilibrium states (out)
+    /// @param conditions The specified constraint conditions of each chemical state
+    /// @param scheduler The scheduler used to distribute the calculations among threads
+    auto solve(Vec<ChemicalState>& states, Vec<EquilibriumConditions> const& conditions, WorkScheduler& scheduler) -> Vec<SmartEquilibriumResult>;
+
     //=================================================================================================================
     //
     // MISCELLANEOUS METHODS
@@ -178,6 +210,18 @@ public:
         Map<Pair<long, long>, Cell> cells;
     };
 
+    /// Return the knowledge database containing the learned chemical equilibrium calculations.
+    auto knowledgeBase() const -> Grid const&;
+
+    /// Store a chemical equilibrium state and its sensitivity derivatives in the knowledge database.
+    /// This method performs the storage step of a learning operation without
+    /// any chemical equilibrium calculation. It is used, for example, to
+    /// restore a knowledge database saved in a checkpoint file.
+    /// @param state The fully calculated chemical equilibrium state
+    /// @param conditions The conditions at which the chemical equilibrium state was calculated
+    /// @param sensitivity The sensitivity derivatives at the calculated chemical equilibrium state
+    auto store(ChemicalState const& state, EquilibriumConditions const& conditions, EquilibriumSensitivity const& sensitivity) -> void;
+
 private:
     struct Impl;
 
@@ -48,5 +48,6 @@ void exportSmartEquilibriumSolver(py::module& m)
         .def("solve", py::overload_cast<ChemicalState&, EquilibriumSensitivity&, EquilibriumConditions const&, EquilibriumRestrictions const&>(&SmartEquilibriumSolver::solve), "Equilibrate a chemical state respecting given constraint conditions and reactivity restrictions and compute sensitivity derivatives.", py::arg("state"), py::arg("sensitivity"), py::arg("conditions"), py::arg("restrictions"))
 
         .def("setOptions", &SmartEquilibriumSolver::setOptions)
+        .def("store", &SmartEquilibriumSolver::store, "Store a chemical equilibrium state and its sensitivity derivatives in the knowledge database.", py::arg("state"), py::arg("conditions"), py::arg("sensitivity"))
         ;
 }
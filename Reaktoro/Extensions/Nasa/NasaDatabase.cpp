@@ -18,7 +18,9 @@
 #include "NasaDatabase.hpp"
 
 // Reaktoro includes
+#include <Reaktoro/Core/DatabaseCache.hpp>
 #include <Reaktoro/Core/Embedded.hpp>
+#include <Reaktoro/Core/Support/DatabaseParser.hpp>
 
 namespace Reaktoro {
 
@@ -38,7 +40,9 @@ auto NasaDatabase::withName(String name) -> NasaDatabase
         "    - nasa-cea \n",
         "");
     const String contents = Embedded::get("databases/reaktoro/" + name + ".yaml");
-    return fromContents(contents);
+    const auto doc = DatabaseCache::parse(name, contents);
+    DatabaseParser dbparser(doc);
+    return Database(dbparser);
 }
 
 } // namespace Reaktoro
@@ -180,7 +180,7 @@ auto waterProps(real T, real P) -> PhreeqcWaterProps
 
 auto waterPropsMemoized(real T, real P) -> PhreeqcWaterProps
 {
-    static thread_local auto memoized_water_props = memoizeLast(waterProps);
+    static const auto memoized_water_props = memoizeLast(waterProps);
     return memoized_water_props(T, P);
 }
 
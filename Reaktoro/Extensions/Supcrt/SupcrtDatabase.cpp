@@ -19,10 +19,12 @@
 
 // C++ includes
 #include <fstream>
+#include <iterator>
 
 // Reaktoro includes
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Core/Data.hpp>
+#include <Reaktoro/Core/DatabaseCache.hpp>
 #include <Reaktoro/Core/Embedded.hpp>
 #include <Reaktoro/Core/Support/DatabaseParser.hpp>
 
@@ -63,7 +65,7 @@ auto SupcrtDatabase::withName(const String& name) -> SupcrtDatabase
         "    - supcrtbl-organics \n",
         "");
     const auto text = Embedded::get("databases/reaktoro/" + name + ".yaml");
-    const auto doc = Data::parse(text);
+    const auto doc = DatabaseCache::parse(name, text);
     DatabaseParser dbparser(doc);
     return Database(dbparser);
 }
@@ -78,14 +80,15 @@ auto SupcrtDatabase::fromFile(const String& path) -> SupcrtDatabase
         "try a full path to the file (e.g., "
         "in Windows, `C:\\User\\username\\mydata\\mydatabase.yaml`, "
         "in Linux and macOS, `/home/username/mydata/mydatabase.yaml`).");
-    auto doc = Data::parse(file);
+    const String contents(std::istreambuf_iterator<char>(file), {});
+    auto doc = DatabaseCache::parse(path, contents);
     DatabaseParser dbparser(doc);
     return Database(dbparser);
 }
 
 auto SupcrtDatabase::fromContents(const String& contents) -> SupcrtDatabase
 {
-    auto doc = Data::parse(contents);
+    auto doc = DatabaseCache::parse("supcrt", contents);
     DatabaseParser dbparser(doc);
     return Database(dbparser);
 }
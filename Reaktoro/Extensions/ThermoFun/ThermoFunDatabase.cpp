@@ -98,13 +98,13 @@ auto convertAggregateState(const ThermoFun::AggregateState::type& value)
 }
 
 /// Convert a ThermoFun::Substance object into a Reaktoro::Species object
-auto createSpecies(const ThermoFunEngine& engine, const ThermoFun::Substance& substance) -> Species
+auto createSpecies(const ThermoFunEngine& engine, const ThermoFun::Substance& substance, const Pairs<Element, double>& elements) -> Species
 {
     Species species;
     species = species.withName(substance.symbol());
     species = species.withFormula(substance.formula());
     species = species.withSubstance(substance.name());
-    species = species.withElements(createElements(engine, substance));
+    species = species.withElements(elements);
     species = species.withCharge(substance.charge());
     species = species.withAggregateState(convertAggregateState(substance.aggregateState()));
     species = species.withStandardThermoModel(createStandardThermoModel(engine, substance.symbol()));
@@ -125,8 +125,23 @@ ThermoFunDatabase::ThermoFunDatabase(const ThermoFun::Database& db)
 {
     ThermoFunEngine engine(db);
     attachData(engine);
+    // Only the records of the species are created here, with their Species
+    // objects created when needed (see Database::addSpeciesRecord).
     for(auto [_, subs] : db.mapSubstances())
-        addSpecies(createSpecies(engine, subs));
+    {
+        const auto elements = createElements(engine, subs);
+        SpeciesRecord record;
+        record.name = subs.symbol();
+        record.formula = subs.formula();
+        record.aggregate_state = convertAggregateState(subs.aggregateState());
+        for(auto const& [element, coeff] : elements)
+        {
+            addElement(element);
+            record.elements.push_back(element.symbol());
+        }
+        record.create = [=]() { return createSpecies(engine, subs, elements); };
+        addSpeciesRecord(record);
+    }
 }
 
 auto ThermoFunDatabase::withName(const String& name) -> ThermoFunDatabase
@@ -20,6 +20,7 @@
 // Reaktoro includes
 #include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/WorkScheduler.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumConditions.hpp>
@@ -50,6 +51,9 @@ struct KineticsSolver::Impl
     VectorXd plower;                   ///< The auxiliary vector used to set the lower bounds of p variables of the equilibrium conditions used for the kinetics calculations.
     VectorXd pupper;                   ///< The auxiliary vector used to set the upper bounds of p variables of the equilibrium conditions used for the kinetics calculations.
 
+    /// The copies of this solver used by the other threads when solving many chemical states in parallel.
+    PerThreadCopies<KineticsSolver> copies;
+
     /// Construct a KineticsSolver::Impl object with given equilibrium specifications to be attained during chemical kinetics.
     Impl(EquilibriumSpecs const& especs)
     : system(especs.system()),
@@ -76,6 +80,9 @@ struct KineticsSolver::Impl
 
         // Update the options in the underlying equilibrium solver
         ksolver.setOptions(koptions);
+
+        // Discard the copies of this solver so that they are recreated with the new options
+        copies.clear();
     }
 
     /// Update the equilibrium conditions for kinetics with given state and time step.
@@ -296,6 +303,31 @@ auto KineticsSolver::solve(ChemicalState& state, KineticsSensitivity& sensitivit
     return pimpl->solve(state, sensitivity, dt, conditions, restrictions);
 }
 
+auto KineticsSolver::solve(Vec<ChemicalState>& states, real const& dt, WorkScheduler& scheduler) -> Vec<KineticsResult>
+{
+    Vec<KineticsResult> results(states.size());
+    runWithSolverPerThread(scheduler, *this, pimpl->copies, states.size(), [&](KineticsSolver& solver, Index icell)
+    {
+        auto& result = results[icell];
+        result = solver.solve(states[icell], dt);
+        return double(result.iterations());
+    });
+    return results;
+}
+
+auto KineticsSolver::solve(Vec<ChemicalState>& states, real const& dt, Vec<EquilibriumConditions> const& conditions, WorkScheduler& scheduler) -> Vec<KineticsResult>
+{
+    errorif(conditions.size() != states.size(), "Expecting as many EquilibriumConditions objects as ChemicalState objects, but got ", conditions.size(), " and ", states.size(), ".");
+    Vec<KineticsResult> results(states.size());
+    runWithSolverPerThread(scheduler, *this, pimpl->copies, states.size(), [&](KineticsSolver& solver, Index icell)
+    {
+        auto& result = results[icell];
+        result = solver.solve(states[icell], dt, conditions[icell]);
+        return double(result.iterations());
+    });
+    return results;
+}
+
 auto KineticsSolver::setOptions(KineticsOptions const& options) -> void
 {
     pimpl->setOptions(options);
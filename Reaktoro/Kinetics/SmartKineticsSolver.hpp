@@ -31,6 +31,7 @@ class EquilibriumConditions;
 class EquilibriumRestrictions;
 class EquilibriumSpecs;
 class KineticsSensitivity;
+class WorkScheduler;
 struct SmartKineticsOptions;
 struct SmartKineticsResult;
 
@@ -117,6 +118,39 @@ public:
     /// @param restrictions The reactivity restrictions on the amounts of selected species
     auto solve(ChemicalState& state, KineticsSensitivity& sensitivity, real const& dt, EquilibriumConditions const& conditions, EquilibriumRestrictions const& restrictions) -> SmartKineticsResult;
 
+    //=================================================================================================================
+    //
+    // CHEMICAL KINETICS SOLVE METHODS FOR MANY CHEMICAL STATES
+    //
+    //=================================================================================================================
+
+    /// React many chemical states for a given time interval in parallel.
+    /// The chemical states are distributed among the threads of `scheduler`.
+    /// The calling thread uses this solver and every other thread uses its own
+    /// copy of it, created in the first call and kept for subsequent ones.
+    /// The time spent in each calculation is used as its cost to dispatch
+    /// the most expensive ones first in the next call.
+    /// Note that each copy of the solver learns and stores its own equilibrium
+    /// calculations, so that a prediction in one thread cannot use a state learned in another.
+    /// @param[in,out] states The initial guesses for the calculations (in) and the computed reacted states (out)
+    /// @param dt The time step in the kinetics calculation (in s).
+    /// @param scheduler The scheduler used to distribute the calculations among threads
+    auto solve(Vec<ChemicalState>& states, real const& dt, WorkScheduler& scheduler) -> Vec<SmartKineticsResult>;
+
+    /// React many chemical states for a given time interval in parallel respecting given constraint conditions.
+    /// The chemical states are distributed among the threads of `scheduler`.
+    /// The calling thread uses this solver and every other thread uses its own
+    /// copy of it, created in the first call and kept for subsequent ones.
+    /// The time spent in each calculation is used as its cost to dispatch
+    /// the most expensive ones first in the next call.
+    /// Note that each copy of the solver learns and stores its own equilibrium
+    /// calculations, so that a prediction in one thread cannot use a state learned in another.
+    /// @param[in,out] states The initial guesses for the calculations (in) and the computed reacted states (out)
+    /// @param dt The time step in the kinetics calculation (in s).
+    /// @param conditions The specified constraint conditions of each chemical state
+    /// @param scheduler The scheduler used to distribute the calculations among threads
+    auto solve(Vec<ChemicalState>& states, real const& dt, Vec<EquilibriumConditions> const& conditions, WorkScheduler& scheduler) -> Vec<SmartKineticsResult>;
+
     //=================================================================================================================
     //
     // MISCELLANEOUS METHODS
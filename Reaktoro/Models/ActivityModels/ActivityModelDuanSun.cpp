@@ -91,15 +91,15 @@ auto ActivityModelDuanSun(String gas) -> ActivityModelGenerator
         ActivityModel fn = [=](ActivityPropsRef props, ActivityModelArgs args)
         {
             // Check AqueousMixture and AqueousMixtureState are available in props.extra
-            auto mixtureit = props.extra.find("AqueousMixture");
-            auto stateit = props.extra.find("AqueousMixtureState");
+            auto const* mixtureptr = props.extra.get(slotAqueousMixture());
+            auto const* stateptr = props.extra.get(slotAqueousMixtureState());
 
-            errorif(stateit == props.extra.end(),
+            errorif(stateptr == nullptr || mixtureptr == nullptr,
                 "ActivityModelDuanSun expects that another aqueous activity model has been chained first (e.g., Davies, Debye-Huckel, HKF, PitzerHMW, etc.) ");
 
             // The aqueous mixture and its state exported by a base aqueous activity model.
-            const auto& mixture = *std::any_cast<SharedPtr<AqueousMixture> const&>(mixtureit->second);
-            const auto& state = *std::any_cast<SharedPtr<AqueousMixtureState> const&>(stateit->second);
+            const auto& mixture = *mixtureptr;
+            const auto& state = *stateptr;
 
             // The local indices of some charged species among all charged species
             static const auto iNa  = mixture.charged().findWithFormula("Na+");
@@ -344,14 +344,15 @@ auto activityModelHKF(const SpeciesList& species) -> ActivityModel
         const auto& [T, P, x] = args;
 
         // Evaluate the state of the aqueous mixture
-        auto const& state = *stateptr = mixture.state(T, P, x);
+        mixture.state(T, P, x, *stateptr);
+        auto const& state = *stateptr;
 
         // Set the state of matter of the phase
         props.som = StateOfMatter::Liquid;
 
         // Export the aqueous mixture and its state via the `extra` data member
-        props.extra["AqueousMixtureState"] = stateptr;
-        props.extra["AqueousMixture"] = mixtureptr;
+        props.extra.set(slotAqueousMixtureState(), stateptr);
+        props.extra.set(slotAqueousMixture(), mixtureptr);
 
         // Auxiliary references to state variables
         const auto& I = state.Is;  // the stoichiometric ionic strength
@@ -59,10 +59,10 @@ auto activityModelIonExchangeGainesThomas(const SpeciesList& species) -> Activit
         ln_g = ArrayXr::Zero(num_species);
 
         // Calculate Davies and Debye--Huckel parameters only if the AqueousPhase has been already evaluated
-        if(props.extra["AqueousMixtureState"].has_value())
+        if(auto const* aqstateptr = props.extra.get(slotAqueousMixtureState()))
         {
             // Export aqueous mixture state via `extra` data member
-            const auto& aqstate = *std::any_cast<SharedPtr<AqueousMixtureState> const&>(props.extra["AqueousMixtureState"]);
+            const auto& aqstate = *aqstateptr;
 
             // Auxiliary constant references properties
             const auto& I = aqstate.Is;            // the stoichiometric ionic strength
@@ -136,10 +136,10 @@ auto activityModelIonExchangeVanselow(const SpeciesList& species) -> ActivityMod
             ln_g = ArrayXr::Zero(num_species);
 
             // Calculate Davies and Debye--Huckel parameters only if the AqueousPhase has been already evaluated
-            if(props.extra["AqueousMixtureState"].has_value())
+            if(auto const* aqstateptr = props.extra.get(slotAqueousMixtureState()))
             {
                 // Export aqueous mixture state via `extra` data member
-                const auto& aqstate = *std::any_cast<SharedPtr<AqueousMixtureState> const&>(props.extra["AqueousMixtureState"]);
+                const auto& aqstate = *aqstateptr;
 
                 // Auxiliary constant references properties
                 const auto& I = aqstate.Is;            // the stoichiometric ionic strength
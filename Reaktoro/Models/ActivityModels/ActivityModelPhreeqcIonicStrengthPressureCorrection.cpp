@@ -48,13 +48,13 @@ auto ActivityModelPhreeqcIonicStrengthPressureCorrection() -> ActivityModelGener
             const auto& [T, P, x] = args;
 
             // Check AqueousMixtureState is available in props.extra
-            auto stateit = props.extra.find("AqueousMixtureState");
+            auto const* stateptr = props.extra.get(slotAqueousMixtureState());
 
-            errorif(stateit == props.extra.end(),
+            errorif(stateptr == nullptr,
                 "ActivityModelPhreeqcIonicStrengthPressureCorrection expects that another aqueous activity model has been chained first (e.g., Davies, Debye-Huckel, HKF, PitzerHMW, etc.) ");
 
             // The aqueous mixture state exported by a base aqueous activity model.
-            const auto& state = *std::any_cast<SharedPtr<AqueousMixtureState> const&>(stateit->second);
+            const auto& state = *stateptr;
 
             const auto mu = state.Ie;
             const auto RT = universalGasConstant * T;
@@ -18,6 +18,7 @@
 #include "ActivityModelPitzer.hpp"
 
 // C++ includes
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <set>
@@ -26,6 +27,8 @@
 
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
+#include <Reaktoro/Common/AutoDiff.hpp>
+#include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/ConvertUtils.hpp>
 #include <Reaktoro/Common/Enumerate.hpp>
 #include <Reaktoro/Common/Exception.hpp>
@@ -320,14 +323,8 @@ struct PitzerParam
     /// The temperature-pressure correction model for the interaction parameter.
     const Fn<real(real const&, real const&)> model;
 
-    /// The current value of the interaction parameter since last update.
-    real value;
-
-    /// Update the current value of the interaction parameter.
-    auto update(real const& T, real const& P)
-    {
-        value = model(T, P);
-    }
+    /// The coefficients in the temperature-pressure correction model for the interaction parameter.
+    const Vec<Param> coefficients;
 };
 
 /// Auxiliary alias for ActivityModelParamsPitzer::InteractionParamAttribs.
@@ -362,7 +359,7 @@ auto createPitzerParamBinary(SpeciesList const& specieslist, PitzerInteractionPa
 
     Indices ispecies = sortedSpeciesIndicesByCharge(specieslist, {ispecies1, ispecies2});
 
-    return PitzerParam{ ispecies, createParamCorrectionModel(attribs.parameters, attribs.model) };
+    return PitzerParam{ ispecies, createParamCorrectionModel(attribs.parameters, attribs.model), attribs.parameters };
 }
 
 /// Convert a PitzerInteractionParamAttribs object to a PitzerParam one for a ternary interaction parameter.
@@ -386,7 +383,7 @@ auto createPitzerParamTernary(SpeciesList const& specieslist, PitzerInteractionP
 
     Indices ispecies = sortedSpeciesIndicesByCharge(specieslist, {ispecies1, ispecies2, ispecies3});
 
-    return PitzerParam{ ispecies, createParamCorrectionModel(attribs.parameters, attribs.model) };
+    return PitzerParam{ ispecies, createParamCorrectionModel(attribs.parameters, attribs.model), attribs.parameters };
 }
 
 /// Return the default value for \eq{alpha_1} parameter according to that used in PHREEQC v3 (see file pitzer.cpp under comment "Set alpha values").
@@ -635,121 +632,221 @@ struct PitzerState
     ArrayXr ln_gamma; ///< The activity coefficients of the aqueous species (natural log).
 };
 
-/// The auxiliary type used to implement the Pitzer activity model.
-struct PitzerModel
+/// Used to represent interaction parameters in the Pitzer activity model that contribute in the same way to the activity coefficients (structure of arrays).
+/// The species indices and the temperature-pressure correction models of the
+/// interaction parameters are compiled once into flat arrays, so that the
+/// evaluation of the Pitzer model consists of tight loops over contiguous
+/// memory without indirections through `Indices` objects of each parameter.
+struct PitzerParamArray
 {
-    AqueousMixture solution; ///< The aqueous solution for which this Pitzer activity model is defined.
-
-    Vec<PitzerParam> beta0;  ///< The parameters \eq{\beta^{(0)}_{ij}(T, P)} in the Pitzer model for cation-anion interactions.
-    Vec<PitzerParam> beta1;  ///< The parameters \eq{\beta^{(1)}_{ij}(T, P)} in the Pitzer model for cation-anion interactions.
-    Vec<PitzerParam> beta2;  ///< The parameters \eq{\beta^{(2)}_{ij}(T, P)} in the Pitzer model for cation-anion interactions.
-    Vec<PitzerParam> Cphi;   ///< The parameters \eq{C^{\phi}_{ij}(T, P)} in the Pitzer model for cation-anion interactions.
-    Vec<PitzerParam> theta;  ///< The parameters \eq{\theta_{ij}(T, P)} in the Pitzer model for cation-cation and anion-anion interactions.
-    Vec<PitzerParam> psi;    ///< The parameters \eq{\psi_{ijk}(T, P)} in the Pitzer model for cation-cation-anion and anion-anion-cation interactions.
-    Vec<PitzerParam> lambda; ///< The parameters \eq{\lambda_{ij}(T, P)} in the Pitzer model for neutral-cation and neutral-anion interactions.
-    Vec<PitzerParam> zeta;   ///< The parameters \eq{\zeta_{ijk}(T, P)} in the Pitzer model for neutral-cation-anion interactions.
-    Vec<PitzerParam> mu;     ///< The parameters \eq{\mu_{ijk}(T, P)} in the Pitzer model for neutral-neutral-neutral, neutral-neutral-cation, and neutral-neutral-anion interactions.
-    Vec<PitzerParam> eta;    ///< The parameters \eq{\eta_{ijk}(T, P)} in the Pitzer model for neutral-cation-cation and neutral-anion-anion interactions.
+    Indices i0;                                     ///< The index of the first species in each interaction parameter.
+    Indices i1;                                     ///< The index of the second species in each interaction parameter.
+    Indices i2;                                     ///< The index of the third species in each interaction parameter (empty if binary parameters).
+    Vec<Fn<real(real const&, real const&)>> models; ///< The temperature-pressure correction models of the interaction parameters.
+    ArrayXr values;                                 ///< The current values of the interaction parameters since last update.
+
+    /// Append the given interaction parameters to this array.
+    auto append(Vec<PitzerParam> const& params) -> void
+    {
+        for(auto const& param : params)
+        {
+            i0.push_back(param.ispecies[0]);
+            i1.push_back(param.ispecies[1]);
+            if(param.ispecies.size() == 3)
+                i2.push_back(param.ispecies[2]);
+            models.push_back(param.model);
+        }
+        values = zeros(models.size());
+    }
 
-    Vec<Param> alpha1; ///< The parameters \eq{alpha_1_{ij}} associated to the parameters \eq{\beta^{(1)}_{ij}}.
-    Vec<Param> alpha2; ///< The parameters \eq{alpha_2_{ij}} associated to the parameters \eq{\beta^{(1)}_{ij}}.
+    /// Return the number of interaction parameters in this array.
+    auto size() const -> Index
+    {
+        return models.size();
+    }
 
-    using Tuples2i = Tuples<Index, Index>;                   ///< Auxiliary type for a tuple of 2 index values.
-    using Tuples3d = Tuples<double, double, double>;         ///< Auxiliary type for a tuple of 3 double values.
-    using Tuples4d = Tuples<double, double, double, double>; ///< Auxiliary type for a tuple of 4 double values.
+    /// Update the current values of the interaction parameters.
+    auto update(real const& T, real const& Pbar) -> void
+    {
+        for(auto k = 0; k < models.size(); ++k)
+            values[k] = models[k](T, Pbar);
+    }
+};
 
-    Tuples3d lambda_coeffs; ///< The coefficients multiplying the terms where the lambda Pitzer parameter is involved.
-    Tuples4d mu_coeffs;     ///< The coefficients multiplying the terms where the mu Pitzer parameter is involved.
+/// The auxiliary type used to implement the Pitzer activity model.
+struct PitzerModel
+{
+    AqueousMixture solution; ///< The aqueous solution for which this Pitzer activity model is defined.
 
-    Tuples2i thetaij; ///< The indices (i, j) of the cation-cation and anion-anion species pairs used to account for \eq{^{E}\theta_{ij}(I)} and \eq{^{E}\theta_{ij}^{\prime}(I)} contributions.
-    ArrayXr thetaE;   ///< The current values of the parameters \eq{^{E}\theta_{ij}(I)} associated to the \eq{\theta_{ij}} parameters.
-    ArrayXr thetaEP;  ///< The current values of the parameters \eq{^{E}\theta_{ij}^{\prime}(I)} associated to the \eq{\theta_{ij}} parameters.
+    PitzerParamArray binary;  ///< The parameters \eq{\beta^{(0)}_{ij}(T, P)} and \eq{\theta_{ij}(T, P)}, which contribute to the model in the same way.
+    PitzerParamArray binaryg; ///< The parameters \eq{\beta^{(1)}_{ij}(T, P)} and \eq{\beta^{(2)}_{ij}(T, P)}, which contribute to the model with functions \eq{g(\alpha\sqrt{I})}.
+    PitzerParamArray Cphi;    ///< The parameters \eq{C^{\phi}_{ij}(T, P)} in the Pitzer model for cation-anion interactions.
+    PitzerParamArray lambda;  ///< The parameters \eq{\lambda_{ij}(T, P)} in the Pitzer model for neutral-cation and neutral-anion interactions.
+    PitzerParamArray ternary; ///< The parameters \eq{\psi_{ijk}(T, P)}, \eq{\zeta_{ijk}(T, P)} and \eq{\eta_{ijk}(T, P)}, which contribute to the model in the same way.
+    PitzerParamArray mu;      ///< The parameters \eq{\mu_{ijk}(T, P)} in the Pitzer model for neutral-neutral-neutral, neutral-neutral-cation, and neutral-neutral-anion interactions.
+
+    Vec<Param> alphaparams; ///< The parameters \eq{\alpha_1} and \eq{\alpha_2} associated to each parameter in #binaryg.
+    ArrayXr alphas;         ///< The distinct values among the parameters \eq{\alpha_1} and \eq{\alpha_2} since last update.
+    Indices ialphas;        ///< The index in #alphas of the \eq{\alpha} parameter associated to each parameter in #binaryg.
+    ArrayXr galphas;        ///< The current values of \eq{g(\alpha\sqrt{I})} for each distinct \eq{\alpha} value.
+    ArrayXr gpalphas;       ///< The current values of \eq{g^\prime(\alpha\sqrt{I})} for each distinct \eq{\alpha} value.
+    ArrayXr ealphas;        ///< The current values of \eq{\exp(-\alpha\sqrt{I})} for each distinct \eq{\alpha} value.
+
+    ArrayXd Cphi_factors; ///< The factors \eq{1/(2\sqrt{|z_iz_j|})} multiplying each parameter in #Cphi.
+
+    ArrayXd lambda_clng0; ///< The coefficients multiplying the lambda parameters in the activity coefficients of the first species.
+    ArrayXd lambda_clng1; ///< The coefficients multiplying the lambda parameters in the activity coefficients of the second species.
+    ArrayXd lambda_cosm;  ///< The coefficients multiplying the lambda parameters in the osmotic coefficient.
+
+    ArrayXd mu_clng0; ///< The coefficients multiplying the mu parameters in the activity coefficients of the first species.
+    ArrayXd mu_clng1; ///< The coefficients multiplying the mu parameters in the activity coefficients of the second species.
+    ArrayXd mu_clng2; ///< The coefficients multiplying the mu parameters in the activity coefficients of the third species.
+    ArrayXd mu_cosm;  ///< The coefficients multiplying the mu parameters in the osmotic coefficient.
+
+    Indices thetai0;   ///< The index of the first species in the cation-cation and anion-anion pairs with different charges, for which \eq{^{E}\theta_{ij}(I)} and \eq{^{E}\theta_{ij}^{\prime}(I)} are non-zero.
+    Indices thetai1;   ///< The index of the second species in the cation-cation and anion-anion pairs with different charges.
+    Indices ithetazz;  ///< The index in #thetazz of the pair of charges of each pair of species in #thetai0 and #thetai1.
+    Vec<Pair<double, double>> thetazz; ///< The distinct pairs of charges of the species in #thetai0 and #thetai1.
+    ArrayXr thetaE;    ///< The current values of \eq{^{E}\theta_{ij}(I)} for each distinct pair of charges.
+    ArrayXr thetaEP;   ///< The current values of \eq{^{E}\theta_{ij}^{\prime}(I)} for each distinct pair of charges.
 
     Fn<real(real const&, real const&)> Aphi; ///< The function that computes the Debye-huckel parameter \eq{A^\phi(T, P)} in the Pitzer model.
 
+    Vec<Param> coefficients; ///< The coefficients in the temperature-pressure correction models of all interaction parameters and the \eq{\alpha} parameters.
+    real Tlast = NaN;        ///< The temperature used in the last update of the interaction parameters (in K).
+    real Plast = NaN;        ///< The pressure used in the last update of the interaction parameters (in Pa).
+    Index versionlast = 0;   ///< The latest version among the coefficients in the last update of the interaction parameters (see Param::version).
+
     /// Construct a default Pitzer object.
     PitzerModel()
     {}
 
     /// Construct a Pitzer object with given list of species in the aqueous solution and the parameters for the Pitzer activity model.
-    // PitzerModel(SpeciesList const& specieslist, ActivityModelParamsPitzer const& params)
     PitzerModel(AqueousMixture const& solution, ActivityModelParamsPitzer const& params)
     : solution(solution)
     {
-        for(auto const& entry : params.beta0)
-            if(PitzerParam param = createPitzerParamBinary(solution.species(), entry); !param.ispecies.empty())
-                beta0.push_back(param);
-
-        for(auto const& entry : params.beta1)
-            if(PitzerParam param = createPitzerParamBinary(solution.species(), entry); !param.ispecies.empty())
-                beta1.push_back(param);
-
-        for(auto const& entry : params.beta2)
-            if(PitzerParam param = createPitzerParamBinary(solution.species(), entry); !param.ispecies.empty())
-                beta2.push_back(param);
-
-        for(auto const& entry : params.Cphi)
-            if(PitzerParam param = createPitzerParamBinary(solution.species(), entry); !param.ispecies.empty())
-                Cphi.push_back(param);
-
-        for(auto const& entry : params.theta)
-            if(PitzerParam param = createPitzerParamBinary(solution.species(), entry); !param.ispecies.empty())
-                theta.push_back(param);
-
-        for(auto const& entry : params.psi)
-            if(PitzerParam param = createPitzerParamTernary(solution.species(), entry); !param.ispecies.empty())
-                psi.push_back(param);
-
-        for(auto const& entry : params.lambda)
-            if(PitzerParam param = createPitzerParamBinary(solution.species(), entry); !param.ispecies.empty())
-                lambda.push_back(param);
+        auto const& specieslist = solution.species();
 
-        for(auto const& entry : params.zeta)
-            if(PitzerParam param = createPitzerParamTernary(solution.species(), entry); !param.ispecies.empty())
-                zeta.push_back(param);
-
-        for(auto const& entry : params.mu)
-            if(PitzerParam param = createPitzerParamTernary(solution.species(), entry); !param.ispecies.empty())
-                mu.push_back(param);
-
-        for(auto const& entry : params.eta)
-            if(PitzerParam param = createPitzerParamTernary(solution.species(), entry); !param.ispecies.empty())
-                eta.push_back(param);
-
-        for(auto const& entry : params.beta1)
-            alpha1.push_back(determineAlpha1(entry.formulas[0], entry.formulas[1], params.alpha1));
-
-        for(auto const& entry : params.beta2)
-            alpha2.push_back(determineAlpha2(entry.formulas[0], entry.formulas[1], params.alpha2));
+        auto collectBinary = [&](Vec<PitzerInteractionParamAttribs> const& entries)
+        {
+            Vec<PitzerParam> res;
+            for(auto const& entry : entries)
+                if(PitzerParam param = createPitzerParamBinary(specieslist, entry); !param.ispecies.empty())
+                    res.push_back(param);
+            return res;
+        };
 
-        auto const& ications = solution.indicesCations();
-        auto const& ianions = solution.indicesAnions();
+        // Collect the beta1 or beta2 parameters together with their alpha parameters (stored in alphaparams in the same order)
+        auto collectBinaryWithAlpha = [&](Vec<PitzerInteractionParamAttribs> const& entries, auto const& alphafn)
+        {
+            Vec<PitzerParam> res;
+            for(auto const& entry : entries)
+            {
+                if(PitzerParam param = createPitzerParamBinary(specieslist, entry); !param.ispecies.empty())
+                {
+                    res.push_back(param);
+                    alphaparams.push_back(alphafn(entry.formulas[0], entry.formulas[1]));
+                }
+            }
+            return res;
+        };
 
-        for(auto i = 0; i < ications.size() - 1; ++i)
-            for(auto j = i + 1; j < ications.size(); ++j)
-                thetaij.emplace_back(ications[i], ications[j]);
+        auto collectTernary = [&](Vec<PitzerInteractionParamAttribs> const& entries)
+        {
+            Vec<PitzerParam> res;
+            for(auto const& entry : entries)
+                if(PitzerParam param = createPitzerParamTernary(specieslist, entry); !param.ispecies.empty())
+                    res.push_back(param);
+            return res;
+        };
 
-        for(auto i = 0; i < ianions.size() - 1; ++i)
-            for(auto j = i + 1; j < ianions.size(); ++j)
-                thetaij.emplace_back(ianions[i], ianions[j]);
+        auto const beta0params  = collectBinary(params.beta0);
+        auto const beta1params  = collectBinaryWithAlpha(params.beta1, [&](auto const& f0, auto const& f1) { return determineAlpha1(f0, f1, params.alpha1); });
+        auto const beta2params  = collectBinaryWithAlpha(params.beta2, [&](auto const& f0, auto const& f1) { return determineAlpha2(f0, f1, params.alpha2); });
+        auto const Cphiparams   = collectBinary(params.Cphi);
+        auto const thetaparams  = collectBinary(params.theta);
+        auto const psiparams    = collectTernary(params.psi);
+        auto const lambdaparams = collectBinary(params.lambda);
+        auto const zetaparams   = collectTernary(params.zeta);
+        auto const muparams     = collectTernary(params.mu);
+        auto const etaparams    = collectTernary(params.eta);
+
+        binary.append(beta0params);
+        binary.append(thetaparams);
+        binaryg.append(beta1params);
+        binaryg.append(beta2params);
+        Cphi.append(Cphiparams);
+        lambda.append(lambdaparams);
+        ternary.append(psiparams);
+        ternary.append(zetaparams);
+        ternary.append(etaparams);
+        mu.append(muparams);
+
+        ialphas = Indices(alphaparams.size(), 0);
+
+        for(auto const* pzparams : { &beta0params, &beta1params, &beta2params, &Cphiparams, &thetaparams, &psiparams, &lambdaparams, &zetaparams, &muparams, &etaparams })
+            for(auto const& param : *pzparams)
+                for(auto const& coeff : param.coefficients)
+                    coefficients.push_back(coeff);
+
+        for(auto const& alpha : alphaparams)
+            coefficients.push_back(alpha);
 
         auto const& z = solution.charges();
 
-        for(auto const& entry : lambda)
+        Cphi_factors.resize(Cphi.size());
+        for(auto k = 0; k < Cphi.size(); ++k)
+            Cphi_factors[k] = 1.0/(2.0 * sqrt(abs(z[Cphi.i0[k]] * z[Cphi.i1[k]])));
+
+        lambda_clng0.resize(lambda.size());
+        lambda_clng1.resize(lambda.size());
+        lambda_cosm.resize(lambda.size());
+        for(auto k = 0; k < lambda.size(); ++k)
         {
-            auto const i1 = entry.ispecies[0];
-            auto const i2 = entry.ispecies[1];
-            lambda_coeffs.push_back(determineLambdaCoeffs(z[i1], z[i2], i1, i2));
+            auto const i0 = lambda.i0[k];
+            auto const i1 = lambda.i1[k];
+            std::tie(lambda_clng0[k], lambda_clng1[k], lambda_cosm[k]) = determineLambdaCoeffs(z[i0], z[i1], i0, i1);
         }
 
-        for(auto const& entry : mu)
+        mu_clng0.resize(mu.size());
+        mu_clng1.resize(mu.size());
+        mu_clng2.resize(mu.size());
+        mu_cosm.resize(mu.size());
+        for(auto k = 0; k < mu.size(); ++k)
         {
-            auto const i1 = entry.ispecies[0];
-            auto const i2 = entry.ispecies[1];
-            auto const i3 = entry.ispecies[2];
-            mu_coeffs.push_back(determineMuCoeffs(z[i1], z[i2], z[i3], i1, i2, i3));
+            auto const i0 = mu.i0[k];
+            auto const i1 = mu.i1[k];
+            auto const i2 = mu.i2[k];
+            std::tie(mu_clng0[k], mu_clng1[k], mu_clng2[k], mu_cosm[k]) = determineMuCoeffs(z[i0], z[i1], z[i2], i0, i1, i2);
         }
 
+        // Collect the cation-cation and anion-anion pairs. Skip those with equal charges, for which ethetaE and ethetaEP are zero.
+        auto addThetaPairs = [&](Indices const& ions)
+        {
+            for(auto i = 0; i + 1 < ions.size(); ++i)
+            {
+                for(auto j = i + 1; j < ions.size(); ++j)
+                {
+                    auto const zi = z[ions[i]];
+                    auto const zj = z[ions[j]];
+                    if(zi == zj)
+                        continue;
+                    auto const izz = indexfn(thetazz, RKT_LAMBDA(x, x.first == zi && x.second == zj));
+                    if(izz == thetazz.size())
+                        thetazz.emplace_back(zi, zj);
+                    thetai0.push_back(ions[i]);
+                    thetai1.push_back(ions[j]);
+                    ithetazz.push_back(izz);
+                }
+            }
+        };
+
+        addThetaPairs(solution.indicesCations());
+        addThetaPairs(solution.indicesAnions());
+
+        thetaE = zeros(thetazz.size());
+        thetaEP = zeros(thetazz.size());
+
         // Define the function Aphi(T, P) according to PHREEQC (see method calc_dielectrics at utilities.cpp for computing A0)
         Aphi = [](real const& T, real const& P) -> real
         {
@@ -767,43 +864,49 @@ struct PitzerModel
     }
 
     /// Update all Pitzer interaction parameters according to current temperature and pressure.
+    /// The update is skipped if temperature, pressure, and the coefficients in
+    /// the correction models have not changed since the last update.
     auto updateParams(real const& T, real const& P)
     {
-        // Note: Do not try to avoid the calculations before in case T and P is
-        // the same as last time because T and P could be the same but the Param
-        // objects in these models could be changing!
-
-        auto const Pbar = P * 1e-5; // from Pa to bar
-
-        for(auto& param : beta0)
-            param.value = param.model(T, Pbar);
-
-        for(auto& param : beta1)
-            param.value = param.model(T, Pbar);
-
-        for(auto& param : beta2)
-            param.value = param.model(T, Pbar);
-
-        for(auto& param : Cphi)
-            param.value = param.model(T, Pbar);
+        // The Param objects in the correction models could be changing even if T and P are the
+        // same as last time, so check also if any of them has a newer version than before
+        Index versionlatest = 0;
+        for(auto const& coeff : coefficients)
+            versionlatest = std::max(versionlatest, coeff.version());
 
-        for(auto& param : theta)
-            param.value = param.model(T, Pbar);
+        // Compare values and derivatives (e.g., seeded T or P changes results even if values are the same)
+        auto const same = [](real const& a, real const& b) { return a == b && grad(a) == grad(b); };
 
-        for(auto& param : psi)
-            param.value = param.model(T, Pbar);
-
-        for(auto& param : lambda)
-            param.value = param.model(T, Pbar);
+        if(same(T, Tlast) && same(P, Plast) && versionlatest == versionlast)
+            return;
 
-        for(auto& param : zeta)
-            param.value = param.model(T, Pbar);
+        auto const Pbar = P * 1e-5; // from Pa to bar
 
-        for(auto& param : mu)
-            param.value = param.model(T, Pbar);
+        binary.update(T, Pbar);
+        binaryg.update(T, Pbar);
+        Cphi.update(T, Pbar);
+        lambda.update(T, Pbar);
+        ternary.update(T, Pbar);
+        mu.update(T, Pbar);
+
+        // Determine the distinct alpha values so that g(alpha*sqrt(I)) is computed only once for each of them
+        Index numalphas = 0;
+        alphas.resize(alphaparams.size());
+        for(auto k = 0; k < alphaparams.size(); ++k)
+        {
+            auto const& alpha = alphaparams[k].value();
+            auto u = 0;
+            while(u < numalphas && !same(alphas[u], alpha))
+                ++u;
+            if(u == numalphas)
+                alphas[numalphas++] = alpha;
+            ialphas[k] = u;
+        }
+        alphas.conservativeResize(numalphas);
 
-        for(auto& param : eta)
-            param.value = param.model(T, Pbar);
+        Tlast = T;
+        Plast = P;
+        versionlast = versionlatest;
     }
 
     /// Evaluate the Pitzer model and compute the properties of the aqueous solution.
@@ -850,64 +953,69 @@ struct PitzerModel
         // The osmotic coefficient of water in the Pitzer model
         OSMOT = -Aphi0*I*DI/(1 + B*DI);
 
-        for(auto const& param : beta0)
+        // Compute g(x), g'(x) and exp(-x) with x = alpha*sqrt(I) only once for each distinct alpha value
+        galphas.resize(alphas.size());
+        gpalphas.resize(alphas.size());
+        ealphas.resize(alphas.size());
+        for(auto u = 0; u < alphas.size(); ++u)
         {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
-
-            LGAMMA[i0] += M[i1] * 2.0 * param.value;
-            LGAMMA[i1] += M[i0] * 2.0 * param.value;
-            OSMOT += M[i0] * M[i1] * param.value;
+            auto const x = alphas[u] * DI;
+            galphas[u] = G(x);
+            gpalphas[u] = GP(x);
+            ealphas[u] = exp(-x);
         }
 
-        for(auto const& [i, param] : enumerate(beta1))
-        {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
-
-            F += M[i0] * M[i1] * param.value * GP(alpha1[i] * DI)/I;
-            LGAMMA[i0] += M[i1] * 2.0 * param.value * G(alpha1[i] * DI);
-            LGAMMA[i1] += M[i0] * 2.0 * param.value * G(alpha1[i] * DI);
-            OSMOT += M[i0] * M[i1] * param.value * exp(-alpha1[i] * DI);
-        }
+        // Compute ethetaE and ethetaEP only once for each distinct pair of charges
+        for(auto u = 0; u < thetazz.size(); ++u)
+            std::tie(thetaE[u], thetaEP[u]) = computeThetaValuesInterpolation(I, DI, Aphi0, thetazz[u].first, thetazz[u].second);
 
-        for(auto const& [i, param] : enumerate(beta2))
+        // Contributions of the beta0 and theta parameters
+        for(auto k = 0; k < binary.size(); ++k)
         {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
+            auto const i0 = binary.i0[k];
+            auto const i1 = binary.i1[k];
+            auto const& value = binary.values[k];
 
-            F += M[i0] * M[i1] * param.value * GP(alpha2[i] * DI)/I;
-            LGAMMA[i0] += M[i1] * 2.0 * param.value * G(alpha2[i] * DI);
-            LGAMMA[i1] += M[i0] * 2.0 * param.value * G(alpha2[i] * DI);
-            OSMOT += M[i0] * M[i1] * param.value * exp(-alpha2[i] * DI);
+            LGAMMA[i0] += M[i1] * 2.0 * value;
+            LGAMMA[i1] += M[i0] * 2.0 * value;
+            OSMOT += M[i0] * M[i1] * value;
         }
 
-        for(auto const& param : Cphi)
+        // Contributions of the beta1 and beta2 parameters
+        for(auto k = 0; k < binaryg.size(); ++k)
         {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
-
-            auto const aux = 2.0 * sqrt(abs(z[i0] * z[i1]));
-
-            CSUM += M[i0] * M[i1] * param.value/aux;
-            LGAMMA[i0] += M[i1] * BIGZ * param.value/aux;
-            LGAMMA[i1] += M[i0] * BIGZ * param.value/aux;
-            OSMOT += M[i0] * M[i1] * BIGZ * param.value/aux;
+            auto const i0 = binaryg.i0[k];
+            auto const i1 = binaryg.i1[k];
+            auto const u = ialphas[k];
+            auto const& value = binaryg.values[k];
+
+            F += M[i0] * M[i1] * value * gpalphas[u]/I;
+            LGAMMA[i0] += M[i1] * 2.0 * value * galphas[u];
+            LGAMMA[i1] += M[i0] * 2.0 * value * galphas[u];
+            OSMOT += M[i0] * M[i1] * value * ealphas[u];
         }
 
-        for(auto const& param : theta)
+        // Contributions of the Cphi parameters
+        for(auto k = 0; k < Cphi.size(); ++k)
         {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
-
-            LGAMMA[i0] += 2.0 * M[i1] * param.value;
-            LGAMMA[i1] += 2.0 * M[i0] * param.value;
-            OSMOT += M[i0] * M[i1] * param.value;
+            auto const i0 = Cphi.i0[k];
+            auto const i1 = Cphi.i1[k];
+            auto const value = Cphi.values[k] * Cphi_factors[k];
+
+            CSUM += M[i0] * M[i1] * value;
+            LGAMMA[i0] += M[i1] * BIGZ * value;
+            LGAMMA[i1] += M[i0] * BIGZ * value;
+            OSMOT += M[i0] * M[i1] * BIGZ * value;
         }
 
-        for(auto const& [i0, i1] : thetaij)
+        // Contributions of the electrostatic mixing effects of unsymmetrical cation-cation and anion-anion pairs
+        for(auto k = 0; k < thetai0.size(); ++k)
         {
-            auto const [etheta, ethetap] = computeThetaValuesInterpolation(I, DI, Aphi0, z[i0], z[i1]);
+            auto const i0 = thetai0[k];
+            auto const i1 = thetai1[k];
+            auto const u = ithetazz[k];
+            auto const& etheta = thetaE[u];
+            auto const& ethetap = thetaEP[u];
 
             F += M[i0] * M[i1] * ethetap;
             LGAMMA[i0] += 2.0 * M[i1] * etheta;
@@ -915,66 +1023,44 @@ struct PitzerModel
             OSMOT += M[i0] * M[i1] * (etheta + I*ethetap);
         }
 
-        for(auto const& param : psi)
+        // Contributions of the psi, zeta and eta parameters
+        for(auto k = 0; k < ternary.size(); ++k)
         {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
-            auto const i2 = param.ispecies[2];
-
-            LGAMMA[i0] += M[i1] * M[i2] * param.value;
-            LGAMMA[i1] += M[i0] * M[i2] * param.value;
-            LGAMMA[i2] += M[i0] * M[i1] * param.value;
-            OSMOT += M[i0] * M[i1] * M[i2] * param.value;
+            auto const i0 = ternary.i0[k];
+            auto const i1 = ternary.i1[k];
+            auto const i2 = ternary.i2[k];
+            auto const& value = ternary.values[k];
+
+            LGAMMA[i0] += M[i1] * M[i2] * value;
+            LGAMMA[i1] += M[i0] * M[i2] * value;
+            LGAMMA[i2] += M[i0] * M[i1] * value;
+            OSMOT += M[i0] * M[i1] * M[i2] * value;
         }
 
-        for(auto const& [i, param] : enumerate(lambda))
+        // Contributions of the lambda parameters
+        for(auto k = 0; k < lambda.size(); ++k)
         {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
-
-            auto const [clng0, clng1, cosm] = lambda_coeffs[i];
-
-            LGAMMA[i0] += M[i1] * param.value * clng0;
-            LGAMMA[i1] += M[i0] * param.value * clng1;
-            OSMOT += M[i0] * M[i1] * param.value * cosm;
-        }
-
-        for(auto const& param : zeta)
-        {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
-            auto const i2 = param.ispecies[2];
-
-            LGAMMA[i0] += M[i1] * M[i2] * param.value;
-            LGAMMA[i1] += M[i0] * M[i2] * param.value;
-            LGAMMA[i2] += M[i0] * M[i1] * param.value;
-            OSMOT += M[i0] * M[i1] * M[i2] * param.value;
-        }
-
-        for(auto const& [i, param] : enumerate(mu))
-        {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
-            auto const i2 = param.ispecies[2];
-
-            auto const [clng0, clng1, clng2, cosm] = mu_coeffs[i];
+            auto const i0 = lambda.i0[k];
+            auto const i1 = lambda.i1[k];
+            auto const& value = lambda.values[k];
 
-            LGAMMA[i0] += M[i1] * M[i2] * param.value * clng0;
-            LGAMMA[i1] += M[i0] * M[i2] * param.value * clng1;
-            LGAMMA[i2] += M[i0] * M[i1] * param.value * clng2;
-            OSMOT += M[i0] * M[i1] * M[i2] * param.value * cosm;
+            LGAMMA[i0] += M[i1] * value * lambda_clng0[k];
+            LGAMMA[i1] += M[i0] * value * lambda_clng1[k];
+            OSMOT += M[i0] * M[i1] * value * lambda_cosm[k];
         }
 
-        for(auto const& param : eta)
+        // Contributions of the mu parameters
+        for(auto k = 0; k < mu.size(); ++k)
         {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
-            auto const i2 = param.ispecies[2];
-
-            LGAMMA[i0] += M[i1] * M[i2] * param.value;
-            LGAMMA[i1] += M[i0] * M[i2] * param.value;
-            LGAMMA[i2] += M[i0] * M[i1] * param.value;
-            OSMOT += M[i0] * M[i1] * M[i2] * param.value;
+            auto const i0 = mu.i0[k];
+            auto const i1 = mu.i1[k];
+            auto const i2 = mu.i2[k];
+            auto const& value = mu.values[k];
+
+            LGAMMA[i0] += M[i1] * M[i2] * value * mu_clng0[k];
+            LGAMMA[i1] += M[i0] * M[i2] * value * mu_clng1[k];
+            LGAMMA[i2] += M[i0] * M[i1] * value * mu_clng2[k];
+            OSMOT += M[i0] * M[i1] * M[i2] * value * mu_cosm[k];
         }
 
         // Finalise the calculation of the activity coefficient by adding the missing F and CSUM contributions
@@ -1015,14 +1101,15 @@ auto createActivityModelPitzer(SpeciesList const& species, ActivityModelParamsPi
         auto const& [T, P, x] = args;
 
         // Evaluate the state of the aqueous solution
-        auto const& aqstate = *aqstateptr = solution.state(T, P, x);
+        solution.state(T, P, x, *aqstateptr);
+        auto const& aqstate = *aqstateptr;
 
         // Set the state of matter of the phase
         props.som = StateOfMatter::Liquid;
 
         // Export the aqueous solution and its state via the `extra` data member
-        props.extra["AqueousMixtureState"] = aqstateptr;
-        props.extra["AqueousMixture"] = aqsolutionptr;
+        props.extra.set(slotAqueousMixtureState(), aqstateptr);
+        props.extra.set(slotAqueousMixture(), aqsolutionptr);
 
         // Evaluate the Pitzer activity model with given aqueous state
         pzmodel.evaluate(aqstate, pzstate);
@@ -19,6 +19,7 @@
 #include <catch2/catch.hpp>
 
 // Reaktoro includes
+#include <Reaktoro/Common/AutoDiff.hpp>
 #include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Extensions/Phreeqc/PhreeqcDatabase.hpp>
 #include <Reaktoro/Models/ActivityModels/ActivityModelPitzer.hpp>
@@ -792,4 +793,151 @@ TEST_CASE("Testing ActivityModelPitzer", "[ActivityModelPitzer]")
         CHECK( props.ln_g[31]/ln10 == Approx( 0.239383000) ); // H4SiO4 (PHREEQC:  0.23937, difference: 5.43e-03 %)
         CHECK( props.ln_g[32]/ln10 == Approx(-1.906930000) ); // Sr+2 (PHREEQC: -1.90518, difference: 9.19e-02 %)
     }
+
+    WHEN("high salinity brine at moderate temperature - chemical elements are C, Ca, Cl, K, Mg, Na, S")
+    {
+        // -----------------------------------------------------------------------------
+        // Note: The expected values below for the activity coefficients, the
+        // activity of water and their derivatives with respect to temperature and
+        // the amount of Na+ were computed with the implementation of the Pitzer
+        // model before its interaction parameters were compiled into flat arrays
+        // (with the alignment of the alpha parameters corrected, see next test).
+        // -----------------------------------------------------------------------------
+
+        const auto species = SpeciesList("H2O H+ OH- Na+ K+ Ca+2 Mg+2 Cl- SO4-2 HCO3- CO3-2 CO2");
+
+        real T = 60.0 + 273.15;
+        real P = 1.0e+5;
+
+        const auto n = ArrayXr{{
+            5.55080e+01, // H2O
+            1.00000e-07, // H+
+            1.00000e-07, // OH-
+            5.00000e+00, // Na+
+            2.00000e-01, // K+
+            5.00000e-01, // Ca+2
+            3.00000e-01, // Mg+2
+            6.40000e+00, // Cl-
+            1.50000e-01, // SO4-2
+            1.00000e-02, // HCO3-
+            1.00000e-03, // CO3-2
+            5.00000e-02, // CO2
+        }};
+
+        ArrayXr x = n / n.sum();
+
+        // Construct the activity props function with the given aqueous species.
+        ActivityModel fn = ActivityModelPitzer()(species);
+
+        // Create the ActivityProps object with the results.
+        ActivityProps props = ActivityProps::create(species.size());
+
+        // Evaluate the activity props function
+        fn(props, {T, P, x});
+
+        CHECK( props.ln_g[0]  == Approx(-1.022215903e-01) ); // H2O
+        CHECK( props.ln_g[1]  == Approx( 1.303155130e+00) ); // H+
+        CHECK( props.ln_g[2]  == Approx(-1.336659341e+00) ); // OH-
+        CHECK( props.ln_g[3]  == Approx(-6.209770149e-02) ); // Na+
+        CHECK( props.ln_g[4]  == Approx(-8.614758898e-01) ); // K+
+        CHECK( props.ln_g[5]  == Approx(-5.175069666e-01) ); // Ca+2
+        CHECK( props.ln_g[6]  == Approx(-4.350105427e-03) ); // Mg+2
+        CHECK( props.ln_g[7]  == Approx( 2.531222598e-01) ); // Cl-
+        CHECK( props.ln_g[8]  == Approx(-4.596880697e+00) ); // SO4-2
+        CHECK( props.ln_g[9]  == Approx(-5.204870260e-01) ); // HCO3-
+        CHECK( props.ln_g[10] == Approx(-4.316348425e+00) ); // CO3-2
+        CHECK( props.ln_g[11] == Approx( 1.105769247e+00) ); // CO2
+        CHECK( props.ln_a[0]  == Approx(-3.069506144e-01) ); // H2O
+
+        // Evaluate the activity props function with temperature seeded
+        autodiff::seed(T);
+        fn(props, {T, P, x});
+        autodiff::unseed(T);
+
+        CHECK( grad(props.ln_g[0])  == Approx( 2.154384171e-04) ); // H2O
+        CHECK( grad(props.ln_g[1])  == Approx(-2.854683621e-03) ); // H+
+        CHECK( grad(props.ln_g[2])  == Approx(-1.025510651e-03) ); // OH-
+        CHECK( grad(props.ln_g[3])  == Approx( 9.023276840e-04) ); // Na+
+        CHECK( grad(props.ln_g[4])  == Approx( 2.798015101e-03) ); // K+
+        CHECK( grad(props.ln_g[5])  == Approx(-1.888106855e-03) ); // Ca+2
+        CHECK( grad(props.ln_g[6])  == Approx(-6.113373431e-03) ); // Mg+2
+        CHECK( grad(props.ln_g[7])  == Approx(-3.417846635e-04) ); // Cl-
+        CHECK( grad(props.ln_g[8])  == Approx(-1.002292094e-03) ); // SO4-2
+        CHECK( grad(props.ln_g[9])  == Approx(-2.168969114e-03) ); // HCO3-
+        CHECK( grad(props.ln_g[10]) == Approx( 1.558500303e-02) ); // CO3-2
+        CHECK( grad(props.ln_g[11]) == Approx(-7.251280486e-05) ); // CO2
+        CHECK( grad(props.ln_a[0])  == Approx( 2.154384171e-04) ); // H2O
+
+        // Evaluate the activity props function with the mole fraction of Na+ seeded
+        autodiff::seed(x[3]);
+        fn(props, {T, P, x});
+        autodiff::unseed(x[3]);
+
+        CHECK( grad(props.ln_g[0])  == Approx(-2.061509922e+00) ); // H2O
+        CHECK( grad(props.ln_g[1])  == Approx( 1.743650224e+00) ); // H+
+        CHECK( grad(props.ln_g[2])  == Approx( 1.121583467e+01) ); // OH-
+        CHECK( grad(props.ln_g[3])  == Approx(-2.679375868e+00) ); // Na+
+        CHECK( grad(props.ln_g[4])  == Approx(-4.792619728e+00) ); // K+
+        CHECK( grad(props.ln_g[5])  == Approx(-1.100948566e+01) ); // Ca+2
+        CHECK( grad(props.ln_g[6])  == Approx(-1.183726084e+01) ); // Mg+2
+        CHECK( grad(props.ln_g[7])  == Approx( 1.062240569e+01) ); // Cl-
+        CHECK( grad(props.ln_g[8])  == Approx( 7.871759999e+00) ); // SO4-2
+        CHECK( grad(props.ln_g[9])  == Approx(-3.806217312e+00) ); // HCO3-
+        CHECK( grad(props.ln_g[10]) == Approx( 2.484007441e+01) ); // CO3-2
+        CHECK( grad(props.ln_g[11]) == Approx( 1.142705064e+01) ); // CO2
+        CHECK( grad(props.ln_a[0])  == Approx(-2.061509922e+00) ); // H2O
+    }
+
+    WHEN("beta1 parameters are given for species not in the solution")
+    {
+        // The alpha1 parameter of each beta1 parameter must be the one of the
+        // same pair of species, even when preceding beta1 parameters are
+        // discarded because their species are not in the solution.
+        using CorrectionModel = ActivityModelParamsPitzer::CorrectionModel;
+
+        auto paramNaCl = [](double value) { return ActivityModelParamsPitzer::InteractionParamAttribs{ {"Na+", "Cl-"}, CorrectionModel::Constant, {value} }; };
+        auto paramCaSO4 = [](double value) { return ActivityModelParamsPitzer::InteractionParamAttribs{ {"Ca+2", "SO4-2"}, CorrectionModel::Constant, {value} }; };
+
+        ActivityModelParamsPitzer params;
+        params.beta0 = { paramNaCl(0.0765) };
+        params.beta1 = { paramNaCl(0.2664) };
+        params.Cphi  = { paramNaCl(0.00127) };
+
+        ActivityModelParamsPitzer paramsext = params;
+        paramsext.beta1 = { paramCaSO4(3.1973), paramNaCl(0.2664) }; // the default alpha1 for Ca+2 and SO4-2 is 1.4 and for Na+ and Cl- is 2.0
+
+        const auto species = SpeciesList("OH- H+ H2O Cl- Na+");
+
+        const auto T = 25.0 + 273.15;
+        const auto P = 1.0e+5;
+
+        const auto n = ArrayXr{{
+            1.0e-07,     // OH-
+            1.0e-07,     // H+
+            5.55062e+01, // H2O
+            3.0e+00,     // Cl-
+            3.0e+00,     // Na+
+        }};
+
+        const auto x = n / n.sum();
+
+        // Construct the activity props functions with the given aqueous species.
+        ActivityModel fn = ActivityModelPitzer(params)(species);
+        ActivityModel fnext = ActivityModelPitzer(paramsext)(species);
+
+        // Create the ActivityProps objects with the results.
+        ActivityProps props = ActivityProps::create(species.size());
+        ActivityProps propsext = ActivityProps::create(species.size());
+
+        // Evaluate the activity props functions
+        fn(props, {T, P, x});
+        fnext(propsext, {T, P, x});
+
+        for(auto i = 0; i < species.size(); ++i)
+        {
+            INFO("species: " << species[i].name());
+            CHECK( propsext.ln_g[i] == Approx(props.ln_g[i]) );
+            CHECK( propsext.ln_a[i] == Approx(props.ln_a[i]) );
+        }
+    }
 }
@@ -24,6 +24,8 @@
 
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
+#include <Reaktoro/Common/AutoDiff.hpp>
+#include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/ConvertUtils.hpp>
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Common/NamingUtils.hpp>
@@ -705,12 +707,61 @@ auto J1(real x) -> real
     return 0.0;
 }
 
+/// The non-zero entries of a table of ternary interaction parameters compiled into flat arrays (structure of arrays).
+struct PitzerTernaryEntries
+{
+    Indices i;      ///< The first index of each non-zero entry in the table.
+    Indices j;      ///< The second index of each non-zero entry in the table.
+    Indices k;      ///< The third index of each non-zero entry in the table.
+    ArrayXr values; ///< The values of the non-zero entries in the table.
+
+    /// Construct a default PitzerTernaryEntries object.
+    PitzerTernaryEntries()
+    {}
+
+    /// Construct a PitzerTernaryEntries object with the non-zero entries of given table.
+    explicit PitzerTernaryEntries(const Table3D<real>& table)
+    {
+        Vec<real> nonzeros;
+        for(auto ii = 0; ii < table.size(); ++ii)
+            for(auto jj = 0; jj < table[ii].size(); ++jj)
+                for(auto kk = 0; kk < table[ii][jj].size(); ++kk)
+                    if(table[ii][jj][kk] != 0.0)
+                    {
+                        i.push_back(ii);
+                        j.push_back(jj);
+                        k.push_back(kk);
+                        nonzeros.push_back(table[ii][jj][kk]);
+                    }
+        values = ArrayXr::Map(nonzeros.data(), nonzeros.size());
+    }
+
+    /// Return the number of non-zero entries.
+    auto size() const -> Index
+    {
+        return i.size();
+    }
+};
+
+/// Convert a table of binary interaction parameters into a matrix.
+auto createMatrix(const Table2D<real>& table, Index rows, Index cols) -> MatrixXr
+{
+    MatrixXr res = zeros(rows, cols);
+    for(auto i = 0; i < rows; ++i)
+        for(auto j = 0; j < cols; ++j)
+            res(i, j) = table[i][j];
+    return res;
+}
+
 struct PitzerParams
 {
     PitzerParams();
 
     explicit PitzerParams(const AqueousMixture& mixture);
 
+    /// Update the matrices of single-salt parameters (beta0, beta1, beta2, C) in case temperature has changed since last update.
+    auto updateSingleSaltParams(const real& T) -> void;
+
     Indices idx_neutrals;
 
     Indices idx_charged;
@@ -748,6 +799,49 @@ struct PitzerParams
     Table3D<real> zeta;
 
     BilinearInterpolator Aphi;
+
+    // The interaction parameters above compiled into matrices and flat arrays of non-zero entries
+
+    MatrixXr theta_cc_mat;  ///< The matrix of parameters \eq{\theta_{ij}} for cation-cation interactions.
+    MatrixXr theta_aa_mat;  ///< The matrix of parameters \eq{\theta_{ij}} for anion-anion interactions.
+    MatrixXr lambda_nc_mat; ///< The matrix of parameters \eq{\lambda_{nc}} for neutral-cation interactions.
+    MatrixXr lambda_na_mat; ///< The matrix of parameters \eq{\lambda_{na}} for neutral-anion interactions.
+
+    PitzerTernaryEntries psi_cca_entries; ///< The non-zero parameters \eq{\psi_{ija}} for cation-cation-anion interactions.
+    PitzerTernaryEntries psi_aac_entries; ///< The non-zero parameters \eq{\psi_{ijc}} for anion-anion-cation interactions.
+    PitzerTernaryEntries zeta_entries;    ///< The non-zero parameters \eq{\zeta_{nca}} for neutral-cation-anion interactions.
+
+    // The single-salt parameters evaluated at the temperature of their last update
+
+    real Tlast = NaN;   ///< The temperature used in the last update of the single-salt parameters (in K).
+    MatrixXr beta0_mat; ///< The parameters \eq{\beta^{(0)}_{ca}} at temperature #Tlast.
+    MatrixXr beta1_mat; ///< The parameters \eq{\beta^{(1)}_{ca}} at temperature #Tlast.
+    MatrixXr beta2_mat; ///< The parameters \eq{\beta^{(2)}_{ca}} at temperature #Tlast.
+    MatrixXr C_mat;     ///< The parameters \eq{C_{ca}=C^{\phi}_{ca}/(2\sqrt{|z_cz_a|})} at temperature #Tlast.
+
+    // Auxiliary matrices used in the evaluation of the model
+
+    MatrixXr B;          ///< The matrix with entries \eq{B_{ca}}.
+    MatrixXr B_phi;      ///< The matrix with entries \eq{B^{\phi}_{ca}}.
+    MatrixXr B_prime;    ///< The matrix with entries \eq{B^{\prime}_{ca}}.
+    MatrixXr Phi_cc;     ///< The matrix with entries \eq{\Phi_{ij}} for cation-cation pairs.
+    MatrixXr Phi_phi_cc; ///< The matrix with entries \eq{\Phi^{\phi}_{ij}} for cation-cation pairs.
+    MatrixXr Phi_prime_cc; ///< The matrix with entries \eq{\Phi^{\prime}_{ij}} for cation-cation pairs.
+    MatrixXr Phi_aa;     ///< The matrix with entries \eq{\Phi_{ij}} for anion-anion pairs.
+    MatrixXr Phi_phi_aa; ///< The matrix with entries \eq{\Phi^{\phi}_{ij}} for anion-anion pairs.
+    MatrixXr Phi_prime_aa; ///< The matrix with entries \eq{\Phi^{\prime}_{ij}} for anion-anion pairs.
+
+    // Auxiliary vectors and matrices reused in every evaluation of the model to avoid allocations
+
+    VectorXr mn;    ///< The molalities of the neutral species.
+    VectorXr mc;    ///< The molalities of the cations.
+    VectorXr ma;    ///< The molalities of the anions.
+    MatrixXr BZC;   ///< The matrix \eq{2B+ZC} (and later \eq{B^{\phi}+ZC}) for cation-anion pairs.
+    VectorXr ln_gc; ///< The contributions to the ln activity coefficients of the cations.
+    VectorXr ln_ga; ///< The contributions to the ln activity coefficients of the anions.
+    VectorXr ln_gn; ///< The contributions to the ln activity coefficients of the neutral species.
+    VectorXr wc;    ///< The auxiliary vector with one entry per cation.
+    VectorXr wn;    ///< The auxiliary vector with one entry per neutral species.
 };
 
 PitzerParams::PitzerParams()
@@ -794,108 +888,97 @@ PitzerParams::PitzerParams(const AqueousMixture& mixture)
     for(auto& x : pressures) x = convertBarToPascal(x);
 
     Aphi = BilinearInterpolator(temperatures, pressures, Aphi_data);
+
+    const auto num_neutrals = idx_neutrals.size();
+    const auto num_cations  = idx_cations.size();
+    const auto num_anions   = idx_anions.size();
+
+    theta_cc_mat  = createMatrix(theta_cc, num_cations, num_cations);
+    theta_aa_mat  = createMatrix(theta_aa, num_anions, num_anions);
+    lambda_nc_mat = createMatrix(lambda_nc, num_neutrals, num_cations);
+    lambda_na_mat = createMatrix(lambda_na, num_neutrals, num_anions);
+
+    psi_cca_entries = PitzerTernaryEntries(psi_cca);
+    psi_aac_entries = PitzerTernaryEntries(psi_aac);
+    zeta_entries    = PitzerTernaryEntries(zeta);
+
+    beta0_mat = zeros(num_cations, num_anions);
+    beta1_mat = zeros(num_cations, num_anions);
+    beta2_mat = zeros(num_cations, num_anions);
+    C_mat     = zeros(num_cations, num_anions);
+
+    mn.resize(num_neutrals);
+    mc.resize(num_cations);
+    ma.resize(num_anions);
+    BZC.resize(num_cations, num_anions);
+    ln_gc.resize(num_cations);
+    ln_ga.resize(num_anions);
+    ln_gn.resize(num_neutrals);
+    wc.resize(num_cations);
+    wn.resize(num_neutrals);
 }
 
-auto thetaE(const AqueousMixtureState& state, const PitzerParams& pitzer, real zi, real zj) -> real
+auto PitzerParams::updateSingleSaltParams(const real& T) -> void
 {
-    if(zi == zj) return 0.0;
+    if(T == Tlast && grad(T) == grad(Tlast))
+        return;
 
-    const auto I     = state.Ie;
-    const auto T     = state.T;
-    const auto P     = state.P;
-    const auto sqrtI = sqrt(I);
-    const auto Aphi  = pitzer.Aphi(T, P);
-    const auto xij   = 6.0*zi*zj*Aphi*sqrtI;
-    const auto xii   = 6.0*zi*zi*Aphi*sqrtI;
-    const auto xjj   = 6.0*zj*zj*Aphi*sqrtI;
-    const auto J0ij  = J0(xij);
-    const auto J0ii  = J0(xii);
-    const auto J0jj  = J0(xjj);
+    for(auto c = 0; c < idx_cations.size(); ++c)
+    {
+        for(auto a = 0; a < idx_anions.size(); ++a)
+        {
+            beta0_mat(c, a) = beta0[c][a](T);
+            beta1_mat(c, a) = beta1[c][a](T);
+            beta2_mat(c, a) = beta2[c][a](T);
+            C_mat(c, a)     = 0.5 * Cphi[c][a](T)/sqrt(abs(z_cations[c]*z_anions[a]));
+        }
+    }
 
-    return zi*zj/(4*I) * (J0ij - 0.5*J0ii - 0.5*J0jj);
+    Tlast = T;
 }
 
-auto thetaE_prime(const AqueousMixtureState& state, const PitzerParams& pitzer, real zi, real zj) -> real
+/// Return the values of \eq{^{E}\theta_{ij}(I)} and \eq{^{E}\theta_{ij}^{\prime}(I)} for a pair of ions with charges \eq{z_i} and \eq{z_j}.
+auto thetaE(const real& I, const real& sqrtI, const real& Aphi, const real& zi, const real& zj) -> Pair<real, real>
 {
-    if(zi == zj) return 0.0;
+    if(zi == zj) return { 0.0, 0.0 };
 
-    const auto I     = state.Ie;
-    const auto T     = state.T;
-    const auto P     = state.P;
-    const auto sqrtI = sqrt(I);
-    const auto Aphi  = pitzer.Aphi(T, P);
     const auto xij   = 6.0*zi*zj*Aphi*sqrtI;
     const auto xii   = 6.0*zi*zi*Aphi*sqrtI;
     const auto xjj   = 6.0*zj*zj*Aphi*sqrtI;
+    const auto J0ij  = J0(xij);
+    const auto J0ii  = J0(xii);
+    const auto J0jj  = J0(xjj);
     const auto J1ij  = J1(xij);
     const auto J1ii  = J1(xii);
     const auto J1jj  = J1(xjj);
 
-    return zi*zj/(8*I*I) * (J1ij - 0.5*J1ii - 0.5*J1jj) - thetaE(state, pitzer, zi, zj)/I;
-}
-
-auto thetaE_cc(const AqueousMixtureState& state, const PitzerParams& pitzer, unsigned i, unsigned j) -> real
-{
-    const auto zi = pitzer.z_cations[i];
-    const auto zj = pitzer.z_cations[j];
-    return thetaE(state, pitzer, zi, zj);
-}
-
-auto thetaE_aa(const AqueousMixtureState& state, const PitzerParams& pitzer, unsigned i, unsigned j) -> real
-{
-    const auto zi = pitzer.z_anions[i];
-    const auto zj = pitzer.z_anions[j];
-    return thetaE(state, pitzer, zi, zj);
-}
-
-auto thetaE_prime_cc(const AqueousMixtureState& state, const PitzerParams& pitzer, unsigned i, unsigned j) -> real
-{
-    const auto zi = pitzer.z_cations[i];
-    const auto zj = pitzer.z_cations[j];
-    return thetaE_prime(state, pitzer, zi, zj);
-}
-
-auto thetaE_prime_aa(const AqueousMixtureState& state, const PitzerParams& pitzer, unsigned i, unsigned j) -> real
-{
-    const auto zi = pitzer.z_anions[i];
-    const auto zj = pitzer.z_anions[j];
-    return thetaE_prime(state, pitzer, zi, zj);
-}
-
-auto Phi_cc(const AqueousMixtureState& state, const PitzerParams& pitzer, unsigned i, unsigned j) -> real
-{
-    const auto thetaij = pitzer.theta_cc[i][j];
-    return thetaij + thetaE_cc(state, pitzer, i, j);
-}
-
-auto Phi_aa(const AqueousMixtureState& state, const PitzerParams& pitzer, unsigned i, unsigned j) -> real
-{
-    const auto thetaij = pitzer.theta_aa[i][j];
-    return thetaij + thetaE_aa(state, pitzer, i, j);
-}
+    const real thetaEij = zi*zj/(4*I) * (J0ij - 0.5*J0ii - 0.5*J0jj);
+    const real thetaEij_prime = zi*zj/(8*I*I) * (J1ij - 0.5*J1ii - 0.5*J1jj) - thetaEij/I;
 
-auto Phi_phi_cc(const AqueousMixtureState& state, const PitzerParams& pitzer, unsigned i, unsigned j) -> real
-{
-    const auto I = state.Ie;
-    const auto thetaij = pitzer.theta_cc[i][j];
-    return thetaij + thetaE_cc(state, pitzer, i, j) + I * thetaE_prime_cc(state, pitzer, i, j);
+    return { thetaEij, thetaEij_prime };
 }
 
-auto Phi_phi_aa(const AqueousMixtureState& state, const PitzerParams& pitzer, unsigned i, unsigned j) -> real
+/// Compute the matrices \eq{\Phi_{ij}}, \eq{\Phi^{\phi}_{ij}} and \eq{\Phi^{\prime}_{ij}} for all pairs of ions of same sign.
+/// Only the entries with \eq{i<j} are computed for \eq{\Phi^{\phi}_{ij}} and \eq{\Phi^{\prime}_{ij}}, since only these are needed.
+auto computePhi(const real& I, const real& sqrtI, const real& Aphi, ArrayXrConstRef z, const MatrixXr& theta, MatrixXr& Phi, MatrixXr& Phi_phi, MatrixXr& Phi_prime) -> void
 {
-    const auto I = state.Ie;
-    const auto thetaij = pitzer.theta_aa[i][j];
-    return thetaij + thetaE_aa(state, pitzer, i, j) + I * thetaE_prime_aa(state, pitzer, i, j);
-}
+    const auto num_ions = z.size();
 
-auto Phi_prime_cc(const AqueousMixtureState& state, const PitzerParams& pitzer, unsigned i, unsigned j) -> real
-{
-    return thetaE_prime_cc(state, pitzer, i, j);
-}
+    Phi = theta;
+    Phi_phi.resize(num_ions, num_ions);
+    Phi_prime.resize(num_ions, num_ions);
 
-auto Phi_prime_aa(const AqueousMixtureState& state, const PitzerParams& pitzer, unsigned i, unsigned j) -> real
-{
-    return thetaE_prime_aa(state, pitzer, i, j);
+    for(auto i = 0; i < num_ions; ++i)
+    {
+        for(auto j = i + 1; j < num_ions; ++j)
+        {
+            const auto [thetaEij, thetaEij_prime] = thetaE(I, sqrtI, Aphi, z[i], z[j]);
+            Phi(i, j) += thetaEij;
+            Phi(j, i) += thetaEij;
+            Phi_phi(i, j) = theta(i, j) + thetaEij + I*thetaEij_prime;
+            Phi_prime(i, j) = thetaEij_prime;
+        }
+    }
 }
 
 auto g(real x) -> real
@@ -912,108 +995,51 @@ const auto alpha  =  2.0;
 const auto alpha1 =  1.4;
 const auto alpha2 = 12.0;
 
-auto B_phi(const AqueousMixtureState& state, const PitzerParams& pitzer, unsigned c, unsigned a) -> real
-{
-    const auto I     = state.Ie;
-    const auto T     = state.T;
-    const auto sqrtI = sqrt(I);
-    const auto zc    = pitzer.z_cations[c];
-    const auto za    = pitzer.z_anions[a];
-    const auto beta0 = pitzer.beta0[c][a](T);
-    const auto beta1 = pitzer.beta1[c][a](T);
-    const auto beta2 = pitzer.beta2[c][a](T);
-
-    if(abs(zc) == 2 && abs(za) == 2)
-        return beta0 + beta1 * exp(-alpha1*sqrtI) + beta2 * exp(-alpha2*sqrtI);
-    else
-        return beta0 + beta1 * exp(-alpha*sqrtI);
-}
-
-auto B(const AqueousMixtureState& state, const PitzerParams& pitzer, unsigned c, unsigned a) -> real
-{
-    const auto I     = state.Ie;
-    const auto T     = state.T;
-    const auto sqrtI = sqrt(I);
-    const auto zc    = pitzer.z_cations[c];
-    const auto za    = pitzer.z_anions[a];
-    const auto beta0 = pitzer.beta0[c][a](T);
-    const auto beta1 = pitzer.beta1[c][a](T);
-    const auto beta2 = pitzer.beta2[c][a](T);
-
-    if(abs(zc) == 2 && abs(za) == 2)
-        return beta0 + beta1 * g(alpha1*sqrtI) + beta2 * g(alpha2*sqrtI);
-    else
-        return beta0 + beta1 * g(alpha*sqrtI);
-}
-
-auto B_prime(const AqueousMixtureState& state, const PitzerParams& pitzer, unsigned c, unsigned a) -> real
-{
-    const auto I     = state.Ie;
-    const auto T     = state.T;
-    const auto sqrtI = sqrt(I);
-    const auto zc    = pitzer.z_cations[c];
-    const auto za    = pitzer.z_anions[a];
-    const auto beta1 = pitzer.beta1[c][a](T);
-    const auto beta2 = pitzer.beta2[c][a](T);
-
-    if(abs(zc) == 2 && abs(za) == 2)
-        return beta1 * g_prime(alpha1*sqrtI)/I + beta2 * g_prime(alpha2*sqrtI)/I;
-    else
-        return beta1 * g_prime(alpha*sqrtI)/I;
-}
-
-auto C(const AqueousMixtureState& state, const PitzerParams& pitzer, unsigned c, unsigned a) -> real
-{
-    const auto T     = state.T;
-    const auto Cphi = pitzer.Cphi[c][a](T);
-    const auto zc   = pitzer.z_cations[c];
-    const auto za   = pitzer.z_anions[a];
-    return 0.5 * Cphi/sqrt(abs(zc*za));
-}
-
-auto computeF(const AqueousMixtureState& state, const PitzerParams& pitzer) -> real
+/// Compute the matrices \eq{B_{ca}}, \eq{B^{\phi}_{ca}} and \eq{B^{\prime}_{ca}} for all pairs of cations and anions.
+auto computeB(const real& I, const real& sqrtI, PitzerParams& pitzer) -> void
 {
-    // The indices of the cations and anions
-    const auto& idx_cations = pitzer.idx_cations;
-    const auto& idx_anions  = pitzer.idx_anions;
-
-    // The number of the cations and anions
-    const auto num_cations = idx_cations.size();
-    const auto num_anions  = idx_anions.size();
-
-    // THe temperature and pressure in units of K and Pa respectively
-    const auto& T = state.T;
-    const auto& P = state.P;
-
-    // The molalities of all aqueous species
-    const auto& m = state.m;
-
-    // The ionic strength of the aqueous mixture and its square root
-    const auto I = state.Ie;
-    const auto sqrtI = sqrt(I);
-
-    // The Debye-Huckel coefficient Aphi
-    const auto Aphi = pitzer.Aphi(T, P);
-
-    // The b parameter of the Harvie-Moller-Weare Pitzer's model
-    const auto b = 1.2;
-
-    // Calculate the term F of the Harvie-Moller-Weare Pitzer's model
-    real F = -Aphi * (sqrtI/(1 + b*sqrtI) + 2.0/b * log(1 + b*sqrtI));
-
-    // Iterate over all pairs of cations and anions
-    for(auto c = 0; c < num_cations; ++c) for(auto a = 0; a < num_anions; ++a)
-        F += m[idx_cations[c]] * m[idx_anions[a]] * B_prime(state, pitzer, c, a);
+    const auto num_cations = pitzer.idx_cations.size();
+    const auto num_anions  = pitzer.idx_anions.size();
 
-    // Iterate over all pairs of distinct cations
-    for(auto i = 0; i < num_cations - 1; ++i) for(auto j = i + 1; j < num_cations; ++j)
-        F += m[idx_cations[i]] * m[idx_cations[j]] * Phi_prime_cc(state, pitzer, i, j);
+    // The functions g(x), g'(x) and exp(-x) evaluated only once for each alpha value
+    const real g0  = g(alpha*sqrtI);
+    const real g1  = g(alpha1*sqrtI);
+    const real g2  = g(alpha2*sqrtI);
+    const real gp0 = g_prime(alpha*sqrtI);
+    const real gp1 = g_prime(alpha1*sqrtI);
+    const real gp2 = g_prime(alpha2*sqrtI);
+    const real e0  = exp(-alpha*sqrtI);
+    const real e1  = exp(-alpha1*sqrtI);
+    const real e2  = exp(-alpha2*sqrtI);
 
-    // Iterate over all pairs of distinct anions
-    for(auto i = 0; i < num_anions - 1; ++i) for(auto j = i + 1; j < num_anions; ++j)
-        F += m[idx_anions[i]] * m[idx_anions[j]] * Phi_prime_aa(state, pitzer, i, j);
+    pitzer.B.resize(num_cations, num_anions);
+    pitzer.B_phi.resize(num_cations, num_anions);
+    pitzer.B_prime.resize(num_cations, num_anions);
 
-    return F;
+    for(auto c = 0; c < num_cations; ++c)
+    {
+        for(auto a = 0; a < num_anions; ++a)
+        {
+            const auto zc    = pitzer.z_cations[c];
+            const auto za    = pitzer.z_anions[a];
+            const auto beta0 = pitzer.beta0_mat(c, a);
+            const auto beta1 = pitzer.beta1_mat(c, a);
+            const auto beta2 = pitzer.beta2_mat(c, a);
+
+            if(abs(zc) == 2 && abs(za) == 2)
+            {
+                pitzer.B(c, a)       = beta0 + beta1 * g1 + beta2 * g2;
+                pitzer.B_phi(c, a)   = beta0 + beta1 * e1 + beta2 * e2;
+                pitzer.B_prime(c, a) = beta1 * gp1/I + beta2 * gp2/I;
+            }
+            else
+            {
+                pitzer.B(c, a)       = beta0 + beta1 * g0;
+                pitzer.B_phi(c, a)   = beta0 + beta1 * e0;
+                pitzer.B_prime(c, a) = beta1 * gp0/I;
+            }
+        }
+    }
 }
 
 auto computeZ(const AqueousMixtureState& state, const PitzerParams& pitzer) -> real
@@ -1023,11 +1049,16 @@ auto computeZ(const AqueousMixtureState& state, const PitzerParams& pitzer) -> r
     return (mi * zi).sum();
 }
 
-/// Return the Pitzer activity coefficient of a cation (in natural log scale).
+/// Compute the Pitzer activity coefficients of all species (in natural log scale) and return the activity of water (in natural log scale).
+/// All terms of the Harvie-Moller-Weare Pitzer's model that depend on pairs of
+/// species (e.g., \eq{B_{ca}}, \eq{C_{ca}}, \eq{\Phi_{ij}}) are computed once
+/// and combined with matrix-vector products, and the terms of the ternary
+/// interaction parameters with loops over their non-zero entries only.
 /// @param state The state of the aqueous mixture
 /// @param pitzer The Pitzer parameters
-/// @param M The local index of the cation among all cations in the mixture
-auto lnActivityCoefficientCation(const AqueousMixtureState& state, const PitzerParams& pitzer, Index M) -> real
+/// @param iH2O The index of the water species
+/// @param[out] ln_g The activity coefficients of the species (in natural log scale), except water
+auto computeLnActivities(const AqueousMixtureState& state, PitzerParams& pitzer, Index iH2O, ArrayXrRef ln_g) -> real
 {
     // The indices of the neutral species, cations and anions
     const auto& idx_neutrals = pitzer.idx_neutrals;
@@ -1039,192 +1070,137 @@ auto lnActivityCoefficientCation(const AqueousMixtureState& state, const PitzerP
     const auto num_cations  = idx_cations.size();
     const auto num_anions   = idx_anions.size();
 
-    // The vector of molalities of all aqueous species
-    const auto& m = state.m;
-
-    // The number of species in the mixture
-    const auto nspecies = m.size();
-
-    // The electrical charge of the M-th cation
-    const auto zM = pitzer.z_cations[M];
-
-    // The terms F and Z of the Harvie-Moller-Weare Pitzer's model
-    const auto F = computeF(state, pitzer);
-    const auto Z = computeZ(state, pitzer);
-
-    // The log of the activity coefficient of the M-th cation
-    real ln_gammaM = {};
-
-    // Iterate over all anions
-    for(auto a = 0; a < num_anions; ++a)
-    {
-        const auto ma = m[idx_anions[a]];
-        const auto BMa = B(state, pitzer, M, a);
-        const auto CMa = C(state, pitzer, M, a);
+    // THe temperature and pressure in units of K and Pa respectively
+    const auto& T = state.T;
+    const auto& P = state.P;
 
-        ln_gammaM += ma * (2*BMa + Z*CMa);
-    }
+    // The molalities of all aqueous species
+    const auto& m = state.m;
 
-    // Iterate over all cations
-    for(auto c = 0; c < num_cations; ++c)
-    {
-        const auto mc = m[idx_cations[c]];
-        const auto PhiMc = Phi_cc(state, pitzer, M, c);
+    // The molalities of the neutral species, cations and anions
+    auto& mn = pitzer.mn;
+    auto& mc = pitzer.mc;
+    auto& ma = pitzer.ma;
 
-        real aux = 2*PhiMc;
+    mn = m(idx_neutrals).matrix();
+    mc = m(idx_cations).matrix();
+    ma = m(idx_anions).matrix();
 
-        // Iterate over all anions
-        for(auto a = 0; a < num_anions; ++a)
-        {
-            const auto ma = m[idx_anions[a]];
-            const auto psiMca = pitzer.psi_cca[M][c][a];
+    // The auxiliary vectors used below
+    auto& wc = pitzer.wc;
+    auto& wn = pitzer.wn;
 
-            aux += ma * psiMca;
-        }
+    // The ionic strength of the aqueous mixture and its square root
+    const auto I = state.Ie;
+    const auto sqrtI = sqrt(I);
 
-        ln_gammaM += mc * aux;
-    }
+    // The Debye-Huckel coefficient Aphi
+    const auto Aphi = pitzer.Aphi(T, P);
 
-    // Iterate over all pairs of distinct anions
-    for(auto i = 0; i < num_anions - 1; ++i) for(auto j = i + 1; j < num_anions; ++j)
-    {
-        const auto mi = m[idx_anions[i]];
-        const auto mj = m[idx_anions[j]];
-        const auto psi_ijM = pitzer.psi_aac[i][j][M];
+    // The b parameter of the Harvie-Moller-Weare Pitzer's model
+    const auto b = 1.2;
 
-        ln_gammaM += mi * mj * psi_ijM;
-    }
+    // Update the single-salt parameters and compute the matrices B, B_phi, B_prime, Phi, Phi_phi, Phi_prime
+    pitzer.updateSingleSaltParams(T);
 
-    // Iterate over all pairs of cations and anions
-    for(auto c = 0; c < num_cations; ++c) for(auto a = 0; a < num_anions; ++a)
-    {
-        const auto mc = m[idx_cations[c]];
-        const auto ma = m[idx_anions[a]];
-        const auto Cca = C(state, pitzer, c, a);
+    computeB(I, sqrtI, pitzer);
+    computePhi(I, sqrtI, Aphi, pitzer.z_cations, pitzer.theta_cc_mat, pitzer.Phi_cc, pitzer.Phi_phi_cc, pitzer.Phi_prime_cc);
+    computePhi(I, sqrtI, Aphi, pitzer.z_anions, pitzer.theta_aa_mat, pitzer.Phi_aa, pitzer.Phi_phi_aa, pitzer.Phi_prime_aa);
 
-        ln_gammaM += abs(zM) * mc * ma * Cca;
-    }
+    const auto& B         = pitzer.B;
+    const auto& B_phi     = pitzer.B_phi;
+    const auto& B_prime   = pitzer.B_prime;
+    const auto& C         = pitzer.C_mat;
+    const auto& lambda_nc = pitzer.lambda_nc_mat;
+    const auto& lambda_na = pitzer.lambda_na_mat;
+    const auto& psi_cca   = pitzer.psi_cca_entries;
+    const auto& psi_aac   = pitzer.psi_aac_entries;
+    const auto& zeta      = pitzer.zeta_entries;
 
-    // Iterate over all pairs of neutral species
-    for(auto n = 0; n < num_neutrals; ++n)
-        ln_gammaM += 2.0 * m[idx_neutrals[n]] * pitzer.lambda_nc[n][M];
+    // Calculate the term F of the Harvie-Moller-Weare Pitzer's model
+    real F = -Aphi * (sqrtI/(1 + b*sqrtI) + 2.0/b * log(1 + b*sqrtI));
 
-    // Finalize the calculation
-    ln_gammaM += zM*zM*F;
+    // Add the contributions of all pairs of cations and anions
+    wc.noalias() = B_prime * ma;
+    F += mc.dot(wc);
 
-    return ln_gammaM;
-}
+    // Add the contributions of all pairs of distinct cations
+    for(auto i = 0; i < num_cations; ++i) for(auto j = i + 1; j < num_cations; ++j)
+        F += mc[i] * mc[j] * pitzer.Phi_prime_cc(i, j);
 
-/// Return the Pitzer activity coefficient of an anion (in natural log scale).
-/// @param state The state of the aqueous mixture
-/// @param pitzer The Pitzer parameters
-/// @param X The local index of the anion among all anions in the mixture
-auto lnActivityCoefficientAnion(const AqueousMixtureState& state, const PitzerParams& pitzer, Index X) -> real
-{
-    // The indices of the neutral species, cations and anions
-    const auto& idx_neutrals = pitzer.idx_neutrals;
-    const auto& idx_cations  = pitzer.idx_cations;
-    const auto& idx_anions   = pitzer.idx_anions;
+    // Add the contributions of all pairs of distinct anions
+    for(auto i = 0; i < num_anions; ++i) for(auto j = i + 1; j < num_anions; ++j)
+        F += ma[i] * ma[j] * pitzer.Phi_prime_aa(i, j);
 
-    // The number of neutrals, cations and anions
-    const auto num_neutrals = idx_neutrals.size();
-    const auto num_cations  = idx_cations.size();
-    const auto num_anions   = idx_anions.size();
+    // The term Z of the Harvie-Moller-Weare Pitzer's model
+    const auto Z = computeZ(state, pitzer);
 
-    // The molalities of all aqueous species
-    const auto& m = state.m;
+    // The sum of the products mc*ma*Cca over all pairs of cations and anions
+    wc.noalias() = C * ma;
+    const real CSUM = mc.dot(wc);
 
-    // The number of species in the mixture
-    const auto nspecies = m.size();
+    // The matrix 2B + ZC used in the activity coefficients of both cations and anions
+    auto& BZC = pitzer.BZC;
+    BZC = 2.0*B + Z*C;
 
-    // The electrical charge of the X-th anion
-    const auto zX = pitzer.z_anions[X];
+    //=============================================================================================
+    // The activity coefficients of the cations
+    //=============================================================================================
+    auto& ln_gc = pitzer.ln_gc;
+    ln_gc.noalias() = BZC * ma;
+    ln_gc.noalias() += 2.0 * pitzer.Phi_cc * mc;
+    ln_gc.noalias() += 2.0 * lambda_nc.transpose() * mn;
 
-    // The terms F and Z of the Harvie-Moller-Weare Pitzer's model
-    const auto F = computeF(state, pitzer);
-    const auto Z = computeZ(state, pitzer);
+    for(auto k = 0; k < psi_cca.size(); ++k)
+        ln_gc[psi_cca.i[k]] += mc[psi_cca.j[k]] * ma[psi_cca.k[k]] * psi_cca.values[k];
 
-    // The log of the activity coefficient of the X-th anion
-    real ln_gammaX = {};
+    for(auto k = 0; k < psi_aac.size(); ++k)
+        if(psi_aac.i[k] < psi_aac.j[k])
+            ln_gc[psi_aac.k[k]] += ma[psi_aac.i[k]] * ma[psi_aac.j[k]] * psi_aac.values[k];
 
-    // Iterate over all cations
-    for(auto c = 0; c < num_cations; ++c)
+    for(auto M = 0; M < num_cations; ++M)
     {
-        const auto mc = m[idx_cations[c]];
-        const auto BcX = B(state, pitzer, c, X);
-        const auto CcX = C(state, pitzer, c, X);
-
-        ln_gammaX += mc * (2*BcX + Z*CcX);
+        const auto zM = pitzer.z_cations[M];
+        ln_g[idx_cations[M]] = ln_gc[M] + abs(zM)*CSUM + zM*zM*F;
     }
 
-    // Iterate over all anions
-    for(auto a = 0; a < num_anions; ++a)
-    {
-        const auto ma = m[idx_anions[a]];
-        const auto PhiXa = Phi_aa(state, pitzer, X, a);
-
-        real aux = 2*PhiXa;
-
-        // Iterate over all cations
-        for(auto c = 0; c < num_cations; ++c)
-        {
-            const auto mc = m[idx_cations[c]];
-            const auto psiXac = pitzer.psi_aac[X][a][c];
-
-            aux += mc * psiXac;
-        }
-
-        ln_gammaX += ma * aux;
-    }
+    //=============================================================================================
+    // The activity coefficients of the anions
+    //=============================================================================================
+    auto& ln_ga = pitzer.ln_ga;
+    ln_ga.noalias() = BZC.transpose() * mc;
+    ln_ga.noalias() += 2.0 * pitzer.Phi_aa * ma;
+    ln_ga.noalias() += 2.0 * lambda_na.transpose() * mn;
 
-    // Iterate over all pairs of distinct cations
-    for(auto i = 0; i < num_cations - 1; ++i) for(auto j = i + 1; j < num_cations; ++j)
-    {
-        const auto mi = m[idx_cations[i]];
-        const auto mj = m[idx_cations[j]];
-        const auto psi_ijX = pitzer.psi_cca[i][j][X];
+    for(auto k = 0; k < psi_aac.size(); ++k)
+        ln_ga[psi_aac.i[k]] += ma[psi_aac.j[k]] * mc[psi_aac.k[k]] * psi_aac.values[k];
 
-        ln_gammaX += mi * mj * psi_ijX;
-    }
+    for(auto k = 0; k < psi_cca.size(); ++k)
+        if(psi_cca.i[k] < psi_cca.j[k])
+            ln_ga[psi_cca.k[k]] += mc[psi_cca.i[k]] * mc[psi_cca.j[k]] * psi_cca.values[k];
 
-    // Iterate over all pairs of cations and anions
-    for(auto c = 0; c < num_cations; ++c) for(auto a = 0; a < num_anions; ++a)
+    for(auto X = 0; X < num_anions; ++X)
     {
-        const auto mc = m[idx_cations[c]];
-        const auto ma = m[idx_anions[a]];
-        const auto Cca = C(state, pitzer, c, a);
-
-        ln_gammaX += abs(zX) * mc * ma * Cca;
+        const auto zX = pitzer.z_anions[X];
+        ln_g[idx_anions[X]] = ln_ga[X] + abs(zX)*CSUM + zX*zX*F;
     }
 
-    // Iterate over all pairs of neutral species
-    for(auto n = 0; n < num_neutrals; ++n)
-        ln_gammaX += 2.0 * m[idx_neutrals[n]] * pitzer.lambda_na[n][X];
+    //=============================================================================================
+    // The activity coefficients of the neutral species
+    //=============================================================================================
+    auto& ln_gn = pitzer.ln_gn;
+    ln_gn.noalias() = 2.0 * lambda_nc * mc;
+    ln_gn.noalias() += 2.0 * lambda_na * ma;
 
-    // Finalize the calculation
-    ln_gammaX += zX*zX*F;
-
-    return ln_gammaX;
-}
-
-/// Return the Pitzer activity of water (in natural log scale).
-/// @param state The state of the aqueous mixture
-/// @param pitzer The Pitzer parameters
-/// @param iH2O The index of the water species
-auto lnActivityWater(const AqueousMixtureState& state, const PitzerParams& pitzer, Index iH2O) -> real
-{
-    // The indices of the neutral species, cations and anions
-    const auto& idx_neutrals = pitzer.idx_neutrals;
-    const auto& idx_cations  = pitzer.idx_cations;
-    const auto& idx_anions   = pitzer.idx_anions;
+    for(auto k = 0; k < zeta.size(); ++k)
+        ln_gn[zeta.i[k]] += mc[zeta.j[k]] * ma[zeta.k[k]] * zeta.values[k];
 
-    // The number of neutrals, cations and anions
-    const auto num_neutrals = idx_neutrals.size();
-    const auto num_cations  = idx_cations.size();
-    const auto num_anions   = idx_anions.size();
+    for(auto N = 0; N < num_neutrals; ++N)
+        ln_g[idx_neutrals[N]] = ln_gn[N];
 
-    // The vector of molalities of all aqueous species
-    const auto& m = state.m;
+    //=============================================================================================
+    // The activity of water
+    //=============================================================================================
 
     // Calculate the sum of molalities of the solutes
     const auto sum_mi = sum(m) - m[iH2O];
@@ -1233,98 +1209,43 @@ auto lnActivityWater(const AqueousMixtureState& state, const PitzerParams& pitze
     if(sum_mi == 0.0)
         return 0.0;
 
-    // The number of species in the mixture
-    const auto nspecies = m.size();
-
-    // The ionic strength of the aqueous mixture
-    const auto I = state.Ie;
-
-    // The square root of the ionic strength of the aqueous mixture
-    const auto sqrtI = sqrt(I);
-
     // The molar mass of water
     const auto Mw = state.m[iH2O];
 
-    // The Debye-Huckel coefficient Aphi
-    const auto Aphi = pitzer.Aphi(state.T, state.P);
-
-    // The b parameter of the Harvie-Moller-Weare Pitzer's model
-    const auto b = 1.2;
-
-    // The term Z of the Harvie-Moller-Weare Pitzer's model
-    const auto Z = computeZ(state, pitzer);
-
     // The osmotic coefficient of the aqueous mixture
     real phi = -Aphi*I*sqrtI/(1 + b*sqrtI);
 
-    // Iterate over all pairs of cations and anions
-    for(auto c = 0; c < num_cations; ++c) for(auto a = 0; a < num_anions; ++a)
-    {
-        const auto mc = m[idx_cations[c]];
-        const auto ma = m[idx_anions[a]];
-        const auto Bca = B_phi(state, pitzer, c, a);
-        const auto Cca = C(state, pitzer, c, a);
-
-        phi += mc * ma * (Bca + Z*Cca);
-    }
-
-    // Iterate over all pairs of distinct cations
-    for(auto i = 0; i < num_cations - 1; ++i) for(auto j = i + 1; j < num_cations; ++j)
-    {
-        const auto mi = m[idx_cations[i]];
-        const auto mj = m[idx_cations[j]];
-        const auto Phi_ij = Phi_phi_cc(state, pitzer, i, j);
-
-        real aux = Phi_ij;
-
-        // Iterate over all anions
-        for(auto a = 0; a < num_anions; ++a)
-        {
-            const auto ma = m[idx_anions[a]];
-            const auto psi_ija = pitzer.psi_cca[i][j][a];
-
-            aux += ma * psi_ija;
-        }
-
-        phi += mi * mj * aux;
-    }
-
-    // Iterate over all pairs of distinct anions
-    for(auto i = 0; i < num_anions - 1; ++i) for(auto j = i + 1; j < num_anions; ++j)
-    {
-        const auto mi = m[idx_anions[i]];
-        const auto mj = m[idx_anions[j]];
-        const auto Phi_ij = Phi_phi_aa(state, pitzer, i, j);
+    // Add the contributions of all pairs of cations and anions
+    BZC = B_phi + Z*C;
+    wc.noalias() = BZC * ma;
+    phi += mc.dot(wc);
 
-        real aux = Phi_ij;
+    // Add the contributions of all pairs of distinct cations and of distinct anions
+    for(auto i = 0; i < num_cations; ++i) for(auto j = i + 1; j < num_cations; ++j)
+        phi += mc[i] * mc[j] * pitzer.Phi_phi_cc(i, j);
 
-        // Iterate over all cations
-        for(auto c = 0; c < num_cations; ++c)
-        {
-            const auto mc = m[idx_cations[c]];
-            const auto psi_ija = pitzer.psi_aac[i][j][c];
-
-            aux += mc * psi_ija;
-        }
+    for(auto i = 0; i < num_anions; ++i) for(auto j = i + 1; j < num_anions; ++j)
+        phi += ma[i] * ma[j] * pitzer.Phi_phi_aa(i, j);
 
-        phi += mi * mj * aux;
-    }
+    // Add the contributions of the psi parameters of all triplets of two distinct cations and an anion
+    for(auto k = 0; k < psi_cca.size(); ++k)
+        if(psi_cca.i[k] < psi_cca.j[k])
+            phi += mc[psi_cca.i[k]] * mc[psi_cca.j[k]] * ma[psi_cca.k[k]] * psi_cca.values[k];
 
-    // Iterate over all pairs of neutral species and cations
-    for(auto n = 0; n < num_neutrals; ++n)
-        for(auto c = 0; c < num_cations; ++c)
-            phi += m[idx_neutrals[n]] * m[idx_cations[c]] * pitzer.lambda_nc[n][c];
+    // Add the contributions of the psi parameters of all triplets of two distinct anions and a cation
+    for(auto k = 0; k < psi_aac.size(); ++k)
+        if(psi_aac.i[k] < psi_aac.j[k])
+            phi += ma[psi_aac.i[k]] * ma[psi_aac.j[k]] * mc[psi_aac.k[k]] * psi_aac.values[k];
 
-    // Iterate over all pairs of neutral species and anions
-    for(auto n = 0; n < num_neutrals; ++n)
-        for(auto a = 0; a < num_anions; ++a)
-            phi += m[idx_neutrals[n]] * m[idx_anions[a]] * pitzer.lambda_na[n][a];
+    // Add the contributions of all pairs of neutral species and ions
+    wn.noalias() = lambda_nc * mc;
+    phi += mn.dot(wn);
+    wn.noalias() = lambda_na * ma;
+    phi += mn.dot(wn);
 
-    // Iterate over all triplets of neutral species, cations and anions
-    for(auto n = 0; n < num_neutrals; ++n)
-        for(auto c = 0; c < num_cations; ++c)
-            for(auto a = 0; a < num_anions; ++a)
-                phi += m[idx_neutrals[n]] * m[idx_cations[c]] * m[idx_anions[a]] * pitzer.zeta[n][c][a];
+    // Add the contributions of all triplets of neutral species, cations and anions
+    for(auto k = 0; k < zeta.size(); ++k)
+        phi += mn[zeta.i[k]] * mc[zeta.j[k]] * ma[zeta.k[k]] * zeta.values[k];
 
     // Finalise the calculation of the osmotic coefficient
     phi = 1 + 2.0/sum_mi * phi;
@@ -1335,45 +1256,6 @@ auto lnActivityWater(const AqueousMixtureState& state, const PitzerParams& pitze
     return ln_aw;
 }
 
-/// Return the Pitzer activity coefficient of a neutral species (in natural log scale).
-/// @param state The state of the aqueous mixture
-/// @param pitzer The Pitzer parameters
-/// @param N The local index of the neutral species among all neutral species in the mixture
-auto lnActivityCoefficientNeutral(const AqueousMixtureState& state, const PitzerParams& pitzer, Index N) -> real
-{
-    // The indices of the neutral species, cations and anions
-    const auto& idx_cations  = pitzer.idx_cations;
-    const auto& idx_anions   = pitzer.idx_anions;
-
-    // The number of neutrals, cations and anions
-    const auto num_cations  = idx_cations.size();
-    const auto num_anions   = idx_anions.size();
-
-    // The vector of molalities of all aqueous species
-    const auto& m = state.m;
-
-    // The number of species in the mixture
-    const auto nspecies = m.size();
-
-    // The log of the activity coefficient of the N-th neutral species
-    real ln_gammaN = {};
-
-    // Iterate over all cations
-    for(auto c = 0; c < num_cations; ++c)
-        ln_gammaN += 2.0 * m[idx_cations[c]] * pitzer.lambda_nc[N][c];
-
-    // Iterate over all anions
-    for(auto a = 0; a < num_anions; ++a)
-        ln_gammaN += 2.0 * m[idx_anions[a]] * pitzer.lambda_na[N][a];
-
-    // Iterate over all pairs of cations and anions
-    for(auto c = 0; c < num_cations; ++c)
-        for(auto a = 0; a < num_anions; ++a)
-            ln_gammaN += m[idx_cations[c]] * m[idx_anions[a]] * pitzer.zeta[N][c][a];
-
-    return ln_gammaN;
-}
-
 } // namespace Pitzer
 
 auto activityModelPitzerHMW(const SpeciesList& species) -> ActivityModel
@@ -1400,47 +1282,18 @@ auto activityModelPitzerHMW(const SpeciesList& species) -> ActivityModel
         const auto& [T, P, x] = args;
 
         // Evaluate the state of the aqueous mixture
-        auto const& state = *stateptr = mixture.state(T, P, x);
+        mixture.state(T, P, x, *stateptr);
+        auto const& state = *stateptr;
 
         // Set the state of matter of the phase
         props.som = StateOfMatter::Liquid;
 
         // Export the aqueous mixture and its state via the `extra` data member
-        props.extra["AqueousMixtureState"] = stateptr;
-        props.extra["AqueousMixture"] = mixtureptr;
-
-        // Calculate the activity coefficients of the cations
-        for(auto M = 0; M < pitzer.idx_cations.size(); ++M)
-        {
-            // Get the global index of the cation in the mixture
-            const Index i = pitzer.idx_cations[M];
-
-            // Set the activity coefficient of the i-th species
-            props.ln_g[i] = lnActivityCoefficientCation(state, pitzer, M);
-        }
-
-        // Calculate the activity coefficients of the anions
-        for(auto X = 0; X < pitzer.idx_anions.size(); ++X)
-        {
-            // Get the global index of the anion in the mixture
-            const Index i = pitzer.idx_anions[X];
-
-            // Set the activity coefficient of the i-th species
-            props.ln_g[i] = lnActivityCoefficientAnion(state, pitzer, X);
-        }
-
-        // Calculate the activity coefficients of the neutral species
-        for(auto N = 0; N < pitzer.idx_neutrals.size(); ++N)
-        {
-            // Get the global index of the neutral species in the mixture
-            const Index i = pitzer.idx_neutrals[N];
-
-            // Set the activity coefficient of the i-th species
-            props.ln_g[i] = lnActivityCoefficientNeutral(state, pitzer, N);
-        }
+        props.extra.set(slotAqueousMixtureState(), stateptr);
+        props.extra.set(slotAqueousMixture(), mixtureptr);
 
-        // Calculate the activity of water
-        const real ln_aw = lnActivityWater(state, pitzer, iwater);
+        // Calculate the activity coefficients of the cations, anions and neutral species, and the activity of water
+        const real ln_aw = computeLnActivities(state, pitzer, iwater, props.ln_g);
 
         // The mole fraction of water
         const auto xw = x[iwater];
@@ -19,6 +19,7 @@
 #include <catch2/catch.hpp>
 
 // Reaktoro includes
+#include <Reaktoro/Common/AutoDiff.hpp>
 #include <Reaktoro/Models/ActivityModels/ActivityModelPitzerHMW.hpp>
 #include <Reaktoro/Water/WaterConstants.hpp>
 using namespace Reaktoro;
@@ -90,4 +91,86 @@ TEST_CASE("Testing ActivityModelPitzerHMW", "[ActivityModelPitzerHMW]")
     // CHECK( exp(props.ln_g[11]) == Approx(1.0000000000) ); // NaOH
 
     // checkActivities(x, props);
+
+    WHEN("high salinity brine at moderate temperature")
+    {
+        // The expected values below were computed with the implementation
+        // before the pair terms were evaluated once per evaluation.
+        const auto species = SpeciesList("H2O H+ OH- Na+ K+ Ca+2 Mg+2 Cl- SO4-2 HCO3- CO3-2 CO2");
+
+        real T = 60.0 + 273.15;
+        real P = 1.0e+5;
+
+        const auto n = ArrayXr{{
+            5.55080e+01, // H2O
+            1.00000e-07, // H+
+            1.00000e-07, // OH-
+            5.00000e+00, // Na+
+            2.00000e-01, // K+
+            5.00000e-01, // Ca+2
+            3.00000e-01, // Mg+2
+            6.40000e+00, // Cl-
+            1.50000e-01, // SO4-2
+            1.00000e-02, // HCO3-
+            1.00000e-03, // CO3-2
+            5.00000e-02, // CO2
+        }};
+
+        ArrayXr x = n / n.sum();
+
+        // Construct the activity props function with the given aqueous species.
+        ActivityModel fn = ActivityModelPitzerHMW()(species);
+
+        // Create the ActivityProps object with the results.
+        ActivityProps props = ActivityProps::create(species.size());
+
+        // Evaluate the activity props function
+        fn(props, {T, P, x});
+
+        CHECK( props.ln_g[1]  == Approx( 1.201249472e+00) ); // H+
+        CHECK( props.ln_g[2]  == Approx(-1.248112171e+00) ); // OH-
+        CHECK( props.ln_g[3]  == Approx(-1.471106367e-01) ); // Na+
+        CHECK( props.ln_g[4]  == Approx(-7.187918228e-01) ); // K+
+        CHECK( props.ln_g[5]  == Approx(-8.596976177e-01) ); // Ca+2
+        CHECK( props.ln_g[6]  == Approx(-3.758986067e-01) ); // Mg+2
+        CHECK( props.ln_g[7]  == Approx( 3.098414101e-01) ); // Cl-
+        CHECK( props.ln_g[8]  == Approx(-3.904669605e+00) ); // SO4-2
+        CHECK( props.ln_g[9]  == Approx(-7.873757252e-02) ); // HCO3-
+        CHECK( props.ln_g[10] == Approx(-4.426219414e+00) ); // CO3-2
+        CHECK( props.ln_g[11] == Approx( 8.064063204e-01) ); // CO2
+
+        // Evaluate the activity props function with temperature seeded
+        autodiff::seed(T);
+        fn(props, {T, P, x});
+        autodiff::unseed(T);
+
+        CHECK( grad(props.ln_g[1])  == Approx(-5.704705290e-03) ); // H+
+        CHECK( grad(props.ln_g[2])  == Approx(-3.875532320e-03) ); // OH-
+        CHECK( grad(props.ln_g[3])  == Approx(-2.130649495e-03) ); // Na+
+        CHECK( grad(props.ln_g[4])  == Approx( 2.102033970e-03) ); // K+
+        CHECK( grad(props.ln_g[5])  == Approx(-1.304600015e-02) ); // Ca+2
+        CHECK( grad(props.ln_g[6])  == Approx(-1.977243459e-02) ); // Mg+2
+        CHECK( grad(props.ln_g[7])  == Approx(-2.997678575e-03) ); // Cl-
+        CHECK( grad(props.ln_g[8])  == Approx( 7.166446908e-03) ); // SO4-2
+        CHECK( grad(props.ln_g[9])  == Approx( 6.559624592e-03) ); // HCO3-
+        CHECK( grad(props.ln_g[10]) == Approx( 4.296743470e-03) ); // CO3-2
+        CHECK( grad(props.ln_g[11]) == Approx( 0.000000000e+00) ); // CO2
+
+        // Evaluate the activity props function with the mole fraction of Na+ seeded
+        autodiff::seed(x[3]);
+        fn(props, {T, P, x});
+        autodiff::unseed(x[3]);
+
+        CHECK( grad(props.ln_g[1])  == Approx( 1.896488859e+00) ); // H+
+        CHECK( grad(props.ln_g[2])  == Approx( 1.125572071e+01) ); // OH-
+        CHECK( grad(props.ln_g[3])  == Approx(-2.552438549e+00) ); // Na+
+        CHECK( grad(props.ln_g[4])  == Approx(-4.980684328e+00) ); // K+
+        CHECK( grad(props.ln_g[5])  == Approx(-1.744420039e+01) ); // Ca+2
+        CHECK( grad(props.ln_g[6])  == Approx(-1.745792727e+01) ); // Mg+2
+        CHECK( grad(props.ln_g[7])  == Approx( 1.125017357e+01) ); // Cl-
+        CHECK( grad(props.ln_g[8])  == Approx( 1.242315238e+01) ); // SO4-2
+        CHECK( grad(props.ln_g[9])  == Approx( 7.456068058e-02) ); // HCO3-
+        CHECK( grad(props.ln_g[10]) == Approx( 2.286657091e+01) ); // CO3-2
+        CHECK( grad(props.ln_g[11]) == Approx( 1.158032080e+01) ); // CO2
+    }
 }
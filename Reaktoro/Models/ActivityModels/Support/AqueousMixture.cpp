@@ -22,6 +22,8 @@
 
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
+#include <Reaktoro/Common/AutoDiff.hpp>
+#include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Singletons/DissociationReactions.hpp>
 #include <Reaktoro/Water/WaterElectroProps.hpp>
 #include <Reaktoro/Water/WaterElectroPropsJohnsonNorton.hpp>
@@ -181,29 +183,32 @@ struct AqueousMixture::Impl
                 dissociation_matrix(i, j) = stoichiometry(i, j);
     }
 
-    /// Return the molalities of the aqueous species with given mole fractions.
-    auto molalities(ArrayXrConstRef x) const -> ArrayXr
+    /// Compute the molalities of the aqueous species with given mole fractions.
+    auto molalities(ArrayXrConstRef x, ArrayXrRef m) const -> void
     {
         const auto xw = x[idx_water];
         const auto Mw = water.molarMass();
-        if(xw == 0.0)
-            return ArrayXr::Zero(x.size());
-        return x/(Mw * xw);
+        if(xw == 0.0) m.fill(0.0);
+        else m = x/(Mw * xw);
     }
 
-    /// Return the stoichiometric molalities of the charged species with given molalities.
-    auto stoichiometricMolalities(ArrayXrConstRef m) const -> ArrayXr
+    /// Compute the stoichiometric molalities of the charged species with given molalities.
+    auto stoichiometricMolalities(ArrayXrConstRef m, ArrayXrRef ms) const -> void
     {
-        // The molalities of the charged species
-        const auto mc = m(idx_charged_species).matrix(); // convert from array to matrix expression
-
-        // The molalities of the neutral species
-        const auto mn = m(idx_neutral_species).matrix(); // convert from array to matrix expression
-
-        // The stoichiometric molalities of the charged species
-        const auto ms = mc + dissociation_matrix.transpose() * mn;
+        const auto num_charged_species = idx_charged_species.size();
+        const auto num_neutral_species = idx_neutral_species.size();
 
-        return ms;
+        // The stoichiometric molalities of the charged species computed
+        // without temporaries as ms = mc + tr(D) * mn, where D is the
+        // dissociation matrix and mc and mn are the molalities of the
+        // charged and neutral species
+        for(auto j = 0; j < num_charged_species; ++j)
+        {
+            ms[j] = m[idx_charged_species[j]];
+            for(auto i = 0; i < num_neutral_species; ++i)
+                if(dissociation_matrix(i, j) != 0.0)
+                    ms[j] += dissociation_matrix(i, j) * m[idx_neutral_species[i]];
+        }
     }
 
     /// Return the effective ionic strength of the aqueous mixture with given molalities.
@@ -219,19 +224,27 @@ struct AqueousMixture::Impl
         return 0.5 * (zc * zc * ms).sum();
     }
 
-    /// Return the state of the aqueous mixture.
-    auto state(real T, real P, ArrayXrConstRef x) const -> AqueousMixtureState
+    /// Update the state of the aqueous mixture in place.
+    auto state(real const& T, real const& P, ArrayXrConstRef x, AqueousMixtureState& state) const -> void
     {
-        AqueousMixtureState state;
-        state.T = T;
-        state.P = P;
-        state.rho = rho(T, P);
-        state.epsilon = epsilon(T, P);
-        state.m  = molalities(x);
-        state.ms = stoichiometricMolalities(state.m);
+        // Evaluate the density and dielectric constant of water only if temperature or pressure have changed
+        const auto same = [](real const& a, real const& b) { return a == b && grad(a) == grad(b); };
+        if(!same(state.T, T) || !same(state.P, P))
+        {
+            state.T = T;
+            state.P = P;
+            state.rho = rho(T, P);
+            state.epsilon = epsilon(T, P);
+        }
+
+        // Resize the arrays of molalities only when needed (no heap allocation when state is reused)
+        state.m.resize(x.size());
+        state.ms.resize(idx_charged_species.size());
+
+        molalities(x, state.m);
+        stoichiometricMolalities(state.m, state.ms);
         state.Ie = effectiveIonicStrength(state.m);
         state.Is = stoichiometricIonicStrength(state.ms);
-        return state;
     }
 };
 
@@ -336,7 +349,28 @@ auto AqueousMixture::charges() const -> ArrayXdConstRef
 
 auto AqueousMixture::state(real T, real P, ArrayXrConstRef x) const -> AqueousMixtureState
 {
-    return pimpl->state(T, P, x);
+    AqueousMixtureState res;
+    res.T = NaN;
+    res.P = NaN;
+    pimpl->state(T, P, x, res);
+    return res;
+}
+
+auto AqueousMixture::state(real const& T, real const& P, ArrayXrConstRef x, AqueousMixtureState& res) const -> void
+{
+    pimpl->state(T, P, x, res);
+}
+
+auto slotAqueousMixtureState() -> SlotKey<AqueousMixtureState> const&
+{
+    static const SlotKey<AqueousMixtureState> key;
+    return key;
+}
+
+auto slotAqueousMixture() -> SlotKey<AqueousMixture> const&
+{
+    static const SlotKey<AqueousMixture> key;
+    return key;
 }
 
 } // namespace Reaktoro
@@ -19,6 +19,7 @@
 
 // Reaktoro includes
 #include <Reaktoro/Common/Matrix.hpp>
+#include <Reaktoro/Common/SlotMap.hpp>
 #include <Reaktoro/Common/Types.hpp>
 #include <Reaktoro/Core/SpeciesList.hpp>
 
@@ -133,10 +134,27 @@ public:
     /// @param x The mole fractions of the species in the mixture
     auto state(real T, real P, ArrayXrConstRef x) const -> AqueousMixtureState;
 
+    /// Calculate the state of the aqueous mixture in place.
+    /// This method reuses the memory of the arrays in @p state and skips the
+    /// evaluation of the density and dielectric constant of water when
+    /// temperature and pressure are the same as those in @p state. Thus,
+    /// @p state should be updated always with the same AqueousMixture object.
+    /// @param T The temperature (in K)
+    /// @param P The pressure (in Pa)
+    /// @param x The mole fractions of the species in the mixture
+    /// @param[in,out] state The state of the aqueous mixture to be updated
+    auto state(real const& T, real const& P, ArrayXrConstRef x, AqueousMixtureState& state) const -> void;
+
 private:
     struct Impl;
 
     SharedPtr<Impl> pimpl;
 };
 
+/// Return the slot key under which aqueous activity models export their AqueousMixtureState.
+auto slotAqueousMixtureState() -> SlotKey<AqueousMixtureState> const&;
+
+/// Return the slot key under which aqueous activity models export their AqueousMixture.
+auto slotAqueousMixture() -> SlotKey<AqueousMixture> const&;
+
 } // namespace Reaktoro
@@ -55,6 +55,7 @@ void exportAqueousMixture(py::module& m)
         .def("indexWater", &AqueousMixture::indexWater, "Return the index of the solvent species in the mixture.")
         .def("charges", &AqueousMixture::charges, "Return the electric charges of the aqueous species in the mixture.")
         .def("dissociationMatrix", &AqueousMixture::dissociationMatrix, "Return the dissociation matrix of the neutral species into charged species.")
-        .def("state", &AqueousMixture::state, "Calculate the state of the aqueous mixture.")
+        .def("state", py::overload_cast<real, real, ArrayXrConstRef>(&AqueousMixture::state, py::const_), "Calculate the state of the aqueous mixture.")
+        .def("state", py::overload_cast<real const&, real const&, ArrayXrConstRef, AqueousMixtureState&>(&AqueousMixture::state, py::const_), "Calculate the state of the aqueous mixture in place.")
         ;
 }
@@ -19,6 +19,7 @@
 #include <catch2/catch.hpp>
 
 // Reaktoro includes
+#include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Singletons/DissociationReactions.hpp>
 #include <Reaktoro/Models/ActivityModels/Support/AqueousMixture.hpp>
 #include <Reaktoro/Water/WaterConstants.hpp>
@@ -121,5 +122,59 @@ TEST_CASE("Testing AqueousMixture class", "[AqueousMixture]")
 
         REQUIRE( state.m.isApprox(m)   );
         REQUIRE( state.ms.isApprox(ms) );
+
+        // Test AqueousMixture::state method that updates an existing AqueousMixtureState object in place
+        AqueousMixtureState other;
+        other.T = NaN;
+        other.P = NaN;
+
+        mixture.state(T, P, x, other);
+
+        REQUIRE( other.T       == state.T       );
+        REQUIRE( other.P       == state.P       );
+        REQUIRE( other.rho     == state.rho     );
+        REQUIRE( other.epsilon == state.epsilon );
+        REQUIRE( other.Ie      == Approx(Ie)    );
+        REQUIRE( other.Is      == Approx(Is)    );
+
+        REQUIRE( other.m.isApprox(m)   );
+        REQUIRE( other.ms.isApprox(ms) );
+
+        // Check the arrays in the state are reused when updating it with new mole fractions
+        const auto mptr  = other.m.data();
+        const auto msptr = other.ms.data();
+
+        const ArrayXr xnew = moleFractions(species.size());
+
+        mixture.state(T, P, xnew, other);
+
+        REQUIRE( other.m.data()  == mptr  );
+        REQUIRE( other.ms.data() == msptr );
+
+        REQUIRE( other.m.isApprox(mixture.state(T, P, xnew).m)   );
+        REQUIRE( other.ms.isApprox(mixture.state(T, P, xnew).ms) );
+
+        // Check the density of water is reevaluated only when temperature or pressure changes
+        auto counter = 0;
+        const auto mixture2 = mixture.withWaterDensityFn([&](real T, real P) { ++counter; return 1000.0 + T; });
+
+        AqueousMixtureState state2;
+        state2.T = NaN;
+        state2.P = NaN;
+
+        mixture2.state(T, P, x, state2);
+
+        REQUIRE( state2.rho == Approx(1000.0 + T) );
+        REQUIRE( counter == 1 );
+
+        mixture2.state(T, P, xnew, state2);
+
+        REQUIRE( counter == 1 );
+
+        mixture2.state(T + 10.0, P, x, state2);
+
+        REQUIRE( state2.T   == T + 10.0 );
+        REQUIRE( state2.rho == Approx(1000.0 + T + 10.0) );
+        REQUIRE( counter == 2 );
     }
 }
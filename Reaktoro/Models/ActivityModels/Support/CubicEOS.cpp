@@ -22,6 +22,7 @@
 
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
+#include <Reaktoro/Common/AutoDiff.hpp>
 #include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Core/StateOfMatter.hpp>
@@ -346,6 +347,9 @@ struct Equation::Impl
     /// The chemical formulas of the substances in the fluid phase.
     Strings const substances;
 
+    /// The parameters on which the temperature-dependent data below depend (e.g., \eq{\Omega}, \eq{\Psi}, and those in the alpha and bip models).
+    Vec<Param> params;
+
     // Auxiliary arrays
 
     ArrayXr a;
@@ -360,6 +364,17 @@ struct Equation::Impl
     ArrayXr bbar;
     Bip bip;
 
+    // Auxiliary data that depend only on temperature and parameters, cached between calls with same T
+
+    real Tcached = NaN;  ///< The temperature at which the temperature-dependent data was last computed.
+    ArrayXr paramvals;   ///< The values of the parameters in `params` when the temperature-dependent data was last computed.
+    MatrixXr aij;        ///< The mixing matrix with entries \eq{a_{ij}=(1-k_{ij})(a_{i}a_{j})^{1/2}}.
+    MatrixXr aijT;       ///< The first-order temperature derivative of \eq{a_{ij}}.
+    MatrixXr aijTT;      ///< The second-order temperature derivative of \eq{a_{ij}}.
+    VectorXr ax;         ///< The auxiliary vector with entries \eq{\sum_{j}a_{ij}x_{j}}.
+    VectorXr axT;        ///< The auxiliary vector with entries \eq{\sum_{j}a_{ij,T}x_{j}}.
+    VectorXr axTT;       ///< The auxiliary vector with entries \eq{\sum_{j}a_{ij,TT}x_{j}}.
+
     /// Construct an Equation::Impl object.
     Impl(EquationSpecs const& eqspecs)
     : eqspecs(eqspecs),
@@ -384,17 +399,39 @@ struct Equation::Impl
         bip.k   = zeros(nspecies, nspecies);
         bip.kT  = zeros(nspecies, nspecies);
         bip.kTT = zeros(nspecies, nspecies);
+        aij     = zeros(nspecies, nspecies);
+        aijT    = zeros(nspecies, nspecies);
+        aijTT   = zeros(nspecies, nspecies);
+
+        params = { eqspecs.eqmodel.Omega, eqspecs.eqmodel.Psi };
+        for(auto const& param : eqspecs.eqmodel.alphafn.params())
+            params.push_back(param);
+        for(auto const& param : eqspecs.bipmodel.params())
+            params.push_back(param);
+
+        paramvals = zeros(params.size());
     }
 
-    auto compute(Props& props, real const& T, real const& P, ArrayXrConstRef const& x) -> void
+    /// Return true if the cached temperature-dependent data was computed with given temperature and current values of the parameters.
+    /// The derivatives carried by the temperature and the parameters are also compared, so that a change in seeding invalidates the cache.
+    auto isTemperatureDependentDataCurrent(real const& T) const -> bool
     {
-        // Check if the mole fractions are zero or non-initialized
-        if(x.size() == 0 || x.maxCoeff() <= 0.0)
-            return;
+        auto same = [](real const& u, real const& v) { return u == v && grad(u) == grad(v); };
+
+        if(!same(T, Tcached))
+            return false;
 
+        for(auto i = 0; i < params.size(); ++i)
+            if(!same(params[i].value(), paramvals[i]))
+                return false;
+
+        return true;
+    }
+
+    /// Compute the data of the cubic equation of state that depend only on temperature (i.e., \eq{a_i}, \eq{b_i}, \eq{k_{ij}} and \eq{a_{ij}}).
+    auto updateTemperatureDependentData(real const& T) -> void
+    {
         // Auxiliary references
-        auto const& sigma   = eqspecs.eqmodel.sigma.value();
-        auto const& epsilon = eqspecs.eqmodel.epsilon.value();
         auto const& Omega   = eqspecs.eqmodel.Omega.value();
         auto const& Psi     = eqspecs.eqmodel.Psi.value();
         auto const& alphafn = eqspecs.eqmodel.alphafn;
@@ -413,59 +450,79 @@ struct Equation::Impl
             aT[k]      = factor*alphaTk;
             aTT[k]     = factor*alphaTTk;
             b[k]       = Omega*R*Tcr[k]/Pcr[k]; // Eq. (3.44)
+            bbar[k]    = b[k]; // see Eq. (13.95) and unnumbered equation before Eq. (13.99)
         }
 
         // Calculate the binary interaction parameters and its temperature derivatives
         if(eqspecs.bipmodel.initialized())
             eqspecs.bipmodel(bip, { substances, T, Tcr, Pcr, omega, a, aT, aTT, alpha, alphaT, alphaTT, b });
 
-        // Calculate the parameter `amix` of the phase and the partial molar parameters `abar` of each species
-        real amix = {};
-        real amixT = {};
-        real amixTT = {};
-        abar.fill(0.0);
-        abarT.fill(0.0);
+        // Calculate the matrices aij, aijT, aijTT, with s = sqrt(a[i]*a[j]) and its derivatives evaluated only for j >= i since s is symmetric
         for(auto i = 0; i < nspecies; ++i)
         {
-            for(auto j = 0; j < nspecies; ++j)
+            for(auto j = i; j < nspecies; ++j)
             {
-                auto const r   = 1.0 - bip.k(i, j);
-                auto const rT  = -bip.kT(i, j);
-                auto const rTT = -bip.kTT(i, j);
-
                 auto const s   = sqrt(a[i]*a[j]); // Eq. (13.93)
                 auto const sT  = 0.5*s/(a[i]*a[j]) * (aT[i]*a[j] + a[i]*aT[j]);
                 auto const sTT = 0.5*s/(a[i]*a[j]) * (aTT[i]*a[j] + 2*aT[i]*aT[j] + a[i]*aTT[j]) - sT*sT/s;
 
-                auto const aij   = r*s;
-                auto const aijT  = rT*s + r*sT;
-                auto const aijTT = rTT*s + 2.0*rT*sT + r*sTT;
+                auto const rij   = 1.0 - bip.k(i, j);
+                auto const rijT  = -bip.kT(i, j);
+                auto const rijTT = -bip.kTT(i, j);
+
+                aij(i, j)   = rij*s;
+                aijT(i, j)  = rijT*s + rij*sT;
+                aijTT(i, j) = rijTT*s + 2.0*rijT*sT + rij*sTT;
 
-                amix   += x[i] * x[j] * aij; // Eq. (13.92) of Smith et al. (2017)
-                amixT  += x[i] * x[j] * aijT;
-                amixTT += x[i] * x[j] * aijTT;
+                if(i == j)
+                    continue;
 
-                abar[i]  += 2 * x[j] * aij;  // see Eq. (13.94)
-                abarT[i] += 2 * x[j] * aijT;
+                auto const rji   = 1.0 - bip.k(j, i);
+                auto const rjiT  = -bip.kT(j, i);
+                auto const rjiTT = -bip.kTT(j, i);
+
+                aij(j, i)   = rji*s;
+                aijT(j, i)  = rjiT*s + rji*sT;
+                aijTT(j, i) = rjiTT*s + 2.0*rjiT*sT + rji*sTT;
             }
         }
 
-        // Finalize the calculation of `abar` and `abarT`
-        for(auto i = 0; i < nspecies; ++i)
-        {
-            abar[i] -= amix;
-            abarT[i] -= amixT;
-        }
+        Tcached = T;
+        for(auto i = 0; i < params.size(); ++i)
+            paramvals[i] = params[i].value();
+    }
 
-        // Calculate the parameters bba[i] and bmix of the cubic equation of state
-        //     bbar[i] = Omega*R*Tc[i]/Pc[i] as shown in Eq. (3.44)
-        //     bmix = sum(x[i] * bbar[i])
-        real bmix = {};
-        for(auto i = 0; i < nspecies; ++i)
-        {
-            bbar[i] = Omega*R*Tcr[i]/Pcr[i]; // see Eq. (13.95) and unnumbered equation before Eq. (13.99)
-            bmix += x[i] * bbar[i];  // Eq. (13.91) of Smith et al. (2017)
-        }
+    auto compute(Props& props, real const& T, real const& P, ArrayXrConstRef const& x) -> void
+    {
+        // Check if the mole fractions are zero or non-initialized
+        if(x.size() == 0 || x.maxCoeff() <= 0.0)
+            return;
+
+        // Auxiliary references
+        auto const& sigma   = eqspecs.eqmodel.sigma.value();
+        auto const& epsilon = eqspecs.eqmodel.epsilon.value();
+
+        // Update the data that depend only on temperature, unless these were computed before for the same temperature and parameters
+        if(!isTemperatureDependentDataCurrent(T))
+            updateTemperatureDependentData(T);
+
+        // Calculate the parameter `amix` of the phase and the partial molar parameters `abar` of each species using
+        //     amix = sum(x[i] * x[j] * aij) as in Eq. (13.92) of Smith et al. (2017)
+        //     abar[i] = 2 * sum(x[j] * aij) - amix as in Eq. (13.94)
+        // with the matrix-vector products of the cached matrices aij, aijT, aijTT and x
+        ax.noalias()   = aij * x.matrix();
+        axT.noalias()  = aijT * x.matrix();
+        axTT.noalias() = aijTT * x.matrix();
+
+        const real amix   = x.matrix().dot(ax);
+        const real amixT  = x.matrix().dot(axT);
+        const real amixTT = x.matrix().dot(axTT);
+
+        abar  = 2.0*ax.array() - amix;
+        abarT = 2.0*axT.array() - amixT;
+
+        // Calculate the parameter bmix of the cubic equation of state, with bbar[i] = Omega*R*Tc[i]/Pc[i] as shown in Eq. (3.44)
+        const real bmix = (x * bbar).sum(); // Eq. (13.91) of Smith et al. (2017)
 
         // Calculate the temperature and pressure derivatives of bmix
         const auto bmixT = 0.0; // no temperature dependence!
@@ -89,6 +89,36 @@ TEST_CASE("Testing CubicEOS::Equation class", "[CubicEOS]")
 
             CHECK( props.som == StateOfMatter::Supercritical );
         }
+
+        WHEN("Composition, temperature and parameters change between calls")
+        {
+            // Compare the results of an Equation object reused across calls (with
+            // cached temperature-dependent data) with those of a new Equation object
+            auto checkSameAsNewEquation = [&](real const& T, real const& P, ArrayXrConstRef x)
+            {
+                CubicEOS::Props expected;
+                CubicEOS::Equation(eqspecs).compute(expected, T, P, x);
+
+                equation.compute(props, T, P, x);
+
+                CHECK( props.V == Approx(expected.V) );
+                CHECK( props.Gres == Approx(expected.Gres) );
+                CHECK( props.Hres == Approx(expected.Hres) );
+                CHECK( props.Cpres == Approx(expected.Cpres) );
+                CHECK( props.ln_phi.isApprox(expected.ln_phi) );
+            };
+
+            const auto T = 60.0 + 273.15; // 60 °C
+            const auto P = 100.0 * 1e5;   // 100 bar
+
+            checkSameAsNewEquation(T, P, x);
+            checkSameAsNewEquation(T, P, ArrayXr{{0.10, 0.80, 0.10}});
+            checkSameAsNewEquation(T, 2*P, ArrayXr{{0.30, 0.30, 0.40}});
+            checkSameAsNewEquation(T + 10.0, P, ArrayXr{{0.30, 0.30, 0.40}});
+
+            eqspecs.eqmodel.Psi = 0.45;
+            checkSameAsNewEquation(T + 10.0, P, ArrayXr{{0.30, 0.30, 0.40}});
+        }
     }
 
     //=============================================
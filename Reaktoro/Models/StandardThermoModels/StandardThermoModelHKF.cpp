@@ -151,7 +151,109 @@ auto StandardThermoModelHKF(const StandardThermoModelParamsHKF& params) -> Stand
         //     + w*Y + (Z + 1)*wT - wr*Yr;
     };
 
-    return StandardThermoModel(evalfn, extractParams(params), createModelSerializer(params));
+    return StandardThermoModel(evalfn, extractParams(params), createModelSerializer(params)).withAttachedData(params);
+}
+
+auto StandardThermoModelHKFBatch(const Vec<StandardThermoModelParamsHKF>& params) -> StandardThermoModelBatch
+{
+    waterThermoPropsWagnerPrussInterpData(StateOfMatter::Liquid); // see StandardThermoModelHKF
+
+    /// The values of the HKF parameters of the aqueous solutes stored contiguously.
+    struct Arrays
+    {
+        ArrayXr Gf, Hf, Sr, a1, a2, a3, a4, c1, c2, wref, z;
+    };
+
+    const auto size = params.size();
+
+    auto arrays = std::make_shared<Arrays>();
+
+    for(auto* array : { &arrays->Gf, &arrays->Hf, &arrays->Sr, &arrays->a1, &arrays->a2, &arrays->a3, &arrays->a4, &arrays->c1, &arrays->c2, &arrays->wref, &arrays->z })
+        array->resize(size);
+
+    Vec<Param> paramsall;
+    for(const auto& p : params)
+        for(const auto& param : extractParams(p))
+            paramsall.push_back(param);
+
+    auto updatefn = [=]()
+    {
+        for(auto i = 0; i < size; ++i)
+        {
+            arrays->Gf[i]   = params[i].Gf;
+            arrays->Hf[i]   = params[i].Hf;
+            arrays->Sr[i]   = params[i].Sr;
+            arrays->a1[i]   = params[i].a1;
+            arrays->a2[i]   = params[i].a2;
+            arrays->a3[i]   = params[i].a3;
+            arrays->a4[i]   = params[i].a4;
+            arrays->c1[i]   = params[i].c1;
+            arrays->c2[i]   = params[i].c2;
+            arrays->wref[i] = params[i].wref;
+            arrays->z[i]    = params[i].charge;
+        }
+    };
+
+    auto evalfn = [=](const real& T, const real& P, ArrayXrRef G0, ArrayXrRef H0, ArrayXrRef V0, ArrayXrRef Cp0, ArrayXrRef VT0, ArrayXrRef VP0)
+    {
+        const auto& [Gf, Hf, Sr, a1, a2, a3, a4, c1, c2, wref, z] = *arrays;
+
+        // The properties of water and the g function of the HKF model, evaluated once for all solutes
+        const auto wtp = waterThermoPropsWagnerPrussMemoized(T, P, StateOfMatter::Liquid);
+        const auto wep = memoizedWaterElectroPropsJohnsonNorton(T, P);
+        const auto gstate = gHKF::compute(T, P, wtp);
+
+        const auto& Z = wep.bornZ;
+        const auto& Y = wep.bornY;
+        const auto& Q = wep.bornQ;
+        const auto& U = wep.bornU;
+        const auto& N = wep.bornN;
+        const auto& X = wep.bornX;
+
+        // The auxiliary terms in the HKF equations that are common to all solutes
+        const real Tth   = T - theta;
+        const real Tth2  = Tth*Tth;
+        const real Tth3  = Tth*Tth2;
+        const real psiP  = psi + P;
+        const real psiP2 = psiP*psiP;
+        const real dP    = P - Pr;
+        const real lnP   = log(psiP/(psi + Pr));
+        const real dT    = T - Tr;
+        const real c1G   = T*log(T/Tr) - T + Tr;
+        const real c2G   = (1.0/Tth - 1.0/(Tr - theta))*(theta - T)/theta - T/(theta*theta)*log(Tr/T * Tth/(Tr - theta));
+        const real c2H   = 1.0/Tth - 1.0/(Tr - theta);
+        const real Z1    = Z + 1.0;
+
+        for(auto i = 0; i < size; ++i)
+        {
+            const auto aep = speciesElectroPropsHKF(gstate, z[i], wref[i]);
+
+            const auto& w   = aep.w;
+            const auto& wT  = aep.wT;
+            const auto& wP  = aep.wP;
+            const auto& wTP = aep.wTP;
+            const auto& wTT = aep.wTT;
+            const auto& wPP = aep.wPP;
+
+            const real aP = a3[i]*dP + a4[i]*lnP;
+
+            V0[i] = a1[i] + a2[i]/psiP + (a3[i] + a4[i]/psiP)/Tth - w*Q - Z1*wP;
+
+            VT0[i] = -(a3[i] + a4[i]/psiP)/Tth2 - wT*Q - w*U - Y*wP - Z1*wTP;
+
+            VP0[i] = -a2[i]/psiP2 - a4[i]/psiP2/Tth - wP*Q - w*N - Q*wP - Z1*wPP;
+
+            G0[i] = Gf[i] - Sr[i]*dT - c1[i]*c1G + a1[i]*dP + a2[i]*lnP - c2[i]*c2G + aP/Tth
+                - w*Z1 + wref[i]*(Zr + 1) + wref[i]*Yr*dT;
+
+            H0[i] = Hf[i] + c1[i]*dT - c2[i]*c2H + a1[i]*dP + a2[i]*lnP + (2.0*T - theta)/Tth2*aP
+                - w*Z1 + w*T*Y + T*Z1*wT + wref[i]*(Zr + 1) - wref[i]*Tr*Yr;
+
+            Cp0[i] = c1[i] + c2[i]/Tth2 - 2.0*T/Tth3*aP + w*T*X + 2.0*T*Y*wT + T*Z1*wTT;
+        }
+    };
+
+    return StandardThermoModelBatch(size, paramsall, updatefn, evalfn);
 }
 
 } // namespace Reaktoro
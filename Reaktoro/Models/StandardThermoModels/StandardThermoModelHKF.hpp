@@ -19,6 +19,7 @@
 
 // Reaktoro includes
 #include <Reaktoro/Core/StandardThermoModel.hpp>
+#include <Reaktoro/Core/StandardThermoModelBatch.hpp>
 
 namespace Reaktoro {
 
@@ -63,6 +64,17 @@ struct StandardThermoModelParamsHKF
 };
 
 /// Return a function that calculates thermodynamic properties of an aqueous solute using the HKF model.
+/// The parameters @p params are attached to the returned model (see Model::attachedData),
+/// so that it can be evaluated together with the models of other aqueous solutes
+/// in the same phase (see createStandardThermoModelBatch).
 auto StandardThermoModelHKF(const StandardThermoModelParamsHKF& params) -> StandardThermoModel;
 
+/// Return an object that calculates the standard thermodynamic properties of many aqueous solutes at once using the HKF model.
+/// The HKF parameters of all solutes are stored contiguously, one array per
+/// parameter, and the properties of water and the *g* function of the HKF
+/// model, which are common to all solutes, are evaluated only once per call.
+/// The Param objects in @p params are shared, so that changes in their values
+/// are taken into account in subsequent evaluations.
+auto StandardThermoModelHKFBatch(const Vec<StandardThermoModelParamsHKF>& params) -> StandardThermoModelBatch;
+
 } // namespace Reaktoro
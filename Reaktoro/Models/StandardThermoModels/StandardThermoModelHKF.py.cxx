@@ -41,4 +41,6 @@ void exportStandardThermoModelHKF(py::module& m)
         ;
 
     m.def("StandardThermoModelHKF", StandardThermoModelHKF);
+
+    m.def("StandardThermoModelHKFBatch", StandardThermoModelHKFBatch);
 }
@@ -209,3 +209,73 @@ TEST_CASE("Testing StandardThermoModelHKF class", "[StandardThermoModelHKF]")
         CHECK( props.Cp0 == Approx(10.2122)      );
     }
 }
+
+TEST_CASE("Testing StandardThermoModelHKFBatch function", "[StandardThermoModelHKF]")
+{
+    // Create a StandardThermoModelParamsHKF object with given parameter values
+    auto createParams = [](Vec<double> const& values, double charge)
+    {
+        StandardThermoModelParamsHKF params;
+        params.Gf     = values[0];
+        params.Hf     = values[1];
+        params.Sr     = values[2];
+        params.a1     = values[3];
+        params.a2     = values[4];
+        params.a3     = values[5];
+        params.a4     = values[6];
+        params.c1     = values[7];
+        params.c2     = values[8];
+        params.wref   = values[9];
+        params.charge = charge;
+        return params;
+    };
+
+    // Parameters for CO2(aq), CO3-2, H+ and Mg+2 from slop98.dat (converted to SI units)
+    Vec<StandardThermoModelParamsHKF> params = {
+        createParams({ -385974.0, -413797.6, 117.5704, 2.6135774e-05, 3125.9082, 0.00011772102, -129197.74, 167.49598, 368208.74, -8368.0 }, 0.0),
+        createParams({ -527983.14, -675234.84, -49.9988, 1.1934442e-05, -1667.073, 0.00026837013, -109382.31, -13.89339, -719300.73, 1418961.8 }, -2.0),
+        createParams({ 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 }, 1.0),
+        createParams({ -453984.92, -465959.53, -138.072, -3.4379928e-06, -3597.8216, 0.0003510376, -99997.6, 87.0272, -246521.28, 643164.48 }, 2.0),
+    };
+
+    const auto size = params.size();
+
+    const auto batch = StandardThermoModelHKFBatch(params);
+
+    CHECK( batch.size() == size );
+
+    ArrayXr G0(size), H0(size), V0(size), Cp0(size), VT0(size), VP0(size);
+
+    // Check the batch evaluation produces the same results as the evaluation of individual models
+    auto checkBatchEvaluation = [&](real T, real P)
+    {
+        batch.eval(T, P, G0, H0, V0, Cp0, VT0, VP0);
+
+        for(auto i = 0; i < size; ++i)
+        {
+            const auto props = StandardThermoModelHKF(params[i])(T, P);
+
+            INFO("i = " << i << ", T = " << T << ", P = " << P);
+            CHECK( G0[i]  == Approx(props.G0).scale(1.0)  );
+            CHECK( H0[i]  == Approx(props.H0).scale(1.0)  );
+            CHECK( V0[i]  == Approx(props.V0).scale(1.0)  );
+            CHECK( Cp0[i] == Approx(props.Cp0).scale(1.0) );
+            CHECK( VT0[i] == Approx(props.VT0).scale(1.0) );
+            CHECK( VP0[i] == Approx(props.VP0).scale(1.0) );
+        }
+    };
+
+    checkBatchEvaluation(25.0 + 273.15, 1.0e5);
+    checkBatchEvaluation(75.0 + 273.15, 1000.0e5);
+    checkBatchEvaluation(200.0 + 273.15, 500.0e5); // in region II of the g function of Shock et al. (1992)
+
+    // Check changes in the Param objects are taken into account by the batch evaluator
+    params[1].Gf = 1234.0;
+    params[3].wref = 700000.0;
+
+    checkBatchEvaluation(75.0 + 273.15, 1000.0e5);
+
+    // Check an error is raised if the given arrays have wrong size
+    ArrayXr wrong(size + 1);
+    CHECK_THROWS( batch.eval(300.0, 1.0e5, wrong, H0, V0, Cp0, VT0, VP0) );
+}
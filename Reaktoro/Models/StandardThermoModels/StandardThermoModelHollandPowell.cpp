@@ -149,7 +149,158 @@ auto StandardThermoModelHollandPowell(const StandardThermoModelParamsHollandPowe
         // S0 = STrPr + CpdlnT;
     };
 
-    return StandardThermoModel(evalfn, extractParams(params), createModelSerializer(params));
+    return StandardThermoModel(evalfn, extractParams(params), createModelSerializer(params)).withAttachedData(params);
+}
+
+auto StandardThermoModelHollandPowellBatch(const Vec<StandardThermoModelParamsHollandPowell>& params) -> StandardThermoModelBatch
+{
+    /// The values of the Holland-Powell parameters of the species stored contiguously.
+    struct Arrays
+    {
+        /// The parameters Gf, Hf, Sr, a, b, c, d of all species (one row per species).
+        MatrixXr coeffs;
+
+        /// The standard molal volumes of the species at reference temperature and pressure (in m³/mol).
+        ArrayXr Vr;
+
+        /// The coefficients α0 and κ0 of the species.
+        ArrayXr alpha0, kappa0;
+
+        /// The auxiliary variables ka, kb, kc in equation (3) of Holland and Powell (2011), for species with non-zero κ0.
+        ArrayXr ka, kb, kc;
+
+        /// The Einstein temperatures θ of the species, for species with non-zero κ0.
+        ArrayXr theta;
+
+        /// The values of θ/ξ0 and 1/(exp(u0) - 1), with u0 = θ/Tr, for species with non-zero κ0.
+        ArrayXr theta_E0, inv_exp_u0;
+    };
+
+    const auto size = params.size();
+
+    auto arrays = std::make_shared<Arrays>();
+
+    arrays->coeffs.resize(size, 7);
+
+    for(auto* array : { &arrays->Vr, &arrays->alpha0, &arrays->kappa0, &arrays->ka, &arrays->kb, &arrays->kc, &arrays->theta, &arrays->theta_E0, &arrays->inv_exp_u0 })
+        array->resize(size);
+
+    Vec<Param> paramsall;
+    for(const auto& p : params)
+        for(const auto& param : extractParams(p))
+            paramsall.push_back(param);
+
+    auto updatefn = [=]()
+    {
+        const auto Tr = 298.15;
+
+        for(auto i = 0; i < size; ++i)
+        {
+            const auto& [Gf, Hf, Sr, Vr, MKa, MKb, MKc, MKd, alpha0, kappa0, kappa0p, kappa0pp, numatoms, Tmax] = params[i];
+
+            arrays->coeffs.row(i) << Gf.value(), Hf.value(), Sr.value(), MKa.value(), MKb.value(), MKc.value(), MKd.value();
+
+            arrays->Vr[i] = Vr;
+            arrays->alpha0[i] = alpha0;
+            arrays->kappa0[i] = kappa0;
+
+            if(kappa0 == 0.0)
+                continue;
+
+            // See equation (3) and p. 346 in Holland and Powell (2011), as in StandardThermoModelHollandPowell
+            const real k0 = kappa0;
+            const real k0p = kappa0p;
+            const real k0pp = kappa0pp;
+
+            arrays->ka[i] = (1 + k0p)/(1 + k0p + k0*k0pp);
+            arrays->kb[i] = k0p/k0 - k0pp/(1 + k0p);
+            arrays->kc[i] = (1 + k0p + k0*k0pp)/(k0p*(1 + k0p) - k0*k0pp);
+
+            arrays->theta[i] = 10636.0/(Sr/numatoms + 6.44);
+
+            const real u0 = arrays->theta[i]/Tr;
+            const real exp_u0 = exp(u0);
+            const real w0 = u0/(exp_u0 - 1);
+
+            const real E0 = w0*w0*exp_u0;
+
+            arrays->theta_E0[i] = arrays->theta[i]/E0;
+            arrays->inv_exp_u0[i] = 1/(exp_u0 - 1);
+        }
+    };
+
+    auto evalfn = [=](const real& T, const real& P, ArrayXrRef G0, ArrayXrRef H0, ArrayXrRef V0, ArrayXrRef Cp0, ArrayXrRef VT0, ArrayXrRef VP0)
+    {
+        const auto& [coeffs, Vr, alpha0, kappa0, ka, kb, kc, theta, theta_E0, inv_exp_u0] = *arrays;
+
+        // Auxiliary variables related to reference pressure Pr and reference temperature Tr
+        const auto Pr   = 1.0e5;
+        const auto Tr   = 298.15;
+        const auto Tr2  = Tr*Tr;
+        const auto Tr05 = sqrt(Tr);
+
+        // Auxiliary variables related to given temperature T, evaluated once for all species
+        const real T2  = T*T;
+        const real T05 = sqrt(T);
+
+        // The contributions of a, b, c, d in the integrals Cp*dT and Cp*d(lnT) (see Fig. 4 of SUPCRTBL (2016))
+        const real CpdTa   = T - Tr;
+        const real CpdTb   = 0.5*(T2 - Tr2);
+        const real CpdTc   = -(1.0/T - 1.0/Tr);
+        const real CpdTd   = 2.0*(T05 - Tr05);
+        const real CpdlnTa = log(T/Tr);
+        const real CpdlnTb = T - Tr;
+        const real CpdlnTc = -0.5*(1/T2 - 1/Tr2);
+        const real CpdlnTd = -2.0*(1/T05 - 1/Tr05);
+
+        // The terms multiplying Gf, Hf, Sr, a, b, c, d in G0, H0 and Cp0 (one column for each)
+        Eigen::Matrix<real, 7, 3> basis;
+        basis.row(0) << 1.0, 0.0, 0.0;
+        basis.row(1) << 0.0, 1.0, 0.0;
+        basis.row(2) << -(T - Tr), 0.0, 0.0;
+        basis.row(3) << CpdTa - T*CpdlnTa, CpdTa, 1.0;
+        basis.row(4) << CpdTb - T*CpdlnTb, CpdTb, T;
+        basis.row(5) << CpdTc - T*CpdlnTc, CpdTc, 1.0/T2;
+        basis.row(6) << CpdTd - T*CpdlnTd, CpdTd, 1.0/T05;
+
+        // Evaluate G0, H0 and Cp0 of all species at once, without the volume contributions
+        G0.matrix().noalias()  = coeffs * basis.col(0);
+        H0.matrix().noalias()  = coeffs * basis.col(1);
+        Cp0.matrix().noalias() = coeffs * basis.col(2);
+        VT0.fill(0.0);
+        VP0.fill(0.0);
+
+        // Add the volume contributions of each species
+        for(auto i = 0; i < size; ++i)
+        {
+            // Check special case when kappa0 is zero (constant volume)
+            if(kappa0[i] == 0.0)
+            {
+                V0[i]  = Vr[i];
+                G0[i] += Vr[i]*(P - Pr);
+                H0[i] += Vr[i]*(P - Pr);
+                continue;
+            }
+
+            // See StandardThermoModelHollandPowell for the equations below
+            const real u      = theta[i]/T;
+            const real exp_u  = exp(u);
+            const real Pth    = alpha0[i]*kappa0[i]*theta_E0[i]*(1/(exp_u - 1) - inv_exp_u0[i]);
+            const real aux1   = 1 - kb[i]*Pth;
+            const real aux2   = pow(aux1, 1 - kc[i]);
+            const real aux3   = 1 + kb[i]*(P - Pth);
+            const real aux4   = pow(aux3, 1 - kc[i]);
+            const real aux5   = kb[i]*(kc[i] - 1)*P;
+            const real aux7   = pow(aux3, kc[i]);
+            const real VdP    = P*Vr[i] * (1 - ka[i] + ka[i]*(aux2 - aux4)/aux5);
+
+            V0[i]  = Vr[i]*(1 - ka[i]*(1 - 1/aux7));
+            G0[i] += VdP;
+            H0[i] += VdP;
+        }
+    };
+
+    return StandardThermoModelBatch(size, paramsall, updatefn, evalfn);
 }
 
 } // namespace Reaktoro
@@ -19,6 +19,7 @@
 
 // Reaktoro includes
 #include <Reaktoro/Core/StandardThermoModel.hpp>
+#include <Reaktoro/Core/StandardThermoModelBatch.hpp>
 
 namespace Reaktoro {
 
@@ -82,6 +83,18 @@ struct StandardThermoModelParamsHollandPowell
 };
 
 /// Return a function that calculates thermodynamic properties of a fluid or mineral species using the Holland-Powell model.
+/// The parameters @p params are attached to the returned model (see Model::attachedData),
+/// so that it can be evaluated together with the models of other species
+/// in the same phase (see createStandardThermoModelBatch).
 auto StandardThermoModelHollandPowell(const StandardThermoModelParamsHollandPowell& params) -> StandardThermoModel;
 
+/// Return an object that calculates the standard thermodynamic properties of many species at once using the Holland-Powell model.
+/// The parameters of all species are stored contiguously, the terms depending
+/// only on temperature are evaluated once per call, and the auxiliary
+/// variables of the volume model depending only on the parameters of each
+/// species are computed only when these parameters change.
+/// The Param objects in @p params are shared, so that changes in their values
+/// are taken into account in subsequent evaluations.
+auto StandardThermoModelHollandPowellBatch(const Vec<StandardThermoModelParamsHollandPowell>& params) -> StandardThermoModelBatch;
+
 } // namespace Reaktoro
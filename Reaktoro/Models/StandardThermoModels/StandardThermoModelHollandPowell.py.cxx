@@ -43,4 +43,6 @@ void exportStandardThermoModelHollandPowell(py::module& m)
         ;
 
     m.def("StandardThermoModelHollandPowell", StandardThermoModelHollandPowell);
+
+    m.def("StandardThermoModelHollandPowellBatch", StandardThermoModelHollandPowellBatch);
 }
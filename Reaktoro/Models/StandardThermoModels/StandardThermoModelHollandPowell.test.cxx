@@ -217,3 +217,85 @@ TEST_CASE("Testing StandardThermoModelHollandPowell class", "[StandardThermoMode
         }
     }
 }
+
+TEST_CASE("Testing StandardThermoModelHollandPowellBatch function", "[StandardThermoModelHollandPowell]")
+{
+    Vec<StandardThermoModelParamsHollandPowell> params(3);
+
+    // Parameters for Quartz from SUPCRTBL (converted to SI units)
+    params[0].Gf       = -856280.0;
+    params[0].Hf       = -910700.0;
+    params[0].Sr       =  41.43;
+    params[0].Vr       =  2.269e-05;
+    params[0].a        =  92.9;
+    params[0].b        = -0.000642;
+    params[0].c        = -714900.0;
+    params[0].d        = -716.1;
+    params[0].alpha0   =  0.0;
+    params[0].kappa0   =  73000000000.0;
+    params[0].kappa0p  =  6.0;
+    params[0].kappa0pp = -8.2e-11;
+    params[0].numatoms =  3.0;
+
+    // Parameters for Albite from SUPCRTBL (converted to SI units)
+    params[1].Gf       = -3712100.0;
+    params[1].Hf       = -3935490.0;
+    params[1].Sr       =  207.4;
+    params[1].Vr       =  0.00010067;
+    params[1].a        =  452.0;
+    params[1].b        = -0.013364;
+    params[1].c        = -1275900.0;
+    params[1].d        = -3953.6;
+    params[1].alpha0   =  2.36e-05;
+    params[1].kappa0   =  54100000000.0;
+    params[1].kappa0p  =  5.91;
+    params[1].kappa0pp = -1.09e-10;
+    params[1].numatoms =  13.0;
+
+    // Parameters for CO2(g) from SUPCRTBL (converted to SI units)
+    params[2].Gf = -394350.0;
+    params[2].Hf = -393510.0;
+    params[2].Sr =  213.7;
+    params[2].Vr =  0.0;
+    params[2].a  =  87.8;
+    params[2].b  = -0.002644;
+    params[2].c  =  706400.0;
+    params[2].d  = -998.9;
+
+    const auto size = params.size();
+
+    const auto batch = StandardThermoModelHollandPowellBatch(params);
+
+    CHECK( batch.size() == size );
+
+    ArrayXr G0(size), H0(size), V0(size), Cp0(size), VT0(size), VP0(size);
+
+    // Check the batch evaluation produces the same results as the evaluation of individual models
+    auto checkBatchEvaluation = [&](real T, real P)
+    {
+        batch.eval(T, P, G0, H0, V0, Cp0, VT0, VP0);
+
+        for(auto i = 0; i < size; ++i)
+        {
+            const auto props = StandardThermoModelHollandPowell(params[i])(T, P);
+
+            INFO("i = " << i << ", T = " << T << ", P = " << P);
+            CHECK( G0[i]  == Approx(props.G0).scale(1.0)  );
+            CHECK( H0[i]  == Approx(props.H0).scale(1.0)  );
+            CHECK( V0[i]  == Approx(props.V0).scale(1.0)  );
+            CHECK( Cp0[i] == Approx(props.Cp0).scale(1.0) );
+            CHECK( VT0[i] == Approx(props.VT0).scale(1.0) );
+            CHECK( VP0[i] == Approx(props.VP0).scale(1.0) );
+        }
+    };
+
+    checkBatchEvaluation(25.0 + 273.15, 1.0e5);
+    checkBatchEvaluation(75.0 + 273.15, 500.0e5);
+    checkBatchEvaluation(300.0 + 273.15, 2000.0e5);
+
+    // Check changes in the Param objects are taken into account by the batch evaluator
+    params[1].Sr = 210.0;
+    params[2].d = -1000.0;
+
+    checkBatchEvaluation(75.0 + 273.15, 500.0e5);
+}
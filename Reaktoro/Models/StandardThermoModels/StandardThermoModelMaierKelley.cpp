@@ -71,7 +71,63 @@ auto StandardThermoModelMaierKelley(const StandardThermoModelParamsMaierKelley&
         // S0  = Sr + CpdlnT;
     };
 
-    return StandardThermoModel(evalfn, extractParams(params), createModelSerializer(params));
+    return StandardThermoModel(evalfn, extractParams(params), createModelSerializer(params)).withAttachedData(params);
+}
+
+auto StandardThermoModelMaierKelleyBatch(const Vec<StandardThermoModelParamsMaierKelley>& params) -> StandardThermoModelBatch
+{
+    const auto size = params.size();
+
+    // The parameters Gf, Hf, Sr, Vr, a, b, c of all species (one row per species)
+    auto coeffs = std::make_shared<MatrixXr>(size, 7);
+
+    Vec<Param> paramsall;
+    for(const auto& p : params)
+        for(const auto& param : extractParams(p))
+            paramsall.push_back(param);
+
+    auto updatefn = [=]()
+    {
+        for(auto i = 0; i < size; ++i)
+        {
+            const auto& [Gf, Hf, Sr, Vr, a, b, c, Tmax] = params[i];
+            coeffs->row(i) << Gf.value(), Hf.value(), Sr.value(), Vr.value(), a.value(), b.value(), c.value();
+        }
+    };
+
+    auto evalfn = [=](const real& T, const real& P, ArrayXrRef G0, ArrayXrRef H0, ArrayXrRef V0, ArrayXrRef Cp0, ArrayXrRef VT0, ArrayXrRef VP0)
+    {
+        const auto Tr = 298.15; // the reference temperature of 25 C (in K)
+        const auto Pr = 1.0e5;  // the reference pressure of 1 bar (in Pa)
+
+        // The contributions of a, b, c in the integrals Cp*dT and Cp*d(lnT)
+        const real CpdTa   = T - Tr;
+        const real CpdTb   = 0.5*(T*T - Tr*Tr);
+        const real CpdTc   = -(1.0/T - 1.0/Tr);
+        const real CpdlnTa = log(T/Tr);
+        const real CpdlnTb = T - Tr;
+        const real CpdlnTc = -0.5*(1.0/(T*T) - 1.0/(Tr*Tr));
+
+        // The terms multiplying Gf, Hf, Sr, Vr, a, b, c in G0, H0, Cp0 and V0 (one column for each)
+        Eigen::Matrix<real, 7, 4> basis;
+        basis.row(0) << 1.0, 0.0, 0.0, 0.0;
+        basis.row(1) << 0.0, 1.0, 0.0, 0.0;
+        basis.row(2) << -(T - Tr), 0.0, 0.0, 0.0;
+        basis.row(3) << P - Pr, P - Pr, 0.0, 1.0;
+        basis.row(4) << CpdTa - T*CpdlnTa, CpdTa, 1.0, 0.0;
+        basis.row(5) << CpdTb - T*CpdlnTb, CpdTb, T, 0.0;
+        basis.row(6) << CpdTc - T*CpdlnTc, CpdTc, 1.0/(T*T), 0.0;
+
+        // Evaluate G0, H0, Cp0 and V0 of all species at once
+        G0.matrix().noalias()  = (*coeffs) * basis.col(0);
+        H0.matrix().noalias()  = (*coeffs) * basis.col(1);
+        Cp0.matrix().noalias() = (*coeffs) * basis.col(2);
+        V0.matrix().noalias()  = (*coeffs) * basis.col(3);
+        VT0.fill(0.0);
+        VP0.fill(0.0);
+    };
+
+    return StandardThermoModelBatch(size, paramsall, updatefn, evalfn);
 }
 
 } // namespace Reaktoro
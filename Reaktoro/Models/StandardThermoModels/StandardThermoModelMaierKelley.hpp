@@ -19,6 +19,7 @@
 
 // Reaktoro includes
 #include <Reaktoro/Core/StandardThermoModel.hpp>
+#include <Reaktoro/Core/StandardThermoModelBatch.hpp>
 
 namespace Reaktoro {
 
@@ -51,6 +52,17 @@ struct StandardThermoModelParamsMaierKelley
 };
 
 /// Return a function that calculates thermodynamic properties of a species using the Maier-Kelley model.
+/// The parameters @p params are attached to the returned model (see Model::attachedData),
+/// so that it can be evaluated together with the models of other species
+/// in the same phase (see createStandardThermoModelBatch).
 auto StandardThermoModelMaierKelley(const StandardThermoModelParamsMaierKelley& params) -> StandardThermoModel;
 
+/// Return an object that calculates the standard thermodynamic properties of many species at once using the Maier-Kelley model.
+/// The parameters of all species are stored in a single matrix, which is
+/// multiplied by vectors of terms depending on temperature and pressure
+/// evaluated only once per call.
+/// The Param objects in @p params are shared, so that changes in their values
+/// are taken into account in subsequent evaluations.
+auto StandardThermoModelMaierKelleyBatch(const Vec<StandardThermoModelParamsMaierKelley>& params) -> StandardThermoModelBatch;
+
 } // namespace Reaktoro
@@ -37,4 +37,6 @@ void exportStandardThermoModelMaierKelley(py::module& m)
         ;
 
     m.def("StandardThermoModelMaierKelley", StandardThermoModelMaierKelley);
+
+    m.def("StandardThermoModelMaierKelleyBatch", StandardThermoModelMaierKelleyBatch);
 }
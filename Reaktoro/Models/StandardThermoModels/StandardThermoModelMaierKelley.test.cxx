@@ -118,3 +118,64 @@ TEST_CASE("Testing StandardThermoModelMaierKelley class", "[StandardThermoModelM
         CHECK( props.Cp0 == Approx(37.211)   );
     }
 }
+
+TEST_CASE("Testing StandardThermoModelMaierKelleyBatch function", "[StandardThermoModelMaierKelley]")
+{
+    Vec<StandardThermoModelParamsMaierKelley> params(2);
+
+    // Parameters for CO2(g) from slop98.dat (converted to SI units)
+    params[0].Gf   = -394358.74;
+    params[0].Hf   = -393509.38;
+    params[0].Sr   =  213.73964;
+    params[0].Vr   =  0.0;
+    params[0].a    =  44.22488;
+    params[0].b    =  0.0087864;
+    params[0].c    = -861904.0;
+    params[0].Tmax =  2500.0;
+
+    // Parameters for NH3(g) from slop98.dat (converted to SI units), with an artificial non-zero volume
+    params[1].Gf   = -16451.488;
+    params[1].Hf   = -46111.864;
+    params[1].Sr   =  192.464;
+    params[1].Vr   =  1.0e-5;
+    params[1].a    =  29.74824;
+    params[1].b    =  0.025104;
+    params[1].c    = -154808.0;
+    params[1].Tmax =  1800.0;
+
+    const auto size = params.size();
+
+    const auto batch = StandardThermoModelMaierKelleyBatch(params);
+
+    CHECK( batch.size() == size );
+
+    ArrayXr G0(size), H0(size), V0(size), Cp0(size), VT0(size), VP0(size);
+
+    // Check the batch evaluation produces the same results as the evaluation of individual models
+    auto checkBatchEvaluation = [&](real T, real P)
+    {
+        batch.eval(T, P, G0, H0, V0, Cp0, VT0, VP0);
+
+        for(auto i = 0; i < size; ++i)
+        {
+            const auto props = StandardThermoModelMaierKelley(params[i])(T, P);
+
+            INFO("i = " << i << ", T = " << T << ", P = " << P);
+            CHECK( G0[i]  == Approx(props.G0).scale(1.0)  );
+            CHECK( H0[i]  == Approx(props.H0).scale(1.0)  );
+            CHECK( V0[i]  == Approx(props.V0).scale(1.0)  );
+            CHECK( Cp0[i] == Approx(props.Cp0).scale(1.0) );
+            CHECK( VT0[i] == Approx(props.VT0).scale(1.0) );
+            CHECK( VP0[i] == Approx(props.VP0).scale(1.0) );
+        }
+    };
+
+    checkBatchEvaluation(25.0 + 273.15, 1.0e5);
+    checkBatchEvaluation(75.0 + 273.15, 1000.0e5);
+
+    // Check changes in the Param objects are taken into account by the batch evaluator
+    params[0].Gf = 1234.0;
+    params[1].c = 5678.0;
+
+    checkBatchEvaluation(75.0 + 273.15, 1000.0e5);
+}
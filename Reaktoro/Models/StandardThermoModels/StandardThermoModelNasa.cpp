@@ -139,7 +139,122 @@ auto StandardThermoModelNasa(const StandardThermoModelParamsNasa& params) -> Sta
         props = detail::computeStandardThermoProps(params, T);
     };
 
-    return StandardThermoModel(evalfn, extractParams(params), createModelSerializer(params));
+    return StandardThermoModel(evalfn, extractParams(params), createModelSerializer(params)).withAttachedData(params);
+}
+
+auto StandardThermoModelNasaBatch(const Vec<StandardThermoModelParamsNasa>& params) -> StandardThermoModelBatch
+{
+    /// The coefficients and temperature intervals of the NASA polynomials of all species stored contiguously.
+    struct Arrays
+    {
+        /// The coefficients a1, ..., a7, b1, b2 of all NASA polynomials of all species (one row per polynomial).
+        MatrixXr coeffs;
+
+        /// The minimum and maximum temperatures of all NASA polynomials of all species (in K).
+        ArrayXd Tmins, Tmaxs;
+
+        /// The index of the first NASA polynomial of each species in #coeffs (with an additional entry equal to the number of polynomials).
+        Indices offsets;
+    };
+
+    const auto size = params.size();
+
+    auto arrays = std::make_shared<Arrays>();
+
+    arrays->offsets.push_back(0);
+    for(const auto& p : params)
+        arrays->offsets.push_back(arrays->offsets.back() + p.polynomials.size());
+
+    const auto numpolynomials = arrays->offsets.back();
+
+    arrays->coeffs.resize(numpolynomials, 9);
+    arrays->Tmins.resize(numpolynomials);
+    arrays->Tmaxs.resize(numpolynomials);
+
+    Vec<Param> paramsall;
+    for(auto i = 0; i < size; ++i)
+    {
+        for(auto j = 0; j < params[i].polynomials.size(); ++j)
+        {
+            arrays->Tmins[arrays->offsets[i] + j] = params[i].polynomials[j].Tmin;
+            arrays->Tmaxs[arrays->offsets[i] + j] = params[i].polynomials[j].Tmax;
+        }
+        for(const auto& param : extractParams(params[i]))
+            paramsall.push_back(param);
+    }
+
+    auto updatefn = [=]()
+    {
+        for(auto i = 0; i < size; ++i)
+        {
+            for(auto j = 0; j < params[i].polynomials.size(); ++j)
+            {
+                const auto& polynomial = params[i].polynomials[j];
+                arrays->coeffs.row(arrays->offsets[i] + j) <<
+                    polynomial.a1.value(), polynomial.a2.value(), polynomial.a3.value(),
+                    polynomial.a4.value(), polynomial.a5.value(), polynomial.a6.value(),
+                    polynomial.a7.value(), polynomial.b1.value(), polynomial.b2.value();
+            }
+        }
+    };
+
+    auto evalfn = [=](const real& T, const real& P, ArrayXrRef G0, ArrayXrRef H0, ArrayXrRef V0, ArrayXrRef Cp0, ArrayXrRef VT0, ArrayXrRef VP0)
+    {
+        const auto& [coeffs, Tmins, Tmaxs, offsets] = *arrays;
+
+        // The powers and logarithm of temperature, evaluated once for all species
+        const real T2  = T*T;
+        const real T3  = T*T2;
+        const real T4  = T*T3;
+        const real lnT = log(T);
+
+        // The terms multiplying a1, ..., a7, b1, b2 in Cp0/R, H0/(RT) and S0/R (one column for each)
+        Eigen::Matrix<real, 9, 3> basis;
+        basis.col(0) << 1.0/T2, 1.0/T, 1.0, T, T2, T3, T4, 0.0, 0.0;
+        basis.col(1) << -1.0/T2, lnT/T, 1.0, T/2.0, T2/3.0, T3/4.0, T4/5.0, 1.0/T, 0.0;
+        basis.col(2) << -0.5/T2, -1.0/T, lnT, T, T2/2.0, T3/3.0, T4/4.0, 0.0, 1.0;
+
+        const auto R = universalGasConstant;
+
+        V0.fill(0.0);
+        VT0.fill(0.0);
+        VP0.fill(0.0);
+
+        for(auto i = 0; i < size; ++i)
+        {
+            // Check if the species has no temperature intervals, and just enthalpy at a single temperature point (see detail::computeStandardThermoProps)
+            if(params[i].polynomials.empty())
+            {
+                G0[i]  = params[i].H0; // NOTE: No given data for computation of G0, so assuming G0 = H0 at T0
+                H0[i]  = params[i].H0;
+                Cp0[i] = 0.0;
+                continue;
+            }
+
+            // Find the NASA polynomial whose temperature interval contains T
+            auto k = offsets[i];
+            while(k < offsets[i + 1] && !(Tmins[k] <= T && T <= Tmaxs[k]))
+                ++k;
+
+            // Use a high value for G0 to penalize the species from appearing at equilibrium if T is out of range
+            if(k == offsets[i + 1])
+            {
+                G0[i]  = 999'999'999'999;
+                H0[i]  = 0.0;
+                Cp0[i] = 0.0;
+                continue;
+            }
+
+            // The values of Cp0/R, H0/(RT) and S0/R of the species
+            const auto values = (coeffs.row(k) * basis).eval();
+
+            Cp0[i] = values[0] * R;
+            H0[i]  = values[1] * R*T;
+            G0[i]  = H0[i] - T*values[2]*R;
+        }
+    };
+
+    return StandardThermoModelBatch(size, paramsall, updatefn, evalfn);
 }
 
 } // namespace Reaktoro
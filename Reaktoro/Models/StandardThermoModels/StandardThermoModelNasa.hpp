@@ -20,6 +20,7 @@
 // Reaktoro includes
 #include <Reaktoro/Core/AggregateState.hpp>
 #include <Reaktoro/Core/StandardThermoModel.hpp>
+#include <Reaktoro/Core/StandardThermoModelBatch.hpp>
 
 namespace Reaktoro {
 
@@ -63,8 +64,19 @@ struct StandardThermoModelParamsNasa
 };
 
 /// Return a function that calculates thermodynamic properties of a species using the Maier-Kelley model.
+/// The parameters @p params are attached to the returned model (see Model::attachedData),
+/// so that it can be evaluated together with the models of other species
+/// in the same phase (see createStandardThermoModelBatch).
 auto StandardThermoModelNasa(const StandardThermoModelParamsNasa& params) -> StandardThermoModel;
 
+/// Return an object that calculates the standard thermodynamic properties of many species at once using the NASA polynomial model.
+/// The coefficients of the NASA polynomials of all species are stored in a
+/// single matrix, and the powers and logarithm of temperature multiplying
+/// them are evaluated only once per call.
+/// The Param objects in @p params are shared, so that changes in their values
+/// are taken into account in subsequent evaluations.
+auto StandardThermoModelNasaBatch(const Vec<StandardThermoModelParamsNasa>& params) -> StandardThermoModelBatch;
+
 //=================================================================================================
 // AUXILIARY METHODS
 //=================================================================================================
@@ -51,4 +51,6 @@ void exportStandardThermoModelNasa(py::module& m)
         ;
 
     m.def("StandardThermoModelNasa", StandardThermoModelNasa);
+
+    m.def("StandardThermoModelNasaBatch", StandardThermoModelNasaBatch);
 }
@@ -138,3 +138,62 @@ TEST_CASE("Testing StandardThermoModelNasa module", "[StandardThermoModelNasa]")
     CHECK( detail::computeStandardThermoProps(params, 1650.0).G0 == model(1650.0, 1e5).G0 );
     CHECK( detail::computeStandardThermoProps(params, 8650.0).G0 == model(8650.0, 1e5).G0 );
 }
+
+TEST_CASE("Testing StandardThermoModelNasaBatch function", "[StandardThermoModelNasa]")
+{
+    Vec<StandardThermoModelParamsNasa> params(3);
+
+    // A species with three temperature intervals
+    params[0].polynomials.resize(3);
+    params[0].polynomials[0] = manufactureNasaPolynomial( 500.0,  200.0, 1000.0, 345.6, 123.4, 234.5);
+    params[0].polynomials[1] = manufactureNasaPolynomial(2000.0, 1000.0, 6000.0, 345.6, 123.4, 234.5);
+    params[0].polynomials[2] = manufactureNasaPolynomial(8000.0, 6000.0, 9000.0, 345.6, 123.4, 234.5);
+
+    // A species with two temperature intervals only
+    params[1].polynomials.resize(2);
+    params[1].polynomials[0] = manufactureNasaPolynomial( 400.0,  300.0, 1000.0, 111.1, 222.2, 333.3);
+    params[1].polynomials[1] = manufactureNasaPolynomial(3000.0, 1000.0, 5000.0, 111.1, 222.2, 333.3);
+
+    // A species without temperature intervals, with just an assigned enthalpy
+    params[2].H0 = 456.7;
+    params[2].T0 = 298.15;
+
+    const auto size = params.size();
+
+    const auto batch = StandardThermoModelNasaBatch(params);
+
+    CHECK( batch.size() == size );
+
+    ArrayXr G0(size), H0(size), V0(size), Cp0(size), VT0(size), VP0(size);
+
+    // Check the batch evaluation produces the same results as the evaluation of individual models
+    auto checkBatchEvaluation = [&](real T, real P)
+    {
+        batch.eval(T, P, G0, H0, V0, Cp0, VT0, VP0);
+
+        for(auto i = 0; i < size; ++i)
+        {
+            const auto props = StandardThermoModelNasa(params[i])(T, P);
+
+            INFO("i = " << i << ", T = " << T << ", P = " << P);
+            CHECK( G0[i]  == Approx(props.G0).scale(1.0)  );
+            CHECK( H0[i]  == Approx(props.H0).scale(1.0)  );
+            CHECK( V0[i]  == Approx(props.V0).scale(1.0)  );
+            CHECK( Cp0[i] == Approx(props.Cp0).scale(1.0) );
+            CHECK( VT0[i] == Approx(props.VT0).scale(1.0) );
+            CHECK( VP0[i] == Approx(props.VP0).scale(1.0) );
+        }
+    };
+
+    checkBatchEvaluation( 250.0, 1e5); // second species is out of its temperature range
+    checkBatchEvaluation( 650.0, 1e5);
+    checkBatchEvaluation(1650.0, 1e5);
+    checkBatchEvaluation(8650.0, 1e5); // second species is out of its temperature range
+
+    // Check changes in the Param objects are taken into account by the batch evaluator
+    params[0].polynomials[1].a3 = 1.5;
+    params[1].polynomials[0].b1 = 2.5;
+
+    checkBatchEvaluation( 650.0, 1e5);
+    checkBatchEvaluation(1650.0, 1e5);
+}
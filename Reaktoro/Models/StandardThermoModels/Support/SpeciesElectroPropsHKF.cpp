@@ -123,6 +123,11 @@ auto gHKF::compute(real T, real P, const WaterThermoProps& wtp) -> gHKF
 }
 
 auto speciesElectroPropsHKF(const gHKF& gstate, const StandardThermoModelParamsHKF& params) -> SpeciesElectroProps
+{
+    return speciesElectroPropsHKF(gstate, params.charge, params.wref);
+}
+
+auto speciesElectroPropsHKF(const gHKF& gstate, const real& z, const real& wref) -> SpeciesElectroProps
 {
     // The species electro instance to be calculated
     SpeciesElectroProps se;
@@ -135,9 +140,9 @@ auto speciesElectroPropsHKF(const gHKF& gstate, const StandardThermoModelParamsH
     // to set the properties below to zero as well. However, this required the
     // chemical formula in the list of params, which was cumbersome. It turns
     // out that the next branch produces zero properties for H+, since its wref=0.
-    if(params.charge == 0.0)
+    if(z == 0.0)
     {
-        se.w   = params.wref;
+        se.w   = wref;
         se.wT  = 0.0;
         se.wP  = 0.0;
         se.wTT = 0.0;
@@ -146,9 +151,6 @@ auto speciesElectroPropsHKF(const gHKF& gstate, const StandardThermoModelParamsH
     }
     else
     {
-        const auto z = params.charge;
-        const auto wref = params.wref;
-
         const auto reref = z*z/(wref/eta + z/3.082);
         const auto re    = reref + abs(z) * g;
 
@@ -55,4 +55,10 @@ struct gHKF
 /// Compute the electrostatic properties of an aqueous solute with given HKF *g* function state.
 auto speciesElectroPropsHKF(const gHKF& gstate, const StandardThermoModelParamsHKF& params) -> SpeciesElectroProps;
 
+/// Compute the electrostatic properties of an aqueous solute with given HKF *g* function state.
+/// @param gstate The *g* function state of the HKF model
+/// @param z The electrical charge of the aqueous solute
+/// @param wref The conventional Born coefficient of the aqueous solute at reference temperature and pressure (in J/mol)
+auto speciesElectroPropsHKF(const gHKF& gstate, const real& z, const real& wref) -> SpeciesElectroProps;
+
 } // namespace Reaktoro
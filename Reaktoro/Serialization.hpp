@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <Reaktoro/Serialization/Binary.hpp>
+#include <Reaktoro/Serialization/Checkpoint.hpp>
 #include <Reaktoro/Serialization/Common.hpp>
 #include <Reaktoro/Serialization/Core.hpp>
 #include <Reaktoro/Serialization/Models.hpp>
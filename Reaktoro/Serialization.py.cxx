@@ -18,12 +18,16 @@
 // pybind11 includes
 #include <Reaktoro/pybind11.hxx>
 
+void exportCheckpoint(py::module& m);
+void exportSerializationBinary(py::module& m);
 void exportSerializationCommon(py::module& m);
 void exportSerializationCore(py::module& m);
 void exportSerializationModels(py::module& m);
 
 void exportSerialization(py::module& m)
 {
+    exportCheckpoint(m);
+    exportSerializationBinary(m);
     exportSerializationCommon(m);
     exportSerializationCore(m);
     exportSerializationModels(m);
@@ -0,0 +1,331 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "Binary.hpp"
+
+// C++ includes
+#include <cstring>
+
+// Optima includes
+#include <Optima/State.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Common/ArrayStream.hpp>
+#include <Reaktoro/Common/BinaryStream.hpp>
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Core/ChemicalProps.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSensitivity.hpp>
+#include <Reaktoro/Serialization/BinaryUtils.hpp>
+
+namespace Reaktoro {
+namespace {
+
+// The layout of the binary data of an object is a header followed by the
+// data of the object. Every field is 8 bytes long (or a string padded to a
+// multiple of 8 bytes), so that arrays of doubles are always properly aligned
+// for direct access in memory.
+//
+// Header:
+//     char[8]  magic     ("RKTSNAP" plus a null character)
+//     uint32   version
+//     uint32   byteorder (0x01020304 in the byte order of the writer)
+//     uint64   kind      (KindChemicalState, KindChemicalProps, KindEquilibriumSensitivity)
+//
+// ChemicalState:
+//     uint64   number of species and fingerprint of the chemical system
+//     double   T, P, n[Nn]
+//     uint64   flags (FlagEquilibrium)
+//     if FlagEquilibrium: strings wnames, pnames, qnames, arrays w and c, Optima dims (x, p, be, c), arrays x, p, ye, s, jb, jn
+//
+// ChemicalProps:
+//     uint64   number of species and fingerprint of the chemical system
+//     array of serialized chemical properties (see ChemicalProps::serialize)
+//
+// EquilibriumSensitivity:
+//     matrices dndw, dpdw, dqdw, dndc, dpdc, dqdc, dudw, dudc
+
+/// The characters identifying binary data written with writeBinary.
+const char BinaryMagic[8] = { 'R', 'K', 'T', 'S', 'N', 'A', 'P', '\0' };
+
+/// The current version of the binary format.
+const std::uint32_t BinaryVersion = 1;
+
+/// The marker used to detect binary data written in a different byte order.
+const std::uint32_t BinaryByteOrder = 0x01020304;
+
+/// The kinds of objects in binary data.
+enum : std::uint64_t { KindChemicalState = 1, KindChemicalProps = 2, KindEquilibriumSensitivity = 3 };
+
+/// The flags identifying the optional data of a chemical state in binary data.
+enum : std::uint64_t { FlagEquilibrium = 1 << 0 };
+
+/// Return the name of a kind of object in binary data.
+auto kindName(std::uint64_t kind) -> String
+{
+    switch(kind)
+    {
+        case KindChemicalState: return "ChemicalState";
+        case KindChemicalProps: return "ChemicalProps";
+        case KindEquilibriumSensitivity: return "EquilibriumSensitivity";
+        default: return "unknown";
+    }
+}
+
+/// The auxiliary data reused in each thread across calls to writeBinary and readBinary to avoid memory allocations.
+struct Workspace
+{
+    /// The auxiliary array used to convert species amounts to double values.
+    ArrayXd n;
+
+    /// The auxiliary array stream used to serialize chemical properties.
+    ArrayStream<double> stream;
+
+    /// The auxiliary names of the w, p, q variables read from binary data.
+    Strings wnames, pnames, qnames;
+
+    /// The auxiliary Optima state read from binary data.
+    Optima::State optstate;
+};
+
+/// Return the Workspace object of the current thread.
+auto workspace() -> Workspace&
+{
+    thread_local Workspace ws;
+    return ws;
+}
+
+/// Write the header of the binary data of an object of given kind.
+auto writeHeader(BinaryMemoryWriter& writer, std::uint64_t kind) -> void
+{
+    writer.write(BinaryMagic, sizeof(BinaryMagic));
+    writer.write<std::uint32_t>(BinaryVersion);
+    writer.write<std::uint32_t>(BinaryByteOrder);
+    writer.write<std::uint64_t>(kind);
+}
+
+/// Read and check the header of the binary data of an object of given kind.
+auto readHeader(BinaryReader& reader, std::uint64_t kind) -> void
+{
+    errorif(reader.size() < sizeof(BinaryMagic) || std::memcmp(reader.view<char>(sizeof(BinaryMagic)), BinaryMagic, sizeof(BinaryMagic)) != 0,
+        "Cannot read a ", kindName(kind), " object from data not written with writeBinary.");
+
+    const auto version = reader.read<std::uint32_t>();
+    errorif(version > BinaryVersion, "Cannot read a ", kindName(kind), " object from binary data with version ", version, ", which is newer than the supported version ", BinaryVersion, ".");
+
+    const auto byteorder = reader.read<std::uint32_t>();
+    errorif(byteorder != BinaryByteOrder, "Cannot read a ", kindName(kind), " object from binary data written on a machine with a different byte order.");
+
+    const auto actual = reader.read<std::uint64_t>();
+    errorif(actual != kind, "Cannot read a ", kindName(kind), " object from binary data containing a ", kindName(actual), " object.");
+}
+
+/// Write the number of species and the fingerprint of a chemical system.
+auto writeSystem(BinaryMemoryWriter& writer, ChemicalSystem const& system) -> void
+{
+    writer.write<std::uint64_t>(system.species().size());
+    writer.write<std::uint64_t>(systemFingerprint(system));
+}
+
+/// Read and check the number of species and the fingerprint of a chemical system.
+auto readSystem(BinaryReader& reader, ChemicalSystem const& system, Chars kind) -> void
+{
+    const auto numspecies = reader.read<std::uint64_t>();
+    const auto fingerprint = reader.read<std::uint64_t>();
+    errorif(numspecies != system.species().size() || fingerprint != systemFingerprint(system),
+        "Cannot read a ", kind, " object from binary data written for a different chemical system.");
+}
+
+} // namespace
+
+auto systemFingerprint(ChemicalSystem const& system) -> std::uint64_t
+{
+    std::uint64_t hash = 14695981039346656037ull; // FNV-1a hash of the species names and element symbols
+    auto combine = [&](String const& str)
+    {
+        for(auto ch : str)
+            hash = (hash ^ static_cast<unsigned char>(ch)) * 1099511628211ull;
+        hash = (hash ^ 0xff) * 1099511628211ull; // separator between strings
+    };
+    for(auto const& species : system.species())
+        combine(species.name());
+    for(auto const& element : system.elements())
+        combine(element.symbol());
+    return hash;
+}
+
+auto writeBinary(ChemicalState const& state, Vec<char>& buffer) -> void
+{
+    auto& ws = workspace();
+
+    auto const& equilibrium = state.equilibrium();
+
+    const std::uint64_t flags = equilibrium.empty() ? 0 : FlagEquilibrium;
+
+    ws.n = state.speciesAmounts().cast<double>();
+
+    BinaryMemoryWriter writer(buffer);
+    writeHeader(writer, KindChemicalState);
+    writeSystem(writer, state.system());
+    writer.write<double>(state.temperature());
+    writer.write<double>(state.pressure());
+    writer.write(ws.n.data(), ws.n.size());
+    writer.write<std::uint64_t>(flags);
+
+    if(flags & FlagEquilibrium)
+    {
+        auto const& optstate = equilibrium.optimaState();
+        detail::writeStrings(writer, equilibrium.namesInputVariables());
+        detail::writeStrings(writer, equilibrium.namesControlVariablesP());
+        detail::writeStrings(writer, equilibrium.namesControlVariablesQ());
+        detail::writeArray(writer, equilibrium.w());
+        detail::writeArray(writer, equilibrium.c());
+        writer.write<std::uint64_t>(optstate.dims.x);
+        writer.write<std::uint64_t>(optstate.dims.p);
+        writer.write<std::uint64_t>(optstate.dims.be);
+        writer.write<std::uint64_t>(optstate.dims.c);
+        detail::writeArray(writer, optstate.x);
+        detail::writeArray(writer, optstate.p);
+        detail::writeArray(writer, optstate.ye);
+        detail::writeArray(writer, optstate.s);
+        detail::writeIndices(writer, optstate.jb);
+        detail::writeIndices(writer, optstate.jn);
+    }
+}
+
+auto writeBinary(ChemicalProps const& props, Vec<char>& buffer) -> void
+{
+    auto& ws = workspace();
+
+    props.serialize(ws.stream);
+
+    BinaryMemoryWriter writer(buffer);
+    writeHeader(writer, KindChemicalProps);
+    writeSystem(writer, props.system());
+    detail::writeArray(writer, ws.stream.data());
+}
+
+auto writeBinary(EquilibriumSensitivity const& sensitivity, Vec<char>& buffer) -> void
+{
+    BinaryMemoryWriter writer(buffer);
+    writeHeader(writer, KindEquilibriumSensitivity);
+    detail::writeMatrix(writer, sensitivity.dndw());
+    detail::writeMatrix(writer, sensitivity.dpdw());
+    detail::writeMatrix(writer, sensitivity.dqdw());
+    detail::writeMatrix(writer, sensitivity.dndc());
+    detail::writeMatrix(writer, sensitivity.dpdc());
+    detail::writeMatrix(writer, sensitivity.dqdc());
+    detail::writeMatrix(writer, sensitivity.dudw());
+    detail::writeMatrix(writer, sensitivity.dudc());
+}
+
+auto readBinary(char const* data, Index size, ChemicalState& state) -> void
+{
+    auto& ws = workspace();
+
+    BinaryReader reader(data, size);
+    readHeader(reader, KindChemicalState);
+    readSystem(reader, state.system(), "ChemicalState");
+
+    const auto Nn = state.system().species().size();
+
+    const auto T = reader.read<double>();
+    const auto P = reader.read<double>();
+    const auto n = ArrayXdConstMap(reader.view<double>(Nn), Nn);
+    const auto flags = reader.read<std::uint64_t>();
+
+    state.setTemperature(T);
+    state.setPressure(P);
+    state.setSpeciesAmounts(n);
+
+    auto& equilibrium = state.equilibrium();
+
+    if(flags & FlagEquilibrium)
+    {
+        detail::readStrings(reader, ws.wnames);
+        detail::readStrings(reader, ws.pnames);
+        detail::readStrings(reader, ws.qnames);
+
+        const auto w = detail::readArray(reader);
+        const auto c = detail::readArray(reader);
+
+        auto& optstate = ws.optstate;
+        optstate.dims.x  = reader.read<std::uint64_t>();
+        optstate.dims.p  = reader.read<std::uint64_t>();
+        optstate.dims.be = reader.read<std::uint64_t>();
+        optstate.dims.c  = reader.read<std::uint64_t>();
+        optstate.x  = detail::readArray(reader);
+        optstate.p  = detail::readArray(reader);
+        optstate.ye = detail::readArray(reader);
+        optstate.s  = detail::readArray(reader);
+        detail::readIndices(reader, optstate.jb);
+        detail::readIndices(reader, optstate.jn);
+
+        // Names are set only when they change, as they are usually the same for all states exchanged
+        if(equilibrium.namesInputVariables() != ws.wnames)
+            equilibrium.setNamesInputVariables(ws.wnames);
+        if(equilibrium.namesControlVariablesP() != ws.pnames)
+            equilibrium.setNamesControlVariablesP(ws.pnames);
+        if(equilibrium.namesControlVariablesQ() != ws.qnames)
+            equilibrium.setNamesControlVariablesQ(ws.qnames);
+
+        equilibrium.setInputVariables(w);
+        equilibrium.setInitialComponentAmounts(c);
+        equilibrium.setOptimaState(optstate);
+    }
+    else equilibrium.reset();
+}
+
+auto readBinary(char const* data, Index size, ChemicalProps& props) -> void
+{
+    BinaryReader reader(data, size);
+    readHeader(reader, KindChemicalProps);
+    readSystem(reader, props.system(), "ChemicalProps");
+    props.update(detail::readArray(reader));
+}
+
+auto readBinary(char const* data, Index size, EquilibriumSensitivity& sensitivity) -> void
+{
+    BinaryReader reader(data, size);
+    readHeader(reader, KindEquilibriumSensitivity);
+    sensitivity.dndw(detail::readMatrix(reader));
+    sensitivity.dpdw(detail::readMatrix(reader));
+    sensitivity.dqdw(detail::readMatrix(reader));
+    sensitivity.dndc(detail::readMatrix(reader));
+    sensitivity.dpdc(detail::readMatrix(reader));
+    sensitivity.dqdc(detail::readMatrix(reader));
+    sensitivity.dudw(detail::readMatrix(reader));
+    sensitivity.dudc(detail::readMatrix(reader));
+}
+
+auto readBinary(Vec<char> const& buffer, ChemicalState& state) -> void
+{
+    readBinary(buffer.data(), buffer.size(), state);
+}
+
+auto readBinary(Vec<char> const& buffer, ChemicalProps& props) -> void
+{
+    readBinary(buffer.data(), buffer.size(), props);
+}
+
+auto readBinary(Vec<char> const& buffer, EquilibriumSensitivity& sensitivity) -> void
+{
+    readBinary(buffer.data(), buffer.size(), sensitivity);
+}
+
+} // namespace Reaktoro
@@ -0,0 +1,92 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <cstdint>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+// Forward declarations
+class ChemicalProps;
+class ChemicalState;
+class ChemicalSystem;
+class EquilibriumSensitivity;
+
+/// Return the fingerprint of a chemical system computed from the names of its species and the symbols of its elements.
+/// This is used in binary data to check that it is read into objects of the same chemical system used to write it.
+auto systemFingerprint(ChemicalSystem const& system) -> std::uint64_t;
+
+/// Write a chemical state to a buffer in a compact binary format.
+/// The binary data starts with a header identifying the type of the object
+/// written and the version of the format. It contains the temperature,
+/// pressure and species amounts of the chemical state, and the data needed to
+/// warm-start chemical equilibrium calculations (if the state has it). The
+/// buffer is overwritten, but its allocated memory is reused.
+/// @param state The chemical state to be written
+/// @param[out] buffer The buffer to which the binary data is written
+auto writeBinary(ChemicalState const& state, Vec<char>& buffer) -> void;
+
+/// Write the chemical properties of a system to a buffer in a compact binary format.
+/// The chemical properties are written in the same order used in ChemicalProps::serialize.
+/// @param props The chemical properties to be written
+/// @param[out] buffer The buffer to which the binary data is written
+auto writeBinary(ChemicalProps const& props, Vec<char>& buffer) -> void;
+
+/// Write the sensitivity derivatives of a chemical equilibrium state to a buffer in a compact binary format.
+/// @param sensitivity The sensitivity derivatives to be written
+/// @param[out] buffer The buffer to which the binary data is written
+auto writeBinary(EquilibriumSensitivity const& sensitivity, Vec<char>& buffer) -> void;
+
+/// Read a chemical state from binary data written with @ref writeBinary into an existing chemical state.
+/// The chemical state must have been created with the same chemical system of
+/// the state written. Its existing memory is reused, so that reading many
+/// states of the same system (e.g., received from other processes) does not
+/// allocate memory. The binary data must be aligned to an 8-byte boundary.
+/// @param data The pointer to the beginning of the binary data
+/// @param size The size of the binary data (in bytes)
+/// @param[out] state The chemical state updated with the binary data
+auto readBinary(char const* data, Index size, ChemicalState& state) -> void;
+
+/// Read the chemical properties of a system from binary data written with @ref writeBinary into existing chemical properties.
+/// The chemical properties must have been created with the same chemical system of the properties written.
+/// @param data The pointer to the beginning of the binary data (aligned to an 8-byte boundary)
+/// @param size The size of the binary data (in bytes)
+/// @param[out] props The chemical properties updated with the binary data
+auto readBinary(char const* data, Index size, ChemicalProps& props) -> void;
+
+/// Read the sensitivity derivatives of a chemical equilibrium state from binary data written with @ref writeBinary into existing ones.
+/// The sensitivity derivatives must have been initialized with the same equilibrium specifications of those written.
+/// @param data The pointer to the beginning of the binary data (aligned to an 8-byte boundary)
+/// @param size The size of the binary data (in bytes)
+/// @param[out] sensitivity The sensitivity derivatives updated with the binary data
+auto readBinary(char const* data, Index size, EquilibriumSensitivity& sensitivity) -> void;
+
+/// Read a chemical state from a buffer written with @ref writeBinary into an existing chemical state.
+auto readBinary(Vec<char> const& buffer, ChemicalState& state) -> void;
+
+/// Read the chemical properties of a system from a buffer written with @ref writeBinary into existing chemical properties.
+auto readBinary(Vec<char> const& buffer, ChemicalProps& props) -> void;
+
+/// Read the sensitivity derivatives of a chemical equilibrium state from a buffer written with @ref writeBinary into existing ones.
+auto readBinary(Vec<char> const& buffer, EquilibriumSensitivity& sensitivity) -> void;
+
+} // namespace Reaktoro
@@ -0,0 +1,58 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// pybind11 includes
+#include <Reaktoro/pybind11.hxx>
+
+// Reaktoro includes
+#include <Reaktoro/Core/ChemicalProps.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSensitivity.hpp>
+#include <Reaktoro/Serialization/Binary.hpp>
+using namespace Reaktoro;
+
+/// Return the binary data of an object written with writeBinary as a Python bytes object.
+template<typename T>
+auto writeBinaryBytes(T const& obj) -> py::bytes
+{
+    thread_local Vec<char> buffer;
+    writeBinary(obj, buffer);
+    return py::bytes(buffer.data(), buffer.size());
+}
+
+/// Read an object from binary data in a Python bytes object without copying it.
+template<typename T>
+auto readBinaryBytes(py::bytes const& data, T& obj) -> void
+{
+    char* ptr = nullptr;
+    Py_ssize_t size = 0;
+    PyBytes_AsStringAndSize(data.ptr(), &ptr, &size);
+    readBinary(ptr, size, obj);
+}
+
+void exportSerializationBinary(py::module& m)
+{
+    m.def("systemFingerprint", systemFingerprint, "Return the fingerprint of a chemical system computed from the names of its species and the symbols of its elements.");
+
+    m.def("writeBinary", writeBinaryBytes<ChemicalState>, "Return a chemical state in a compact binary format.");
+    m.def("writeBinary", writeBinaryBytes<ChemicalProps>, "Return the chemical properties of a system in a compact binary format.");
+    m.def("writeBinary", writeBinaryBytes<EquilibriumSensitivity>, "Return the sensitivity derivatives of a chemical equilibrium state in a compact binary format.");
+
+    m.def("readBinary", readBinaryBytes<ChemicalState>, "Read a chemical state from binary data written with writeBinary into an existing chemical state.");
+    m.def("readBinary", readBinaryBytes<ChemicalProps>, "Read the chemical properties of a system from binary data written with writeBinary into existing chemical properties.");
+    m.def("readBinary", readBinaryBytes<EquilibriumSensitivity>, "Read the sensitivity derivatives of a chemical equilibrium state from binary data written with writeBinary into existing ones.");
+}
@@ -0,0 +1,131 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Core/ChemicalProps.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSensitivity.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSpecs.hpp>
+#include <Reaktoro/Extensions/Supcrt/SupcrtDatabase.hpp>
+#include <Reaktoro/Serialization/Binary.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing binary serialization of ChemicalState, ChemicalProps and EquilibriumSensitivity", "[Binary]")
+{
+    SupcrtDatabase db("supcrtbl");
+
+    ChemicalSystem system(db,
+        AqueousPhase("H2O(aq) H+ OH- Ca+2 HCO3- CO3-2 CO2(aq)"),
+        MineralPhase("Calcite"));
+
+    const auto specs = EquilibriumSpecs::TP(system);
+
+    EquilibriumSolver solver(specs);
+    EquilibriumSensitivity sensitivity(specs);
+
+    ChemicalState state(system);
+    state.temperature(60.0, "celsius");
+    state.pressure(10.0, "bar");
+    state.set("H2O(aq)", 1.0, "kg");
+    state.set("Calcite", 1.0, "mol");
+
+    REQUIRE( solver.solve(state, sensitivity).succeeded() );
+
+    Vec<char> buffer;
+
+    SECTION("Testing ChemicalState")
+    {
+        writeBinary(state, buffer);
+
+        ChemicalState restored(system);
+        readBinary(buffer, restored);
+
+        CHECK( restored.temperature() == state.temperature() );
+        CHECK( restored.pressure() == state.pressure() );
+        CHECK( (restored.speciesAmounts() == state.speciesAmounts()).all() );
+        CHECK( restored.equilibrium().namesInputVariables() == state.equilibrium().namesInputVariables() );
+        CHECK( restored.equilibrium().w().isApprox(state.equilibrium().w()) );
+        CHECK( restored.equilibrium().c().isApprox(state.equilibrium().c()) );
+        CHECK( (restored.equilibrium().indicesPrimarySpecies() == state.equilibrium().indicesPrimarySpecies()).all() );
+        CHECK( restored.equilibrium().elementChemicalPotentials().isApprox(state.equilibrium().elementChemicalPotentials()) );
+
+        // Restarting from the restored state should warm-start as the original state does
+        ChemicalState original(state);
+        const auto result0 = solver.solve(original);
+        const auto result1 = solver.solve(restored);
+
+        CHECK( result1.iterations() == result0.iterations() );
+
+        // Reading a state without equilibrium data resets the equilibrium data of the existing state
+        writeBinary(ChemicalState(system), buffer);
+        readBinary(buffer, restored);
+
+        CHECK( restored.equilibrium().empty() );
+    }
+
+    SECTION("Testing ChemicalProps")
+    {
+        writeBinary(state.props(), buffer);
+
+        ChemicalProps restored(system);
+        readBinary(buffer, restored);
+
+        CHECK( restored.temperature() == state.props().temperature() );
+        CHECK( restored.pressure() == state.props().pressure() );
+        CHECK( (restored.speciesAmounts() == state.props().speciesAmounts()).all() );
+        CHECK( (restored.speciesActivitiesLn() == state.props().speciesActivitiesLn()).all() );
+        CHECK( restored.volume() == state.props().volume() );
+    }
+
+    SECTION("Testing EquilibriumSensitivity")
+    {
+        writeBinary(sensitivity, buffer);
+
+        EquilibriumSensitivity restored(specs);
+        readBinary(buffer, restored);
+
+        CHECK( restored.dndw() == sensitivity.dndw() );
+        CHECK( restored.dpdw() == sensitivity.dpdw() );
+        CHECK( restored.dndc() == sensitivity.dndc() );
+        CHECK( restored.dudw() == sensitivity.dudw() );
+        CHECK( restored.dudc() == sensitivity.dudc() );
+    }
+
+    SECTION("Testing errors")
+    {
+        writeBinary(state, buffer);
+
+        ChemicalProps props(system);
+        CHECK_THROWS( readBinary(buffer, props) ); // not binary data of a ChemicalProps object
+
+        ChemicalSystem othersystem(db, AqueousPhase("H2O(aq) H+ OH-"));
+        ChemicalState otherstate(othersystem);
+        CHECK_THROWS( readBinary(buffer, otherstate) ); // different chemical system
+
+        buffer.resize(buffer.size() / 2);
+        CHECK_THROWS( readBinary(buffer, state) ); // truncated binary data
+
+        Vec<char> garbage(64, 'x');
+        CHECK_THROWS( readBinary(garbage, state) ); // not binary data written with writeBinary
+    }
+}
@@ -0,0 +1,139 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <cstdint>
+
+// Reaktoro includes
+#include <Reaktoro/Common/BinaryStream.hpp>
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/Matrix.hpp>
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+namespace detail {
+
+// The functions below write and read arrays, matrices and strings in the
+// binary data of writeBinary and readBinary and in checkpoint files. They
+// accept either a BinaryWriter or a BinaryMemoryWriter object, which have the
+// same writing methods. Every field is a multiple of 8 bytes long, so that
+// arrays of doubles are always properly aligned for direct access in memory.
+
+/// Write an array of double values as its length followed by its values.
+template<typename Writer>
+auto writeArray(Writer& writer, double const* data, Index size) -> void
+{
+    writer.template write<std::uint64_t>(size);
+    writer.write(data, size);
+}
+
+/// Write an array of double values as its length followed by its values.
+template<typename Writer, typename Derived>
+auto writeArray(Writer& writer, Eigen::DenseBase<Derived> const& array) -> void
+{
+    const Eigen::Ref<const ArrayXd> values = array.derived().array();
+    writeArray(writer, values.data(), values.size());
+}
+
+/// Write an array of indices as its length followed by its values as 64-bit integers.
+template<typename Writer>
+auto writeIndices(Writer& writer, ArrayXlConstRef indices) -> void
+{
+    writer.template write<std::uint64_t>(indices.size());
+    for(auto i : indices)
+        writer.template write<std::int64_t>(i);
+}
+
+/// Write a matrix of double values as its number of rows and columns followed by its values in column-major order.
+template<typename Writer>
+auto writeMatrix(Writer& writer, MatrixXdConstRef matrix) -> void
+{
+    writer.template write<std::uint64_t>(matrix.rows());
+    writer.template write<std::uint64_t>(matrix.cols());
+    if(matrix.outerStride() == matrix.rows())
+        writer.write(matrix.data(), matrix.size());
+    else for(auto j = 0; j < matrix.cols(); ++j)
+        writer.write(matrix.col(j).data(), matrix.rows());
+}
+
+/// Write a list of strings as its count followed by the strings.
+template<typename Writer>
+auto writeStrings(Writer& writer, Strings const& strings) -> void
+{
+    writer.template write<std::uint64_t>(strings.size());
+    for(auto const& str : strings)
+        writer.writeString(str);
+}
+
+/// Return a view to an array of double values written with writeArray.
+inline auto readArray(BinaryReader& reader) -> ArrayXdConstMap
+{
+    const auto size = reader.read<std::uint64_t>();
+    return ArrayXdConstMap(reader.view<double>(size), size);
+}
+
+/// Read an array of indices written with writeIndices into an existing array.
+inline auto readIndices(BinaryReader& reader, ArrayXl& indices) -> void
+{
+    const auto size = reader.read<std::uint64_t>();
+    auto const* values = reader.view<std::int64_t>(size);
+    indices.resize(size);
+    for(Index i = 0; i < size; ++i)
+        indices[i] = values[i];
+}
+
+/// Read an array of indices written with writeIndices.
+inline auto readIndices(BinaryReader& reader) -> ArrayXl
+{
+    ArrayXl indices;
+    readIndices(reader, indices);
+    return indices;
+}
+
+/// Return a view to a matrix of double values written with writeMatrix.
+inline auto readMatrix(BinaryReader& reader) -> MatrixXdConstMap
+{
+    const auto rows = reader.read<std::uint64_t>();
+    const auto cols = reader.read<std::uint64_t>();
+    errorif(cols != 0 && rows > reader.remaining() / cols, "Cannot read a matrix with ", rows, " rows and ", cols, " columns from binary data with only ", reader.remaining(), " bytes remaining (truncated or corrupted data?).");
+    return MatrixXdConstMap(reader.view<double>(rows * cols), rows, cols);
+}
+
+/// Read a list of strings written with writeStrings into an existing list, reusing its memory.
+inline auto readStrings(BinaryReader& reader, Strings& strings) -> void
+{
+    strings.resize(reader.readCount(sizeof(std::uint64_t)));
+    for(auto& str : strings)
+    {
+        const auto length = reader.read<std::uint64_t>();
+        str.assign(reader.view<char>(length), length);
+        reader.align();
+    }
+}
+
+/// Read a list of strings written with writeStrings.
+inline auto readStrings(BinaryReader& reader) -> Strings
+{
+    Strings strings;
+    readStrings(reader, strings);
+    return strings;
+}
+
+} // namespace detail
+} // namespace Reaktoro
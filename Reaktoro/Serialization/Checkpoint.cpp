@@ -0,0 +1,525 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "Checkpoint.hpp"
+
+// C++ includes
+#include <cstdint>
+#include <cstring>
+
+// Optima includes
+#include <Optima/State.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Common/ArrayStream.hpp>
+#include <Reaktoro/Common/BinaryStream.hpp>
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Core/ChemicalProps.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumConditions.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSensitivity.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSpecs.hpp>
+#include <Reaktoro/Equilibrium/SmartEquilibriumSolver.hpp>
+#include <Reaktoro/Serialization/Binary.hpp>
+#include <Reaktoro/Serialization/BinaryUtils.hpp>
+
+namespace Reaktoro {
+namespace {
+
+// The layout of a checkpoint file is a header followed by a sequence of
+// blocks, each starting with a 64-bit tag. Every field is 8 bytes long (or a
+// string padded to a multiple of 8 bytes), so that arrays of doubles in the
+// file are always properly aligned for direct access in mapped memory.
+//
+// Header:
+//     char[8]  magic     ("RKTCKPT" plus a null character)
+//     uint32   version
+//     uint32   byteorder (0x01020304 in the byte order of the writer)
+//     uint64   number of species in the chemical system
+//     uint64   number of elements in the chemical system
+//     uint64   fingerprint of the chemical system (hash of species names and element symbols)
+//
+// Block TagNames (names of the w, p, q variables used by subsequent states):
+//     strings wnames, pnames, qnames (each as count followed by strings)
+//
+// Block TagState (a chemical state):
+//     double   T, P, n[Nn]
+//     uint64   flags (FlagEquilibrium, FlagProps)
+//     if FlagEquilibrium: uint64 index of names block, arrays w and c, Optima dims (x, p, be, c), arrays x, p, ye, s, jb, jn
+//     if FlagProps: array of serialized chemical properties
+//
+// Block TagKnowledge (a record in the knowledge database of a smart equilibrium solver):
+//     a state as in TagState (always with FlagEquilibrium and FlagProps)
+//     arrays w and c of the equilibrium conditions
+//     matrices dndw, dpdw, dqdw, dndc, dpdc, dqdc, dudw, dudc of the sensitivity derivatives
+
+/// The characters identifying a checkpoint file.
+const char CheckpointMagic[8] = { 'R', 'K', 'T', 'C', 'K', 'P', 'T', '\0' };
+
+/// The current version of the checkpoint format.
+const std::uint32_t CheckpointVersion = 1;
+
+/// The marker used to detect checkpoint files written in a different byte order.
+const std::uint32_t CheckpointByteOrder = 0x01020304;
+
+/// The tags identifying the blocks in a checkpoint file.
+enum : std::uint64_t { TagNames = 1, TagState = 2, TagKnowledge = 3 };
+
+/// The flags identifying the optional data of a chemical state in a checkpoint file.
+enum : std::uint64_t { FlagEquilibrium = 1 << 0, FlagProps = 1 << 1 };
+
+} // namespace
+
+//=================================================================================================
+//
+// CheckpointWriter
+//
+//=================================================================================================
+
+struct CheckpointWriter::Impl
+{
+    /// The chemical system of the states written to the checkpoint file.
+    ChemicalSystem system;
+
+    /// The options for writing the checkpoint file.
+    CheckpointOptions options;
+
+    /// The binary writer used to stream data to the checkpoint file.
+    BinaryWriter writer;
+
+    /// The number of chemical states written so far.
+    Index nstates = 0;
+
+    /// The number of blocks of names of w, p, q variables written so far.
+    Index nnames = 0;
+
+    /// The names of the w, p, q variables in the last written block of names.
+    Strings wnames, pnames, qnames;
+
+    /// The auxiliary array used to convert species amounts to double values.
+    ArrayXd n;
+
+    /// The auxiliary array stream used to serialize chemical properties.
+    ArrayStream<double> stream;
+
+    /// Construct a CheckpointWriter::Impl object.
+    Impl(String const& filename, ChemicalSystem const& system, CheckpointOptions const& options)
+    : system(system), options(options), writer(filename)
+    {
+        writer.write(CheckpointMagic, sizeof(CheckpointMagic));
+        writer.write<std::uint32_t>(CheckpointVersion);
+        writer.write<std::uint32_t>(CheckpointByteOrder);
+        writer.write<std::uint64_t>(system.species().size());
+        writer.write<std::uint64_t>(system.elements().size());
+        writer.write<std::uint64_t>(systemFingerprint(system));
+    }
+
+    /// Write the names of the w, p, q variables of a chemical state if they differ from the last ones written.
+    auto writeNamesIfNeeded(ChemicalState::Equilibrium const& equilibrium) -> void
+    {
+        if(nnames > 0 &&
+            equilibrium.namesInputVariables() == wnames &&
+            equilibrium.namesControlVariablesP() == pnames &&
+            equilibrium.namesControlVariablesQ() == qnames)
+            return;
+
+        wnames = equilibrium.namesInputVariables();
+        pnames = equilibrium.namesControlVariablesP();
+        qnames = equilibrium.namesControlVariablesQ();
+
+        writer.write<std::uint64_t>(TagNames);
+        detail::writeStrings(writer, wnames);
+        detail::writeStrings(writer, pnames);
+        detail::writeStrings(writer, qnames);
+
+        ++nnames;
+    }
+
+    /// Write the data of a chemical state (without the block tag).
+    auto writeStateData(ChemicalState const& state, bool props) -> void
+    {
+        errorif(state.system().id() != system.id() && systemFingerprint(state.system()) != systemFingerprint(system),
+            "Cannot write to a checkpoint file a chemical state whose chemical system differs from the one of the checkpoint file.");
+
+        auto const& equilibrium = state.equilibrium();
+
+        const std::uint64_t flags =
+            (equilibrium.empty() ? 0 : FlagEquilibrium) |
+            (props ? FlagProps : 0);
+
+        n = state.speciesAmounts().cast<double>();
+
+        writer.write<double>(state.temperature());
+        writer.write<double>(state.pressure());
+        writer.write(n.data(), n.size());
+        writer.write<std::uint64_t>(flags);
+
+        if(flags & FlagEquilibrium)
+        {
+            auto const& optstate = equilibrium.optimaState();
+            writer.write<std::uint64_t>(nnames - 1);
+            detail::writeArray(writer, equilibrium.w());
+            detail::writeArray(writer, equilibrium.c());
+            writer.write<std::uint64_t>(optstate.dims.x);
+            writer.write<std::uint64_t>(optstate.dims.p);
+            writer.write<std::uint64_t>(optstate.dims.be);
+            writer.write<std::uint64_t>(optstate.dims.c);
+            detail::writeArray(writer, optstate.x);
+            detail::writeArray(writer, optstate.p);
+            detail::writeArray(writer, optstate.ye);
+            detail::writeArray(writer, optstate.s);
+            detail::writeIndices(writer, optstate.jb);
+            detail::writeIndices(writer, optstate.jn);
+        }
+
+        if(flags & FlagProps)
+        {
+            state.props().serialize(stream);
+            detail::writeArray(writer, stream.data());
+        }
+    }
+
+    /// Write a chemical state.
+    auto write(ChemicalState const& state) -> void
+    {
+        if(!state.equilibrium().empty())
+            writeNamesIfNeeded(state.equilibrium());
+        writer.write<std::uint64_t>(TagState);
+        writeStateData(state, options.props);
+        ++nstates;
+    }
+
+    /// Write the knowledge database of a smart chemical equilibrium solver.
+    auto write(SmartEquilibriumSolver const& solver) -> void
+    {
+        for(auto const& [key, cell] : solver.knowledgeBase().cells)
+        {
+            for(auto const& cluster : cell.clusters)
+            {
+                for(auto const& record : cluster.records)
+                {
+                    errorif(record.state.equilibrium().empty(), "Expecting a chemical equilibrium state in a record of the knowledge database of a smart chemical equilibrium solver.");
+                    writeNamesIfNeeded(record.state.equilibrium());
+                    writer.write<std::uint64_t>(TagKnowledge);
+                    writeStateData(record.state, true);
+                    detail::writeArray(writer, record.conditions.inputValues().cast<double>());
+                    detail::writeArray(writer, record.conditions.initialComponentAmounts());
+                    detail::writeMatrix(writer, record.sensitivity.dndw());
+                    detail::writeMatrix(writer, record.sensitivity.dpdw());
+                    detail::writeMatrix(writer, record.sensitivity.dqdw());
+                    detail::writeMatrix(writer, record.sensitivity.dndc());
+                    detail::writeMatrix(writer, record.sensitivity.dpdc());
+                    detail::writeMatrix(writer, record.sensitivity.dqdc());
+                    detail::writeMatrix(writer, record.sensitivity.dudw());
+                    detail::writeMatrix(writer, record.sensitivity.dudc());
+                }
+            }
+        }
+    }
+};
+
+CheckpointWriter::CheckpointWriter(String const& filename, ChemicalSystem const& system, CheckpointOptions const& options)
+: pimpl(new Impl(filename, system, options))
+{}
+
+CheckpointWriter::~CheckpointWriter()
+{}
+
+auto CheckpointWriter::write(ChemicalState const& state) -> void
+{
+    pimpl->write(state);
+}
+
+auto CheckpointWriter::write(SmartEquilibriumSolver const& solver) -> void
+{
+    pimpl->write(solver);
+}
+
+auto CheckpointWriter::numStates() const -> Index
+{
+    return pimpl->nstates;
+}
+
+auto CheckpointWriter::close() -> void
+{
+    pimpl->writer.close();
+}
+
+//=================================================================================================
+//
+// CheckpointReader
+//
+//=================================================================================================
+
+struct CheckpointReader::Impl
+{
+    /// The chemical system of the states in the checkpoint file.
+    ChemicalSystem system;
+
+    /// The memory-mapped checkpoint file.
+    MemoryMappedFile file;
+
+    /// The version of the format of the checkpoint file.
+    Index version = 0;
+
+    /// The number of species in the chemical system.
+    Index Nn = 0;
+
+    /// The offsets of the data of the chemical states in the checkpoint file (after the block tag).
+    Indices states;
+
+    /// The offsets of the records of the knowledge database in the checkpoint file (after the block tag).
+    Indices knowledge;
+
+    /// The names of the w, p, q variables in each block of names.
+    Vec<Tuple<Strings, Strings, Strings>> names;
+
+    /// Construct a CheckpointReader::Impl object.
+    Impl(String const& filename, ChemicalSystem const& system)
+    : system(system), file(filename), Nn(system.species().size())
+    {
+        BinaryReader reader(file.data(), file.size());
+
+        errorif(file.size() < sizeof(CheckpointMagic) || std::memcmp(reader.view<char>(sizeof(CheckpointMagic)), CheckpointMagic, sizeof(CheckpointMagic)) != 0,
+            "The file `", filename, "` is not a Reaktoro checkpoint file.");
+
+        version = reader.read<std::uint32_t>();
+        errorif(version > CheckpointVersion, "The checkpoint file `", filename, "` has version ", version, ", which is newer than the supported version ", CheckpointVersion, ".");
+
+        const auto byteorder = reader.read<std::uint32_t>();
+        errorif(byteorder != CheckpointByteOrder, "The checkpoint file `", filename, "` was written on a machine with a different byte order.");
+
+        const auto numspecies = reader.read<std::uint64_t>();
+        const auto numelements = reader.read<std::uint64_t>();
+        const auto fprint = reader.read<std::uint64_t>();
+
+        errorif(numspecies != Nn || numelements != system.elements().size() || fprint != systemFingerprint(system),
+            "The checkpoint file `", filename, "` was written for a chemical system different from the given one.");
+
+        // Scan the blocks in the file to determine the offsets of the chemical states and knowledge records
+        while(reader.remaining())
+        {
+            const auto tag = reader.read<std::uint64_t>();
+            switch(tag)
+            {
+            case TagNames:
+            {
+                auto wnames = detail::readStrings(reader);
+                auto pnames = detail::readStrings(reader);
+                auto qnames = detail::readStrings(reader);
+                names.emplace_back(std::move(wnames), std::move(pnames), std::move(qnames));
+                break;
+            }
+            case TagState:
+                states.push_back(reader.offset());
+                skipState(reader);
+                break;
+            case TagKnowledge:
+                knowledge.push_back(reader.offset());
+                skipState(reader);
+                detail::readArray(reader);
+                detail::readArray(reader);
+                for(auto i = 0; i < 8; ++i)
+                    detail::readMatrix(reader);
+                break;
+            default:
+                errorif(true, "The checkpoint file `", filename, "` is corrupted (unknown block tag ", tag, " at offset ", reader.offset() - 8, ").");
+            }
+        }
+    }
+
+    /// Advance the reader past the data of a chemical state.
+    auto skipState(BinaryReader& reader) const -> void
+    {
+        reader.skip((2 + Nn) * sizeof(double));
+        const auto flags = reader.read<std::uint64_t>();
+        if(flags & FlagEquilibrium)
+        {
+            reader.skip(sizeof(std::uint64_t)); // names index
+            detail::readArray(reader); // w
+            detail::readArray(reader); // c
+            reader.skip(4 * sizeof(std::uint64_t)); // dims
+            detail::readArray(reader); // x
+            detail::readArray(reader); // p
+            detail::readArray(reader); // ye
+            detail::readArray(reader); // s
+            detail::readIndices(reader); // jb
+            detail::readIndices(reader); // jn
+        }
+        if(flags & FlagProps)
+            detail::readArray(reader);
+    }
+
+    /// Return a reader positioned at the data of the chemical state with given index.
+    auto readerAt(Index offset) const -> BinaryReader
+    {
+        BinaryReader reader(file.data(), file.size());
+        reader.seek(offset);
+        return reader;
+    }
+
+    /// Return the offset of the chemical state with given index.
+    auto stateOffset(Index istate) const -> Index
+    {
+        errorif(istate >= states.size(), "There is no chemical state with index ", istate, " in the checkpoint file (it has ", states.size(), " states).");
+        return states[istate];
+    }
+
+    /// Read the data of a chemical state into an existing chemical state.
+    auto readStateData(BinaryReader& reader, ChemicalState& state) const -> void
+    {
+        errorif(state.system().species().size() != Nn, "Cannot read a chemical state from a checkpoint file into a chemical state of a different chemical system.");
+
+        const auto T = reader.read<double>();
+        const auto P = reader.read<double>();
+        const auto n = ArrayXdConstMap(reader.view<double>(Nn), Nn);
+        const auto flags = reader.read<std::uint64_t>();
+
+        state.setTemperature(T);
+        state.setPressure(P);
+        state.setSpeciesAmounts(n);
+
+        auto& equilibrium = state.equilibrium();
+
+        if(flags & FlagEquilibrium)
+        {
+            const auto inames = reader.read<std::uint64_t>();
+            errorif(inames >= names.size(), "The checkpoint file is corrupted (reference to an unknown block of names).");
+            auto const& [wnames, pnames, qnames] = names[inames];
+
+            const auto w = detail::readArray(reader);
+            const auto c = detail::readArray(reader);
+
+            Optima::Dims dims;
+            dims.x  = reader.read<std::uint64_t>();
+            dims.p  = reader.read<std::uint64_t>();
+            dims.be = reader.read<std::uint64_t>();
+            dims.c  = reader.read<std::uint64_t>();
+
+            Optima::State optstate(dims);
+            optstate.x  = detail::readArray(reader);
+            optstate.p  = detail::readArray(reader);
+            optstate.ye = detail::readArray(reader);
+            optstate.s  = detail::readArray(reader);
+            optstate.jb = detail::readIndices(reader);
+            optstate.jn = detail::readIndices(reader);
+
+            equilibrium.setNamesInputVariables(wnames);
+            equilibrium.setNamesControlVariablesP(pnames);
+            equilibrium.setNamesControlVariablesQ(qnames);
+            equilibrium.setInputVariables(w);
+            equilibrium.setInitialComponentAmounts(c);
+            equilibrium.setOptimaState(optstate);
+        }
+        else equilibrium.reset();
+
+        if(flags & FlagProps)
+            state.props().update(detail::readArray(reader));
+    }
+
+    /// Read the chemical state with given index into an existing chemical state.
+    auto read(Index istate, ChemicalState& state) const -> void
+    {
+        auto reader = readerAt(stateOffset(istate));
+        readStateData(reader, state);
+    }
+
+    /// Read the knowledge database into a smart chemical equilibrium solver.
+    auto read(SmartEquilibriumSolver& solver, EquilibriumSpecs const& specs) const -> void
+    {
+        ChemicalState state(system);
+        EquilibriumConditions conditions(specs);
+        EquilibriumSensitivity sensitivity(specs);
+
+        for(auto offset : knowledge)
+        {
+            auto reader = readerAt(offset);
+
+            readStateData(reader, state);
+
+            const auto w = detail::readArray(reader);
+            const auto c = detail::readArray(reader);
+
+            conditions.setInputVariables(w.cast<real>());
+            conditions.setInitialComponentAmounts(c.matrix());
+
+            sensitivity.dndw(detail::readMatrix(reader));
+            sensitivity.dpdw(detail::readMatrix(reader));
+            sensitivity.dqdw(detail::readMatrix(reader));
+            sensitivity.dndc(detail::readMatrix(reader));
+            sensitivity.dpdc(detail::readMatrix(reader));
+            sensitivity.dqdc(detail::readMatrix(reader));
+            sensitivity.dudw(detail::readMatrix(reader));
+            sensitivity.dudc(detail::readMatrix(reader));
+
+            solver.store(state, conditions, sensitivity);
+        }
+    }
+};
+
+CheckpointReader::CheckpointReader(String const& filename, ChemicalSystem const& system)
+: pimpl(new Impl(filename, system))
+{}
+
+CheckpointReader::~CheckpointReader()
+{}
+
+auto CheckpointReader::version() const -> Index
+{
+    return pimpl->version;
+}
+
+auto CheckpointReader::numStates() const -> Index
+{
+    return pimpl->states.size();
+}
+
+auto CheckpointReader::temperature(Index istate) const -> double
+{
+    auto reader = pimpl->readerAt(pimpl->stateOffset(istate));
+    return reader.read<double>();
+}
+
+auto CheckpointReader::pressure(Index istate) const -> double
+{
+    auto reader = pimpl->readerAt(pimpl->stateOffset(istate) + sizeof(double));
+    return reader.read<double>();
+}
+
+auto CheckpointReader::speciesAmounts(Index istate) const -> ArrayXdConstMap
+{
+    auto reader = pimpl->readerAt(pimpl->stateOffset(istate) + 2 * sizeof(double));
+    return ArrayXdConstMap(reader.view<double>(pimpl->Nn), pimpl->Nn);
+}
+
+auto CheckpointReader::read(Index istate, ChemicalState& state) const -> void
+{
+    pimpl->read(istate, state);
+}
+
+auto CheckpointReader::hasKnowledgeBase() const -> bool
+{
+    return !pimpl->knowledge.empty();
+}
+
+auto CheckpointReader::read(SmartEquilibriumSolver& solver, EquilibriumSpecs const& specs) const -> void
+{
+    pimpl->read(solver, specs);
+}
+
+} // namespace Reaktoro
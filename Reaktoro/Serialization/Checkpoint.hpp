@@ -0,0 +1,137 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Matrix.hpp>
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+// Forward declarations
+class ChemicalState;
+class ChemicalSystem;
+class EquilibriumSpecs;
+class SmartEquilibriumSolver;
+
+/// The options for writing checkpoint files.
+/// @see CheckpointWriter
+struct CheckpointOptions
+{
+    /// The boolean flag that indicates whether the chemical properties of the states should also be written.
+    /// This is not needed to warm-start equilibrium calculations after a
+    /// restart, since the chemical properties are recomputed by the solvers,
+    /// but it avoids an explicit update of these properties before they are
+    /// used after a restart.
+    bool props = false;
+};
+
+/// Used to write checkpoint files with the state of long reactive transport simulations.
+/// A checkpoint file is a versioned binary file containing a sequence of
+/// chemical states (e.g., one per cell of a discretized domain), including
+/// their temperatures, pressures, species amounts, and the data needed to
+/// warm-start chemical equilibrium calculations (the Optima state and the
+/// *w*, *p*, *q*, *c* variables). Optionally, the knowledge database of a
+/// SmartEquilibriumSolver object can also be written. The data is streamed to
+/// the file as it is written, using buffered output, and can be read back with
+/// a CheckpointReader object.
+/// @see CheckpointReader
+class CheckpointWriter
+{
+public:
+    /// Construct a CheckpointWriter object.
+    /// @param filename The path to the checkpoint file (overwritten if existent)
+    /// @param system The chemical system of the states written to the checkpoint file
+    /// @param options The options for writing the checkpoint file
+    CheckpointWriter(String const& filename, ChemicalSystem const& system, CheckpointOptions const& options = {});
+
+    /// Destroy this CheckpointWriter object after closing the checkpoint file.
+    ~CheckpointWriter();
+
+    /// Write a chemical state to the checkpoint file.
+    auto write(ChemicalState const& state) -> void;
+
+    /// Write the knowledge database of a smart chemical equilibrium solver to the checkpoint file.
+    auto write(SmartEquilibriumSolver const& solver) -> void;
+
+    /// Return the number of chemical states written so far.
+    auto numStates() const -> Index;
+
+    /// Write any buffered data and close the checkpoint file.
+    auto close() -> void;
+
+private:
+    struct Impl;
+
+    Ptr<Impl> pimpl;
+};
+
+/// Used to read checkpoint files written with CheckpointWriter.
+/// The checkpoint file is memory-mapped and its data is accessed on demand
+/// directly from the mapped memory. Methods such as @ref speciesAmounts
+/// return views to this memory without any copy.
+/// @see CheckpointWriter
+class CheckpointReader
+{
+public:
+    /// Construct a CheckpointReader object.
+    /// @param filename The path to the checkpoint file
+    /// @param system The chemical system of the states in the checkpoint file
+    CheckpointReader(String const& filename, ChemicalSystem const& system);
+
+    /// Destroy this CheckpointReader object.
+    ~CheckpointReader();
+
+    /// Return the version of the format of the checkpoint file.
+    auto version() const -> Index;
+
+    /// Return the number of chemical states in the checkpoint file.
+    auto numStates() const -> Index;
+
+    /// Return the temperature of the chemical state with given index (in K).
+    auto temperature(Index istate) const -> double;
+
+    /// Return the pressure of the chemical state with given index (in Pa).
+    auto pressure(Index istate) const -> double;
+
+    /// Return the amounts of the species in the chemical state with given index (in mol).
+    /// The returned array maps directly the memory of the checkpoint file.
+    auto speciesAmounts(Index istate) const -> ArrayXdConstMap;
+
+    /// Read the chemical state with given index into an existing chemical state.
+    /// @param istate The index of the chemical state in the checkpoint file
+    /// @param[out] state The chemical state restored from the checkpoint file
+    auto read(Index istate, ChemicalState& state) const -> void;
+
+    /// Return true if the checkpoint file contains the knowledge database of a smart chemical equilibrium solver.
+    auto hasKnowledgeBase() const -> bool;
+
+    /// Read the knowledge database in the checkpoint file into a smart chemical equilibrium solver.
+    /// Note that the usage counts used to prioritize the search of records
+    /// in the knowledge database are not stored and start from zero.
+    /// @param[out] solver The smart chemical equilibrium solver whose knowledge database is extended
+    /// @param specs The chemical equilibrium specifications used in the smart chemical equilibrium solver
+    auto read(SmartEquilibriumSolver& solver, EquilibriumSpecs const& specs) const -> void;
+
+private:
+    struct Impl;
+
+    Ptr<Impl> pimpl;
+};
+
+} // namespace Reaktoro
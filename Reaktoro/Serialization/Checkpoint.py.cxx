@@ -0,0 +1,55 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// pybind11 includes
+#include <Reaktoro/pybind11.hxx>
+
+// Reaktoro includes
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSpecs.hpp>
+#include <Reaktoro/Equilibrium/SmartEquilibriumSolver.hpp>
+#include <Reaktoro/Serialization/Checkpoint.hpp>
+using namespace Reaktoro;
+
+void exportCheckpoint(py::module& m)
+{
+    py::class_<CheckpointOptions>(m, "CheckpointOptions")
+        .def(py::init<>())
+        .def_readwrite("props", &CheckpointOptions::props, "The boolean flag that indicates whether the chemical properties of the states should also be written.")
+        ;
+
+    py::class_<CheckpointWriter>(m, "CheckpointWriter")
+        .def(py::init<String const&, ChemicalSystem const&, CheckpointOptions const&>(), py::arg("filename"), py::arg("system"), py::arg("options") = CheckpointOptions{})
+        .def("write", py::overload_cast<ChemicalState const&>(&CheckpointWriter::write), "Write a chemical state to the checkpoint file.")
+        .def("write", py::overload_cast<SmartEquilibriumSolver const&>(&CheckpointWriter::write), "Write the knowledge database of a smart chemical equilibrium solver to the checkpoint file.")
+        .def("numStates", &CheckpointWriter::numStates, "Return the number of chemical states written so far.")
+        .def("close", &CheckpointWriter::close, "Write any buffered data and close the checkpoint file.")
+        ;
+
+    py::class_<CheckpointReader>(m, "CheckpointReader")
+        .def(py::init<String const&, ChemicalSystem const&>())
+        .def("version", &CheckpointReader::version, "Return the version of the format of the checkpoint file.")
+        .def("numStates", &CheckpointReader::numStates, "Return the number of chemical states in the checkpoint file.")
+        .def("temperature", &CheckpointReader::temperature, "Return the temperature of the chemical state with given index (in K).")
+        .def("pressure", &CheckpointReader::pressure, "Return the pressure of the chemical state with given index (in Pa).")
+        .def("speciesAmounts", [](CheckpointReader const& self, Index istate) -> ArrayXd { return self.speciesAmounts(istate); }, "Return the amounts of the species in the chemical state with given index (in mol).")
+        .def("read", py::overload_cast<Index, ChemicalState&>(&CheckpointReader::read, py::const_), "Read the chemical state with given index into an existing chemical state.")
+        .def("hasKnowledgeBase", &CheckpointReader::hasKnowledgeBase, "Return true if the checkpoint file contains the knowledge database of a smart chemical equilibrium solver.")
+        .def("read", py::overload_cast<SmartEquilibriumSolver&, EquilibriumSpecs const&>(&CheckpointReader::read, py::const_), "Read the knowledge database in the checkpoint file into a smart chemical equilibrium solver.")
+        ;
+}
@@ -0,0 +1,125 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <cstdio>
+
+// Reaktoro includes
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSpecs.hpp>
+#include <Reaktoro/Equilibrium/SmartEquilibriumResult.hpp>
+#include <Reaktoro/Equilibrium/SmartEquilibriumSolver.hpp>
+#include <Reaktoro/Extensions/Supcrt/SupcrtDatabase.hpp>
+#include <Reaktoro/Serialization/Checkpoint.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing CheckpointWriter and CheckpointReader", "[Checkpoint]")
+{
+    const String filename = "reaktoro-checkpoint-test.rkt";
+
+    SupcrtDatabase db("supcrtbl");
+
+    ChemicalSystem system(db,
+        AqueousPhase("H2O(aq) H+ OH- Ca+2 HCO3- CO3-2 CO2(aq)"),
+        MineralPhase("Calcite"));
+
+    const auto specs = EquilibriumSpecs::TP(system);
+
+    EquilibriumSolver solver(specs);
+    SmartEquilibriumSolver smartsolver(specs);
+
+    // Create a few chemical states, some of them equilibrated
+    Vec<ChemicalState> states;
+    for(auto i = 0; i < 4; ++i)
+    {
+        ChemicalState state(system);
+        state.temperature(25.0 + 10.0*i, "celsius");
+        state.pressure(1.0 + i, "bar");
+        state.set("H2O(aq)", 1.0, "kg");
+        state.set("Calcite", 1.0 + 0.1*i, "mol");
+        if(i > 0)
+            REQUIRE( solver.solve(state).succeeded() );
+        states.push_back(state);
+    }
+
+    // Populate the knowledge database of the smart solver
+    ChemicalState smartstate(states[1]);
+    REQUIRE( smartsolver.solve(smartstate).learned() );
+
+    CheckpointWriter writer(filename, system);
+    for(auto const& state : states)
+        writer.write(state);
+    writer.write(smartsolver);
+    writer.close();
+
+    CHECK( writer.numStates() == states.size() );
+
+    CheckpointReader reader(filename, system);
+
+    CHECK( reader.version() == 1 );
+    CHECK( reader.numStates() == states.size() );
+    CHECK( reader.hasKnowledgeBase() );
+
+    for(auto i = 0; i < states.size(); ++i)
+    {
+        CHECK( reader.temperature(i) == states[i].temperature() );
+        CHECK( reader.pressure(i) == states[i].pressure() );
+        CHECK( reader.speciesAmounts(i).isApprox(states[i].speciesAmounts().cast<double>()) );
+
+        ChemicalState restored(system);
+        reader.read(i, restored);
+
+        CHECK( restored.temperature() == states[i].temperature() );
+        CHECK( restored.pressure() == states[i].pressure() );
+        CHECK( (restored.speciesAmounts() == states[i].speciesAmounts()).all() );
+        CHECK( restored.equilibrium().empty() == states[i].equilibrium().empty() );
+
+        if(states[i].equilibrium().empty())
+            continue;
+
+        CHECK( restored.equilibrium().namesInputVariables() == states[i].equilibrium().namesInputVariables() );
+        CHECK( restored.equilibrium().w().isApprox(states[i].equilibrium().w()) );
+        CHECK( restored.equilibrium().c().isApprox(states[i].equilibrium().c()) );
+        CHECK( restored.equilibrium().p().isApprox(states[i].equilibrium().p()) );
+        CHECK( (restored.equilibrium().indicesPrimarySpecies() == states[i].equilibrium().indicesPrimarySpecies()).all() );
+        CHECK( restored.equilibrium().elementChemicalPotentials().isApprox(states[i].equilibrium().elementChemicalPotentials()) );
+
+        // Restarting from the restored state should warm-start as the original state does
+        ChemicalState original(states[i]);
+        const auto result0 = solver.solve(original);
+        const auto result1 = solver.solve(restored);
+
+        CHECK( result1.iterations() == result0.iterations() );
+    }
+
+    // Restore the knowledge database into a new smart solver and check it predicts a state it learned before
+    SmartEquilibriumSolver newsmartsolver(specs);
+    reader.read(newsmartsolver, specs);
+
+    ChemicalState state(states[1]);
+    CHECK( newsmartsolver.solve(state).predicted() );
+
+    CHECK_THROWS( reader.read(states.size(), state) );
+
+    std::remove(filename.c_str());
+}
@@ -18,6 +18,7 @@
 #pragma once
 
 // Reaktoro includes
+#include <Reaktoro/Common/HashIndex.hpp>
 #include <Reaktoro/Common/Index.hpp>
 #include <Reaktoro/Common/StringList.hpp>
 #include <Reaktoro/Common/Types.hpp>
@@ -80,6 +81,12 @@ private:
     /// The elements stored in the periodic table.
     Vec<Element> m_elements;
 
+    /// The hash index of the element symbols.
+    HashIndex<String> m_symbols_index;
+
+    /// The hash index of the element names.
+    HashIndex<String> m_names_index;
+
 private:
     /// Construct a default Elements object [private].
     Elements();
@@ -206,17 +206,17 @@ struct AqueousProps::Impl
         // The symbols of the elements in the aqueous phase
         const auto symbols = vectorize(phase.elements(), RKT_LAMBDA(x, x.symbol()));
 
-        // Collect the species from the database that contains the elements in the aqueous phase
-        const auto species_same_elements = system.database().species().withElements(symbols);
-
         // Collect the non-aqueous species from the database that contains the elements in the aqueous phase
-        nonaqueous = removefn(species_same_elements, RKT_LAMBDA(x, x.aggregateState() == AggregateState::Aqueous));
+        Vec<Species> collected = system.database().speciesWithFilter([&](SpeciesRecord const& record) {
+            return record.aggregate_state != AggregateState::Aqueous && contained(record.elements, symbols); });
 
         // Ensure non-aqueous species are sorted by aggregate state (gases, solids, etc)
-        std::sort(nonaqueous.begin(), nonaqueous.end(),
+        std::sort(collected.begin(), collected.end(),
             [](auto l, auto r)
                 { return l.aggregateState() < r.aggregateState(); });
 
+        nonaqueous = collected;
+
         // Assemble the formula matrices of the aqueous and non-aqueous species w.r.t. elements in the aqueous phase
         Aaqs = detail::assembleFormulaMatrix(phase.species(), phase.elements());
         Anon = detail::assembleFormulaMatrix(nonaqueous, phase.elements());
@@ -278,7 +278,7 @@ struct AqueousProps::Impl
         props = cprops;
 
         // Update the internal aqueous state object
-        aqstate = aqsolution.state(T, P, x);
+        aqsolution.state(T, P, x, aqstate);
 
         // Update auxiliary vector naq to be used in the echelonization below
         naq = aqprops.speciesAmounts();
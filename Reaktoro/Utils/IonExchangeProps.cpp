@@ -81,7 +81,7 @@ struct IonExchangeProps::Impl
     ArrayXr nex;
 
     /// The extra properties and data produced during the evaluation of the ion exchange phase activity model.
-    Map<String, Any> extra;
+    SlotMap extra;
 
     Impl(const ChemicalSystem& system)
     : system(system),
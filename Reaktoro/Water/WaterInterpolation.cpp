@@ -18,12 +18,13 @@
 #include "WaterInterpolation.hpp"
 
 // C++ includes
-#include <sstream>
+#include <algorithm>
+#include <cmath>
 
 // Reaktoro includes
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Common/InterpolationUtils.hpp>
-#include <Reaktoro/Core/Embedded.hpp>
+#include <Reaktoro/Water/WaterInterpolationData.hpp>
 #include <Reaktoro/Water/WaterThermoProps.hpp>
 
 namespace Reaktoro {
@@ -188,6 +189,163 @@ const Vec<Vec<double>> densities_vapor =
     { 1.237391e+03, 1.234940e+03, 1.232378e+03, 1.229829e+03, 1.227295e+03, 1.224773e+03, 1.222265e+03, 1.219768e+03, 1.217282e+03, 1.214806e+03, 1.212339e+03, 1.209879e+03, 1.207427e+03, 1.204981e+03, 1.202540e+03, 1.200104e+03, 1.197672e+03, 1.195242e+03, 1.192815e+03, 1.190390e+03, 1.187967e+03, 1.183123e+03, 1.178281e+03, 1.173440e+03, 1.168598e+03, 1.163755e+03, 1.158910e+03, 1.154064e+03, 1.149216e+03, 1.144368e+03, 1.139520e+03, 1.134673e+03, 1.129827e+03, 1.124984e+03, 1.120143e+03, 1.115307e+03, 1.110475e+03, 1.105649e+03, 1.100829e+03, 1.096017e+03, 1.091213e+03, 1.086416e+03, 1.081630e+03, 1.076854e+03, 1.072088e+03, 1.067334e+03, 1.055502e+03, 1.043755e+03, 1.032100e+03, 1.020544e+03, 1.009096e+03, 9.977622e+02, 9.865466e+02, 9.754563e+02, 9.536690e+02, 9.324319e+02, 9.117666e+02, 8.916878e+02, 8.722007e+02, 8.533039e+02, 8.349913e+02, 8.172513e+02, 8.092803e+02 },
 };
 
+/// Used to find in constant time the first node, in a sorted list of interpolation nodes, that is not less than a given value.
+/// This gives the same result as std::lower_bound, but the search starts at a node obtained from a
+/// uniform partition of the range of the nodes into buckets, so that only a few nodes need to be visited.
+class WaterInterpNodeLocator
+{
+public:
+    /// Construct a default WaterInterpNodeLocator object.
+    WaterInterpNodeLocator() = default;
+
+    /// Construct a WaterInterpNodeLocator object with given sorted nodes and width of the buckets.
+    WaterInterpNodeLocator(Vec<double> const& nodes, double width)
+    : nodes(nodes), xmin(nodes.front()), dx(width)
+    {
+        const auto numbuckets = 1 + static_cast<Index>((nodes.back() - xmin) / dx);
+        buckets.resize(numbuckets);
+        for(Index k = 0; k < numbuckets; ++k)
+            buckets[k] = std::lower_bound(nodes.begin(), nodes.end(), xmin + k*dx) - nodes.begin();
+    }
+
+    /// Return the index of the first node that is not less than *x*.
+    auto lowerBound(double x) const -> Index
+    {
+        if(!(x > xmin)) return 0;
+        const auto n = nodes.size();
+        const auto k = static_cast<Index>(std::min((x - xmin)/dx, static_cast<double>(buckets.size() - 1)));
+        Index i = buckets[k];
+        while(i > 0 && nodes[i - 1] >= x) --i; // guard against round-off errors in the bucket boundaries
+        while(i < n && nodes[i] < x) ++i;
+        return i;
+    }
+
+    /// Return the index of the first node that is not less than *x*, checking first if *hint* (the result of a previous lookup) is still the answer.
+    auto lowerBound(double x, Index& hint) const -> Index
+    {
+        const auto n = nodes.size();
+        if(hint <= n && (hint == 0 || nodes[hint - 1] < x) && (hint == n || nodes[hint] >= x))
+            return hint;
+        return hint = lowerBound(x);
+    }
+
+private:
+    /// The sorted interpolation nodes.
+    Vec<double> nodes;
+
+    /// The first interpolation node.
+    double xmin = 0.0;
+
+    /// The width of the buckets.
+    double dx = 1.0;
+
+    /// The index of the first node not less than the lower boundary of each bucket.
+    Indices buckets;
+};
+
+/// Used to store the data needed for fast lookup of the interpolation cell containing a given temperature and pressure.
+struct WaterInterpGrid
+{
+    /// The node locator along the logarithm of the pressures (in MPa).
+    WaterInterpNodeLocator Plocator;
+
+    /// The node locators along the temperatures of each pressure row.
+    Vec<WaterInterpNodeLocator> Tlocators;
+
+    /// The index of the first row of each pressure in the compiled table of water properties.
+    Indices offsets;
+};
+
+auto createWaterInterpGrid() -> WaterInterpGrid
+{
+    WaterInterpGrid grid;
+
+    Vec<double> logpressures(pressures.size());
+    for(Index i = 0; i < pressures.size(); ++i)
+        logpressures[i] = std::log(pressures[i]);
+
+    grid.Plocator = WaterInterpNodeLocator(logpressures, 0.01); // the smallest log-spacing of pressures is about 0.013
+
+    grid.Tlocators.resize(pressures.size());
+    grid.offsets.resize(pressures.size());
+
+    Index offset = 0;
+    for(Index i = 0; i < pressures.size(); ++i)
+    {
+        grid.Tlocators[i] = WaterInterpNodeLocator(temperatures[i], 5.0); // most temperatures are spaced 5 K or more
+        grid.offsets[i] = offset;
+        offset += temperatures[i].size();
+    }
+
+    errorif(offset != detail::waterThermoPropsWagnerPrussInterpNumRows, "Expecting the compiled table of water properties for interpolation to have one row per temperature and pressure node.");
+
+    return grid;
+}
+
+/// Return the interpolation grid of water properties, created once and shared among all threads.
+auto waterInterpGrid() -> WaterInterpGrid const&
+{
+    static const WaterInterpGrid grid = createWaterInterpGrid();
+    return grid;
+}
+
+/// Return the index of the first pressure node not less than *PMPa* (in MPa), reusing the pressure interval of the last call in the current thread if possible.
+auto lowerBoundPressure(double PMPa) -> Index
+{
+    thread_local Index hint = 0;
+    return waterInterpGrid().Plocator.lowerBound(std::log(PMPa), hint);
+}
+
+/// Return the index of the first temperature node not less than *T* along pressure row *iP*, reusing the temperature interval of the last call in the current thread if possible.
+auto lowerBoundTemperature(Index iP, double T) -> Index
+{
+    thread_local Indices hints(pressures.size(), 0);
+    return waterInterpGrid().Tlocators[iP].lowerBound(T, hints[iP]);
+}
+
+/// Return the weights of the quadratic interpolation at *x* with given nodes *x0*, *x1* and *x2* (consistent with @ref interpolateQuadratic).
+auto quadraticWeights(real const& x, double x0, double x1, double x2) -> Array<real, 3>
+{
+    if(x0 == x2)
+        return { real(1.0), real(0.0), real(0.0) };
+    if(x0 == x1 || x1 == x2)
+    {
+        const real t = (x - x0)/(x2 - x0);
+        return { 1.0 - t, real(0.0), t };
+    }
+    return {
+        ((x - x1)*(x - x2))/((x0 - x1)*(x0 - x2)),
+        ((x - x0)*(x - x2))/((x1 - x0)*(x1 - x2)),
+        ((x - x0)*(x - x1))/((x2 - x0)*(x2 - x1))
+    };
+}
+
+/// Add the water properties in a row of the compiled table, multiplied by weight *w*, to the given water properties.
+auto addWeightedRow(WaterThermoProps& props, real const& w, double const* row) -> void
+{
+    props.T   += w * row[0];
+    props.V   += w * row[1];
+    props.S   += w * row[2];
+    props.A   += w * row[3];
+    props.U   += w * row[4];
+    props.H   += w * row[5];
+    props.G   += w * row[6];
+    props.Cv  += w * row[7];
+    props.Cp  += w * row[8];
+    props.D   += w * row[9];
+    props.DT  += w * row[10];
+    props.DP  += w * row[11];
+    props.DTT += w * row[12];
+    props.DTP += w * row[13];
+    props.DPP += w * row[14];
+    props.P   += w * row[15];
+    props.PT  += w * row[16];
+    props.PD  += w * row[17];
+    props.PTT += w * row[18];
+    props.PTD += w * row[19];
+    props.PDD += w * row[20];
+}
+
 auto waterDensityWagnerPrussInterp(real const& T, real const& P, StateOfMatter som) -> real
 {
     errorif(T <= 0.0, "Unable to interpolate water density at ", T, " K and ", P, " Pa because of zero or negative temperature.");
@@ -197,7 +355,7 @@ auto waterDensityWagnerPrussInterp(real const& T, real const& P, StateOfMatter s
 
     errorif(PMPa > pressures.back(), "Unable to interpolate water density at ", T, " K and ", PMPa, " MPa because interpolation over pressure is limited to ", pressures.back(), " MPa.");
 
-    const Index iP = std::lower_bound(pressures.begin(), pressures.end(), PMPa) - pressures.begin();
+    const Index iP = lowerBoundPressure(PMPa.val());
 
     const Index iPmax = pressures.size() - 1;
 
@@ -215,7 +373,7 @@ auto waterDensityWagnerPrussInterp(real const& T, real const& P, StateOfMatter s
 
         errorif(T > Ts.back(), "Unable to interpolate water density at ", T, " K and ", PMPa, " MPa because interpolation over temperature is limited to ", Ts.back(), " K along the interpolation data row corresponding to ", pressures[indexP], " MPa.");
 
-        const Index iT = std::lower_bound(Ts.begin(), Ts.end(), T) - Ts.begin();
+        const Index iT = lowerBoundTemperature(indexP, T.val());
 
         const Index iTmax = Ts.size() - 1;
 
@@ -238,68 +396,72 @@ auto waterDensityWagnerPrussInterp(real const& T, real const& P, StateOfMatter s
     return interpolateQuadratic(PMPa, P0, P1, P2, D0, D1, D2);
 }
 
-auto parseWaterThermoPropsWagnerPrussInterpData(StateOfMatter som) -> Vec<Vec<WaterThermoProps>>
+auto createWaterThermoPropsWagnerPrussInterpData() -> Vec<Vec<WaterThermoProps>>
 {
-    // TODO: Use som here to distinguish different data files to fetch interpolation data. This data must be regenerated for liquid and vapor states.
-    const auto text = Embedded::get("interpolation/WaterThermoPropsWagnerPruss.txt");
-    std::istringstream file(text);
-    String line;
+    using detail::waterThermoPropsWagnerPrussInterpTable;
+    using detail::waterThermoPropsWagnerPrussInterpNumRows;
+
+    Vec<Vec<WaterThermoProps>> data(pressures.size());
 
-    Vec<Vec<WaterThermoProps>> data;
+    Index irow = 0;
 
-    while(std::getline(file, line))
+    for(Index i = 0; i < pressures.size(); ++i)
     {
-        if(line[0] == 'P')
-        {
-            data.push_back(Vec<WaterThermoProps>());
-        }
-        else
+        data[i].resize(temperatures[i].size());
+
+        for(auto& props : data[i])
         {
-            std::istringstream ss(line);
-
-            WaterThermoProps props;
-
-            ss >> props.T.val()
-               >> props.V.val()
-               >> props.S.val()
-               >> props.A.val()
-               >> props.U.val()
-               >> props.H.val()
-               >> props.G.val()
-               >> props.Cv.val()
-               >> props.Cp.val()
-               >> props.D.val()
-               >> props.DT.val()
-               >> props.DP.val()
-               >> props.DTT.val()
-               >> props.DTP.val()
-               >> props.DPP.val()
-               >> props.P.val()
-               >> props.PT.val()
-               >> props.PD.val()
-               >> props.PTT.val()
-               >> props.PTD.val()
-               >> props.PDD.val();
-
-            data.back().push_back(props);
+            errorif(irow >= waterThermoPropsWagnerPrussInterpNumRows, "Expecting more rows in the compiled table of water properties for interpolation.");
+
+            auto const& row = waterThermoPropsWagnerPrussInterpTable[irow++];
+
+            props.T   = row[0];
+            props.V   = row[1];
+            props.S   = row[2];
+            props.A   = row[3];
+            props.U   = row[4];
+            props.H   = row[5];
+            props.G   = row[6];
+            props.Cv  = row[7];
+            props.Cp  = row[8];
+            props.D   = row[9];
+            props.DT  = row[10];
+            props.DP  = row[11];
+            props.DTT = row[12];
+            props.DTP = row[13];
+            props.DPP = row[14];
+            props.P   = row[15];
+            props.PT  = row[16];
+            props.PD  = row[17];
+            props.PTT = row[18];
+            props.PTD = row[19];
+            props.PDD = row[20];
         }
     }
 
+    errorif(irow != waterThermoPropsWagnerPrussInterpNumRows, "Expecting fewer rows in the compiled table of water properties for interpolation.");
+
     return data;
 }
 
 auto waterThermoPropsWagnerPrussInterpData(StateOfMatter som) -> Vec<Vec<WaterThermoProps>> const&
 {
-    thread_local Vec<Vec<WaterThermoProps>> data = parseWaterThermoPropsWagnerPrussInterpData(som);
+    // TODO: Use som here to distinguish different tables of interpolation data. This data must be regenerated for liquid and vapor states.
+    static const Vec<Vec<WaterThermoProps>> data = createWaterThermoPropsWagnerPrussInterpData(); // built once and shared among all threads (thread-safe initialization of function-local statics)
     return data;
 }
 
 auto waterThermoPropsWagnerPrussInterp(real const& T, real const& P, StateOfMatter som) -> WaterThermoProps
 {
+    errorif(T <= 0.0, "Unable to interpolate water properties at ", T, " K and ", P, " Pa because of zero or negative temperature.");
+    errorif(P <= 0.0, "Unable to interpolate water properties at ", T, " K and ", P, " Pa because of zero or negative pressure.");
+
     const auto PMPa = P * 1e-6; // from Pa to MPa
 
-    const Index iP = std::lower_bound(pressures.begin(), pressures.end(), PMPa) - pressures.begin();
-    const Index iT = std::lower_bound(temperatures[iP].begin(), temperatures[iP].end(), T) - temperatures[iP].begin();
+    errorif(PMPa > pressures.back(), "Unable to interpolate water properties at ", T, " K and ", PMPa, " MPa because interpolation over pressure is limited to ", pressures.back(), " MPa.");
+
+    const Index iP = lowerBoundPressure(PMPa.val());
+    const Index iT = lowerBoundTemperature(iP, T.val());
 
     const Index iPmax = iT < transitions[iP] ? pressures.size() : iP; // check if (T, P) is within liquid/supercritical state
 
@@ -308,35 +470,44 @@ auto waterThermoPropsWagnerPrussInterp(real const& T, real const& P, StateOfMatt
     const Index iP1 = iPmax > 1 ? iP0 + 1 : 0;
     const Index iP2 = iPmax > 0 ? iP1 + 1 : 0;
 
-    auto const& data = waterThermoPropsWagnerPrussInterpData(som);
+    const Array<Index, 3> iPs = { iP0, iP1, iP2 };
 
-    auto interpolateAtT = [&](Index indexP)
+    const auto wP = quadraticWeights(PMPa, pressures[iP0], pressures[iP1], pressures[iP2]);
+
+    auto const& grid = waterInterpGrid();
+
+    // The biquadratic interpolation below combines, with weights wP[i]*wT[j], the
+    // 3x3 rows of the compiled table around (T, P), which is the same as
+    // interpolating quadratically along temperature at each of the three
+    // pressures and then along pressure, but without temporary WaterThermoProps.
+    WaterThermoProps props;
+
+    for(Index i = 0; i < 3; ++i)
     {
+        if(i > 0 && iPs[i] == iPs[i - 1]) // skip repeated pressure nodes, whose interpolation weights are zero
+            continue;
+
+        const Index indexP = iPs[i];
+
         auto const& Ts = temperatures[indexP];
-        auto const& Ds = data[indexP];
 
-        const Index iT = std::lower_bound(Ts.begin(), Ts.end(), T) - Ts.begin();
+        const Index iT = lowerBoundTemperature(indexP, T.val());
 
         const auto iTtran = std::min(transitions[indexP], Ts.size()); // use min in case transitions[indexP] == 99
         const auto iTmax = iT < transitions[indexP] ? iTtran : Ts.size(); // used for ensuring that interpolation is performed within same state of matter
 
         // Set indices of temperature so that if there is phase transition along temperature, temperatures below that value are used
         const Index iT0 = std::min(iTmax - 3, iT);
-        const Index iT1 = iT0 + 1;
-        const Index iT2 = iT0 + 2;
 
-        return interpolateQuadratic(T, Ts[iT0], Ts[iT1], Ts[iT2], Ds[iT0], Ds[iT1], Ds[iT2]);
-    };
+        const auto wT = quadraticWeights(T, Ts[iT0], Ts[iT0 + 1], Ts[iT0 + 2]);
 
-    const auto P0 = pressures[iP0];
-    const auto P1 = pressures[iP1];
-    const auto P2 = pressures[iP2];
+        auto const* rows = detail::waterThermoPropsWagnerPrussInterpTable + grid.offsets[indexP] + iT0;
 
-    const auto D0 = interpolateAtT(iP0); // density at T and P=P0
-    const auto D1 = interpolateAtT(iP1); // density at T and P=P1
-    const auto D2 = interpolateAtT(iP2); // density at T and P=P2
+        for(Index j = 0; j < 3; ++j)
+            addWeightedRow(props, wP[i] * wT[j], rows[j]);
+    }
 
-    return interpolateQuadratic(PMPa, P0, P1, P2, D0, D1, D2);
+    return props;
 }
 
 } // namespace Reaktoro
@@ -41,6 +41,12 @@ auto waterDensityWagnerPrussInterp(real const& T, real const& P, StateOfMatter s
 /// shown in Table 13.2 of *Wagner, W., Pruss, A. (2002). The IAPWS Formulation 1995 for the
 /// Thermodynamic Properties of Ordinary Water Substance for General and Scientific Use. Journal of
 /// Physical and Chemical Reference Data, 31(2), 387. https://doi.org/10.1063/1.1461829*.
+/// The interpolation cell containing the given temperature and pressure is found in constant time
+/// (and reused across consecutive calls in the same thread whenever possible), and the properties are
+/// computed as a weighted sum of the 3x3 nearest rows of the compiled interpolation table.
+/// @note Compared to @ref waterThermoPropsWagnerPruss, the interpolated density has relative errors below
+/// 1% over most of the interpolation range and up to about 5% near the critical point (e.g., 4.2% at 723 K
+/// and 125 MPa). Use the Wagner and Pruss (2002) equation of state directly if better accuracy is needed.
 /// @param T The temperature value (in K)
 /// @param P The pressure value (in Pa)
 /// @param som The desired state of matter for water (the actual state of matter may end up being different!)
@@ -51,7 +57,7 @@ auto waterThermoPropsWagnerPrussInterp(real const& T, real const& P, StateOfMatt
 /// shown in Table 13.2 of *Wagner, W., Pruss, A. (2002). The IAPWS Formulation 1995 for the
 /// Thermodynamic Properties of Ordinary Water Substance for General and Scientific Use. Journal of
 /// Physical and Chemical Reference Data, 31(2), 387. https://doi.org/10.1063/1.1461829*.
-/// @note The first call to this function will trigger a parsing operation of embedded text data.
+/// @note The interpolation data is compiled into the library and converted only once, on the first call to this function, into a container shared among all threads.
 /// @param som The desired state of matter for water (the actual state of matter may end up being different!)
 auto waterThermoPropsWagnerPrussInterpData(StateOfMatter som) -> Vec<Vec<WaterThermoProps>> const&;
 
@@ -19,6 +19,7 @@
 #include <catch2/catch.hpp>
 
 // Reaktoro includes
+#include <Reaktoro/Common/InterpolationUtils.hpp>
 #include <Reaktoro/Water/WaterInterpolation.hpp>
 #include <Reaktoro/Water/WaterThermoProps.hpp>
 #include <Reaktoro/Water/WaterThermoPropsUtils.hpp>
@@ -102,3 +103,107 @@ TEST_CASE("Testing water interpolation methods", "[WaterInterpolation]")
 
     // TODO: To reduce errors above (note the 4.17% error at 723K and 125MPa), more refinement in the interpolation grid is needed.
 }
+
+TEST_CASE("Testing water interpolation data", "[WaterInterpolation]")
+{
+    auto const& data = waterThermoPropsWagnerPrussInterpData(StateOfMatter::Liquid);
+
+    CHECK( data.size() == 31 ); // number of pressure points
+
+    auto const& first = data.front().front(); // at P = 0.05 MPa and lowest temperature
+    auto const& last = data.back().back();    // at P = 1000 MPa and highest temperature
+
+    CHECK( first.P.val() == Approx(0.05e6) );
+    CHECK( first.D.val() == Approx(waterDensityWagnerPruss(first.T.val(), 0.05e6, StateOfMatter::Liquid).val()).epsilon(1e-5) );
+
+    CHECK( last.T.val() == Approx(1273.0) );
+    CHECK( last.P.val() == Approx(1000e6) );
+    CHECK( last.D.val() == Approx(waterDensityWagnerPruss(last.T.val(), 1000e6, StateOfMatter::Liquid).val()).epsilon(1e-5) );
+
+    // The data is shared among all threads, not copied per thread
+    CHECK( &waterThermoPropsWagnerPrussInterpData(StateOfMatter::Liquid) == &data );
+}
+
+TEST_CASE("Testing water interpolation at interpolation nodes and cached cells", "[WaterInterpolation]")
+{
+    auto const& data = waterThermoPropsWagnerPrussInterpData(StateOfMatter::Liquid);
+
+    // Interpolation at liquid nodes reproduces the tabulated values
+    for(auto i : { 0, 6, 14, 25, 30 })
+    {
+        auto const& node = data[i][3];
+        auto const props = waterThermoPropsWagnerPrussInterp(node.T, node.P, StateOfMatter::Liquid);
+        CHECK( props.D.val() == Approx(node.D.val()) );
+        CHECK( props.H.val() == Approx(node.H.val()) );
+        CHECK( props.Cp.val() == Approx(node.Cp.val()) );
+    }
+
+    // Interpolated values do not depend on the cell used in previous calls
+    const auto Ts = { 280.0, 354.5, 600.0, 800.0, 1200.0 };
+    const auto Ps = { 0.07e6, 1.5e6, 22.0e6, 150.0e6, 900.0e6 };
+
+    Vec<double> forward, backward;
+
+    for(auto T : Ts)
+        for(auto P : Ps)
+            forward.push_back(waterThermoPropsWagnerPrussInterp(T, P, StateOfMatter::Liquid).D.val());
+
+    for(auto P : Ps)
+        for(auto T : Ts)
+            backward.push_back(waterThermoPropsWagnerPrussInterp(T, P, StateOfMatter::Liquid).D.val());
+
+    Index k = 0;
+    for(Index i = 0; i < Ts.size(); ++i)
+        for(Index j = 0; j < Ps.size(); ++j)
+            CHECK( forward[k++] == backward[j*Ts.size() + i] );
+}
+
+TEST_CASE("Testing water interpolation against interpolation with binary searches", "[WaterInterpolation]")
+{
+    auto const& data = waterThermoPropsWagnerPrussInterpData(StateOfMatter::Liquid);
+
+    Vec<double> pressures;
+    for(auto const& row : data)
+        pressures.push_back(row.front().P.val());
+
+    // Interpolate along temperature at three pressures and then along pressure, finding the nodes with std::lower_bound
+    // (only valid at supercritical pressures, where the interpolation rows have no phase transitions)
+    auto interpolateBinarySearch = [&](double T, double P)
+    {
+        const Index iP = std::lower_bound(pressures.begin(), pressures.end(), P) - pressures.begin();
+        const Index iP0 = std::min(pressures.size() - 3, iP);
+
+        auto interpolateAtT = [&](Index indexP)
+        {
+            Vec<double> Ts;
+            for(auto const& props : data[indexP])
+                Ts.push_back(props.T.val());
+            auto const& Ds = data[indexP];
+            const Index iT = std::lower_bound(Ts.begin(), Ts.end(), T) - Ts.begin();
+            const Index iT0 = std::min(Ts.size() - 3, iT);
+            return interpolateQuadratic(real(T), Ts[iT0], Ts[iT0 + 1], Ts[iT0 + 2], Ds[iT0], Ds[iT0 + 1], Ds[iT0 + 2]);
+        };
+
+        const auto W0 = interpolateAtT(iP0);
+        const auto W1 = interpolateAtT(iP0 + 1);
+        const auto W2 = interpolateAtT(iP0 + 2);
+
+        return interpolateQuadratic(real(P), pressures[iP0], pressures[iP0 + 1], pressures[iP0 + 2], W0, W1, W2);
+    };
+
+    // The cells found in constant time must be the same as those found with binary searches,
+    // for points visited in order (reusing the cell of the previous call) and out of order
+    for(auto T : { 400.0, 401.0, 650.5, 999.9, 1000.0, 1200.0, 402.0, 1272.0 })
+    {
+        for(auto P : { 25.0e6, 30.0e6, 30.5e6, 150.0e6, 999.0e6, 26.0e6 })
+        {
+            const auto expected = interpolateBinarySearch(T, P);
+            const auto actual = waterThermoPropsWagnerPrussInterp(T, P, StateOfMatter::Liquid);
+
+            INFO("T = " << T << " K, P = " << P << " Pa");
+            CHECK( actual.D.val()  == Approx(expected.D.val()).epsilon(1e-12) );
+            CHECK( actual.H.val()  == Approx(expected.H.val()).epsilon(1e-12) );
+            CHECK( actual.Cp.val() == Approx(expected.Cp.val()).epsilon(1e-12) );
+        }
+    }
+}
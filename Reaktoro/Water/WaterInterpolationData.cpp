@@ -0,0 +1,2243 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// THIS FILE WAS GENERATED BY scripts/generate-water-properties-for-interpolation-wagner-pruss.py -- DO NOT EDIT IT MANUALLY
+// ---------------------------------------------------------------------------------------------------------------------------
+
+#include "WaterInterpolationData.hpp"
+
+namespace Reaktoro {
+namespace detail {
+
+const double waterThermoPropsWagnerPrussInterpTable[waterThermoPropsWagnerPrussInterpNumRows][waterThermoPropsWagnerPrussInterpNumCols] =
+{
+    // P = 0.05 MPa
+    { +2.731560e+02, +1.000183e-03, -5.843910e-02, +4.948496e-04, -1.596250e+01, +3.404664e+01, +5.000963e+01, +4.217208e+03, +4.219679e+03, +9.998174e+02, +6.783538e-02, +5.088075e-07, -1.820833e-02, -3.815949e-09, -1.192168e-15, +5.000000e+04, -1.333223e+05, +1.965380e+06, +3.382816e+04, +1.412599e+04, +9.050591e+03 },
+    { +2.750000e+02, +1.000088e-03, +2.831121e+01, -2.607932e+01, +7.759504e+03, +7.809508e+03, +2.392508e+01, +4.213032e+03, +4.213715e+03, +9.999122e+02, +3.530611e-02, +5.020547e-07, -1.709438e-02, -3.513025e-09, -1.154554e-15, +5.000000e+04, -7.032324e+04, +1.991815e+06, +3.307607e+04, +1.361520e+04, +9.123496e+03 },
+    { +2.800000e+02, +1.000114e-03, +1.041161e+02, -3.578122e+02, +2.879470e+04, +2.884470e+04, -3.078065e+02, +4.200050e+03, +4.201150e+03, +9.998860e+02, -4.370126e-02, +4.862928e-07, -1.462811e-02, -2.819543e-09, -1.075848e-15, +5.000000e+04, +8.986614e+04, +2.056374e+06, +3.114084e+04, +1.233177e+04, +9.355289e+03 },
+    { +2.850000e+02, +1.000507e-03, +1.783939e+02, -1.064718e+03, +4.977756e+04, +4.982758e+04, -1.014693e+03, +4.185001e+03, +4.192552e+03, +9.994930e+02, -1.119630e-01, +4.736263e-07, -1.275829e-02, -2.266618e-09, -1.022514e-15, +5.000000e+04, +2.363953e+05, +2.111369e+06, +2.932073e+04, +1.118186e+04, +9.624143e+03 },
+    { +2.900000e+02, +1.001221e-03, +2.512562e+02, -2.139449e+03, +7.072483e+04, +7.077490e+04, -2.089388e+03, +4.168219e+03, +4.186769e+03, +9.987801e+02, -1.719718e-01, +4.634601e-07, -1.130316e-02, -1.814058e-09, -9.870748e-16, +5.000000e+04, +3.710607e+05, +2.157683e+06, +2.758666e+04, +1.015070e+04, +9.915461e+03 },
+    { +2.950000e+02, +1.002221e-03, +3.227922e+02, -3.575156e+03, +9.164855e+04, +9.169866e+04, -3.525045e+03, +4.149940e+03, +4.183026e+03, +9.977841e+02, -2.254897e-01, +4.553627e-07, -1.014632e-02, -1.435542e-09, -9.647516e-16, +5.000000e+04, +4.951869e+05, +2.196051e+06, +2.592352e+04, +9.227036e+03, +1.021746e+04 },
+    { +3.000000e+02, +1.003478e-03, +3.930762e+02, -5.365398e+03, +1.125575e+05, +1.126076e+05, -5.315224e+03, +4.130344e+03, +4.180781e+03, +9.965339e+02, -2.738017e-01, +4.490115e-07, -9.210292e-03, -1.113120e-09, -9.524363e-16, +5.000000e+04, +6.097878e+05, +2.227114e+06, +2.432450e+04, +8.401829e+03, +1.052116e+04 },
+    { +3.050000e+02, +1.004971e-03, +4.621710e+02, -7.504074e+03, +1.334581e+05, +1.335083e+05, -7.453825e+03, +4.109577e+03, +4.179653e+03, +9.950531e+02, -3.178709e-01, +4.441594e-07, -8.441769e-03, -8.340882e-10, -9.480693e-16, +5.000000e+04, +7.156685e+05, +2.251444e+06, +2.278735e+04, +7.667326e+03, +1.081991e+04 },
+    { +3.100000e+02, +1.006683e-03, +5.301310e+02, -9.985377e+03, +1.543552e+05, +1.544056e+05, -9.935043e+03, +4.087768e+03, +4.179371e+03, +9.933610e+02, -3.584351e-01, +4.406139e-07, -7.802995e-03, -5.891571e-10, -9.502667e-16, +5.000000e+04, +8.134902e+05, +2.269561e+06, +2.131208e+04, +7.016511e+03, +1.110890e+04 },
+    { +3.150000e+02, +1.008600e-03, +5.970046e+02, -1.280376e+04, +1.752527e+05, +1.753031e+05, -1.275333e+04, +4.065039e+03, +4.179748e+03, +9.914736e+02, -3.960711e-01, +4.382227e-07, -7.266591e-03, -3.713362e-10, -9.580908e-16, +5.000000e+04, +9.038123e+05, +2.281945e+06, +1.989963e+04, +6.442802e+03, +1.138471e+04 },
+    { +3.200000e+02, +1.010709e-03, +6.628353e+02, -1.595389e+04, +1.961534e+05, +1.962039e+05, -1.590335e+04, +4.041504e+03, +4.180655e+03, +9.894044e+02, -4.312376e-01, +4.368644e-07, -6.812292e-03, -1.752339e-10, -9.709078e-16, +5.000000e+04, +9.871200e+05, +2.289040e+06, +1.855107e+04, +5.939918e+03, +1.164496e+04 },
+    { +3.250000e+02, +1.013002e-03, +7.276629e+02, -1.943066e+04, +2.170598e+05, +2.171104e+05, -1.938001e+04, +4.017276e+03, +4.182011e+03, +9.871648e+02, -4.643052e-01, +4.364413e-07, -6.424840e-03, +3.398578e-12, -9.882969e-16, +5.000000e+04, +1.063843e+06, +2.291259e+06, +1.726722e+04, +5.501831e+03, +1.188803e+04 },
+    { +3.300000e+02, +1.015471e-03, +7.915245e+02, -2.322914e+04, +2.379739e+05, +2.380247e+05, -2.317837e+04, +3.992466e+03, +4.183767e+03, +9.847644e+02, -4.955778e-01, +4.368750e-07, -6.092579e-03, +1.679747e-10, -1.009992e-15, +5.000000e+04, +1.134370e+06, +2.288984e+06, +1.604839e+04, +5.122767e+03, +1.211285e+04 },
+    { +3.350000e+02, +1.018111e-03, +8.544550e+02, -2.734461e+04, +2.588978e+05, +2.589487e+05, -2.729370e+04, +3.967181e+03, +4.185900e+03, +9.822115e+02, -5.253079e-01, +4.381023e-07, -5.806493e-03, +3.212845e-10, -1.035845e-15, +5.000000e+04, +1.199053e+06, +2.282572e+06, +1.489442e+04, +4.797224e+03, +1.231879e+04 },
+    { +3.400000e+02, +1.020915e-03, +9.164875e+02, -3.177247e+04, +2.798333e+05, +2.798843e+05, -3.172142e+04, +3.941521e+03, +4.188406e+03, +9.795135e+02, -5.537079e-01, +4.400730e-07, -5.559532e-03, +4.656464e-10, -1.065799e-15, +5.000000e+04, +1.258218e+06, +2.272350e+06, +1.380463e+04, +4.519995e+03, +1.250550e+04 },
+    { +3.450000e+02, +1.023881e-03, +9.776538e+02, -3.650833e+04, +3.007822e+05, +3.008334e+05, -3.645713e+04, +3.915583e+03, +4.191293e+03, +9.766764e+02, -5.809591e-01, +4.427472e-07, -5.346140e-03, +6.030177e-10, -1.099872e-15, +5.000000e+04, +1.312169e+06, +2.258625e+06, +1.277786e+04, +4.286185e+03, +1.267286e+04 },
+    { +3.500000e+02, +1.027005e-03, +1.037984e+03, -4.154792e+04, +3.217466e+05, +3.217979e+05, -4.149657e+04, +3.889456e+03, +4.194579e+03, +9.737056e+02, -6.072178e-01, +4.460943e-07, -5.161900e-03, +7.350774e-10, -1.138148e-15, +5.000000e+04, +1.361187e+06, +2.241679e+06, +1.181261e+04, +4.091227e+03, +1.282090e+04 },
+    { +3.544670e+02, +1.029928e-03, +1.091201e+03, -4.630384e+04, +3.404908e+05, +3.405423e+05, -4.625234e+04, +3.866024e+03, +4.197873e+03, +9.709421e+02, -6.299498e-01, +4.496350e-07, -5.019063e-03, +8.497649e-10, -1.176014e-15, +5.000000e+04, +1.401025e+06, +2.224026e+06, +1.100080e+04, +3.946450e+03, +1.293696e+04 },
+    { +3.544670e+02, +1.029928e-03, +1.091201e+03, -4.630384e+04, +3.404908e+05, +3.405423e+05, -4.625234e+04, +3.866024e+03, +4.197873e+03, +9.709421e+02, -6.299498e-01, +4.496350e-07, -5.019063e-03, +8.497649e-10, -1.176014e-15, +5.000000e+04, +1.401025e+06, +2.224026e+06, +1.100080e+04, +3.946450e+03, +1.293696e+04 },
+    { +3.550000e+02, +3.245160e+00, +7.596029e+03, -2.125589e+05, +2.484031e+06, +2.646289e+06, -5.030091e+04, +1.512128e+03, +2.013792e+03, +3.081512e-01, -9.139855e-04, +6.225378e-06, +6.281449e-06, -1.951382e-08, +2.630050e-12, +5.000000e+04, +1.468161e+02, +1.606328e+05, -9.770563e-02, +4.935498e+02, -1.090101e+04 },
+    { +3.600000e+02, +3.293181e+00, +7.624083e+03, -2.530105e+05, +2.491659e+06, +2.656318e+06, -8.835144e+04, +1.501189e+03, +1.998673e+03, +3.036578e-01, -8.837843e-04, +6.129805e-06, +5.818028e-06, -1.873225e-08, +2.367421e-12, +5.000000e+04, +1.441782e+02, +1.631373e+05, -7.596920e-02, +4.894519e+02, -1.027863e+04 },
+    { +3.650000e+02, +3.341018e+00, +7.651571e+03, -2.935917e+05, +2.499232e+06, +2.666283e+06, -1.265408e+05, +1.493451e+03, +1.987496e+03, +2.993099e-01, -8.556602e-04, +6.037916e-06, +5.442805e-06, -1.803507e-08, +2.148348e-12, +5.000000e+04, +1.417145e+02, +1.656201e+05, -6.198978e-02, +4.863509e+02, -9.759853e+03 },
+    { +3.700000e+02, +3.388701e+00, +7.678551e+03, -3.343014e+05, +2.506762e+06, +2.676197e+06, -1.648663e+05, +1.487691e+03, +1.978810e+03, +2.950983e-01, -8.292659e-04, +5.949353e-06, +5.122332e-06, -1.739899e-08, +1.960121e-12, +5.000000e+04, +1.393876e+02, +1.680855e+05, -5.210823e-02, +4.838498e+02, -9.308366e+03 },
+    { +3.750000e+02, +3.436252e+00, +7.705064e+03, -3.751381e+05, +2.514261e+06, +2.686073e+06, -2.033255e+05, +1.483279e+03, +1.971858e+03, +2.910148e-01, -8.043739e-04, +5.863846e-06, +4.839858e-06, -1.681109e-08, +1.795534e-12, +5.000000e+04, +1.371751e+02, +1.705365e+05, -4.459834e-02, +4.817488e+02, -8.905244e+03 },
+    { +3.800000e+02, +3.483685e+00, +7.731143e+03, -4.161005e+05, +2.521734e+06, +2.695918e+06, -2.419162e+05, +1.479867e+03, +1.966214e+03, +2.870523e-01, -7.808194e-04, +5.781176e-06, +4.586208e-06, -1.626340e-08, +1.650046e-12, +5.000000e+04, +1.350624e+02, +1.729752e+05, -3.860136e-02, +4.799396e+02, -8.539795e+03 },
+    { +3.850000e+02, +3.531016e+00, +7.756815e+03, -4.571871e+05, +2.529187e+06, +2.705737e+06, -2.806363e+05, +1.477244e+03, +1.961615e+03, +2.832046e-01, -7.584732e-04, +5.701155e-06, +4.355811e-06, -1.575043e-08, +1.520503e-12, +5.000000e+04, +1.330385e+02, +1.754031e+05, -3.365902e-02, +4.783579e+02, -8.205384e+03 },
+    { +3.900000e+02, +3.578256e+00, +7.782101e+03, -4.983965e+05, +2.536623e+06, +2.715536e+06, -3.194837e+05, +1.475272e+03, +1.957882e+03, +2.794658e-01, -7.372289e-04, +5.623620e-06, +4.144931e-06, -1.526809e-08, +1.404547e-12, +5.000000e+04, +1.310951e+02, +1.778214e+05, -2.950510e-02, +4.769617e+02, -7.897475e+03 },
+    { +3.950000e+02, +3.625414e+00, +7.807023e+03, -5.397274e+05, +2.544047e+06, +2.725317e+06, -3.584567e+05, +1.473850e+03, +1.954883e+03, +2.758306e-01, -7.169960e-04, +5.548428e-06, +3.950840e-06, -1.481315e-08, +1.300316e-12, +5.000000e+04, +1.292251e+02, +1.802312e+05, -2.597032e-02, +4.757215e+02, -7.612705e+03 },
+    { +4.000000e+02, +3.672498e+00, +7.831598e+03, -5.811783e+05, +2.551461e+06, +2.735086e+06, -3.975534e+05, +1.472901e+03, +1.952519e+03, +2.722942e-01, -6.976960e-04, +5.475448e-06, +3.771423e-06, -1.438290e-08, +1.206292e-12, +5.000000e+04, +1.274226e+02, +1.826335e+05, -2.293769e-02, +4.746145e+02, -7.348410e+03 },
+    { +4.100000e+02, +3.766474e+00, +7.879768e+03, -6.644350e+05, +2.566270e+06, +2.754594e+06, -4.761113e+05, +1.472186e+03, +1.949377e+03, +2.655003e-01, -6.616271e-04, +5.335663e-06, +3.450068e-06, -1.358779e-08, +1.043996e-12, +5.000000e+04, +1.240009e+02, +1.874181e+05, -1.805280e-02, +4.727316e+02, -6.872798e+03 },
+    { +4.200000e+02, +3.860233e+00, +7.926723e+03, -7.481563e+05, +2.581067e+06, +2.774079e+06, -5.551447e+05, +1.472750e+03, +1.947948e+03, +2.590517e-01, -6.285564e-04, +5.203441e-06, +3.170270e-06, -1.286807e-08, +9.096574e-13, +5.000000e+04, +1.207963e+02, +1.921805e+05, -1.435859e-02, +4.712024e+02, -6.456630e+03 },
+    { +4.300000e+02, +3.953812e+00, +7.972556e+03, -8.323326e+05, +2.595866e+06, +2.793557e+06, -6.346420e+05, +1.474317e+03, +1.947862e+03, +2.529204e-01, -5.981091e-04, +5.078088e-06, +2.924315e-06, -1.221245e-08, +7.973843e-13, +5.000000e+04, +1.177823e+02, +1.969245e+05, -1.153069e-02, +4.699479e+02, -6.089295e+03 },
+    { +4.400000e+02, +4.047242e+00, +8.017345e+03, -9.169544e+05, +2.610678e+06, +2.813040e+06, -7.145923e+05, +1.476681e+03, +1.948843e+03, +2.470818e-01, -5.699769e-04, +4.959008e-06, +2.706379e-06, -1.161207e-08, +7.027437e-13, +5.000000e+04, +1.149377e+02, +2.016532e+05, -9.343275e-03, +4.689091e+02, -5.762521e+03 },
+    { +4.500000e+02, +4.140546e+00, +8.061161e+03, -1.002013e+06, +2.625509e+06, +2.832537e+06, -7.949856e+05, +1.479687e+03, +1.950681e+03, +2.415140e-01, -5.439032e-04, +4.845686e-06, +2.511964e-06, -1.105979e-08, +6.223486e-13, +5.000000e+04, +1.122448e+02, +2.063691e+05, -7.635039e-03, +4.680416e+02, -5.469755e+03 },
+    { +4.600000e+02, +4.233743e+00, +8.104061e+03, -1.087500e+06, +2.640368e+06, +2.852056e+06, -8.758125e+05, +1.483213e+03, +1.953215e+03, +2.361976e-01, -5.196711e-04, +4.737671e-06, +2.337525e-06, -1.054977e-08, +5.535772e-13, +5.000000e+04, +1.096891e+02, +2.110742e+05, -6.288970e-03, +4.673113e+02, -5.205751e+03 },
+    { +4.700000e+02, +4.326848e+00, +8.146100e+03, -1.173406e+06, +2.655260e+06, +2.871603e+06, -9.570640e+05, +1.487167e+03, +1.956317e+03, +2.311151e-01, -4.970956e-04, +4.634566e-06, +2.180227e-06, -1.007719e-08, +4.943758e-13, +5.000000e+04, +1.072583e+02, +2.157699e+05, -5.219211e-03, +4.666919e+02, -4.966266e+03 },
+    { +4.800000e+02, +4.419875e+00, +8.187324e+03, -1.259726e+06, +2.670190e+06, +2.891184e+06, -1.038732e+06, +1.491474e+03, +1.959890e+03, +2.262507e-01, -4.760172e-04, +4.536016e-06, +2.037764e-06, -9.638008e-09, +4.431186e-13, +5.000000e+04, +1.049417e+02, +2.204578e+05, -4.362127e-03, +4.661628e+02, -4.747841e+03 },
+    { +4.900000e+02, +4.512834e+00, +8.227775e+03, -1.346450e+06, +2.685160e+06, +2.910802e+06, -1.120808e+06, +1.496075e+03, +1.963854e+03, +2.215902e-01, -4.562972e-04, +4.441706e-06, +1.908243e-06, -9.228775e-09, +3.985059e-13, +5.000000e+04, +1.027302e+02, +2.251387e+05, -3.670123e-03, +4.657079e+02, -4.547632e+03 },
+    { +5.000000e+02, +4.605734e+00, +8.267493e+03, -1.433572e+06, +2.700175e+06, +2.930462e+06, -1.203285e+06, +1.500924e+03, +1.968146e+03, +2.171207e-01, -4.378145e-04, +4.351351e-06, +1.790086e-06, -8.846551e-09, +3.594892e-13, +5.000000e+04, +1.006158e+02, +2.298137e+05, -3.107287e-03, +4.653144e+02, -4.363284e+03 },
+    { +5.100000e+02, +4.698582e+00, +8.306512e+03, -1.521085e+06, +2.715237e+06, +2.950166e+06, -1.286155e+06, +1.505983e+03, +1.972717e+03, +2.128302e-01, -4.204620e-04, +4.264694e-06, +1.681968e-06, -8.488793e-09, +3.252153e-13, +5.000000e+04, +9.859139e+01, +2.344834e+05, -2.646302e-03, +4.649720e+02, -4.192832e+03 },
+    { +5.200000e+02, +4.791384e+00, +8.344865e+03, -1.608982e+06, +2.730348e+06, +2.969917e+06, -1.369413e+06, +1.511221e+03, +1.977524e+03, +2.087080e-01, -4.041454e-04, +4.181501e-06, +1.582764e-06, -8.153285e-09, +2.949847e-13, +5.000000e+04, +9.665080e+01, +2.391486e+05, -2.266221e-03, +4.646725e+02, -4.034622e+03 },
+    { +5.300000e+02, +4.884146e+00, +8.382580e+03, -1.697258e+06, +2.745510e+06, +2.989717e+06, -1.453051e+06, +1.516614e+03, +1.982535e+03, +2.047441e-01, -3.887803e-04, +4.101560e-06, +1.491510e-06, -7.838084e-09, +2.682198e-13, +5.000000e+04, +9.478839e+01, +2.438097e+05, -1.950863e-03, +4.644091e+02, -3.887259e+03 },
+    { +5.400000e+02, +4.976871e+00, +8.419686e+03, -1.785906e+06, +2.760725e+06, +3.009568e+06, -1.537062e+06, +1.522142e+03, +1.987723e+03, +2.009294e-01, -3.742915e-04, +4.024677e-06, +1.407379e-06, -7.541477e-09, +2.444402e-13, +5.000000e+04, +9.299912e+01, +2.484671e+05, -1.687632e-03, +4.641765e+02, -3.749552e+03 },
+    { +5.500000e+02, +5.069565e+00, +8.456208e+03, -1.874921e+06, +2.775994e+06, +3.029472e+06, -1.621442e+06, +1.527787e+03, +1.993064e+03, +1.972556e-01, -3.606114e-04, +3.950674e-06, +1.329652e-06, -7.261941e-09, +2.232441e-13, +5.000000e+04, +9.127845e+01, +2.531214e+05, -1.466658e-03, +4.639701e+02, -3.620483e+03 },
+    { +5.600000e+02, +5.162230e+00, +8.492169e+03, -1.964296e+06, +2.791318e+06, +3.049430e+06, -1.706185e+06, +1.533537e+03, +1.998541e+03, +1.937147e-01, -3.476792e-04, +3.879386e-06, +1.257700e-06, -6.998124e-09, +2.042935e-13, +5.000000e+04, +8.962222e+01, +2.577727e+05, -1.280153e-03, +4.637863e+02, -3.499175e+03 },
+    { +5.700000e+02, +5.254869e+00, +8.527591e+03, -2.054027e+06, +2.806700e+06, +3.069443e+06, -1.791284e+06, +1.539379e+03, +2.004138e+03, +1.902997e-01, -3.354399e-04, +3.810663e-06, +1.190975e-06, -6.748811e-09, +1.873023e-13, +5.000000e+04, +8.802666e+01, +2.624215e+05, -1.121932e-03, +4.636218e+02, -3.384866e+03 },
+    { +5.800000e+02, +5.347485e+00, +8.562496e+03, -2.144109e+06, +2.822139e+06, +3.089513e+06, -1.876735e+06, +1.545305e+03, +2.009842e+03, +1.870038e-01, -3.238439e-04, +3.744365e-06, +1.128991e-06, -6.512912e-09, +1.720273e-13, +5.000000e+04, +8.648833e+01, +2.670680e+05, -9.870508e-04, +4.634742e+02, -3.276897e+03 },
+    { +5.900000e+02, +5.440080e+00, +8.596903e+03, -2.234536e+06, +2.837636e+06, +3.109640e+06, -1.962532e+06, +1.551306e+03, +2.015642e+03, +1.838208e-01, -3.128458e-04, +3.680363e-06, +1.071320e-06, -6.289445e-09, +1.582607e-13, +5.000000e+04, +8.500404e+01, +2.717123e+05, -8.715361e-04, +4.633413e+02, -3.174688e+03 },
+    { +6.000000e+02, +5.532656e+00, +8.630829e+03, -2.325304e+06, +2.853193e+06, +3.129826e+06, -2.048671e+06, +1.557377e+03, +2.021530e+03, +1.807450e-01, -3.024044e-04, +3.618538e-06, +1.017583e-06, -6.077519e-09, +1.458243e-13, +5.000000e+04, +8.357088e+01, +2.763547e+05, -7.721740e-04, +4.632212e+02, -3.077731e+03 },
+    { +6.100000e+02, +5.625215e+00, +8.664293e+03, -2.416408e+06, +2.868810e+06, +3.150071e+06, -2.135147e+06, +1.563511e+03, +2.027498e+03, +1.777710e-01, -2.924821e-04, +3.558777e-06, +9.674389e-07, -5.876328e-09, +1.345645e-13, +5.000000e+04, +8.218613e+01, +2.809954e+05, -6.863510e-04, +4.631123e+02, -2.985576e+03 },
+    { +6.200000e+02, +5.717757e+00, +8.697310e+03, -2.507843e+06, +2.884488e+06, +3.170376e+06, -2.221956e+06, +1.569704e+03, +2.033539e+03, +1.748938e-01, -2.830446e-04, +3.500978e-06, +9.205855e-07, -5.685136e-09, +1.243485e-13, +5.000000e+04, +8.084731e+01, +2.856345e+05, -6.119304e-04, +4.630133e+02, -2.897827e+03 },
+    { +6.300000e+02, +5.810285e+00, +8.729896e+03, -2.599606e+06, +2.900228e+06, +3.190742e+06, -2.309092e+06, +1.575952e+03, +2.039648e+03, +1.721086e-01, -2.740604e-04, +3.445043e-06, +8.767508e-07, -5.503275e-09, +1.150610e-13, +5.000000e+04, +7.955208e+01, +2.902721e+05, -5.471564e-04, +4.629232e+02, -2.814130e+03 },
+    { +6.400000e+02, +5.902800e+00, +8.762065e+03, -2.691692e+06, +2.916030e+06, +3.211169e+06, -2.396552e+06, +1.582252e+03, +2.045820e+03, +1.694111e-01, -2.655004e-04, +3.390883e-06, +8.356904e-07, -5.330132e-09, +1.066016e-13, +5.000000e+04, +7.829829e+01, +2.949084e+05, -4.905789e-04, +4.628408e+02, -2.734168e+03 },
+    { +6.500000e+02, +5.995302e+00, +8.793832e+03, -2.784097e+06, +2.931894e+06, +3.231659e+06, -2.484332e+06, +1.588601e+03, +2.052052e+03, +1.667973e-01, -2.573380e-04, +3.338413e-06, +7.971839e-07, -5.165144e-09, +9.888253e-14, +5.000000e+04, +7.708393e+01, +2.995435e+05, -4.409945e-04, +4.627654e+02, -2.657659e+03 },
+    { +6.750000e+02, +6.226511e+00, +8.871573e+03, -3.016480e+06, +2.971832e+06, +3.283157e+06, -2.705154e+06, +1.604674e+03, +2.067869e+03, +1.606036e-01, -2.385156e-04, +3.214128e-06, +7.108312e-07, -4.785079e-09, +8.234175e-14, +5.000000e+04, +7.420851e+01, +3.111264e+05, -3.414392e-04, +4.626025e+02, -2.479880e+03 },
+    { +7.000000e+02, +6.457662e+00, +8.947067e+03, -3.250775e+06, +3.012172e+06, +3.335055e+06, -2.927892e+06, +1.621008e+03, +2.083993e+03, +1.548548e-01, -2.216955e-04, +3.098819e-06, +6.366113e-07, -4.445882e-09, +6.900066e-14, +5.000000e+04, +7.154193e+01, +3.227036e+05, -2.679901e-04, +4.624693e+02, -2.318806e+03 },
+    { +7.250000e+02, +6.688765e+00, +9.020482e+03, -3.486929e+06, +3.052921e+06, +3.387359e+06, -3.152490e+06, +1.637580e+03, +2.100389e+03, +1.495044e-01, -2.066014e-04, +2.991541e-06, +5.724426e-07, -4.141815e-09, +5.814413e-14, +5.000000e+04, +6.906187e+01, +3.342759e+05, -2.129145e-04, +4.623592e+02, -2.171806e+03 },
+    { +7.500000e+02, +6.919827e+00, +9.091968e+03, -3.724891e+06, +3.094085e+06, +3.440076e+06, -3.378900e+06, +1.654369e+03, +2.117030e+03, +1.445123e-01, -1.930036e-04, +2.891476e-06, +5.166643e-07, -3.868133e-09, +4.923831e-14, +5.000000e+04, +6.674916e+01, +3.458442e+05, -1.710156e-04, +4.622673e+02, -2.036782e+03 },
+    { +7.750000e+02, +7.150856e+00, +9.161660e+03, -3.964617e+06, +3.135670e+06, +3.493212e+06, -3.607074e+06, +1.671354e+03, +2.133890e+03, +1.398434e-01, -1.807095e-04, +2.797914e-06, +4.679381e-07, -3.620876e-09, +4.187943e-14, +5.000000e+04, +6.458722e+01, +3.574091e+05, -1.387265e-04, +4.621897e+02, -1.912043e+03 },
+    { +8.000000e+02, +7.381855e+00, +9.229677e+03, -4.206062e+06, +3.177680e+06, +3.546772e+06, -3.836969e+06, +1.688516e+03, +2.150945e+03, +1.354673e-01, -1.695570e-04, +2.710239e-06, +4.251765e-07, -3.396720e-09, +3.575843e-14, +5.000000e+04, +6.256163e+01, +3.689711e+05, -1.135523e-04, +4.621238e+02, -1.796203e+03 },
+    { +8.250000e+02, +7.612830e+00, +9.296128e+03, -4.449186e+06, +3.220120e+06, +3.600761e+06, -4.068545e+06, +1.705834e+03, +2.168171e+03, +1.313572e-01, -1.594084e-04, +2.627909e-06, +3.874891e-07, -3.192853e-09, +3.063621e-14, +5.000000e+04, +6.065979e+01, +3.805306e+05, -9.371738e-05, +4.620673e+02, -1.688122e+03 },
+    { +8.500000e+02, +7.843784e+00, +9.361112e+03, -4.693952e+06, +3.262993e+06, +3.655182e+06, -4.301763e+06, +1.723286e+03, +2.185543e+03, +1.274895e-01, -1.501464e-04, +2.550448e-06, +3.541414e-07, -3.006881e-09, +2.632597e-14, +5.000000e+04, +5.887061e+01, +3.920880e+05, -7.793866e-05, +4.620186e+02, -1.586847e+03 },
+    { +9.000000e+02, +8.305637e+00, +9.487025e+03, -5.188270e+06, +3.350053e+06, +3.765335e+06, -4.772988e+06, +1.758495e+03, +2.220622e+03, +1.204002e-01, -1.338934e-04, +2.408492e-06, +2.981267e-07, -2.680723e-09, +1.958266e-14, +5.000000e+04, +5.559221e+01, +4.151975e+05, -5.503082e-05, +4.619394e+02, -1.401638e+03 },
+    { +9.500000e+02, +8.767434e+00, +9.608035e+03, -5.688756e+06, +3.438877e+06, +3.877249e+06, -5.250384e+06, +1.793946e+03, +2.255973e+03, +1.140585e-01, -1.201470e-04, +2.281536e-06, +2.533515e-07, -2.405037e-09, +1.467341e-14, +5.000000e+04, +5.266058e+01, +4.383012e+05, -3.982453e-05, +4.618783e+02, -1.235518e+03 },
+    { +1.000000e+03, +9.229186e+00, +9.724652e+03, -6.195178e+06, +3.529474e+06, +3.990933e+06, -5.733718e+06, +1.829438e+03, +2.291386e+03, +1.083519e-01, -1.084162e-04, +2.167314e-06, +2.171258e-07, -2.169885e-09, +1.104347e-14, +5.000000e+04, +5.002328e+01, +4.614005e+05, -2.945237e-05, +4.618302e+02, -1.084775e+03 },
+    { +1.050000e+03, +9.690902e+00, +9.837303e+03, -6.707328e+06, +3.621840e+06, +4.106385e+06, -6.222783e+06, +1.864775e+03, +2.326660e+03, +1.031896e-01, -9.832474e-05, +2.063999e-06, +1.874988e-07, -1.967673e-09, +8.323517e-15, +5.000000e+04, +4.763797e+01, +4.844963e+05, -2.220673e-05, +4.617918e+02, -9.466255e+02 },
+    { +1.100000e+03, +1.015259e+01, +9.946347e+03, -7.225018e+06, +3.715964e+06, +4.223594e+06, -6.717389e+06, +1.899771e+03, +2.361605e+03, +9.849703e-02, -8.958050e-05, +1.970097e-06, +1.630316e-07, -1.792508e-09, +6.262011e-15, +5.000000e+04, +4.547010e+01, +5.075892e+05, -1.703668e-05, +4.617605e+02, -8.189377e+02 },
+    { +1.150000e+03, +1.061426e+01, +1.005209e+04, -7.748076e+06, +3.811825e+06, +4.342537e+06, -7.217363e+06, +1.934262e+03, +2.396054e+03, +9.421292e-02, -8.195369e-05, +1.884375e-06, +1.426466e-07, -1.639764e-09, +4.684192e-15, +5.000000e+04, +4.349117e+01, +5.306798e+05, -1.327671e-05, +4.617346e+02, -7.000553e+02 },
+    { +1.200000e+03, +1.107590e+01, +1.015478e+04, -8.276342e+06, +3.909393e+06, +4.463188e+06, -7.722547e+06, +1.968105e+03, +2.429862e+03, +9.028610e-02, -7.526154e-05, +1.805809e-06, +1.255259e-07, -1.505766e-09, +3.466469e-15, +5.000000e+04, +4.167747e+01, +5.537685e+05, -1.049467e-05, +4.617131e+02, -5.886702e+02 },
+    { +1.250000e+03, +1.153753e+01, +1.025464e+04, -8.809670e+06, +4.008634e+06, +4.585511e+06, -8.232794e+06, +2.001181e+03, +2.462910e+03, +8.667365e-02, -6.935724e-05, +1.733536e-06, +1.110408e-07, -1.387562e-09, +2.520039e-15, +5.000000e+04, +4.000912e+01, +5.768556e+05, -8.403622e-06, +4.616949e+02, -4.837364e+02 },
+    { +1.273000e+03, +1.174988e+01, +1.029969e+04, -9.056663e+06, +4.054836e+06, +4.642330e+06, -8.469169e+06, +2.016112e+03, +2.477828e+03, +8.510727e-02, -6.687218e-05, +1.702199e-06, +1.051239e-07, -1.337816e-09, +2.157266e-15, +5.000000e+04, +3.928575e+01, +5.874752e+05, -7.617726e-06, +4.616874e+02, -4.373937e+02 },
+    // P = 0.1 MPa
+    { +2.731530e+02, +1.000157e-03, -1.013922e-01, +2.148424e-03, -2.769342e+01, +7.232232e+01, +1.000179e+02, +4.216980e+03, +4.219441e+03, +9.998426e+02, +6.769921e-02, +5.087593e-07, -1.820163e-02, -3.815372e-09, -1.192037e-15, +1.000000e+05, -1.330673e+05, +1.965566e+06, +3.382215e+04, +1.412767e+04, +9.052168e+03 },
+    { +2.750000e+02, +1.000063e-03, +2.831297e+01, -2.607743e+01, +7.759990e+03, +7.859996e+03, +7.392884e+01, +4.212803e+03, +4.213479e+03, +9.999373e+02, +3.513048e-02, +5.019970e-07, -1.708656e-02, -3.512076e-09, -1.154364e-15, +1.000000e+05, -6.998147e+04, +1.992044e+06, +3.306922e+04, +1.361619e+04, +9.125142e+03 },
+    { +2.800000e+02, +1.000090e-03, +1.041139e+02, -3.578104e+02, +2.879409e+04, +2.889410e+04, -2.578014e+02, +4.199838e+03, +4.200945e+03, +9.999104e+02, -4.384222e-02, +4.862390e-07, -1.462197e-02, -2.818898e-09, -1.075668e-15, +1.000000e+05, +9.016598e+04, +2.056602e+06, +3.113499e+04, +1.233306e+04, +9.356832e+03 },
+    { +2.850000e+02, +1.000484e-03, +1.783883e+02, -1.064716e+03, +4.977596e+04, +4.987601e+04, -9.646679e+02, +4.184803e+03, +4.192370e+03, +9.995167e+02, -1.120763e-01, +4.735752e-07, -1.275332e-02, -2.266184e-09, -1.022338e-15, +1.000000e+05, +2.366601e+05, +2.111597e+06, +2.931575e+04, +1.118336e+04, +9.625597e+03 },
+    { +2.900000e+02, +1.001198e-03, +2.512475e+02, -2.139447e+03, +7.072234e+04, +7.082246e+04, -2.039327e+03, +4.168033e+03, +4.186604e+03, +9.988033e+02, -1.720625e-01, +4.634108e-07, -1.129904e-02, -1.813775e-09, -9.868956e-16, +1.000000e+05, +3.712959e+05, +2.157913e+06, +2.758241e+04, +1.015232e+04, +9.916830e+03 },
+    { +2.950000e+02, +1.002198e-03, +3.227809e+02, -3.575154e+03, +9.164521e+04, +9.174543e+04, -3.474934e+03, +4.149765e+03, +4.182874e+03, +9.978068e+02, -2.255614e-01, +4.553145e-07, -1.014284e-02, -1.435373e-09, -9.645665e-16, +1.000000e+05, +4.953970e+05, +2.196284e+06, +2.591992e+04, +9.228711e+03, +1.021875e+04 },
+    { +3.000000e+02, +1.003456e-03, +3.930624e+02, -5.365396e+03, +1.125533e+05, +1.126537e+05, -5.265050e+03, +4.130179e+03, +4.180640e+03, +9.965563e+02, -2.738574e-01, +4.489639e-07, -9.207303e-03, -1.113039e-09, -9.522425e-16, +1.000000e+05, +6.099764e+05, +2.227351e+06, +2.432147e+04, +8.403516e+03, +1.052236e+04 },
+    { +3.050000e+02, +1.004949e-03, +4.621549e+02, -7.504072e+03, +1.334532e+05, +1.335537e+05, -7.403577e+03, +4.109421e+03, +4.179520e+03, +9.950753e+02, -3.179126e-01, +4.441120e-07, -8.439163e-03, -8.340792e-10, -9.478650e-16, +1.000000e+05, +7.158388e+05, +2.251684e+06, +2.278480e+04, +7.668994e+03, +1.082104e+04 },
+    { +3.100000e+02, +1.006661e-03, +5.301129e+02, -9.985375e+03, +1.543496e+05, +1.544503e+05, -9.884709e+03, +4.087621e+03, +4.179245e+03, +9.933830e+02, -3.584646e-01, +4.405664e-07, -7.800692e-03, -5.892084e-10, -9.500502e-16, +1.000000e+05, +8.136448e+05, +2.269805e+06, +2.130997e+04, +7.018138e+03, +1.110996e+04 },
+    { +3.150000e+02, +1.008577e-03, +5.969845e+02, -1.280375e+04, +1.752464e+05, +1.753472e+05, -1.270290e+04, +4.064899e+03, +4.179627e+03, +9.914955e+02, -3.960897e-01, +4.381748e-07, -7.264529e-03, -3.714402e-10, -9.578607e-16, +1.000000e+05, +9.039534e+05, +2.282194e+06, +1.989789e+04, +6.444373e+03, +1.138571e+04 },
+    { +3.200000e+02, +1.010687e-03, +6.628133e+02, -1.595388e+04, +1.961464e+05, +1.962474e+05, -1.585282e+04, +4.041371e+03, +4.180538e+03, +9.894263e+02, -4.312463e-01, +4.368159e-07, -6.810425e-03, -1.753855e-10, -9.706626e-16, +1.000000e+05, +9.872497e+05, +2.289294e+06, +1.854967e+04, +5.941424e+03, +1.164590e+04 },
+    { +3.250000e+02, +1.012980e-03, +7.276391e+02, -1.943065e+04, +2.170520e+05, +2.171533e+05, -1.932936e+04, +4.017150e+03, +4.181897e+03, +9.871866e+02, -4.643051e-01, +4.363919e-07, -6.423130e-03, +3.202906e-12, -9.880352e-16, +1.000000e+05, +1.063963e+06, +2.291518e+06, +1.726610e+04, +5.503266e+03, +1.188892e+04 },
+    { +3.300000e+02, +1.015449e-03, +7.914990e+02, -2.322914e+04, +2.379655e+05, +2.380671e+05, -2.312760e+04, +3.992347e+03, +4.183655e+03, +9.847862e+02, -4.955694e-01, +4.368245e-07, -6.090994e-03, +1.677369e-10, -1.009713e-15, +1.000000e+05, +1.134482e+06, +2.289249e+06, +1.604753e+04, +5.124127e+03, +1.211370e+04 },
+    { +3.350000e+02, +1.018088e-03, +8.544278e+02, -2.734460e+04, +2.588887e+05, +2.589905e+05, -2.724279e+04, +3.967067e+03, +4.185789e+03, +9.822334e+02, -5.252918e-01, +4.380505e-07, -5.805008e-03, +3.210055e-10, -1.035546e-15, +1.000000e+05, +1.199158e+06, +2.282842e+06, +1.489378e+04, +4.798507e+03, +1.231960e+04 },
+    { +3.400000e+02, +1.020892e-03, +9.164587e+02, -3.177247e+04, +2.798235e+05, +2.799256e+05, -3.167038e+04, +3.941413e+03, +4.188296e+03, +9.795355e+02, -5.536846e-01, +4.400197e-07, -5.558127e-03, +4.653264e-10, -1.065477e-15, +1.000000e+05, +1.258318e+06, +2.272626e+06, +1.380417e+04, +4.521201e+03, +1.250627e+04 },
+    { +3.450000e+02, +1.023857e-03, +9.776233e+02, -3.650832e+04, +3.007717e+05, +3.008741e+05, -3.640594e+04, +3.915480e+03, +4.191184e+03, +9.766985e+02, -5.809289e-01, +4.426922e-07, -5.344795e-03, +6.026562e-10, -1.099526e-15, +1.000000e+05, +1.312264e+06, +2.258906e+06, +1.277757e+04, +4.287315e+03, +1.267360e+04 },
+    { +3.500000e+02, +1.026981e-03, +1.037952e+03, -4.154792e+04, +3.217354e+05, +3.218381e+05, -4.144522e+04, +3.889359e+03, +4.194470e+03, +9.737279e+02, -6.071811e-01, +4.460374e-07, -5.160601e-03, +7.346733e-10, -1.137776e-15, +1.000000e+05, +1.361278e+06, +2.241964e+06, +1.181246e+04, +4.092283e+03, +1.282162e+04 },
+    { +3.550000e+02, +1.030261e-03, +1.097475e+03, -4.688714e+04, +3.427165e+05, +3.428195e+05, -4.678412e+04, +3.863132e+03, +4.198180e+03, +9.706281e+02, -6.325776e-01, +4.500325e-07, -5.002018e-03, +8.628408e-10, -1.180370e-15, +1.000000e+05, +1.405626e+06, +2.222062e+06, +1.090702e+04, +3.931869e+03, +1.295050e+04 },
+    { +3.600000e+02, +1.033695e-03, +1.156220e+03, -5.252204e+04, +3.637173e+05, +3.638206e+05, -5.241867e+04, +3.836876e+03, +4.202341e+03, +9.674033e+02, -6.572392e-01, +4.546616e-07, -4.866218e-03, +9.884563e-10, -1.227505e-15, +1.000000e+05, +1.445557e+06, +2.199438e+06, +1.005917e+04, +3.802166e+03, +1.306047e+04 },
+    { +3.650000e+02, +1.037283e-03, +1.214216e+03, -5.844880e+04, +3.847400e+05, +3.848437e+05, -5.834507e+04, +3.810658e+03, +4.206985e+03, +9.640568e+02, -6.812739e-01, +4.599148e-07, -4.750929e-03, +1.112691e-09, -1.279436e-15, +1.000000e+05, +1.481305e+06, +2.174316e+06, +9.266672e+03, +3.699590e+03, +1.315184e+04 },
+    { +3.700000e+02, +1.041025e-03, +1.271489e+03, -6.466373e+04, +4.057872e+05, +4.058913e+05, -6.455963e+04, +3.784541e+03, +4.212146e+03, +9.605914e+02, -7.047796e-01, +4.657880e-07, -4.654324e-03, +1.236622e-09, -1.336469e-15, +1.000000e+05, +1.513091e+06, +2.146900e+06, +8.527169e+03, +3.620865e+03, +1.322495e+04 },
+    { +3.727560e+02, +1.043154e-03, +1.302759e+03, -6.821131e+04, +4.173999e+05, +4.175042e+05, -6.810699e+04, +3.770208e+03, +4.215223e+03, +9.586315e+02, -7.175426e-01, +4.692905e-07, -4.608519e-03, +1.305171e-09, -1.370218e-15, +1.000000e+05, +1.528995e+06, +2.130876e+06, +8.141326e+03, +3.586574e+03, +1.325758e+04 },
+    { +3.727560e+02, +1.043154e-03, +1.302759e+03, -6.821131e+04, +4.173999e+05, +4.175042e+05, -6.810699e+04, +3.770208e+03, +4.215223e+03, +9.586315e+02, -7.175426e-01, +4.692905e-07, -4.608519e-03, +1.305171e-09, -1.370218e-15, +1.000000e+05, +1.528995e+06, +2.130876e+06, +8.141326e+03, +3.586574e+03, +1.325758e+04 },
+    { +3.750000e+02, +1.704948e+00, +7.371294e+03, -2.551295e+05, +2.509106e+06, +2.679601e+06, -8.463467e+04, +1.547868e+03, +2.068593e+03, +5.865280e-01, -1.687105e-03, +5.958400e-06, +1.174333e-05, -1.859503e-08, +2.004542e-12, +1.000000e+05, +2.831472e+02, +1.678303e+05, -2.305615e-01, +5.077793e+02, -9.476025e+03 },
+    { +3.800000e+02, +1.729400e+00, +7.398569e+03, -2.944996e+05, +2.516957e+06, +2.689897e+06, -1.215596e+05, +1.535581e+03, +2.050686e+03, +5.782353e-01, -1.630745e-03, +5.867472e-06, +1.083711e-05, -1.779546e-08, +1.810958e-12, +1.000000e+05, +2.779297e+02, +1.704311e+05, -1.849568e-01, +5.022808e+02, -8.965100e+03 },
+    { +3.850000e+02, +1.753728e+00, +7.425281e+03, -3.339922e+05, +2.524741e+06, +2.700114e+06, -1.586194e+05, +1.526249e+03, +2.036634e+03, +5.702138e-01, -1.578450e-03, +5.780287e-06, +1.010284e-05, -1.709168e-08, +1.649763e-12, +1.000000e+05, +2.730747e+02, +1.730018e+05, -1.541878e-01, +4.980640e+02, -8.542269e+03 },
+    { +3.900000e+02, +1.777951e+00, +7.451485e+03, -3.736066e+05, +2.532472e+06, +2.710267e+06, -1.958115e+05, +1.518891e+03, +2.025205e+03, +5.624452e-01, -1.529536e-03, +5.696442e-06, +9.477866e-06, -1.645622e-08, +1.511219e-12, +1.000000e+05, +2.685072e+02, +1.755482e+05, -1.315893e-01, +4.946292e+02, -8.175537e+03 },
+    { +3.950000e+02, +1.802082e+00, +7.477222e+03, -4.133417e+05, +2.540161e+06, +2.720369e+06, -2.331335e+05, +1.512971e+03, +2.015717e+03, +5.549136e-01, -1.483544e-03, +5.615637e-06, +8.929886e-06, -1.587379e-08, +1.389859e-12, +1.000000e+05, +2.641809e+02, +1.780742e+05, -1.139287e-01, +4.917212e+02, -7.848267e+03 },
+    { +4.000000e+02, +1.826132e+00, +7.502525e+03, -4.531963e+05, +2.547814e+06, +2.730427e+06, -2.705830e+05, +1.508173e+03, +2.007758e+03, +5.476054e-01, -1.440139e-03, +5.537632e-06, +8.440681e-06, -1.533498e-08, +1.282294e-12, +1.000000e+05, +2.600641e+02, +1.805826e+05, -9.954615e-02, +4.892002e+02, -7.551190e+03 },
+    { +4.100000e+02, +1.874023e+00, +7.551942e+03, -5.332590e+05, +2.563037e+06, +2.750439e+06, -3.458566e+05, +1.501177e+03, +1.995417e+03, +5.336113e-01, -1.360084e-03, +5.389244e-06, +7.596833e-06, -1.436430e-08, +1.099902e-12, +1.000000e+05, +2.523702e+02, +1.855548e+05, -7.731047e-02, +4.850139e+02, -7.027010e+03 },
+    { +4.200000e+02, +1.921680e+00, +7.599916e+03, -6.137850e+05, +2.578180e+06, +2.770348e+06, -4.216171e+05, +1.496845e+03, +1.986756e+03, +5.203780e-01, -1.287748e-03, +5.249961e-06, +6.890161e-06, -1.350941e-08, +9.515388e-13, +1.000000e+05, +2.452871e+02, +1.904776e+05, -6.096073e-02, +4.816765e+02, -6.575946e+03 },
+    { +4.300000e+02, +1.969145e+00, +7.646592e+03, -6.947651e+05, +2.593269e+06, +2.790184e+06, -4.978506e+05, +1.494529e+03, +1.980887e+03, +5.078347e-01, -1.221934e-03, +5.118746e-06, +6.287840e-06, -1.274770e-08, +8.291821e-13, +1.000000e+05, +2.387175e+02, +1.953604e+05, -4.862408e-02, +4.789699e+02, -6.182431e+03 },
+    { +4.400000e+02, +2.016451e+00, +7.692086e+03, -7.761901e+05, +2.608328e+06, +2.809973e+06, -5.745450e+05, +1.493780e+03, +1.977190e+03, +4.959207e-01, -1.161718e-03, +4.994751e-06, +5.767655e-06, -1.206283e-08, +7.271609e-13, +1.000000e+05, +2.325877e+02, +2.002102e+05, -3.917294e-02, +4.767485e+02, -5.835646e+03 },
+    { +4.500000e+02, +2.063625e+00, +7.736494e+03, -8.580513e+05, +2.623371e+06, +2.829733e+06, -6.516887e+05, +1.494264e+03, +1.975204e+03, +4.845841e-01, -1.106361e-03, +4.877274e-06, +5.313558e-06, -1.144247e-08, +6.412906e-13, +1.000000e+05, +2.268401e+02, +2.050326e+05, -3.184855e-02, +4.749072e+02, -5.527432e+03 },
+    { +4.600000e+02, +2.110687e+00, +7.779897e+03, -9.403402e+05, +2.638413e+06, +2.849481e+06, -7.292715e+05, +1.495731e+03, +1.974584e+03, +4.737793e-01, -1.055267e-03, +4.765719e-06, +4.913555e-06, -1.087702e-08, +5.684105e-13, +1.000000e+05, +2.214286e+02, +2.098319e+05, -2.611521e-02, +4.733673e+02, -5.251420e+03 },
+    { +4.700000e+02, +2.157655e+00, +7.822367e+03, -1.023049e+06, +2.653463e+06, +2.869229e+06, -8.072836e+05, +1.497990e+03, +1.975063e+03, +4.634662e-01, -1.007941e-03, +4.659576e-06, +4.558477e-06, -1.035887e-08, +5.060935e-13, +1.000000e+05, +2.163160e+02, +2.146118e+05, -2.158571e-02, +4.720689e+02, -5.002550e+03 },
+    { +4.800000e+02, +2.204540e+00, +7.863961e+03, -1.106170e+06, +2.668531e+06, +2.888986e+06, -8.857159e+05, +1.500891e+03, +1.976437e+03, +4.536093e-01, -9.639714e-04, +4.558405e-06, +4.241183e-06, -9.881899e-09, +4.524510e-13, +1.000000e+05, +2.114712e+02, +2.193750e+05, -1.797613e-02, +4.709656e+02, -4.776755e+03 },
+    { +4.900000e+02, +2.251356e+00, +7.904735e+03, -1.189696e+06, +2.683624e+06, +2.908760e+06, -9.645600e+05, +1.504318e+03, +1.978544e+03, +4.441768e-01, -9.230101e-04, +4.461818e-06, +3.956022e-06, -9.441090e-09, +4.059955e-13, +1.000000e+05, +2.068686e+02, +2.241239e+05, -1.507593e-02, +4.700215e+02, -4.570731e+03 },
+    { +5.000000e+02, +2.298111e+00, +7.944733e+03, -1.273619e+06, +2.698747e+06, +2.928558e+06, -1.043808e+06, +1.508180e+03, +1.981258e+03, +4.351401e-01, -8.847590e-04, +4.369476e-06, +3.698454e-06, -9.032289e-09, +3.655429e-13, +1.000000e+05, +2.024863e+02, +2.288604e+05, -1.272749e-02, +4.692081e+02, -4.381776e+03 },
+    { +5.100000e+02, +2.344812e+00, +7.983998e+03, -1.357933e+06, +2.713906e+06, +2.948387e+06, -1.123452e+06, +1.512404e+03, +1.984477e+03, +4.264734e-01, -8.489614e-04, +4.281077e-06, +3.464788e-06, -8.652014e-09, +3.301412e-13, +1.000000e+05, +1.983056e+02, +2.335861e+05, -1.081172e-02, +4.685030e+02, -4.207659e+03 },
+    { +5.200000e+02, +2.391467e+00, +8.022567e+03, -1.442632e+06, +2.729103e+06, +2.968249e+06, -1.203486e+06, +1.516931e+03, +1.988120e+03, +4.181534e-01, -8.153938e-04, +4.196351e-06, +3.251981e-06, -8.297313e-09, +2.990181e-13, +1.000000e+05, +1.943102e+02, +2.383023e+05, -9.237921e-03, +4.678882e+02, -4.046525e+03 },
+    { +5.300000e+02, +2.438080e+00, +8.060475e+03, -1.527709e+06, +2.744342e+06, +2.988150e+06, -1.283901e+06, +1.521715e+03, +1.992123e+03, +4.101588e-01, -7.838607e-04, +4.115054e-06, +3.057502e-06, -7.965662e-09, +2.715419e-13, +1.000000e+05, +1.904861e+02, +2.430102e+05, -7.936412e-03, +4.673492e+02, -3.896819e+03 },
+    { +5.400000e+02, +2.484657e+00, +8.097752e+03, -1.613159e+06, +2.759627e+06, +3.008093e+06, -1.364693e+06, +1.526719e+03, +1.996432e+03, +4.024700e-01, -7.541898e-04, +4.036968e-06, +2.879223e-06, -7.654883e-09, +2.471916e-13, +1.000000e+05, +1.868209e+02, +2.477107e+05, -6.853275e-03, +4.668744e+02, -3.757230e+03 },
+    { +5.500000e+02, +2.531202e+00, +8.134426e+03, -1.698975e+06, +2.774960e+06, +3.028080e+06, -1.445854e+06, +1.531910e+03, +2.001004e+03, +3.950693e-01, -7.262283e-04, +3.961893e-06, +2.715337e-06, -7.363082e-09, +2.255346e-13, +1.000000e+05, +1.833034e+02, +2.524046e+05, -5.946466e-03, +4.664540e+02, -3.626644e+03 },
+    { +5.600000e+02, +2.577717e+00, +8.170524e+03, -1.785151e+06, +2.790342e+06, +3.048114e+06, -1.527380e+06, +1.537265e+03, +2.005804e+03, +3.879402e-01, -6.998403e-04, +3.889648e-06, +2.564300e-06, -7.088601e-09, +2.062096e-13, +1.000000e+05, +1.799238e+02, +2.570926e+05, -5.182969e-03, +4.660803e+02, -3.504110e+03 },
+    { +5.700000e+02, +2.624206e+00, +8.206070e+03, -1.871684e+06, +2.805776e+06, +3.068197e+06, -1.609263e+06, +1.542762e+03, +2.010803e+03, +3.810676e-01, -6.749039e-04, +3.820068e-06, +2.424783e-06, -6.829979e-09, +1.889124e-13, +1.000000e+05, +1.766733e+02, +2.617754e+05, -4.536680e-03, +4.657466e+02, -3.388810e+03 },
+    { +5.800000e+02, +2.670672e+00, +8.241086e+03, -1.958566e+06, +2.821263e+06, +3.088330e+06, -1.691499e+06, +1.548385e+03, +2.015976e+03, +3.744376e-01, -6.513101e-04, +3.753000e-06, +2.295634e-06, -6.585924e-09, +1.733861e-13, +1.000000e+05, +1.735438e+02, +2.664535e+05, -3.986822e-03, +4.654475e+02, -3.280036e+03 },
+    { +5.900000e+02, +2.717116e+00, +8.275593e+03, -2.045795e+06, +2.836805e+06, +3.108517e+06, -1.774083e+06, +1.554119e+03, +2.021303e+03, +3.680373e-01, -6.289601e-04, +3.688305e-06, +2.175846e-06, -6.355285e-09, +1.594121e-13, +1.000000e+05, +1.705282e+02, +2.711272e+05, -3.516754e-03, +4.651786e+02, -3.177173e+03 },
+    { +6.000000e+02, +2.763541e+00, +8.309611e+03, -2.133364e+06, +2.852403e+06, +3.128757e+06, -1.857009e+06, +1.559953e+03, +2.026767e+03, +3.618546e-01, -6.077649e-04, +3.625853e-06, +2.064539e-06, -6.137032e-09, +1.468036e-13, +1.000000e+05, +1.676198e+02, +2.757971e+05, -3.113068e-03, +4.649358e+02, -3.079683e+03 },
+    { +6.100000e+02, +2.809949e+00, +8.343157e+03, -2.221269e+06, +2.868057e+06, +3.149052e+06, -1.940274e+06, +1.565876e+03, +2.032354e+03, +3.558784e-01, -5.876436e-04, +3.565526e-06, +1.960937e-06, -5.930241e-09, +1.354004e-13, +1.000000e+05, +1.648126e+02, +2.804635e+05, -2.764895e-03, +4.647161e+02, -2.987096e+03 },
+    { +6.200000e+02, +2.856340e+00, +8.376251e+03, -2.309505e+06, +2.883770e+06, +3.169404e+06, -2.023871e+06, +1.571882e+03, +2.038053e+03, +3.500984e-01, -5.685227e-04, +3.507213e-06, +1.864353e-06, -5.734080e-09, +1.250644e-13, +1.000000e+05, +1.621010e+02, +2.851267e+05, -2.463375e-03, +4.645166e+02, -2.898993e+03 },
+    { +6.300000e+02, +2.902717e+00, +8.408906e+03, -2.398069e+06, +2.899542e+06, +3.189814e+06, -2.107797e+06, +1.577962e+03, +2.043852e+03, +3.445048e-01, -5.503352e-04, +3.450812e-06, +1.774178e-06, -5.547795e-09, +1.156760e-13, +1.000000e+05, +1.594799e+02, +2.897869e+05, -2.201248e-03, +4.643349e+02, -2.815008e+03 },
+    { +6.400000e+02, +2.949080e+00, +8.441140e+03, -2.486956e+06, +2.915374e+06, +3.210282e+06, -2.192048e+06, +1.584112e+03, +2.049744e+03, +3.390888e-01, -5.330196e-04, +3.396227e-06, +1.689867e-06, -5.370705e-09, +1.071316e-13, +1.000000e+05, +1.569447e+02, +2.944444e+05, -1.972534e-03, +4.641691e+02, -2.734812e+03 },
+    { +6.500000e+02, +2.995431e+00, +8.472966e+03, -2.576162e+06, +2.931266e+06, +3.230809e+06, -2.276619e+06, +1.590325e+03, +2.055721e+03, +3.338417e-01, -5.165199e-04, +3.343369e-06, +1.610935e-06, -5.202187e-09, +9.934045e-14, +1.000000e+05, +1.544908e+02, +2.990995e+05, -1.772281e-03, +4.640173e+02, -2.658111e+03 },
+    { +6.750000e+02, +3.111262e+00, +8.550834e+03, -2.800547e+06, +2.971266e+06, +3.282392e+06, -2.489421e+06, +1.606113e+03, +2.070993e+03, +3.214130e-01, -4.785116e-04, +3.218253e-06, +1.434377e-06, -4.814797e-09, +8.266314e-14, +1.000000e+05, +1.486868e+02, +3.107276e+05, -1.370776e-03, +4.636899e+02, -2.479999e+03 },
+    { +7.000000e+02, +3.227034e+00, +8.626434e+03, -3.026845e+06, +3.011659e+06, +3.334362e+06, -2.704142e+06, +1.622222e+03, +2.086679e+03, +3.098821e-01, -4.445907e-04, +3.102275e-06, +1.283101e-06, -4.469952e-09, +6.922946e-14, +1.000000e+05, +1.433112e+02, +3.223441e+05, -1.075057e-03, +4.634226e+02, -2.318729e+03 },
+    { +7.250000e+02, +3.342757e+00, +8.699937e+03, -3.255001e+06, +3.052453e+06, +3.386729e+06, -2.920725e+06, +1.638614e+03, +2.102718e+03, +2.991542e-01, -4.141833e-04, +2.994452e-06, +1.152646e-06, -4.161477e-09, +5.830902e-14, +1.000000e+05, +1.383169e+02, +3.339509e+05, -8.536032e-04, +4.632018e+02, -2.171619e+03 },
+    { +7.500000e+02, +3.458441e+00, +8.771497e+03, -3.484966e+06, +3.093656e+06, +3.439500e+06, -3.139122e+06, +1.655257e+03, +2.119065e+03, +2.891477e-01, -3.868145e-04, +2.893940e-06, +1.039485e-06, -3.884318e-09, +4.935843e-14, +1.000000e+05, +1.336636e+02, +3.455496e+05, -6.853045e-04, +4.630174e+02, -2.036538e+03 },
+    { +7.750000e+02, +3.574090e+00, +8.841251e+03, -3.716694e+06, +3.135275e+06, +3.492684e+06, -3.359285e+06, +1.672124e+03, +2.135680e+03, +2.797915e-01, -3.620885e-04, +2.800011e-06, +9.408047e-07, -3.634293e-09, +4.196773e-14, +1.000000e+05, +1.293168e+02, +3.571415e+05, -5.557107e-04, +4.628620e+02, -1.911774e+03 },
+    { +8.000000e+02, +3.689710e+00, +8.909321e+03, -3.950142e+06, +3.177315e+06, +3.546286e+06, -3.581171e+06, +1.689188e+03, +2.152529e+03, +2.710240e-01, -3.396727e-04, +2.712029e-06, +8.543310e-07, -3.407913e-09, +3.582385e-14, +1.000000e+05, +1.252467e+02, +3.687276e+05, -4.547367e-04, +4.627300e+02, -1.795930e+03 },
+    { +8.250000e+02, +3.805306e+00, +8.975819e+03, -4.185269e+06, +3.219782e+06, +3.600312e+06, -3.804738e+06, +1.706423e+03, +2.169581e+03, +2.627910e-01, -3.192858e-04, +2.629442e-06, +7.782132e-07, -3.202244e-09, +3.068500e-14, +1.000000e+05, +1.214272e+02, +3.803088e+05, -3.752189e-04, +4.626170e+02, -1.687855e+03 },
+    { +8.500000e+02, +3.920880e+00, +9.040843e+03, -4.422037e+06, +3.262679e+06, +3.654767e+06, -4.029949e+06, +1.723806e+03, +2.186803e+03, +2.550448e-01, -3.006885e-04, +2.551765e-06, +7.109318e-07, -3.014804e-09, +2.636255e-14, +1.000000e+05, +1.178355e+02, +3.918856e+05, -3.119879e-04, +4.625194e+02, -1.586593e+03 },
+    { +9.000000e+02, +4.151974e+00, +9.166821e+03, -4.900360e+06, +3.349779e+06, +3.764976e+06, -4.485163e+06, +1.758906e+03, +2.221643e+03, +2.408493e-01, -2.680725e-04, +2.409472e-06, +5.980633e-07, -2.686443e-09, +1.960348e-14, +1.000000e+05, +1.112578e+02, +4.150287e+05, -2.202289e-04, +4.623608e+02, -1.401417e+03 },
+    { +9.500000e+02, +4.383012e+00, +9.287880e+03, -5.384851e+06, +3.438636e+06, +3.876937e+06, -4.946550e+06, +1.794278e+03, +2.256814e+03, +2.281536e-01, -2.405038e-04, +2.282270e-06, +5.079673e-07, -2.409236e-09, +1.468536e-14, +1.000000e+05, +1.053792e+02, +4.381603e+05, -1.593460e-04, +4.622386e+02, -1.235332e+03 },
+    { +1.000000e+03, +4.614005e+00, +9.404537e+03, -5.875278e+06, +3.529259e+06, +3.990659e+06, -5.413877e+06, +1.829710e+03, +2.292089e+03, +2.167315e-01, -2.169886e-04, +2.167867e-06, +4.351520e-07, -2.173012e-09, +1.105033e-14, +1.000000e+05, +1.000931e+02, +4.612829e+05, -1.178305e-04, +4.621425e+02, -1.084620e+03 },
+    { +1.050000e+03, +4.844963e+00, +9.517220e+03, -6.371433e+06, +3.621647e+06, +4.106144e+06, -5.886937e+06, +1.865001e+03, +2.327253e+03, +2.063999e-01, -1.967673e-04, +2.064416e-06, +3.756498e-07, -1.970030e-09, +8.327407e-15, +1.000000e+05, +9.531380e+01, +4.843986e+05, -8.883531e-05, +4.620655e+02, -9.464950e+02 },
+    { +1.100000e+03, +5.075892e+00, +9.626290e+03, -6.873128e+06, +3.715790e+06, +4.223380e+06, -6.365539e+06, +1.899961e+03, +2.362111e+03, +1.970097e-01, -1.792508e-04, +1.970410e-06, +3.265427e-07, -1.794304e-09, +6.264148e-15, +1.000000e+05, +9.097130e+01, +5.075085e+05, -6.814915e-05, +4.620029e+02, -8.188267e+02 },
+    { +1.150000e+03, +5.306798e+00, +9.732050e+03, -7.380191e+06, +3.811667e+06, +4.342347e+06, -6.849511e+06, +1.934424e+03, +2.396490e+03, +1.884375e-01, -1.639764e-04, +1.884610e-06, +2.856505e-07, -1.641145e-09, +4.685293e-15, +1.000000e+05, +8.700815e+01, +5.306138e+05, -5.310653e-05, +4.619512e+02, -6.999588e+02 },
+    { +1.200000e+03, +5.537685e+00, +9.834759e+03, -7.892462e+06, +3.909250e+06, +4.463018e+06, -7.338693e+06, +1.968245e+03, +2.430241e+03, +1.805809e-01, -1.505766e-04, +1.805982e-06, +2.513212e-07, -1.506835e-09, +3.466961e-15, +1.000000e+05, +8.337655e+01, +5.537154e+05, -4.197722e-05, +4.619081e+02, -5.885843e+02 },
+    { +1.250000e+03, +5.768556e+00, +9.934638e+03, -8.409795e+06, +4.008503e+06, +4.585358e+06, -7.832940e+06, +2.001302e+03, +2.463241e+03, +1.733536e-01, -1.387562e-04, +1.733662e-06, +2.222867e-07, -1.388396e-09, +2.520179e-15, +1.000000e+05, +8.003647e+01, +5.768137e+05, -3.361262e-05, +4.618717e+02, -4.836577e+02 },
+    { +1.273000e+03, +5.874752e+00, +9.979686e+03, -8.649431e+06, +4.054709e+06, +4.642185e+06, -8.061955e+06, +2.016226e+03, +2.478141e+03, +1.702199e-01, -1.337816e-04, +1.702307e-06, +2.104294e-07, -1.338561e-09, +2.157300e-15, +1.000000e+05, +7.858841e+01, +5.874380e+05, -3.046899e-05, +4.618568e+02, -4.373174e+02 },
+    // P = 0.101325 MPa
+    { +2.731530e+02, +1.000157e-03, -1.013024e-01, +2.216303e-03, -2.766885e+01, +7.367204e+01, +1.013431e+02, +4.216973e+03, +4.219434e+03, +9.998433e+02, +6.769416e-02, +5.087577e-07, -1.820140e-02, -3.815343e-09, -1.192032e-15, +1.013250e+05, -1.330577e+05, +1.965572e+06, +3.382196e+04, +1.412769e+04, +9.052213e+03 },
+    { +2.750000e+02, +1.000062e-03, +2.831302e+01, -2.607737e+01, +7.760003e+03, +7.861334e+03, +7.525392e+01, +4.212797e+03, +4.213473e+03, +9.999379e+02, +3.512583e-02, +5.019954e-07, -1.708635e-02, -3.512051e-09, -1.154359e-15, +1.013250e+05, -6.997241e+04, +1.992050e+06, +3.306904e+04, +1.361621e+04, +9.125185e+03 },
+    { +2.800000e+02, +1.000089e-03, +1.041139e+02, -3.578103e+02, +2.879407e+04, +2.889541e+04, -2.564763e+02, +4.199832e+03, +4.200939e+03, +9.999110e+02, -4.384595e-02, +4.862376e-07, -1.462180e-02, -2.818881e-09, -1.075663e-15, +1.013250e+05, +9.017392e+04, +2.056608e+06, +3.113484e+04, +1.233310e+04, +9.356873e+03 },
+    { +2.850000e+02, +1.000483e-03, +1.783882e+02, -1.064716e+03, +4.977592e+04, +4.987729e+04, -9.633423e+02, +4.184798e+03, +4.192365e+03, +9.995173e+02, -1.120793e-01, +4.735738e-07, -1.275319e-02, -2.266172e-09, -1.022333e-15, +1.013250e+05, +2.366671e+05, +2.111603e+06, +2.931561e+04, +1.118340e+04, +9.625635e+03 },
+    { +2.900000e+02, +1.001198e-03, +2.512473e+02, -2.139447e+03, +7.072227e+04, +7.082372e+04, -2.038001e+03, +4.168028e+03, +4.186600e+03, +9.988039e+02, -1.720649e-01, +4.634095e-07, -1.129893e-02, -1.813768e-09, -9.868909e-16, +1.013250e+05, +3.713022e+05, +2.157919e+06, +2.758230e+04, +1.015236e+04, +9.916866e+03 },
+    { +2.950000e+02, +1.002197e-03, +3.227806e+02, -3.575154e+03, +9.164512e+04, +9.174667e+04, -3.473606e+03, +4.149760e+03, +4.182870e+03, +9.978074e+02, -2.255633e-01, +4.553132e-07, -1.014274e-02, -1.435368e-09, -9.645616e-16, +1.013250e+05, +4.954025e+05, +2.196290e+06, +2.591983e+04, +9.228755e+03, +1.021878e+04 },
+    { +3.000000e+02, +1.003455e-03, +3.930621e+02, -5.365396e+03, +1.125532e+05, +1.126549e+05, -5.263721e+03, +4.130174e+03, +4.180636e+03, +9.965569e+02, -2.738589e-01, +4.489626e-07, -9.207224e-03, -1.113037e-09, -9.522374e-16, +1.013250e+05, +6.099814e+05, +2.227357e+06, +2.432139e+04, +8.403561e+03, +1.052240e+04 },
+    { +3.050000e+02, +1.004948e-03, +4.621545e+02, -7.504072e+03, +1.334531e+05, +1.335549e+05, -7.402246e+03, +4.109417e+03, +4.179516e+03, +9.950759e+02, -3.179137e-01, +4.441108e-07, -8.439094e-03, -8.340790e-10, -9.478596e-16, +1.013250e+05, +7.158433e+05, +2.251691e+06, +2.278474e+04, +7.669038e+03, +1.082107e+04 },
+    { +3.100000e+02, +1.006660e-03, +5.301124e+02, -9.985375e+03, +1.543495e+05, +1.544515e+05, -9.883375e+03, +4.087617e+03, +4.179242e+03, +9.933836e+02, -3.584653e-01, +4.405651e-07, -7.800631e-03, -5.892098e-10, -9.500445e-16, +1.013250e+05, +8.136489e+05, +2.269812e+06, +2.130991e+04, +7.018181e+03, +1.110999e+04 },
+    { +3.150000e+02, +1.008577e-03, +5.969839e+02, -1.280375e+04, +1.752462e+05, +1.753484e+05, -1.270156e+04, +4.064895e+03, +4.179623e+03, +9.914961e+02, -3.960902e-01, +4.381736e-07, -7.264475e-03, -3.714429e-10, -9.578546e-16, +1.013250e+05, +9.039572e+05, +2.282201e+06, +1.989785e+04, +6.444415e+03, +1.138573e+04 },
+    { +3.200000e+02, +1.010686e-03, +6.628127e+02, -1.595388e+04, +1.961462e+05, +1.962486e+05, -1.585148e+04, +4.041368e+03, +4.180535e+03, +9.894268e+02, -4.312466e-01, +4.368146e-07, -6.810375e-03, -1.753895e-10, -9.706561e-16, +1.013250e+05, +9.872532e+05, +2.289301e+06, +1.854963e+04, +5.941464e+03, +1.164593e+04 },
+    { +3.250000e+02, +1.012979e-03, +7.276384e+02, -1.943065e+04, +2.170518e+05, +2.171545e+05, -1.932801e+04, +4.017147e+03, +4.181894e+03, +9.871872e+02, -4.643051e-01, +4.363906e-07, -6.423084e-03, +3.197723e-12, -9.880283e-16, +1.013250e+05, +1.063967e+06, +2.291525e+06, +1.726607e+04, +5.503304e+03, +1.188894e+04 },
+    { +3.300000e+02, +1.015448e-03, +7.914983e+02, -2.322914e+04, +2.379653e+05, +2.380682e+05, -2.312625e+04, +3.992344e+03, +4.183652e+03, +9.847868e+02, -4.955692e-01, +4.368232e-07, -6.090952e-03, +1.677306e-10, -1.009705e-15, +1.013250e+05, +1.134485e+06, +2.289256e+06, +1.604751e+04, +5.124163e+03, +1.211372e+04 },
+    { +3.350000e+02, +1.018087e-03, +8.544271e+02, -2.734460e+04, +2.588885e+05, +2.589916e+05, -2.724145e+04, +3.967064e+03, +4.185786e+03, +9.822340e+02, -5.252914e-01, +4.380492e-07, -5.804969e-03, +3.209981e-10, -1.035538e-15, +1.013250e+05, +1.199161e+06, +2.282849e+06, +1.489376e+04, +4.798541e+03, +1.231962e+04 },
+    { +3.400000e+02, +1.020891e-03, +9.164579e+02, -3.177247e+04, +2.798232e+05, +2.799267e+05, -3.166903e+04, +3.941410e+03, +4.188293e+03, +9.795361e+02, -5.536840e-01, +4.400183e-07, -5.558089e-03, +4.653180e-10, -1.065469e-15, +1.013250e+05, +1.258320e+06, +2.272633e+06, +1.380416e+04, +4.521233e+03, +1.250629e+04 },
+    { +3.450000e+02, +1.023857e-03, +9.776225e+02, -3.650832e+04, +3.007714e+05, +3.008752e+05, -3.640458e+04, +3.915478e+03, +4.191181e+03, +9.766991e+02, -5.809281e-01, +4.426907e-07, -5.344760e-03, +6.026467e-10, -1.099517e-15, +1.013250e+05, +1.312266e+06, +2.258913e+06, +1.277757e+04, +4.287345e+03, +1.267362e+04 },
+    { +3.500000e+02, +1.026980e-03, +1.037951e+03, -4.154792e+04, +3.217351e+05, +3.218391e+05, -4.144386e+04, +3.889357e+03, +4.194467e+03, +9.737284e+02, -6.071801e-01, +4.460359e-07, -5.160566e-03, +7.346626e-10, -1.137766e-15, +1.013250e+05, +1.361281e+06, +2.241972e+06, +1.181246e+04, +4.092311e+03, +1.282164e+04 },
+    { +3.550000e+02, +1.030260e-03, +1.097474e+03, -4.688714e+04, +3.427162e+05, +3.428206e+05, -4.678275e+04, +3.863130e+03, +4.198177e+03, +9.706287e+02, -6.325764e-01, +4.500309e-07, -5.001984e-03, +8.628289e-10, -1.180359e-15, +1.013250e+05, +1.405629e+06, +2.222069e+06, +1.090702e+04, +3.931895e+03, +1.295052e+04 },
+    { +3.600000e+02, +1.033694e-03, +1.156219e+03, -5.252204e+04, +3.637169e+05, +3.638217e+05, -5.241730e+04, +3.836873e+03, +4.202338e+03, +9.674039e+02, -6.572379e-01, +4.546599e-07, -4.866185e-03, +9.884431e-10, -1.227494e-15, +1.013250e+05, +1.445559e+06, +2.199446e+06, +1.005917e+04, +3.802190e+03, +1.306049e+04 },
+    { +3.650000e+02, +1.037283e-03, +1.214215e+03, -5.844880e+04, +3.847396e+05, +3.848448e+05, -5.834370e+04, +3.810656e+03, +4.206982e+03, +9.640574e+02, -6.812724e-01, +4.599131e-07, -4.750896e-03, +1.112676e-09, -1.279423e-15, +1.013250e+05, +1.481307e+06, +2.174324e+06, +9.266676e+03, +3.699612e+03, +1.315185e+04 },
+    { +3.700000e+02, +1.041025e-03, +1.271488e+03, -6.466373e+04, +4.057869e+05, +4.058923e+05, -6.455825e+04, +3.784539e+03, +4.212143e+03, +9.605921e+02, -7.047780e-01, +4.657862e-07, -4.654291e-03, +1.236606e-09, -1.336455e-15, +1.013250e+05, +1.513093e+06, +2.146908e+06, +8.527175e+03, +3.620886e+03, +1.322497e+04 },
+    { +3.731240e+02, +1.043441e-03, +1.306917e+03, -6.869151e+04, +4.189508e+05, +4.190565e+05, -6.858579e+04, +3.768296e+03, +4.215644e+03, +9.583677e+02, -7.192358e-01, +4.697707e-07, -4.602754e-03, +1.314333e-09, -1.374839e-15, +1.013250e+05, +1.531036e+06, +2.128698e+06, +8.090953e+03, +3.582469e+03, +1.326155e+04 },
+    { +3.731240e+02, +1.043441e-03, +1.306917e+03, -6.869151e+04, +4.189508e+05, +4.190565e+05, -6.858579e+04, +3.768296e+03, +4.215644e+03, +9.583677e+02, -7.192358e-01, +4.697707e-07, -4.602754e-03, +1.314333e-09, -1.374839e-15, +1.013250e+05, +1.531036e+06, +2.128698e+06, +8.090953e+03, +3.582469e+03, +1.326155e+04 },
+    { +3.750000e+02, +1.682299e+00, +7.364836e+03, -2.528496e+05, +2.508964e+06, +2.679423e+06, -8.239068e+04, +1.549864e+03, +2.071551e+03, +5.944247e-01, -1.711781e-03, +5.961061e-06, +1.197356e-05, -1.865239e-08, +2.012048e-12, +1.013250e+05, +2.871604e+02, +1.677554e+05, -2.393913e-01, +5.086531e+02, -9.498776e+03 },
+    { +3.800000e+02, +1.706452e+00, +7.392147e+03, -2.921896e+05, +2.516826e+06, +2.689732e+06, -1.192834e+05, +1.537222e+03, +2.053163e+03, +5.860113e-01, -1.654355e-03, +5.869875e-06, +1.103581e-05, -1.784211e-08, +1.816198e-12, +1.013250e+05, +2.818381e+02, +1.703614e+05, -1.912987e-01, +5.029755e+02, -8.980007e+03 },
+    { +3.850000e+02, +1.730481e+00, +7.418889e+03, -3.316521e+05, +2.524620e+06, +2.699961e+06, -1.563112e+05, +1.527651e+03, +2.038779e+03, +5.778742e-01, -1.601123e-03, +5.782476e-06, +1.028021e-05, -1.713122e-08, +1.653700e-12, +1.013250e+05, +2.768923e+02, +1.729363e+05, -1.591004e-01, +4.986486e+02, -8.552938e+03 },
+    { +3.900000e+02, +1.754404e+00, +7.445118e+03, -3.712364e+05, +2.532360e+06, +2.710125e+06, -1.934714e+05, +1.520118e+03, +2.027101e+03, +5.699943e-01, -1.551363e-03, +5.698447e-06, +9.639328e-06, -1.649056e-08, +1.514333e-12, +1.013250e+05, +2.722432e+02, +1.754864e+05, -1.355946e-01, +4.951389e+02, -8.183741e+03 },
+    { +3.950000e+02, +1.778234e+00, +7.470878e+03, -4.109412e+05, +2.540056e+06, +2.720235e+06, -2.307616e+05, +1.514060e+03, +2.017415e+03, +5.623555e-01, -1.504597e-03, +5.617480e-06, +9.078600e-06, -1.590406e-08, +1.392405e-12, +1.013250e+05, +2.678420e+02, +1.780158e+05, -1.173015e-01, +4.921751e+02, -7.854907e+03 },
+    { +4.000000e+02, +1.801984e+00, +7.496202e+03, -4.507655e+05, +2.547715e+06, +2.730301e+06, -2.681795e+05, +1.509148e+03, +2.009290e+03, +5.549439e-01, -1.460476e-03, +5.539332e-06, +8.578698e-06, -1.536193e-08, +1.284420e-12, +1.013250e+05, +2.636556e+02, +1.805272e+05, -1.024431e-01, +4.896097e+02, -7.556748e+03 },
+    { +4.100000e+02, +1.849273e+00, +7.545653e+03, -5.307676e+05, +2.562950e+06, +2.750328e+06, -3.433900e+05, +1.501973e+03, +1.996684e+03, +5.407530e-01, -1.379131e-03, +5.390702e-06, +7.717479e-06, -1.438603e-08, +1.101440e-12, +1.013250e+05, +2.558352e+02, +1.855046e+05, -7.951908e-02, +4.853546e+02, -7.031128e+03 },
+    { +4.200000e+02, +1.896327e+00, +7.593655e+03, -6.112331e+05, +2.578102e+06, +2.770247e+06, -4.190877e+05, +1.497503e+03, +1.987818e+03, +5.273351e-01, -1.305660e-03, +5.251222e-06, +6.997072e-06, -1.352722e-08, +9.526822e-13, +1.013250e+05, +2.486392e+02, +1.904318e+05, -6.268510e-02, +4.819650e+02, -6.579105e+03 },
+    { +4.300000e+02, +1.943190e+00, +7.640354e+03, -6.921525e+05, +2.593200e+06, +2.790093e+06, -4.952588e+05, +1.495080e+03, +1.981788e+03, +5.146177e-01, -1.238835e-03, +5.119845e-06, +6.383544e-06, -1.276247e-08, +8.300463e-13, +1.013250e+05, +2.419673e+02, +1.953184e+05, -4.999005e-02, +4.792171e+02, -6.184889e+03 },
+    { +4.400000e+02, +1.989894e+00, +7.685867e+03, -7.735168e+05, +2.608265e+06, +2.809891e+06, -5.718908e+05, +1.494244e+03, +1.977960e+03, +5.025394e-01, -1.177709e-03, +4.995715e-06, +5.854029e-06, -1.207521e-08, +7.278224e-13, +1.013250e+05, +2.357439e+02, +2.001715e+05, -4.026726e-02, +4.769624e+02, -5.837574e+03 },
+    { +4.500000e+02, +2.036465e+00, +7.730291e+03, -8.553173e+05, +2.623314e+06, +2.829658e+06, -6.489725e+05, +1.494658e+03, +1.975869e+03, +4.910471e-01, -1.121530e-03, +4.878124e-06, +5.392044e-06, -1.145294e-08, +6.418025e-13, +1.013250e+05, +2.299100e+02, +2.049968e+05, -3.273394e-02, +4.750938e+02, -5.528952e+03 },
+    { +4.600000e+02, +2.082924e+00, +7.773708e+03, -9.375456e+05, +2.638360e+06, +2.849413e+06, -7.264933e+05, +1.496069e+03, +1.975161e+03, +4.800944e-01, -1.069685e-03, +4.766472e-06, +4.985286e-06, -1.088593e-08, +5.688104e-13, +1.013250e+05, +2.244185e+02, +2.097988e+05, -2.683808e-02, +4.735314e+02, -5.252623e+03 },
+    { +4.700000e+02, +2.129288e+00, +7.816189e+03, -1.020194e+06, +2.653415e+06, +2.869165e+06, -8.044435e+05, +1.498281e+03, +1.975569e+03, +4.696406e-01, -1.021671e-03, +4.660247e-06, +4.624358e-06, -1.036652e-08, +5.064089e-13, +1.013250e+05, +2.192311e+02, +2.145809e+05, -2.218089e-02, +4.722142e+02, -5.003506e+03 },
+    { +4.800000e+02, +2.175570e+00, +7.857794e+03, -1.103254e+06, +2.668487e+06, +2.888927e+06, -8.828142e+05, +1.501144e+03, +1.976883e+03, +4.596496e-01, -9.770693e-04, +4.559004e-06, +4.301949e-06, -9.888506e-09, +4.527017e-13, +1.013250e+05, +2.143164e+02, +2.193461e+05, -1.847006e-02, +4.710951e+02, -4.777517e+03 },
+    { +4.900000e+02, +2.221783e+00, +7.898576e+03, -1.186719e+06, +2.683583e+06, +2.908705e+06, -9.615967e+05, +1.504540e+03, +1.978939e+03, +4.500890e-01, -9.355233e-04, +4.462356e-06, +4.012278e-06, -9.446827e-09, +4.061964e-13, +1.013250e+05, +2.096478e+02, +2.240969e+05, -1.548888e-02, +4.701375e+02, -4.571340e+03 },
+    { +5.000000e+02, +2.267934e+00, +7.938582e+03, -1.270582e+06, +2.698709e+06, +2.928508e+06, -1.040783e+06, +1.508375e+03, +1.981610e+03, +4.409300e-01, -8.967301e-04, +4.369961e-06, +3.750704e-06, -9.037298e-09, +3.657051e-13, +1.013250e+05, +2.052033e+02, +2.288350e+05, -1.307514e-02, +4.693126e+02, -4.382263e+03 },
+    { +5.100000e+02, +2.314032e+00, +7.977853e+03, -1.354835e+06, +2.713870e+06, +2.948339e+06, -1.120366e+06, +1.512576e+03, +1.984792e+03, +4.321461e-01, -8.604282e-04, +4.281515e-06, +3.513457e-06, -8.656407e-09, +3.302731e-13, +1.013250e+05, +2.009635e+02, +2.335622e+05, -1.110631e-02, +4.685976e+02, -4.208050e+03 },
+    { +5.200000e+02, +2.360083e+00, +8.016429e+03, -1.439473e+06, +2.729070e+06, +2.968205e+06, -1.200338e+06, +1.517084e+03, +1.988404e+03, +4.237138e-01, -8.263903e-04, +4.196747e-06, +3.297432e-06, -8.301184e-09, +2.991260e-13, +1.013250e+05, +1.969121e+02, +2.382798e+05, -9.489067e-03, +4.679742e+02, -4.046839e+03 },
+    { +5.300000e+02, +2.406093e+00, +8.054341e+03, -1.524490e+06, +2.744311e+06, +2.988109e+06, -1.280692e+06, +1.521852e+03, +1.992379e+03, +4.156114e-01, -7.944175e-04, +4.115414e-06, +3.100046e-06, -7.969086e-09, +2.716307e-13, +1.013250e+05, +1.930347e+02, +2.429889e+05, -8.151746e-03, +4.674278e+02, -3.897071e+03 },
+    { +5.400000e+02, +2.452067e+00, +8.091623e+03, -1.609878e+06, +2.759598e+06, +3.008054e+06, -1.361423e+06, +1.526841e+03, +1.996665e+03, +4.078192e-01, -7.643345e-04, +4.037295e-06, +2.919128e-06, -7.657923e-09, +2.472650e-13, +1.013250e+05, +1.893185e+02, +2.476906e+05, -7.038891e-03, +4.669464e+02, -3.757432e+03 },
+    { +5.500000e+02, +2.498008e+00, +8.128301e+03, -1.695633e+06, +2.774932e+06, +3.028043e+06, -1.442523e+06, +1.532020e+03, +2.001216e+03, +4.003190e-01, -7.359862e-04, +3.962192e-06, +2.752839e-06, -7.365790e-09, +2.255957e-13, +1.013250e+05, +1.857523e+02, +2.523855e+05, -6.107267e-03, +4.665203e+02, -3.626806e+03 },
+    { +5.600000e+02, +2.543920e+00, +8.164403e+03, -1.781749e+06, +2.790316e+06, +3.048079e+06, -1.523987e+06, +1.537364e+03, +2.005998e+03, +3.930942e-01, -7.092343e-04, +3.889922e-06, +2.599606e-06, -7.091021e-09, +2.062607e-13, +1.013250e+05, +1.823261e+02, +2.570746e+05, -5.322927e-03, +4.661414e+02, -3.504240e+03 },
+    { +5.700000e+02, +2.589805e+00, +8.199952e+03, -1.868221e+06, +2.805751e+06, +3.068163e+06, -1.605809e+06, +1.542852e+03, +2.010980e+03, +3.861294e-01, -6.839551e-04, +3.820319e-06, +2.458074e-06, -6.832149e-09, +1.889554e-13, +1.013250e+05, +1.790309e+02, +2.617583e+05, -4.659032e-03, +4.658032e+02, -3.388914e+03 },
+    { +5.800000e+02, +2.635668e+00, +8.234970e+03, -1.955043e+06, +2.821240e+06, +3.088299e+06, -1.687984e+06, +1.548467e+03, +2.016139e+03, +3.794105e-01, -6.600377e-04, +3.753230e-06, +2.327072e-06, -6.587875e-09, +1.734224e-13, +1.013250e+05, +1.758586e+02, +2.664372e+05, -4.094224e-03, +4.655001e+02, -3.280118e+03 },
+    { +5.900000e+02, +2.681508e+00, +8.269480e+03, -2.042210e+06, +2.836783e+06, +3.108487e+06, -1.770507e+06, +1.554194e+03, +2.021453e+03, +3.729244e-01, -6.373820e-04, +3.688516e-06, +2.205576e-06, -6.357042e-09, +1.594428e-13, +1.013250e+05, +1.728017e+02, +2.711117e+05, -3.611399e-03, +4.652275e+02, -3.177238e+03 },
+    { +6.000000e+02, +2.727330e+00, +8.303501e+03, -2.129719e+06, +2.852382e+06, +3.128728e+06, -1.853372e+06, +1.560021e+03, +2.026906e+03, +3.666590e-01, -6.158975e-04, +3.626048e-06, +2.092690e-06, -6.138620e-09, +1.468297e-13, +1.013250e+05, +1.698537e+02, +2.757823e+05, -3.196775e-03, +4.649814e+02, -3.079735e+03 },
+    { +6.100000e+02, +2.773134e+00, +8.337050e+03, -2.217563e+06, +2.868038e+06, +3.149025e+06, -1.936575e+06, +1.565939e+03, +2.032483e+03, +3.606028e-01, -5.955021e-04, +3.565706e-06, +1.987625e-06, -5.931679e-09, +1.354227e-13, +1.013250e+05, +1.670082e+02, +2.804494e+05, -2.839181e-03, +4.647587e+02, -2.987135e+03 },
+    { +6.200000e+02, +2.818922e+00, +8.370145e+03, -2.305739e+06, +2.883751e+06, +3.169379e+06, -2.020111e+06, +1.571940e+03, +2.038173e+03, +3.547455e-01, -5.761213e-04, +3.507379e-06, +1.889683e-06, -5.735384e-09, +1.250834e-13, +1.013250e+05, +1.642598e+02, +2.851132e+05, -2.529513e-03, +4.645565e+02, -2.899024e+03 },
+    { +6.300000e+02, +2.864695e+00, +8.402803e+03, -2.394242e+06, +2.899524e+06, +3.189789e+06, -2.103976e+06, +1.578016e+03, +2.043964e+03, +3.490773e-01, -5.576868e-04, +3.450965e-06, +1.798245e-06, -5.548981e-09, +1.156924e-13, +1.013250e+05, +1.616031e+02, +2.897740e+05, -2.260311e-03, +4.643724e+02, -2.815031e+03 },
+    { +6.400000e+02, +2.910455e+00, +8.435038e+03, -2.483068e+06, +2.915356e+06, +3.210258e+06, -2.188166e+06, +1.584161e+03, +2.049848e+03, +3.435889e-01, -5.401365e-04, +3.396369e-06, +1.712757e-06, -5.371785e-09, +1.071456e-13, +1.013250e+05, +1.590335e+02, +2.944321e+05, -2.025430e-03, +4.642043e+02, -2.734828e+03 },
+    { +6.500000e+02, +2.956203e+00, +8.466865e+03, -2.572213e+06, +2.931249e+06, +3.230786e+06, -2.272676e+06, +1.590371e+03, +2.055818e+03, +3.382718e-01, -5.234135e-04, +3.343501e-06, +1.632727e-06, -5.203173e-09, +9.935262e-14, +1.013250e+05, +1.565465e+02, +2.990877e+05, -1.819783e-03, +4.640505e+02, -2.658123e+03 },
+    { +6.750000e+02, +3.070524e+00, +8.544737e+03, -2.796447e+06, +2.971251e+06, +3.282372e+06, -2.485326e+06, +1.606151e+03, +2.071076e+03, +3.256773e-01, -4.848917e-04, +3.218362e-06, +1.453726e-06, -4.815588e-09, +8.267168e-14, +1.013250e+05, +1.506641e+02, +3.107170e+05, -1.407478e-03, +4.637188e+02, -2.480002e+03 },
+    { +7.000000e+02, +3.184787e+00, +8.620339e+03, -3.022592e+06, +3.011645e+06, +3.334344e+06, -2.699894e+06, +1.622254e+03, +2.086750e+03, +3.139927e-01, -4.505138e-04, +3.102367e-06, +1.300369e-06, -4.470592e-09, +6.923553e-14, +1.013250e+05, +1.452162e+02, +3.223345e+05, -1.103819e-03, +4.634479e+02, -2.318727e+03 },
+    { +7.250000e+02, +3.299002e+00, +8.693845e+03, -3.250597e+06, +3.052441e+06, +3.386712e+06, -2.916325e+06, +1.638642e+03, +2.102780e+03, +3.031219e-01, -4.196976e-04, +2.994530e-06, +1.168127e-06, -4.162000e-09, +5.831340e-14, +1.013250e+05, +1.401548e+02, +3.339423e+05, -8.764265e-04, +4.632241e+02, -2.171614e+03 },
+    { +7.500000e+02, +3.413177e+00, +8.765407e+03, -3.480410e+06, +3.093645e+06, +3.439485e+06, -3.134570e+06, +1.655281e+03, +2.119119e+03, +2.929822e-01, -3.919615e-04, +2.894006e-06, +1.053424e-06, -3.884748e-09, +4.936161e-14, +1.013250e+05, +1.354391e+02, +3.455418e+05, -7.036191e-04, +4.630373e+02, -2.036531e+03 },
+    { +7.750000e+02, +3.527317e+00, +8.835162e+03, -3.711986e+06, +3.135265e+06, +3.492670e+06, -3.354581e+06, +1.672144e+03, +2.135728e+03, +2.835016e-01, -3.669042e-04, +2.800066e-06, +9.534030e-07, -3.634649e-09, +4.197007e-14, +1.013250e+05, +1.310341e+02, +3.571344e+05, -5.705565e-04, +4.628799e+02, -1.911767e+03 },
+    { +8.000000e+02, +3.641429e+00, +8.903234e+03, -3.945282e+06, +3.177306e+06, +3.546274e+06, -3.576314e+06, +1.689205e+03, +2.152571e+03, +2.746175e-01, -3.441884e-04, +2.712076e-06, +8.657579e-07, -3.408210e-09, +3.582558e-14, +1.013250e+05, +1.269095e+02, +3.687212e+05, -4.668814e-04, +4.627461e+02, -1.795922e+03 },
+    { +8.250000e+02, +3.755516e+00, +8.969733e+03, -4.180257e+06, +3.219773e+06, +3.600301e+06, -3.799729e+06, +1.706439e+03, +2.169618e+03, +2.662750e-01, -3.235289e-04, +2.629483e-06, +7.886115e-07, -3.202494e-09, +3.068629e-14, +1.013250e+05, +1.230390e+02, +3.803029e+05, -3.852376e-04, +4.626315e+02, -1.687848e+03 },
+    { +8.500000e+02, +3.869581e+00, +9.034758e+03, -4.416874e+06, +3.262671e+06, +3.654756e+06, -4.024788e+06, +1.723820e+03, +2.186837e+03, +2.584259e-01, -3.046832e-04, +2.551800e-06, +7.204229e-07, -3.015014e-09, +2.636352e-14, +1.013250e+05, +1.193993e+02, +3.918803e+05, -3.203167e-04, +4.625327e+02, -1.586586e+03 },
+    { +9.000000e+02, +4.097658e+00, +9.160738e+03, -4.894893e+06, +3.349771e+06, +3.764967e+06, -4.479697e+06, +1.758917e+03, +2.221670e+03, +2.440418e-01, -2.716322e-04, +2.409498e-06, +6.060363e-07, -2.686595e-09, +1.960403e-14, +1.013250e+05, +1.127339e+02, +4.150242e+05, -2.261065e-04, +4.623720e+02, -1.401411e+03 },
+    { +9.500000e+02, +4.325678e+00, +9.281799e+03, -5.379080e+06, +3.438629e+06, +3.876928e+06, -4.940780e+06, +1.794287e+03, +2.256836e+03, +2.311776e-01, -2.436961e-04, +2.282289e-06, +5.147319e-07, -2.409347e-09, +1.468568e-14, +1.013250e+05, +1.067770e+02, +4.381565e+05, -1.635980e-04, +4.622482e+02, -1.235327e+03 },
+    { +1.000000e+03, +4.553653e+00, +9.398456e+03, -5.869203e+06, +3.529253e+06, +3.990652e+06, -5.407804e+06, +1.829718e+03, +2.292107e+03, +2.196039e-01, -2.198679e-04, +2.167881e-06, +4.409420e-07, -2.173095e-09, +1.105052e-14, +1.013250e+05, +1.014206e+02, +4.612798e+05, -1.209743e-04, +4.621507e+02, -1.084616e+03 },
+    { +1.050000e+03, +4.781594e+00, +9.511140e+03, -6.365055e+06, +3.621642e+06, +4.106137e+06, -5.880560e+06, +1.865007e+03, +2.327268e+03, +2.091353e-01, -1.993776e-04, +2.064427e-06, +3.806447e-07, -1.970092e-09, +8.327510e-15, +1.013250e+05, +9.657772e+01, +4.843960e+05, -9.120527e-05, +4.620727e+02, -9.464916e+02 },
+    { +1.100000e+03, +5.009505e+00, +9.620211e+03, -6.866446e+06, +3.715786e+06, +4.223374e+06, -6.358858e+06, +1.899966e+03, +2.362124e+03, +1.996205e-01, -1.816283e-04, +1.970419e-06, +3.308823e-07, -1.794351e-09, +6.264204e-15, +1.013250e+05, +9.217750e+01, +5.075064e+05, -6.996713e-05, +4.620093e+02, -8.188237e+02 },
+    { +1.150000e+03, +5.237394e+00, +9.725972e+03, -7.373204e+06, +3.811663e+06, +4.342342e+06, -6.842526e+06, +1.934428e+03, +2.396502e+03, +1.909347e-01, -1.661509e-04, +1.884616e-06, +2.894450e-07, -1.641181e-09, +4.685322e-15, +1.013250e+05, +8.816170e+01, +5.306121e+05, -5.452317e-05, +4.619570e+02, -6.999562e+02 },
+    { +1.200000e+03, +5.465263e+00, +9.828681e+03, -7.885172e+06, +3.909246e+06, +4.463014e+06, -7.331404e+06, +1.968248e+03, +2.430251e+03, +1.829738e-01, -1.525731e-04, +1.805987e-06, +2.546584e-07, -1.506864e-09, +3.466974e-15, +1.013250e+05, +8.448187e+01, +5.537139e+05, -4.309694e-05, +4.619133e+02, -5.885820e+02 },
+    { +1.250000e+03, +5.693117e+00, +9.928561e+03, -8.402202e+06, +4.008499e+06, +4.585354e+06, -7.825346e+06, +2.001306e+03, +2.463250e+03, +1.756507e-01, -1.405958e-04, +1.733665e-06, +2.252376e-07, -1.388418e-09, +2.520183e-15, +1.013250e+05, +8.109744e+01, +5.768126e+05, -3.450920e-05, +4.618764e+02, -4.836556e+02 },
+    { +1.273000e+03, +5.797925e+00, +9.973608e+03, -8.641697e+06, +4.054706e+06, +4.642181e+06, -8.054222e+06, +2.016229e+03, +2.478149e+03, +1.724755e-01, -1.355552e-04, +1.702310e-06, +2.132224e-07, -1.338581e-09, +2.157301e-15, +1.013250e+05, +7.963016e+01, +5.874370e+05, -3.128172e-05, +4.618613e+02, -4.373154e+02 },
+    // P = 0.25 MPa
+    { +2.731420e+02, +1.000082e-03, -2.611708e-01, +1.338035e-02, -7.132333e+01, +1.786971e+02, +2.500338e+02, +4.216298e+03, +4.218733e+03, +9.999182e+02, +6.732713e-02, +5.086225e-07, -1.818281e-02, -3.813983e-09, -1.191689e-15, +2.500000e+05, -1.323715e+05, +1.966095e+06, +3.380497e+04, +1.413329e+04, +9.056832e+03 },
+    { +2.750000e+02, +9.999875e-04, +2.831820e+01, -2.606426e+01, +7.761442e+03, +8.011438e+03, +2.239326e+02, +4.212119e+03, +4.212775e+03, +1.000013e+03, +3.460389e-02, +5.018239e-07, -1.706311e-02, -3.509231e-09, -1.153795e-15, +2.500000e+05, -6.895624e+04, +1.992731e+06, +3.304871e+04, +1.361914e+04, +9.130082e+03 },
+    { +2.800000e+02, +1.000017e-03, +1.041073e+02, -3.577976e+02, +2.879225e+04, +2.904225e+04, -1.077934e+02, +4.199202e+03, +4.200331e+03, +9.999833e+02, -4.426491e-02, +4.860777e-07, -1.460354e-02, -2.816964e-09, -1.075130e-15, +2.500000e+05, +9.106549e+04, +2.057284e+06, +3.111747e+04, +1.233695e+04, +9.361466e+03 },
+    { +2.850000e+02, +1.000412e-03, +1.783715e+02, -1.064704e+03, +4.977117e+04, +5.002127e+04, -8.146007e+02, +4.184209e+03, +4.191823e+03, +9.995877e+02, -1.124162e-01, +4.734218e-07, -1.273841e-02, -2.264881e-09, -1.021808e-15, +2.500000e+05, +2.374545e+05, +2.112281e+06, +2.930080e+04, +1.118786e+04, +9.629961e+03 },
+    { +2.900000e+02, +1.001128e-03, +2.512216e+02, -2.139435e+03, +7.071484e+04, +7.096512e+04, -1.889153e+03, +4.167476e+03, +4.186109e+03, +9.988728e+02, -1.723345e-01, +4.632628e-07, -1.128669e-02, -1.812927e-09, -9.863588e-16, +2.500000e+05, +3.720017e+05, +2.158602e+06, +2.756969e+04, +1.015717e+04, +9.920937e+03 },
+    { +2.950000e+02, +1.002129e-03, +3.227469e+02, -3.575142e+03, +9.163519e+04, +9.188573e+04, -3.324610e+03, +4.149240e+03, +4.182419e+03, +9.978751e+02, -2.257767e-01, +4.551699e-07, -1.013240e-02, -1.434865e-09, -9.640116e-16, +2.500000e+05, +4.960273e+05, +2.196982e+06, +2.590914e+04, +9.233733e+03, +1.022261e+04 },
+    { +3.000000e+02, +1.003388e-03, +3.930211e+02, -5.365384e+03, +1.125409e+05, +1.127918e+05, -5.114537e+03, +4.129684e+03, +4.180216e+03, +9.966237e+02, -2.740243e-01, +4.488211e-07, -9.198341e-03, -1.112797e-09, -9.516619e-16, +2.500000e+05, +6.105424e+05, +2.228059e+06, +2.431237e+04, +8.408575e+03, +1.052599e+04 },
+    { +3.050000e+02, +1.004882e-03, +4.621068e+02, -7.504061e+03, +1.334385e+05, +1.336897e+05, -7.252840e+03, +4.108954e+03, +4.179121e+03, +9.951419e+02, -3.180377e-01, +4.439699e-07, -8.431348e-03, -8.340514e-10, -9.472527e-16, +2.500000e+05, +7.163498e+05, +2.252405e+06, +2.277718e+04, +7.673996e+03, +1.082444e+04 },
+    { +3.100000e+02, +1.006594e-03, +5.300584e+02, -9.985364e+03, +1.543327e+05, +1.545844e+05, -9.733715e+03, +4.087179e+03, +4.178865e+03, +9.934491e+02, -3.585530e-01, +4.404239e-07, -7.793785e-03, -5.893616e-10, -9.494014e-16, +2.500000e+05, +8.141087e+05, +2.270540e+06, +2.130364e+04, +7.023018e+03, +1.111315e+04 },
+    { +3.150000e+02, +1.008511e-03, +5.969240e+02, -1.280374e+04, +1.752273e+05, +1.754795e+05, -1.255161e+04, +4.064480e+03, +4.179262e+03, +9.915613e+02, -3.961454e-01, +4.380312e-07, -7.258348e-03, -3.717513e-10, -9.571711e-16, +2.500000e+05, +9.043771e+05, +2.282942e+06, +1.989270e+04, +6.449086e+03, +1.138871e+04 },
+    { +3.200000e+02, +1.010620e-03, +6.627472e+02, -1.595387e+04, +1.961252e+05, +1.963779e+05, -1.570122e+04, +4.040974e+03, +4.180186e+03, +9.894918e+02, -4.312727e-01, +4.366703e-07, -6.804826e-03, -1.758390e-10, -9.699279e-16, +2.500000e+05, +9.876391e+05, +2.290057e+06, +1.854547e+04, +5.945940e+03, +1.164872e+04 },
+    { +3.250000e+02, +1.012913e-03, +7.275676e+02, -1.943064e+04, +2.170288e+05, +2.172821e+05, -1.917742e+04, +4.016774e+03, +4.181554e+03, +9.872520e+02, -4.643046e-01, +4.362438e-07, -6.418000e-03, +2.616928e-12, -9.872509e-16, +2.500000e+05, +1.064324e+06, +2.292296e+06, +1.726276e+04, +5.507568e+03, +1.189159e+04 },
+    { +3.300000e+02, +1.015381e-03, +7.914223e+02, -2.322913e+04, +2.379402e+05, +2.381941e+05, -2.297528e+04, +3.991989e+03, +4.183318e+03, +9.848517e+02, -4.955443e-01, +4.366731e-07, -6.086242e-03, +1.670246e-10, -1.008874e-15, +2.500000e+05, +1.134818e+06, +2.290043e+06, +1.604494e+04, +5.128204e+03, +1.211623e+04 },
+    { +3.350000e+02, +1.018020e-03, +8.543461e+02, -2.734459e+04, +2.588614e+05, +2.591159e+05, -2.709009e+04, +3.966728e+03, +4.185458e+03, +9.822991e+02, -5.252437e-01, +4.378953e-07, -5.800557e-03, +3.201699e-10, -1.034648e-15, +2.500000e+05, +1.199473e+06, +2.283651e+06, +1.489185e+04, +4.802355e+03, +1.232201e+04 },
+    { +3.400000e+02, +1.020823e-03, +9.163721e+02, -3.177246e+04, +2.797941e+05, +2.800493e+05, -3.151725e+04, +3.941090e+03, +4.187968e+03, +9.796015e+02, -5.536149e-01, +4.398599e-07, -5.553913e-03, +4.643680e-10, -1.064514e-15, +2.500000e+05, +1.258616e+06, +2.273451e+06, +1.380281e+04, +4.524818e+03, +1.250859e+04 },
+    { +3.450000e+02, +1.023788e-03, +9.775320e+02, -3.650831e+04, +3.007402e+05, +3.009962e+05, -3.625236e+04, +3.915174e+03, +4.190856e+03, +9.767649e+02, -5.808386e-01, +4.425273e-07, -5.340765e-03, +6.015735e-10, -1.098492e-15, +2.500000e+05, +1.312549e+06, +2.259747e+06, +1.277670e+04, +4.290704e+03, +1.267583e+04 },
+    { +3.500000e+02, +1.026910e-03, +1.037856e+03, -4.154790e+04, +3.217018e+05, +3.219585e+05, -4.129118e+04, +3.889067e+03, +4.194143e+03, +9.737947e+02, -6.070710e-01, +4.458668e-07, -5.156707e-03, +7.334627e-10, -1.136663e-15, +2.500000e+05, +1.361552e+06, +2.242822e+06, +1.181201e+04, +4.095448e+03, +1.282379e+04 },
+    { +3.550000e+02, +1.030189e-03, +1.097374e+03, -4.688713e+04, +3.426808e+05, +3.429383e+05, -4.662958e+04, +3.862855e+03, +4.197851e+03, +9.706956e+02, -6.324483e-01, +4.498555e-07, -4.998219e-03, +8.614973e-10, -1.179170e-15, +2.500000e+05, +1.405892e+06, +2.222936e+06, +1.090693e+04, +3.934816e+03, +1.295261e+04 },
+    { +3.600000e+02, +1.033622e-03, +1.156115e+03, -5.252203e+04, +3.636793e+05, +3.639378e+05, -5.226362e+04, +3.836612e+03, +4.202009e+03, +9.674715e+02, -6.570910e-01, +4.544775e-07, -4.862478e-03, +9.869732e-10, -1.226210e-15, +2.500000e+05, +1.445816e+06, +2.200329e+06, +1.005939e+04, +3.804901e+03, +1.306254e+04 },
+    { +3.650000e+02, +1.037209e-03, +1.214106e+03, -5.844879e+04, +3.846999e+05, +3.849592e+05, -5.818948e+04, +3.810407e+03, +4.206649e+03, +9.641258e+02, -6.811071e-01, +4.597230e-07, -4.747214e-03, +1.111060e-09, -1.278035e-15, +2.500000e+05, +1.481560e+06, +2.175223e+06, +9.267151e+03, +3.702121e+03, +1.315389e+04 },
+    { +3.700000e+02, +1.040950e-03, +1.271375e+03, -6.466372e+04, +4.057449e+05, +4.060051e+05, -6.440348e+04, +3.784302e+03, +4.211804e+03, +9.606613e+02, -7.045942e-01, +4.655876e-07, -4.650602e-03, +1.234832e-09, -1.334951e-15, +2.500000e+05, +1.513344e+06, +2.147824e+06, +8.527864e+03, +3.623199e+03, +1.322699e+04 },
+    { +3.750000e+02, +1.044844e-03, +1.327947e+03, -7.116328e+04, +4.268169e+05, +4.270781e+05, -7.090207e+04, +3.758351e+03, +4.217507e+03, +9.570805e+02, -7.276418e-01, +4.720724e-07, -4.571185e-03, +1.359299e-09, -1.397323e-15, +2.500000e+05, +1.541377e+06, +2.118319e+06, +7.839099e+03, +3.565156e+03, +1.328223e+04 },
+    { +3.800000e+02, +1.048894e-03, +1.383850e+03, -7.794406e+04, +4.479189e+05, +4.481811e+05, -7.768184e+04, +3.732601e+03, +4.223795e+03, +9.533855e+02, -7.503328e-01, +4.791834e-07, -4.507804e-03, +1.485422e-09, -1.465578e-15, +2.500000e+05, +1.565857e+06, +2.086884e+06, +7.198396e+03, +3.525288e+03, +1.331999e+04 },
+    { +3.850000e+02, +1.053100e-03, +1.439108e+03, -8.500277e+04, +4.690538e+05, +4.693171e+05, -8.473949e+04, +3.707095e+03, +4.230701e+03, +9.495777e+02, -7.727450e-01, +4.869310e-07, -4.459553e-03, +1.614141e-09, -1.540212e-15, +2.500000e+05, +1.586970e+06, +2.053679e+06, +6.603298e+03, +3.501152e+03, +1.334069e+04 },
+    { +3.900000e+02, +1.057464e-03, +1.493746e+03, -9.233625e+04, +4.902249e+05, +4.904892e+05, -9.207188e+04, +3.681868e+03, +4.238263e+03, +9.456584e+02, -7.949524e-01, +4.953306e-07, -4.425747e-03, +1.746389e-09, -1.621792e-15, +2.500000e+05, +1.604892e+06, +2.018853e+06, +6.051376e+03, +3.490542e+03, +1.334472e+04 },
+    { +3.950000e+02, +1.061990e-03, +1.547790e+03, -9.994146e+04, +5.114354e+05, +5.117009e+05, -9.967597e+04, +3.656950e+03, +4.246516e+03, +9.416284e+02, -8.170258e-01, +5.044023e-07, -4.405886e-03, +1.883110e-09, -1.710973e-15, +2.500000e+05, +1.619790e+06, +1.982544e+06, +5.540250e+03, +3.491475e+03, +1.333251e+04 },
+    { +4.000000e+02, +1.066680e-03, +1.601261e+03, -1.078155e+05, +5.326890e+05, +5.329556e+05, -1.075488e+05, +3.632369e+03, +4.255501e+03, +9.374882e+02, -8.390340e-01, +5.141708e-07, -4.399643e-03, +2.025278e-09, -1.808504e-15, +2.500000e+05, +1.631819e+06, +1.944879e+06, +5.067605e+03, +3.502168e+03, +1.330446e+04 },
+    { +4.005610e+02, +1.067217e-03, +1.607226e+03, -1.087156e+05, +5.350765e+05, +5.353433e+05, -1.084488e+05, +3.629633e+03, +4.256556e+03, +9.370168e+02, -8.415022e-01, +5.153116e-07, -4.399783e-03, +2.041613e-09, -1.820004e-15, +2.500000e+05, +1.632997e+06, +1.940574e+06, +5.016876e+03, +3.503905e+03, +1.330034e+04 },
+    { +4.005610e+02, +1.067217e-03, +1.607226e+03, -1.087156e+05, +5.350765e+05, +5.353433e+05, -1.084488e+05, +3.629633e+03, +4.256556e+03, +9.370168e+02, -8.415022e-01, +5.153116e-07, -4.399783e-03, +2.041613e-09, -1.820004e-15, +2.500000e+05, +1.632997e+06, +1.940574e+06, +5.016876e+03, +3.503905e+03, +1.330034e+04 },
+    { +4.100000e+02, +7.379637e-01, +7.103418e+03, -3.597482e+05, +2.552653e+06, +2.737144e+06, -1.752572e+05, +1.604506e+03, +2.160498e+03, +1.355080e+00, -3.723862e-03, +5.568937e-06, +2.636770e-05, -1.737387e-08, +1.313452e-12, +2.500000e+05, +6.686845e+02, +1.795675e+05, -6.679412e-01, +5.318915e+02, -7.604964e+03 },
+    { +4.200000e+02, +7.580990e-01, +7.154965e+03, -4.360758e+05, +2.569010e+06, +2.758534e+06, -2.465510e+05, +1.578984e+03, +2.120257e+03, +1.319089e+00, -3.480817e-03, +5.403151e-06, +2.250609e-05, -1.585235e-08, +1.097693e-12, +2.500000e+05, +6.442199e+02, +1.850772e+05, -4.695150e-01, +5.187769e+02, -6.958886e+03 },
+    { +4.300000e+02, +7.779941e-01, +7.204508e+03, -5.128484e+05, +2.585090e+06, +2.779588e+06, -3.183499e+05, +1.561971e+03, +2.092038e+03, +1.285357e+00, -3.270173e-03, +5.250880e-06, +1.974788e-05, -1.464049e-08, +9.359309e-13, +2.500000e+05, +6.227858e+02, +1.904443e+05, -3.571060e-01, +5.098554e+02, -6.464687e+03 },
+    { +4.400000e+02, +7.976998e-01, +7.252352e+03, -5.900605e+05, +2.600975e+06, +2.800399e+06, -3.906355e+05, +1.550058e+03, +2.071181e+03, +1.253604e+00, -3.083912e-03, +5.109705e-06, +1.758213e-05, -1.362134e-08, +8.075025e-13, +2.500000e+05, +6.035402e+02, +1.957060e+05, -2.806868e-01, +5.030424e+02, -6.052803e+03 },
+    { +4.500000e+02, +8.172515e-01, +7.298714e+03, -6.677049e+05, +2.616717e+06, +2.821029e+06, -4.633920e+05, +1.541740e+03, +2.055559e+03, +1.223613e+00, -2.917225e-03, +4.977988e-06, +1.581061e-05, -1.274231e-08, +7.028203e-13, +2.500000e+05, +5.860250e+02, +2.008844e+05, -2.244595e-01, +4.975890e+02, -5.697478e+03 },
+    { +4.600000e+02, +8.366759e-01, +7.343759e+03, -7.457744e+05, +2.632355e+06, +2.841524e+06, -5.366054e+05, +1.536139e+03, +2.043906e+03, +1.195206e+00, -2.766739e-03, +4.854496e-06, +1.432844e-05, -1.197225e-08, +6.161341e-13, +2.500000e+05, +5.699334e+02, +2.059946e+05, -1.816482e-01, +4.931268e+02, -5.385707e+03 },
+    { +4.700000e+02, +8.559935e-01, +7.387619e+03, -8.242616e+05, +2.647919e+06, +2.861918e+06, -6.102632e+05, +1.532654e+03, +2.035350e+03, +1.168233e+00, -2.629918e-03, +4.738252e-06, +1.306856e-05, -1.128980e-08, +5.435020e-13, +2.500000e+05, +5.550397e+02, +2.110483e+05, -1.484567e-01, +4.894267e+02, -5.109127e+03 },
+    { +4.800000e+02, +8.752209e-01, +7.430403e+03, -9.031594e+05, +2.663434e+06, +2.882239e+06, -6.843542e+05, +1.530844e+03, +2.029248e+03, +1.142569e+00, -2.504785e-03, +4.628461e-06, +1.198398e-05, -1.067928e-08, +4.820501e-13, +2.500000e+05, +5.411702e+02, +2.160545e+05, -1.224027e-01, +4.863268e+02, -4.861635e+03 },
+    { +4.900000e+02, +8.943713e-01, +7.472199e+03, -9.824608e+05, +2.678917e+06, +2.902509e+06, -7.588680e+05, +1.530376e+03, +2.025115e+03, +1.118104e+00, -2.389769e-03, +4.524466e-06, +1.104028e-05, -1.012878e-08, +4.296164e-13, +2.500000e+05, +5.281881e+02, +2.210205e+05, -1.017426e-01, +4.837069e+02, -4.638512e+03 },
+    { +5.000000e+02, +9.134557e-01, +7.513084e+03, -1.062159e+06, +2.694383e+06, +2.922747e+06, -8.337951e+05, +1.530991e+03, +2.022578e+03, +1.094744e+00, -2.283597e-03, +4.425716e-06, +1.021159e-05, -9.629045e-09, +3.845420e-13, +2.500000e+05, +5.159836e+02, +2.259521e+05, -8.520970e-02, +4.814747e+02, -4.436016e+03 },
+    { +5.100000e+02, +9.324827e-01, +7.553122e+03, -1.142248e+06, +2.709845e+06, +2.942965e+06, -9.091268e+05, +1.532490e+03, +2.021345e+03, +1.072406e+00, -2.185221e-03, +4.331741e-06, +9.478071e-06, -9.172744e-09, +3.455347e-13, +2.500000e+05, +5.044671e+02, +2.308541e+05, -7.186714e-02, +4.795589e+02, -4.251129e+03 },
+    { +5.200000e+02, +9.514599e-01, +7.592369e+03, -1.222720e+06, +2.725312e+06, +2.963177e+06, -9.848549e+05, +1.534714e+03, +2.021186e+03, +1.051016e+00, -2.093770e-03, +4.242136e-06, +8.824258e-06, -8.753997e-09, +3.115751e-13, +2.500000e+05, +4.935650e+02, +2.357303e+05, -6.101335e-02, +4.779033e+02, -4.081397e+03 },
+    { +5.300000e+02, +9.703934e-01, +7.630875e+03, -1.303570e+06, +2.740794e+06, +2.983392e+06, -1.060972e+06, +1.537540e+03, +2.021920e+03, +1.030510e+00, -2.008511e-03, +4.156552e-06, +8.237932e-06, -8.368017e-09, +2.818498e-13, +2.500000e+05, +4.832157e+02, +2.405840e+05, -5.211759e-02, +4.764635e+02, -3.924805e+03 },
+    { +5.400000e+02, +9.892884e-01, +7.668682e+03, -1.384792e+06, +2.756296e+06, +3.003618e+06, -1.137470e+06, +1.540867e+03, +2.023402e+03, +1.010828e+00, -1.928819e-03, +4.074680e-06, +7.709300e-06, -8.010860e-09, +2.557031e-13, +2.500000e+05, +4.733671e+02, +2.454180e+05, -4.477472e-02, +4.752039e+02, -3.779684e+03 },
+    { +5.500000e+02, +1.008149e+00, +7.705828e+03, -1.466380e+06, +2.771825e+06, +3.023862e+06, -1.214343e+06, +1.544616e+03, +2.025514e+03, +9.919167e-01, -1.854159e-03, +3.996250e-06, +7.230421e-06, -7.679238e-09, +2.326015e-13, +2.500000e+05, +4.639749e+02, +2.502346e+05, -3.867289e-02, +4.740959e+02, -3.644641e+03 },
+    { +5.600000e+02, +1.026980e+00, +7.742348e+03, -1.548329e+06, +2.787385e+06, +3.044130e+06, -1.291585e+06, +1.548721e+03, +2.028162e+03, +9.737292e-01, -1.784067e-03, +3.921019e-06, +6.794781e-06, -7.370386e-09, +2.121072e-13, +2.500000e+05, +4.550008e+02, +2.550357e+05, -3.357015e-02, +4.731164e+02, -3.518507e+03 },
+    { +5.700000e+02, +1.045783e+00, +7.778272e+03, -1.630634e+06, +2.802981e+06, +3.064427e+06, -1.369188e+06, +1.553132e+03, +2.031268e+03, +9.562215e-01, -1.718138e-03, +3.848774e-06, +6.396983e-06, -7.081953e-09, +1.938579e-13, +2.500000e+05, +4.464117e+02, +2.598230e+05, -2.927730e-02, +4.722463e+02, -3.400293e+03 },
+    { +5.800000e+02, +1.064562e+00, +7.813629e+03, -1.713289e+06, +2.818616e+06, +3.084757e+06, -1.447148e+06, +1.557805e+03, +2.034769e+03, +9.393538e-01, -1.656016e-03, +3.779319e-06, +6.032509e-06, -6.811924e-09, +1.775518e-13, +2.500000e+05, +4.381785e+02, +2.645979e+05, -2.564538e-02, +4.714700e+02, -3.289156e+03 },
+    { +5.900000e+02, +1.083319e+00, +7.848445e+03, -1.796289e+06, +2.834294e+06, +3.105123e+06, -1.525459e+06, +1.562705e+03, +2.038611e+03, +9.230895e-01, -1.597389e-03, +3.712480e-06, +5.697550e-06, -6.558560e-09, +1.629357e-13, +2.500000e+05, +4.302755e+02, +2.693617e+05, -2.255621e-02, +4.707745e+02, -3.184373e+03 },
+    { +6.000000e+02, +1.102056e+00, +7.882742e+03, -1.879629e+06, +2.850016e+06, +3.125530e+06, -1.604115e+06, +1.567803e+03, +2.042753e+03, +9.073953e-01, -1.541978e-03, +3.648097e-06, +5.388862e-06, -6.320349e-09, +1.497959e-13, +2.500000e+05, +4.226800e+02, +2.741155e+05, -1.991545e-02, +4.701491e+02, -3.085323e+03 },
+    { +6.100000e+02, +1.120775e+00, +7.916543e+03, -1.963306e+06, +2.865786e+06, +3.145979e+06, -1.683112e+06, +1.573074e+03, +2.047156e+03, +8.922401e-01, -1.489534e-03, +3.586027e-06, +5.103666e-06, -6.095967e-09, +1.379509e-13, +2.500000e+05, +4.153716e+02, +2.788602e+05, -1.764731e-02, +4.695848e+02, -2.991464e+03 },
+    { +6.200000e+02, +1.139477e+00, +7.949868e+03, -2.047314e+06, +2.881605e+06, +3.166474e+06, -1.762445e+06, +1.578500e+03, +2.051792e+03, +8.775955e-01, -1.439834e-03, +3.526136e-06, +4.839566e-06, -5.884250e-09, +1.272458e-13, +2.500000e+05, +4.083320e+02, +2.835966e+05, -1.569047e-02, +4.690737e+02, -2.902327e+03 },
+    { +6.300000e+02, +1.158165e+00, +7.982736e+03, -2.131649e+06, +2.897475e+06, +3.187016e+06, -1.842108e+06, +1.584063e+03, +2.056633e+03, +8.634349e-01, -1.392679e-03, +3.468303e-06, +4.594479e-06, -5.684165e-09, +1.175479e-13, +2.500000e+05, +4.015448e+02, +2.883254e+05, -1.399507e-02, +4.686096e+02, -2.817499e+03 },
+    { +6.400000e+02, +1.176839e+00, +8.015164e+03, -2.216308e+06, +2.913397e+06, +3.207607e+06, -1.922098e+06, +1.589749e+03, +2.061659e+03, +8.497340e-01, -1.347887e-03, +3.412417e-06, +4.366591e-06, -5.494796e-09, +1.087427e-13, +2.500000e+05, +3.949949e+02, +2.930474e+05, -1.252034e-02, +4.681868e+02, -2.736617e+03 },
+    { +6.500000e+02, +1.195500e+00, +8.047168e+03, -2.301285e+06, +2.929374e+06, +3.228250e+06, -2.002410e+06, +1.595545e+03, +2.066850e+03, +8.364699e-01, -1.305295e-03, +3.358374e-06, +4.154308e-06, -5.315324e-09, +1.007312e-13, +2.500000e+05, +3.886688e+02, +2.977631e+05, -1.123272e-02, +4.678007e+02, -2.659359e+03 },
+    { +6.750000e+02, +1.242106e+00, +8.125424e+03, -2.515099e+06, +2.969563e+06, +3.280089e+06, -2.204572e+06, +1.610460e+03, +2.080452e+03, +8.050845e-01, -1.207493e-03, +3.230725e-06, +3.683042e-06, -4.905300e-09, +8.363714e-14, +2.500000e+05, +3.737531e+02, +3.095280e+05, -8.661548e-03, +4.669702e+02, -2.480271e+03 },
+    { +7.000000e+02, +1.288652e+00, +8.201343e+03, -2.730825e+06, +3.010115e+06, +3.332278e+06, -2.408662e+06, +1.625885e+03, +2.094799e+03, +7.760048e-01, -1.120551e-03, +3.112711e-06, +3.282981e-06, -4.543083e-09, +6.992161e-14, +2.500000e+05, +3.599919e+02, +3.212633e+05, -6.777179e-03, +4.662943e+02, -2.318435e+03 },
+    { +7.250000e+02, +1.335149e+00, +8.275111e+03, -2.948409e+06, +3.051047e+06, +3.384834e+06, -2.614622e+06, +1.641731e+03, +2.109751e+03, +7.489799e-01, -1.042865e-03, +3.003236e-06, +2.940573e-06, -4.221104e-09, +5.880712e-14, +2.500000e+05, +3.472470e+02, +3.329742e+05, -5.371487e-03, +4.657373e+02, -2.171009e+03 },
+    { +7.500000e+02, +1.381606e+00, +8.346894e+03, -3.167802e+06, +3.092369e+06, +3.437770e+06, -2.822401e+06, +1.657933e+03, +2.125203e+03, +7.237954e-01, -9.731293e-04, +2.901371e-06, +2.645402e-06, -3.933326e-09, +4.972078e-14, +2.500000e+05, +3.354032e+02, +3.446646e+05, -4.306428e-03, +4.652732e+02, -2.035767e+03 },
+    { +7.750000e+02, +1.428028e+00, +8.416837e+03, -3.388958e+06, +3.134091e+06, +3.491098e+06, -3.031951e+06, +1.674439e+03, +2.141074e+03, +7.002662e-01, -9.102694e-04, +2.806326e-06, +2.389330e-06, -3.674866e-09, +4.223381e-14, +2.500000e+05, +3.243634e+02, +3.563378e+05, -3.488260e-03, +4.648827e+02, -1.910936e+03 },
+    { +8.000000e+02, +1.474422e+00, +8.485069e+03, -3.611834e+06, +3.176221e+06, +3.544827e+06, -3.243228e+06, +1.691206e+03, +2.157299e+03, +6.782321e-01, -8.533911e-04, +2.717417e-06, +2.165910e-06, -3.441724e-09, +3.602079e-14, +2.500000e+05, +3.140449e+02, +3.679965e+05, -2.851980e-03, +4.645513e+02, -1.795082e+03 },
+    { +8.250000e+02, +1.520790e+00, +8.551705e+03, -3.836389e+06, +3.218768e+06, +3.598965e+06, -3.456191e+06, +1.708194e+03, +2.173823e+03, +6.575531e-01, -8.017451e-04, +2.634056e-06, +1.969970e-06, -3.230590e-09, +3.083174e-14, +2.500000e+05, +3.043766e+02, +3.796426e+05, -2.351657e-03, +4.642676e+02, -1.687031e+03 },
+    { +8.500000e+02, +1.567136e+00, +8.616848e+03, -4.062585e+06, +3.261736e+06, +3.653520e+06, -3.670801e+06, +1.725368e+03, +2.190595e+03, +6.381065e-01, -7.546987e-04, +2.555728e-06, +1.797323e-06, -3.038697e-09, +2.647251e-14, +2.500000e+05, +2.952970e+02, +3.912780e+05, -1.954290e-03, +4.640231e+02, -1.585811e+03 },
+    { +9.000000e+02, +1.659776e+00, +8.743022e+03, -4.519764e+06, +3.348956e+06, +3.763900e+06, -4.104820e+06, +1.760142e+03, +2.224715e+03, +6.024909e-01, -6.723298e-04, +2.412417e-06, +1.508800e-06, -2.703671e-09, +1.966597e-14, +2.500000e+05, +2.786955e+02, +4.145220e+05, -1.378406e-03, +4.636259e+02, -1.400742e+03 },
+    { +9.500000e+02, +1.752359e+00, +8.864232e+03, -4.983110e+06, +3.437910e+06, +3.876000e+06, -4.545021e+06, +1.795274e+03, +2.259342e+03, +5.706594e-01, -6.028361e-04, +2.284475e-06, +1.279438e-06, -2.421872e-09, +1.472120e-14, +2.500000e+05, +2.638838e+02, +4.377372e+05, -9.968080e-04, +4.633199e+02, -1.234763e+03 },
+    { +1.000000e+03, +1.844896e+00, +8.981007e+03, -5.452393e+06, +3.528614e+06, +3.989838e+06, -4.991169e+06, +1.830526e+03, +2.294198e+03, +5.420359e-01, -5.436453e-04, +2.169526e-06, +1.094654e-06, -2.182416e-09, +1.107087e-14, +2.500000e+05, +2.505825e+02, +4.609302e+05, -7.368341e-04, +4.630793e+02, -1.084144e+03 },
+    { +1.050000e+03, +1.937399e+00, +9.093785e+03, -5.927404e+06, +3.621070e+06, +4.105419e+06, -5.443055e+06, +1.865679e+03, +2.329034e+03, +5.161560e-01, -4.928030e-04, +2.065666e-06, +9.440280e-07, -1.977116e-09, +8.339020e-15, +2.500000e+05, +2.385686e+02, +4.841054e+05, -5.553769e-04, +4.628868e+02, -9.460953e+02 },
+    { +1.100000e+03, +2.029873e+00, +9.202931e+03, -6.407955e+06, +3.715269e+06, +4.222737e+06, -5.900487e+06, +1.900532e+03, +2.363631e+03, +4.926418e-01, -4.488009e-04, +1.971350e-06, +8.199602e-07, -1.799700e-09, +6.270509e-15, +2.500000e+05, +2.276617e+02, +5.072665e+05, -4.259768e-04, +4.627302e+02, -8.184862e+02 },
+    { +1.150000e+03, +2.122323e+00, +9.308754e+03, -6.893873e+06, +3.811194e+06, +4.341775e+06, -6.363292e+06, +1.934910e+03, +2.397800e+03, +4.711817e-01, -4.104591e-04, +1.885313e-06, +7.168100e-07, -1.645292e-09, +4.688555e-15, +2.500000e+05, +2.177141e+02, +5.304160e+05, -3.319094e-04, +4.626011e+02, -6.996628e+02 },
+    { +1.200000e+03, +2.214755e+00, +9.411516e+03, -7.385000e+06, +3.908819e+06, +4.462507e+06, -6.831311e+06, +1.968663e+03, +2.431379e+03, +4.515172e-01, -3.768427e-04, +1.806502e-06, +6.303254e-07, -1.510047e-09, +3.468403e-15, +2.500000e+05, +2.086035e+02, +5.535559e+05, -2.623296e-04, +4.624933e+02, -5.883206e+02 },
+    { +1.250000e+03, +2.307171e+00, +9.511438e+03, -7.881189e+06, +4.008108e+06, +4.584901e+06, -7.304397e+06, +2.001666e+03, +2.464237e+03, +4.334313e-01, -3.472033e-04, +1.734040e-06, +5.572573e-07, -1.390900e-09, +2.520570e-15, +2.500000e+05, +2.002280e+02, +5.766879e+05, -2.100437e-04, +4.624023e+02, -4.834164e+02 },
+    { +1.273000e+03, +2.349678e+00, +9.556503e+03, -8.111098e+06, +4.054330e+06, +4.641750e+06, -7.523679e+06, +2.016567e+03, +2.479079e+03, +4.255903e-01, -3.347336e-04, +1.702631e-06, +5.274369e-07, -1.340798e-09, +2.157377e-15, +2.500000e+05, +1.965978e+02, +5.873264e+05, -1.903952e-04, +4.623651e+02, -4.370836e+02 },
+    // P = 0.5 MPa
+    { +2.731230e+02, +9.999560e-04, -5.378425e-01, +5.298532e-02, -1.468442e+02, +3.531338e+02, +5.000310e+02, +4.215166e+03, +4.217557e+03, +1.000044e+03, +6.671909e-02, +5.083971e-07, -1.815190e-02, -3.811777e-09, -1.191126e-15, +5.000000e+05, -1.312342e+05, +1.966966e+06, +3.377663e+04, +1.414282e+04, +9.064595e+03 },
+    { +2.750000e+02, +9.998621e-04, +2.832674e+01, -2.601724e+01, +7.763837e+03, +8.263768e+03, +4.739138e+02, +4.210980e+03, +4.211603e+03, +1.000138e+03, +3.372717e-02, +5.015355e-07, -1.702411e-02, -3.504492e-09, -1.152848e-15, +5.000000e+05, -6.724782e+04, +1.993877e+06, +3.301458e+04, +1.362405e+04, +9.138328e+03 },
+    { +2.800000e+02, +9.998952e-04, +1.040962e+02, -3.577520e+02, +2.878917e+04, +2.928912e+04, +1.421956e+02, +4.198144e+03, +4.199309e+03, +1.000105e+03, -4.496875e-02, +4.858091e-07, -1.457287e-02, -2.813742e-09, -1.074235e-15, +5.000000e+05, +9.256465e+04, +2.058422e+06, +3.108830e+04, +1.234343e+04, +9.369202e+03 },
+    { +2.850000e+02, +1.000294e-03, +1.783433e+02, -1.064659e+03, +4.976318e+04, +5.026333e+04, -5.645124e+02, +4.183221e+03, +4.190914e+03, +9.997060e+02, -1.129821e-01, +4.731665e-07, -1.271360e-02, -2.262711e-09, -1.020928e-15, +5.000000e+05, +2.387788e+05, +2.113421e+06, +2.927591e+04, +1.119534e+04, +9.637246e+03 },
+    { +2.900000e+02, +1.001012e-03, +2.511784e+02, -2.139391e+03, +7.070235e+04, +7.120285e+04, -1.638885e+03, +4.166548e+03, +4.185286e+03, +9.989886e+02, -1.727876e-01, +4.630163e-07, -1.126613e-02, -1.811513e-09, -9.854660e-16, +5.000000e+05, +3.731782e+05, +2.159751e+06, +2.754850e+04, +1.016525e+04, +9.927795e+03 },
+    { +2.950000e+02, +1.002015e-03, +3.226902e+02, -3.575099e+03, +9.161850e+04, +9.211951e+04, -3.074092e+03, +4.148368e+03, +4.181662e+03, +9.979889e+02, -2.261353e-01, +4.549290e-07, -1.011504e-02, -1.434017e-09, -9.630886e-16, +5.000000e+05, +4.970783e+05, +2.198145e+06, +2.589117e+04, +9.242097e+03, +1.022905e+04 },
+    { +3.000000e+02, +1.003275e-03, +3.929521e+02, -5.365342e+03, +1.125203e+05, +1.130219e+05, -4.863704e+03, +4.128861e+03, +4.179510e+03, +9.967358e+02, -2.743025e-01, +4.485833e-07, -9.183420e-03, -1.112390e-09, -9.506960e-16, +5.000000e+05, +6.114861e+05, +2.229240e+06, +2.429721e+04, +8.417001e+03, +1.053204e+04 },
+    { +3.050000e+02, +1.004770e-03, +4.620265e+02, -7.504019e+03, +1.334141e+05, +1.339164e+05, -7.001634e+03, +4.108175e+03, +4.178456e+03, +9.952529e+02, -3.182462e-01, +4.437332e-07, -8.418337e-03, -8.340029e-10, -9.462342e-16, +5.000000e+05, +7.172018e+05, +2.253606e+06, +2.276448e+04, +7.682327e+03, +1.083011e+04 },
+    { +3.100000e+02, +1.006483e-03, +5.299675e+02, -9.985322e+03, +1.543046e+05, +1.548079e+05, -9.482080e+03, +4.086442e+03, +4.178233e+03, +9.935592e+02, -3.587003e-01, +4.401867e-07, -7.782285e-03, -5.896143e-10, -9.483223e-16, +5.000000e+05, +8.148822e+05, +2.271763e+06, +2.129309e+04, +7.031145e+03, +1.111847e+04 },
+    { +3.150000e+02, +1.008399e-03, +5.968233e+02, -1.280370e+04, +1.751956e+05, +1.756998e+05, -1.229950e+04, +4.063783e+03, +4.178656e+03, +9.916707e+02, -3.962384e-01, +4.377921e-07, -7.248056e-03, -3.722669e-10, -9.560240e-16, +5.000000e+05, +9.050835e+05, +2.284189e+06, +1.988404e+04, +6.456936e+03, +1.139371e+04 },
+    { +3.200000e+02, +1.010508e-03, +6.626371e+02, -1.595383e+04, +1.960900e+05, +1.965953e+05, -1.544858e+04, +4.040313e+03, +4.179599e+03, +9.896009e+02, -4.313167e-01, +4.364280e-07, -6.795504e-03, -1.765918e-10, -9.687058e-16, +5.000000e+05, +9.882884e+05, +2.291329e+06, +1.853845e+04, +5.953463e+03, +1.165344e+04 },
+    { +3.250000e+02, +1.012801e-03, +7.274485e+02, -1.943060e+04, +2.169902e+05, +2.174966e+05, -1.892420e+04, +4.016146e+03, +4.180983e+03, +9.873610e+02, -4.643041e-01, +4.359971e-07, -6.409459e-03, +1.643748e-12, -9.859465e-16, +5.000000e+05, +1.064925e+06, +2.293593e+06, +1.725719e+04, +5.514733e+03, +1.189604e+04 },
+    { +3.300000e+02, +1.015269e-03, +7.912946e+02, -2.322909e+04, +2.378981e+05, +2.384058e+05, -2.272145e+04, +3.991394e+03, +4.182759e+03, +9.849608e+02, -4.955027e-01, +4.364211e-07, -6.078329e-03, +1.658412e-10, -1.007479e-15, +5.000000e+05, +1.135378e+06, +2.291365e+06, +1.604063e+04, +5.134995e+03, +1.212046e+04 },
+    { +3.350000e+02, +1.017906e-03, +8.542101e+02, -2.734455e+04, +2.588158e+05, +2.593248e+05, -2.683560e+04, +3.966162e+03, +4.184906e+03, +9.824086e+02, -5.251639e-01, +4.376368e-07, -5.793146e-03, +3.187813e-10, -1.033154e-15, +5.000000e+05, +1.199999e+06, +2.285000e+06, +1.488863e+04, +4.808764e+03, +1.232604e+04 },
+    { +3.400000e+02, +1.020709e-03, +9.162279e+02, -3.177241e+04, +2.797451e+05, +2.802554e+05, -3.126206e+04, +3.940553e+03, +4.187421e+03, +9.797114e+02, -5.534990e-01, +4.395940e-07, -5.546898e-03, +4.627752e-10, -1.062913e-15, +5.000000e+05, +1.259114e+06, +2.274826e+06, +1.380054e+04, +4.530844e+03, +1.251245e+04 },
+    { +3.450000e+02, +1.023672e-03, +9.773798e+02, -3.650827e+04, +3.006878e+05, +3.011996e+05, -3.599643e+04, +3.914663e+03, +4.190312e+03, +9.768755e+02, -5.806884e-01, +4.422529e-07, -5.334056e-03, +5.997738e-10, -1.096772e-15, +5.000000e+05, +1.313023e+06, +2.261150e+06, +1.277524e+04, +4.296350e+03, +1.267956e+04 },
+    { +3.500000e+02, +1.026793e-03, +1.037696e+03, -4.154786e+04, +3.216458e+05, +3.221592e+05, -4.103446e+04, +3.888582e+03, +4.193597e+03, +9.739062e+02, -6.068878e-01, +4.455829e-07, -5.150226e-03, +7.314506e-10, -1.134812e-15, +5.000000e+05, +1.362009e+06, +2.244251e+06, +1.181126e+04, +4.100721e+03, +1.282740e+04 },
+    { +3.550000e+02, +1.030070e-03, +1.097207e+03, -4.688709e+04, +3.426212e+05, +3.431363e+05, -4.637205e+04, +3.862393e+03, +4.197303e+03, +9.708080e+02, -6.322332e-01, +4.495610e-07, -4.991897e-03, +8.592643e-10, -1.177176e-15, +5.000000e+05, +1.406335e+06, +2.224392e+06, +1.090678e+04, +3.939726e+03, +1.295613e+04 },
+    { +3.600000e+02, +1.033501e-03, +1.155939e+03, -5.252198e+04, +3.636162e+05, +3.641330e+05, -5.200523e+04, +3.836173e+03, +4.201456e+03, +9.675851e+02, -6.568446e-01, +4.541712e-07, -4.856254e-03, +9.845081e-10, -1.224057e-15, +5.000000e+05, +1.446249e+06, +2.201813e+06, +1.005975e+04, +3.809459e+03, +1.306600e+04 },
+    { +3.650000e+02, +1.037086e-03, +1.213923e+03, -5.844874e+04, +3.846331e+05, +3.851516e+05, -5.793020e+04, +3.809989e+03, +4.206089e+03, +9.642406e+02, -6.808297e-01, +4.594037e-07, -4.741032e-03, +1.108349e-09, -1.275706e-15, +5.000000e+05, +1.481986e+06, +2.176735e+06, +9.267943e+03, +3.706338e+03, +1.315731e+04 },
+    { +3.700000e+02, +1.040824e-03, +1.271184e+03, -6.466367e+04, +4.056743e+05, +4.061947e+05, -6.414326e+04, +3.783904e+03, +4.211234e+03, +9.607777e+02, -7.042859e-01, +4.652542e-07, -4.644411e-03, +1.231859e-09, -1.332428e-15, +5.000000e+05, +1.513766e+06, +2.149363e+06, +8.529017e+03, +3.627088e+03, +1.323039e+04 },
+    { +3.750000e+02, +1.044715e-03, +1.327749e+03, -7.116323e+04, +4.267425e+05, +4.272649e+05, -7.064087e+04, +3.757972e+03, +4.216927e+03, +9.571985e+02, -7.273024e-01, +4.717235e-07, -4.564936e-03, +1.356043e-09, -1.394584e-15, +5.000000e+05, +1.541798e+06, +2.119886e+06, +7.840550e+03, +3.568729e+03, +1.328563e+04 },
+    { +3.800000e+02, +1.048762e-03, +1.383644e+03, -7.794401e+04, +4.478406e+05, +4.483650e+05, -7.741963e+04, +3.732241e+03, +4.223200e+03, +9.535052e+02, -7.499619e-01, +4.788173e-07, -4.501448e-03, +1.481860e-09, -1.462599e-15, +5.000000e+05, +1.566280e+06, +2.088479e+06, +7.200089e+03, +3.528559e+03, +1.332342e+04 },
+    { +3.850000e+02, +1.052965e-03, +1.438894e+03, -8.500272e+04, +4.689714e+05, +4.694979e+05, -8.447624e+04, +3.706752e+03, +4.230091e+03, +9.496994e+02, -7.723420e-01, +4.865463e-07, -4.453046e-03, +1.610248e-09, -1.536964e-15, +5.000000e+05, +1.587397e+06, +2.055303e+06, +6.605183e+03, +3.504132e+03, +1.334416e+04 },
+    { +3.900000e+02, +1.057326e-03, +1.493524e+03, -9.233620e+04, +4.901383e+05, +4.906670e+05, -9.180753e+04, +3.681541e+03, +4.237635e+03, +9.457821e+02, -7.945163e-01, +4.949256e-07, -4.419040e-03, +1.742133e-09, -1.618245e-15, +5.000000e+05, +1.605325e+06, +2.020506e+06, +6.053408e+03, +3.493244e+03, +1.334825e+04 },
+    { +3.950000e+02, +1.061848e-03, +1.547559e+03, -9.994141e+04, +5.113445e+05, +5.118754e+05, -9.941049e+04, +3.656639e+03, +4.245868e+03, +9.417544e+02, -8.165556e-01, +5.039751e-07, -4.398933e-03, +1.878458e-09, -1.707090e-15, +5.000000e+05, +1.620230e+06, +1.984225e+06, +5.542391e+03, +3.493912e+03, +1.333612e+04 },
+    { +4.000000e+02, +1.066534e-03, +1.601023e+03, -1.078154e+05, +5.325936e+05, +5.331269e+05, -1.072822e+05, +3.632072e+03, +4.254830e+03, +9.376167e+02, -8.385283e-01, +5.137192e-07, -4.392393e-03, +2.020189e-09, -1.804244e-15, +5.000000e+05, +1.632270e+06, +1.946589e+06, +5.069819e+03, +3.504352e+03, +1.330816e+04 },
+    { +4.100000e+02, +1.076413e-03, +1.706328e+03, -1.243589e+05, +5.752356e+05, +5.757738e+05, -1.238207e+05, +3.584025e+03, +4.275096e+03, +9.290116e+02, -8.825430e-01, +5.354151e-07, -4.419462e-03, +2.323990e-09, -2.027008e-15, +5.000000e+05, +1.648334e+06, +1.867710e+06, +4.231166e+03, +3.548328e+03, +1.320638e+04 },
+    { +4.200000e+02, +1.086999e-03, +1.809624e+03, -1.419455e+05, +6.180966e+05, +6.186401e+05, -1.414020e+05, +3.537527e+03, +4.298775e+03, +9.199640e+02, -9.270974e-01, +5.603146e-07, -4.500570e-03, +2.662521e-09, -2.294959e-15, +5.000000e+05, +1.654601e+06, +1.784712e+06, +3.520648e+03, +3.614311e+03, +1.304605e+04 },
+    { +4.249810e+02, +1.092550e-03, +1.860382e+03, -1.510886e+05, +6.395385e+05, +6.400848e+05, -1.505424e+05, +3.514972e+03, +4.311963e+03, +9.152901e+02, -9.496614e-01, +5.740319e-07, -4.561852e-03, +2.847329e-09, -2.448614e-15, +5.000000e+05, +1.654370e+06, +1.742063e+06, +3.209738e+03, +3.652623e+03, +1.294530e+04 },
+    { +4.249810e+02, +1.092550e-03, +1.860382e+03, -1.510886e+05, +6.395385e+05, +6.400848e+05, -1.505424e+05, +3.514972e+03, +4.311963e+03, +9.152901e+02, -9.496614e-01, +5.740319e-07, -4.561852e-03, +2.847329e-09, -2.448614e-15, +5.000000e+05, +1.654370e+06, +1.742063e+06, +3.209738e+03, +3.652623e+03, +1.294530e+04 },
+    { +4.300000e+02, +3.802748e-01, +6.848564e+03, -3.749827e+05, +2.569900e+06, +2.760037e+06, -1.848453e+05, +1.716982e+03, +2.346867e+03, +2.629677e+00, -7.474209e-03, +5.514841e-06, +6.458459e-05, -1.956986e-08, +1.209479e-12, +5.000000e+05, +1.355290e+03, +1.813289e+05, -2.495177e+00, +5.895632e+02, -7.211062e+03 },
+    { +4.400000e+02, +3.909454e-01, +6.901523e+03, -4.490710e+05, +2.587599e+06, +2.783072e+06, -2.535983e+05, +1.666124e+03, +2.267138e+03, +2.557902e+00, -6.903043e-03, +5.331895e-06, +5.113183e-05, -1.719978e-08, +9.822934e-13, +5.000000e+05, +1.294670e+03, +1.875506e+05, -1.545839e+00, +5.602721e+02, -6.480321e+03 },
+    { +4.500000e+02, +4.013997e-01, +6.951864e+03, -5.235670e+05, +2.604772e+06, +2.805471e+06, -3.228671e+05, +1.635189e+03, +2.215892e+03, +2.491282e+00, -6.433949e-03, +5.168531e-06, +4.321797e-05, -1.554978e-08, +8.272963e-13, +5.000000e+05, +1.244831e+03, +1.934786e+05, -1.119513e+00, +5.435388e+02, -5.991833e+03 },
+    { +4.600000e+02, +4.116915e-01, +7.000140e+03, -5.984745e+05, +2.621590e+06, +2.827436e+06, -3.926287e+05, +1.613718e+03, +2.178713e+03, +2.429003e+00, -6.031322e-03, +5.019750e-06, +3.757171e-05, -1.425094e-08, +7.091790e-13, +5.000000e+05, +1.201518e+03, +1.992131e+05, -8.665717e-01, +5.317450e+02, -5.606731e+03 },
+    { +4.700000e+02, +4.218535e-01, +7.046679e+03, -6.737909e+05, +2.638148e+06, +2.849075e+06, -4.628642e+05, +1.598090e+03, +2.150425e+03, +2.370491e+00, -5.678375e-03, +4.882778e-06, +3.318349e-05, -1.317415e-08, +6.147952e-13, +5.000000e+05, +1.162939e+03, +2.048014e+05, -6.908970e-01, +5.225830e+02, -5.281161e+03 },
+    { +4.800000e+02, +4.319087e-01, +7.091714e+03, -7.495116e+05, +2.654511e+06, +2.870465e+06, -5.335573e+05, +1.586632e+03, +2.128541e+03, +2.315304e+00, -5.364874e-03, +4.755734e-06, +2.963420e-05, -1.225780e-08, +5.375408e-13, +5.000000e+05, +1.128085e+03, +2.102725e+05, -5.598653e-01, +5.151614e+02, -4.997567e+03 },
+    { +4.900000e+02, +4.418745e-01, +7.135421e+03, -8.256312e+05, +2.670725e+06, +2.891662e+06, -6.046940e+05, +1.578351e+03, +2.111551e+03, +2.263086e+00, -5.083661e-03, +4.637212e-06, +2.669634e-05, -1.146482e-08, +4.733249e-13, +5.000000e+05, +1.096275e+03, +2.156468e+05, -4.588960e-01, +5.090243e+02, -4.746663e+03 },
+    { +5.000000e+02, +4.517648e-01, +7.177942e+03, -9.021441e+05, +2.686827e+06, +2.912709e+06, -6.762618e+05, +1.572562e+03, +2.098405e+03, +2.213541e+00, -4.829400e-03, +4.526112e-06, +2.422412e-05, -1.076982e-08, +4.193167e-13, +5.000000e+05, +1.067008e+03, +2.209402e+05, -3.796957e-01, +5.038835e+02, -4.522372e+03 },
+    { +5.100000e+02, +4.615906e-01, +7.219392e+03, -9.790446e+05, +2.702845e+06, +2.933641e+06, -7.482493e+05, +1.568762e+03, +2.088329e+03, +2.166422e+00, -4.597969e-03, +4.421551e-06, +2.211585e-05, -1.015431e-08, +3.734478e-13, +5.000000e+05, +1.039899e+03, +2.261650e+05, -3.168063e-01, +4.995346e+02, -4.320220e+03 },
+    { +5.200000e+02, +4.713609e-01, +7.259866e+03, -1.056327e+06, +2.718804e+06, +2.954484e+06, -8.206463e+05, +1.566566e+03, +2.080734e+03, +2.121517e+00, -4.386118e-03, +4.322808e-06, +2.029748e-05, -9.604357e-09, +3.341604e-13, +5.000000e+05, +1.014646e+03, +2.313311e+05, -2.663684e-01, +4.958242e+02, -4.136730e+03 },
+    { +5.300000e+02, +4.810830e-01, +7.299444e+03, -1.133985e+06, +2.734720e+06, +2.975262e+06, -8.934436e+05, +1.565676e+03, +2.075164e+03, +2.078643e+00, -4.191239e-03, +4.229282e-06, +1.871362e-05, -9.109220e-09, +3.002584e-13, +5.000000e+05, +9.910049e+02, +2.364468e+05, -2.255565e-01, +4.926343e+02, -3.969129e+03 },
+    { +5.400000e+02, +4.907632e-01, +7.338195e+03, -1.212014e+06, +2.750611e+06, +2.995993e+06, -9.666325e+05, +1.565857e+03, +2.071261e+03, +2.037643e+00, -4.011206e-03, +4.140469e-06, +1.732209e-05, -8.660475e-09, +2.708085e-13, +5.000000e+05, +9.687805e+02, +2.415185e+05, -1.922621e-01, +4.898725e+02, -3.815168e+03 },
+    { +5.500000e+02, +5.004065e-01, +7.376176e+03, -1.290408e+06, +2.766489e+06, +3.016692e+06, -1.040205e+06, +1.566925e+03, +2.068741e+03, +1.998375e+00, -3.844266e-03, +4.055940e-06, +1.609019e-05, -8.251413e-09, +2.450736e-13, +5.000000e+05, +9.478113e+02, +2.465520e+05, -1.648918e-01, +4.874658e+02, -3.673008e+03 },
+    { +5.600000e+02, +5.100171e-01, +7.413438e+03, -1.369162e+06, +2.782363e+06, +3.037371e+06, -1.114154e+06, +1.568733e+03, +2.067378e+03, +1.960719e+00, -3.688956e-03, +3.975327e-06, +1.499227e-05, -7.876625e-09, +2.224642e-13, +5.000000e+05, +9.279630e+02, +2.515517e+05, -1.422287e-01, +4.853559e+02, -3.541128e+03 },
+    { +5.700000e+02, +5.195988e-01, +7.450025e+03, -1.448271e+06, +2.798243e+06, +3.058043e+06, -1.188471e+06, +1.571160e+03, +2.066990e+03, +1.924562e+00, -3.544042e-03, +3.898308e-06, +1.400790e-05, -7.531695e-09, +2.025044e-13, +5.000000e+05, +9.091232e+02, +2.565215e+05, -1.233354e-01, +4.834958e+02, -3.418266e+03 },
+    { +5.800000e+02, +5.291547e-01, +7.485976e+03, -1.527729e+06, +2.814137e+06, +3.078714e+06, -1.263152e+06, +1.574113e+03, +2.067430e+03, +1.889807e+00, -3.408474e-03, +3.824605e-06, +1.312066e-05, -7.212976e-09, +1.848060e-13, +5.000000e+05, +8.911964e+02, +2.614649e+05, -1.074837e-01, +4.818476e+02, -3.303362e+03 },
+    { +5.900000e+02, +5.386874e-01, +7.521326e+03, -1.607533e+06, +2.830050e+06, +3.099394e+06, -1.338189e+06, +1.577512e+03, +2.068578e+03, +1.856364e+00, -3.281350e-03, +3.753972e-06, +1.231716e-05, -6.917427e-09, +1.690499e-13, +5.000000e+05, +8.741010e+02, +2.663845e+05, -9.410348e-02, +4.803800e+02, -3.195523e+03 },
+    { +6.000000e+02, +5.481993e-01, +7.556107e+03, -1.687676e+06, +2.845988e+06, +3.120088e+06, -1.413577e+06, +1.581295e+03, +2.070334e+03, +1.824154e+00, -3.161889e-03, +3.686188e-06, +1.158640e-05, -6.642490e-09, +1.549713e-13, +5.000000e+05, +8.577666e+02, +2.712829e+05, -8.274506e-02, +4.790675e+02, -3.093989e+03 },
+    { +6.100000e+02, +5.576924e-01, +7.590346e+03, -1.768156e+06, +2.861956e+06, +3.140802e+06, -1.489309e+06, +1.585409e+03, +2.072618e+03, +1.793103e+00, -3.049410e-03, +3.621060e-06, +1.091926e-05, -6.385991e-09, +1.423492e-13, +5.000000e+05, +8.421319e+02, +2.761622e+05, -7.305126e-02, +4.778887e+02, -2.998112e+03 },
+    { +6.200000e+02, +5.671685e-01, +7.624070e+03, -1.848966e+06, +2.877957e+06, +3.161541e+06, -1.565382e+06, +1.589810e+03, +2.075360e+03, +1.763145e+00, -2.943317e-03, +3.558413e-06, +1.030810e-05, -6.146072e-09, +1.309978e-13, +5.000000e+05, +8.271432e+02, +2.810241e+05, -6.473638e-02, +4.768261e+02, -2.907333e+03 },
+    { +6.300000e+02, +5.766290e-01, +7.657301e+03, -1.930104e+06, +2.893996e+06, +3.182310e+06, -1.641789e+06, +1.594463e+03, +2.078504e+03, +1.734217e+00, -2.843083e-03, +3.498089e-06, +9.746449e-06, -5.921128e-09, +1.207597e-13, +5.000000e+05, +8.127533e+02, +2.858704e+05, -5.757044e-02, +4.758648e+02, -2.821171e+03 },
+    { +6.400000e+02, +5.860755e-01, +7.690061e+03, -2.011564e+06, +2.910075e+06, +3.203113e+06, -1.718526e+06, +1.599338e+03, +2.082002e+03, +1.706265e+00, -2.748242e-03, +3.439945e-06, +9.228831e-06, -5.709769e-09, +1.115011e-13, +5.000000e+05, +7.989201e+02, +2.907023e+05, -5.136710e-02, +4.749922e+02, -2.739204e+03 },
+    { +6.500000e+02, +5.955090e-01, +7.722370e+03, -2.093343e+06, +2.926197e+06, +3.223952e+06, -1.795589e+06, +1.604409e+03, +2.085814e+03, +1.679236e+00, -2.658376e-03, +3.383852e-06, +8.750545e-06, -5.510782e-09, +1.031075e-13, +5.000000e+05, +7.856063e+02, +2.955212e+05, -4.597447e-02, +4.741977e+02, -2.661067e+03 },
+    { +6.750000e+02, +6.190430e-01, +7.801285e+03, -2.299161e+06, +2.966706e+06, +3.276227e+06, -1.989640e+06, +1.617812e+03, +2.096504e+03, +1.615397e+00, -2.453127e-03, +3.251841e-06, +7.701629e-06, -5.060743e-09, +8.529396e-14, +5.000000e+05, +7.543811e+02, +3.075182e+05, -3.527551e-02, +4.724965e+02, -2.480450e+03 },
+    { +7.000000e+02, +6.425167e-01, +7.877744e+03, -2.506891e+06, +3.007530e+06, +3.328788e+06, -2.185633e+06, +1.632059e+03, +2.108535e+03, +1.556380e+00, -2.271867e-03, +3.130338e-06, +6.824453e-06, -4.668106e-09, +7.109475e-14, +5.000000e+05, +7.257577e+02, +3.194543e+05, -2.749617e-02, +4.711196e+02, -2.317736e+03 },
+    { +7.250000e+02, +6.659406e-01, +7.951960e+03, -2.716479e+06, +3.048693e+06, +3.381663e+06, -2.383508e+06, +1.646973e+03, +2.121617e+03, +1.501635e+00, -2.110778e-03, +3.018043e-06, +6.082814e-06, -4.322656e-09, +5.964880e-14, +5.000000e+05, +6.993863e+02, +3.313406e+05, -2.172896e-02, +4.699895e+02, -2.169829e+03 },
+    { +7.500000e+02, +6.893232e-01, +8.024119e+03, -2.927875e+06, +3.090214e+06, +3.434876e+06, -2.583213e+06, +1.662425e+03, +2.135539e+03, +1.450698e+00, -1.966822e-03, +2.913878e-06, +5.449911e-06, -4.016535e-09, +5.033152e-14, +5.000000e+05, +6.749843e+02, +3.431853e+05, -1.738066e-02, +4.690509e+02, -2.034352e+03 },
+    { +7.750000e+02, +7.126710e-01, +8.094379e+03, -3.141034e+06, +3.132110e+06, +3.488446e+06, -2.784698e+06, +1.678321e+03, +2.150144e+03, +1.403172e+00, -1.837546e-03, +2.816940e-06, +4.905448e-06, -3.743578e-09, +4.268126e-14, +5.000000e+05, +6.523200e+02, +3.549952e+05, -1.405327e-02, +4.682629e+02, -1.909433e+03 },
+    { +8.000000e+02, +7.359892e-01, +8.162882e+03, -3.355912e+06, +3.174393e+06, +3.542388e+06, -2.987918e+06, +1.694585e+03, +2.165309e+03, +1.358716e+00, -1.720944e-03, +2.726464e-06, +4.433764e-06, -3.498863e-09, +3.635132e-14, +5.000000e+05, +6.312000e+02, +3.667755e+05, -1.147356e-02, +4.675952e+02, -1.793581e+03 },
+    { +8.250000e+02, +7.592823e-01, +8.229750e+03, -3.572470e+06, +3.217074e+06, +3.596715e+06, -3.192829e+06, +1.711155e+03, +2.180938e+03, +1.317033e+00, -1.615355e-03, +2.641795e-06, +4.022581e-06, -3.278406e-09, +3.107760e-14, +5.000000e+05, +6.114611e+02, +3.785305e+05, -9.450057e-03, +4.670248e+02, -1.685583e+03 },
+    { +8.500000e+02, +7.825537e-01, +8.295094e+03, -3.790669e+06, +3.260161e+06, +3.651438e+06, -3.399393e+06, +1.727979e+03, +2.196950e+03, +1.277868e+00, -1.519393e-03, +2.562369e-06, +3.662136e-06, -3.078942e-09, +2.665642e-14, +5.000000e+05, +5.929641e+02, +3.902639e+05, -7.846129e-03, +4.665337e+02, -1.584444e+03 },
+    { +9.000000e+02, +8.290425e-01, +8.421595e+03, -4.231853e+06, +3.347582e+06, +3.762104e+06, -3.817332e+06, +1.762205e+03, +2.229855e+03, +1.206211e+00, -1.351860e-03, +2.417347e-06, +3.063517e-06, -2.732619e-09, +1.977018e-14, +5.000000e+05, +5.592329e+02, +4.136767e+05, -5.526713e-03, +4.657366e+02, -1.399567e+03 },
+    { +9.500000e+02, +8.754735e-01, +8.543058e+03, -4.679205e+06, +3.436700e+06, +3.874437e+06, -4.241468e+06, +1.796936e+03, +2.263568e+03, +1.142239e+00, -1.210950e-03, +2.288163e-06, +2.590851e-06, -2.443064e-09, +1.478078e-14, +5.000000e+05, +5.292235e+02, +4.370318e+05, -3.993155e-03, +4.651233e+02, -1.233776e+03 },
+    { +1.000000e+03, +9.218598e-01, +8.660031e+03, -5.132493e+06, +3.527538e+06, +3.988468e+06, -4.671563e+06, +1.831887e+03, +2.297722e+03, +1.084764e+00, -1.091216e-03, +2.172298e-06, +2.212026e-06, -2.198165e-09, +1.110490e-14, +5.000000e+05, +5.023325e+02, +4.603420e+05, -2.949931e-03, +4.646415e+02, -1.083319e+03 },
+    { +1.050000e+03, +9.682105e-01, +8.772967e+03, -5.591509e+06, +3.620106e+06, +4.104211e+06, -5.107404e+06, +1.866809e+03, +2.332008e+03, +1.032833e+00, -9.885625e-04, +2.067753e-06, +1.904481e-06, -1.988970e-09, +8.358187e-15, +5.000000e+05, +4.780854e+02, +4.836168e+05, -2.222534e-03, +4.642561e+02, -9.454013e+02 },
+    { +1.100000e+03, +1.014533e+00, +8.882241e+03, -6.056065e+06, +3.714400e+06, +4.221666e+06, -5.548799e+06, +1.901484e+03, +2.366168e+03, +9.856754e-01, -8.998528e-04, +1.972919e-06, +1.651979e-06, -1.808721e-09, +6.280947e-15, +5.000000e+05, +4.561022e+02, +5.068631e+05, -1.704196e-03, +4.639428e+02, -8.178943e+02 },
+    { +1.150000e+03, +1.060832e+00, +8.988169e+03, -6.525988e+06, +3.810406e+06, +4.340822e+06, -5.995572e+06, +1.935720e+03, +2.399985e+03, +9.426565e-01, -8.226477e-04, +1.886486e-06, +1.442593e-06, -1.652220e-09, +4.693853e-15, +5.000000e+05, +4.360742e+02, +5.300862e+05, -1.327589e-03, +4.636845e+02, -6.991479e+02 },
+    { +1.200000e+03, +1.107112e+00, +9.091017e+03, -7.001120e+06, +3.908100e+06, +4.461656e+06, -6.447564e+06, +1.969360e+03, +2.433276e+03, +9.032512e-01, -7.550247e-04, +1.807370e-06, +1.267409e-06, -1.515410e-09, +3.470693e-15, +5.000000e+05, +4.177478e+02, +5.532903e+05, -1.049129e-03, +4.634688e+02, -5.878618e+02 },
+    { +1.250000e+03, +1.153376e+00, +9.191012e+03, -7.481314e+06, +4.007451e+06, +4.584139e+06, -6.904627e+06, +2.002272e+03, +2.465897e+03, +8.670200e-01, -6.954504e-04, +1.734670e-06, +1.119659e-06, -1.395078e-09, +2.521128e-15, +5.000000e+05, +4.009122e+02, +5.764784e+05, -8.399379e-04, +4.632867e+02, -4.829966e+02 },
+    { +1.273000e+03, +1.174653e+00, +9.236106e+03, -7.703866e+06, +4.053698e+06, +4.641024e+06, -7.116539e+06, +2.017137e+03, +2.480644e+03, +8.513154e-01, -6.703995e-04, +1.703170e-06, +1.059427e-06, -1.344530e-09, +2.157419e-15, +5.000000e+05, +3.936186e+02, +5.871404e+05, -7.613395e-04, +4.632123e+02, -4.366770e+02 },
+    // P = 0.75 MPa
+    { +2.731050e+02, +9.998301e-04, -7.991703e-01, +1.196060e-01, -2.181378e+02, +5.317348e+02, +7.499922e+02, +4.214032e+03, +4.216379e+03, +1.000170e+03, +6.609289e-02, +5.081680e-07, -1.812039e-02, -3.809390e-09, -1.190542e-15, +7.500000e+05, -1.300611e+05, +1.967853e+06, +3.374793e+04, +1.415204e+04, +9.072416e+03 },
+    { +2.750000e+02, +9.997368e-04, +2.833506e+01, -2.593893e+01, +7.766203e+03, +8.516006e+03, +7.238636e+02, +4.209843e+03, +4.210435e+03, +1.000263e+03, +3.285164e-02, +5.012474e-07, -1.698520e-02, -3.499757e-09, -1.151903e-15, +7.500000e+05, -6.553976e+04, +1.995023e+06, +3.298053e+04, +1.362896e+04, +9.146591e+03 },
+    { +2.800000e+02, +9.997739e-04, +1.040848e+02, -3.576762e+02, +2.878608e+04, +2.953591e+04, +3.921542e+02, +4.197088e+03, +4.198290e+03, +1.000226e+03, -4.567178e-02, +4.855406e-07, -1.454227e-02, -2.810522e-09, -1.073343e-15, +7.500000e+05, +9.406377e+04, +2.059560e+06, +3.105919e+04, +1.234990e+04, +9.376954e+03 },
+    { +2.850000e+02, +1.000176e-03, +1.783150e+02, -1.064585e+03, +4.975518e+04, +5.050531e+04, -3.144537e+02, +4.182234e+03, +4.190007e+03, +9.998243e+02, -1.135475e-01, +4.729114e-07, -1.268882e-02, -2.260540e-09, -1.020049e-15, +7.500000e+05, +2.401032e+05, +2.114561e+06, +2.925105e+04, +1.120282e+04, +9.644546e+03 },
+    { +2.900000e+02, +1.000896e-03, +2.511351e+02, -2.139319e+03, +7.068985e+04, +7.144052e+04, -1.388647e+03, +4.165622e+03, +4.184464e+03, +9.991043e+02, -1.732403e-01, +4.627700e-07, -1.124561e-02, -1.810098e-09, -9.845755e-16, +7.500000e+05, +3.743550e+05, +2.160900e+06, +2.752734e+04, +1.017332e+04, +9.934666e+03 },
+    { +2.950000e+02, +1.001901e-03, +3.226334e+02, -3.575028e+03, +9.160182e+04, +9.235324e+04, -2.823602e+03, +4.147496e+03, +4.180906e+03, +9.981026e+02, -2.264937e-01, +4.546883e-07, -1.009769e-02, -1.433168e-09, -9.621680e-16, +7.500000e+05, +4.981296e+05, +2.199309e+06, +2.587321e+04, +9.250453e+03, +1.023551e+04 },
+    { +3.000000e+02, +1.003162e-03, +3.928830e+02, -5.365271e+03, +1.124996e+05, +1.132520e+05, -4.612900e+03, +4.128038e+03, +4.178806e+03, +9.968480e+02, -2.745805e-01, +4.483457e-07, -9.168518e-03, -1.111981e-09, -9.497325e-16, +7.500000e+05, +6.124303e+05, +2.230422e+06, +2.428206e+04, +8.425419e+03, +1.053810e+04 },
+    { +3.050000e+02, +1.004658e-03, +4.619461e+02, -7.503949e+03, +1.333896e+05, +1.341431e+05, -6.750455e+03, +4.107398e+03, +4.177793e+03, +9.953638e+02, -3.184547e-01, +4.434968e-07, -8.405342e-03, -8.339515e-10, -9.452182e-16, +7.500000e+05, +7.180542e+05, +2.254808e+06, +2.275178e+04, +7.690651e+03, +1.083579e+04 },
+    { +3.100000e+02, +1.006371e-03, +5.298767e+02, -9.985252e+03, +1.542765e+05, +1.550313e+05, -9.230474e+03, +4.085707e+03, +4.177603e+03, +9.936692e+02, -3.588478e-01, +4.399498e-07, -7.770799e-03, -5.898638e-10, -9.472458e-16, +7.500000e+05, +8.156562e+05, +2.272987e+06, +2.128254e+04, +7.039265e+03, +1.112381e+04 },
+    { +3.150000e+02, +1.008288e-03, +5.967226e+02, -1.280363e+04, +1.751640e+05, +1.759202e+05, -1.204741e+04, +4.063086e+03, +4.178051e+03, +9.917802e+02, -3.963315e-01, +4.375532e-07, -7.237776e-03, -3.727790e-10, -9.548798e-16, +7.500000e+05, +9.057905e+05, +2.285436e+06, +1.987537e+04, +6.464779e+03, +1.139872e+04 },
+    { +3.200000e+02, +1.010397e-03, +6.625270e+02, -1.595376e+04, +1.960549e+05, +1.968127e+05, -1.519596e+04, +4.039652e+03, +4.179014e+03, +9.897100e+02, -4.313610e-01, +4.361860e-07, -6.786193e-03, -1.773407e-10, -9.674868e-16, +7.500000e+05, +9.889382e+05, +2.292600e+06, +1.853144e+04, +5.960980e+03, +1.165816e+04 },
+    { +3.250000e+02, +1.012689e-03, +7.273295e+02, -1.943053e+04, +2.169515e+05, +2.177111e+05, -1.867101e+04, +4.015520e+03, +4.180412e+03, +9.874700e+02, -4.643038e-01, +4.357508e-07, -6.400929e-03, +6.748675e-13, -9.846454e-16, +7.500000e+05, +1.065526e+06, +2.294890e+06, +1.725161e+04, +5.521894e+03, +1.190050e+04 },
+    { +3.300000e+02, +1.015156e-03, +7.911669e+02, -2.322902e+04, +2.378561e+05, +2.386174e+05, -2.246765e+04, +3.990799e+03, +4.182200e+03, +9.850699e+02, -4.954614e-01, +4.361694e-07, -6.070427e-03, +1.646625e-10, -1.006088e-15, +7.500000e+05, +1.135938e+06, +2.292687e+06, +1.603631e+04, +5.141782e+03, +1.212469e+04 },
+    { +3.350000e+02, +1.017793e-03, +8.540741e+02, -2.734448e+04, +2.587703e+05, +2.595337e+05, -2.658113e+04, +3.965597e+03, +4.184355e+03, +9.825180e+02, -5.250843e-01, +4.373787e-07, -5.785745e-03, +3.173979e-10, -1.031665e-15, +7.500000e+05, +1.200526e+06, +2.286348e+06, +1.488540e+04, +4.815169e+03, +1.233008e+04 },
+    { +3.400000e+02, +1.020594e-03, +9.160838e+02, -3.177234e+04, +2.796961e+05, +2.804616e+05, -3.100690e+04, +3.940016e+03, +4.186874e+03, +9.798213e+02, -5.533835e-01, +4.393285e-07, -5.539893e-03, +4.611880e-10, -1.061316e-15, +7.500000e+05, +1.259612e+06, +2.276201e+06, +1.379825e+04, +4.536866e+03, +1.251632e+04 },
+    { +3.450000e+02, +1.023556e-03, +9.772277e+02, -3.650820e+04, +3.006354e+05, +3.014030e+05, -3.574053e+04, +3.914152e+03, +4.189767e+03, +9.769860e+02, -5.805387e-01, +4.419789e-07, -5.327357e-03, +5.979803e-10, -1.095056e-15, +7.500000e+05, +1.313499e+06, +2.262551e+06, +1.277378e+04, +4.301993e+03, +1.268328e+04 },
+    { +3.500000e+02, +1.026676e-03, +1.037536e+03, -4.154779e+04, +3.215899e+05, +3.223599e+05, -4.077778e+04, +3.888096e+03, +4.193053e+03, +9.740175e+02, -6.067052e-01, +4.452994e-07, -5.143755e-03, +7.294453e-10, -1.132967e-15, +7.500000e+05, +1.362466e+06, +2.245680e+06, +1.181050e+04, +4.105992e+03, +1.283101e+04 },
+    { +3.550000e+02, +1.029951e-03, +1.097039e+03, -4.688701e+04, +3.425618e+05, +3.433343e+05, -4.611455e+04, +3.861931e+03, +4.196755e+03, +9.709204e+02, -6.320186e-01, +4.492669e-07, -4.985587e-03, +8.570388e-10, -1.175187e-15, +7.500000e+05, +1.406777e+06, +2.225848e+06, +1.090662e+04, +3.944634e+03, +1.295966e+04 },
+    { +3.600000e+02, +1.033380e-03, +1.155764e+03, -5.252191e+04, +3.635532e+05, +3.643282e+05, -5.174687e+04, +3.835734e+03, +4.200904e+03, +9.676986e+02, -6.565988e-01, +4.538655e-07, -4.850042e-03, +9.820513e-10, -1.221910e-15, +7.500000e+05, +1.446681e+06, +2.203296e+06, +1.006010e+04, +3.814015e+03, +1.306947e+04 },
+    { +3.650000e+02, +1.036962e-03, +1.213740e+03, -5.844866e+04, +3.845664e+05, +3.853441e+05, -5.767094e+04, +3.809571e+03, +4.205530e+03, +9.643555e+02, -6.805530e-01, +4.590851e-07, -4.734863e-03, +1.105647e-09, -1.273385e-15, +7.500000e+05, +1.482411e+06, +2.178245e+06, +9.268728e+03, +3.710554e+03, +1.316073e+04 },
+    { +3.700000e+02, +1.040698e-03, +1.270993e+03, -6.466359e+04, +4.056038e+05, +4.063844e+05, -6.388307e+04, +3.783507e+03, +4.210666e+03, +9.608939e+02, -7.039783e-01, +4.649214e-07, -4.638234e-03, +1.228895e-09, -1.329913e-15, +7.500000e+05, +1.514188e+06, +2.150901e+06, +8.530162e+03, +3.630976e+03, +1.323380e+04 },
+    { +3.750000e+02, +1.044587e-03, +1.327550e+03, -7.116315e+04, +4.266682e+05, +4.274517e+05, -7.037971e+04, +3.757594e+03, +4.216347e+03, +9.573164e+02, -7.269638e-01, +4.713751e-07, -4.558701e-03, +1.352798e-09, -1.391854e-15, +7.500000e+05, +1.542219e+06, +2.121453e+06, +7.841993e+03, +3.572302e+03, +1.328904e+04 },
+    { +3.800000e+02, +1.048630e-03, +1.383438e+03, -7.794393e+04, +4.477623e+05, +4.485488e+05, -7.715745e+04, +3.731881e+03, +4.222607e+03, +9.536249e+02, -7.495919e-01, +4.784521e-07, -4.495109e-03, +1.478312e-09, -1.459630e-15, +7.500000e+05, +1.566702e+06, +2.090074e+06, +7.201774e+03, +3.531830e+03, +1.332685e+04 },
+    { +3.850000e+02, +1.052830e-03, +1.438680e+03, -8.500263e+04, +4.688891e+05, +4.696788e+05, -8.421301e+04, +3.706409e+03, +4.229482e+03, +9.498210e+02, -7.719399e-01, +4.861625e-07, -4.446555e-03, +1.606369e-09, -1.533728e-15, +7.500000e+05, +1.587823e+06, +2.056925e+06, +6.607060e+03, +3.507113e+03, +1.334763e+04 },
+    { +3.900000e+02, +1.057188e-03, +1.493302e+03, -9.233611e+04, +4.900518e+05, +4.908447e+05, -9.154322e+04, +3.681215e+03, +4.237008e+03, +9.459058e+02, -7.940813e-01, +4.945215e-07, -4.412352e-03, +1.737894e-09, -1.614711e-15, +7.500000e+05, +1.605757e+06, +2.022157e+06, +6.055434e+03, +3.495948e+03, +1.335178e+04 },
+    { +3.950000e+02, +1.061706e-03, +1.547329e+03, -9.994132e+04, +5.112537e+05, +5.120500e+05, -9.914504e+04, +3.656328e+03, +4.245222e+03, +9.418804e+02, -8.160865e-01, +5.035488e-07, -4.392000e-03, +1.873823e-09, -1.703223e-15, +7.500000e+05, +1.620670e+06, +1.985905e+06, +5.544525e+03, +3.496350e+03, +1.333972e+04 },
+    { +4.000000e+02, +1.066388e-03, +1.600784e+03, -1.078154e+05, +5.324983e+05, +5.332981e+05, -1.070156e+05, +3.631776e+03, +4.254160e+03, +9.377451e+02, -8.380239e-01, +5.132687e-07, -4.385166e-03, +2.015120e-09, -1.800002e-15, +7.500000e+05, +1.632720e+06, +1.948297e+06, +5.072027e+03, +3.506537e+03, +1.331186e+04 },
+    { +4.100000e+02, +1.076258e-03, +1.706072e+03, -1.243588e+05, +5.751309e+05, +5.759381e+05, -1.235516e+05, +3.583756e+03, +4.274372e+03, +9.291454e+02, -8.819628e-01, +5.349090e-07, -4.411487e-03, +2.317909e-09, -2.021868e-15, +7.500000e+05, +1.648809e+06, +1.869477e+06, +4.233431e+03, +3.550040e+03, +1.321031e+04 },
+    { +4.200000e+02, +1.086834e-03, +1.809351e+03, -1.419454e+05, +6.179818e+05, +6.187969e+05, -1.411303e+05, +3.537282e+03, +4.297986e+03, +9.201041e+02, -9.264327e-01, +5.597417e-07, -4.491605e-03, +2.655188e-09, -2.288668e-15, +7.500000e+05, +1.655108e+06, +1.786538e+06, +3.522869e+03, +3.615594e+03, +1.305028e+04 },
+    { +4.300000e+02, +1.098161e-03, +1.910798e+03, -1.605561e+05, +6.610868e+05, +6.619105e+05, -1.597325e+05, +3.492439e+03, +4.325391e+03, +9.106131e+02, -9.719825e-01, +5.881628e-07, -4.628087e-03, +3.037546e-09, -2.611451e-15, +7.500000e+05, +1.652574e+06, +1.700210e+06, +2.925079e+03, +3.694532e+03, +1.283480e+04 },
+    { +4.400000e+02, +1.110298e-03, +2.010590e+03, -1.801735e+05, +7.044862e+05, +7.053189e+05, -1.793407e+05, +3.449274e+03, +4.357048e+03, +9.006589e+02, -1.019199e+00, +6.206861e-07, -4.825962e-03, +3.478073e-09, -3.004968e-15, +7.500000e+05, +1.642052e+06, +1.611120e+06, +2.426359e+03, +3.779975e+03, +1.256678e+04 },
+    { +4.408990e+02, +1.111431e-03, +2.019486e+03, -1.819858e+05, +7.084037e+05, +7.092373e+05, -1.811523e+05, +3.445477e+03, +4.360121e+03, +8.997406e+02, -1.023547e+00, +6.238321e-07, -4.847005e-03, +3.521063e-09, -3.044442e-15, +7.500000e+05, +1.640741e+06, +1.602995e+06, +2.385951e+03, +3.787780e+03, +1.254020e+04 },
+    { +4.408990e+02, +1.111431e-03, +2.019486e+03, -1.819858e+05, +7.084037e+05, +7.092373e+05, -1.811523e+05, +3.445477e+03, +4.360121e+03, +8.997406e+02, -1.023547e+00, +6.238321e-07, -4.847005e-03, +3.521063e-09, -3.044442e-15, +7.500000e+05, +1.640741e+06, +1.602995e+06, +2.385951e+03, +3.787780e+03, +1.254020e+04 },
+    { +4.500000e+02, +2.624024e-01, +6.734561e+03, -4.390184e+05, +2.591534e+06, +2.788336e+06, -2.422166e+05, +1.761177e+03, +2.431965e+03, +3.810941e+00, -1.080849e-02, +5.396267e-06, +9.553608e-05, -1.981026e-08, +1.009589e-12, +7.500000e+05, +2.002957e+03, +1.853133e+05, -3.748549e+00, +6.108615e+02, -6.424871e+03 },
+    { +4.600000e+02, +2.697410e-01, +6.786994e+03, -5.121327e+05, +2.609885e+06, +2.812190e+06, -3.098269e+05, +1.708516e+03, +2.345590e+03, +3.707260e+00, -9.959606e-03, +5.211297e-06, +7.614494e-05, -1.735336e-08, +8.293209e-13, +7.500000e+05, +1.911157e+03, +1.918908e+05, -2.464659e+00, +5.806252e+02, -5.859833e+03 },
+    { +4.700000e+02, +2.769122e-01, +6.836779e+03, -5.856319e+05, +2.627654e+06, +2.835339e+06, -3.779477e+05, +1.674645e+03, +2.287212e+03, +3.611252e+00, -9.261879e-03, +5.046918e-06, +6.415437e-05, -1.560175e-08, +7.014723e-13, +7.500000e+05, +1.835155e+03, +1.981407e+05, -1.833496e+00, +5.619814e+02, -5.456721e+03 },
+    { +4.800000e+02, +2.839548e-01, +6.884457e+03, -6.595217e+05, +2.645018e+06, +2.857984e+06, -4.465555e+05, +1.650394e+03, +2.243761e+03, +3.521687e+00, -8.665686e-03, +4.898041e-06, +5.548513e-05, -1.422201e-08, +6.027935e-13, +7.500000e+05, +1.769215e+03, +2.041633e+05, -1.439021e+00, +5.483574e+02, -5.129812e+03 },
+    { +4.900000e+02, +2.908934e-01, +6.930362e+03, -7.338010e+05, +2.662076e+06, +2.880246e+06, -5.156310e+05, +1.632330e+03, +2.210121e+03, +3.437685e+00, -8.145794e-03, +4.761675e-06, +4.875197e-05, -1.308497e-08, +5.236057e-13, +7.500000e+05, +1.710699e+03, +2.100101e+05, -1.158289e+00, +5.375974e+02, -4.849814e+03 },
+    { +5.000000e+02, +2.977458e-01, +6.974735e+03, -8.084670e+05, +2.678901e+06, +2.902210e+06, -5.851577e+05, +1.618761e+03, +2.183666e+03, +3.358570e+00, -7.686298e-03, +4.635755e-06, +4.333142e-05, -1.212447e-08, +4.586660e-13, +7.500000e+05, +1.658047e+03, +2.157146e+05, -9.462243e-01, +5.287979e+02, -4.603998e+03 },
+    { +5.100000e+02, +3.045256e-01, +7.017763e+03, -8.835154e+05, +2.695544e+06, +2.923938e+06, -6.551212e+05, +1.608648e+03, +2.162743e+03, +3.283796e+00, -7.275981e-03, +4.518736e-06, +3.886986e-05, -1.129936e-08, +4.046138e-13, +7.500000e+05, +1.610181e+03, +2.213008e+05, -7.813832e-01, +5.214690e+02, -4.385205e+03 },
+    { +5.200000e+02, +3.112439e-01, +7.059593e+03, -9.589418e+05, +2.712046e+06, +2.945479e+06, -7.255089e+05, +1.601264e+03, +2.146190e+03, +3.212914e+00, -6.906479e-03, +4.409412e-06, +3.513689e-05, -1.058122e-08, +3.590957e-13, +7.500000e+05, +1.566304e+03, +2.267876e+05, -6.511225e-01, +5.152911e+02, -4.188593e+03 },
+    { +5.300000e+02, +3.179093e-01, +7.100345e+03, -1.034741e+06, +2.728441e+06, +2.966873e+06, -7.963095e+05, +1.596069e+03, +2.133145e+03, +3.145552e+00, -6.571357e-03, +4.306824e-06, +3.197125e-05, -9.949334e-09, +3.203866e-13, +7.500000e+05, +1.525801e+03, +2.321896e+05, -5.469738e-01, +5.100341e+02, -4.010540e+03 },
+    { +5.400000e+02, +3.245289e-01, +7.140119e+03, -1.110909e+06, +2.744755e+06, +2.988152e+06, -8.675126e+05, +1.592649e+03, +2.122945e+03, +3.081390e+00, -6.265558e-03, +4.210190e-06, +2.925552e-05, -9.388155e-09, +2.871863e-13, +7.500000e+05, +1.488189e+03, +2.375190e+05, -4.628918e-01, +5.055240e+02, -3.848209e+03 },
+    { +5.500000e+02, +3.311087e-01, +7.178998e+03, -1.187440e+06, +2.761009e+06, +3.009340e+06, -9.391089e+05, +1.590681e+03, +2.115078e+03, +3.020156e+00, -5.985041e-03, +4.118866e-06, +2.690211e-05, -8.885727e-09, +2.584964e-13, +7.500000e+05, +1.453080e+03, +2.427853e+05, -3.944205e-01, +5.016259e+02, -3.699318e+03 },
+    { +5.600000e+02, +3.376535e-01, +7.217053e+03, -1.264330e+06, +2.777220e+06, +3.030460e+06, -1.011090e+06, +1.589909e+03, +2.109140e+03, +2.961616e+00, -5.726532e-03, +4.032311e-06, +2.484440e-05, -8.432713e-09, +2.335380e-13, +7.500000e+05, +1.420161e+03, +2.479967e+05, -3.382147e-01, +4.982339e+02, -3.562012e+03 },
+    { +5.700000e+02, +3.441676e-01, +7.254343e+03, -1.341573e+06, +2.793403e+06, +3.051528e+06, -1.083447e+06, +1.590133e+03, +2.104809e+03, +2.905561e+00, -5.487340e-03, +3.950071e-06, +2.303096e-05, -8.021715e-09, +2.116957e-13, +7.500000e+05, +1.389175e+03, +2.531600e+05, -2.917318e-01, +4.952638e+02, -3.434766e+03 },
+    { +5.800000e+02, +3.506543e-01, +7.290922e+03, -1.419165e+06, +2.809570e+06, +3.072560e+06, -1.156174e+06, +1.591190e+03, +2.101828e+03, +2.851812e+00, -5.265233e-03, +3.871757e-06, +2.142153e-05, -7.646790e-09, +1.924774e-13, +7.500000e+05, +1.359908e+03, +2.582807e+05, -2.530192e-01, +4.926479e+02, -3.316313e+03 },
+    { +5.900000e+02, +3.571166e-01, +7.326834e+03, -1.497101e+06, +2.825731e+06, +3.093569e+06, -1.229264e+06, +1.592948e+03, +2.099990e+03, +2.800206e+00, -5.058337e-03, +3.797032e-06, +1.998419e-05, -7.303109e-09, +1.754857e-13, +7.500000e+05, +1.332182e+03, +2.633636e+05, -2.205645e-01, +4.903315e+02, -3.205598e+03 },
+    { +6.000000e+02, +3.635571e-01, +7.362120e+03, -1.575377e+06, +2.841896e+06, +3.114563e+06, -1.302709e+06, +1.595304e+03, +2.099125e+03, +2.750600e+00, -4.865062e-03, +3.725604e-06, +1.869333e-05, -6.986704e-09, +1.603962e-13, +7.500000e+05, +1.305845e+03, +2.684129e+05, -1.931864e-01, +4.882703e+02, -3.101731e+03 },
+    { +6.100000e+02, +3.699779e-01, +7.396816e+03, -1.653987e+06, +2.858070e+06, +3.135554e+06, -1.376504e+06, +1.598169e+03, +2.099095e+03, +2.702864e+00, -4.684051e-03, +3.657218e-06, +1.752819e-05, -6.694284e-09, +1.469422e-13, +7.500000e+05, +1.280769e+03, +2.734319e+05, -1.699554e-01, +4.864275e+02, -3.003960e+03 },
+    { +6.200000e+02, +3.763811e-01, +7.430953e+03, -1.732929e+06, +2.874262e+06, +3.156548e+06, -1.450643e+06, +1.601473e+03, +2.099786e+03, +2.656882e+00, -4.514136e-03, +3.591647e-06, +1.647176e-05, -6.423089e-09, +1.349024e-13, +7.500000e+05, +1.256843e+03, +2.784238e+05, -1.501345e-01, +4.847730e+02, -2.911645e+03 },
+    { +6.300000e+02, +3.827681e-01, +7.464560e+03, -1.812197e+06, +2.890476e+06, +3.177552e+06, -1.525121e+06, +1.605156e+03, +2.101103e+03, +2.612548e+00, -4.354301e-03, +3.528693e-06, +1.550998e-05, -6.170790e-09, +1.240917e-13, +7.500000e+05, +1.233970e+03, +2.833911e+05, -1.331354e-01, +4.832816e+02, -2.824237e+03 },
+    { +6.400000e+02, +3.891406e-01, +7.497663e+03, -1.891788e+06, +2.906716e+06, +3.198572e+06, -1.599933e+06, +1.609171e+03, +2.102967e+03, +2.569765e+00, -4.203660e-03, +3.468175e-06, +1.463114e-05, -5.935403e-09, +1.143546e-13, +7.500000e+05, +1.212067e+03, +2.883361e+05, -1.184854e-01, +4.819323e+02, -2.741262e+03 },
+    { +6.500000e+02, +3.954998e-01, +7.530286e+03, -1.971698e+06, +2.922988e+06, +3.219613e+06, -1.675073e+06, +1.613476e+03, +2.105311e+03, +2.528446e+00, -4.061435e-03, +3.409934e-06, +1.382538e-05, -5.715225e-09, +1.055593e-13, +7.500000e+05, +1.191060e+03, +2.932608e+05, -1.058018e-01, +4.807074e+02, -2.662309e+03 },
+    { +6.750000e+02, +4.113466e-01, +7.609876e+03, -2.172841e+06, +2.963826e+06, +3.272336e+06, -1.864331e+06, +1.625296e+03, +2.112922e+03, +2.431040e+00, -3.738362e-03, +3.273376e-06, +1.207890e-05, -5.222145e-09, +8.699395e-14, +7.500000e+05, +1.142051e+03, +3.054950e+05, -8.078964e-02, +4.780961e+02, -2.480285e+03 },
+    { +7.000000e+02, +4.271317e-01, +7.686887e+03, -2.375894e+06, +3.004927e+06, +3.325275e+06, -2.055545e+06, +1.638321e+03, +2.122529e+03, +2.341198e+00, -3.454940e-03, +3.148261e-06, +1.063939e-05, -4.797164e-09, +7.229294e-14, +7.500000e+05, +1.097412e+03, +3.176357e+05, -6.273897e-02, +4.759932e+02, -2.316775e+03 },
+    { +7.250000e+02, +4.428661e-01, +7.761559e+03, -2.580805e+06, +3.046325e+06, +3.378475e+06, -2.248656e+06, +1.652273e+03, +2.133669e+03, +2.258019e+00, -3.204425e-03, +3.033062e-06, +9.436626e-06, -4.426991e-09, +6.050517e-14, +7.500000e+05, +1.056498e+03, +3.296999e+05, -4.943666e-02, +4.742741e+02, -2.168447e+03 },
+    { +7.500000e+02, +4.585585e-01, +7.834099e+03, -2.787524e+06, +3.088050e+06, +3.431969e+06, -2.443606e+06, +1.666958e+03, +2.146010e+03, +2.180747e+00, -2.981560e-03, +2.926538e-06, +8.420202e-06, -4.101695e-09, +5.095089e-14, +7.500000e+05, +1.018801e+03, +3.417007e+05, -3.945449e-02, +4.728505e+02, -2.032775e+03 },
+    { +7.750000e+02, +4.742156e-01, +7.904681e+03, -2.996006e+06, +3.130122e+06, +3.485783e+06, -2.640344e+06, +1.682231e+03, +2.159313e+03, +2.108746e+00, -2.782174e-03, +2.827667e-06, +7.552931e-06, -3.813677e-09, +4.313378e-14, +7.500000e+05, +9.839116e+02, +3.536485e+05, -3.184471e-02, +4.716582e+02, -1.907800e+03 },
+    { +8.000000e+02, +4.898429e-01, +7.973457e+03, -3.206207e+06, +3.172559e+06, +3.539941e+06, -2.838824e+06, +1.697984e+03, +2.173395e+03, +2.041471e+00, -2.602906e-03, +2.735593e-06, +6.806751e-06, -3.556999e-09, +3.668477e-14, +7.500000e+05, +9.514959e+02, +3.655514e+05, -2.596261e-02, +4.706498e+02, -1.791972e+03 },
+    { +8.250000e+02, +5.054447e-01, +8.040559e+03, -3.418087e+06, +3.215375e+06, +3.594458e+06, -3.039003e+06, +1.714131e+03, +2.188111e+03, +1.978456e+00, -2.441009e-03, +2.649595e-06, +6.160081e-06, -3.326947e-09, +3.132507e-14, +7.500000e+05, +9.212761e+02, +3.774162e+05, -2.135988e-02, +4.697894e+02, -1.684045e+03 },
+    { +8.500000e+02, +5.210247e-01, +8.106106e+03, -3.631608e+06, +3.258582e+06, +3.649351e+06, -3.240840e+06, +1.730600e+03, +2.203349e+03, +1.919295e+00, -2.294214e-03, +2.569056e-06, +5.596047e-06, -3.119719e-09, +2.684117e-14, +7.500000e+05, +8.930183e+02, +3.892481e+05, -1.771860e-02, +4.690495e+02, -1.583000e+03 },
+    { +9.000000e+02, +5.521304e-01, +8.232936e+03, -4.063436e+06, +3.346206e+06, +3.760304e+06, -3.649338e+06, +1.764274e+03, +2.235022e+03, +1.811166e+00, -2.038664e-03, +2.422302e-06, +4.665000e-06, -2.761860e-09, +1.987447e-14, +7.500000e+05, +8.416222e+02, +4.128304e+05, -1.246434e-02, +4.678501e+02, -1.398332e+03 },
+    { +9.500000e+02, +5.831780e-01, +8.354652e+03, -4.501431e+06, +3.435488e+06, +3.872871e+06, -4.064048e+06, +1.798600e+03, +2.267811e+03, +1.714742e+00, -1.824382e-03, +2.291866e-06, +3.934703e-06, -2.464423e-09, +1.484019e-14, +7.500000e+05, +7.960249e+02, +4.363257e+05, -8.997801e-03, +4.669283e+02, -1.232741e+03 },
+    { +1.000000e+03, +6.141806e-01, +8.471824e+03, -4.945363e+06, +3.526461e+06, +3.987096e+06, -4.484728e+06, +1.833249e+03, +2.301257e+03, +1.628186e+00, -1.642736e-03, +2.175078e-06, +3.352375e-06, -2.214011e-09, +1.113869e-14, +7.500000e+05, +7.552537e+02, +4.597536e+05, -6.643111e-03, +4.662046e+02, -1.082454e+03 },
+    { +1.050000e+03, +6.451476e-01, +8.584918e+03, -5.395023e+06, +3.619141e+06, +4.103002e+06, -4.911162e+06, +1.867941e+03, +2.334990e+03, +1.550033e+00, -1.487293e-03, +2.069845e-06, +2.881507e-06, -2.000881e-09, +8.377119e-15, +7.500000e+05, +7.185528e+02, +4.831280e+05, -5.002967e-03, +4.656260e+02, -9.446727e+02 },
+    { +1.100000e+03, +6.760861e-01, +8.694321e+03, -5.850223e+06, +3.713530e+06, +4.220595e+06, -5.343158e+06, +1.902435e+03, +2.368711e+03, +1.479102e+00, -1.353164e-03, +1.974491e-06, +2.496142e-06, -1.817774e-09, +6.291179e-15, +7.500000e+05, +6.853230e+02, +5.064597e+05, -3.835063e-03, +4.651557e+02, -8.172721e+02 },
+    { +1.150000e+03, +7.070013e-01, +8.800354e+03, -6.310789e+06, +3.809618e+06, +4.339869e+06, -5.780538e+06, +1.936531e+03, +2.402173e+03, +1.414425e+00, -1.236571e-03, +1.887660e-06, +2.177401e-06, -1.659167e-09, +4.698979e-15, +7.500000e+05, +6.550814e+02, +5.297565e+05, -2.986952e-03, +4.647681e+02, -6.986061e+02 },
+    { +1.200000e+03, +7.378974e-01, +8.903289e+03, -6.776565e+06, +3.907382e+06, +4.460805e+06, -6.223142e+06, +1.970057e+03, +2.435176e+03, +1.355202e+00, -1.134549e-03, +1.808238e-06, +1.911282e-06, -1.520784e-09, +3.472839e-15, +7.500000e+05, +6.274334e+02, +5.530247e+05, -2.360103e-03, +4.644446e+02, -5.873787e+02 },
+    { +1.250000e+03, +7.687775e-01, +9.003356e+03, -7.247403e+06, +4.006793e+06, +4.583376e+06, -6.670820e+06, +2.002877e+03, +2.467559e+03, +1.300766e+00, -1.044743e-03, +1.735301e-06, +1.687225e-06, -1.399263e-09, +2.521569e-15, +7.500000e+05, +6.020530e+02, +5.762690e+05, -1.889322e-03, +4.641714e+02, -4.825548e+02 },
+    { +1.273000e+03, +7.829778e-01, +9.048480e+03, -7.465650e+06, +4.053065e+06, +4.640299e+06, -6.878417e+06, +2.017706e+03, +2.482211e+03, +1.277175e+00, -1.006999e-03, +1.703710e-06, +1.595984e-06, -1.348267e-09, +2.157354e-15, +7.500000e+05, +5.910626e+02, +5.869545e+05, -1.712466e-03, +4.640597e+02, -4.362493e+02 },
+    // P = 1.0 MPa
+    { +2.730860e+02, +9.997044e-04, -1.076035e+00, +2.117823e-01, -2.936383e+02, +7.060661e+02, +9.999162e+02, +4.212903e+03, +4.215207e+03, +1.000296e+03, +6.548481e-02, +5.079428e-07, -1.808954e-02, -3.807168e-09, -1.189983e-15, +1.000000e+06, -1.289216e+05, +1.968726e+06, +3.371968e+04, +1.416152e+04, +9.080221e+03 },
+    { +2.750000e+02, +9.996116e-04, +2.834316e+01, -2.582938e+01, +7.768540e+03, +8.768151e+03, +9.737822e+02, +4.208708e+03, +4.209269e+03, +1.000389e+03, +3.197729e-02, +5.009596e-07, -1.694639e-02, -3.495026e-09, -1.150960e-15, +1.000000e+06, -6.383208e+04, +1.996169e+06, +3.294654e+04, +1.363385e+04, +9.154868e+03 },
+    { +2.800000e+02, +9.996526e-04, +1.040733e+02, -3.575701e+02, +2.878296e+04, +2.978262e+04, +6.420825e+02, +4.196034e+03, +4.197274e+03, +1.000348e+03, -4.637401e-02, +4.852724e-07, -1.451172e-02, -2.807303e-09, -1.072453e-15, +1.000000e+06, +9.556284e+04, +2.060698e+06, +3.103013e+04, +1.235636e+04, +9.384722e+03 },
+    { +2.850000e+02, +1.000058e-03, +1.782865e+02, -1.064482e+03, +4.974717e+04, +5.074723e+04, -6.442452e+01, +4.181249e+03, +4.189102e+03, +9.999425e+02, -1.141124e-01, +4.726565e-07, -1.266410e-02, -2.258370e-09, -1.019173e-15, +1.000000e+06, +2.414277e+05, +2.115701e+06, +2.922623e+04, +1.121030e+04, +9.651862e+03 },
+    { +2.900000e+02, +1.000781e-03, +2.510916e+02, -2.139218e+03, +7.067736e+04, +7.167814e+04, -1.138437e+03, +4.164698e+03, +4.183643e+03, +9.992200e+02, -1.736926e-01, +4.625240e-07, -1.122512e-02, -1.808682e-09, -9.836872e-16, +1.000000e+06, +3.755322e+05, +2.162050e+06, +2.750620e+04, +1.018139e+04, +9.941552e+03 },
+    { +2.950000e+02, +1.001787e-03, +3.225765e+02, -3.574928e+03, +9.158514e+04, +9.258693e+04, -2.573141e+03, +4.146626e+03, +4.180151e+03, +9.982162e+02, -2.268519e-01, +4.544479e-07, -1.008038e-02, -1.432317e-09, -9.612496e-16, +1.000000e+06, +4.991813e+05, +2.200472e+06, +2.585527e+04, +9.258802e+03, +1.024198e+04 },
+    { +3.000000e+02, +1.003049e-03, +3.928139e+02, -5.365173e+03, +1.124790e+05, +1.134820e+05, -4.362123e+03, +4.127217e+03, +4.178104e+03, +9.969600e+02, -2.748585e-01, +4.481084e-07, -9.153636e-03, -1.111570e-09, -9.487714e-16, +1.000000e+06, +6.133749e+05, +2.231603e+06, +2.426692e+04, +8.433830e+03, +1.054417e+04 },
+    { +3.050000e+02, +1.004546e-03, +4.618657e+02, -7.503851e+03, +1.333652e+05, +1.343697e+05, -6.499305e+03, +4.106622e+03, +4.177131e+03, +9.954746e+02, -3.186632e-01, +4.432606e-07, -8.392363e-03, -8.338973e-10, -9.442047e-16, +1.000000e+06, +7.189072e+05, +2.256009e+06, +2.273909e+04, +7.698968e+03, +1.084149e+04 },
+    { +3.100000e+02, +1.006260e-03, +5.297858e+02, -9.985155e+03, +1.542485e+05, +1.552547e+05, -8.978895e+03, +4.084972e+03, +4.176973e+03, +9.937792e+02, -3.589953e-01, +4.397131e-07, -7.759327e-03, -5.901101e-10, -9.461720e-16, +1.000000e+06, +8.164307e+05, +2.274210e+06, +2.127199e+04, +7.047379e+03, +1.112915e+04 },
+    { +3.150000e+02, +1.008177e-03, +5.966219e+02, -1.280353e+04, +1.751324e+05, +1.761405e+05, -1.179536e+04, +4.062390e+03, +4.177447e+03, +9.918895e+02, -3.964248e-01, +4.373146e-07, -7.227508e-03, -3.732875e-10, -9.537384e-16, +1.000000e+06, +9.064979e+05, +2.286683e+06, +1.986670e+04, +6.472615e+03, +1.140374e+04 },
+    { +3.200000e+02, +1.010286e-03, +6.624169e+02, -1.595366e+04, +1.960197e+05, +1.970300e+05, -1.494338e+04, +4.038992e+03, +4.178430e+03, +9.898190e+02, -4.314054e-01, +4.359443e-07, -6.776894e-03, -1.780857e-10, -9.662709e-16, +1.000000e+06, +9.895885e+05, +2.293871e+06, +1.852441e+04, +5.968491e+03, +1.166289e+04 },
+    { +3.250000e+02, +1.012577e-03, +7.272104e+02, -1.943043e+04, +2.169130e+05, +2.179255e+05, -1.841786e+04, +4.014893e+03, +4.179843e+03, +9.875789e+02, -4.643038e-01, +4.355048e-07, -6.392410e-03, -2.897268e-13, -9.833477e-16, +1.000000e+06, +1.066128e+06, +2.296186e+06, +1.724603e+04, +5.529049e+03, +1.190497e+04 },
+    { +3.300000e+02, +1.015044e-03, +7.910393e+02, -2.322892e+04, +2.378141e+05, +2.388291e+05, -2.221388e+04, +3.990204e+03, +4.181642e+03, +9.851789e+02, -4.954204e-01, +4.359180e-07, -6.062535e-03, +1.634885e-10, -1.004701e-15, +1.000000e+06, +1.136499e+06, +2.294009e+06, +1.603198e+04, +5.148564e+03, +1.212893e+04 },
+    { +3.350000e+02, +1.017680e-03, +8.539381e+02, -2.734438e+04, +2.587249e+05, +2.597426e+05, -2.632670e+04, +3.965032e+03, +4.183805e+03, +9.826273e+02, -5.250052e-01, +4.371210e-07, -5.778355e-03, +3.160196e-10, -1.030180e-15, +1.000000e+06, +1.201052e+06, +2.287696e+06, +1.488216e+04, +4.821570e+03, +1.233412e+04 },
+    { +3.400000e+02, +1.020480e-03, +9.159397e+02, -3.177224e+04, +2.796473e+05, +2.806677e+05, -3.075176e+04, +3.939479e+03, +4.186329e+03, +9.799311e+02, -5.532684e-01, +4.390633e-07, -5.532899e-03, +4.596064e-10, -1.059723e-15, +1.000000e+06, +1.260111e+06, +2.277576e+06, +1.379596e+04, +4.542885e+03, +1.252019e+04 },
+    { +3.450000e+02, +1.023440e-03, +9.770757e+02, -3.650809e+04, +3.005830e+05, +3.016065e+05, -3.548465e+04, +3.913642e+03, +4.189224e+03, +9.770965e+02, -5.803895e-01, +4.417054e-07, -5.320669e-03, +5.961931e-10, -1.093346e-15, +1.000000e+06, +1.313974e+06, +2.263952e+06, +1.277231e+04, +4.307633e+03, +1.268701e+04 },
+    { +3.500000e+02, +1.026558e-03, +1.037376e+03, -4.154768e+04, +3.215341e+05, +3.225606e+05, -4.052113e+04, +3.887612e+03, +4.192509e+03, +9.741288e+02, -6.065231e-01, +4.450164e-07, -5.137295e-03, +7.274468e-10, -1.131127e-15, +1.000000e+06, +1.362923e+06, +2.247108e+06, +1.180973e+04, +4.111261e+03, +1.283463e+04 },
+    { +3.550000e+02, +1.029831e-03, +1.096871e+03, -4.688691e+04, +3.425024e+05, +3.435323e+05, -4.585708e+04, +3.861470e+03, +4.196209e+03, +9.710327e+02, -6.318046e-01, +4.489734e-07, -4.979287e-03, +8.548208e-10, -1.173205e-15, +1.000000e+06, +1.407221e+06, +2.227303e+06, +1.090645e+04, +3.949540e+03, +1.296319e+04 },
+    { +3.600000e+02, +1.033259e-03, +1.155589e+03, -5.252180e+04, +3.634902e+05, +3.645235e+05, -5.148854e+04, +3.835295e+03, +4.200352e+03, +9.678120e+02, -6.563536e-01, +4.535603e-07, -4.843842e-03, +9.796028e-10, -1.219770e-15, +1.000000e+06, +1.447114e+06, +2.204779e+06, +1.006044e+04, +3.818570e+03, +1.307293e+04 },
+    { +3.650000e+02, +1.036839e-03, +1.213557e+03, -5.844855e+04, +3.844997e+05, +3.855366e+05, -5.741172e+04, +3.809154e+03, +4.204971e+03, +9.644702e+02, -6.802769e-01, +4.587670e-07, -4.728707e-03, +1.102954e-09, -1.271071e-15, +1.000000e+06, +1.482837e+06, +2.179756e+06, +9.269504e+03, +3.714769e+03, +1.316416e+04 },
+    { +3.700000e+02, +1.040572e-03, +1.270803e+03, -6.466348e+04, +4.055335e+05, +4.065740e+05, -6.362291e+04, +3.783109e+03, +4.210098e+03, +9.610101e+02, -7.036715e-01, +4.645892e-07, -4.632070e-03, +1.225942e-09, -1.327406e-15, +1.000000e+06, +1.514610e+06, +2.152439e+06, +8.531300e+03, +3.634864e+03, +1.323721e+04 },
+    { +3.750000e+02, +1.044458e-03, +1.327352e+03, -7.116304e+04, +4.265940e+05, +4.276385e+05, -7.011858e+04, +3.757216e+03, +4.215768e+03, +9.574342e+02, -7.266260e-01, +4.710275e-07, -4.552480e-03, +1.349564e-09, -1.389133e-15, +1.000000e+06, +1.542640e+06, +2.123018e+06, +7.843428e+03, +3.575876e+03, +1.329245e+04 },
+    { +3.800000e+02, +1.048499e-03, +1.383232e+03, -7.794381e+04, +4.476842e+05, +4.487327e+05, -7.689531e+04, +3.731521e+03, +4.222015e+03, +9.537444e+02, -7.492227e-01, +4.780875e-07, -4.488785e-03, +1.474775e-09, -1.456671e-15, +1.000000e+06, +1.567125e+06, +2.091667e+06, +7.203452e+03, +3.535101e+03, +1.333028e+04 },
+    { +3.850000e+02, +1.052695e-03, +1.438466e+03, -8.500252e+04, +4.688069e+05, +4.698596e+05, -8.394982e+04, +3.706066e+03, +4.228875e+03, +9.499424e+02, -7.715388e-01, +4.857795e-07, -4.440082e-03, +1.602504e-09, -1.530504e-15, +1.000000e+06, +1.588249e+06, +2.058547e+06, +6.608931e+03, +3.510095e+03, +1.335110e+04 },
+    { +3.900000e+02, +1.057050e-03, +1.493081e+03, -9.233599e+04, +4.899654e+05, +4.910225e+05, -9.127894e+04, +3.680888e+03, +4.236383e+03, +9.460294e+02, -7.936474e-01, +4.941183e-07, -4.405683e-03, +1.733670e-09, -1.611190e-15, +1.000000e+06, +1.606189e+06, +2.023807e+06, +6.057453e+03, +3.498653e+03, +1.335531e+04 },
+    { +3.950000e+02, +1.061564e-03, +1.547099e+03, -9.994120e+04, +5.111630e+05, +5.122246e+05, -9.887963e+04, +3.656018e+03, +4.244576e+03, +9.420062e+02, -8.156186e-01, +5.031235e-07, -4.385088e-03, +1.869206e-09, -1.699370e-15, +1.000000e+06, +1.621110e+06, +1.987584e+06, +5.546653e+03, +3.498790e+03, +1.334333e+04 },
+    { +4.000000e+02, +1.066242e-03, +1.600546e+03, -1.078152e+05, +5.324032e+05, +5.334695e+05, -1.067490e+05, +3.631480e+03, +4.253492e+03, +9.378733e+02, -8.375207e-01, +5.128192e-07, -4.377962e-03, +2.010070e-09, -1.795776e-15, +1.000000e+06, +1.633169e+06, +1.950005e+06, +5.074229e+03, +3.508724e+03, +1.331556e+04 },
+    { +4.100000e+02, +1.076103e-03, +1.705817e+03, -1.243587e+05, +5.750264e+05, +5.761025e+05, -1.232825e+05, +3.583487e+03, +4.273650e+03, +9.292790e+02, -8.813840e-01, +5.344042e-07, -4.403540e-03, +2.311853e-09, -2.016749e-15, +1.000000e+06, +1.649284e+06, +1.871243e+06, +4.235690e+03, +3.551756e+03, +1.321424e+04 },
+    { +4.200000e+02, +1.086668e-03, +1.809077e+03, -1.419453e+05, +6.178671e+05, +6.189538e+05, -1.408586e+05, +3.537038e+03, +4.297198e+03, +9.202439e+02, -9.257698e-01, +5.591703e-07, -4.482676e-03, +2.647887e-09, -2.282406e-15, +1.000000e+06, +1.655613e+06, +1.788364e+06, +3.525086e+03, +3.616880e+03, +1.305451e+04 },
+    { +4.300000e+02, +1.097984e-03, +1.910505e+03, -1.605560e+05, +6.609611e+05, +6.620590e+05, -1.594580e+05, +3.492216e+03, +4.324523e+03, +9.107601e+02, -9.712242e-01, +5.875109e-07, -4.617884e-03, +3.028684e-09, -2.603707e-15, +1.000000e+06, +1.653117e+06, +1.702096e+06, +2.927170e+03, +3.695429e+03, +1.283939e+04 },
+    { +4.400000e+02, +1.110107e-03, +2.010276e+03, -1.801733e+05, +7.043482e+05, +7.054583e+05, -1.790632e+05, +3.449070e+03, +4.356082e+03, +9.008139e+02, -1.018331e+00, +6.199360e-07, -4.814120e-03, +3.467226e-09, -2.995278e-15, +1.000000e+06, +1.642638e+06, +1.613070e+06, +2.428256e+03, +3.780519e+03, +1.257177e+04 },
+    { +4.500000e+02, +1.123109e-03, +2.108567e+03, -2.007817e+05, +7.480735e+05, +7.491966e+05, -1.996586e+05, +3.407627e+03, +4.392432e+03, +8.903858e+02, -1.067736e+00, +6.571026e-07, -5.079250e-03, +3.980101e-09, -3.476908e-15, +1.000000e+06, +1.624915e+06, +1.521832e+06, +2.016193e+03, +3.866698e+03, +1.225444e+04 },
+    { +4.530280e+02, +1.127231e-03, +2.138064e+03, -2.072152e+05, +7.613878e+05, +7.625150e+05, -2.060880e+05, +3.395416e+03, +4.404484e+03, +8.871293e+02, -1.083259e+00, +6.694141e-07, -5.174760e-03, +4.153192e-09, -3.644380e-15, +1.000000e+06, +1.618219e+06, +1.493844e+06, +1.906896e+03, +3.892330e+03, +1.214896e+04 },
+    { +4.530280e+02, +1.127231e-03, +2.138064e+03, -2.072152e+05, +7.613878e+05, +7.625150e+05, -2.060880e+05, +3.395416e+03, +4.404484e+03, +8.871293e+02, -1.083259e+00, +6.694141e-07, -5.174760e-03, +4.153192e-09, -3.644380e-15, +1.000000e+06, +1.618219e+06, +1.493844e+06, +1.906896e+03, +3.892330e+03, +1.214896e+04 },
+    { +4.600000e+02, +1.985058e-01, +6.625276e+03, -4.506464e+05, +2.596980e+06, +2.795486e+06, -2.521406e+05, +1.838709e+03, +2.572612e+03, +5.037636e+00, -1.483980e-02, +5.439041e-06, +1.486436e-04, -2.208693e-08, +1.006583e-12, +1.000000e+06, +2.728386e+03, +1.838559e+05, -6.547727e+00, +6.537698e+02, -6.255797e+03 },
+    { +4.700000e+02, +2.042490e-01, +6.679235e+03, -5.229153e+05, +2.616325e+06, +2.820574e+06, -3.186662e+05, +1.767721e+03, +2.455121e+03, +4.895984e+00, -1.354811e-02, +5.235582e-06, +1.136516e-04, -1.886836e-08, +8.133415e-13, +1.000000e+06, +2.587698e+03, +1.910007e+05, -4.096320e+00, +6.115604e+02, -5.667323e+03 },
+    { +4.800000e+02, +2.098277e-01, +6.730076e+03, -5.955428e+05, +2.634894e+06, +2.844721e+06, -3.857150e+05, +1.723941e+03, +2.378746e+03, +4.765814e+00, -1.251911e-02, +5.058264e-06, +9.359910e-05, -1.670882e-08, +6.817433e-13, +1.000000e+06, +2.474981e+03, +1.976963e+05, -2.978708e+00, +5.870985e+02, -5.267644e+03 },
+    { +4.900000e+02, +2.152828e-01, +6.778522e+03, -6.685426e+05, +2.652933e+06, +2.868216e+06, -4.532598e+05, +1.693026e+03, +2.322741e+03, +4.645054e+00, -1.165602e-02, +4.899718e-06, +7.973495e-05, -1.506498e-08, +5.823527e-13, +1.000000e+06, +2.378917e+03, +2.040934e+05, -2.317264e+00, +5.698123e+02, -4.950772e+03 },
+    { +5.000000e+02, +2.206388e-01, +6.824994e+03, -7.419177e+05, +2.670579e+06, +2.891218e+06, -5.212789e+05, +1.669924e+03, +2.279478e+03, +4.532294e+00, -1.091330e-02, +4.755912e-06, +6.924779e-05, -1.373972e-08, +5.036278e-13, +1.000000e+06, +2.294682e+03, +2.102646e+05, -1.859392e+00, +5.563564e+02, -4.681751e+03 },
+    { +5.100000e+02, +2.259133e-01, +6.869784e+03, -8.156673e+05, +2.687922e+06, +2.913836e+06, -5.897541e+05, +1.652332e+03, +2.245306e+03, +4.426478e+00, -1.026380e-02, +4.624180e-06, +6.095646e-05, -1.263851e-08, +4.396494e-13, +1.000000e+06, +2.219593e+03, +2.162545e+05, -1.517620e+00, +5.454165e+02, -4.446335e+03 },
+    { +5.200000e+02, +2.311193e-01, +6.913110e+03, -8.897890e+05, +2.705028e+06, +2.936147e+06, -6.586697e+05, +1.638922e+03, +2.218045e+03, +4.326770e+00, -9.688986e-03, +4.502583e-06, +5.422881e-05, -1.170536e-08, +3.867657e-13, +1.000000e+06, +2.151873e+03, +2.220947e+05, -1.253253e+00, +5.363266e+02, -4.237041e+03 },
+    { +5.300000e+02, +2.362673e-01, +6.955145e+03, -9.642793e+05, +2.721947e+06, +2.958215e+06, -7.280120e+05, +1.628795e+03, +2.196208e+03, +4.232495e+00, -9.175345e-03, +4.389639e-06, +4.866850e-05, -1.090281e-08, +3.424820e-13, +1.000000e+06, +2.090228e+03, +2.278092e+05, -1.044758e+00, +5.286720e+02, -4.049033e+03 },
+    { +5.400000e+02, +2.413655e-01, +6.996027e+03, -1.039134e+06, +2.738720e+06, +2.980086e+06, -7.977687e+05, +1.621294e+03, +2.178705e+03, +4.143093e+00, -8.712636e-03, +4.284182e-06, +4.400464e-05, -1.020413e-08, +3.049994e-13, +1.000000e+06, +2.033676e+03, +2.334168e+05, -8.781855e-01, +5.221611e+02, -3.878782e+03 },
+    { +5.500000e+02, +2.464208e-01, +7.035872e+03, -1.114350e+06, +2.755380e+06, +3.001800e+06, -8.679291e+05, +1.615917e+03, +2.164709e+03, +4.058099e+00, -8.292916e-03, +4.185277e-06, +4.004328e-05, -9.589518e-09, +2.729790e-13, +1.000000e+06, +1.981450e+03, +2.389328e+05, -7.437367e-01, +5.165759e+02, -3.723546e+03 },
+    { +5.600000e+02, +2.514387e-01, +7.074773e+03, -1.189922e+06, +2.771951e+06, +3.023390e+06, -9.384830e+05, +1.612277e+03, +2.153583e+03, +3.977113e+00, -7.909909e-03, +4.092161e-06, +3.664151e-05, -9.043981e-09, +2.454026e-13, +1.000000e+06, +1.932941e+03, +2.443696e+05, -6.342442e-01, +5.117486e+02, -3.581136e+03 },
+    { +5.700000e+02, +2.564237e-01, +7.112810e+03, -1.265845e+06, +2.788456e+06, +3.044880e+06, -1.009422e+06, +1.610069e+03, +2.144824e+03, +3.899795e+00, -7.558581e-03, +4.004206e-06, +3.369185e-05, -8.555928e-09, +2.214826e-13, +1.000000e+06, +1.887661e+03, +2.497374e+05, -5.443467e-01, +5.075474e+02, -3.449772e+03 },
+    { +5.800000e+02, +2.613799e-01, +7.150051e+03, -1.342116e+06, +2.804913e+06, +3.066293e+06, -1.080737e+06, +1.609049e+03, +2.138037e+03, +3.825849e+00, -7.234841e-03, +3.920882e-06, +3.111212e-05, -8.116270e-09, +2.006012e-13, +1.000000e+06, +1.845208e+03, +2.550447e+05, -4.699764e-01, +5.038679e+02, -3.327992e+03 },
+    { +5.900000e+02, +2.663103e-01, +7.186553e+03, -1.418731e+06, +2.821336e+06, +3.087646e+06, -1.152420e+06, +1.609023e+03, +2.132904e+03, +3.755018e+00, -6.935320e-03, +3.841743e-06, +2.883857e-05, -7.717778e-09, +1.822677e-13, +1.000000e+06, +1.805253e+03, +2.602985e+05, -4.080130e-01, +5.006262e+02, -3.214584e+03 },
+    { +6.000000e+02, +2.712179e-01, +7.222368e+03, -1.495683e+06, +2.837738e+06, +3.108955e+06, -1.224465e+06, +1.609836e+03, +2.129169e+03, +3.687072e+00, -6.657217e-03, +3.766409e-06, +2.682109e-05, -7.354631e-09, +1.660880e-13, +1.000000e+06, +1.767524e+03, +2.655049e+05, -3.560410e-01, +4.977548e+02, -3.108537e+03 },
+    { +6.100000e+02, +2.761051e-01, +7.257539e+03, -1.572970e+06, +2.854128e+06, +3.130234e+06, -1.296865e+06, +1.611360e+03, +2.126624e+03, +3.621810e+00, -6.398178e-03, +3.694549e-06, +2.501981e-05, -7.022091e-09, +1.517422e-13, +1.000000e+06, +1.731789e+03, +2.706691e+05, -3.121748e-01, +4.951984e+02, -3.009001e+03 },
+    { +6.200000e+02, +2.809738e-01, +7.292106e+03, -1.650588e+06, +2.870518e+06, +3.151491e+06, -1.369614e+06, +1.613492e+03, +2.125099e+03, +3.559051e+00, -6.156207e-03, +3.625878e-06, +2.340269e-05, -6.716256e-09, +1.389685e-13, +1.000000e+06, +1.697853e+03, +2.757953e+05, -2.749307e-01, +4.929119e+02, -2.915257e+03 },
+    { +6.300000e+02, +2.858258e-01, +7.326102e+03, -1.728531e+06, +2.886913e+06, +3.172738e+06, -1.442706e+06, +1.616145e+03, +2.124453e+03, +3.498634e+00, -5.929598e-03, +3.560145e-06, +2.194367e-05, -6.433887e-09, +1.275504e-13, +1.000000e+06, +1.665549e+03, +2.808874e+05, -2.431331e-01, +4.908579e+02, -2.826693e+03 },
+    { +6.400000e+02, +2.906628e-01, +7.359558e+03, -1.806797e+06, +2.903320e+06, +3.193983e+06, -1.516134e+06, +1.619251e+03, +2.124569e+03, +3.440413e+00, -5.716879e-03, +3.497131e-06, +2.062137e-05, -6.172266e-09, +1.173079e-13, +1.000000e+06, +1.634734e+03, +2.859487e+05, -2.158431e-01, +4.890053e+02, -2.742785e+03 },
+    { +6.500000e+02, +2.954860e-01, +7.392503e+03, -1.885381e+06, +2.919746e+06, +3.215232e+06, -1.589895e+06, +1.622750e+03, +2.125351e+03, +3.384255e+00, -5.516774e-03, +3.436639e-06, +1.941809e-05, -5.929098e-09, +1.080901e-13, +1.000000e+06, +1.605282e+03, +2.909820e+05, -1.923067e-01, +4.873282e+02, -2.663081e+03 },
+    { +6.750000e+02, +3.074917e-01, +7.472787e+03, -2.083209e+06, +2.960922e+06, +3.268414e+06, -1.775717e+06, +1.632914e+03, +2.129713e+03, +3.252120e+00, -5.064717e-03, +3.295341e-06, +1.683938e-05, -5.389749e-09, +8.873870e-14, +1.000000e+06, +1.536932e+03, +3.034587e+05, -1.461568e-01, +4.837675e+02, -2.479773e+03 },
+    { +7.000000e+02, +3.194342e-01, +7.550360e+03, -2.282946e+06, +3.002306e+06, +3.321740e+06, -1.963512e+06, +1.644672e+03, +2.136785e+03, +3.130535e+00, -4.670796e-03, +3.166486e-06, +1.474351e-05, -4.930395e-09, +7.351693e-14, +1.000000e+06, +1.475072e+03, +3.158074e+05, -1.130886e-01, +4.809142e+02, -2.315552e+03 },
+    { +7.250000e+02, +3.313250e-01, +7.625497e+03, -2.484540e+06, +3.043945e+06, +3.375270e+06, -2.153215e+06, +1.657633e+03, +2.145907e+03, +3.018184e+00, -4.324512e-03, +3.048297e-06, +1.301233e-05, -4.534189e-09, +6.137657e-14, +1.000000e+06, +1.418665e+03, +3.280521e+05, -8.885838e-02, +4.785904e+02, -2.166861e+03 },
+    { +7.500000e+02, +3.431732e-01, +7.698423e+03, -2.687941e+06, +3.085876e+06, +3.429049e+06, -2.344768e+06, +1.671530e+03, +2.156618e+03, +2.913980e+00, -4.017836e-03, +2.939354e-06, +1.156319e-05, -4.188852e-09, +5.157907e-14, +1.000000e+06, +1.366911e+03, +3.402108e+05, -7.075887e-02, +4.766716e+02, -2.031037e+03 },
+    { +7.750000e+02, +3.549857e-01, +7.769330e+03, -2.893105e+06, +3.128126e+06, +3.483111e+06, -2.538119e+06, +1.686168e+03, +2.168584e+03, +2.817015e+00, -3.744502e-03, +2.838507e-06, +1.033650e-05, -3.885189e-09, +4.359142e-14, +1.000000e+06, +1.319180e+03, +3.522979e+05, -5.701140e-02, +4.750683e+02, -1.906036e+03 },
+    { +8.000000e+02, +3.667680e-01, +7.838382e+03, -3.099987e+06, +3.170718e+06, +3.537486e+06, -2.733219e+06, +1.701402e+03, +2.181555e+03, +2.726519e+00, -3.499528e-03, +2.744806e-06, +9.288140e-06, -3.616149e-09, +3.702116e-14, +1.000000e+06, +1.274963e+03, +3.643244e+05, -4.641625e-02, +4.737147e+02, -1.790255e+03 },
+    { +8.250000e+02, +3.785246e-01, +7.905721e+03, -3.308549e+06, +3.213671e+06, +3.592196e+06, -2.930024e+06, +1.717120e+03, +2.195342e+03, +2.641836e+00, -3.278889e-03, +2.657457e-06, +8.384770e-06, -3.376223e-09, +3.157417e-14, +1.000000e+06, +1.233845e+03, +3.762995e+05, -3.814515e-02, +4.725613e+02, -1.682414e+03 },
+    { +8.500000e+02, +3.902592e-01, +7.971472e+03, -3.518751e+06, +3.257000e+06, +3.647259e+06, -3.128492e+06, +1.733231e+03, +2.209792e+03, +2.562399e+00, -3.079297e-03, +2.575789e-06, +7.600693e-06, -3.161034e-09, +2.702674e-14, +1.000000e+06, +1.195477e+03, +3.882305e+05, -3.161431e-02, +4.715705e+02, -1.581476e+03 },
+    { +9.000000e+02, +4.136737e-01, +8.098633e+03, -3.943941e+06, +3.344828e+06, +3.758502e+06, -3.530268e+06, +1.766347e+03, +2.240216e+03, +2.417364e+00, -2.732815e-03, +2.427284e-06, +6.314106e-06, -2.791397e-09, +1.997883e-14, +1.000000e+06, +1.125873e+03, +4.119831e+05, -2.221041e-02, +4.699662e+02, -1.397038e+03 },
+    { +9.500000e+02, +4.370299e-01, +8.220603e+03, -4.375299e+06, +3.434274e+06, +3.871304e+06, -3.938269e+06, +1.800267e+03, +2.272072e+03, +2.288173e+00, -2.443175e-03, +2.295583e-06, +5.311459e-06, -2.485950e-09, +1.489941e-14, +1.000000e+06, +1.064294e+03, +4.356191e+05, -1.601933e-02, +4.687347e+02, -1.231657e+03 },
+    { +1.000000e+03, +4.603408e-01, +8.337975e+03, -4.812592e+06, +3.525383e+06, +3.985723e+06, -4.352252e+06, +1.834612e+03, +2.304803e+03, +2.172304e+00, -2.198229e-03, +2.177867e-06, +4.515963e-06, -2.229952e-09, +1.117223e-14, +1.000000e+06, +1.009350e+03, +4.591648e+05, -1.182009e-02, +4.677685e+02, -1.081548e+03 },
+    { +1.050000e+03, +4.836161e-01, +8.451228e+03, -5.255614e+06, +3.618176e+06, +4.101792e+06, -4.771998e+06, +1.869072e+03, +2.337979e+03, +2.067756e+00, -1.989008e-03, +2.071941e-06, +3.875257e-06, -2.012848e-09, +8.395814e-15, +1.000000e+06, +9.599729e+02, +4.826391e+05, -8.898115e-03, +4.669963e+02, -9.439096e+02 },
+    { +1.100000e+03, +5.068627e-01, +8.560759e+03, -5.704175e+06, +3.712660e+06, +4.219523e+06, -5.197312e+06, +1.903387e+03, +2.371258e+03, +1.972921e+00, -1.808743e-03, +1.976065e-06, +3.352540e-06, -1.826861e-09, +6.301204e-15, +1.000000e+06, +9.153255e+02, +5.060563e+05, -6.818954e-03, +4.663690e+02, -8.166199e+02 },
+    { +1.150000e+03, +5.300860e-01, +8.666897e+03, -6.158103e+06, +3.808829e+06, +4.338915e+06, -5.628017e+06, +1.937341e+03, +2.404365e+03, +1.886486e+00, -1.652233e-03, +1.888835e-06, +2.921287e-06, -1.666134e-09, +4.703931e-15, +1.000000e+06, +8.747365e+02, +5.294269e+05, -5.309888e-03, +4.658520e+02, -6.980376e+02 },
+    { +1.200000e+03, +5.532901e-01, +8.769919e+03, -6.617240e+06, +3.906663e+06, +4.459953e+06, -6.063950e+06, +1.970754e+03, +2.437078e+03, +1.807370e+00, -1.515418e-03, +1.809106e-06, +2.561976e-06, -1.526169e-09, +3.474843e-15, +1.000000e+06, +8.376610e+02, +5.527592e+05, -4.194946e-03, +4.654205e+02, -5.868717e+02 },
+    { +1.250000e+03, +5.764784e-01, +8.870059e+03, -7.081440e+06, +4.006135e+06, +4.582613e+06, -6.504961e+06, +2.003483e+03, +2.469223e+03, +1.734670e+00, -1.395082e-03, +1.735931e-06, +2.259973e-06, -1.403453e-09, +2.521893e-15, +1.000000e+06, +8.036507e+02, +5.760597e+05, -3.357827e-03, +4.650562e+02, -4.820913e+02 },
+    { +1.273000e+03, +5.871404e-01, +8.915213e+03, -7.296633e+06, +4.052432e+06, +4.639573e+06, -6.709493e+06, +2.018275e+03, +2.483778e+03, +1.703170e+00, -1.344533e-03, +1.704249e-06, +2.137125e-06, -1.352008e-09, +2.157183e-15, +1.000000e+06, +7.889302e+02, +5.867688e+05, -3.043402e-03, +4.649073e+02, -4.358008e+02 },
+    // P = 2.0 MPa
+    { +2.730120e+02, +9.992022e-04, -2.153598e+00, +8.454704e-01, -5.871127e+02, +1.411292e+03, +1.999250e+03, +4.208394e+03, +4.210529e+03, +1.000798e+03, +6.301631e-02, +5.070353e-07, -1.796524e-02, -3.797860e-09, -1.187722e-15, +2.000000e+06, -1.242839e+05, +1.972249e+06, +3.360627e+04, +1.419860e+04, +9.111717e+03 },
+    { +2.750000e+02, +9.991118e-04, +2.837335e+01, -2.507990e+01, +7.777593e+03, +9.775816e+03, +1.973144e+03, +4.204189e+03, +4.204635e+03, +1.000889e+03, +2.849171e-02, +4.998105e-07, -1.679203e-02, -3.476140e-09, -1.147212e-15, +2.000000e+06, -5.700503e+04, +2.000758e+06, +3.281131e+04, +1.365332e+04, +9.188136e+03 },
+    { +2.800000e+02, +9.991684e-04, +1.040256e+02, -3.568439e+02, +2.877033e+04, +3.076867e+04, +1.641493e+03, +4.191835e+03, +4.193231e+03, +1.000832e+03, -4.917488e-02, +4.842017e-07, -1.439018e-02, -2.794444e-09, -1.068915e-15, +2.000000e+06, +1.015587e+05, +2.065255e+06, +3.091439e+04, +1.238211e+04, +9.415954e+03 },
+    { +2.850000e+02, +9.995855e-04, +1.781713e+02, -1.063774e+03, +4.971505e+04, +5.171422e+04, +9.353969e+02, +4.177324e+03, +4.185500e+03, +1.000415e+03, -1.163664e-01, +4.716390e-07, -1.256563e-02, -2.249687e-09, -1.015692e-15, +2.000000e+06, +2.467277e+05, +2.120265e+06, +2.912732e+04, +1.124010e+04, +9.681275e+03 },
+    { +2.900000e+02, +1.000318e-03, +2.509168e+02, -2.138524e+03, +7.062736e+04, +7.262800e+04, -1.378877e+02, +4.161014e+03, +4.180379e+03, +9.996820e+02, -1.754985e-01, +4.615421e-07, -1.114347e-02, -1.803006e-09, -9.801568e-16, +2.000000e+06, +3.802437e+05, +2.166650e+06, +2.742187e+04, +1.021356e+04, +9.969229e+03 },
+    { +2.950000e+02, +1.001332e-03, +3.223482e+02, -3.574245e+03, +9.151848e+04, +9.352114e+04, -1.571582e+03, +4.143157e+03, +4.177148e+03, +9.986702e+02, -2.282825e-01, +4.534885e-07, -1.001135e-02, -1.428893e-09, -9.575991e-16, +2.000000e+06, +5.033921e+05, +2.205128e+06, +2.578367e+04, +9.292117e+03, +1.026798e+04 },
+    { +3.000000e+02, +1.002599e-03, +3.925369e+02, -5.364497e+03, +1.123966e+05, +1.144018e+05, -3.359299e+03, +4.123944e+03, +4.175305e+03, +9.974077e+02, -2.759692e-01, +4.471616e-07, -9.094304e-03, -1.109902e-09, -9.449506e-16, +2.000000e+06, +6.171577e+05, +2.236328e+06, +2.420644e+04, +8.467397e+03, +1.056856e+04 },
+    { +3.050000e+02, +1.004099e-03, +4.615439e+02, -7.503181e+03, +1.332677e+05, +1.352759e+05, -5.494982e+03, +4.103528e+03, +4.174494e+03, +9.959174e+02, -3.194970e-01, +4.423184e-07, -8.340609e-03, -8.336522e-10, -9.401755e-16, +2.000000e+06, +7.223235e+05, +2.260815e+06, +2.268836e+04, +7.732161e+03, +1.086435e+04 },
+    { +3.100000e+02, +1.005815e-03, +5.294222e+02, -9.984488e+03, +1.541364e+05, +1.561480e+05, -7.972858e+03, +4.082044e+03, +4.174464e+03, +9.942184e+02, -3.595859e-01, +4.387691e-07, -7.713578e-03, -5.910634e-10, -9.419030e-16, +2.000000e+06, +8.195333e+05, +2.279103e+06, +2.122981e+04, +7.079765e+03, +1.115060e+04 },
+    { +3.150000e+02, +1.007733e-03, +5.962189e+02, -1.280287e+04, +1.750061e+05, +1.770216e+05, -1.078740e+04, +4.059615e+03, +4.175039e+03, +9.923264e+02, -3.967991e-01, +4.363632e-07, -7.186561e-03, -3.752863e-10, -9.492013e-16, +2.000000e+06, +9.093322e+05, +2.291669e+06, +1.983202e+04, +6.503898e+03, +1.142389e+04 },
+    { +3.200000e+02, +1.009841e-03, +6.619767e+02, -1.595300e+04, +1.958795e+05, +1.978992e+05, -1.393332e+04, +4.036361e+03, +4.176100e+03, +9.902545e+02, -4.315850e-01, +4.349804e-07, -6.739810e-03, -1.810268e-10, -9.614378e-16, +2.000000e+06, +9.921941e+05, +2.298954e+06, +1.849629e+04, +5.998477e+03, +1.168186e+04 },
+    { +3.250000e+02, +1.012131e-03, +7.267346e+02, -1.942977e+04, +2.167590e+05, +2.187832e+05, -1.740550e+04, +4.012396e+03, +4.177574e+03, +9.880139e+02, -4.643060e-01, +4.345240e-07, -6.358439e-03, -4.105537e-12, -9.781901e-16, +2.000000e+06, +1.068539e+06, +2.301369e+06, +1.722364e+04, +5.557617e+03, +1.192290e+04 },
+    { +3.300000e+02, +1.014596e-03, +7.905292e+02, -2.322825e+04, +2.376464e+05, +2.396756e+05, -2.119906e+04, +3.987833e+03, +4.179418e+03, +9.856143e+02, -4.952592e-01, +4.349161e-07, -6.031070e-03, +1.588391e-10, -9.991886e-16, +2.000000e+06, +1.138747e+06, +2.299294e+06, +1.601460e+04, +5.175644e+03, +1.214594e+04 },
+    { +3.350000e+02, +1.017228e-03, +8.533948e+02, -2.734370e+04, +2.585435e+05, +2.605780e+05, -2.530925e+04, +3.962780e+03, +4.181612e+03, +9.830639e+02, -5.246919e-01, +4.360938e-07, -5.748894e-03, +3.105575e-10, -1.024279e-15, +2.000000e+06, +1.203163e+06, +2.293085e+06, +1.486914e+04, +4.847132e+03, +1.235033e+04 },
+    { +3.400000e+02, +1.020023e-03, +9.153641e+02, -3.177156e+04, +2.794522e+05, +2.814923e+05, -2.973151e+04, +3.937339e+03, +4.184155e+03, +9.803696e+02, -5.528119e-01, +4.380068e-07, -5.505022e-03, +4.533361e-10, -1.053396e-15, +2.000000e+06, +1.262108e+06, +2.283070e+06, +1.378672e+04, +4.566923e+03, +1.253572e+04 },
+    { +3.450000e+02, +1.022979e-03, +9.764684e+02, -3.650740e+04, +3.003742e+05, +3.024201e+05, -3.446144e+04, +3.911608e+03, +4.187058e+03, +9.775377e+02, -5.797968e-01, +4.406154e-07, -5.294019e-03, +5.891053e-10, -1.086552e-15, +2.000000e+06, +1.315879e+06, +2.269553e+06, +1.276633e+04, +4.330163e+03, +1.270198e+04 },
+    { +3.500000e+02, +1.026090e-03, +1.036738e+03, -4.154698e+04, +3.213113e+05, +3.233635e+05, -3.949480e+04, +3.885677e+03, +4.190342e+03, +9.745733e+02, -6.057996e-01, +4.438889e-07, -5.111564e-03, +7.195204e-10, -1.123821e-15, +2.000000e+06, +1.364755e+06, +2.252816e+06, +1.180657e+04, +4.132310e+03, +1.284914e+04 },
+    { +3.550000e+02, +1.029356e-03, +1.096202e+03, -4.688619e+04, +3.422655e+05, +3.443242e+05, -4.482748e+04, +3.859630e+03, +4.194031e+03, +9.714811e+02, -6.309542e-01, +4.478041e-07, -4.954202e-03, +8.460232e-10, -1.165333e-15, +2.000000e+06, +1.408996e+06, +2.233119e+06, +1.090570e+04, +3.969145e+03, +1.297735e+04 },
+    { +3.600000e+02, +1.032775e-03, +1.154889e+03, -5.252108e+04, +3.632390e+05, +3.653045e+05, -5.045553e+04, +3.833544e+03, +4.198155e+03, +9.682650e+02, -6.553788e-01, +4.523448e-07, -4.819160e-03, +9.698909e-10, -1.211276e-15, +2.000000e+06, +1.448848e+06, +2.210703e+06, +1.006174e+04, +3.836774e+03, +1.308683e+04 },
+    { +3.650000e+02, +1.036346e-03, +1.212827e+03, -5.844782e+04, +3.842339e+05, +3.863066e+05, -5.637512e+04, +3.807488e+03, +4.202746e+03, +9.649283e+02, -6.791793e-01, +4.575006e-07, -4.704208e-03, +1.092274e-09, -1.261888e-15, +2.000000e+06, +1.484543e+06, +2.185790e+06, +9.272528e+03, +3.731619e+03, +1.317789e+04 },
+    { +3.700000e+02, +1.040070e-03, +1.270042e+03, -6.466273e+04, +4.052527e+05, +4.073328e+05, -6.258259e+04, +3.781524e+03, +4.207837e+03, +9.614740e+02, -7.024514e-01, +4.632668e-07, -4.607549e-03, +1.214229e-09, -1.317461e-15, +2.000000e+06, +1.516300e+06, +2.158583e+06, +8.535770e+03, +3.650410e+03, +1.325086e+04 },
+    { +3.750000e+02, +1.043945e-03, +1.326561e+03, -7.116227e+04, +4.262979e+05, +4.283858e+05, -6.907438e+04, +3.755707e+03, +4.213462e+03, +9.579045e+02, -7.252829e-01, +4.696438e-07, -4.527744e-03, +1.336742e-09, -1.378342e-15, +2.000000e+06, +1.544325e+06, +2.129273e+06, +7.849094e+03, +3.590167e+03, +1.330611e+04 },
+    { +3.800000e+02, +1.047974e-03, +1.382409e+03, -7.794303e+04, +4.473724e+05, +4.494684e+05, -7.584708e+04, +3.730084e+03, +4.219656e+03, +9.542218e+02, -7.477550e-01, +4.766367e-07, -4.463647e-03, +1.460755e-09, -1.444939e-15, +2.000000e+06, +1.568815e+06, +2.098034e+06, +7.210088e+03, +3.548189e+03, +1.334403e+04 },
+    { +3.850000e+02, +1.052158e-03, +1.437612e+03, -8.500171e+04, +4.684791e+05, +4.705834e+05, -8.289739e+04, +3.704699e+03, +4.226454e+03, +9.504275e+02, -7.699440e-01, +4.842554e-07, -4.414359e-03, +1.587183e-09, -1.517723e-15, +2.000000e+06, +1.589954e+06, +2.065026e+06, +6.616341e+03, +3.522030e+03, +1.336501e+04 },
+    { +3.900000e+02, +1.056499e-03, +1.492195e+03, -9.233516e+04, +4.896210e+05, +4.917340e+05, -9.022217e+04, +3.679586e+03, +4.233891e+03, +9.465227e+02, -7.919221e-01, +4.925141e-07, -4.379193e-03, +1.716930e-09, -1.597238e-15, +2.000000e+06, +1.607918e+06, +2.030399e+06, +6.065460e+03, +3.509485e+03, +1.336945e+04 },
+    { +3.950000e+02, +1.060998e-03, +1.546182e+03, -9.994035e+04, +5.108014e+05, +5.129234e+05, -9.781835e+04, +3.654777e+03, +4.242004e+03, +9.425085e+02, -8.137586e-01, +5.014317e-07, -4.357644e-03, +1.850913e-09, -1.684106e-15, +2.000000e+06, +1.622870e+06, +1.994289e+06, +5.555100e+03, +3.508566e+03, +1.335777e+04 },
+    { +4.000000e+02, +1.065660e-03, +1.599596e+03, -1.078144e+05, +5.320239e+05, +5.341552e+05, -1.056830e+05, +3.630299e+03, +4.250830e+03, +9.383853e+02, -8.355207e-01, +5.110318e-07, -4.349371e-03, +1.990069e-09, -1.779041e-15, +2.000000e+06, +1.634968e+06, +1.956825e+06, +5.082976e+03, +3.517492e+03, +1.333036e+04 },
+    { +4.100000e+02, +1.075486e-03, +1.704798e+03, -1.243577e+05, +5.746096e+05, +5.767606e+05, -1.222068e+05, +3.582414e+03, +4.270777e+03, +9.298124e+02, -8.790842e-01, +5.323976e-07, -4.372029e-03, +2.287878e-09, -1.996491e-15, +2.000000e+06, +1.651180e+06, +1.878295e+06, +4.244676e+03, +3.558643e+03, +1.322998e+04 },
+    { +4.200000e+02, +1.086010e-03, +1.807986e+03, -1.419443e+05, +6.174099e+05, +6.195819e+05, -1.397723e+05, +3.536061e+03, +4.294065e+03, +9.208019e+02, -9.231364e-01, +5.569003e-07, -4.447301e-03, +2.619004e-09, -2.257642e-15, +2.000000e+06, +1.657633e+06, +1.795654e+06, +3.533907e+03, +3.622058e+03, +1.307142e+04 },
+    { +4.300000e+02, +1.097278e-03, +1.909336e+03, -1.605549e+05, +6.604597e+05, +6.626543e+05, -1.583604e+05, +3.491326e+03, +4.321072e+03, +9.113463e+02, -9.682131e-01, +5.849225e-07, -4.577505e-03, +2.993655e-09, -2.573110e-15, +2.000000e+06, +1.655284e+06, +1.709628e+06, +2.935500e+03, +3.699056e+03, +1.285770e+04 },
+    { +4.400000e+02, +1.109346e-03, +2.009024e+03, -1.801722e+05, +7.037985e+05, +7.060172e+05, -1.779535e+05, +3.448255e+03, +4.352243e+03, +9.014324e+02, -1.014885e+00, +6.169600e-07, -4.767306e-03, +3.424389e-09, -2.957033e-15, +2.000000e+06, +1.644977e+06, +1.620851e+06, +2.435822e+03, +3.782743e+03, +1.259173e+04 },
+    { +4.500000e+02, +1.122283e-03, +2.107224e+03, -2.007804e+05, +7.474703e+05, +7.497148e+05, -1.985359e+05, +3.406876e+03, +4.388120e+03, +8.910412e+02, -1.063782e+00, +6.536500e-07, -5.024148e-03, +3.927196e-09, -3.428484e-15, +2.000000e+06, +1.627449e+06, +1.529871e+06, +2.022758e+03, +3.867655e+03, +1.227627e+04 },
+    { +4.600000e+02, +1.136174e-03, +2.204111e+03, -2.223659e+05, +7.915251e+05, +7.937975e+05, -2.200936e+05, +3.367202e+03, +4.429370e+03, +8.801469e+02, -1.115627e+00, +6.958132e-07, -5.359036e-03, +4.523043e-09, -4.013616e-15, +2.000000e+06, +1.603343e+06, +1.437167e+06, +1.685648e+03, +3.949473e+03, +1.191401e+04 },
+    { +4.700000e+02, +1.151124e-03, +2.299866e+03, -2.449166e+05, +8.360207e+05, +8.383229e+05, -2.426143e+05, +3.329244e+03, +4.476836e+03, +8.687160e+02, -1.171275e+00, +7.445140e-07, -5.787819e-03, +5.240196e-09, -4.748983e-15, +2.000000e+06, +1.573208e+06, +1.343158e+06, +1.415200e+03, +4.024782e+03, +1.150753e+04 },
+    { +4.800000e+02, +1.167263e-03, +2.394680e+03, -2.684223e+05, +8.810240e+05, +8.833585e+05, -2.660878e+05, +3.293019e+03, +4.531600e+03, +8.567053e+02, -1.231772e+00, +8.011502e-07, -6.333274e-03, +6.117827e-09, -5.686829e-15, +2.000000e+06, +1.537504e+06, +1.248205e+06, +1.203402e+03, +4.090875e+03, +1.105932e+04 },
+    { +4.855270e+02, +1.176749e-03, +2.446752e+03, -2.818206e+05, +9.061435e+05, +9.084970e+05, -2.794671e+05, +3.273751e+03, +4.565502e+03, +8.497988e+02, -1.267756e+00, +8.365152e-07, -6.696334e-03, +6.691240e-09, -6.318681e-15, +2.000000e+06, +1.515521e+06, +1.195436e+06, +1.108973e+03, +4.122645e+03, +1.079456e+04 },
+    { +4.855270e+02, +1.176749e-03, +2.446752e+03, -2.818206e+05, +9.061435e+05, +9.084970e+05, -2.794671e+05, +3.273751e+03, +4.565502e+03, +8.497988e+02, -1.267756e+00, +8.365152e-07, -6.696334e-03, +6.691240e-09, -6.318681e-15, +2.000000e+06, +1.515521e+06, +1.195436e+06, +1.108973e+03, +4.122645e+03, +1.079456e+04 },
+    { +4.900000e+02, +1.011223e-01, +6.367520e+03, -5.101296e+05, +2.609955e+06, +2.812200e+06, -3.078850e+05, +2.068185e+03, +3.036407e+03, +9.889017e+00, -3.306032e-02, +5.656258e-06, +4.454947e-04, -3.088047e-08, +1.004090e-12, +2.000000e+06, +5.844911e+03, +1.767953e+05, -2.100510e+01, +7.817789e+02, -5.548623e+03 },
+    { +5.000000e+02, +1.044053e-01, +6.426462e+03, -5.806702e+05, +2.632561e+06, +2.841372e+06, -3.718596e+05, +1.946202e+03, +2.818487e+03, +9.578059e+00, -2.934688e-02, +5.381218e-06, +3.140939e-04, -2.473826e-08, +7.817507e-13, +2.000000e+06, +5.453576e+03, +1.858315e+05, -1.254741e+01, +7.070679e+02, -5.016797e+03 },
+    { +5.100000e+02, +1.075385e-01, +6.480846e+03, -6.514762e+05, +2.653755e+06, +2.868832e+06, -4.363993e+05, +1.873768e+03, +2.682219e+03, +9.298997e+00, -2.657927e-02, +5.153830e-06, +2.453147e-04, -2.098490e-08, +6.393847e-13, +2.000000e+06, +5.157188e+03, +1.940305e+05, -8.900967e+00, +6.658948e+02, -4.670593e+03 },
+    { +5.200000e+02, +1.105625e-01, +6.531935e+03, -7.225905e+05, +2.674016e+06, +2.895141e+06, -5.014656e+05, +1.823270e+03, +2.584148e+03, +9.044662e+00, -2.436134e-02, +4.957991e-06, +2.009977e-04, -1.831299e-08, +5.364598e-13, +2.000000e+06, +4.913551e+03, +2.016946e+05, -6.854750e+00, +6.377543e+02, -4.401696e+03 },
+    { +5.300000e+02, +1.135006e-01, +6.580414e+03, -7.940304e+05, +2.693589e+06, +2.920590e+06, -5.670293e+05, +1.785282e+03, +2.508743e+03, +8.810528e+00, -2.251831e-02, +4.785515e-06, +1.691805e-04, -1.626458e-08, +4.575337e-13, +2.000000e+06, +4.705514e+03, +2.089639e+05, -5.484205e+00, +6.161981e+02, -4.174813e+03 },
+    { +5.400000e+02, +1.163687e-01, +6.626730e+03, -8.658041e+05, +2.712630e+06, +2.945367e+06, -6.330667e+05, +1.755776e+03, +2.448928e+03, +8.593375e+00, -2.095241e-02, +4.631328e-06, +1.450291e-04, -1.463034e-08, +3.949900e-13, +2.000000e+06, +4.524061e+03, +2.159208e+05, -4.477399e+00, +5.987816e+02, -3.976212e+03 },
+    { +5.500000e+02, +1.191786e-01, +6.671209e+03, -9.379150e+05, +2.731250e+06, +2.969607e+06, -6.995578e+05, +1.732571e+03, +2.400699e+03, +8.390769e+00, -1.960046e-02, +4.491923e-06, +1.260874e-04, -1.329285e-08, +3.443371e-13, +2.000000e+06, +4.363489e+03, +2.226218e+05, -3.703793e+00, +5.843344e+02, -3.799153e+03 },
+    { +5.600000e+02, +1.219393e-01, +6.714101e+03, -1.010364e+06, +2.749533e+06, +2.993411e+06, -7.664856e+05, +1.714265e+03, +2.361428e+03, +8.200802e+00, -1.841823e-02, +4.364734e-06, +1.108912e-04, -1.217729e-08, +3.026342e-13, +2.000000e+06, +4.219784e+03, +2.291091e+05, -3.095027e+00, +5.721640e+02, -3.639525e+03 },
+    { +5.700000e+02, +1.246580e-01, +6.755604e+03, -1.083151e+06, +2.767543e+06, +3.016859e+06, -8.338352e+05, +1.699858e+03, +2.329247e+03, +8.021947e+00, -1.737338e-02, +4.247810e-06, +9.848181e-05, -1.123248e-08, +2.678371e-13, +2.000000e+06, +4.089961e+03, +2.354154e+05, -2.608712e+00, +5.617989e+02, -3.494424e+03 },
+    { +5.800000e+02, +1.273406e-01, +6.795877e+03, -1.156275e+06, +2.785334e+06, +3.040015e+06, -9.015935e+05, +1.688601e+03, +2.302765e+03, +7.852958e+00, -1.644154e-02, +4.139638e-06, +8.819642e-05, -1.042184e-08, +2.384713e-13, +2.000000e+06, +3.971733e+03, +2.415670e+05, -2.215816e+00, +5.528925e+02, -3.361624e+03 },
+    { +5.900000e+02, +1.299916e-01, +6.835049e+03, -1.229732e+06, +2.802947e+06, +3.062930e+06, -9.697490e+05, +1.679916e+03, +2.280919e+03, +7.692802e+00, -1.560397e-02, +4.039016e-06, +7.956073e-05, -9.718481e-09, +2.134447e-13, +2.000000e+06, +3.863308e+03, +2.475850e+05, -1.895374e+00, +5.451800e+02, -3.239355e+03 },
+    { +6.000000e+02, +1.326152e-01, +6.873229e+03, -1.303522e+06, +2.820416e+06, +3.085646e+06, -1.038291e+06, +1.673349e+03, +2.262886e+03, +7.540614e+00, -1.484599e-02, +3.944979e-06, +7.222710e-05, -9.102183e-09, +1.919322e-13, +2.000000e+06, +3.763263e+03, +2.534868e+05, -1.631810e+00, +5.384546e+02, -3.126179e+03 },
+    { +6.100000e+02, +1.352145e-01, +6.910506e+03, -1.377640e+06, +2.837769e+06, +3.108198e+06, -1.107211e+06, +1.668541e+03, +2.248017e+03, +7.395656e+00, -1.415596e-02, +3.856734e-06, +6.593577e-05, -8.557480e-09, +1.732993e-13, +2.000000e+06, +3.670451e+03, +2.592867e+05, -1.413338e+00, +5.325521e+02, -3.020909e+03 },
+    { +6.200000e+02, +1.377923e-01, +6.946958e+03, -1.452083e+06, +2.855031e+06, +3.130615e+06, -1.176499e+06, +1.665206e+03, +2.235794e+03, +7.257300e+00, -1.352446e-02, +3.773631e-06, +6.048946e-05, -8.072352e-09, +1.570514e-13, +2.000000e+06, +3.583940e+03, +2.649968e+05, -1.230931e+00, +5.273411e+02, -2.922561e+03 },
+    { +6.300000e+02, +1.403509e-01, +6.982649e+03, -1.526849e+06, +2.872220e+06, +3.152922e+06, -1.246147e+06, +1.663112e+03, +2.225804e+03, +7.124998e+00, -1.294386e-02, +3.695121e-06, +5.573613e-05, -7.637325e-09, +1.427972e-13, +2.000000e+06, +3.502960e+03, +2.706272e+05, -1.077602e+00, +5.227154e+02, -2.830308e+03 },
+    { +6.400000e+02, +1.428924e-01, +7.017636e+03, -1.601934e+06, +2.889353e+06, +3.175138e+06, -1.316149e+06, +1.662071e+03, +2.217710e+03, +6.998274e+00, -1.240783e-02, +3.620742e-06, +5.155710e-05, -7.244837e-09, +1.302240e-13, +2.000000e+06, +3.426875e+03, +2.761864e+05, -9.478946e-01, +5.185883e+02, -2.743457e+03 },
+    { +6.500000e+02, +1.454184e-01, +7.051967e+03, -1.677335e+06, +2.906444e+06, +3.197281e+06, -1.386498e+06, +1.661929e+03, +2.211238e+03, +6.876710e+00, -1.191112e-02, +3.550103e-06, +4.785858e-05, -6.888787e-09, +1.190791e-13, +2.000000e+06, +3.355148e+03, +2.816820e+05, -8.375132e-01, +5.148887e+02, -2.661416e+03 },
+    { +6.750000e+02, +1.516751e-01, +7.135201e+03, -1.867195e+06, +2.949066e+06, +3.252416e+06, -1.563845e+06, +1.664731e+03, +2.200767e+03, +6.593041e+00, -1.081400e-02, +3.387744e-06, +4.025771e-05, -6.127520e-09, +9.619931e-14, +2.000000e+06, +3.192094e+03, +2.951817e+05, -6.253967e-01, +5.071483e+02, -2.474232e+03 },
+    { +7.000000e+02, +1.578626e-01, +7.215145e+03, -2.058956e+06, +2.991646e+06, +3.307371e+06, -1.743230e+06, +1.670957e+03, +2.196515e+03, +6.334623e+00, -9.883833e-03, +3.242551e-06, +3.439505e-05, -5.508007e-09, +7.868658e-14, +2.000000e+06, +3.048166e+03, +3.083992e+05, -4.772517e-01, +5.010548e+02, -2.308024e+03 },
+    { +7.250000e+02, +1.639945e-01, +7.292217e+03, -2.252567e+06, +3.034290e+06, +3.362279e+06, -1.924578e+06, +1.679664e+03, +2.196787e+03, +6.097765e+00, -9.084094e-03, +3.111473e-06, +2.975627e-05, -4.993291e-09, +6.501988e-14, +2.000000e+06, +2.919547e+03, +3.213912e+05, -3.709435e-01, +4.961606e+02, -2.158480e+03 },
+    { +7.500000e+02, +1.700810e-01, +7.366745e+03, -2.447982e+06, +3.077076e+06, +3.417238e+06, -2.107820e+06, +1.690222e+03, +2.200444e+03, +5.879552e+00, -8.388617e-03, +2.992223e-06, +2.600935e-05, -4.558430e-09, +5.418314e-14, +2.000000e+06, +2.803474e+03, +3.341997e+05, -2.928677e-01, +4.921629e+02, -2.022472e+03 },
+    { +7.750000e+02, +1.761299e-01, +7.438993e+03, -2.645156e+06, +3.120063e+06, +3.472323e+06, -2.292896e+06, +1.702193e+03, +2.206694e+03, +5.677628e+00, -7.778072e-03, +2.883033e-06, +2.293110e-05, -4.185953e-09, +4.547475e-14, +2.000000e+06, +2.697878e+03, +3.468569e+05, -2.343735e-01, +4.888506e+02, -1.897673e+03 },
+    { +8.000000e+02, +1.821473e-01, +7.509178e+03, -2.844047e+06, +3.163295e+06, +3.527590e+06, -2.479753e+06, +1.715266e+03, +2.214968e+03, +5.490063e+00, -7.237796e-03, +2.782511e-06, +2.036616e-05, -3.863230e-09, +3.839664e-14, +2.000000e+06, +2.601174e+03, +3.593876e+05, -1.897903e-01, +4.860726e+02, -1.782307e+03 },
+    { +8.250000e+02, +1.881380e-01, +7.577484e+03, -3.044616e+06, +3.206809e+06, +3.583085e+06, -2.668340e+06, +1.729210e+03, +2.224846e+03, +5.315248e+00, -6.756422e-03, +2.689536e-06, +1.820322e-05, -3.580885e-09, +3.258691e-14, +2.000000e+06, +2.512115e+03, +3.718114e+05, -1.552988e-01, +4.837179e+02, -1.674986e+03 },
+    { +8.500000e+02, +1.941059e-01, +7.644065e+03, -3.246824e+06, +3.250631e+06, +3.638843e+06, -2.858612e+06, +1.743849e+03, +2.236011e+03, +5.151827e+00, -6.324972e-03, +2.603190e-06, +1.636048e-05, -3.331802e-09, +2.777730e-14, +2.000000e+06, +2.429700e+03, +3.841440e+05, -1.282633e-01, +4.817035e+02, -1.574607e+03 },
+    { +9.000000e+02, +2.059856e-01, +7.772571e+03, -3.656024e+06, +3.339290e+06, +3.751261e+06, -3.244053e+06, +1.774688e+03, +2.261263e+03, +4.854707e+00, -5.584385e-03, +2.447472e-06, +1.340433e-05, -2.912550e-09, +2.039684e-14, +2.000000e+06, +2.281695e+03, +4.085849e+05, -8.965113e-02, +4.784564e+02, -1.391264e+03 },
+    { +9.500000e+02, +2.178058e-01, +7.895572e+03, -4.071389e+06, +3.429404e+06, +3.865015e+06, -3.635778e+06, +1.806959e+03, +2.289282e+03, +4.591245e+00, -4.972794e-03, +2.310600e-06, +1.115702e-05, -2.573738e-09, +1.513437e-14, +2.000000e+06, +2.152165e+03, +4.327879e+05, -6.444011e-02, +4.759743e+02, -1.226846e+03 },
+    { +1.000000e+03, +2.295801e-01, +8.013748e+03, -4.492690e+06, +3.521059e+06, +3.980219e+06, -4.033530e+06, +1.840077e+03, +2.319096e+03, +4.355779e+00, -4.460418e-03, +2.189106e-06, +9.407986e-06, -2.294682e-09, +1.130391e-14, +2.000000e+06, +2.037553e+03, +4.568076e+05, -4.743702e-02, +4.740323e+02, -1.077528e+03 },
+    { +1.050000e+03, +2.413181e-01, +8.127642e+03, -4.919718e+06, +3.614307e+06, +4.096943e+06, -4.437081e+06, +1.873604e+03, +2.350006e+03, +4.143907e+00, -4.025993e-03, +2.080374e-06, +8.020513e-06, -2.061272e-09, +8.468195e-15, +2.000000e+06, +1.935226e+03, +4.806829e+05, -3.565261e-02, +4.724829e+02, -9.405173e+02 },
+    { +1.100000e+03, +2.530273e-01, +8.237690e+03, -5.352284e+06, +3.709174e+06, +4.215229e+06, -4.846230e+06, +1.907196e+03, +2.381495e+03, +3.952143e+00, -3.653895e-03, +1.982385e-06, +6.902217e-06, -1.863531e-09, +6.339220e-15, +2.000000e+06, +1.843181e+03, +5.044428e+05, -2.729101e-02, +4.712257e+02, -8.137135e+02 },
+    { +1.150000e+03, +2.647130e-01, +8.344250e+03, -5.790218e+06, +3.805669e+06, +4.335095e+06, -5.260792e+06, +1.940582e+03, +2.413165e+03, +3.777677e+00, -3.332370e-03, +1.893548e-06, +5.988637e-06, -1.694189e-09, +4.721999e-15, +2.000000e+06, +1.759855e+03, +5.281091e+05, -2.123450e-02, +4.701903e+02, -6.954994e+02 },
+    { +1.200000e+03, +2.763794e-01, +8.447621e+03, -6.233361e+06, +3.903784e+06, +4.456543e+06, -5.680602e+06, +1.973541e+03, +2.444710e+03, +3.618215e+00, -3.052397e-03, +1.812584e-06, +5.233574e-06, -1.547817e-09, +3.481433e-15, +2.000000e+06, +1.684002e+03, +5.516985e+05, -1.676645e-02, +4.693265e+02, -5.846061e+02 },
+    { +1.250000e+03, +2.880298e-01, +8.548053e+03, -6.681565e+06, +4.003501e+06, +4.579560e+06, -6.105505e+06, +2.005903e+03, +2.475892e+03, +3.471862e+00, -2.806939e-03, +1.738453e-06, +4.603158e-06, -1.420277e-09, +2.522028e-15, +2.000000e+06, +1.614619e+03, +5.752240e+05, -1.341543e-02, +4.685975e+02, -4.800217e+02 },
+    { +1.273000e+03, +2.933844e-01, +8.593324e+03, -6.889401e+06, +4.049900e+06, +4.636669e+06, -6.302632e+06, +2.020550e+03, +2.490062e+03, +3.408497e+00, -2.704041e-03, +1.706405e-06, +4.347806e-06, -1.367019e-09, +2.155442e-15, +2.000000e+06, +1.584642e+03, +5.860272e+05, -1.215758e-02, +4.682996e+02, -4.338001e+02 },
+    // P = 3.0 MPa
+    { +2.729380e+02, +9.987013e-04, -3.232735e+00, +1.898480e+00, -8.804377e+02, +2.115666e+03, +2.998002e+03, +4.203910e+03, +4.205882e+03, +1.001300e+03, +6.054800e-02, +5.061294e-07, -1.784151e-02, -3.788431e-09, -1.185493e-15, +3.000000e+06, -1.196295e+05, +1.975779e+06, +3.349354e+04, +1.423529e+04, +9.143537e+03 },
+    { +2.750000e+02, +9.986137e-04, +2.840005e+01, -2.383478e+01, +7.786179e+03, +1.078202e+04, +2.972006e+03, +4.199704e+03, +4.200048e+03, +1.001388e+03, +2.502499e-02, +4.986651e-07, -1.663912e-02, -3.457316e-09, -1.143499e-15, +3.000000e+06, -5.018396e+04, +2.005354e+06, +3.267723e+04, +1.367263e+04, +9.221653e+03 },
+    { +2.800000e+02, +9.986858e-04, +1.039752e+02, -3.556375e+02, +2.875741e+04, +3.175346e+04, +2.640420e+03, +4.187665e+03, +4.189226e+03, +1.001316e+03, -5.196290e-02, +4.831346e-07, -1.426962e-02, -2.781609e-09, -1.065414e-15, +3.000000e+06, +1.075537e+05, +2.069817e+06, +3.079947e+04, +1.240772e+04, +9.447440e+03 },
+    { +2.850000e+02, +9.991150e-04, +1.780540e+02, -1.062598e+03, +4.968278e+04, +5.268013e+04, +1.934747e+03, +4.173425e+03, +4.181930e+03, +1.000886e+03, -1.186118e-01, +4.706251e-07, -1.246786e-02, -2.241004e-09, -1.012246e-15, +3.000000e+06, +2.520302e+05, +2.124834e+06, +2.902897e+04, +1.126978e+04, +9.710927e+03 },
+    { +2.900000e+02, +9.998570e-04, +2.507404e+02, -2.137371e+03, +7.057735e+04, +7.357692e+04, +8.621998e+02, +4.157352e+03, +4.177140e+03, +1.000143e+03, -1.772987e-01, +4.605637e-07, -1.106234e-02, -1.797313e-09, -9.766617e-16, +3.000000e+06, +3.849601e+05, +2.171252e+06, +2.733793e+04, +1.024561e+04, +9.997123e+03 },
+    { +2.950000e+02, +1.000878e-03, +3.221187e+02, -3.573110e+03, +9.145191e+04, +9.445454e+04, -5.704776e+02, +4.139709e+03, +4.174167e+03, +9.991232e+02, -2.297097e-01, +4.525327e-07, -9.942720e-03, -1.425439e-09, -9.539844e-16, +3.000000e+06, +5.076090e+05, +2.209785e+06, +2.571231e+04, +9.325306e+03, +1.029417e+04 },
+    { +3.000000e+02, +1.002150e-03, +3.922591e+02, -5.363376e+03, +1.123144e+05, +1.153208e+05, -2.356925e+03, +4.120689e+03, +4.172526e+03, +9.978543e+02, -2.770783e-01, +4.462185e-07, -9.035285e-03, -1.108196e-09, -9.411668e-16, +3.000000e+06, +6.209475e+05, +2.241054e+06, +2.414610e+04, +8.500841e+03, +1.059312e+04 },
+    { +3.050000e+02, +1.003654e-03, +4.612215e+02, -7.502068e+03, +1.331705e+05, +1.361815e+05, -4.491106e+03, +4.100450e+03, +4.171876e+03, +9.963593e+02, -3.203305e-01, +4.413802e-07, -8.289114e-03, -8.333623e-10, -9.361853e-16, +3.000000e+06, +7.257473e+05, +2.265620e+06, +2.263770e+04, +7.765237e+03, +1.088738e+04 },
+    { +3.100000e+02, +1.005372e-03, +5.290583e+02, -9.983380e+03, +1.540247e+05, +1.570408e+05, -6.967264e+03, +4.079130e+03, +4.171972e+03, +9.946567e+02, -3.601774e-01, +4.378293e-07, -7.668051e-03, -5.919661e-10, -9.376754e-16, +3.000000e+06, +8.226434e+05, +2.283995e+06, +2.118764e+04, +7.112039e+03, +1.117219e+04 },
+    { +3.150000e+02, +1.007291e-03, +5.958159e+02, -1.280176e+04, +1.748803e+05, +1.779021e+05, -9.779890e+03, +4.056853e+03, +4.172646e+03, +9.927622e+02, -3.971753e-01, +4.354162e-07, -7.145811e-03, -3.772289e-10, -9.447086e-16, +3.000000e+06, +9.121740e+05, +2.296653e+06, +1.979730e+04, +6.535078e+03, +1.144416e+04 },
+    { +3.200000e+02, +1.009399e-03, +6.615366e+02, -1.595189e+04, +1.957398e+05, +1.987680e+05, -1.292370e+04, +4.033741e+03, +4.173785e+03, +9.906890e+02, -4.317674e-01, +4.340214e-07, -6.702906e-03, -1.839062e-10, -9.566530e-16, +3.000000e+06, +9.948069e+05, +2.304034e+06, +1.846810e+04, +6.028369e+03, +1.170095e+04 },
+    { +3.250000e+02, +1.011687e-03, +7.262592e+02, -1.942865e+04, +2.166056e+05, +2.196406e+05, -1.639359e+04, +4.009910e+03, +4.175319e+03, +9.884480e+02, -4.643119e-01, +4.335484e-07, -6.324638e-03, -7.853927e-12, -9.730851e-16, +3.000000e+06, +1.070958e+06, +2.306547e+06, +1.720117e+04, +5.586099e+03, +1.194093e+04 },
+    { +3.300000e+02, +1.014149e-03, +7.900197e+02, -2.322713e+04, +2.374794e+05, +2.405218e+05, -2.018468e+04, +3.985472e+03, +4.177206e+03, +9.860488e+02, -4.951027e-01, +4.339196e-07, -5.999768e-03, +1.542634e-10, -9.937333e-16, +3.000000e+06, +1.141001e+06, +2.304574e+06, +1.599712e+04, +5.202648e+03, +1.216303e+04 },
+    { +3.350000e+02, +1.016777e-03, +8.528522e+02, -2.734258e+04, +2.583629e+05, +2.614133e+05, -2.429224e+04, +3.960537e+03, +4.179431e+03, +9.834995e+02, -5.243840e-01, +4.350724e-07, -5.719594e-03, +3.051761e-10, -1.018440e-15, +3.000000e+06, +1.205280e+06, +2.298468e+06, +1.485600e+04, +4.872626e+03, +1.236662e+04 },
+    { +3.400000e+02, +1.019568e-03, +9.147894e+02, -3.177042e+04, +2.792580e+05, +2.823167e+05, -2.871171e+04, +3.935207e+03, +4.181993e+03, +9.808071e+02, -5.523617e-01, +4.369565e-07, -5.477307e-03, +4.471542e-10, -1.047139e-15, +3.000000e+06, +1.264111e+06, +2.288557e+06, +1.377736e+04, +4.590904e+03, +1.255132e+04 },
+    { +3.450000e+02, +1.022518e-03, +9.758622e+02, -3.650625e+04, +3.001662e+05, +3.032338e+05, -3.343870e+04, +3.909581e+03, +4.184905e+03, +9.779777e+02, -5.792112e-01, +4.395323e-07, -5.267534e-03, +5.821146e-10, -1.079835e-15, +3.000000e+06, +1.317790e+06, +2.275146e+06, +1.276023e+04, +4.352644e+03, +1.271701e+04 },
+    { +3.500000e+02, +1.025624e-03, +1.036101e+03, -4.154582e+04, +3.210895e+05, +3.241663e+05, -3.846895e+04, +3.883749e+03, +4.188187e+03, +9.750166e+02, -6.050840e-01, +4.427687e-07, -5.086001e-03, +7.117006e-10, -1.116599e-15, +3.000000e+06, +1.366592e+06, +2.258515e+06, +1.180328e+04, +4.153318e+03, +1.286371e+04 },
+    { +3.550000e+02, +1.028882e-03, +1.095534e+03, -4.688501e+04, +3.420296e+05, +3.451163e+05, -4.379836e+04, +3.857796e+03, +4.191865e+03, +9.719283e+02, -6.301126e-01, +4.466427e-07, -4.929293e-03, +8.373432e-10, -1.157556e-15, +3.000000e+06, +1.410775e+06, +2.238926e+06, +1.090481e+04, +3.988718e+03, +1.299156e+04 },
+    { +3.600000e+02, +1.032294e-03, +1.154191e+03, -5.251987e+04, +3.629888e+05, +3.660857e+05, -4.942299e+04, +3.831800e+03, +4.195970e+03, +9.687167e+02, -6.544137e-01, +4.511377e-07, -4.794665e-03, +9.603087e-10, -1.202886e-15, +3.000000e+06, +1.450585e+06, +2.216618e+06, +1.006290e+04, +3.854954e+03, +1.310078e+04 },
+    { +3.650000e+02, +1.035856e-03, +1.212098e+03, -5.844659e+04, +3.839692e+05, +3.870768e+05, -5.533902e+04, +3.805828e+03, +4.200533e+03, +9.653852e+02, -6.780923e-01, +4.562432e-07, -4.679906e-03, +1.081738e-09, -1.252821e-15, +3.000000e+06, +1.486252e+06, +2.191813e+06, +9.275424e+03, +3.748453e+03, +1.319167e+04 },
+    { +3.700000e+02, +1.039569e-03, +1.269283e+03, -6.466148e+04, +4.049731e+05, +4.080919e+05, -6.154277e+04, +3.779944e+03, +4.205588e+03, +9.619366e+02, -7.012429e-01, +4.619543e-07, -4.583239e-03, +1.202675e-09, -1.307645e-15, +3.000000e+06, +1.517992e+06, +2.164716e+06, +8.540115e+03, +3.665946e+03, +1.326456e+04 },
+    { +3.750000e+02, +1.043435e-03, +1.325771e+03, -7.116099e+04, +4.260032e+05, +4.291335e+05, -6.803069e+04, +3.754203e+03, +4.211169e+03, +9.583735e+02, -7.239524e-01, +4.682708e-07, -4.503235e-03, +1.324097e-09, -1.367695e-15, +3.000000e+06, +1.546012e+06, +2.135516e+06, +7.854637e+03, +3.604456e+03, +1.331981e+04 },
+    { +3.800000e+02, +1.047452e-03, +1.381589e+03, -7.794172e+04, +4.470621e+05, +4.502045e+05, -7.479936e+04, +3.728652e+03, +4.217311e+03, +9.546977e+02, -7.463012e-01, +4.751976e-07, -4.438756e-03, +1.446932e-09, -1.433368e-15, +3.000000e+06, +1.570507e+06, +2.104388e+06, +7.216607e+03, +3.561282e+03, +1.335780e+04 },
+    { +3.850000e+02, +1.051623e-03, +1.436761e+03, -8.500037e+04, +4.681528e+05, +4.713076e+05, -8.184550e+04, +3.703335e+03, +4.224048e+03, +9.509110e+02, -7.683644e-01, +4.827440e-07, -4.388906e-03, +1.572081e-09, -1.505123e-15, +3.000000e+06, +1.591660e+06, +2.071491e+06, +6.623637e+03, +3.533976e+03, +1.337893e+04 },
+    { +3.900000e+02, +1.055950e-03, +1.491313e+03, -9.233379e+04, +4.892782e+05, +4.924460e+05, -8.916594e+04, +3.678288e+03, +4.231416e+03, +9.470144e+02, -7.902134e-01, +4.909237e-07, -4.352997e-03, +1.700436e-09, -1.583490e-15, +3.000000e+06, +1.609646e+06, +2.036976e+06, +6.073358e+03, +3.520333e+03, +1.338361e+04 },
+    { +3.950000e+02, +1.060435e-03, +1.545267e+03, -9.993894e+04, +5.104416e+05, +5.136229e+05, -9.675764e+04, +3.653541e+03, +4.239451e+03, +9.430091e+02, -8.119167e-01, +4.997552e-07, -4.330522e-03, +1.832894e-09, -1.669073e-15, +3.000000e+06, +1.624629e+06, +2.000980e+06, +5.563443e+03, +3.518366e+03, +1.337222e+04 },
+    { +4.000000e+02, +1.065081e-03, +1.598648e+03, -1.078129e+05, +5.316465e+05, +5.348417e+05, -1.046177e+05, +3.629120e+03, +4.248189e+03, +9.388954e+02, -8.335405e-01, +5.092611e-07, -4.321134e-03, +1.970376e-09, -1.762567e-15, +3.000000e+06, +1.636765e+06, +1.963629e+06, +5.091624e+03, +3.526290e+03, +1.334518e+04 },
+    { +4.100000e+02, +1.074871e-03, +1.703784e+03, -1.243562e+05, +5.741951e+05, +5.774197e+05, -1.211316e+05, +3.581343e+03, +4.267927e+03, +9.303438e+02, -8.768082e-01, +5.304111e-07, -4.340953e-03, +2.264296e-09, -1.976573e-15, +3.000000e+06, +1.653073e+06, +1.885330e+06, +4.253576e+03, +3.565572e+03, +1.324571e+04 },
+    { +4.200000e+02, +1.085355e-03, +1.806900e+03, -1.419427e+05, +6.169551e+05, +6.202112e+05, -1.386866e+05, +3.535088e+03, +4.290958e+03, +9.213577e+02, -9.205316e-01, +5.546548e-07, -4.412467e-03, +2.590626e-09, -2.233325e-15, +3.000000e+06, +1.659648e+06, +1.802923e+06, +3.542658e+03, +3.627289e+03, +1.308831e+04 },
+    { +4.300000e+02, +1.096575e-03, +1.908173e+03, -1.605532e+05, +6.599613e+05, +6.632510e+05, -1.572634e+05, +3.490438e+03, +4.317653e+03, +9.119299e+02, -9.652367e-01, +5.823644e-07, -4.537807e-03, +2.959281e-09, -2.543109e-15, +3.000000e+06, +1.657444e+06, +1.717138e+06, +2.943775e+03, +3.702748e+03, +1.287599e+04 },
+    { +4.400000e+02, +1.108589e-03, +2.007778e+03, -1.801703e+05, +7.032521e+05, +7.065779e+05, -1.768445e+05, +3.447442e+03, +4.348444e+03, +9.020479e+02, -1.011482e+00, +6.140217e-07, -4.721361e-03, +3.382417e-09, -2.919594e-15, +3.000000e+06, +1.647306e+06, +1.628607e+06, +2.443350e+03, +3.785043e+03, +1.261163e+04 },
+    { +4.500000e+02, +1.121462e-03, +2.105887e+03, -2.007784e+05, +7.468709e+05, +7.502353e+05, -1.974140e+05, +3.406128e+03, +4.383857e+03, +8.916931e+02, -1.059881e+00, +6.502453e-07, -4.970175e-03, +3.875449e-09, -3.381169e-15, +3.000000e+06, +1.629971e+06, +1.537881e+06, +2.029306e+03, +3.868701e+03, +1.229802e+04 },
+    { +4.600000e+02, +1.135279e-03, +2.202675e+03, -2.223637e+05, +7.908668e+05, +7.942726e+05, -2.189578e+05, +3.366507e+03, +4.424539e+03, +8.808407e+02, -1.111137e+00, +6.918300e-07, -5.294670e-03, +4.458516e-09, -3.952976e-15, +3.000000e+06, +1.606083e+06, +1.445442e+06, +1.691006e+03, +3.949392e+03, +1.193784e+04 },
+    { +4.700000e+02, +1.150142e-03, +2.298319e+03, -2.449141e+05, +8.352959e+05, +8.387463e+05, -2.414637e+05, +3.328590e+03, +4.471303e+03, +8.694581e+02, -1.166076e+00, +7.398047e-07, -5.709838e-03, +5.158655e-09, -4.670024e-15, +3.000000e+06, +1.576194e+06, +1.351708e+06, +1.419167e+03, +4.023691e+03, +1.153368e+04 },
+    { +4.800000e+02, +1.166176e-03, +2.393007e+03, -2.684196e+05, +8.802238e+05, +8.837224e+05, -2.649210e+05, +3.292390e+03, +4.525192e+03, +8.575036e+02, -1.225706e+00, +7.955160e-07, -6.237163e-03, +6.013165e-09, -5.582147e-15, +3.000000e+06, +1.540769e+06, +1.257046e+06, +1.205772e+03, +4.088886e+03, +1.108803e+04 },
+    { +4.900000e+02, +1.183538e-03, +2.486938e+03, -2.928719e+05, +9.257278e+05, +9.292784e+05, -2.893213e+05, +3.257938e+03, +4.587569e+03, +8.449242e+02, -1.291295e+00, +8.607565e-07, -6.907752e-03, +7.075007e-09, -6.762109e-15, +3.000000e+06, +1.500186e+06, +1.161769e+06, +1.043990e+03, +4.142813e+03, +1.060331e+04 },
+    { +5.000000e+02, +1.202425e-03, +2.580332e+03, -3.182653e+05, +9.719008e+05, +9.755080e+05, -3.146580e+05, +3.225288e+03, +4.660254e+03, +8.316524e+02, -1.364490e+00, +9.379617e-07, -7.767573e-03, +8.421814e-09, -8.319390e-15, +3.000000e+06, +1.454739e+06, +1.066142e+06, +9.281094e+02, +4.183729e+03, +1.008176e+04 },
+    { +5.070030e+02, +1.216692e-03, +2.645548e+03, -3.366066e+05, +1.004694e+06, +1.008344e+06, -3.329565e+05, +3.203546e+03, +4.718590e+03, +8.219006e+02, -1.421433e+00, +1.000920e-06, -8.518460e-03, +9.595541e-09, -9.722469e-15, +3.000000e+06, +1.420126e+06, +9.990810e+05, +8.717714e+02, +4.203854e+03, +9.695688e+03 },
+    { +5.070030e+02, +1.216692e-03, +2.645548e+03, -3.366066e+05, +1.004694e+06, +1.008344e+06, -3.329565e+05, +3.203546e+03, +4.718590e+03, +8.219006e+02, -1.421433e+00, +1.000920e-06, -8.518460e-03, +9.595541e-09, -9.722469e-15, +3.000000e+06, +1.420126e+06, +9.990810e+05, +8.717714e+02, +4.203854e+03, +9.695688e+03 },
+    { +5.100000e+02, +6.743833e-02, +6.206434e+03, -5.538408e+05, +2.611441e+06, +2.813756e+06, -3.515258e+05, +2.252478e+03, +3.469183e+03, +1.482836e+01, -5.598640e-02, +5.975355e-06, +9.241259e-04, -4.155244e-08, +1.072607e-12, +3.000000e+06, +9.369553e+03, +1.673541e+05, -4.010354e+01, +8.823053e+02, -5.027470e+03 },
+    { +5.200000e+02, +6.988818e-02, +6.270445e+03, -6.235808e+05, +2.637050e+06, +2.846715e+06, -4.139163e+05, +2.090306e+03, +3.153103e+03, +1.430857e+01, -4.847030e-02, +5.614511e-06, +6.200633e-04, -3.168434e-08, +8.080040e-13, +3.000000e+06, +8.633040e+03, +1.781099e+05, -2.372761e+01, +7.838410e+02, -4.565387e+03 },
+    { +5.300000e+02, +7.219198e-02, +6.328531e+03, -6.934911e+05, +2.660630e+06, +2.877206e+06, -4.769152e+05, +1.994568e+03, +2.957817e+03, +1.385195e+01, -4.310646e-02, +5.328437e-06, +4.667445e-04, -2.594860e-08, +6.455698e-13, +3.000000e+06, +8.089888e+03, +1.876723e+05, -1.673139e+01, +7.299885e+02, -4.267207e+03 },
+    { +5.400000e+02, +7.439106e-02, +6.382458e+03, -7.636463e+05, +2.682881e+06, +2.906054e+06, -5.404731e+05, +1.927915e+03, +2.818576e+03, +1.344248e+01, -3.894758e-02, +5.089603e-06, +3.714380e-04, -2.203355e-08, +5.320923e-13, +3.000000e+06, +7.652380e+03, +1.964790e+05, -1.284552e+01, +6.933962e+02, -4.035851e+03 },
+    { +5.500000e+02, +7.650889e-02, +6.433163e+03, -8.340803e+05, +2.704159e+06, +2.933686e+06, -6.045536e+05, +1.877625e+03, +2.712160e+03, +1.307038e+01, -3.558240e-02, +4.884416e-06, +3.051983e-04, -1.913599e-08, +4.474761e-13, +3.000000e+06, +7.284884e+03, +2.047328e+05, -1.026504e+01, +6.654581e+02, -3.840006e+03 },
+    { +5.600000e+02, +7.856114e-02, +6.481248e+03, -9.048111e+05, +2.724688e+06, +2.960371e+06, -6.691277e+05, +1.838294e+03, +2.627982e+03, +1.272894e+01, -3.278633e-02, +4.704721e-06, +2.563141e-04, -1.689220e-08, +3.819426e-13, +3.000000e+06, +6.968815e+03, +2.125525e+05, -8.380030e+00, +6.429139e+02, -3.667723e+03 },
+    { +5.700000e+02, +8.055922e-02, +6.527142e+03, -9.758490e+05, +2.744622e+06, +2.986300e+06, -7.341713e+05, +1.807038e+03, +2.560100e+03, +1.241323e+01, -3.041814e-02, +4.545066e-06, +2.188984e-04, -1.510239e-08, +3.298644e-13, +3.000000e+06, +6.692563e+03, +2.200188e+05, -6.936246e+00, +6.242128e+02, -3.513296e+03 },
+    { +5.800000e+02, +8.251184e-02, +6.571170e+03, -1.047200e+06, +2.764079e+06, +3.011615e+06, -7.996643e+05, +1.782025e+03, +2.504678e+03, +1.211947e+01, -2.838171e-02, +4.401576e-06, +1.895175e-04, -1.364285e-08, +2.876627e-13, +3.000000e+06, +6.448078e+03, +2.271913e+05, -5.801908e+00, +6.084470e+02, -3.373330e+03 },
+    { +5.900000e+02, +8.442581e-02, +6.613585e+03, -1.118867e+06, +2.783148e+06, +3.036426e+06, -8.655893e+05, +1.761965e+03, +2.459027e+03, +1.184472e+01, -2.660840e-02, +4.271386e-06, +1.659788e-04, -1.243125e-08, +2.529194e-13, +3.000000e+06, +6.229453e+03, +2.341161e+05, -4.896277e+00, +5.950044e+02, -3.245456e+03 },
+    { +6.000000e+02, +8.630661e-02, +6.654587e+03, -1.190851e+06, +2.801901e+06, +3.060821e+06, -9.319313e+05, +1.745898e+03, +2.421175e+03, +1.158660e+01, -2.504764e-02, +4.152318e-06, +1.468029e-04, -1.141030e-08, +2.239342e-13, +3.000000e+06, +6.032206e+03, +2.408294e+05, -4.164597e+00, +5.834379e+02, -3.127869e+03 },
+    { +6.100000e+02, +8.815866e-02, +6.694340e+03, -1.263153e+06, +2.820394e+06, +3.084870e+06, -9.986769e+05, +1.733085e+03, +2.389633e+03, +1.134319e+01, -2.366128e-02, +4.042682e-06, +1.309545e-04, -1.053886e-08, +1.994762e-13, +3.000000e+06, +5.852865e+03, +2.473605e+05, -3.567606e+00, +5.734073e+02, -3.019132e+03 },
+    { +6.200000e+02, +8.998560e-02, +6.732976e+03, -1.335771e+06, +2.838674e+06, +3.108631e+06, -1.065814e+06, +1.722953e+03, +2.363255e+03, +1.111289e+01, -2.241996e-02, +3.941144e-06, +1.176895e-04, -9.786638e-09, +1.786333e-13, +3.000000e+06, +5.688693e+03, +2.537334e+05, -3.076256e+00, +5.646472e+02, -2.918069e+03 },
+    { +6.300000e+02, +9.179045e-02, +6.770607e+03, -1.408704e+06, +2.856778e+06, +3.132150e+06, -1.133333e+06, +1.715045e+03, +2.341145e+03, +1.089438e+01, -2.130071e-02, +3.846629e-06, +1.064615e-04, -9.130870e-09, +1.607167e-13, +3.000000e+06, +5.537501e+03, +2.599679e+05, -2.668637e+00, +5.569473e+02, -2.823710e+03 },
+    { +6.400000e+02, +9.357575e-02, +6.807327e+03, -1.481951e+06, +2.874738e+06, +3.155466e+06, -1.201223e+06, +1.708998e+03, +2.322595e+03, +1.068653e+01, -2.028531e-02, +3.758263e-06, +9.686179e-05, -8.554170e-09, +1.451969e-13, +3.000000e+06, +5.397522e+03, +2.660803e+05, -2.327992e+00, +5.501393e+02, -2.735242e+03 },
+    { +6.500000e+02, +9.534364e-02, +6.843213e+03, -1.555508e+06, +2.892581e+06, +3.178611e+06, -1.269477e+06, +1.704520e+03, +2.307039e+03, +1.048838e+01, -1.935909e-02, +3.675327e-06, +8.858018e-05, -8.043041e-09, +1.316615e-13, +3.000000e+06, +5.267311e+03, +2.720846e+05, -2.041364e+00, +5.440867e+02, -2.651983e+03 },
+    { +6.750000e+02, +9.969858e-02, +6.929704e+03, -1.740743e+06, +2.936807e+06, +3.235903e+06, -1.441647e+06, +1.698728e+03, +2.278457e+03, +1.003023e+01, -1.736048e-02, +3.488027e-06, +7.219926e-05, -6.987594e-09, +1.045223e-13, +3.000000e+06, +4.977163e+03, +2.866950e+05, -1.499908e+00, +5.315792e+02, -2.463028e+03 },
+    { +7.000000e+02, +1.039778e-01, +7.012220e+03, -1.927862e+06, +2.980692e+06, +3.292625e+06, -1.615929e+06, +1.698667e+03, +2.260811e+03, +9.617438e+00, -1.571325e-02, +3.324019e-06, +6.015777e-05, -6.164998e-09, +8.433551e-14, +3.000000e+06, +4.727184e+03, +3.008406e+05, -1.130017e+00, +5.218820e+02, -2.296254e+03 },
+    { +7.250000e+02, +1.081971e-01, +7.091363e+03, -2.116822e+06, +3.024416e+06, +3.349008e+06, -1.792230e+06, +1.702643e+03, +2.250884e+03, +9.242389e+00, -1.432872e-02, +3.178427e-06, +5.099933e-05, -5.505287e-09, +6.893423e-14, +3.000000e+06, +4.508116e+03, +3.146211e+05, -8.694075e-01, +5.141873e+02, -2.146834e+03 },
+    { +7.500000e+02, +1.123682e-01, +7.167585e+03, -2.307577e+06, +3.068111e+06, +3.405216e+06, -1.970473e+06, +1.709554e+03, +2.246585e+03, +8.899319e+00, -1.314670e-02, +3.047772e-06, +4.384089e-05, -4.964038e-09, +5.694180e-14, +3.000000e+06, +4.313546e+03, +3.281086e+05, -6.808839e-01, +5.079623e+02, -2.011332e+03 },
+    { +7.750000e+02, +1.164996e-01, +7.241239e+03, -2.500087e+06, +3.111873e+06, +3.461372e+06, -2.150588e+06, +1.718657e+03, +2.246499e+03, +8.583723e+00, -1.212474e-02, +2.929486e-06, +3.812003e-05, -4.511722e-09, +4.744606e-14, +3.000000e+06, +4.138863e+03, +3.413568e+05, -5.413896e-01, +5.028438e+02, -1.887234e+03 },
+    { +8.000000e+02, +1.205980e-01, +7.312604e+03, -2.694310e+06, +3.155774e+06, +3.517568e+06, -2.332516e+06, +1.729434e+03, +2.249641e+03, +8.292008e+00, -1.123186e-02, +2.821616e-06, +3.346342e-05, -4.127941e-09, +3.982140e-14, +3.000000e+06, +3.980649e+03, +3.544068e+05, -4.361495e-01, +4.985766e+02, -1.772649e+03 },
+    { +8.250000e+02, +1.246689e-01, +7.381910e+03, -2.890208e+06, +3.199868e+06, +3.573875e+06, -2.516201e+06, +1.741512e+03, +2.255301e+03, +8.021249e+00, -1.044486e-02, +2.722640e-06, +2.961444e-05, -3.798149e-09, +3.362618e-14, +3.000000e+06, +3.836299e+03, +3.672906e+05, -3.554094e-01, +4.949769e+02, -1.666122e+03 },
+    { +8.500000e+02, +1.287162e-01, +7.449347e+03, -3.087744e+06, +3.244201e+06, +3.630349e+06, -2.701596e+06, +1.754616e+03, +2.262956e+03, +7.769032e+00, -9.745939e-03, +2.631348e-06, +2.639132e-05, -3.511684e-09, +2.854096e-14, +3.000000e+06, +3.703782e+03, +3.800333e+05, -2.925560e-01, +4.919090e+02, -1.566512e+03 },
+    { +9.000000e+02, +1.367531e-01, +7.579230e+03, -3.487596e+06, +3.333711e+06, +3.743970e+06, -3.077336e+06, +1.783104e+03, +2.282748e+03, +7.312447e+00, -8.559550e-03, +2.468078e-06, +2.132826e-05, -3.038610e-09, +2.081550e-14, +3.000000e+06, +3.468104e+03, +4.051736e+05, -2.034783e-01, +4.869841e+02, -1.384555e+03 },
+    { +9.500000e+02, +1.447293e-01, +7.703280e+03, -3.893609e+06, +3.424506e+06, +3.858694e+06, -3.459422e+06, +1.813687e+03, +2.306766e+03, +6.909452e+00, -7.591560e-03, +2.325851e-06, +1.756753e-05, -2.664250e-09, +1.536605e-14, +3.000000e+06, +3.263992e+03, +4.299502e+05, -1.457733e-01, +4.832342e+02, -1.221284e+03 },
+    { +1.000000e+03, +1.526587e-01, +7.822273e+03, -4.305556e+06, +3.516717e+06, +3.974693e+06, -3.847580e+06, +1.845559e+03, +2.333564e+03, +6.550558e+00, -6.788108e-03, +2.200474e-06, +1.469315e-05, -2.360955e-09, +1.143144e-14, +3.000000e+06, +3.084839e+03, +4.544476e+05, -1.070666e-01, +4.803078e+02, -1.072883e+03 },
+    { +1.050000e+03, +1.605516e-01, +7.936814e+03, -4.723230e+06, +3.610425e+06, +4.092080e+06, -4.241575e+06, +1.878143e+03, +2.362149e+03, +6.228527e+00, -6.111848e-03, +2.088876e-06, +1.244547e-05, -2.110584e-09, +8.536663e-15, +3.000000e+06, +2.925902e+03, +4.787263e+05, -8.034261e-02, +4.779768e+02, -9.365908e+02 },
+    { +1.100000e+03, +1.684153e-01, +8.047383e+03, -5.146441e+06, +3.705680e+06, +4.210926e+06, -4.641195e+06, +1.911007e+03, +2.391808e+03, +5.937704e+00, -5.535976e-03, +1.988742e-06, +1.065465e-05, -1.900714e-09, +6.373866e-15, +3.000000e+06, +2.783657e+03, +5.028304e+05, -6.143240e-02, +4.760874e+02, -8.103404e+02 },
+    { +1.150000e+03, +1.762553e-01, +8.154368e+03, -5.575019e+06, +3.802504e+06, +4.331270e+06, -5.046253e+06, +1.943821e+03, +2.422017e+03, +5.673588e+00, -5.040709e-03, +1.898278e-06, +9.205359e-06, -1.722538e-09, +4.737274e-15, +3.000000e+06, +2.655411e+03, +5.267932e+05, -4.776236e-02, +4.745326e+02, -6.925466e+02 },
+    { +1.200000e+03, +1.840759e-01, +8.258090e+03, -6.008806e+06, +3.900902e+06, +4.453130e+06, -5.456578e+06, +1.976326e+03, +2.452377e+03, +5.432540e+00, -4.611107e-03, +1.816068e-06, +8.016759e-06, -1.569632e-09, +3.485742e-15, +3.000000e+06, +2.539061e+03, +5.506401e+05, -3.769214e-02, +4.732359e+02, -5.819677e+02 },
+    { +1.250000e+03, +1.918805e-01, +8.358814e+03, -6.447654e+06, +4.000864e+06, +4.576505e+06, -5.872012e+06, +2.008320e+03, +2.482587e+03, +5.211576e+00, -4.235666e-03, +1.740974e-06, +7.030728e-06, -1.437190e-09, +2.520311e-15, +3.000000e+06, +2.432928e+03, +5.743910e+05, -3.014754e-02, +4.721419e+02, -4.776138e+02 },
+    { +1.273000e+03, +1.954660e-01, +8.404204e+03, -6.651186e+06, +4.047365e+06, +4.633763e+06, -6.064788e+06, +2.022822e+03, +2.496367e+03, +5.115980e+00, -4.078594e-03, +1.708559e-06, +6.632967e-06, -1.382097e-09, +2.152018e-15, +3.000000e+06, +2.387154e+03, +5.852885e+05, -2.731731e-02, +4.716949e+02, -4.314751e+02 },
+    // P = 4.0 MPa
+    { +2.728630e+02, +9.982016e-04, -4.328844e+00, +3.363704e+00, -1.177818e+03, +2.814989e+03, +3.996170e+03, +4.199451e+03, +4.201267e+03, +1.001802e+03, +5.809777e-02, +5.052288e-07, -1.771898e-02, -3.779049e-09, -1.183316e-15, +4.000000e+06, -1.149930e+05, +1.979301e+06, +3.338190e+04, +1.427185e+04, +9.175647e+03 },
+    { +2.750000e+02, +9.981172e-04, +2.842327e+01, -2.209728e+01, +7.794303e+03, +1.178677e+04, +3.970372e+03, +4.195252e+03, +4.195508e+03, +1.001886e+03, +2.157706e-02, +4.975235e-07, -1.648765e-02, -3.438555e-09, -1.139821e-15, +4.000000e+06, -4.336893e+04, +2.009955e+06, +3.254428e+04, +1.369178e+04, +9.255418e+03 },
+    { +2.800000e+02, +9.982047e-04, +1.039220e+02, -3.539538e+02, +2.874420e+04, +3.273702e+04, +3.638865e+03, +4.183524e+03, +4.185258e+03, +1.001799e+03, -5.473811e-02, +4.820709e-07, -1.415004e-02, -2.768799e-09, -1.061948e-15, +4.000000e+06, +1.135478e+05, +2.074384e+06, +3.068536e+04, +1.243320e+04, +9.479175e+03 },
+    { +2.850000e+02, +9.986460e-04, +1.779345e+02, -1.060956e+03, +4.965038e+04, +5.364496e+04, +2.933627e+03, +4.169551e+03, +4.178390e+03, +1.001356e+03, -1.208484e-01, +4.696145e-07, -1.237079e-02, -2.232320e-09, -1.008834e-15, +4.000000e+06, +2.573353e+05, +2.129406e+06, +2.893119e+04, +1.129932e+04, +9.740812e+03 },
+    { +2.900000e+02, +9.993972e-04, +2.505623e+02, -2.135762e+03, +7.052732e+04, +7.452491e+04, +1.861827e+03, +4.153713e+03, +4.173928e+03, +1.000603e+03, -1.790931e-01, +4.595888e-07, -1.098171e-02, -1.791601e-09, -9.732010e-16, +4.000000e+06, +3.896812e+05, +2.175858e+06, +2.725437e+04, +1.027753e+04, +1.002523e+04 },
+    { +2.950000e+02, +1.000425e-03, +3.218880e+02, -3.571526e+03, +9.138543e+04, +9.538713e+04, +4.301735e+02, +4.136280e+03, +4.171209e+03, +9.995753e+02, -2.311334e-01, +4.515805e-07, -9.874479e-03, -1.421957e-09, -9.504047e-16, +4.000000e+06, +5.118321e+05, +2.214445e+06, +2.564120e+04, +9.358366e+03, +1.032055e+04 },
+    { +3.000000e+02, +1.001703e-03, +3.919804e+02, -5.361810e+03, +1.122323e+05, +1.162391e+05, -1.354998e+03, +4.117452e+03, +4.169768e+03, +9.983001e+02, -2.781856e-01, +4.452792e-07, -8.976577e-03, -1.106451e-09, -9.374191e-16, +4.000000e+06, +6.247441e+05, +2.245782e+06, +2.408591e+04, +8.534160e+03, +1.061785e+04 },
+    { +3.050000e+02, +1.003210e-03, +4.608986e+02, -7.500514e+03, +1.330735e+05, +1.370864e+05, -3.487674e+03, +4.097389e+03, +4.169274e+03, +9.968002e+02, -3.211637e-01, +4.404460e-07, -8.237877e-03, -8.330282e-10, -9.322330e-16, +4.000000e+06, +7.291783e+05, +2.270426e+06, +2.258710e+04, +7.798192e+03, +1.091054e+04 },
+    { +3.100000e+02, +1.004930e-03, +5.286941e+02, -9.981834e+03, +1.539133e+05, +1.579330e+05, -5.962113e+03, +4.076230e+03, +4.169495e+03, +9.950941e+02, -3.607698e-01, +4.368937e-07, -7.622745e-03, -5.928188e-10, -9.334885e-16, +4.000000e+06, +8.257610e+05, +2.288886e+06, +2.114548e+04, +7.144201e+03, +1.119390e+04 },
+    { +3.150000e+02, +1.006849e-03, +5.954129e+02, -1.280022e+04, +1.747549e+05, +1.787823e+05, -8.772820e+03, +4.054105e+03, +4.170268e+03, +9.931972e+02, -3.975535e-01, +4.344737e-07, -7.105257e-03, -3.791162e-10, -9.402597e-16, +4.000000e+06, +9.150231e+05, +2.301635e+06, +1.976254e+04, +6.566152e+03, +1.146456e+04 },
+    { +3.200000e+02, +1.008957e-03, +6.610968e+02, -1.595035e+04, +1.956006e+05, +1.996365e+05, -1.191452e+04, +4.031134e+03, +4.171484e+03, +9.911225e+02, -4.319528e-01, +4.330671e-07, -6.666180e-03, -1.867249e-10, -9.519155e-16, +4.000000e+06, +9.974269e+05, +2.309111e+06, +1.843985e+04, +6.058164e+03, +1.172014e+04 },
+    { +3.250000e+02, +1.011244e-03, +7.257841e+02, -1.942710e+04, +2.164527e+05, +2.204977e+05, -1.538213e+04, +4.007435e+03, +4.173076e+03, +9.888810e+02, -4.643216e-01, +4.325779e-07, -6.291005e-03, -1.153580e-11, -9.680316e-16, +4.000000e+06, +1.073383e+06, +2.311723e+06, +1.717861e+04, +5.614494e+03, +1.195905e+04 },
+    { +3.300000e+02, +1.013703e-03, +7.895107e+02, -2.322557e+04, +2.373130e+05, +2.413678e+05, -1.917076e+04, +3.983121e+03, +4.175007e+03, +9.864822e+02, -4.949507e-01, +4.329286e-07, -5.968628e-03, +1.497605e-10, -9.883344e-16, +4.000000e+06, +1.143262e+06, +2.309850e+06, +1.597953e+04, +5.229574e+03, +1.218022e+04 },
+    { +3.350000e+02, +1.016328e-03, +8.523105e+02, -2.734100e+04, +2.581830e+05, +2.622483e+05, -2.327569e+04, +3.958303e+03, +4.177262e+03, +9.839340e+02, -5.240815e-01, +4.340568e-07, -5.690454e-03, +2.998741e-10, -1.012664e-15, +4.000000e+06, +1.207403e+06, +2.303846e+06, +1.484275e+04, +4.898052e+03, +1.238299e+04 },
+    { +3.400000e+02, +1.019115e-03, +9.142157e+02, -3.176883e+04, +2.790645e+05, +2.831410e+05, -2.769237e+04, +3.933083e+03, +4.179843e+03, +9.812435e+02, -5.519176e-01, +4.359125e-07, -5.449752e-03, +4.410594e-10, -1.040949e-15, +4.000000e+06, +1.266120e+06, +2.294038e+06, +1.376787e+04, +4.614824e+03, +1.256700e+04 },
+    { +3.450000e+02, +1.022059e-03, +9.752572e+02, -3.650465e+04, +2.999591e+05, +3.040473e+05, -3.241641e+04, +3.907561e+03, +4.182763e+03, +9.784167e+02, -5.786325e-01, +4.384557e-07, -5.241211e-03, +5.752195e-10, -1.073193e-15, +4.000000e+06, +1.319706e+06, +2.280732e+06, +1.275401e+04, +4.375073e+03, +1.273211e+04 },
+    { +3.500000e+02, +1.025159e-03, +1.035465e+03, -4.154419e+04, +3.208686e+05, +3.249692e+05, -3.744355e+04, +3.881829e+03, +4.186044e+03, +9.754588e+02, -6.043762e-01, +4.416557e-07, -5.060607e-03, +7.039859e-10, -1.109459e-15, +4.000000e+06, +1.368433e+06, +2.264207e+06, +1.179986e+04, +4.174284e+03, +1.287834e+04 },
+    { +3.550000e+02, +1.028411e-03, +1.094868e+03, -4.688336e+04, +3.417948e+05, +3.459084e+05, -4.276972e+04, +3.855969e+03, +4.189712e+03, +9.723744e+02, -6.292795e-01, +4.454890e-07, -4.904559e-03, +8.287788e-10, -1.149870e-15, +4.000000e+06, +1.412559e+06, +2.244724e+06, +1.090380e+04, +4.008256e+03, +1.300582e+04 },
+    { +3.600000e+02, +1.031814e-03, +1.153494e+03, -5.251819e+04, +3.627397e+05, +3.668670e+05, -4.839094e+04, +3.830061e+03, +4.193798e+03, +9.691672e+02, -6.534582e-01, +4.499390e-07, -4.770353e-03, +9.508542e-10, -1.194598e-15, +4.000000e+06, +1.452326e+06, +2.222524e+06, +1.006394e+04, +3.873107e+03, +1.311478e+04 },
+    { +3.650000e+02, +1.035367e-03, +1.211371e+03, -5.844488e+04, +3.837057e+05, +3.878471e+05, -5.430341e+04, +3.804174e+03, +4.198334e+03, +9.658408e+02, -6.770158e-01, +4.549949e-07, -4.655801e-03, +1.071342e-09, -1.243867e-15, +4.000000e+06, +1.487963e+06, +2.197827e+06, +9.278193e+03, +3.765268e+03, +1.320549e+04 },
+    { +3.700000e+02, +1.039071e-03, +1.268526e+03, -6.465973e+04, +4.046949e+05, +4.088511e+05, -6.050345e+04, +3.778369e+03, +4.203354e+03, +9.623980e+02, -7.000460e-01, +4.606515e-07, -4.559139e-03, +1.191278e-09, -1.297955e-15, +4.000000e+06, +1.519687e+06, +2.170839e+06, +8.544336e+03, +3.681471e+03, +1.327829e+04 },
+    { +3.750000e+02, +1.042926e-03, +1.324984e+03, -7.115921e+04, +4.257098e+05, +4.298815e+05, -6.698751e+04, +3.752703e+03, +4.208891e+03, +9.588411e+02, -7.226346e-01, +4.669084e-07, -4.478952e-03, +1.311625e-09, -1.357189e-15, +4.000000e+06, +1.547701e+06, +2.141748e+06, +7.860059e+03, +3.618742e+03, +1.333354e+04 },
+    { +3.800000e+02, +1.046932e-03, +1.380771e+03, -7.793990e+04, +4.467533e+05, +4.509410e+05, -7.375217e+04, +3.727225e+03, +4.214982e+03, +9.551722e+02, -7.448611e-01, +4.737699e-07, -4.414108e-03, +1.433301e-09, -1.421956e-15, +4.000000e+06, +1.572200e+06, +2.110729e+06, +7.223008e+03, +3.574377e+03, +1.337160e+04 },
+    { +3.850000e+02, +1.051090e-03, +1.435913e+03, -8.499851e+04, +4.678280e+05, +4.720323e+05, -8.079415e+04, +3.701976e+03, +4.221659e+03, +9.513930e+02, -7.667998e-01, +4.812451e-07, -4.363716e-03, +1.557195e-09, -1.492702e-15, +4.000000e+06, +1.593366e+06, +2.077943e+06, +6.630820e+03, +3.545932e+03, +1.339289e+04 },
+    { +3.900000e+02, +1.055404e-03, +1.490433e+03, -9.233188e+04, +4.889370e+05, +4.931586e+05, -8.811027e+04, +3.676993e+03, +4.228958e+03, +9.475046e+02, -7.885212e-01, +4.893470e-07, -4.327089e-03, +1.684182e-09, -1.569942e-15, +4.000000e+06, +1.611374e+06, +2.043539e+06, +6.081147e+03, +3.531198e+03, +1.339778e+04 },
+    { +3.950000e+02, +1.059874e-03, +1.544356e+03, -9.993698e+04, +5.100835e+05, +5.143230e+05, -9.569748e+04, +3.652307e+03, +4.236915e+03, +9.435080e+02, -8.100927e-01, +4.980935e-07, -4.303716e-03, +1.815145e-09, -1.654267e-15, +4.000000e+06, +1.626387e+06, +2.007655e+06, +5.571683e+03, +3.528188e+03, +1.338668e+04 },
+    { +4.000000e+02, +1.064505e-03, +1.597704e+03, -1.078109e+05, +5.312709e+05, +5.355289e+05, -1.035529e+05, +3.627945e+03, +4.245566e+03, +9.394038e+02, -8.315798e-01, +5.075066e-07, -4.293245e-03, +1.950985e-09, -1.746351e-15, +4.000000e+06, +1.638560e+06, +1.970418e+06, +5.100176e+03, +3.535116e+03, +1.336000e+04 },
+    { +4.100000e+02, +1.074260e-03, +1.702772e+03, -1.243541e+05, +5.737826e+05, +5.780797e+05, -1.200570e+05, +3.580276e+03, +4.265099e+03, +9.308733e+02, -8.745555e-01, +5.284443e-07, -4.310303e-03, +2.241096e-09, -1.956988e-15, +4.000000e+06, +1.654962e+06, +1.892347e+06, +4.262391e+03, +3.572541e+03, +1.326143e+04 },
+    { +4.200000e+02, +1.084703e-03, +1.805817e+03, -1.419404e+05, +6.165029e+05, +6.208417e+05, -1.376016e+05, +3.534117e+03, +4.287878e+03, +9.219113e+02, -9.179550e-01, +5.524335e-07, -4.378161e-03, +2.562739e-09, -2.209443e-15, +4.000000e+06, +1.661657e+06, +1.810173e+06, +3.551337e+03, +3.632571e+03, +1.310518e+04 },
+    { +4.300000e+02, +1.095877e-03, +1.907015e+03, -1.605507e+05, +6.594657e+05, +6.638493e+05, -1.561672e+05, +3.489553e+03, +4.314266e+03, +9.125110e+02, -9.622943e-01, +5.798361e-07, -4.498772e-03, +2.925546e-09, -2.513688e-15, +4.000000e+06, +1.659597e+06, +1.724625e+06, +2.951995e+03, +3.706503e+03, +1.289424e+04 },
+    { +4.400000e+02, +1.107836e-03, +2.006538e+03, -1.801676e+05, +7.027091e+05, +7.071404e+05, -1.757363e+05, +3.446632e+03, +4.344684e+03, +9.026604e+02, -1.008120e+00, +6.111205e-07, -4.676262e-03, +3.341284e-09, -2.882937e-15, +4.000000e+06, +1.649625e+06, +1.636338e+06, +2.450840e+03, +3.787418e+03, +1.263149e+04 },
+    { +4.500000e+02, +1.120647e-03, +2.104558e+03, -2.007755e+05, +7.462755e+05, +7.507581e+05, -1.962930e+05, +3.405382e+03, +4.379642e+03, +8.923417e+02, -1.056031e+00, +6.468873e-07, -4.917296e-03, +3.824823e-09, -3.334928e-15, +4.000000e+06, +1.632481e+06, +1.545864e+06, +2.035836e+03, +3.869833e+03, +1.231971e+04 },
+    { +4.600000e+02, +1.134391e-03, +2.201247e+03, -2.223606e+05, +7.902129e+05, +7.947505e+05, -2.178230e+05, +3.365815e+03, +4.419767e+03, +8.815306e+02, -1.106710e+00, +6.879068e-07, -5.231744e-03, +4.395514e-09, -3.893837e-15, +4.000000e+06, +1.608808e+06, +1.453685e+06, +1.696368e+03, +3.949408e+03, +1.196159e+04 },
+    { +4.700000e+02, +1.149167e-03, +2.296781e+03, -2.449107e+05, +8.345766e+05, +8.391732e+05, -2.403140e+05, +3.327939e+03, +4.465846e+03, +8.701956e+02, -1.160957e+00, +7.351733e-07, -5.633790e-03, +5.079227e-09, -4.593211e-15, +4.000000e+06, +1.579161e+06, +1.360224e+06, +1.423166e+03, +4.022712e+03, +1.155972e+04 },
+    { +4.800000e+02, +1.165099e-03, +2.391346e+03, -2.684158e+05, +8.794302e+05, +8.840906e+05, -2.637554e+05, +3.291766e+03, +4.518882e+03, +8.582963e+02, -1.219744e+00, +7.899849e-07, -6.143703e-03, +5.911497e-09, -5.480607e-15, +4.000000e+06, +1.544010e+06, +1.265847e+06, +1.208209e+03, +4.087023e+03, +1.111661e+04 },
+    { +4.900000e+02, +1.182338e-03, +2.485136e+03, -2.928677e+05, +9.248490e+05, +9.295784e+05, -2.881384e+05, +3.257324e+03, +4.580183e+03, +8.457816e+02, -1.284287e+00, +8.540632e-07, -6.790717e-03, +6.942516e-09, -6.625131e-15, +4.000000e+06, +1.503737e+06, +1.170874e+06, +1.044646e+03, +4.140172e+03, +1.063468e+04 },
+    { +5.000000e+02, +1.201077e-03, +2.578368e+03, -3.182606e+05, +9.709232e+05, +9.757275e+05, -3.134563e+05, +3.224662e+03, +4.651488e+03, +8.325862e+02, -1.356157e+00, +9.297375e-07, -7.617812e-03, +8.245427e-09, -8.130166e-15, +4.000000e+06, +1.458644e+06, +1.075572e+06, +9.267280e+02, +4.180408e+03, +1.011622e+04 },
+    { +5.100000e+02, +1.221557e-03, +2.671282e+03, -3.445909e+05, +1.017763e+06, +1.022649e+06, -3.397047e+05, +3.193872e+03, +4.735164e+03, +8.186271e+02, -1.437456e+00, +1.020239e-06, -8.689948e-03, +9.930649e-09, -1.015581e-14, +4.000000e+06, +1.408940e+06, +9.801621e+05, +8.497798e+02, +4.206281e+03, +9.563307e+03 },
+    { +5.200000e+02, +1.244097e-03, +2.764163e+03, -3.718582e+05, +1.065507e+06, +1.070483e+06, -3.668818e+05, +3.165104e+03, +4.834537e+03, +8.037961e+02, -1.531105e+00, +1.130192e-06, -1.010892e-02, +1.217195e-08, -1.296043e-14, +4.000000e+06, +1.354730e+06, +8.848053e+05, +8.102236e+02, +4.216544e+03, +8.977651e+03 },
+    { +5.235040e+02, +1.252555e-03, +2.796762e+03, -3.816347e+05, +1.082481e+06, +1.087491e+06, -3.766245e+05, +3.155543e+03, +4.873905e+03, +7.983678e+02, -1.567571e+00, +1.174502e-06, -1.071626e-02, +1.313709e-08, -1.420067e-14, +4.000000e+06, +1.334669e+06, +8.514250e+05, +8.047332e+02, +4.216235e+03, +8.764921e+03 },
+    { +5.235040e+02, +1.252555e-03, +2.796762e+03, -3.816347e+05, +1.082481e+06, +1.087491e+06, -3.766245e+05, +3.155543e+03, +4.873905e+03, +7.983678e+02, -1.567571e+00, +1.174502e-06, -1.071626e-02, +1.313709e-08, -1.420067e-14, +4.000000e+06, +1.334669e+06, +8.514250e+05, +8.047332e+02, +4.216235e+03, +8.764921e+03 },
+    { +5.300000e+02, +5.114358e-02, +6.116898e+03, -6.207829e+05, +2.621173e+06, +2.825747e+06, -4.162086e+05, +2.306748e+03, +3.679525e+03, +1.955280e+01, -7.793259e-02, +6.133332e-06, +1.317743e-03, -4.675134e-08, +1.011703e-12, +4.000000e+06, +1.270640e+04, +1.630435e+05, -4.777216e+01, +9.010698e+02, -4.384942e+03 },
+    { +5.400000e+02, +5.310309e-02, +6.182373e+03, -6.901234e+05, +2.648358e+06, +2.860771e+06, -4.777110e+05, +2.156480e+03, +3.351661e+03, +1.883130e+01, -6.704130e-02, +5.726443e-06, +9.084850e-04, -3.569009e-08, +7.645589e-13, +4.000000e+06, +1.170732e+04, +1.746285e+05, -3.101504e+01, +8.154133e+02, -4.071516e+03 },
+    { +5.500000e+02, +5.493872e-02, +6.241774e+03, -7.595909e+05, +2.673385e+06, +2.893140e+06, -5.398360e+05, +2.059472e+03, +3.134610e+03, +1.820210e+01, -5.916895e-02, +5.405594e-06, +6.846296e-04, -2.894633e-08, +6.077835e-13, +4.000000e+06, +1.094587e+04, +1.849935e+05, -2.289546e+01, +7.629456e+02, -3.847855e+03 },
+    { +5.600000e+02, +5.668289e-02, +6.296756e+03, -8.292634e+05, +2.696920e+06, +2.923652e+06, -6.025319e+05, +1.988747e+03, +2.975149e+03, +1.764201e+01, -5.308724e-02, +5.140653e-06, +5.410359e-04, -2.429816e-08, +4.978141e-13, +4.000000e+06, +1.032694e+04, +1.945278e+05, -1.794990e+01, +7.249312e+02, -3.664478e+03 },
+    { +5.700000e+02, +5.835540e-02, +6.348283e+03, -8.991812e+05, +2.719340e+06, +2.952762e+06, -6.657596e+05, +1.934170e+03, +2.851793e+03, +1.713638e+01, -4.820604e-02, +4.915588e-06, +4.406835e-04, -2.087557e-08, +4.162678e-13, +4.000000e+06, +9.806769e+03, +2.034344e+05, -1.449944e+01, +6.950016e+02, -3.504663e+03 },
+    { +5.800000e+02, +5.996990e-02, +6.396999e+03, -9.693678e+05, +2.740892e+06, +2.980771e+06, -7.294882e+05, +1.890930e+03, +2.753647e+03, +1.667503e+01, -4.418564e-02, +4.720504e-06, +3.669408e-04, -1.825013e-08, +3.535951e-13, +4.000000e+06, +9.360366e+03, +2.118418e+05, -1.191945e+01, +6.704774e+02, -3.361563e+03 },
+    { +5.900000e+02, +6.153647e-02, +6.443371e+03, -1.039838e+06, +2.761751e+06, +3.007897e+06, -7.936918e+05, +1.856227e+03, +2.674178e+03, +1.625053e+01, -4.080858e-02, +4.548755e-06, +3.109017e-04, -1.617688e-08, +3.041590e-13, +4.000000e+06, +8.971374e+03, +2.198404e+05, -9.920178e+00, +6.499467e+02, -3.231641e+03 },
+    { +6.000000e+02, +6.306278e-02, +6.487752e+03, -1.110600e+06, +2.782051e+06, +3.034302e+06, -8.583490e+05, +1.828191e+03, +2.609032e+03, +1.585721e+01, -3.792658e-02, +4.395642e-06, +2.672303e-04, -1.450234e-08, +2.643606e-13, +4.000000e+06, +8.628222e+03, +2.274980e+05, -8.338295e+00, +6.325215e+02, -3.112645e+03 },
+    { +6.100000e+02, +6.455487e-02, +6.530420e+03, -1.181661e+06, +2.801895e+06, +3.060115e+06, -9.234411e+05, +1.805475e+03, +2.555125e+03, +1.549070e+01, -3.543430e-02, +4.257722e-06, +2.324975e-04, -1.312457e-08, +2.317811e-13, +4.000000e+06, +8.322360e+03, +2.348674e+05, -7.068647e+00, +6.175793e+02, -3.002936e+03 },
+    { +6.200000e+02, +6.601755e-02, +6.571592e+03, -1.253023e+06, +2.821365e+06, +3.085435e+06, -9.889524e+05, +1.787064e+03, +2.510186e+03, +1.514749e+01, -3.325460e-02, +4.132399e-06, +2.043956e-04, -1.197310e-08, +2.047335e-13, +4.000000e+06, +8.047288e+03, +2.419902e+05, -6.038137e+00, +6.046564e+02, -2.901230e+03 },
+    { +6.300000e+02, +6.745472e-02, +6.611447e+03, -1.324687e+06, +2.840524e+06, +3.110343e+06, -1.054869e+06, +1.772174e+03, +2.472504e+03, +1.482476e+01, -3.132969e-02, +4.017675e-06, +1.813186e-04, -1.099771e-08, +1.820065e-13, +4.000000e+06, +7.797965e+03, +2.489002e+05, -5.193709e+00, +5.933959e+02, -2.806484e+03 },
+    { +6.400000e+02, +6.886961e-02, +6.650128e+03, -1.396656e+06, +2.859426e+06, +3.134905e+06, -1.121177e+06, +1.760192e+03, +2.440761e+03, +1.452019e+01, -2.961534e-02, +3.911981e-06, +1.621193e-04, -1.016170e-08, +1.627095e-13, +4.000000e+06, +7.570420e+03, +2.556249e+05, -4.495852e+00, +5.835177e+02, -2.717833e+03 },
+    { +6.500000e+02, +7.026486e-02, +6.687757e+03, -1.468927e+06, +2.878115e+06, +3.159174e+06, -1.187868e+06, +1.750632e+03, +2.413930e+03, +1.423187e+01, -2.807719e-02, +3.814068e-06, +1.459604e-04, -9.437720e-09, +1.461747e-13, +4.000000e+06, +7.361481e+03, +2.621872e+05, -3.914624e+00, +5.747984e+02, -2.634553e+03 },
+    { +6.750000e+02, +7.368094e-02, +6.777847e+03, -1.650923e+06, +2.924124e+06, +3.218848e+06, -1.356199e+06, +1.734949e+03, +2.363407e+03, +1.357203e+01, -2.483755e-02, +3.597123e-06, +1.151438e-04, -7.992942e-09, +1.138500e-13, +4.000000e+06, +6.904838e+03, +2.780000e+05, -2.833325e+00, +5.569722e+02, -2.446060e+03 },
+    { +7.000000e+02, +7.701412e-02, +6.863152e+03, -1.834777e+06, +2.969430e+06, +3.277486e+06, -1.526720e+06, +1.727815e+03, +2.330018e+03, +1.298463e+01, -2.224428e-02, +3.411402e-06, +9.350489e-05, -6.913418e-09, +9.052570e-14, +4.000000e+06, +6.520569e+03, +2.931346e+05, -2.109106e+00, +5.433341e+02, -2.280201e+03 },
+    { +7.250000e+02, +8.028277e-02, +6.944510e+03, -2.020455e+06, +3.014315e+06, +3.335446e+06, -1.699324e+06, +1.726572e+03, +2.308395e+03, +1.245597e+01, -2.011447e-02, +3.249441e-06, +7.765121e-05, -6.076731e-09, +7.314698e-14, +4.000000e+06, +6.190133e+03, +3.077452e+05, -1.607196e+00, +5.326273e+02, -2.131917e+03 },
+    { +7.500000e+02, +8.350004e-02, +7.022525e+03, -2.207918e+06, +3.058976e+06, +3.392976e+06, -1.873918e+06, +1.729524e+03, +2.295154e+03, +1.197604e+01, -1.832992e-02, +3.106162e-06, +6.563769e-05, -5.409342e-09, +5.986696e-14, +4.000000e+06, +5.901148e+03, +3.219407e+05, -1.249068e+00, +5.240394e+02, -1.997630e+03 },
+    { +7.750000e+02, +8.667560e-02, +7.097653e+03, -2.397128e+06, +3.103553e+06, +3.450255e+06, -2.050426e+06, +1.735556e+03, +2.288066e+03, +1.153727e+01, -1.681055e-02, +2.977956e-06, +5.628294e-05, -4.864588e-09, +4.951029e-14, +4.000000e+06, +5.644994e+03, +3.358008e+05, -9.870830e-01, +5.170261e+02, -1.874738e+03 },
+    { +8.000000e+02, +8.981677e-02, +7.170246e+03, -2.588047e+06, +3.148151e+06, +3.507418e+06, -2.228779e+06, +1.743902e+03, +2.285616e+03, +1.113378e+01, -1.549996e-02, +2.862171e-06, +4.883418e-05, -4.411496e-09, +4.129721e-14, +4.000000e+06, +5.415455e+03, +3.493851e+05, -7.912881e-01, +5.112110e+02, -1.761303e+03 },
+    { +8.250000e+02, +9.292921e-02, +7.240588e+03, -2.780636e+06, +3.192849e+06, +3.564565e+06, -2.408919e+06, +1.754024e+03, +2.286733e+03, +1.076088e+01, -1.435716e-02, +2.756797e-06, +4.279207e-05, -4.028723e-09, +3.469238e-14, +4.000000e+06, +5.207912e+03, +3.627398e+05, -6.422422e-01, +5.063268e+02, -1.655845e+03 },
+    { +8.500000e+02, +9.601739e-02, +7.308905e+03, -2.974862e+06, +3.237708e+06, +3.621778e+06, -2.590792e+06, +1.765530e+03, +2.290643e+03, +1.041478e+01, -1.335152e-02, +2.660276e-06, +3.781383e-05, -3.701094e-09, +2.931757e-14, +4.000000e+06, +5.018846e+03, +3.759008e+05, -5.269608e-01, +5.021786e+02, -1.557212e+03 },
+    { +9.000000e+02, +1.021346e-01, +7.440198e+03, -3.368086e+06, +3.328092e+06, +3.736631e+06, -2.959547e+06, +1.791593e+03, +2.304675e+03, +9.791003e+00, -1.166329e-02, +2.489103e-06, +3.014661e-05, -3.169713e-09, +2.123442e-14, +4.000000e+06, +4.685738e+03, +4.017512e+05, -3.647680e-01, +4.955447e+02, -1.376930e+03 },
+    { +9.500000e+02, +1.081897e-01, +7.565316e+03, -3.767468e+06, +3.419583e+06, +3.852341e+06, -3.334709e+06, +1.820452e+03, +2.324525e+03, +9.243024e+00, -1.030221e-02, +2.341331e-06, +2.457498e-05, -2.757521e-09, +1.559413e-14, +4.000000e+06, +4.400152e+03, +4.271074e+05, -2.604845e-01, +4.905119e+02, -1.214990e+03 },
+    { +1.000000e+03, +1.141974e-01, +7.685138e+03, -4.172780e+06, +3.512357e+06, +3.969147e+06, -3.715991e+06, +1.851057e+03, +2.348208e+03, +8.756768e+00, -9.182843e-03, +2.211967e-06, +2.038892e-05, -2.428773e-09, +1.155465e-14, +4.000000e+06, +4.151438e+03, +4.520863e+05, -1.908990e-01, +4.865936e+02, -1.067630e+03 },
+    { +1.050000e+03, +1.201680e-01, +7.800333e+03, -4.583818e+06, +3.606532e+06, +4.087204e+06, -4.103146e+06, +1.882688e+03, +2.374406e+03, +8.321683e+00, -8.247453e-03, +2.097446e-06, +1.715994e-05, -2.160772e-09, +8.601120e-15, +4.000000e+06, +3.932142e+03, +4.767704e+05, -1.430323e-01, +4.834773e+02, -9.321436e+02 },
+    { +1.100000e+03, +1.261092e-01, +7.911427e+03, -5.000393e+06, +3.702177e+06, +4.206614e+06, -4.495956e+06, +1.914820e+03, +2.402199e+03, +7.929638e+00, -7.455490e-03, +1.995132e-06, +1.461548e-05, -1.938396e-09, +6.405097e-15, +4.000000e+06, +3.736840e+03, +5.012200e+05, -1.092506e-01, +4.809538e+02, -8.065120e+02 },
+    { +1.150000e+03, +1.320265e-01, +8.018840e+03, -5.422333e+06, +3.799333e+06, +4.327439e+06, -4.894227e+06, +1.947060e+03, +2.430921e+03, +7.574237e+00, -6.777541e-03, +1.903022e-06, +1.257473e-05, -1.751170e-09, +4.749741e-15, +4.000000e+06, +3.561462e+03, +5.254800e+05, -8.487674e-02, +4.788784e+02, -6.891895e+02 },
+    { +1.200000e+03, +1.379243e-01, +8.122915e+03, -5.849482e+06, +3.898016e+06, +4.449713e+06, -5.297784e+06, +1.979108e+03, +2.460079e+03, +7.250352e+00, -6.191712e-03, +1.819555e-06, +1.091346e-05, -1.591602e-09, +3.487775e-15, +4.000000e+06, +3.402871e+03, +5.495849e+05, -6.694649e-02, +4.771484e+02, -5.789657e+02 },
+    { +1.250000e+03, +1.438060e-01, +8.223933e+03, -6.281692e+06, +3.998224e+06, +4.573448e+06, -5.706468e+06, +2.010734e+03, +2.489305e+03, +6.953811e+00, -5.681347e-03, +1.743493e-06, +9.543821e-06, -1.454186e-09, +2.516754e-15, +4.000000e+06, +3.258600e+03, +5.735612e+05, -5.352698e-02, +4.756892e+02, -4.748758e+02 },
+    { +1.273000e+03, +1.465070e-01, +8.269441e+03, -6.482171e+06, +4.044828e+06, +4.630856e+06, -5.896143e+06, +2.025090e+03, +2.502692e+03, +6.825614e+00, -5.468255e-03, +1.710709e-06, +8.993500e-06, -1.397234e-09, +2.146925e-15, +4.000000e+06, +3.196485e+03, +5.845530e+05, -4.849587e-02, +4.750930e+02, -4.288335e+02 },
+    // P = 5.0 MPa
+    { +2.727880e+02, +9.977031e-04, -5.426505e+00, +5.240884e+00, -1.475045e+03, +3.513471e+03, +4.993757e+03, +4.195014e+03, +4.196682e+03, +1.002302e+03, +5.564781e-02, +5.043296e-07, -1.759702e-02, -3.769546e-09, -1.181170e-15, +5.000000e+06, -1.103402e+05, +1.982830e+06, +3.327097e+04, +1.430800e+04, +9.208079e+03 },
+    { +2.750000e+02, +9.976224e-04, +2.844305e+01, -1.987064e+01, +7.801969e+03, +1.279008e+04, +4.968241e+03, +4.190832e+03, +4.191014e+03, +1.002383e+03, +1.814786e-02, +4.963855e-07, -1.633762e-02, -3.419856e-09, -1.136178e-15, +5.000000e+06, -3.656001e+04, +2.014563e+06, +3.241246e+04, +1.371078e+04, +9.289430e+03 },
+    { +2.800000e+02, +9.977251e-04, +1.038661e+02, -3.517958e+02, +2.873071e+04, +3.371933e+04, +4.636830e+03, +4.179411e+03, +4.181327e+03, +1.002280e+03, -5.750051e-02, +4.810106e-07, -1.403145e-02, -2.756013e-09, -1.058516e-15, +5.000000e+06, +1.195410e+05, +2.078956e+06, +3.057206e+04, +1.245855e+04, +9.511159e+03 },
+    { +2.850000e+02, +9.981783e-04, +1.778129e+02, -1.058852e+03, +4.961783e+04, +5.460872e+04, +3.932039e+03, +4.165702e+03, +4.174881e+03, +1.001825e+03, -1.230764e-01, +4.686074e-07, -1.227441e-02, -2.223635e-09, -1.005457e-15, +5.000000e+06, +2.626429e+05, +2.133982e+06, +2.883396e+04, +1.132874e+04, +9.770929e+03 },
+    { +2.900000e+02, +9.989389e-04, +2.503827e+02, -2.133700e+03, +7.047727e+04, +7.547197e+04, +2.860995e+03, +4.150096e+03, +4.170741e+03, +1.001062e+03, -1.808818e-01, +4.586173e-07, -1.090160e-02, -1.785872e-09, -9.697737e-16, +5.000000e+06, +3.944070e+05, +2.180467e+06, +2.717119e+04, +1.030932e+04, +1.005354e+04 },
+    { +2.950000e+02, +9.999736e-04, +3.216561e+02, -3.569495e+03, +9.131904e+04, +9.631891e+04, +1.430373e+03, +4.132871e+03, +4.168273e+03, +1.000026e+03, -2.325536e-01, +4.506319e-07, -9.806627e-03, -1.418445e-09, -9.468589e-16, +5.000000e+06, +5.160611e+05, +2.219106e+06, +2.557032e+04, +9.391297e+03, +1.034712e+04 },
+    { +3.000000e+02, +1.001257e-03, +3.917008e+02, -5.359802e+03, +1.121504e+05, +1.171567e+05, -3.535187e+02, +4.114232e+03, +4.167029e+03, +9.987449e+02, -2.792911e-01, +4.443437e-07, -8.918179e-03, -1.104670e-09, -9.337068e-16, +5.000000e+06, +6.285476e+05, +2.250510e+06, +2.402585e+04, +8.567352e+03, +1.064274e+04 },
+    { +3.050000e+02, +1.002767e-03, +4.605750e+02, -7.498522e+03, +1.329769e+05, +1.379907e+05, -2.484685e+03, +4.094343e+03, +4.166691e+03, +9.972402e+02, -3.219965e-01, +4.395157e-07, -8.186896e-03, -8.326502e-10, -9.283181e-16, +5.000000e+06, +7.326166e+05, +2.275231e+06, +2.253657e+04, +7.831027e+03, +1.093386e+04 },
+    { +3.100000e+02, +1.004490e-03, +5.283296e+02, -9.979851e+03, +1.538023e+05, +1.588248e+05, -4.957403e+03, +4.073345e+03, +4.167035e+03, +9.955305e+02, -3.613630e-01, +4.359623e-07, -7.577658e-03, -5.936221e-10, -9.293413e-16, +5.000000e+06, +8.288859e+05, +2.293776e+06, +2.110333e+04, +7.176248e+03, +1.121575e+04 },
+    { +3.150000e+02, +1.006410e-03, +5.950099e+02, -1.279824e+04, +1.746299e+05, +1.796619e+05, -7.766191e+03, +4.051370e+03, +4.167905e+03, +9.936312e+02, -3.979336e-01, +4.335357e-07, -7.064898e-03, -3.809488e-10, -9.358537e-16, +5.000000e+06, +9.178796e+05, +2.306615e+06, +1.972776e+04, +6.597121e+03, +1.148506e+04 },
+    { +3.200000e+02, +1.008517e-03, +6.606572e+02, -1.594836e+04, +1.954619e+05, +2.005045e+05, -1.090578e+04, +4.028538e+03, +4.169197e+03, +9.915551e+02, -4.321409e-01, +4.321175e-07, -6.629633e-03, -1.894835e-10, -9.472245e-16, +5.000000e+06, +1.000054e+06, +2.314185e+06, +1.841154e+04, +6.087861e+03, +1.173944e+04 },
+    { +3.250000e+02, +1.010802e-03, +7.253095e+02, -1.942512e+04, +2.163005e+05, +2.213545e+05, -1.437110e+04, +4.004971e+03, +4.170847e+03, +9.893131e+02, -4.643350e-01, +4.316123e-07, -6.257539e-03, -1.515206e-11, -9.630288e-16, +5.000000e+06, +1.075815e+06, +2.316894e+06, +1.715597e+04, +5.642800e+03, +1.197727e+04 },
+    { +3.300000e+02, +1.013259e-03, +7.890024e+02, -2.322357e+04, +2.371472e+05, +2.422135e+05, -1.815728e+04, +3.980780e+03, +4.172821e+03, +9.869146e+02, -4.948031e-01, +4.319429e-07, -5.937650e-03, +1.453292e-10, -9.829909e-16, +5.000000e+06, +1.145529e+06, +2.315121e+06, +1.596185e+04, +5.256422e+03, +1.219749e+04 },
+    { +3.350000e+02, +1.015881e-03, +8.517696e+02, -2.733899e+04, +2.580038e+05, +2.630832e+05, -2.225959e+04, +3.956078e+03, +4.175106e+03, +9.843676e+02, -5.237842e-01, +4.330470e-07, -5.661471e-03, +2.946506e-10, -1.006948e-15, +5.000000e+06, +1.209532e+06, +2.309218e+06, +1.482939e+04, +4.923408e+03, +1.239944e+04 },
+    { +3.400000e+02, +1.018663e-03, +9.136429e+02, -3.176680e+04, +2.788718e+05, +2.839651e+05, -2.667348e+04, +3.930968e+03, +4.177706e+03, +9.816789e+02, -5.514795e-01, +4.348746e-07, -5.422354e-03, +4.350503e-10, -1.034827e-15, +5.000000e+06, +1.268135e+06, +2.299513e+06, +1.375827e+04, +4.638685e+03, +1.258275e+04 },
+    { +3.450000e+02, +1.021602e-03, +9.746533e+02, -3.650259e+04, +2.997528e+05, +3.048608e+05, -3.139458e+04, +3.905550e+03, +4.180634e+03, +9.788546e+02, -5.780607e-01, +4.373858e-07, -5.215049e-03, +5.684184e-10, -1.066624e-15, +5.000000e+06, +1.321627e+06, +2.286311e+06, +1.274766e+04, +4.397451e+03, +1.274727e+04 },
+    { +3.500000e+02, +1.024695e-03, +1.034830e+03, -4.154210e+04, +3.206486e+05, +3.257720e+05, -3.641863e+04, +3.879915e+03, +4.183913e+03, +9.758999e+02, -6.036760e-01, +4.405498e-07, -5.035377e-03, +6.963745e-10, -1.102401e-15, +5.000000e+06, +1.370279e+06, +2.269891e+06, +1.179631e+04, +4.195207e+03, +1.289303e+04 },
+    { +3.550000e+02, +1.027940e-03, +1.094203e+03, -4.688124e+04, +3.415609e+05, +3.467006e+05, -4.174154e+04, +3.854149e+03, +4.187571e+03, +9.728193e+02, -6.284550e-01, +4.443429e-07, -4.879998e-03, +8.203281e-10, -1.142274e-15, +5.000000e+06, +1.414347e+06, +2.250514e+06, +1.090266e+04, +4.027760e+03, +1.302014e+04 },
+    { +3.600000e+02, +1.031336e-03, +1.152799e+03, -5.251604e+04, +3.624917e+05, +3.676484e+05, -4.735937e+04, +3.828329e+03, +4.191638e+03, +9.696166e+02, -6.525120e-01, +4.487485e-07, -4.746223e-03, +9.415252e-10, -1.186409e-15, +5.000000e+06, +1.454071e+06, +2.228420e+06, +1.006485e+04, +3.891234e+03, +1.312882e+04 },
+    { +3.650000e+02, +1.034880e-03, +1.210647e+03, -5.844269e+04, +3.834433e+05, +3.886177e+05, -5.326829e+04, +3.802525e+03, +4.196147e+03, +9.662952e+02, -6.759496e-01, +4.537555e-07, -4.631887e-03, +1.061086e-09, -1.235025e-15, +5.000000e+06, +1.489678e+06, +2.203830e+06, +9.280836e+03, +3.782063e+03, +1.321935e+04 },
+    { +3.700000e+02, +1.038575e-03, +1.267771e+03, -6.465750e+04, +4.044178e+05, +4.096107e+05, -5.946463e+04, +3.776799e+03, +4.201132e+03, +9.628580e+02, -6.988603e-01, +4.593583e-07, -4.535244e-03, +1.180034e-09, -1.288389e-15, +5.000000e+06, +1.521384e+06, +2.176950e+06, +8.548432e+03, +3.696984e+03, +1.329206e+04 },
+    { +3.750000e+02, +1.042419e-03, +1.324199e+03, -7.115693e+04, +4.254178e+05, +4.306299e+05, -6.594484e+04, +3.751209e+03, +4.206627e+03, +9.593073e+02, -7.213291e-01, +4.655564e-07, -4.454889e-03, +1.299323e-09, -1.346822e-15, +5.000000e+06, +1.549392e+06, +2.147968e+06, +7.865359e+03, +3.633022e+03, +1.334730e+04 },
+    { +3.800000e+02, +1.046413e-03, +1.379956e+03, -7.793757e+04, +4.464458e+05, +4.516779e+05, -7.270550e+04, +3.725802e+03, +4.212666e+03, +9.556453e+02, -7.434345e-01, +4.723536e-07, -4.389699e-03, +1.419860e-09, -1.410698e-15, +5.000000e+06, +1.573894e+06, +2.117058e+06, +7.229292e+03, +3.587474e+03, +1.338543e+04 },
+    { +3.850000e+02, +1.050560e-03, +1.435067e+03, -8.499612e+04, +4.675047e+05, +4.727575e+05, -7.974332e+04, +3.700621e+03, +4.219285e+03, +9.518735e+02, -7.652499e-01, +4.797585e-07, -4.338787e-03, +1.542519e-09, -1.480455e-15, +5.000000e+06, +1.595073e+06, +2.084382e+06, +6.637890e+03, +3.557895e+03, +1.340686e+04 },
+    { +3.900000e+02, +1.054860e-03, +1.489556e+03, -9.232943e+04, +4.885974e+05, +4.938717e+05, -8.705513e+04, +3.675702e+03, +4.226517e+03, +9.479931e+02, -7.868450e-01, +4.877838e-07, -4.301464e-03, +1.668164e-09, -1.556591e-15, +5.000000e+06, +1.613102e+06, +2.050089e+06, +6.088829e+03, +3.542077e+03, +1.341197e+04 },
+    { +3.950000e+02, +1.059316e-03, +1.543447e+03, -9.993447e+04, +5.097272e+05, +5.150237e+05, -9.463789e+04, +3.651078e+03, +4.234397e+03, +9.440053e+02, -8.082863e-01, +4.964466e-07, -4.277220e-03, +1.797659e-09, -1.639683e-15, +5.000000e+06, +1.628144e+06, +2.014316e+06, +5.579820e+03, +3.538031e+03, +1.340116e+04 },
+    { +4.000000e+02, +1.063931e-03, +1.596764e+03, -1.078083e+05, +5.308972e+05, +5.362168e+05, -1.024886e+05, +3.626774e+03, +4.242962e+03, +9.399104e+02, -8.296384e-01, +5.057683e-07, -4.265697e-03, +1.931889e-09, -1.730385e-15, +5.000000e+06, +1.640353e+06, +1.977190e+06, +5.108630e+03, +3.543969e+03, +1.337482e+04 },
+    { +4.100000e+02, +1.073652e-03, +1.701765e+03, -1.243513e+05, +5.733723e+05, +5.787406e+05, -1.189831e+05, +3.579212e+03, +4.262293e+03, +9.314007e+02, -8.723258e-01, +5.264970e-07, -4.280068e-03, +2.218272e-09, -1.937726e-15, +5.000000e+06, +1.656849e+06, +1.899346e+06, +4.271121e+03, +3.579549e+03, +1.327715e+04 },
+    { +4.200000e+02, +1.084055e-03, +1.804739e+03, -1.419375e+05, +6.160531e+05, +6.214734e+05, -1.365172e+05, +3.533149e+03, +4.284824e+03, +9.224626e+02, -9.154060e-01, +5.502358e-07, -4.344369e-03, +2.535331e-09, -2.185987e-15, +5.000000e+06, +1.663661e+06, +1.817403e+06, +3.559946e+03, +3.637904e+03, +1.312203e+04 },
+    { +4.300000e+02, +1.095183e-03, +1.905862e+03, -1.605476e+05, +6.589730e+05, +6.644489e+05, -1.550717e+05, +3.488670e+03, +4.310910e+03, +9.130896e+02, -9.593854e-01, +5.773369e-07, -4.460383e-03, +2.892432e-09, -2.484830e-15, +5.000000e+06, +1.661743e+06, +1.732091e+06, +2.960158e+03, +3.710319e+03, +1.291245e+04 },
+    { +4.400000e+02, +1.107089e-03, +2.005304e+03, -1.801643e+05, +7.021693e+05, +7.077048e+05, -1.746288e+05, +3.445825e+03, +4.340961e+03, +9.032701e+02, -1.004799e+00, +6.082556e-07, -4.631985e-03, +3.300968e-09, -2.847039e-15, +5.000000e+06, +1.651935e+06, +1.644046e+06, +2.458291e+03, +3.789865e+03, +1.265130e+04 },
+    { +4.500000e+02, +1.119837e-03, +2.103235e+03, -2.007719e+05, +7.456838e+05, +7.512830e+05, -1.951727e+05, +3.404639e+03, +4.375474e+03, +8.929869e+02, -1.052231e+00, +6.435751e-07, -4.865478e-03, +3.775286e-09, -3.289727e-15, +5.000000e+06, +1.634978e+06, +1.553820e+06, +2.042346e+03, +3.871048e+03, +1.234134e+04 },
+    { +4.600000e+02, +1.133509e-03, +2.199827e+03, -2.223566e+05, +7.895636e+05, +7.952311e+05, -2.166891e+05, +3.365126e+03, +4.415055e+03, +8.822166e+02, -1.102345e+00, +6.840419e-07, -5.170212e-03, +4.333985e-09, -3.836148e-15, +5.000000e+06, +1.611517e+06, +1.461899e+06, +1.701735e+03, +3.949520e+03, +1.198525e+04 },
+    { +4.700000e+02, +1.148200e-03, +2.295253e+03, -2.449064e+05, +8.338625e+05, +8.396035e+05, -2.391654e+05, +3.327291e+03, +4.460463e+03, +8.709285e+02, -1.155917e+00, +7.306176e-07, -5.559604e-03, +5.001834e-09, -4.518463e-15, +5.000000e+06, +1.582109e+06, +1.368705e+06, +1.427196e+03, +4.021841e+03, +1.158565e+04 },
+    { +4.800000e+02, +1.164031e-03, +2.389696e+03, -2.684110e+05, +8.786429e+05, +8.844630e+05, -2.625908e+05, +3.291146e+03, +4.512667e+03, +8.590836e+02, -1.213882e+00, +7.845538e-07, -6.052786e-03, +5.812701e-09, -5.382078e-15, +5.000000e+06, +1.547226e+06, +1.274610e+06, +1.210708e+03, +4.085283e+03, +1.114504e+04 },
+    { +4.900000e+02, +1.181150e-03, +2.483347e+03, -2.928624e+05, +9.239779e+05, +9.298836e+05, -2.869566e+05, +3.256715e+03, +4.572922e+03, +8.466324e+02, -1.277409e+00, +8.475047e-07, -6.677242e-03, +6.814185e-09, -6.492664e-15, +5.000000e+06, +1.507259e+06, +1.179934e+06, +1.045405e+03, +4.137670e+03, +1.066588e+04 },
+    { +5.000000e+02, +1.199743e-03, +2.576419e+03, -3.182546e+05, +9.699551e+05, +9.759538e+05, -3.122559e+05, +3.224045e+03, +4.642889e+03, +8.335120e+02, -1.347997e+00, +9.216991e-07, -7.473180e-03, +8.075246e-09, -7.947922e-15, +5.000000e+06, +1.462513e+06, +1.084953e+06, +9.255022e+02, +4.177244e+03, +1.015047e+04 },
+    { +5.100000e+02, +1.220044e-03, +2.669147e+03, -3.445841e+05, +1.016681e+06, +1.022781e+06, -3.384839e+05, +3.193218e+03, +4.724823e+03, +8.196423e+02, -1.427642e+00, +1.010213e-06, -8.500992e-03, +9.699278e-09, -9.898126e-15, +5.000000e+06, +1.413208e+06, +9.898899e+05, +8.462641e+02, +4.202551e+03, +9.600938e+03 },
+    { +5.200000e+02, +1.242360e-03, +2.761806e+03, -3.718504e+05, +1.064289e+06, +1.070500e+06, -3.656386e+05, +3.164375e+03, +4.821867e+03, +8.049199e+02, -1.519096e+00, +1.117422e-06, -9.854560e-03, +1.184764e-08, -1.258383e-14, +5.000000e+06, +1.359466e+06, +8.949174e+05, +8.040119e+02, +4.212335e+03, +9.019072e+03 },
+    { +5.300000e+02, +1.267093e-03, +2.854726e+03, -4.000563e+05, +1.112948e+06, +1.119284e+06, -3.937208e+05, +3.137742e+03, +4.938565e+03, +7.892081e+02, -1.626316e+00, +1.249774e-06, -1.168636e-02, +1.478453e-08, -1.640925e-14, +5.000000e+06, +1.301288e+06, +8.001446e+05, +7.962326e+02, +4.205442e+03, +8.406093e+03 },
+    { +5.370910e+02, +1.286391e-03, +2.920997e+03, -4.206304e+05, +1.148211e+06, +1.154643e+06, -4.141984e+05, +3.120388e+03, +5.036840e+03, +7.773685e+02, -1.715045e+00, +1.364103e-06, -1.341135e-02, +1.758351e-08, -2.018647e-14, +5.000000e+06, +1.257270e+06, +7.330827e+05, +8.109541e+02, +4.189824e+03, +7.952785e+03 },
+    { +5.370910e+02, +1.286391e-03, +2.920997e+03, -4.206304e+05, +1.148211e+06, +1.154643e+06, -4.141984e+05, +3.120388e+03, +5.036840e+03, +7.773685e+02, -1.715045e+00, +1.364103e-06, -1.341135e-02, +1.758351e-08, -2.018647e-14, +5.000000e+06, +1.257270e+06, +7.330827e+05, +8.109541e+02, +4.189824e+03, +7.952785e+03 },
+    { +5.400000e+02, +3.999425e-02, +5.997063e+03, -6.315822e+05, +2.606832e+06, +2.806803e+06, -4.316110e+05, +2.502870e+03, +4.229934e+03, +2.500360e+01, -1.157120e-01, +6.696336e-06, +2.450857e-03, -6.644045e-08, +1.241950e-12, +5.000000e+06, +1.727990e+04, +1.493354e+05, -7.848001e+01, +1.003095e+03, -4.136113e+03 },
+    { +5.500000e+02, +4.175179e-02, +6.069845e+03, -7.007129e+05, +2.637702e+06, +2.846461e+06, -4.919540e+05, +2.299459e+03, +3.746408e+03, +2.395107e+01, -9.624930e-02, +6.138394e-06, +1.562734e-03, -4.735013e-08, +8.866866e-13, +5.000000e+06, +1.567988e+04, +1.629091e+05, -4.819584e+01, +8.876617e+02, -3.833592e+03 },
+    { +5.600000e+02, +4.336837e-02, +6.134456e+03, -7.698228e+05, +2.665473e+06, +2.882314e+06, -5.529810e+05, +2.174548e+03, +3.443701e+03, +2.305828e+01, -8.303628e-02, +5.722107e-06, +1.122039e-03, -3.676662e-08, +6.801672e-13, +5.000000e+06, +1.451149e+04, +1.747608e+05, -3.463663e+01, +8.214515e+02, -3.630345e+03 },
+    { +5.700000e+02, +4.488511e-02, +6.193412e+03, -8.390499e+05, +2.691195e+06, +2.915621e+06, -6.146244e+05, +2.085653e+03, +3.228286e+03, +2.227910e+01, -7.323951e-02, +5.390927e-06, +8.568078e-04, -2.990471e-08, +5.431573e-13, +5.000000e+06, +1.358570e+04, +1.854968e+05, -2.680547e+01, +7.750830e+02, -3.466852e+03 },
+    { +5.800000e+02, +4.632564e-02, +6.248080e+03, -9.084632e+05, +2.715423e+06, +2.947052e+06, -6.768350e+05, +2.017770e+03, +3.064861e+03, +2.158632e+01, -6.561139e-02, +5.117349e-06, +6.796187e-04, -2.506824e-08, +4.455137e-13, +5.000000e+06, +1.282136e+04, +1.954137e+05, -2.150285e+01, +7.391435e+02, -3.324497e+03 },
+    { +5.900000e+02, +4.770555e-02, +6.299336e+03, -9.781024e+05, +2.738506e+06, +2.977034e+06, -7.395746e+05, +1.964188e+03, +2.936476e+03, +2.096192e+01, -5.947770e-02, +4.885433e-06, +5.537968e-04, -2.148126e-08, +3.727086e-13, +5.000000e+06, +1.217450e+04, +2.046901e+05, -1.760172e+01, +7.099087e+02, -3.196393e+03 },
+    { +6.000000e+02, +4.903602e-02, +6.347796e+03, -1.047993e+06, +2.760685e+06, +3.005865e+06, -8.028124e+05, +1.921178e+03, +2.833405e+03, +2.039317e+01, -5.442695e-02, +4.684972e-06, +4.607702e-04, -1.872515e-08, +3.166492e-13, +5.000000e+06, +1.161735e+04, +2.134485e+05, -1.460691e+01, +6.855233e+02, -3.079339e+03 },
+    { +6.100000e+02, +5.032540e-02, +6.393915e+03, -1.118150e+06, +2.782138e+06, +3.033765e+06, -8.665228e+05, +1.886334e+03, +2.749387e+03, +1.987068e+01, -5.018883e-02, +4.509005e-06, +3.899124e-04, -1.654956e-08, +2.724021e-13, +5.000000e+06, +1.113080e+04, +2.217784e+05, -1.225149e+01, +6.648675e+02, -2.971449e+03 },
+    { +6.200000e+02, +5.158012e-02, +6.438042e+03, -1.188585e+06, +2.803001e+06, +3.060902e+06, -9.306841e+05, +1.857955e+03, +2.680107e+03, +1.938731e+01, -4.657697e-02, +4.352585e-06, +3.346489e-04, -1.479445e-08, +2.367745e-13, +5.000000e+06, +1.070099e+04, +2.297486e+05, -1.036893e+01, +6.471752e+02, -2.871398e+03 },
+    { +6.300000e+02, +5.280527e-02, +6.480451e+03, -1.259304e+06, +2.823380e+06, +3.087406e+06, -9.952779e+05, +1.834780e+03, +2.622451e+03, +1.893750e+01, -4.345831e-02, +4.212075e-06, +2.906918e-04, -1.335264e-08, +2.076084e-13, +5.000000e+06, +1.031755e+04, +2.374127e+05, -8.845766e+00, +6.318844e+02, -2.778155e+03 },
+    { +6.400000e+02, +5.400492e-02, +6.521359e+03, -1.330313e+06, +2.843357e+06, +3.113382e+06, -1.060288e+06, +1.815844e+03, +2.574111e+03, +1.851683e+01, -4.073522e-02, +4.084738e-06, +2.551359e-04, -1.214974e-08, +1.833948e-13, +5.000000e+06, +9.972543e+03, +2.448138e+05, -7.600751e+00, +6.185664e+02, -2.690881e+03 },
+    { +6.500000e+02, +5.518238e-02, +6.560945e+03, -1.401613e+06, +2.863002e+06, +3.138913e+06, -1.125701e+06, +1.800396e+03, +2.533338e+03, +1.812173e+01, -3.833442e-02, +3.968462e-06, +2.259523e-04, -1.113269e-08, +1.630498e-13, +5.000000e+06, +9.659765e+03, +2.519868e+05, -6.573924e+00, +6.068862e+02, -2.608875e+03 },
+    { +6.750000e+02, +5.804579e-02, +6.655013e+03, -1.581143e+06, +2.910991e+06, +3.201220e+06, -1.290914e+06, +1.773440e+03, +2.456341e+03, +1.722778e+01, -3.340418e-02, +3.716119e-06, +1.722773e-04, -9.171982e-09, +1.243546e-13, +5.000000e+06, +8.988997e+03, +2.690980e+05, -4.690787e+00, +5.832315e+02, -2.423221e+03 },
+    { +7.000000e+02, +6.081836e-02, +6.743346e+03, -1.762495e+06, +2.957847e+06, +3.261939e+06, -1.458404e+06, +1.758417e+03, +2.404523e+03, +1.644240e+01, -2.957530e-02, +3.505275e-06, +1.362484e-04, -7.767568e-09, +9.732898e-14, +5.000000e+06, +8.437370e+03, +2.852843e+05, -3.452352e+00, +5.653450e+02, -2.259831e+03 },
+    { +7.250000e+02, +6.352139e-02, +6.827073e+03, -1.945650e+06, +3.003979e+06, +3.321586e+06, -1.628043e+06, +1.751452e+03, +2.369535e+03, +1.574273e+01, -2.650449e-02, +3.324830e-06, +1.107928e-04, -6.715145e-09, +7.768865e-14, +5.000000e+06, +7.971682e+03, +3.007672e+05, -2.606964e+00, +5.514350e+02, -2.113728e+03 },
+    { +7.500000e+02, +6.616975e-02, +6.906984e+03, -2.130574e+06, +3.049664e+06, +3.380513e+06, -1.799726e+06, +1.750130e+03, +2.346275e+03, +1.511265e+01, -2.397998e-02, +3.167565e-06, +9.206987e-05, -5.898434e-09, +6.297150e-14, +5.000000e+06, +7.570476e+03, +3.156999e+05, -2.011324e+00, +5.403623e+02, -1.981378e+03 },
+    { +7.750000e+02, +6.877418e-02, +6.983657e+03, -2.317236e+06, +3.095099e+06, +3.438970e+06, -1.973365e+06, +1.752885e+03, +2.331469e+03, +1.454034e+01, -2.186371e-02, +3.028539e-06, +7.784870e-05, -5.246834e-09, +5.167259e-14, +5.000000e+06, +7.219226e+03, +3.301922e+05, -1.580157e+00, +5.313750e+02, -1.860204e+03 },
+    { +8.000000e+02, +7.134270e-02, +7.057529e+03, -2.505599e+06, +3.140425e+06, +3.497138e+06, -2.148885e+06, +1.758665e+03, +2.322936e+03, +1.401685e+01, -2.006157e-02, +2.904228e-06, +6.676031e-05, -4.715189e-09, +4.282584e-14, +5.000000e+06, +6.907710e+03, +3.443256e+05, -1.260743e+00, +5.239598e+02, -1.748291e+03 },
+    { +8.250000e+02, +7.388141e-02, +7.128942e+03, -2.695628e+06, +3.185749e+06, +3.555156e+06, -2.326221e+06, +1.766739e+03, +2.319167e+03, +1.353520e+01, -1.850699e-02, +2.792034e-06, +5.792557e-05, -4.273351e-09, +3.578581e-14, +5.000000e+06, +6.628498e+03, +3.581618e+05, -1.019364e+00, +5.177562e+02, -1.644178e+03 },
+    { +8.500000e+02, +7.639509e-02, +7.198166e+03, -2.887289e+06, +3.231152e+06, +3.613127e+06, -2.505314e+06, +1.776586e+03, +2.319088e+03, +1.308985e+01, -1.715145e-02, +2.689988e-06, +5.075784e-05, -3.900459e-09, +3.010686e-14, +5.000000e+06, +6.376031e+03, +3.717489e+05, -8.337961e-01, +5.125040e+02, -1.546730e+03 },
+    { +9.000000e+02, +8.136172e-02, +7.330903e+03, -3.275379e+06, +3.322434e+06, +3.729242e+06, -2.868570e+06, +1.800152e+03, +2.327051e+03, +1.229079e+01, -1.490070e-02, +2.510547e-06, +3.992331e-05, -3.305994e-09, +2.165313e-14, +5.000000e+06, +5.935242e+03, +3.983196e+05, -5.745126e-01, +5.041338e+02, -1.368408e+03 },
+    { +9.500000e+02, +8.626498e-02, +7.457108e+03, -3.669621e+06, +3.414632e+06, +3.845957e+06, -3.238296e+06, +1.827250e+03, +2.342560e+03, +1.159219e+01, -1.310753e-02, +2.357038e-06, +3.221250e-05, -2.853584e-09, +1.581829e-14, +5.000000e+06, +5.561019e+03, +4.242613e+05, -4.089926e-01, +4.978049e+02, -1.207980e+03 },
+    { +1.000000e+03, +9.112005e-02, +7.577769e+03, -4.069789e+06, +3.507980e+06, +3.963580e+06, -3.614189e+06, +1.856572e+03, +2.363027e+03, +1.097453e+01, -1.164617e-02, +2.223581e-06, +2.651316e-05, -2.498134e-09, +1.167334e-14, +5.000000e+06, +5.237572e+03, +4.497249e+05, -2.990978e-01, +4.928882e+02, -1.061783e+03 },
+    { +1.050000e+03, +9.593763e-02, +7.693626e+03, -4.475681e+06, +3.602626e+06, +4.082314e+06, -3.995993e+06, +1.887240e+03, +2.386777e+03, +1.042344e+01, -1.043368e-02, +2.106077e-06, +2.217383e-05, -2.211825e-09, +8.661461e-15, +5.000000e+06, +4.954082e+03, +4.748164e+05, -2.237708e-01, +4.889833e+02, -9.271889e+02 },
+    { +1.100000e+03, +1.007254e-01, +7.805250e+03, -4.887108e+06, +3.698666e+06, +4.202293e+06, -4.383481e+06, +1.918633e+03, +2.412664e+03, +9.927978e+00, -9.412930e-03, +2.001551e-06, +1.879033e-05, -1.976565e-09, +6.432867e-15, +5.000000e+06, +4.702818e+03, +4.996125e+05, -1.707443e-01, +4.858241e+02, -8.022402e+02 },
+    { +1.150000e+03, +1.054893e-01, +7.913093e+03, -5.303901e+06, +3.796156e+06, +4.323603e+06, -4.776455e+06, +1.950297e+03, +2.439875e+03, +9.479636e+00, -8.543140e-03, +1.907777e-06, +1.610000e-05, -1.780073e-09, +4.759387e-15, +5.000000e+06, +4.478061e+03, +5.241704e+05, -1.325557e-01, +4.832275e+02, -6.854384e+02 },
+    { +1.200000e+03, +1.102335e-01, +8.017522e+03, -5.725901e+06, +3.895125e+06, +4.446293e+06, -5.174734e+06, +1.981887e+03, +2.467816e+03, +9.071651e+00, -7.794361e-03, +1.823043e-06, +1.392557e-05, -1.613720e-09, +3.487534e-15, +5.000000e+06, +4.275468e+03, +5.485334e+05, -1.045008e-01, +4.810639e+02, -5.756093e+02 },
+    { +1.250000e+03, +1.149615e-01, +8.118835e+03, -6.152963e+06, +3.995582e+06, +4.570389e+06, -5.578155e+06, +2.013145e+03, +2.496047e+03, +8.698561e+00, -7.144062e-03, +1.746007e-06, +1.214354e-05, -1.471256e-09, +2.511371e-15, +5.000000e+06, +4.091656e+03, +5.727353e+05, -8.352464e-02, +4.792392e+02, -4.718159e+02 },
+    { +1.273000e+03, +1.171317e-01, +8.164463e+03, -6.351073e+06, +4.042289e+06, +4.627948e+06, -5.765414e+06, +2.027355e+03, +2.509037e+03, +8.537396e+00, -6.873079e-03, +1.712852e-06, +1.143027e-05, -1.412423e-09, +2.140180e-15, +5.000000e+06, +4.012651e+03, +5.838214e+05, -7.566497e-02, +4.784938e+02, -4.258831e+02 },
+    // P = 6.0 MPa
+    { +2.727130e+02, +9.972059e-04, -6.525721e+00, +7.527502e+00, -1.772121e+03, +4.211114e+03, +5.990763e+03, +4.190601e+03, +4.192126e+03, +1.002802e+03, +5.319829e-02, +5.034319e-07, -1.747565e-02, -3.759923e-09, -1.179053e-15, +6.000000e+06, -1.056713e+05, +1.986366e+06, +3.316076e+04, +1.434375e+04, +9.240833e+03 },
+    { +2.750000e+02, +9.971292e-04, +2.845941e+01, -1.715807e+01, +7.809179e+03, +1.379195e+04, +5.965617e+03, +4.186445e+03, +4.186565e+03, +1.002879e+03, +1.473733e-02, +4.952511e-07, -1.618901e-02, -3.401220e-09, -1.132567e-15, +6.000000e+06, -2.975728e+04, +2.019178e+06, +3.228178e+04, +1.372964e+04, +9.323687e+03 },
+    { +2.800000e+02, +9.972470e-04, +1.038075e+02, -3.491665e+02, +2.871693e+04, +3.470041e+04, +5.634316e+03, +4.175326e+03, +4.177432e+03, +1.002761e+03, -6.025014e-02, +4.799538e-07, -1.391382e-02, -2.743252e-09, -1.055118e-15, +6.000000e+06, +1.255332e+05, +2.083534e+06, +3.045956e+04, +1.248376e+04, +9.543386e+03 },
+    { +2.850000e+02, +9.977122e-04, +1.776892e+02, -1.056288e+03, +4.958515e+04, +5.557142e+04, +4.929985e+03, +4.161877e+03, +4.171402e+03, +1.002293e+03, -1.252957e-01, +4.676036e-07, -1.217871e-02, -2.214948e-09, -1.002112e-15, +6.000000e+06, +2.679528e+05, +2.138563e+06, +2.873730e+04, +1.135802e+04, +9.801272e+03 },
+    { +2.900000e+02, +9.984819e-04, +2.502014e+02, -2.131187e+03, +7.042721e+04, +7.641810e+04, +3.859705e+03, +4.146501e+03, +4.167580e+03, +1.001520e+03, -1.826648e-01, +4.576492e-07, -1.082199e-02, -1.780126e-09, -9.663791e-16, +6.000000e+06, +3.991373e+05, +2.185080e+06, +2.708838e+04, +1.034098e+04, +1.008206e+04 },
+    { +2.950000e+02, +9.995237e-04, +3.214229e+02, -3.567021e+03, +9.125274e+04, +9.724988e+04, +2.430121e+03, +4.129482e+03, +4.165359e+03, +1.000477e+03, -2.339703e-01, +4.496868e-07, -9.739163e-03, -1.414904e-09, -9.433464e-16, +6.000000e+06, +5.202961e+05, +2.223770e+06, +2.549969e+04, +9.424096e+03, +1.037387e+04 },
+    { +3.000000e+02, +1.000812e-03, +3.914204e+02, -5.357356e+03, +1.120688e+05, +1.180736e+05, +6.475154e+02, +4.111030e+03, +4.164309e+03, +9.991888e+02, -2.803949e-01, +4.434118e-07, -8.860090e-03, -1.102851e-09, -9.300289e-16, +6.000000e+06, +6.323578e+05, +2.255240e+06, +2.396594e+04, +8.600416e+03, +1.066780e+04 },
+    { +3.050000e+02, +1.002326e-03, +4.602510e+02, -7.496095e+03, +1.328805e+05, +1.388944e+05, -1.482138e+03, +4.091313e+03, +4.164125e+03, +9.976792e+02, -3.228290e-01, +4.385894e-07, -8.136170e-03, -8.322288e-10, -9.244396e-16, +6.000000e+06, +7.360620e+05, +2.280037e+06, +2.248610e+04, +7.863738e+03, +1.095732e+04 },
+    { +3.100000e+02, +1.004050e-03, +5.279648e+02, -9.977436e+03, +1.536917e+05, +1.597160e+05, -3.953134e+03, +4.070475e+03, +4.164591e+03, +9.959660e+02, -3.619570e-01, +4.350350e-07, -7.532790e-03, -5.943765e-10, -9.252332e-16, +6.000000e+06, +8.320181e+05, +2.298666e+06, +2.106118e+04, +7.208179e+03, +1.123773e+04 },
+    { +3.150000e+02, +1.005971e-03, +5.946068e+02, -1.279583e+04, +1.745053e+05, +1.805411e+05, -6.760001e+03, +4.048647e+03, +4.165556e+03, +9.940643e+02, -3.983154e-01, +4.326020e-07, -7.024732e-03, -3.827274e-10, -9.314897e-16, +6.000000e+06, +9.207433e+05, +2.311594e+06, +1.969294e+04, +6.627981e+03, +1.150568e+04 },
+    { +3.200000e+02, +1.008078e-03, +6.602177e+02, -1.594595e+04, +1.953237e+05, +2.013722e+05, -9.897484e+03, +4.025955e+03, +4.166923e+03, +9.919867e+02, -4.323317e-01, +4.311726e-07, -6.593263e-03, -1.921829e-10, -9.425792e-16, +6.000000e+06, +1.002688e+06, +2.319257e+06, +1.838316e+04, +6.117460e+03, +1.175884e+04 },
+    { +3.250000e+02, +1.010362e-03, +7.248353e+02, -1.942269e+04, +2.161488e+05, +2.222109e+05, -1.336052e+04, +4.002517e+03, +4.168631e+03, +9.897443e+02, -4.643519e-01, +4.306518e-07, -6.224239e-03, -1.870359e-11, -9.580757e-16, +6.000000e+06, +1.078254e+06, +2.322062e+06, +1.713324e+04, +5.671018e+03, +1.199558e+04 },
+    { +3.300000e+02, +1.012816e-03, +7.884947e+02, -2.322114e+04, +2.369821e+05, +2.430590e+05, -1.714424e+04, +3.978449e+03, +4.170648e+03, +9.873461e+02, -4.946600e-01, +4.309626e-07, -5.906830e-03, +1.409686e-10, -9.777018e-16, +6.000000e+06, +1.147803e+06, +2.320387e+06, +1.594407e+04, +5.283189e+03, +1.221484e+04 },
+    { +3.350000e+02, +1.015434e-03, +8.512294e+02, -2.733654e+04, +2.578253e+05, +2.639179e+05, -2.124393e+04, +3.953862e+03, +4.172962e+03, +9.848001e+02, -5.234922e-01, +4.320429e-07, -5.632645e-03, +2.895043e-10, -1.001292e-15, +6.000000e+06, +1.211667e+06, +2.314585e+06, +1.481592e+04, +4.948693e+03, +1.241596e+04 },
+    { +3.400000e+02, +1.018212e-03, +9.130712e+02, -3.176432e+04, +2.786799e+05, +2.847891e+05, -2.565505e+04, +3.928862e+03, +4.175580e+03, +9.821133e+02, -5.510475e-01, +4.338428e-07, -5.395114e-03, +4.291258e-10, -1.028770e-15, +6.000000e+06, +1.270155e+06, +2.304982e+06, +1.374855e+04, +4.662483e+03, +1.259856e+04 },
+    { +3.450000e+02, +1.021146e-03, +9.740506e+02, -3.650008e+04, +2.995474e+05, +3.056743e+05, -3.037320e+04, +3.903546e+03, +4.178516e+03, +9.792915e+02, -5.774957e-01, +4.363225e-07, -5.189046e-03, +5.617099e-10, -1.060128e-15, +6.000000e+06, +1.323552e+06, +2.291883e+06, +1.274118e+04, +4.419776e+03, +1.276249e+04 },
+    { +3.500000e+02, +1.024233e-03, +1.034197e+03, -4.153956e+04, +3.204295e+05, +3.265749e+05, -3.539416e+04, +3.878009e+03, +4.181794e+03, +9.763399e+02, -6.029834e-01, +4.394509e-07, -5.010312e-03, +6.888649e-10, -1.095424e-15, +6.000000e+06, +1.372129e+06, +2.275567e+06, +1.179264e+04, +4.216085e+03, +1.290777e+04 },
+    { +3.550000e+02, +1.027471e-03, +1.093540e+03, -4.687866e+04, +3.413280e+05, +3.474928e+05, -4.071384e+04, +3.852335e+03, +4.185442e+03, +9.732630e+02, -6.276388e-01, +4.432044e-07, -4.855607e-03, +8.119894e-10, -1.134767e-15, +6.000000e+06, +1.416138e+06, +2.256295e+06, +1.090139e+04, +4.047227e+03, +1.303450e+04 },
+    { +3.600000e+02, +1.030859e-03, +1.152106e+03, -5.251342e+04, +3.622448e+05, +3.684300e+05, -4.632827e+04, +3.826602e+03, +4.189490e+03, +9.700647e+02, -6.515751e-01, +4.475661e-07, -4.722272e-03, +9.323195e-10, -1.178319e-15, +6.000000e+06, +1.455819e+06, +2.234307e+06, +1.006563e+04, +3.909332e+03, +1.314291e+04 },
+    { +3.650000e+02, +1.034395e-03, +1.209924e+03, -5.844002e+04, +3.831821e+05, +3.893884e+05, -5.223365e+04, +3.800881e+03, +4.193973e+03, +9.667483e+02, -6.748936e-01, +4.525248e-07, -4.608164e-03, +1.050965e-09, -1.226292e-15, +6.000000e+06, +1.491396e+06, +2.209824e+06, +9.283352e+03, +3.798838e+03, +1.323325e+04 },
+    { +3.700000e+02, +1.038080e-03, +1.267018e+03, -6.465478e+04, +4.041420e+05, +4.103705e+05, -5.842630e+04, +3.775235e+03, +4.198924e+03, +9.633167e+02, -6.976859e-01, +4.580747e-07, -4.511552e-03, +1.168940e-09, -1.278945e-15, +6.000000e+06, +1.523083e+06, +2.183050e+06, +8.552404e+03, +3.712484e+03, +1.330586e+04 },
+    { +3.750000e+02, +1.041914e-03, +1.323416e+03, -7.115415e+04, +4.251270e+05, +4.313785e+05, -6.490267e+04, +3.749719e+03, +4.204377e+03, +9.597722e+02, -7.200359e-01, +4.642147e-07, -4.431045e-03, +1.287189e-09, -1.336590e-15, +6.000000e+06, +1.551084e+06, +2.154176e+06, +7.870539e+03, +3.647296e+03, +1.336109e+04 },
+    { +3.800000e+02, +1.045897e-03, +1.379143e+03, -7.793473e+04, +4.461397e+05, +4.524151e+05, -7.165935e+04, +3.724383e+03, +4.210366e+03, +9.561169e+02, -7.420213e-01, +4.709485e-07, -4.365525e-03, +1.406605e-09, -1.399594e-15, +6.000000e+06, +1.575589e+06, +2.123374e+06, +7.235459e+03, +3.600572e+03, +1.339929e+04 },
+    { +3.850000e+02, +1.050031e-03, +1.434224e+03, -8.499322e+04, +4.671829e+05, +4.734831e+05, -7.869303e+04, +3.699269e+03, +4.216926e+03, +9.523525e+02, -7.637146e-01, +4.782841e-07, -4.314112e-03, +1.528050e-09, -1.468378e-15, +6.000000e+06, +1.596780e+06, +2.090808e+06, +6.644848e+03, +3.569867e+03, +1.342085e+04 },
+    { +3.900000e+02, +1.054318e-03, +1.488682e+03, -9.232646e+04, +4.882595e+05, +4.945854e+05, -8.600055e+04, +3.674415e+03, +4.224091e+03, +9.484801e+02, -7.851848e-01, +4.862338e-07, -4.276118e-03, +1.652376e-09, -1.543433e-15, +6.000000e+06, +1.614830e+06, +2.056624e+06, +6.096403e+03, +3.552970e+03, +1.342617e+04 },
+    { +3.950000e+02, +1.058760e-03, +1.542542e+03, -9.993141e+04, +5.093725e+05, +5.157251e+05, -9.357885e+04, +3.649852e+03, +4.231896e+03, +9.445009e+02, -8.064973e-01, +4.948141e-07, -4.251029e-03, +1.780431e-09, -1.625315e-15, +6.000000e+06, +1.629900e+06, +2.020961e+06, +5.587854e+03, +3.547893e+03, +1.341564e+04 },
+    { +4.000000e+02, +1.063360e-03, +1.595826e+03, -1.078052e+05, +5.305253e+05, +5.369055e+05, -1.014250e+05, +3.625606e+03, +4.240376e+03, +9.404153e+02, -8.277159e-01, +5.040458e-07, -4.238483e-03, +1.913083e-09, -1.714665e-15, +6.000000e+06, +1.642144e+06, +1.983947e+06, +5.116987e+03, +3.552847e+03, +1.338965e+04 },
+    { +4.100000e+02, +1.073046e-03, +1.700761e+03, -1.243480e+05, +5.729641e+05, +5.794024e+05, -1.179097e+05, +3.578151e+03, +4.259509e+03, +9.319263e+02, -8.701188e-01, +5.245688e-07, -4.250241e-03, +2.195813e-09, -1.918782e-15, +6.000000e+06, +1.658732e+06, +1.906328e+06, +4.279766e+03, +3.586594e+03, +1.329286e+04 },
+    { +4.200000e+02, +1.083410e-03, +1.803666e+03, -1.419339e+05, +6.156057e+05, +6.221062e+05, -1.354335e+05, +3.532183e+03, +4.281796e+03, +9.230117e+02, -9.128842e-01, +5.480614e-07, -4.311081e-03, +2.508392e-09, -2.162944e-15, +6.000000e+06, +1.665660e+06, +1.824613e+06, +3.568482e+03, +3.643285e+03, +1.313886e+04 },
+    { +4.300000e+02, +1.094492e-03, +1.904714e+03, -1.605438e+05, +6.584831e+05, +6.650500e+05, -1.539768e+05, +3.487790e+03, +4.307585e+03, +9.136657e+02, -9.565092e-01, +5.748663e-07, -4.422625e-03, +2.859924e-09, -2.456520e-15, +6.000000e+06, +1.663881e+06, +1.739535e+06, +2.968265e+03, +3.714194e+03, +1.293064e+04 },
+    { +4.400000e+02, +1.106345e-03, +2.004075e+03, -1.801602e+05, +7.016328e+05, +7.082709e+05, -1.735221e+05, +3.445020e+03, +4.337277e+03, +9.038770e+02, -1.001518e+00, +6.054262e-07, -4.588508e-03, +3.261445e-09, -2.811878e-15, +6.000000e+06, +1.654236e+06, +1.651729e+06, +2.465703e+03, +3.792382e+03, +1.267106e+04 },
+    { +4.500000e+02, +1.119033e-03, +2.101919e+03, -2.007675e+05, +7.450959e+05, +7.518101e+05, -1.940533e+05, +3.403899e+03, +4.371352e+03, +8.936289e+02, -1.048480e+00, +6.403075e-07, -4.814691e-03, +3.726803e-09, -3.245532e-15, +6.000000e+06, +1.637463e+06, +1.561750e+06, +2.048837e+03, +3.872344e+03, +1.236289e+04 },
+    { +4.600000e+02, +1.132633e-03, +2.198414e+03, -2.223518e+05, +7.889187e+05, +7.957145e+05, -2.155560e+05, +3.364439e+03, +4.410399e+03, +8.828987e+02, -1.098041e+00, +6.802340e-07, -5.110028e-03, +4.273881e-09, -3.779859e-15, +6.000000e+06, +1.614211e+06, +1.470082e+06, +1.707103e+03, +3.949725e+03, +1.200883e+04 },
+    { +4.700000e+02, +1.147240e-03, +2.293734e+03, -2.449011e+05, +8.331537e+05, +8.400371e+05, -2.380176e+05, +3.326646e+03, +4.455153e+03, +8.716569e+02, -1.150953e+00, +7.261357e-07, -5.487216e-03, +4.926403e-09, -4.445702e-15, +6.000000e+06, +1.585038e+06, +1.377153e+06, +1.431254e+03, +4.021076e+03, +1.161146e+04 },
+    { +4.800000e+02, +1.162973e-03, +2.388056e+03, -2.684052e+05, +8.778618e+05, +8.848396e+05, -2.614273e+05, +3.290531e+03, +4.506545e+03, +8.598655e+02, -1.208118e+00, +7.792198e-07, -5.964314e-03, +5.716662e-09, -5.286435e-15, +6.000000e+06, +1.550420e+06, +1.283335e+06, +1.213267e+03, +4.083662e+03, +1.117334e+04 },
+    { +4.900000e+02, +1.179974e-03, +2.481572e+03, -2.928559e+05, +9.231143e+05, +9.301941e+05, -2.857761e+05, +3.256112e+03, +4.565782e+03, +8.474766e+02, -1.270657e+00, +8.410765e-07, -6.567172e-03, +6.689828e-09, -6.364503e-15, +6.000000e+06, +1.510751e+06, +1.188953e+06, +1.046262e+03, +4.135301e+03, +1.069690e+04 },
+    { +5.000000e+02, +1.198423e-03, +2.574487e+03, -3.182473e+05, +9.689961e+05, +9.761867e+05, -3.110568e+05, +3.223434e+03, +4.634453e+03, +8.344297e+02, -1.340004e+00, +9.138395e-07, -7.333428e-03, +7.910964e-09, -7.772301e-15, +6.000000e+06, +1.466345e+06, +1.094284e+06, +9.244246e+02, +4.174232e+03, +1.018450e+04 },
+    { +5.100000e+02, +1.218550e-03, +2.667032e+03, -3.445759e+05, +1.015610e+06, +1.022922e+06, -3.372646e+05, +3.192574e+03, +4.714704e+03, +8.206476e+02, -1.418054e+00, +1.000440e-06, -8.319264e-03, +9.476969e-09, -9.651020e-15, +6.000000e+06, +1.417431e+06, +9.995606e+05, +8.429631e+02, +4.198995e+03, +9.638303e+03 },
+    { +5.200000e+02, +1.240647e-03, +2.759473e+03, -3.718409e+05, +1.063085e+06, +1.070529e+06, -3.643971e+05, +3.163661e+03, +4.809510e+03, +8.060311e+02, -1.507405e+00, +1.105019e-06, -9.611357e-03, +1.153785e-08, -1.222488e-14, +6.000000e+06, +1.364144e+06, +9.049622e+05, +7.981075e+02, +4.208328e+03, +9.060159e+03 },
+    { +5.300000e+02, +1.265103e-03, +2.852131e+03, -4.000454e+05, +1.111584e+06, +1.119174e+06, -3.924547e+05, +3.136907e+03, +4.923142e+03, +7.904497e+02, -1.611757e+00, +1.233639e-06, -1.134913e-02, +1.433679e-08, -1.586693e-14, +6.000000e+06, +1.306507e+06, +8.106102e+05, +7.871904e+02, +4.201067e+03, +8.451406e+03 },
+    { +5.400000e+02, +1.292444e-03, +2.945402e+03, -4.291964e+05, +1.161321e+06, +1.169076e+06, -4.214417e+05, +3.112649e+03, +5.061982e+03, +7.737278e+02, -1.736641e+00, +1.395569e-06, -1.376899e-02, +1.829096e-08, -2.123461e-14, +6.000000e+06, +1.244396e+06, +7.165536e+05, +8.088864e+02, +4.176043e+03, +7.812506e+03 },
+    { +5.487350e+02, +1.319264e-03, +3.027785e+03, -4.554444e+05, +1.206007e+06, +1.213923e+06, -4.475288e+05, +3.093927e+03, +5.211629e+03, +7.579981e+02, -1.869252e+00, +1.575787e-06, -1.676884e-02, +2.327727e-08, -2.828617e-14, +6.000000e+06, +1.186234e+06, +6.346035e+05, +8.549182e+02, +4.138669e+03, +7.229057e+03 },
+    { +5.487350e+02, +1.319264e-03, +3.027785e+03, -4.554444e+05, +1.206007e+06, +1.213923e+06, -4.475288e+05, +3.093927e+03, +5.211629e+03, +7.579981e+02, -1.869252e+00, +1.575787e-06, -1.676884e-02, +2.327727e-08, -2.828617e-14, +6.000000e+06, +1.186234e+06, +6.346035e+05, +8.549182e+02, +4.138669e+03, +7.229057e+03 },
+    { +5.500000e+02, +3.266815e-02, +5.901226e+03, -6.509958e+05, +2.594679e+06, +2.790687e+06, -4.549869e+05, +2.660876e+03, +4.763437e+03, +3.061085e+01, -1.614641e-01, +7.278052e-06, +4.062179e-03, -8.991184e-08, +1.479022e-12, +6.000000e+06, +2.218507e+04, +1.373994e+05, -1.100184e+02, +1.077961e+03, -3.836447e+03 },
+    { +5.600000e+02, +3.428669e-02, +5.980711e+03, -7.201275e+05, +2.629071e+06, +2.834791e+06, -5.144073e+05, +2.416661e+03, +4.121448e+03, +2.916584e+01, -1.301988e-01, +6.546103e-06, +2.434392e-03, -6.032119e-08, +1.001869e-12, +6.000000e+06, +1.988951e+04, +1.527627e+05, -6.587216e+01, +9.426633e+02, -3.571599e+03 },
+    { +5.700000e+02, +3.575136e-02, +6.050000e+03, -7.890758e+05, +2.659424e+06, +2.873932e+06, -5.745676e+05, +2.269944e+03, +3.733402e+03, +2.797096e+01, -1.100211e-01, +6.026035e-06, +1.679938e-03, -4.507277e-08, +7.437757e-13, +6.000000e+06, +1.825763e+04, +1.659466e+05, -4.680107e+01, +8.672679e+02, -3.398967e+03 },
+    { +5.800000e+02, +3.711038e-02, +6.112464e+03, -8.580470e+05, +2.687182e+06, +2.909844e+06, -6.353847e+05, +2.166597e+03, +3.463220e+03, +2.694664e+01, -9.556205e-02, +5.625690e-06, +1.246545e-03, -3.565739e-08, +5.804390e-13, +6.000000e+06, +1.698673e+04, +1.777560e+05, -3.601784e+01, +8.151327e+02, -3.260088e+03 },
+    { +5.900000e+02, +3.839034e-02, +6.169867e+03, -9.271421e+05, +2.713080e+06, +2.943422e+06, -6.968001e+05, +2.088052e+03, +3.261268e+03, +2.604822e+01, -8.458656e-02, +5.302989e-06, +9.670142e-04, -2.925634e-08, +4.679481e-13, +6.000000e+06, +1.595073e+04, +1.885729e+05, -2.880493e+01, +7.749257e+02, -3.137873e+03 },
+    { +6.000000e+02, +3.960835e-02, +6.223312e+03, -9.964190e+05, +2.737568e+06, +2.975218e+06, -7.587689e+05, +2.026162e+03, +3.104264e+03, +2.524720e+01, -7.593697e-02, +5.034670e-06, +7.739381e-04, -2.464077e-08, +3.862411e-13, +6.000000e+06, +1.508281e+04, +1.986227e+05, -2.353690e+01, +7.422770e+02, -3.026532e+03 },
+    { +6.100000e+02, +4.077634e-02, +6.273555e+03, -1.065914e+06, +2.760955e+06, +3.005613e+06, -8.212557e+05, +1.976474e+03, +2.979144e+03, +2.452403e+01, -6.893100e-02, +4.806372e-06, +6.343527e-04, -2.117415e-08, +3.246191e-13, +6.000000e+06, +1.434159e+04, +2.080571e+05, -1.951139e+01, +7.150532e+02, -2.923626e+03 },
+    { +6.200000e+02, +4.190312e-02, +6.321147e+03, -1.135650e+06, +2.783461e+06, +3.034880e+06, -8.842312e+05, +1.936150e+03, +2.877676e+03, +2.386457e+01, -6.313326e-02, +4.608597e-06, +5.299918e-04, -1.848899e-08, +2.767944e-13, +6.000000e+06, +1.369902e+04, +2.169858e+05, -1.635503e+01, +6.919849e+02, -2.827815e+03 },
+    { +6.300000e+02, +4.299537e-02, +6.366504e+03, -1.205643e+06, +2.805254e+06, +3.063226e+06, -9.476712e+05, +1.903205e+03, +2.794287e+03, +2.325832e+01, -5.825078e-02, +4.434756e-06, +4.498722e-04, -1.635735e-08, +2.388202e-13, +6.000000e+06, +1.313506e+04, +2.254916e+05, -1.383757e+01, +6.722121e+02, -2.738180e+03 },
+    { +6.400000e+02, +4.405831e-02, +6.409949e+03, -1.275905e+06, +2.826463e+06, +3.090813e+06, -1.011555e+06, +1.876179e+03, +2.725029e+03, +2.269720e+01, -5.407856e-02, +4.280106e-06, +3.870064e-04, -1.463040e-08, +2.080963e-13, +6.000000e+06, +1.263486e+04, +2.336391e+05, -1.180363e+01, +6.551080e+02, -2.653999e+03 },
+    { +6.500000e+02, +4.509608e-02, +6.451737e+03, -1.346441e+06, +2.847188e+06, +3.117764e+06, -1.075865e+06, +1.853961e+03, +2.667009e+03, +2.217488e+01, -5.046875e-02, +4.141139e-06, +3.367591e-04, -1.320709e-08, +1.828443e-13, +6.000000e+06, +1.218717e+04, +2.414795e+05, -1.014272e+01, +6.401958e+02, -2.574673e+03 },
+    { +6.750000e+02, +4.760093e-02, +6.550209e+03, -1.524011e+06, +2.897381e+06, +3.182986e+06, -1.238405e+06, +1.814256e+03, +2.558108e+03, +2.100799e+01, -4.325111e-02, +3.846294e-06, +2.477252e-04, -1.056012e-08, +1.362461e-13, +6.000000e+06, +1.124488e+04, +2.599905e+05, -7.138948e+00, +6.102518e+02, -2.394400e+03 },
+    { +7.000000e+02, +5.000609e-02, +6.641831e+03, -1.703355e+06, +2.945927e+06, +3.245963e+06, -1.403318e+06, +1.790487e+03, +2.484764e+03, +1.999756e+01, -3.782030e-02, +3.606292e-06, +1.906267e-04, -8.744482e-09, +1.048289e-13, +6.000000e+06, +1.048731e+04, +2.772931e+05, -5.197571e+00, +5.878438e+02, -2.235107e+03 },
+    { +7.250000e+02, +5.233628e-02, +6.728094e+03, -1.884470e+06, +2.993398e+06, +3.307416e+06, -1.570452e+06, +1.777284e+03, +2.434542e+03, +1.910721e+01, -3.356995e-02, +3.404939e-06, +1.517115e-04, -7.429179e-09, +8.259337e-14, +6.000000e+06, +9.859193e+03, +2.936910e+05, -3.890963e+00, +5.705620e+02, -2.092267e+03 },
+    { +7.500000e+02, +5.460829e-02, +6.810011e+03, -2.067336e+06, +3.040171e+06, +3.367821e+06, -1.739687e+06, +1.771366e+03, +2.400082e+03, +1.831224e+01, -3.014290e-02, +3.232169e-06, +1.239128e-04, -6.435887e-09, +6.626926e-14, +6.000000e+06, +9.325905e+03, +3.093898e+05, -2.981120e+00, +5.568979e+02, -1.962591e+03 },
+    { +7.750000e+02, +5.683404e-02, +6.888303e+03, -2.251927e+06, +3.086508e+06, +3.427512e+06, -1.910923e+06, +1.770639e+03, +2.376784e+03, +1.759509e+01, -2.731484e-02, +3.081336e-06, +1.033020e-04, -5.660953e-09, +5.393827e-14, +6.000000e+06, +8.864608e+03, +3.245346e+05, -2.328949e+00, +5.458676e+02, -1.843656e+03 },
+    { +8.000000e+02, +5.902228e-02, +6.963505e+03, -2.438210e+06, +3.132594e+06, +3.486728e+06, -2.084076e+06, +1.773718e+03, +2.361646e+03, +1.694275e+01, -2.493751e-02, +2.947841e-06, +8.755421e-05, -5.040407e-09, +4.440898e-14, +6.000000e+06, +8.459585e+03, +3.392313e+05, -1.849764e+00, +5.368068e+02, -1.733639e+03 },
+    { +8.250000e+02, +6.117961e-02, +7.036026e+03, -2.626153e+06, +3.178568e+06, +3.545645e+06, -2.259076e+06, +1.779655e+03, +2.352629e+03, +1.634532e+01, -2.290880e-02, +2.828378e-06, +7.522155e-05, -4.532810e-09, +3.690669e-14, +6.000000e+06, +8.099626e+03, +3.535595e+05, -1.490125e+00, +5.292534e+02, -1.631146e+03 },
+    { +8.500000e+02, +6.331109e-02, +7.106184e+03, -2.815724e+06, +3.224532e+06, +3.604399e+06, -2.435858e+06, +1.787782e+03, +2.348305e+03, +1.579502e+01, -2.115590e-02, +2.720494e-06, +6.536298e-05, -4.110217e-09, +3.090847e-14, +6.000000e+06, +7.776491e+03, +3.675803e+05, -1.215220e+00, +5.228768e+02, -1.535091e+03 },
+    { +9.000000e+02, +6.751175e-02, +7.240399e+03, -3.199624e+06, +3.316734e+06, +3.721805e+06, -2.794554e+06, +1.808778e+03, +2.349881e+03, +1.481224e+01, -1.827704e-02, +2.532409e-06, +5.072564e-05, -3.447587e-09, +2.207115e-14, +6.000000e+06, +7.217256e+03, +3.948809e+05, -8.336170e-01, +5.127468e+02, -1.359012e+03 },
+    { +9.500000e+02, +7.164774e-02, +7.367711e+03, -3.589669e+06, +3.409656e+06, +3.839542e+06, -3.159783e+06, +1.834081e+03, +2.360871e+03, +1.395717e+01, -1.601032e-02, +2.372966e-06, +4.051438e-05, -2.952472e-09, +1.603818e-14, +6.000000e+06, +6.746966e+03, +4.214135e+05, -5.916689e-01, +5.051106e+02, -1.200273e+03 },
+    { +1.000000e+03, +7.573480e-02, +7.489223e+03, -3.985637e+06, +3.503585e+06, +3.957994e+06, -3.531229e+06, +1.862101e+03, +2.378021e+03, +1.320397e+01, -1.417963e-02, +2.235312e-06, +3.308407e-05, -2.569036e-09, +1.178730e-14, +6.000000e+06, +6.343465e+03, +4.473648e+05, -4.318000e-01, +4.991902e+02, -1.055358e+03 },
+    { +1.050000e+03, +7.978390e-02, +7.605747e+03, -4.387326e+06, +3.598709e+06, +4.077412e+06, -3.908622e+06, +1.891797e+03, +2.399261e+03, +1.253386e+01, -1.267139e-02, +2.114767e-06, +2.749714e-05, -2.263731e-09, +8.717583e-15, +6.000000e+06, +5.991860e+03, +4.728653e+05, -3.225919e-01, +4.944941e+02, -9.217399e+02 },
+    { +1.100000e+03, +8.380298e-02, +7.717905e+03, -4.794548e+06, +3.695147e+06, +4.197965e+06, -4.291731e+06, +1.922448e+03, +2.423205e+03, +1.193275e+01, -1.140878e-02, +2.007997e-06, +2.318481e-05, -2.015207e-09, +6.457128e-15, +6.000000e+06, +5.681672e+03, +4.980088e+05, -2.459034e-01, +4.906981e+02, -7.975364e+02 },
+    { +1.150000e+03, +8.779790e-02, +7.826182e+03, -5.207135e+06, +3.792974e+06, +4.319761e+06, -4.680348e+06, +1.953532e+03, +2.448879e+03, +1.138979e+01, -1.033777e-02, +1.912540e-06, +1.978438e-05, -1.809235e-09, +4.766197e-15, +6.000000e+06, +5.405260e+03, +5.228650e+05, -1.907722e-01, +4.875797e+02, -6.813035e+02 },
+    { +1.200000e+03, +9.177312e-02, +7.930967e+03, -5.624929e+06, +3.892231e+06, +4.442870e+06, -5.074291e+06, +1.984664e+03, +2.475587e+03, +1.089644e+01, -9.419197e-03, +1.826529e-06, +1.705494e-05, -1.635974e-09, +3.485024e-15, +6.000000e+06, +5.156882e+03, +5.474864e+05, -1.503234e-01, +4.849821e+02, -5.719075e+02 },
+    { +1.250000e+03, +9.573204e-02, +8.032576e+03, -6.047784e+06, +3.992936e+06, +4.567329e+06, -5.473392e+06, +2.015552e+03, +2.502812e+03, +1.044582e+01, -8.623882e-03, +1.748515e-06, +1.483096e-05, -1.488393e-09, +2.504173e-15, +6.000000e+06, +4.932117e+03, +5.719138e+05, -1.201095e-01, +4.827918e+02, -4.684422e+02 },
+    { +1.273000e+03, +9.754844e-02, +8.078324e+03, -6.243959e+06, +4.039747e+06, +4.625038e+06, -5.658668e+06, +2.029617e+03, +2.515401e+03, +1.025132e+01, -8.293117e-03, +1.714989e-06, +1.394409e-05, -1.427658e-09, +2.131797e-15, +6.000000e+06, +4.835669e+03, +5.830943e+05, -1.087949e-01, +4.818972e+02, -4.226317e+02 },
+    // P = 7.0 MPa
+    { +2.726380e+02, +9.967098e-04, -7.626493e+00, +1.022105e+01, -2.069051e+03, +4.907918e+03, +6.987190e+03, +4.186211e+03, +4.187599e+03, +1.003301e+03, +5.074936e-02, +5.025355e-07, -1.735487e-02, -3.750181e-09, -1.176963e-15, +7.000000e+06, -1.009866e+05, +1.989909e+06, +3.305128e+04, +1.437909e+04, +9.273908e+03 },
+    { +2.750000e+02, +9.966376e-04, +2.847237e+01, -1.396276e+01, +7.815938e+03, +1.479240e+04, +6.962500e+03, +4.182089e+03, +4.182160e+03, +1.003374e+03, +1.134540e-02, +4.941203e-07, -1.604181e-02, -3.382648e-09, -1.128990e-15, +7.000000e+06, -2.296080e+04, +2.023798e+06, +3.215222e+04, +1.374834e+04, +9.358187e+03 },
+    { +2.800000e+02, +9.967705e-04, +1.037462e+02, -3.460690e+02, +2.870288e+04, +3.568027e+04, +6.631324e+03, +4.171269e+03, +4.173574e+03, +1.003240e+03, -6.298702e-02, +4.789004e-07, -1.379715e-02, -2.730514e-09, -1.051752e-15, +7.000000e+06, +1.315243e+05, +2.088117e+06, +3.034786e+04, +1.250883e+04, +9.575855e+03 },
+    { +2.850000e+02, +9.972474e-04, +1.775635e+02, -1.053268e+03, +4.955232e+04, +5.653306e+04, +5.927464e+03, +4.158077e+03, +4.167953e+03, +1.002760e+03, -1.275063e-01, +4.666032e-07, -1.208370e-02, -2.206261e-09, -9.987984e-16, +7.000000e+06, +2.732649e+05, +2.143149e+06, +2.864119e+04, +1.138717e+04, +9.831839e+03 },
+    { +2.900000e+02, +9.980264e-04, +2.500184e+02, -2.128226e+03, +7.037712e+04, +7.736331e+04, +4.857959e+03, +4.142928e+03, +4.164445e+03, +1.001978e+03, -1.844421e-01, +4.566845e-07, -1.074289e-02, -1.774361e-09, -9.630163e-16, +7.000000e+06, +4.038720e+05, +2.189695e+06, +2.700595e+04, +1.037250e+04, +1.011078e+04 },
+    { +2.950000e+02, +9.990751e-04, +3.211886e+02, -3.564105e+03, +9.118652e+04, +9.818005e+04, +3.429421e+03, +4.126112e+03, +4.162468e+03, +1.000926e+03, -2.353834e-01, +4.487452e-07, -9.672084e-03, -1.411335e-09, -9.398662e-16, +7.000000e+06, +5.245369e+05, +2.228436e+06, +2.542929e+04, +9.456762e+03, +1.040080e+04 },
+    { +3.000000e+02, +1.000368e-03, +3.911391e+02, -5.354473e+03, +1.119873e+05, +1.189898e+05, +1.648105e+03, +4.107846e+03, +4.161609e+03, +9.996317e+02, -2.814968e-01, +4.424836e-07, -8.802307e-03, -1.100996e-09, -9.263848e-16, +7.000000e+06, +6.361746e+05, +2.259971e+06, +2.390616e+04, +8.633351e+03, +1.069301e+04 },
+    { +3.050000e+02, +1.001886e-03, +4.599264e+02, -7.493236e+03, +1.327843e+05, +1.397975e+05, -4.800322e+02, +4.088299e+03, +4.161577e+03, +9.981173e+02, -3.236610e-01, +4.376669e-07, -8.085698e-03, -8.317645e-10, -9.205968e-16, +7.000000e+06, +7.395145e+05, +2.284843e+06, +2.243569e+04, +7.896326e+03, +1.098091e+04 },
+    { +3.100000e+02, +1.003612e-03, +5.275998e+02, -9.974589e+03, +1.535814e+05, +1.606066e+05, -2.949302e+03, +4.067619e+03, +4.162162e+03, +9.964006e+02, -3.625517e-01, +4.341118e-07, -7.488140e-03, -5.950826e-10, -9.211632e-16, +7.000000e+06, +8.351575e+05, +2.303554e+06, +2.101904e+04, +7.239993e+03, +1.125983e+04 },
+    { +3.150000e+02, +1.005534e-03, +5.942037e+02, -1.279299e+04, +1.743812e+05, +1.814199e+05, -5.754248e+03, +4.045938e+03, +4.163222e+03, +9.944964e+02, -3.986990e-01, +4.316727e-07, -6.984759e-03, -3.844526e-10, -9.271670e-16, +7.000000e+06, +9.236141e+05, +2.316570e+06, +1.965809e+04, +6.658733e+03, +1.152641e+04 },
+    { +3.200000e+02, +1.007640e-03, +6.597785e+02, -1.594311e+04, +1.951860e+05, +2.022395e+05, -8.889624e+03, +4.023383e+03, +4.164663e+03, +9.924174e+02, -4.325252e-01, +4.302323e-07, -6.557068e-03, -1.948238e-10, -9.379786e-16, +7.000000e+06, +1.005329e+06, +2.324325e+06, +1.835472e+04, +6.146959e+03, +1.177833e+04 },
+    { +3.250000e+02, +1.009923e-03, +7.243615e+02, -1.941984e+04, +2.159976e+05, +2.230671e+05, -1.235038e+04, +4.000075e+03, +4.166428e+03, +9.901744e+02, -4.643724e-01, +4.296962e-07, -6.191104e-03, -2.219126e-11, -9.531715e-16, +7.000000e+06, +1.080699e+06, +2.327226e+06, +1.711043e+04, +5.699144e+03, +1.201397e+04 },
+    { +3.300000e+02, +1.012375e-03, +7.879876e+02, -2.321827e+04, +2.368176e+05, +2.439043e+05, -1.613164e+04, +3.976128e+03, +4.168487e+03, +9.877765e+02, -4.945212e-01, +4.299875e-07, -5.876169e-03, +1.366777e-10, -9.724662e-16, +7.000000e+06, +1.150083e+06, +2.325649e+06, +1.592618e+04, +5.309874e+03, +1.223227e+04 },
+    { +3.350000e+02, +1.014990e-03, +8.506900e+02, -2.733364e+04, +2.576475e+05, +2.647524e+05, -2.022872e+04, +3.951656e+03, +4.170831e+03, +9.852317e+02, -5.232052e-01, +4.310444e-07, -5.603975e-03, +2.844341e-10, -9.956950e-16, +7.000000e+06, +1.213808e+06, +2.319946e+06, +1.480234e+04, +4.973907e+03, +1.243255e+04 },
+    { +3.400000e+02, +1.017763e-03, +9.125003e+02, -3.176140e+04, +2.784887e+05, +2.856131e+05, -2.463706e+04, +3.926763e+03, +4.173466e+03, +9.825466e+02, -5.506213e-01, +4.328170e-07, -5.368028e-03, +4.232846e-10, -1.022777e-15, +7.000000e+06, +1.272180e+06, +2.310445e+06, +1.373870e+04, +4.686219e+03, +1.261444e+04 },
+    { +3.450000e+02, +1.020692e-03, +9.734490e+02, -3.649713e+04, +2.993428e+05, +3.064876e+05, -2.935228e+04, +3.901550e+03, +4.176410e+03, +9.797273e+02, -5.769373e-01, +4.352656e-07, -5.163200e-03, +5.550927e-10, -1.053703e-15, +7.000000e+06, +1.325483e+06, +2.297448e+06, +1.273458e+04, +4.442048e+03, +1.277778e+04 },
+    { +3.500000e+02, +1.023773e-03, +1.033565e+03, -4.153657e+04, +3.202113e+05, +3.273777e+05, -3.437016e+04, +3.876110e+03, +4.179687e+03, +9.767788e+02, -6.022983e-01, +4.383589e-07, -4.985408e-03, +6.814553e-10, -1.088524e-15, +7.000000e+06, +1.373984e+06, +2.281236e+06, +1.178884e+04, +4.236918e+03, +1.292256e+04 },
+    { +3.550000e+02, +1.027004e-03, +1.092878e+03, -4.687563e+04, +3.410960e+05, +3.482851e+05, -3.968660e+04, +3.850527e+03, +4.183324e+03, +9.737057e+02, -6.268309e-01, +4.420734e-07, -4.831384e-03, +8.037608e-10, -1.127346e-15, +7.000000e+06, +1.417934e+06, +2.262068e+06, +1.089999e+04, +4.066658e+03, +1.304891e+04 },
+    { +3.600000e+02, +1.030384e-03, +1.151415e+03, -5.251034e+04, +3.619989e+05, +3.692116e+05, -4.529765e+04, +3.824882e+03, +4.187355e+03, +9.705117e+02, -6.506473e-01, +4.463918e-07, -4.698497e-03, +9.232352e-10, -1.170326e-15, +7.000000e+06, +1.457570e+06, +2.240185e+06, +1.006628e+04, +3.927402e+03, +1.315704e+04 },
+    { +3.650000e+02, +1.033912e-03, +1.209202e+03, -5.843688e+04, +3.829220e+05, +3.901593e+05, -5.119950e+04, +3.799243e+03, +4.191812e+03, +9.672002e+02, -6.738476e-01, +4.513028e-07, -4.584627e-03, +1.040979e-09, -1.217666e-15, +7.000000e+06, +1.493116e+06, +2.215807e+06, +9.285743e+03, +3.815592e+03, +1.324719e+04 },
+    { +3.700000e+02, +1.037588e-03, +1.266267e+03, -6.465158e+04, +4.038674e+05, +4.111305e+05, -5.738847e+04, +3.773675e+03, +4.196728e+03, +9.637741e+02, -6.965224e-01, +4.568004e-07, -4.488060e-03, +1.157996e-09, -1.269620e-15, +7.000000e+06, +1.524785e+06, +2.189140e+06, +8.556254e+03, +3.727970e+03, +1.331970e+04 },
+    { +3.750000e+02, +1.041411e-03, +1.322636e+03, -7.115089e+04, +4.248376e+05, +4.321274e+05, -6.386101e+04, +3.748234e+03, +4.202140e+03, +9.602357e+02, -7.187547e-01, +4.628831e-07, -4.407414e-03, +1.275219e-09, -1.326493e-15, +7.000000e+06, +1.552778e+06, +2.160372e+06, +7.875600e+03, +3.661563e+03, +1.337491e+04 },
+    { +3.800000e+02, +1.045383e-03, +1.378333e+03, -7.793139e+04, +4.458351e+05, +4.531528e+05, -7.061371e+04, +3.722969e+03, +4.208080e+03, +9.565872e+02, -7.406212e-01, +4.695544e-07, -4.341583e-03, +1.393532e-09, -1.388638e-15, +7.000000e+06, +1.577285e+06, +2.129679e+06, +7.241510e+03, +3.613670e+03, +1.341317e+04 },
+    { +3.850000e+02, +1.049505e-03, +1.433383e+03, -8.498979e+04, +4.668626e+05, +4.742092e+05, -7.764326e+04, +3.697922e+03, +4.214582e+03, +9.528300e+02, -7.621937e-01, +4.768217e-07, -4.289687e-03, +1.513785e-09, -1.456469e-15, +7.000000e+06, +1.598488e+06, +2.097220e+06, +6.651693e+03, +3.581844e+03, +1.343487e+04 },
+    { +3.900000e+02, +1.053779e-03, +1.487810e+03, -9.232295e+04, +4.879231e+05, +4.952996e+05, -8.494650e+04, +3.673132e+03, +4.221682e+03, +9.489656e+02, -7.835402e-01, +4.846969e-07, -4.251044e-03, +1.636814e-09, -1.530462e-15, +7.000000e+06, +1.616557e+06, +2.063145e+06, +6.103869e+03, +3.563875e+03, +1.344039e+04 },
+    { +3.950000e+02, +1.058207e-03, +1.541639e+03, -9.992781e+04, +5.090196e+05, +5.164271e+05, -9.252037e+04, +3.648629e+03, +4.229413e+03, +9.449949e+02, -8.047254e-01, +4.931959e-07, -4.225136e-03, +1.763456e-09, -1.611160e-15, +7.000000e+06, +1.631655e+06, +2.027592e+06, +5.595787e+03, +3.557774e+03, +1.343014e+04 },
+    { +4.000000e+02, +1.062791e-03, +1.594892e+03, -1.078015e+05, +5.301553e+05, +5.375948e+05, -1.003619e+05, +3.624441e+03, +4.237810e+03, +9.409185e+02, -8.258121e-01, +5.023389e-07, -4.211596e-03, +1.894560e-09, -1.699184e-15, +7.000000e+06, +1.643934e+06, +1.990688e+06, +5.125247e+03, +3.561750e+03, +1.340449e+04 },
+    { +4.100000e+02, +1.072444e-03, +1.699761e+03, -1.243441e+05, +5.725580e+05, +5.800651e+05, -1.168370e+05, +3.577092e+03, +4.256746e+03, +9.324499e+02, -8.679341e-01, +5.226593e-07, -4.220813e-03, +2.173712e-09, -1.900147e-15, +7.000000e+06, +1.660611e+06, +1.913292e+06, +4.288327e+03, +3.593674e+03, +1.330856e+04 },
+    { +4.200000e+02, +1.082768e-03, +1.802596e+03, -1.419297e+05, +6.151607e+05, +6.227401e+05, -1.343504e+05, +3.531221e+03, +4.278793e+03, +9.235587e+02, -9.103890e-01, +5.459098e-07, -4.278285e-03, +2.481910e-09, -2.140305e-15, +7.000000e+06, +1.667655e+06, +1.831804e+06, +3.576948e+03, +3.648712e+03, +1.315567e+04 },
+    { +4.300000e+02, +1.093805e-03, +1.903570e+03, -1.605393e+05, +6.579959e+05, +6.656525e+05, -1.528827e+05, +3.486912e+03, +4.304290e+03, +9.142393e+02, -9.536653e-01, +5.724237e-07, -4.385481e-03, +2.828006e-09, -2.428744e-15, +7.000000e+06, +1.666013e+06, +1.746958e+06, +2.976315e+03, +3.718126e+03, +1.294879e+04 },
+    { +4.400000e+02, +1.105606e-03, +2.002852e+03, -1.801554e+05, +7.010995e+05, +7.088387e+05, -1.724161e+05, +3.444217e+03, +4.333628e+03, +9.044810e+02, -9.982755e-01, +6.026316e-07, -4.545810e-03, +3.222694e-09, -2.777433e-15, +7.000000e+06, +1.656527e+06, +1.659389e+06, +2.473074e+03, +3.794967e+03, +1.269077e+04 },
+    { +4.500000e+02, +1.118234e-03, +2.100609e+03, -2.007623e+05, +7.445118e+05, +7.523394e+05, -1.929346e+05, +3.403161e+03, +4.367275e+03, +8.942675e+02, -1.044777e+00, +6.370837e-07, -4.764904e-03, +3.679343e-09, -3.202313e-15, +7.000000e+06, +1.639937e+06, +1.569653e+06, +2.055306e+03, +3.873720e+03, +1.238438e+04 },
+    { +4.600000e+02, +1.131763e-03, +2.197009e+03, -2.223461e+05, +7.882781e+05, +7.962004e+05, -2.144238e+05, +3.363755e+03, +4.405800e+03, +8.835771e+02, -1.093797e+00, +6.764817e-07, -5.051149e-03, +4.215156e-09, -3.724923e-15, +7.000000e+06, +1.616891e+06, +1.478237e+06, +1.712471e+03, +3.950021e+03, +1.203231e+04 },
+    { +4.700000e+02, +1.146288e-03, +2.292223e+03, -2.448949e+05, +8.324500e+05, +8.404740e+05, -2.368709e+05, +3.326005e+03, +4.449913e+03, +8.723808e+02, -1.146063e+00, +7.217255e-07, -5.416561e-03, +4.852863e-09, -4.374855e-15, +7.000000e+06, +1.587949e+06, +1.385568e+06, +1.435337e+03, +4.020413e+03, +1.163717e+04 },
+    { +4.800000e+02, +1.161923e-03, +2.386428e+03, -2.683984e+05, +8.770868e+05, +8.852203e+05, -2.602649e+05, +3.289919e+03, +4.500514e+03, +8.606421e+02, -1.202448e+00, +7.739800e-07, -5.878191e-03, +5.623274e-09, -5.193561e-15, +7.000000e+06, +1.553591e+06, +1.292023e+06, +1.215882e+03, +4.082156e+03, +1.120150e+04 },
+    { +4.900000e+02, +1.178808e-03, +2.479809e+03, -2.928483e+05, +9.222581e+05, +9.305097e+05, -2.845967e+05, +3.255515e+03, +4.558761e+03, +8.483145e+02, -1.264028e+00, +8.347743e-07, -6.460362e-03, +6.569273e-09, -6.240454e-15, +7.000000e+06, +1.514215e+06, +1.197929e+06, +1.047213e+03, +4.133062e+03, +1.072776e+04 },
+    { +5.000000e+02, +1.197118e-03, +2.572570e+03, -3.182388e+05, +9.680462e+05, +9.764260e+05, -3.098590e+05, +3.222831e+03, +4.626174e+03, +8.353397e+02, -1.332173e+00, +9.061524e-07, -7.198320e-03, +7.752291e-09, -7.602973e-15, +7.000000e+06, +1.470142e+06, +1.103567e+06, +9.234883e+02, +4.171367e+03, +1.021833e+04 },
+    { +5.100000e+02, +1.217073e-03, +2.664936e+03, -3.445663e+05, +1.014551e+06, +1.023071e+06, -3.360468e+05, +3.191940e+03, +4.704798e+03, +8.216433e+02, -1.408685e+00, +9.909080e-07, -8.144372e-03, +9.263223e-09, -9.413890e-15, +7.000000e+06, +1.421610e+06, +1.009175e+06, +8.398664e+02, +4.195606e+03, +9.675405e+03 },
+    { +5.200000e+02, +1.238958e-03, +2.757165e+03, -3.718300e+05, +1.061896e+06, +1.070569e+06, -3.631573e+05, +3.162963e+03, +4.797452e+03, +8.071300e+02, -1.496016e+00, +1.092966e-06, -9.378620e-03, +1.124167e-08, -1.188244e-14, +7.000000e+06, +1.368767e+06, +9.149413e+05, +7.924943e+02, +4.204515e+03, +9.100919e+03 },
+    { +5.300000e+02, +1.263144e-03, +2.849566e+03, -4.000326e+05, +1.110237e+06, +1.119079e+06, -3.911906e+05, +3.136094e+03, +4.908153e+03, +7.916755e+02, -1.597634e+00, +1.218031e-06, -1.102872e-02, +1.391181e-08, -1.535341e-14, +7.000000e+06, +1.311654e+06, +8.209974e+05, +7.785664e+02, +4.196922e+03, +8.496306e+03 },
+    { +5.400000e+02, +1.290135e-03, +2.942522e+03, -4.291814e+05, +1.159780e+06, +1.168811e+06, -4.201504e+05, +3.111648e+03, +5.042854e+03, +7.751129e+02, -1.718672e+00, +1.374742e-06, -1.330855e-02, +1.765350e-08, -2.042715e-14, +7.000000e+06, +1.250177e+06, +7.274090e+05, +7.965164e+02, +4.171644e+03, +7.862196e+03 },
+    { +5.500000e+02, +1.320636e-03, +3.036530e+03, -4.592890e+05, +1.210802e+06, +1.220047e+06, -4.500445e+05, +3.090132e+03, +5.210830e+03, +7.572112e+02, -1.867142e+00, +1.576901e-06, -1.660026e-02, +2.315567e-08, -2.822403e-14, +7.000000e+06, +1.184058e+06, +6.341553e+05, +8.464903e+02, +4.127379e+03, +7.197902e+03 },
+    { +5.589790e+02, +1.351856e-03, +3.122397e+03, -4.871568e+05, +1.258197e+06, +1.267660e+06, -4.776938e+05, +3.073997e+03, +5.402484e+03, +7.397236e+02, -2.034665e+00, +1.816220e-06, -2.101579e-02, +3.069267e-08, -3.938231e-14, +7.000000e+06, +1.120274e+06, +5.505941e+05, +9.209974e+02, +4.070239e+03, +6.573486e+03 },
+    { +5.589790e+02, +1.351856e-03, +3.122397e+03, -4.871568e+05, +1.258197e+06, +1.267660e+06, -4.776938e+05, +3.073997e+03, +5.402484e+03, +7.397236e+02, -2.034665e+00, +1.816220e-06, -2.101579e-02, +3.069267e-08, -3.938231e-14, +7.000000e+06, +1.120274e+06, +5.505941e+05, +9.209974e+02, +4.070239e+03, +6.573486e+03 },
+    { +5.600000e+02, +2.754532e-02, +5.824422e+03, -6.764533e+05, +2.585223e+06, +2.778040e+06, -4.836361e+05, +2.772589e+03, +5.242127e+03, +3.630381e+01, -2.135060e-01, +7.843100e-06, +6.082193e-03, -1.151219e-07, +1.694579e-12, +7.000000e+06, +2.722214e+04, +1.275006e+05, -1.364544e+02, +1.121558e+03, -3.512356e+03 },
+    { +5.700000e+02, +2.905380e-02, +5.909577e+03, -7.456954e+05, +2.622763e+06, +2.826140e+06, -5.423188e+05, +2.505532e+03, +4.458750e+03, +3.441891e+01, -1.677071e-01, +6.928403e-06, +3.487117e-03, -7.361884e-08, +1.098507e-12, +7.000000e+06, +2.420574e+04, +1.443334e+05, -8.180157e+01, +9.797077e+02, -3.302960e+03 },
+    { +5.800000e+02, +3.040095e-02, +5.982800e+03, -8.145951e+05, +2.655429e+06, +2.868235e+06, -6.017884e+05, +2.344760e+03, +3.993254e+03, +3.289371e+01, -1.392323e-01, +6.303694e-06, +2.334722e-03, -5.329977e-08, +7.931229e-13, +7.000000e+06, +2.208742e+04, +1.586371e+05, -5.824234e+01, +9.004737e+02, -3.166322e+03 },
+    { +5.900000e+02, +3.163952e-02, +6.048185e+03, -8.834255e+05, +2.685004e+06, +2.906480e+06, -6.619488e+05, +2.231302e+03, +3.673271e+03, +3.160604e+01, -1.193631e-01, +5.835739e-06, +1.693427e-03, -4.120350e-08, +6.069293e-13, +7.000000e+06, +2.045381e+04, +1.713579e+05, -4.486213e+01, +8.453609e+02, -3.053870e+03 },
+    { +6.000000e+02, +3.279801e-02, +6.107847e+03, -9.523192e+05, +2.712389e+06, +2.941975e+06, -7.227331e+05, +2.145014e+03, +3.436526e+03, +3.048965e+01, -1.045846e-01, +5.466173e-06, +1.290448e-03, -3.320928e-08, +4.822119e-13, +7.000000e+06, +1.913305e+04, +1.829433e+05, -3.589047e+01, +8.026727e+02, -2.952485e+03 },
+    { +6.100000e+02, +3.389443e-02, +6.163084e+03, -1.021352e+06, +2.738129e+06, +2.975390e+06, -7.840911e+05, +2.076987e+03, +3.253907e+03, +2.950337e+01, -9.312450e-02, +5.163779e-06, +1.018009e-03, -2.757311e-08, +3.935468e-13, +7.000000e+06, +1.803418e+04, +1.936566e+05, -2.933631e+01, +7.679023e+02, -2.858205e+03 },
+    { +6.200000e+02, +3.494117e-02, +6.214777e+03, -1.090571e+06, +2.762591e+06, +3.007179e+06, -8.459830e+05, +2.022318e+03, +3.109205e+03, +2.861954e+01, -8.396375e-02, +4.909819e-06, +8.244903e-04, -2.341641e-08, +3.278022e-13, +7.000000e+06, +1.710119e+04, +2.036735e+05, -2.433066e+01, +7.388355e+02, -2.769590e+03 },
+    { +6.300000e+02, +3.594721e-02, +6.263561e+03, -1.160007e+06, +2.786036e+06, +3.037667e+06, -9.083769e+05, +1.977873e+03, +2.992330e+03, +2.781857e+01, -7.646610e-02, +4.692187e-06, +6.819099e-04, -2.024495e-08, +2.774731e-13, +7.000000e+06, +1.629647e+04, +2.131202e+05, -2.040781e+01, +7.141477e+02, -2.685932e+03 },
+    { +6.400000e+02, +3.691933e-02, +6.309909e+03, -1.229681e+06, +2.808660e+06, +3.067096e+06, -9.712462e+05, +1.941469e+03, +2.896537e+03, +2.708609e+01, -7.021133e-02, +4.502646e-06, +5.737921e-04, -1.775910e-08, +2.379592e-13, +7.000000e+06, +1.559335e+04, +2.220916e+05, -1.727979e+01, +6.929390e+02, -2.606748e+03 },
+    { +6.500000e+02, +3.786276e-02, +6.354185e+03, -1.299608e+06, +2.830612e+06, +3.095652e+06, -1.034568e+06, +1.911503e+03, +2.817102e+03, +2.641118e+01, -6.491005e-02, +4.335366e-06, +4.898508e-04, -1.576711e-08, +2.062907e-13, +7.000000e+06, +1.497222e+04, +2.306610e+05, -1.475243e+01, +6.745525e+02, -2.531643e+03 },
+    { +6.750000e+02, +4.012102e-02, +6.457544e+03, -1.475582e+06, +2.883261e+06, +3.164108e+06, -1.194735e+06, +1.857454e+03, +2.669708e+03, +2.492459e+01, -5.460882e-02, +3.989159e-06, +3.468734e-04, -1.220184e-08, +1.497824e-13, +7.000000e+06, +1.368931e+04, +2.506794e+05, -1.024593e+01, +6.379173e+02, -2.359482e+03 },
+    { +7.000000e+02, +4.226969e-02, +6.552741e+03, -1.653266e+06, +2.933653e+06, +3.229541e+06, -1.357378e+06, +1.824042e+03, +2.571241e+03, +2.365762e+01, -4.711193e-02, +3.715197e-06, +2.594183e-04, -9.864544e-09, +1.131230e-13, +7.000000e+06, +1.268087e+04, +2.691647e+05, -7.382381e+00, +6.107538e+02, -2.205999e+03 },
+    { +7.250000e+02, +4.433743e-02, +6.641718e+03, -1.832682e+06, +2.982564e+06, +3.292926e+06, -1.522320e+06, +1.804070e+03, +2.503677e+03, +2.255431e+01, -4.139136e-02, +3.490151e-06, +2.019449e-04, -8.228800e-09, +8.789938e-14, +7.000000e+06, +1.185948e+04, +2.865206e+05, -5.480912e+00, +5.899573e+02, -2.067537e+03 },
+    { +7.500000e+02, +4.634324e-02, +6.725757e+03, -2.013825e+06, +3.030492e+06, +3.354895e+06, -1.689423e+06, +1.793228e+03, +2.456717e+03, +2.157812e+01, -3.686957e-02, +3.300173e-06, +1.620647e-04, -7.026814e-09, +6.977519e-14, +7.000000e+06, +1.117201e+04, +3.030144e+05, -4.171410e+00, +5.736115e+02, -1.941292e+03 },
+    { +7.750000e+02, +4.830035e-02, +6.805748e+03, -2.196676e+06, +3.077778e+06, +3.415880e+06, -1.858574e+06, +1.788812e+03, +2.424091e+03, +2.070379e+01, -3.319714e-02, +3.136452e-06, +1.331907e-04, -6.109658e-09, +5.631281e-14, +7.000000e+06, +1.058430e+04, +3.188316e+05, -3.241380e+00, +5.604799e+02, -1.825119e+03 },
+    { +8.000000e+02, +5.021827e-02, +6.882334e+03, -2.381210e+06, +3.124658e+06, +3.476185e+06, -2.029682e+06, +1.789056e+03, +2.401792e+03, +1.991307e+01, -3.015005e-02, +2.993065e-06, +1.115621e-04, -5.388627e-09, +4.604824e-14, +7.000000e+06, +1.007330e+04, +3.341057e+05, -2.563288e+00, +5.497354e+02, -1.717373e+03 },
+    { +8.250000e+02, +5.210413e-02, +6.956000e+03, -2.567395e+06, +3.171305e+06, +3.536033e+06, -2.202666e+06, +1.792767e+03, +2.387146e+03, +1.919234e+01, -2.757783e-02, +2.865857e-06, +9.490516e-05, -4.807918e-09, +3.805511e-14, +7.000000e+06, +9.622892e+03, +3.489358e+05, -2.057643e+00, +5.408068e+02, -1.616775e+03 },
+    { +8.500000e+02, +5.396333e-02, +7.027119e+03, -2.755204e+06, +3.217848e+06, +3.595591e+06, -2.377460e+06, +1.799112e+03, +2.378311e+03, +1.853110e+01, -2.537550e-02, +2.751809e-06, +8.177932e-05, -4.330822e-09, +3.172197e-14, +7.000000e+06, +9.221388e+03, +3.633974e+05, -1.673221e+00, +5.332886e+02, -1.522318e+03 },
+    { +9.000000e+02, +5.761779e-02, +7.162847e+03, -3.135568e+06, +3.310994e+06, +3.714319e+06, -2.732243e+06, +1.817470e+03, +2.373168e+03, +1.735575e+01, -2.179769e-02, +2.554689e-06, +6.262429e-05, -3.594624e-09, +2.248792e-14, +7.000000e+06, +8.532425e+03, +3.914371e+05, -1.142896e+00, +5.213792e+02, -1.348762e+03 },
+    { +9.500000e+02, +6.120627e-02, +7.291285e+03, -3.522068e+06, +3.404653e+06, +3.833097e+06, -3.093624e+06, +1.840944e+03, +2.379461e+03, +1.633820e+01, -1.901343e-02, +2.389113e-06, +4.951600e-05, -3.054210e-09, +1.625343e-14, +7.000000e+06, +7.958363e+03, +4.185654e+05, -8.088352e-01, +5.124267e+02, -1.191887e+03 },
+    { +1.000000e+03, +6.474506e-02, +7.413659e+03, -3.914486e+06, +3.499173e+06, +3.952388e+06, -3.461271e+06, +1.867644e+03, +2.393189e+03, +1.544519e+01, -1.678475e-02, +2.247154e-06, +4.012022e-05, -2.641473e-09, +1.189634e-14, +7.000000e+06, +7.469336e+03, +4.450072e+05, -5.891154e-01, +5.054981e+02, -1.048370e+03 },
+    { +1.050000e+03, +6.824545e-02, +7.530859e+03, -4.312622e+06, +3.594780e+06, +4.072498e+06, -3.834904e+06, +1.896359e+03, +2.411858e+03, +1.465299e+01, -1.496142e-02, +2.123511e-06, +3.313994e-05, -2.316475e-09, +8.769380e-15, +7.000000e+06, +7.045606e+03, +4.709182e+05, -4.395143e-01, +5.000089e+02, -9.158099e+02 },
+    { +1.100000e+03, +7.171554e-02, +7.643555e+03, -4.716290e+06, +3.691620e+06, +4.193629e+06, -4.214282e+06, +1.926262e+03, +2.433819e+03, +1.394398e+01, -1.344350e-02, +2.014464e-06, +2.780453e-05, -2.054306e-09, +6.477836e-15, +7.000000e+06, +6.673484e+03, +4.964099e+05, -3.347088e-01, +4.955751e+02, -7.924123e+02 },
+    { +1.150000e+03, +7.516131e-02, +7.752268e+03, -5.125322e+06, +3.789786e+06, +4.315915e+06, -4.599193e+06, +1.956765e+03, +2.457933e+03, +1.330472e+01, -1.216169e-02, +1.917308e-06, +2.363103e-05, -1.838643e-09, +4.770158e-15, +7.000000e+06, +6.343109e+03, +5.215646e+05, -2.594938e-01, +4.919345e+02, -6.767949e+02 },
+    { +1.200000e+03, +7.858726e-02, +7.857411e+03, -5.539560e+06, +3.889333e+06, +4.439444e+06, -4.989449e+06, +1.987437e+03, +2.483390e+03, +1.272471e+01, -1.106635e-02, +1.830012e-06, +2.030337e-05, -1.658354e-09, +3.480250e-15, +7.000000e+06, +6.047146e+03, +5.464444e+05, -2.043794e-01, +4.889028e+02, -5.678694e+02 },
+    { +1.250000e+03, +8.199686e-02, +7.959317e+03, -5.958858e+06, +3.990289e+06, +4.564267e+06, -5.384880e+06, +2.017956e+03, +2.509600e+03, +1.219559e+01, -1.012087e-02, +1.751015e-06, +1.760709e-05, -1.505588e-09, +2.495175e-15, +7.000000e+06, +5.780000e+03, +5.710973e+05, -1.632488e-01, +4.863470e+02, -4.647628e+02 },
+    { +1.273000e+03, +8.356055e-02, +8.005185e+03, -6.153397e+06, +4.037204e+06, +4.622128e+06, -5.568473e+06, +2.031876e+03, +2.521784e+03, +1.196737e+01, -9.728408e-03, +1.717116e-06, +1.653577e-05, -1.442930e-09, +2.121791e-15, +7.000000e+06, +5.665552e+03, +5.823720e+05, -1.478542e-01, +4.853031e+02, -4.190869e+02 },
+    // P = 8.0 MPa
+    { +2.725620e+02, +9.962150e-04, -8.744170e+00, +1.330992e+01, -2.370019e+03, +5.599701e+03, +7.983030e+03, +4.181845e+03, +4.183104e+03, +1.003799e+03, +4.831844e-02, +5.016442e-07, -1.723530e-02, -3.740485e-09, -1.174924e-15, +8.000000e+06, -9.632015e+04, +1.993445e+06, +3.294293e+04, +1.441431e+04, +9.307270e+03 },
+    { +2.750000e+02, +9.961476e-04, +2.848195e+01, -1.028788e+01, +7.822249e+03, +1.579143e+04, +7.958893e+03, +4.177765e+03, +4.177801e+03, +1.003867e+03, +7.972009e-03, +4.929931e-07, -1.589602e-02, -3.364139e-09, -1.125443e-15, +8.000000e+06, -1.617063e+04, +2.028426e+06, +3.202379e+04, +1.376691e+04, +9.392929e+03 },
+    { +2.800000e+02, +9.962954e-04, +1.036823e+02, -3.425061e+02, +2.868855e+04, +3.665891e+04, +7.627857e+03, +4.167240e+03, +4.169751e+03, +1.003718e+03, -6.571118e-02, +4.778503e-07, -1.368144e-02, -2.717801e-09, -1.048417e-15, +8.000000e+06, +1.375141e+05, +2.092706e+06, +3.023696e+04, +1.253377e+04, +9.608561e+03 },
+    { +2.850000e+02, +9.967841e-04, +1.774356e+02, -1.049793e+03, +4.951937e+04, +5.749364e+04, +6.924480e+03, +4.154301e+03, +4.164533e+03, +1.003226e+03, -1.297082e-01, +4.656060e-07, -1.198936e-02, -2.197573e-09, -9.955161e-16, +8.000000e+06, +2.785793e+05, +2.147739e+06, +2.854564e+04, +1.141619e+04, +9.862625e+03 },
+    { +2.900000e+02, +9.975722e-04, +2.498339e+02, -2.124819e+03, +7.032702e+04, +7.830760e+04, +5.855758e+03, +4.139376e+03, +4.161335e+03, +1.002434e+03, -1.862136e-01, +4.557232e-07, -1.066428e-02, -1.768579e-09, -9.596843e-16, +8.000000e+06, +4.086111e+05, +2.194315e+06, +2.692388e+04, +1.040389e+04, +1.013970e+04 },
+    { +2.950000e+02, +9.986279e-04, +3.209530e+02, -3.560751e+03, +9.112039e+04, +9.910941e+04, +4.428272e+03, +4.122762e+03, +4.159598e+03, +1.001374e+03, -2.367929e-01, +4.478070e-07, -9.605388e-03, -1.407737e-09, -9.364176e-16, +8.000000e+06, +5.287834e+05, +2.233105e+06, +2.535913e+04, +9.489294e+03, +1.042790e+04 },
+    { +3.000000e+02, +9.999263e-04, +3.908570e+02, -5.351157e+03, +1.119059e+05, +1.199054e+05, +2.648253e+03, +4.104678e+03, +4.158929e+03, +1.000074e+03, -2.825969e-01, +4.415590e-07, -8.744831e-03, -1.099105e-09, -9.227736e-16, +8.000000e+06, +6.399980e+05, +2.264703e+06, +2.384652e+04, +8.666154e+03, +1.071837e+04 },
+    { +3.050000e+02, +1.001448e-03, +4.596012e+02, -7.489946e+03, +1.326884e+05, +1.407000e+05, +5.216345e+02, +4.085300e+03, +4.159046e+03, +9.985546e+02, -3.244925e-01, +4.367482e-07, -8.035479e-03, -8.312576e-10, -9.167889e-16, +8.000000e+06, +7.429739e+05, +2.289649e+06, +2.238535e+04, +7.928787e+03, +1.100465e+04 },
+    { +3.100000e+02, +1.003176e-03, +5.272345e+02, -9.971315e+03, +1.534714e+05, +1.614968e+05, -1.945908e+03, +4.064777e+03, +4.159750e+03, +9.968342e+02, -3.631471e-01, +4.331927e-07, -7.443706e-03, -5.957409e-10, -9.171307e-16, +8.000000e+06, +8.383040e+05, +2.308442e+06, +2.097692e+04, +7.271689e+03, +1.128205e+04 },
+    { +3.150000e+02, +1.005098e-03, +5.938006e+02, -1.278972e+04, +1.742575e+05, +1.822982e+05, -4.748932e+03, +4.043242e+03, +4.160903e+03, +9.949276e+02, -3.990843e-01, +4.307477e-07, -6.944978e-03, -3.861250e-10, -9.228847e-16, +8.000000e+06, +9.264921e+05, +2.321545e+06, +1.962321e+04, +6.689375e+03, +1.154725e+04 },
+    { +3.200000e+02, +1.007204e-03, +6.593394e+02, -1.593984e+04, +1.950488e+05, +2.031064e+05, -7.882202e+03, +4.020823e+03, +4.162417e+03, +9.928472e+02, -4.327213e-01, +4.292966e-07, -6.521049e-03, -1.974070e-10, -9.334221e-16, +8.000000e+06, +1.007977e+06, +2.329392e+06, +1.832622e+04, +6.176357e+03, +1.179792e+04 },
+    { +3.250000e+02, +1.009485e-03, +7.238880e+02, -1.941656e+04, +2.158470e+05, +2.239229e+05, -1.134068e+04, +3.997643e+03, +4.164238e+03, +9.906037e+02, -4.643963e-01, +4.287454e-07, -6.158132e-03, -2.561592e-11, -9.483152e-16, +8.000000e+06, +1.083152e+06, +2.332386e+06, +1.708754e+04, +5.727179e+03, +1.203245e+04 },
+    { +3.300000e+02, +1.011935e-03, +7.874811e+02, -2.321497e+04, +2.366538e+05, +2.447493e+05, -1.511949e+04, +3.973817e+03, +4.166338e+03, +9.882060e+02, -4.943866e-01, +4.290177e-07, -5.845665e-03, +1.324556e-10, -9.672832e-16, +8.000000e+06, +1.152369e+06, +2.330906e+06, +1.590820e+04, +5.336478e+03, +1.224978e+04 },
+    { +3.350000e+02, +1.014546e-03, +8.501514e+02, -2.733032e+04, +2.574704e+05, +2.655868e+05, -1.921395e+04, +3.949458e+03, +4.168711e+03, +9.856622e+02, -5.229233e-01, +4.300515e-07, -5.575458e-03, +2.794389e-10, -9.901553e-16, +8.000000e+06, +1.215955e+06, +2.325303e+06, +1.478864e+04, +4.999047e+03, +1.244921e+04 },
+    { +3.400000e+02, +1.017316e-03, +9.119304e+02, -3.175804e+04, +2.782983e+05, +2.864368e+05, -2.361952e+04, +3.924673e+03, +4.171364e+03, +9.829789e+02, -5.502009e-01, +4.317972e-07, -5.341096e-03, +4.175253e-10, -1.016848e-15, +8.000000e+06, +1.274211e+06, +2.315902e+06, +1.372874e+04, +4.709891e+03, +1.263038e+04 },
+    { +3.450000e+02, +1.020239e-03, +9.728485e+02, -3.649373e+04, +2.991390e+05, +3.073009e+05, -2.833182e+04, +3.899562e+03, +4.174316e+03, +9.801620e+02, -5.763855e-01, +4.342150e-07, -5.137510e-03, +5.485653e-10, -1.047348e-15, +8.000000e+06, +1.327419e+06, +2.303006e+06, +1.272786e+04, +4.464264e+03, +1.279312e+04 },
+    { +3.500000e+02, +1.023315e-03, +1.032935e+03, -4.153313e+04, +3.199940e+05, +3.281805e+05, -3.334662e+04, +3.874217e+03, +4.177591e+03, +9.772166e+02, -6.016205e-01, +4.372738e-07, -4.960664e-03, +6.741444e-10, -1.081702e-15, +8.000000e+06, +1.375844e+06, +2.286897e+06, +1.178491e+04, +4.257705e+03, +1.293741e+04 },
+    { +3.550000e+02, +1.026539e-03, +1.092218e+03, -4.687214e+04, +3.408651e+05, +3.490774e+05, -3.865983e+04, +3.848726e+03, +4.181219e+03, +9.741472e+02, -6.260313e-01, +4.409497e-07, -4.807327e-03, +7.956406e-10, -1.120012e-15, +8.000000e+06, +1.419734e+06, +2.267832e+06, +1.089847e+04, +4.086050e+03, +1.306337e+04 },
+    { +3.600000e+02, +1.029911e-03, +1.150725e+03, -5.250679e+04, +3.617541e+05, +3.699934e+05, -4.426750e+04, +3.823167e+03, +4.185232e+03, +9.709575e+02, -6.497286e-01, +4.452254e-07, -4.674897e-03, +9.142702e-10, -1.162427e-15, +8.000000e+06, +1.459325e+06, +2.246053e+06, +1.006681e+04, +3.945441e+03, +1.317121e+04 },
+    { +3.650000e+02, +1.033431e-03, +1.208483e+03, -5.843327e+04, +3.826630e+05, +3.909304e+05, -5.016582e+04, +3.797611e+03, +4.189663e+03, +9.676509e+02, -6.728115e-01, +4.500894e-07, -4.561275e-03, +1.031124e-09, -1.209145e-15, +8.000000e+06, +1.494840e+06, +2.221781e+06, +9.288009e+03, +3.832324e+03, +1.326117e+04 },
+    { +3.700000e+02, +1.037097e-03, +1.265519e+03, -6.464790e+04, +4.035940e+05, +4.118907e+05, -5.635112e+04, +3.772121e+03, +4.194546e+03, +9.642303e+02, -6.953698e-01, +4.555354e-07, -4.464763e-03, +1.147196e-09, -1.260413e-15, +8.000000e+06, +1.526489e+06, +2.195219e+06, +8.559981e+03, +3.743441e+03, +1.333357e+04 },
+    { +3.750000e+02, +1.040910e-03, +1.321857e+03, -7.114713e+04, +4.245494e+05, +4.328767e+05, -6.281985e+04, +3.746754e+03, +4.199916e+03, +9.606980e+02, -7.174854e-01, +4.615616e-07, -4.383994e-03, +1.263410e-09, -1.316525e-15, +8.000000e+06, +1.554474e+06, +2.166558e+06, +7.880541e+03, +3.675822e+03, +1.338875e+04 },
+    { +3.800000e+02, +1.044871e-03, +1.377525e+03, -7.792755e+04, +4.455318e+05, +4.538908e+05, -6.956858e+04, +3.721559e+03, +4.205807e+03, +9.570560e+02, -7.392342e-01, +4.681712e-07, -4.317867e-03, +1.380638e-09, -1.377829e-15, +8.000000e+06, +1.578983e+06, +2.135971e+06, +7.247445e+03, +3.626766e+03, +1.342707e+04 },
+    { +3.850000e+02, +1.048981e-03, +1.432545e+03, -8.498586e+04, +4.665438e+05, +4.749357e+05, -7.659402e+04, +3.696579e+03, +4.212253e+03, +9.533061e+02, -7.606870e-01, +4.753711e-07, -4.265509e-03, +1.499718e-09, -1.444725e-15, +8.000000e+06, +1.600196e+06, +2.103620e+06, +6.658428e+03, +3.593826e+03, +1.344890e+04 },
+    { +3.900000e+02, +1.053242e-03, +1.486942e+03, -9.231892e+04, +4.875884e+05, +4.960143e+05, -8.389299e+04, +3.671853e+03, +4.219288e+03, +9.494495e+02, -7.819110e-01, +4.831728e-07, -4.226238e-03, +1.621475e-09, -1.517676e-15, +8.000000e+06, +1.618284e+06, +2.069653e+06, +6.111229e+03, +3.574792e+03, +1.345463e+04 },
+    { +3.950000e+02, +1.057656e-03, +1.540739e+03, -9.992368e+04, +5.086684e+05, +5.171296e+05, -9.146243e+04, +3.647410e+03, +4.226946e+03, +9.454873e+02, -8.029703e-01, +4.915917e-07, -4.199535e-03, +1.746729e-09, -1.597213e-15, +8.000000e+06, +1.633409e+06, +2.034209e+06, +5.603618e+03, +3.567672e+03, +1.344464e+04 },
+    { +4.000000e+02, +1.062225e-03, +1.593961e+03, -1.077972e+05, +5.297870e+05, +5.382848e+05, -9.929942e+04, +3.623279e+03, +4.235261e+03, +9.414200e+02, -8.239267e-01, +5.006473e-07, -4.185031e-03, +1.876315e-09, -1.683939e-15, +8.000000e+06, +1.645723e+06, +1.997414e+06, +5.133411e+03, +3.570676e+03, +1.341932e+04 },
+    { +4.100000e+02, +1.071844e-03, +1.698765e+03, -1.243396e+05, +5.721540e+05, +5.807287e+05, -1.157648e+05, +3.576037e+03, +4.254004e+03, +9.329716e+02, -8.657713e-01, +5.207684e-07, -4.191775e-03, +2.151961e-09, -1.881815e-15, +8.000000e+06, +1.662488e+06, +1.920239e+06, +4.296802e+03, +3.600789e+03, +1.332426e+04 },
+    { +4.200000e+02, +1.082130e-03, +1.801531e+03, -1.419250e+05, +6.147181e+05, +6.233751e+05, -1.332679e+05, +3.530260e+03, +4.275815e+03, +9.241036e+02, -9.079202e-01, +5.437806e-07, -4.245969e-03, +2.455874e-09, -2.118060e-15, +8.000000e+06, +1.669644e+06, +1.838977e+06, +3.585341e+03, +3.654185e+03, +1.317247e+04 },
+    { +4.300000e+02, +1.093122e-03, +1.902432e+03, -1.605342e+05, +6.575114e+05, +6.662564e+05, -1.517892e+05, +3.486037e+03, +4.301025e+03, +9.148106e+02, -9.508530e-01, +5.700086e-07, -4.348936e-03, +2.796663e-09, -2.401488e-15, +8.000000e+06, +1.668138e+06, +1.754360e+06, +2.984308e+03, +3.722114e+03, +1.296690e+04 },
+    { +4.400000e+02, +1.104872e-03, +2.001634e+03, -1.801499e+05, +7.005693e+05, +7.094083e+05, -1.713109e+05, +3.443416e+03, +4.330016e+03, +9.050822e+02, -9.950719e-01, +5.998711e-07, -4.503868e-03, +3.184693e-09, -2.743683e-15, +8.000000e+06, +1.658810e+06, +1.667025e+06, +2.480405e+03, +3.797618e+03, +1.271043e+04 },
+    { +4.500000e+02, +1.117440e-03, +2.099306e+03, -2.007563e+05, +7.439313e+05, +7.528708e+05, -1.918168e+05, +3.402425e+03, +4.363242e+03, +8.949030e+02, -1.041121e+00, +6.339026e-07, -4.716088e-03, +3.632876e-09, -3.160039e-15, +8.000000e+06, +1.642399e+06, +1.577530e+06, +2.061752e+03, +3.875172e+03, +1.240580e+04 },
+    { +4.600000e+02, +1.130900e-03, +2.195612e+03, -2.223397e+05, +7.876418e+05, +7.966890e+05, -2.132925e+05, +3.363074e+03, +4.401255e+03, +8.842517e+02, -1.089611e+00, +6.727837e-07, -4.993534e-03, +4.157765e-09, -3.671296e-15, +8.000000e+06, +1.619556e+06, +1.486362e+06, +1.717838e+03, +3.950404e+03, +1.205571e+04 },
+    { +4.700000e+02, +1.145344e-03, +2.290722e+03, -2.448878e+05, +8.317514e+05, +8.409141e+05, -2.357251e+05, +3.325367e+03, +4.444743e+03, +8.731003e+02, -1.141247e+00, +7.173853e-07, -5.347580e-03, +4.781148e-09, -4.305852e-15, +8.000000e+06, +1.590842e+06, +1.393951e+06, +1.439443e+03, +4.019849e+03, +1.166277e+04 },
+    { +4.800000e+02, +1.160883e-03, +2.384809e+03, -2.683905e+05, +8.763179e+05, +8.856050e+05, -2.591035e+05, +3.289311e+03, +4.494571e+03, +8.614135e+02, -1.196871e+00, +7.688318e-07, -5.794328e-03, +5.532431e-09, -5.103346e-15, +8.000000e+06, +1.556739e+06, +1.300675e+06, +1.218549e+03, +4.080761e+03, +1.122952e+04 },
+    { +4.900000e+02, +1.177653e-03, +2.478059e+03, -2.928397e+05, +9.214091e+05, +9.308304e+05, -2.834184e+05, +3.254922e+03, +4.551854e+03, +8.491462e+02, -1.257517e+00, +8.285942e-07, -6.356671e-03, +6.452355e-09, -6.120334e-15, +8.000000e+06, +1.517652e+06, +1.206863e+06, +1.048253e+03, +4.130949e+03, +1.075844e+04 },
+    { +5.000000e+02, +1.195826e-03, +2.570668e+03, -3.182291e+05, +9.671051e+05, +9.766717e+05, -3.086625e+05, +3.222235e+03, +4.618046e+03, +8.362421e+02, -1.324498e+00, +8.986316e-07, -7.067636e-03, +7.598961e-09, -7.439624e-15, +8.000000e+06, +1.473905e+06, +1.112803e+06, +9.226865e+02, +4.168643e+03, +1.025194e+04 },
+    { +5.100000e+02, +1.215614e-03, +2.662858e+03, -3.445553e+05, +1.013503e+06, +1.023227e+06, -3.348304e+05, +3.191317e+03, +4.695098e+03, +8.226295e+02, -1.399525e+00, +9.816087e-07, -7.975952e-03, +9.057578e-09, -9.186181e-15, +8.000000e+06, +1.425747e+06, +1.018736e+06, +8.369642e+02, +4.192377e+03, +9.712249e+03 },
+    { +5.200000e+02, +1.237291e-03, +2.754880e+03, -3.718175e+05, +1.060720e+06, +1.070619e+06, -3.619191e+05, +3.162278e+03, +4.785680e+03, +8.082171e+02, -1.484917e+00, +1.081249e-06, -9.155713e-03, +1.095828e-08, -1.155546e-14, +8.000000e+06, +1.373335e+06, +9.248567e+05, +7.871578e+02, +4.200885e+03, +9.141358e+03 },
+    { +5.300000e+02, +1.261215e-03, +2.847032e+03, -4.000182e+05, +1.108909e+06, +1.118999e+06, -3.899284e+05, +3.135303e+03, +4.893577e+03, +7.928859e+02, -1.583926e+00, +1.202923e-06, -1.072394e-02, +1.350797e-08, -1.486661e-14, +8.000000e+06, +1.316731e+06, +8.313085e+05, +7.703369e+02, +4.192993e+03, +8.540801e+03 },
+    { +5.400000e+02, +1.287867e-03, +2.939681e+03, -4.291644e+05, +1.158263e+06, +1.168566e+06, -4.188614e+05, +3.110680e+03, +5.024346e+03, +7.764776e+02, -1.701322e+00, +1.354698e-06, -1.287448e-02, +1.705324e-08, -1.966886e-14, +8.000000e+06, +1.255868e+06, +7.381718e+05, +7.847222e+02, +4.167510e+03, +7.911366e+03 },
+    { +5.500000e+02, +1.317915e-03, +3.033300e+03, -4.592686e+05, +1.209046e+06, +1.219590e+06, -4.487253e+05, +3.088878e+03, +5.186556e+03, +7.587742e+02, -1.844463e+00, +1.549311e-06, -1.594856e-02, +2.221317e-08, -2.697183e-14, +8.000000e+06, +1.190506e+06, +6.454484e+05, +8.300703e+02, +4.123106e+03, +7.252621e+03 },
+    { +5.600000e+02, +1.352333e-03, +3.128537e+03, -4.903514e+05, +1.261629e+06, +1.272448e+06, -4.795328e+05, +3.070670e+03, +5.394242e+03, +7.394631e+02, -2.025467e+00, +1.808211e-06, -2.059657e-02, +3.018949e-08, -3.879689e-14, +8.000000e+06, +1.120150e+06, +5.530328e+05, +9.085822e+02, +4.058211e+03, +6.562203e+03 },
+    { +5.681580e+02, +1.384666e-03, +3.208071e+03, -5.164558e+05, +1.306235e+06, +1.317313e+06, -5.053784e+05, +3.059391e+03, +5.614093e+03, +7.221957e+02, -2.215735e+00, +2.093412e-06, -2.646957e-02, +4.050765e-08, -5.478690e-14, +8.000000e+06, +1.058433e+06, +4.776891e+05, +1.001707e+03, +3.988843e+03, +5.971905e+03 },
+    { +5.681580e+02, +1.384666e-03, +3.208071e+03, -5.164558e+05, +1.306235e+06, +1.317313e+06, -5.053784e+05, +3.059391e+03, +5.614093e+03, +7.221957e+02, -2.215735e+00, +2.093412e-06, -2.646957e-02, +4.050765e-08, -5.478690e-14, +8.000000e+06, +1.058433e+06, +4.776891e+05, +1.001707e+03, +3.988843e+03, +5.971905e+03 },
+    { +5.700000e+02, +2.381145e-02, +5.763629e+03, -7.064703e+05, +2.578798e+06, +2.769290e+06, -5.159787e+05, +2.839692e+03, +5.638368e+03, +4.199660e+01, -2.689239e-01, +8.351269e-06, +8.324257e-03, -1.391538e-07, +1.858125e-12, +8.000000e+06, +3.220156e+04, +1.197423e+05, -1.543581e+02, +1.137296e+03, -3.190196e+03 },
+    { +5.800000e+02, +2.522277e-02, +5.853138e+03, -7.758588e+05, +2.618961e+06, +2.820743e+06, -5.740766e+05, +2.567280e+03, +4.744933e+03, +3.964672e+01, -2.070485e-01, +7.263885e-06, +4.644938e-03, -8.604031e-08, +1.165930e-12, +8.000000e+06, +2.850382e+04, +1.376674e+05, -9.461377e+01, +1.000812e+03, -3.042045e+03 },
+    { +5.900000e+02, +2.647104e-02, +5.929414e+03, -8.447663e+05, +2.653588e+06, +2.865356e+06, -6.329980e+05, +2.399919e+03, +4.215549e+03, +3.777713e+01, -1.695058e-01, +6.542384e-06, +3.044838e-03, -6.082466e-08, +8.237938e-13, +8.000000e+06, +2.590888e+04, +1.528495e+05, -6.817516e+01, +9.223953e+02, -2.941782e+03 },
+    { +6.000000e+02, +2.761074e-02, +5.997064e+03, -9.135223e+05, +2.684716e+06, +2.905602e+06, -6.926364e+05, +2.280572e+03, +3.853712e+03, +3.621780e+01, -1.438071e-01, +6.013127e-06, +2.171575e-03, -4.618538e-08, +6.207461e-13, +8.000000e+06, +2.391552e+04, +1.663028e+05, -5.280403e+01, +8.667564e+02, -2.855045e+03 },
+    { +6.100000e+02, +2.867110e-02, +6.058467e+03, -9.822874e+05, +2.713377e+06, +2.942746e+06, -7.529185e+05, +2.189391e+03, +3.587648e+03, +3.487832e+01, -1.249817e-01, +5.601762e-06, +1.632671e-03, -3.670898e-08, +4.875559e-13, +8.000000e+06, +2.231114e+04, +1.785153e+05, -4.236729e+01, +8.231761e+02, -2.773643e+03 },
+    { +6.200000e+02, +2.967043e-02, +6.115080e+03, -1.051153e+06, +2.740196e+06, +2.977560e+06, -8.137898e+05, +2.117333e+03, +3.383479e+03, +3.370359e+01, -1.105609e-01, +5.269370e-06, +1.273983e-03, -3.013955e-08, +3.944037e-13, +8.000000e+06, +2.098180e+04, +1.897760e+05, -3.470046e+01, +7.874395e+02, -2.695658e+03 },
+    { +6.300000e+02, +3.062118e-02, +6.167883e+03, -1.120177e+06, +2.765589e+06, +3.010559e+06, -8.752075e+05, +2.059312e+03, +3.222333e+03, +3.265714e+01, -9.914814e-02, +4.993053e-06, +1.022508e-03, -2.536081e-08, +3.262220e-13, +8.000000e+06, +1.985722e+04, +2.002783e+05, -2.883012e+01, +7.574211e+02, -2.620685e+03 },
+    { +6.400000e+02, +3.153232e-02, +6.217574e+03, -1.189396e+06, +2.789852e+06, +3.042110e+06, -9.371371e+05, +2.012044e+03, +3.092528e+03, +3.171349e+01, -8.988509e-02, +4.758267e-06, +8.392341e-04, -2.175602e-08, +2.745707e-13, +8.000000e+06, +1.889030e+04, +2.101605e+05, -2.422256e+01, +7.318237e+02, -2.548636e+03 },
+    { +6.500000e+02, +3.241055e-02, +6.264674e+03, -1.258835e+06, +2.813203e+06, +3.072488e+06, -9.995503e+05, +1.973230e+03, +2.986321e+03, +3.085415e+01, -8.221248e-02, +4.555259e-06, +7.015270e-04, -1.895751e-08, +2.343661e-13, +8.000000e+06, +1.804782e+04, +2.195265e+05, -2.054379e+01, +7.097560e+02, -2.479451e+03 },
+    { +6.750000e+02, +3.449330e-02, +6.373473e+03, -1.433497e+06, +2.868597e+06, +3.144543e+06, -1.157551e+06, +1.903098e+03, +2.792321e+03, +2.899114e+01, -6.775794e-02, +4.146512e-06, +4.768159e-04, -1.415350e-08, +1.652830e-13, +8.000000e+06, +1.634095e+04, +2.411665e+05, -1.408116e+01, +6.660992e+02, -2.318352e+03 },
+    { +7.000000e+02, +3.645528e-02, +6.472560e+03, -1.609786e+06, +2.921006e+06, +3.212649e+06, -1.318143e+06, +1.859099e+03, +2.664518e+03, +2.743087e+01, -5.760522e-02, +3.832841e-06, +3.460886e-04, -1.115225e-08, +1.223257e-13, +8.000000e+06, +1.502938e+04, +2.609031e+05, -1.004397e+01, +6.339926e+02, -2.172478e+03 },
+    { +7.250000e+02, +3.832982e-02, +6.564445e+03, -1.787758e+06, +2.971465e+06, +3.278104e+06, -1.481119e+06, +1.831810e+03, +2.577230e+03, +2.608935e+01, -5.005990e-02, +3.580886e-06, +2.633335e-04, -9.125520e-09, +9.364953e-14, +8.000000e+06, +1.397975e+04, +2.792605e+05, -7.397821e+00, +6.095670e+02, -2.039549e+03 },
+    { +7.500000e+02, +4.013841e-02, +6.650730e+03, -1.967427e+06, +3.020621e+06, +3.341729e+06, -1.646319e+06, +1.815713e+03, +2.516336e+03, +2.491379e+01, -4.421626e-02, +3.371794e-06, +2.075673e-04, -7.676937e-09, +7.350535e-14, +8.000000e+06, +1.311357e+04, +2.965780e+05, -5.594530e+00, +5.904672e+02, -1.917502e+03 },
+    { +7.750000e+02, +4.189569e-02, +6.732501e+03, -2.148784e+06, +3.068905e+06, +3.404070e+06, -1.813618e+06, +1.807399e+03, +2.473477e+03, +2.386880e+01, -3.954667e-02, +3.194000e-06, +1.681344e-04, -6.595911e-09, +5.880182e-14, +8.000000e+06, +1.238155e+04, +3.130871e+05, -4.324893e+00, +5.751876e+02, -1.804622e+03 },
+    { +8.000000e+02, +4.361206e-02, +6.810527e+03, -2.331810e+06, +3.116612e+06, +3.465509e+06, -1.982913e+06, +1.804673e+03, +2.443422e+03, +2.292944e+01, -3.572296e-02, +3.039957e-06, +1.391673e-04, -5.761424e-09, +4.774515e-14, +8.000000e+06, +1.175114e+04, +3.289521e+05, -3.405900e+00, +5.627286e+02, -1.699523e+03 },
+    { +8.250000e+02, +4.529515e-02, +6.885378e+03, -2.516479e+06, +3.163958e+06, +3.526319e+06, -2.154118e+06, +1.806069e+03, +2.422747e+03, +2.207742e+01, -3.253014e-02, +2.904497e-06, +1.172216e-04, -5.099525e-09, +3.923103e-14, +8.000000e+06, +1.119992e+04, +3.442937e+05, -2.724785e+00, +5.524043e+02, -1.601094e+03 },
+    { +8.500000e+02, +4.695076e-02, +6.957487e+03, -2.702765e+06, +3.211099e+06, +3.586705e+06, -2.327159e+06, +1.810574e+03, +2.409120e+03, +2.129891e+01, -2.982131e-02, +2.783942e-06, +1.001679e-04, -4.562734e-09, +3.254680e-14, +8.000000e+06, +1.071190e+04, +3.592029e+05, -2.209606e+00, +5.437309e+02, -1.508439e+03 },
+    { +9.000000e+02, +5.019639e-02, +7.094762e+03, -3.080072e+06, +3.305214e+06, +3.706785e+06, -2.678501e+06, +1.826225e+03, +2.396919e+03, +1.992175e+01, -2.546815e-02, +2.577384e-06, +7.569344e-05, -3.747231e-09, +2.290286e-14, +8.000000e+06, +9.881394e+03, +3.879903e+05, -1.503068e+00, +5.300266e+02, -1.337680e+03 },
+    { +9.500000e+02, +5.337469e-02, +7.224346e+03, -3.463505e+06, +3.399624e+06, +3.826621e+06, -3.036508e+06, +1.847835e+03, +2.398330e+03, +1.873547e+01, -2.211970e-02, +2.405472e-06, +5.925389e-05, -3.158823e-09, +1.646368e-14, +8.000000e+06, +9.195578e+03, +4.157189e+05, -1.060763e+00, +5.197505e+02, -1.182840e+03 },
+    { +1.000000e+03, +5.650256e-02, +7.347594e+03, -3.852851e+06, +3.494743e+06, +3.946764e+06, -3.400830e+06, +1.873200e+03, +2.408532e+03, +1.769831e+01, -1.946308e-02, +2.259103e-06, +4.764048e-05, -2.715436e-09, +1.200023e-14, +8.000000e+06, +8.615401e+03, +4.426535e+05, -7.711264e-01, +5.118106e+02, -1.040834e+03 },
+    { +1.050000e+03, +5.959158e-02, +7.465475e+03, -4.247910e+06, +3.590839e+06, +4.067571e+06, -3.771178e+06, +1.900925e+03, +2.424566e+03, +1.678090e+01, -1.730461e-02, +2.132304e-06, +3.911234e-05, -2.370042e-09, +8.816748e-15, +8.000000e+06, +8.115451e+03, +4.689762e+05, -5.745409e-01, +5.055269e+02, -9.094122e+02 },
+    { +1.100000e+03, +6.265003e-02, +7.578714e+03, -4.648501e+06, +3.688085e+06, +4.189285e+06, -4.147300e+06, +1.930077e+03, +2.444505e+03, +1.596168e+01, -1.551754e-02, +2.020951e-06, +3.265504e-05, -2.093849e-09, +6.494945e-15, +8.000000e+06, +7.678334e+03, +4.948165e+05, -4.371326e-01, +5.004546e+02, -7.868793e+02 },
+    { +1.150000e+03, +6.568399e-02, +7.687866e+03, -5.054453e+06, +3.786593e+06, +4.312065e+06, -4.528981e+06, +1.959996e+03, +2.467034e+03, +1.522441e+01, -1.401514e-02, +1.922079e-06, +2.764307e-05, -1.868284e-09, +4.771260e-15, +8.000000e+06, +7.291656e+03, +5.202700e+05, -3.386830e-01, +4.962917e+02, -6.719228e+02 },
+    { +1.200000e+03, +6.869802e-02, +7.793368e+03, -5.465610e+06, +3.886432e+06, +4.436016e+06, -4.916026e+06, +1.990207e+03, +2.491226e+03, +1.455646e+01, -1.273594e-02, +1.833489e-06, +2.367262e-05, -1.680850e-09, +3.473216e-15, +8.000000e+06, +6.946288e+03, +5.454082e+05, -2.666307e-01, +4.928259e+02, -5.635038e+02 },
+    { +1.250000e+03, +7.169564e-02, +7.895573e+03, -5.881828e+06, +3.987639e+06, +4.561204e+06, -5.308263e+06, +2.020357e+03, +2.516409e+03, +1.394785e+01, -1.163508e-02, +1.753505e-06, +2.047294e-05, -1.522834e-09, +2.484390e-15, +8.000000e+06, +6.635325e+03, +5.702864e+05, -2.129077e-01, +4.899046e+02, -4.607854e+02 },
+    { +1.273000e+03, +7.306980e-02, +7.941561e+03, -6.074950e+06, +4.034658e+06, +4.619216e+06, -5.490391e+06, +2.034130e+03, +2.528185e+03, +1.368554e+01, -1.117899e-02, +1.719232e-06, +1.920606e-05, -1.458234e-09, +2.110179e-15, +8.000000e+06, +6.502316e+03, +5.816552e+05, -1.928104e-01, +4.887115e+02, -4.152561e+02 },
+    // P = 10 MPa
+    { +2.724100e+02, +9.952290e-04, -1.098413e+01, +2.068424e+01, -2.971504e+03, +6.980786e+03, +9.972974e+03, +4.173178e+03, +4.174198e+03, +1.004794e+03, +4.345884e-02, +4.998654e-07, -1.699797e-02, -3.720737e-09, -1.170922e-15, +1.000000e+07, -8.694108e+04, +2.000538e+06, +3.272851e+04, +1.448354e+04, +9.374947e+03 },
+    { +2.750000e+02, +9.951724e-04, +2.849112e+01, -1.511966e+00, +7.833545e+03, +1.778527e+04, +9.950212e+03, +4.169211e+03, +4.169212e+03, +1.004851e+03, +1.280602e-03, +4.907493e-07, -1.560861e-02, -3.327311e-09, -1.118443e-15, +1.000000e+07, -2.609483e+03, +2.037700e+06, +3.177030e+04, +1.380362e+04, +9.463129e+03 },
+    { +2.800000e+02, +9.953497e-04, +1.035466e+02, -3.339962e+02, +2.865906e+04, +3.861256e+04, +9.619501e+03, +4.159263e+03, +4.162212e+03, +1.004672e+03, -7.112141e-02, +4.757601e-07, -1.345288e-02, -2.692447e-09, -1.041838e-15, +1.000000e+07, +1.494901e+05, +2.101900e+06, +3.001754e+04, +1.258326e+04, +9.674675e+03 },
+    { +2.850000e+02, +9.958617e-04, +1.771738e+02, -1.041492e+03, +4.945304e+04, +5.941165e+04, +8.917125e+03, +4.146822e+03, +4.157783e+03, +1.004156e+03, -1.340860e-01, +4.636215e-07, -1.180272e-02, -2.180192e-09, -9.890407e-16, +1.000000e+07, +2.892143e+05, +2.156932e+06, +2.835617e+04, +1.147381e+04, +9.924841e+03 },
+    { +2.900000e+02, +9.966679e-04, +2.494601e+02, -2.116681e+03, +7.022676e+04, +8.019344e+04, +7.849997e+03, +4.132337e+03, +4.155189e+03, +1.003343e+03, -1.897391e-01, +4.538104e-07, -1.050856e-02, -1.756963e-09, -9.531095e-16, +1.000000e+07, +4.181022e+05, +2.203563e+06, +2.676086e+04, +1.046625e+04, +1.019811e+04 },
+    { +2.950000e+02, +9.977374e-04, +3.204784e+02, -3.552737e+03, +9.098838e+04, +1.009658e+05, +6.424636e+03, +4.116118e+03, +4.153924e+03, +1.002268e+03, -2.396011e-01, +4.459410e-07, -9.473140e-03, -1.400456e-09, -9.296120e-16, +1.000000e+07, +5.372933e+05, +2.242449e+06, +2.521951e+04, +9.553947e+03, +1.048261e+04 },
+    { +3.000000e+02, +9.990459e-04, +3.902902e+02, -5.343235e+03, +1.117438e+05, +1.217343e+05, +4.647224e+03, +4.098396e+03, +4.153625e+03, +1.000955e+03, -2.847912e-01, +4.397206e-07, -8.630789e-03, -1.095214e-09, -9.156471e-16, +1.000000e+07, +6.476640e+05, +2.274171e+06, +2.372765e+04, +8.731359e+03, +1.076955e+04 },
+    { +3.050000e+02, +1.000574e-03, +4.589493e+02, -7.482086e+03, +1.324974e+05, +1.425032e+05, +2.523655e+03, +4.079350e+03, +4.154035e+03, +9.994262e+02, -3.261539e-01, +4.349221e-07, -7.935794e-03, -8.301183e-10, -9.092749e-16, +1.000000e+07, +7.499133e+05, +2.299262e+06, +2.228486e+04, +7.993326e+03, +1.105250e+04 },
+    { +3.100000e+02, +1.002307e-03, +5.265030e+02, -9.963492e+03, +1.532524e+05, +1.632755e+05, +5.957330e+01, +4.059135e+03, +4.154971e+03, +9.976988e+02, -3.643398e-01, +4.313664e-07, -7.355484e-03, -5.969164e-10, -9.091750e-16, +1.000000e+07, +8.446180e+05, +2.318215e+06, +2.089269e+04, +7.334718e+03, +1.132684e+04 },
+    { +3.150000e+02, +1.004231e-03, +5.929942e+02, -1.278191e+04, +1.740113e+05, +1.840536e+05, -2.739604e+03, +4.037888e+03, +4.156308e+03, +9.957873e+02, -3.998598e-01, +4.289104e-07, -6.865986e-03, -3.893143e-10, -9.144385e-16, +1.000000e+07, +9.322688e+05, +2.331489e+06, +1.955336e+04, +6.750321e+03, +1.158924e+04 },
+    { +3.200000e+02, +1.006336e-03, +6.584618e+02, -1.593202e+04, +1.947758e+05, +2.048391e+05, -5.868663e+03, +4.015739e+03, +4.157966e+03, +9.937039e+02, -4.331212e-01, +4.274388e-07, -6.449529e-03, -2.024032e-10, -9.244377e-16, +1.000000e+07, +1.013294e+06, +2.339516e+06, +1.826904e+04, +6.234843e+03, +1.183739e+04 },
+    { +3.250000e+02, +1.008614e-03, +7.229423e+02, -1.940872e+04, +2.155475e+05, +2.256337e+05, -9.322577e+03, +3.992811e+03, +4.159896e+03, +9.914593e+02, -4.644542e-01, +4.268584e-07, -6.092676e-03, -3.227962e-11, -9.387434e-16, +1.000000e+07, +1.088076e+06, +2.342697e+06, +1.704150e+04, +5.782967e+03, +1.206967e+04 },
+    { +3.300000e+02, +1.011059e-03, +7.864697e+02, -2.320709e+04, +2.363279e+05, +2.464385e+05, -1.309650e+04, +3.969224e+03, +4.162077e+03, +9.890622e+02, -4.941300e-01, +4.270933e-07, -5.785124e-03, +1.242136e-10, -9.570710e-16, +1.000000e+07, +1.156960e+06, +2.341409e+06, +1.587193e+04, +5.389433e+03, +1.228502e+04 },
+    { +3.350000e+02, +1.013664e-03, +8.490764e+02, -2.732238e+04, +2.571182e+05, +2.672549e+05, -1.718574e+04, +3.945090e+03, +4.164507e+03, +9.865203e+02, -5.223742e-01, +4.280822e-07, -5.518881e-03, +2.696694e-10, -9.792451e-16, +1.000000e+07, +1.220266e+06, +2.336000e+06, +1.476093e+04, +5.049105e+03, +1.248274e+04 },
+    { +3.400000e+02, +1.016425e-03, +9.107935e+02, -3.175003e+04, +2.779197e+05, +2.880840e+05, -2.158578e+04, +3.920518e+03, +4.167195e+03, +9.838405e+02, -5.493771e-01, +4.297753e-07, -5.287686e-03, +4.062481e-10, -1.005176e-15, +1.000000e+07, +1.278289e+06, +2.326798e+06, +1.370847e+04, +4.757039e+03, +1.266245e+04 },
+    { +3.450000e+02, +1.019339e-03, +9.716508e+02, -3.648563e+04, +2.987339e+05, +3.089273e+05, -2.629224e+04, +3.895608e+03, +4.170162e+03, +9.810284e+02, -5.753012e-01, +4.321329e-07, -5.086590e-03, +5.357747e-10, -1.034842e-15, +1.000000e+07, +1.331306e+06, +2.314103e+06, +1.271405e+04, +4.508528e+03, +1.282396e+04 },
+    { +3.500000e+02, +1.022402e-03, +1.031677e+03, -4.152492e+04, +3.195621e+05, +3.297861e+05, -3.130090e+04, +3.870454e+03, +4.173435e+03, +9.780890e+02, -6.002866e-01, +4.351239e-07, -4.911649e-03, +6.598121e-10, -1.068284e-15, +1.000000e+07, +1.379576e+06, +2.298196e+06, +1.177669e+04, +4.299137e+03, +1.296726e+04 },
+    { +3.550000e+02, +1.025613e-03, +1.090901e+03, -4.686380e+04, +3.404061e+05, +3.506622e+05, -3.660768e+04, +3.845144e+03, +4.177044e+03, +9.750269e+02, -6.244560e-01, +4.387241e-07, -4.759704e-03, +7.797184e-10, -1.105592e-15, +1.000000e+07, +1.423345e+06, +2.279337e+06, +1.089504e+04, +4.124718e+03, +1.309243e+04 },
+    { +3.600000e+02, +1.028970e-03, +1.149349e+03, -5.249832e+04, +3.612675e+05, +3.715572e+05, -4.220862e+04, +3.819756e+03, +4.181021e+03, +9.718457e+02, -6.479177e-01, +4.429162e-07, -4.628211e-03, +8.966906e-10, -1.146906e-15, +1.000000e+07, +1.462845e+06, +2.257764e+06, +1.006749e+04, +3.981426e+03, +1.319968e+04 },
+    { +3.650000e+02, +1.032473e-03, +1.207049e+03, -5.842465e+04, +3.821483e+05, +3.924731e+05, -4.809992e+04, +3.794363e+03, +4.185402e+03, +9.685487e+02, -6.707687e-01, +4.476880e-07, -4.515114e-03, +1.011801e-09, -1.192412e-15, +1.000000e+07, +1.498295e+06, +2.233699e+06, +9.292170e+03, +3.865715e+03, +1.328924e+04 },
+    { +3.700000e+02, +1.036120e-03, +1.264027e+03, -6.463911e+04, +4.030507e+05, +4.134119e+05, -5.427791e+04, +3.769028e+03, +4.190220e+03, +9.651388e+02, -6.930967e-01, +4.530327e-07, -4.418749e-03, +1.126024e-09, -1.242341e-15, +1.000000e+07, +1.529904e+06, +2.207346e+06, +8.567071e+03, +3.774333e+03, +1.336141e+04 },
+    { +3.750000e+02, +1.039913e-03, +1.320307e+03, -7.113816e+04, +4.239769e+05, +4.343760e+05, -6.073903e+04, +3.743807e+03, +4.195509e+03, +9.616185e+02, -7.149818e-01, +4.589482e-07, -4.337773e-03, +1.240265e-09, -1.296974e-15, +1.000000e+07, +1.557870e+06, +2.178895e+06, +7.890067e+03, +3.704311e+03, +1.341653e+04 },
+    { +3.800000e+02, +1.043853e-03, +1.375915e+03, -7.791838e+04, +4.449293e+05, +4.553679e+05, -6.747986e+04, +3.718752e+03, +4.201305e+03, +9.579896e+02, -7.364983e-01, +4.654368e-07, -4.271103e-03, +1.355374e-09, -1.356638e-15, +1.000000e+07, +1.582381e+06, +2.148519e+06, +7.258971e+03, +3.652949e+03, +1.345494e+04 },
+    { +3.850000e+02, +1.047939e-03, +1.430876e+03, -8.497649e+04, +4.659106e+05, +4.763900e+05, -7.449710e+04, +3.693906e+03, +4.207640e+03, +9.542540e+02, -7.577153e-01, +4.725048e-07, -4.217875e-03, +1.472168e-09, -1.421714e-15, +1.000000e+07, +1.603614e+06, +2.116381e+06, +6.671564e+03, +3.617801e+03, +1.347701e+04 },
+    { +3.900000e+02, +1.052174e-03, +1.485212e+03, -9.230932e+04, +4.869235e+05, +4.974452e+05, -8.178757e+04, +3.669305e+03, +4.214548e+03, +9.504129e+02, -7.786983e-01, +4.801626e-07, -4.177410e-03, +1.591445e-09, -1.492642e-15, +1.000000e+07, +1.621739e+06, +2.082628e+06, +6.125630e+03, +3.596654e+03, +1.348313e+04 },
+    { +3.950000e+02, +1.056561e-03, +1.538949e+03, -9.991383e+04, +5.079709e+05, +5.185365e+05, -8.934822e+04, +3.644983e+03, +4.222063e+03, +9.464673e+02, -7.995098e-01, +4.884247e-07, -4.149191e-03, +1.713999e-09, -1.569924e-15, +1.000000e+07, +1.636915e+06, +2.047399e+06, +5.618975e+03, +3.587515e+03, +1.347366e+04 },
+    { +4.000000e+02, +1.061100e-03, +1.592108e+03, -1.077871e+05, +5.290559e+05, +5.396669e+05, -9.717610e+04, +3.620966e+03, +4.230217e+03, +9.424180e+02, -8.202100e-01, +4.973094e-07, -4.132838e-03, +1.840633e-09, -1.654132e-15, +1.000000e+07, +1.649295e+06, +2.010821e+06, +5.149451e+03, +3.588592e+03, +1.344901e+04 },
+    { +4.100000e+02, +1.070653e-03, +1.696783e+03, -1.243289e+05, +5.713520e+05, +5.820585e+05, -1.136223e+05, +3.573935e+03, +4.248583e+03, +9.340094e+02, -8.615101e-01, +5.170407e-07, -4.134836e-03, +2.109479e-09, -1.846028e-15, +1.000000e+07, +1.666232e+06, +1.934084e+06, +4.313500e+03, +3.615116e+03, +1.335562e+04 },
+    { +4.200000e+02, +1.080863e-03, +1.799413e+03, -1.419136e+05, +6.138399e+05, +6.246485e+05, -1.311049e+05, +3.528348e+03, +4.269932e+03, +9.251869e+02, -9.030595e-01, +5.395881e-07, -4.182736e-03, +2.405098e-09, -2.074713e-15, +1.000000e+07, +1.673609e+06, +1.853265e+06, +3.601913e+03, +3.665259e+03, +1.320599e+04 },
+    { +4.300000e+02, +1.091768e-03, +1.900169e+03, -1.605220e+05, +6.565505e+05, +6.674682e+05, -1.496043e+05, +3.484294e+03, +4.294583e+03, +9.159458e+02, -9.453211e-01, +5.652590e-07, -4.277586e-03, +2.735644e-09, -2.348481e-15, +1.000000e+07, +1.672368e+06, +1.769101e+06, +3.000122e+03, +3.730251e+03, +1.300303e+04 },
+    { +4.400000e+02, +1.103416e-03, +1.999216e+03, -1.801368e+05, +6.995182e+05, +7.105524e+05, -1.691026e+05, +3.441823e+03, +4.322897e+03, +9.062765e+02, -9.887768e-01, +5.944496e-07, -4.422178e-03, +3.110861e-09, -2.678193e-15, +1.000000e+07, +1.663348e+06, +1.682228e+06, +2.494942e+03, +3.803111e+03, +1.274960e+04 },
+    { +4.500000e+02, +1.115866e-03, +2.096718e+03, -2.007422e+05, +7.427811e+05, +7.539398e+05, -1.895835e+05, +3.400961e+03, +4.355305e+03, +8.961646e+02, -1.033946e+00, +6.276649e-07, -4.621256e-03, +3.542804e-09, -3.078214e-15, +1.000000e+07, +1.647290e+06, +1.593207e+06, +2.074573e+03, +3.878298e+03, +1.244845e+04 },
+    { +4.600000e+02, +1.129191e-03, +2.192840e+03, -2.223243e+05, +7.863819e+05, +7.976738e+05, -2.110324e+05, +3.361719e+03, +4.392326e+03, +8.855900e+02, -1.081407e+00, +6.655454e-07, -4.881937e-03, +4.046816e-09, -3.567792e-15, +1.000000e+07, +1.624843e+06, +1.502527e+06, +1.728561e+03, +3.951423e+03, +1.210226e+04 },
+    { +4.700000e+02, +1.143476e-03, +2.287745e+03, -2.448710e+05, +8.303690e+05, +8.418038e+05, -2.334362e+05, +3.324100e+03, +4.434603e+03, +8.745266e+02, -1.131824e+00, +7.089075e-07, -5.214410e-03, +4.642939e-09, -4.173116e-15, +1.000000e+07, +1.596574e+06, +1.410621e+06, +1.447716e+03, +4.019008e+03, +1.171364e+04 },
+    { +4.800000e+02, +1.158828e-03, +2.381604e+03, -2.683721e+05, +8.747978e+05, +8.863861e+05, -2.567838e+05, +3.288106e+03, +4.482941e+03, +8.629411e+02, -1.185982e+00, +7.587996e-07, -5.633043e-03, +5.358000e-09, -4.930474e-15, +1.000000e+07, +1.562971e+06, +1.317871e+06, +1.224029e+03, +4.078294e+03, +1.128515e+04 },
+    { +4.900000e+02, +1.175376e-03, +2.474595e+03, -2.928192e+05, +9.197325e+05, +9.314862e+05, -2.810654e+05, +3.253751e+03, +4.538370e+03, +8.507913e+02, -1.244838e+00, +8.165851e-07, -6.158137e-03, +6.228825e-09, -5.891203e-15, +1.000000e+07, +1.524444e+06, +1.224612e+06, +1.050581e+03, +4.127083e+03, +1.081931e+04 },
+    { +5.000000e+02, +1.193282e-03, +2.566910e+03, -3.182063e+05, +9.652487e+05, +9.771815e+05, -3.062734e+05, +3.221062e+03, +4.602227e+03, +8.380247e+02, -1.309595e+00, +8.840658e-07, -6.818727e-03, +7.307327e-09, -7.129721e-15, +1.000000e+07, +1.481332e+06, +1.131138e+06, +9.214620e+02, +4.163599e+03, +1.031855e+04 },
+    { +5.100000e+02, +1.212746e-03, +2.658758e+03, -3.445295e+05, +1.011437e+06, +1.023565e+06, -3.324021e+05, +3.190096e+03, +4.676285e+03, +8.245746e+02, -1.381804e+00, +9.636711e-07, -7.657189e-03, +8.668897e-09, -8.757001e-15, +1.000000e+07, +1.433895e+06, +1.037698e+06, +8.317074e+02, +4.186374e+03, +9.785181e+03 },
+    { +5.200000e+02, +1.234024e-03, +2.750379e+03, -3.717881e+05, +1.058409e+06, +1.070749e+06, -3.594478e+05, +3.160950e+03, +4.762951e+03, +8.103569e+02, -1.463539e+00, +1.058758e-06, -8.737084e-03, +1.042679e-08, -1.094415e-14, +1.000000e+07, +1.382317e+06, +9.445029e+05, +7.772597e+02, +4.194145e+03, +9.221297e+03 },
+    { +5.300000e+02, +1.257446e-03, +2.842050e+03, -3.999843e+05, +1.106302e+06, +1.118877e+06, -3.874098e+05, +3.133779e+03, +4.865587e+03, +7.952627e+02, -1.557672e+00, +1.174106e-06, -1.015711e-02, +1.275799e-08, -1.396570e-14, +1.000000e+07, +1.326688e+06, +8.517119e+05, +7.549761e+02, +4.185740e+03, +8.628612e+03 },
+    { +5.400000e+02, +1.283452e-03, +2.934111e+03, -4.291246e+05, +1.155296e+06, +1.168130e+06, -4.162901e+05, +3.108836e+03, +4.989060e+03, +7.791486e+02, -1.668337e+00, +1.316773e-06, -1.207726e-02, +1.595250e-08, -1.828386e-14, +1.000000e+07, +1.266989e+06, +7.594323e+05, +7.627184e+02, +4.159969e+03, +8.008200e+03 },
+    { +5.500000e+02, +1.312645e-03, +3.026993e+03, -4.592212e+05, +1.205625e+06, +1.218751e+06, -4.460948e+05, +3.086517e+03, +5.140717e+03, +7.618204e+02, -1.801774e+00, +1.497668e-06, -1.477147e-02, +2.051396e-08, -2.472460e-14, +1.000000e+07, +1.203054e+06, +6.677049e+05, +7.996046e+02, +4.115484e+03, +7.360089e+03 },
+    { +5.600000e+02, +1.345887e-03, +3.121270e+03, -4.902935e+05, +1.257618e+06, +1.271077e+06, -4.768346e+05, +3.067466e+03, +5.332274e+03, +7.430047e+02, -1.967971e+00, +1.734647e-06, -1.874271e-02, +2.738388e-08, -3.488051e-14, +1.000000e+07, +1.134508e+06, +5.764861e+05, +8.666084e+02, +4.050629e+03, +6.682659e+03 },
+    { +5.700000e+02, +1.384474e-03, +3.217759e+03, -5.223722e+05, +1.311750e+06, +1.325595e+06, -5.085275e+05, +3.052782e+03, +5.583801e+03, +7.222960e+02, -2.184142e+00, +2.059257e-06, -2.500622e-02, +3.850364e-08, -5.214772e-14, +1.000000e+07, +1.060645e+06, +4.856120e+05, +9.679913e+02, +3.963313e+03, +5.971775e+03 },
+    { +5.800000e+02, +1.430514e-03, +3.317717e+03, -5.555064e+05, +1.368770e+06, +1.383075e+06, -5.412013e+05, +3.044486e+03, +5.933285e+03, +6.990495e+02, -2.483173e+00, +2.533430e-06, -3.590876e-02, +5.847100e-08, -8.487206e-14, +1.000000e+07, +9.801627e+05, +3.947218e+05, +1.115001e+03, +3.851107e+03, +5.219612e+03 },
+    { +5.841470e+02, +1.452593e-03, +3.360646e+03, -5.695744e+05, +1.393537e+06, +1.408063e+06, -5.550485e+05, +3.043783e+03, +6.123693e+03, +6.884241e+02, -2.646127e+00, +2.802164e-06, -4.304250e-02, +7.184745e-08, -1.076553e-13, +1.000000e+07, +9.443157e+05, +3.568671e+05, +1.195092e+03, +3.796826e+03, +4.892771e+03 },
+    { +5.841470e+02, +1.452593e-03, +3.360646e+03, -5.695744e+05, +1.393537e+06, +1.408063e+06, -5.550485e+05, +3.043783e+03, +6.123693e+03, +6.884241e+02, -2.646127e+00, +2.802164e-06, -4.304250e-02, +7.184745e-08, -1.076553e-13, +1.000000e+07, +9.443157e+05, +3.568671e+05, +1.195092e+03, +3.796826e+03, +4.892771e+03 },
+    { +5.900000e+02, +1.886133e-02, +5.681717e+03, -7.767293e+05, +2.575484e+06, +2.764097e+06, -5.881160e+05, +2.872808e+03, +6.134265e+03, +5.301853e+01, -3.751497e-01, +9.057203e-06, +1.242415e-02, -1.722381e-07, +1.948427e-12, +1.000000e+07, +4.142003e+04, +1.104094e+05, -1.654691e+02, +1.115823e+03, -2.622417e+03 },
+    { +6.000000e+02, +2.009138e-02, +5.775637e+03, -8.463317e+05, +2.619050e+06, +2.819964e+06, -6.454179e+05, +2.623925e+03, +5.136468e+03, +4.977258e+01, -2.831172e-01, +7.726629e-06, +6.860242e-03, -1.038141e-07, +1.189429e-12, +1.000000e+07, +3.664176e+04, +1.294226e+05, -1.099222e+02, +1.008887e+03, -2.578508e+03 },
+    { +6.100000e+02, +2.117006e-02, +5.855206e+03, -9.152820e+05, +2.656394e+06, +2.868094e+06, -7.035815e+05, +2.459905e+03, +4.531873e+03, +4.723653e+01, -2.281198e-01, +6.866206e-06, +4.417574e-03, -7.163592e-08, +8.218620e-13, +1.000000e+07, +3.322356e+04, +1.456408e+05, -8.225045e+01, +9.403104e+02, -2.538916e+03 },
+    { +6.200000e+02, +2.214782e-02, +5.925345e+03, -9.839690e+05, +2.689745e+06, +2.911223e+06, -7.624908e+05, +2.339095e+03, +4.117140e+03, +4.515116e+01, -1.911389e-01, +6.248980e-06, +3.097616e-03, -5.332176e-08, +6.088923e-13, +1.000000e+07, +3.058721e+04, +1.600261e+05, -6.486724e+01, +8.885447e+02, -2.495244e+03 },
+    { +6.300000e+02, +2.305223e-02, +5.988678e+03, -1.052588e+06, +2.720279e+06, +2.950801e+06, -8.220658e+05, +2.245407e+03, +3.812877e+03, +4.337975e+01, -1.644748e-01, +5.777846e-06, +2.295601e-03, -4.170332e-08, +4.721135e-13, +1.000000e+07, +2.846646e+04, +1.730749e+05, -5.259420e+01, +8.466433e+02, -2.447646e+03 },
+    { +6.400000e+02, +2.390049e-02, +6.046820e+03, -1.121252e+06, +2.748713e+06, +2.987718e+06, -8.822471e+05, +2.170747e+03, +3.580115e+03, +4.184015e+01, -1.443183e-01, +5.402716e-06, +1.769907e-03, -3.378964e-08, +3.780922e-13, +1.000000e+07, +2.671218e+04, +1.850921e+05, -4.340435e+01, +8.115964e+02, -2.397514e+03 },
+    { +6.500000e+02, +2.470425e-02, +6.100856e+03, -1.190031e+06, +2.775525e+06, +3.022568e+06, -9.429886e+05, +2.110261e+03, +3.396828e+03, +4.047887e+01, -1.285420e-01, +5.094649e-06, +1.406270e-03, -2.811778e-08, +3.102316e-13, +1.000000e+07, +2.523078e+04, +1.962844e+05, -3.629179e+01, +7.817394e+02, -2.346083e+03 },
+    { +6.750000e+02, +2.656849e-02, +6.222550e+03, -1.362751e+06, +2.837470e+06, +3.103155e+06, -1.097066e+06, +2.002022e+03, +3.076504e+03, +3.763857e+01, -1.008904e-01, +4.513763e-06, +8.700648e-04, -1.929616e-08, +2.038817e-13, +1.000000e+07, +2.235174e+04, +2.215447e+05, -2.421893e+01, +7.234227e+02, -2.216981e+03 },
+    { +7.000000e+02, +2.828465e-02, +6.330518e+03, -1.536849e+06, +2.894513e+06, +3.177360e+06, -1.254003e+06, +1.933786e+03, +2.874149e+03, +3.535487e+01, -8.295725e-02, +4.098385e-06, +5.915716e-04, -1.435531e-08, +1.440205e-13, +1.000000e+07, +2.024145e+04, +2.439986e+05, -1.694195e+01, +6.810913e+02, -2.092117e+03 },
+    { +7.250000e+02, +2.989828e-02, +6.428866e+03, -1.712495e+06, +2.948433e+06, +3.247416e+06, -1.413512e+06, +1.890147e+03, +2.738899e+03, +3.344674e+01, -7.036714e-02, +3.780852e-06, +4.288613e-04, -1.126566e-08, +1.066806e-13, +1.000000e+07, +1.861145e+04, +2.644907e+05, -1.229177e+01, +6.491978e+02, -1.973860e+03 },
+    { +7.500000e+02, +3.143696e-02, +6.520046e+03, -1.889756e+06, +3.000278e+06, +3.314648e+06, -1.575386e+06, +1.862521e+03, +2.645202e+03, +3.180969e+01, -6.102581e-02, +3.526835e-06, +3.256568e-04, -9.181135e-09, +8.170859e-14, +1.000000e+07, +1.730328e+04, +2.835404e+05, -9.184777e+00, +6.244538e+02, -1.862569e+03 },
+    { +7.750000e+02, +3.291868e-02, +6.605639e+03, -2.068655e+06, +3.050715e+06, +3.379902e+06, -1.739468e+06, +1.845783e+03, +2.578846e+03, +3.037789e+01, -5.380729e-02, +3.316864e-06, +2.560806e-04, -7.694231e-09, +6.414627e-14, +1.000000e+07, +1.622234e+04, +3.014896e+05, -7.032171e+00, +6.047881e+02, -1.757877e+03 },
+    { +8.000000e+02, +3.435578e-02, +6.686722e+03, -2.249189e+06, +3.100189e+06, +3.443747e+06, -1.905631e+06, +1.836718e+03, +2.531337e+03, +2.910718e+01, -4.805324e-02, +3.138979e-06, +2.069133e-04, -6.587544e-09, +5.131724e-14, +1.000000e+07, +1.530856e+04, +3.185749e+05, -5.494765e+00, +5.888400e+02, -1.659198e+03 },
+    { +8.250000e+02, +3.575710e-02, +6.764065e+03, -2.431344e+06, +3.149010e+06, +3.506581e+06, -2.073773e+06, +1.833223e+03, +2.497308e+03, +2.796648e+01, -4.335327e-02, +2.985375e-06, +1.708433e-04, -5.735810e-09, +4.166442e-14, +1.000000e+07, +1.452189e+04, +3.349663e+05, -4.368017e+00, +5.756842e+02, -1.565917e+03 },
+    { +8.500000e+02, +3.712917e-02, +6.838238e+03, -2.615099e+06, +3.197403e+06, +3.568695e+06, -2.243808e+06, +1.833874e+03, +2.473214e+03, +2.693300e+01, -3.943824e-02, +2.850710e-06, +1.435653e-04, -5.062367e-09, +3.422764e-14, +1.000000e+07, +1.383453e+04, +3.507898e+05, -3.523776e+00, +5.646733e+02, -1.477467e+03 },
+    { +9.000000e+02, +3.980436e-02, +6.978717e+03, -2.987315e+06, +3.293530e+06, +3.691574e+06, -2.589271e+06, +1.843911e+03, +2.445825e+03, +2.512288e+01, -3.328115e-02, +2.624014e-06, +1.056578e-04, -4.069650e-09, +2.372461e-14, +1.000000e+07, +1.268330e+04, +3.810956e+05, -2.378480e+00, +5.473490e+02, -1.313109e+03 },
+    { +9.500000e+02, +4.240952e-02, +7.110652e+03, -3.365633e+06, +3.389487e+06, +3.813582e+06, -2.941537e+06, +1.861700e+03, +2.436906e+03, +2.357961e+01, -2.865333e-02, +2.438807e-06, +8.108990e-05, -3.376742e-09, +1.686751e-14, +1.000000e+07, +1.174891e+04, +4.100366e+05, -1.669732e+00, +5.344124e+02, -1.162837e+03 },
+    { +1.000000e+03, +4.496271e-02, +7.235681e+03, -3.749849e+06, +3.485832e+06, +3.935459e+06, -3.300222e+06, +1.884345e+03, +2.439735e+03, +2.224065e+01, -2.504541e-02, +2.283299e-06, +6.421026e-05, -2.867896e-09, +1.219174e-14, +1.000000e+07, +1.096896e+04, +4.379628e+05, -1.209424e+00, +5.244442e+02, -1.024182e+03 },
+    { +1.050000e+03, +4.747618e-02, +7.354946e+03, -4.139771e+06, +3.582922e+06, +4.057684e+06, -3.665010e+06, +1.910067e+03, +2.450312e+03, +2.106319e+01, -2.215370e-02, +2.150022e-06, +5.208658e-05, -2.479572e-09, +8.897767e-15, +1.000000e+07, +1.030394e+04, +4.651115e+05, -8.988418e-01, +5.165692e+02, -8.952664e+02 },
+    { +1.100000e+03, +4.995855e-02, +7.469282e+03, -4.535220e+06, +3.680991e+06, +4.180576e+06, -4.035634e+06, +1.937703e+03, +2.466093e+03, +2.001659e+01, -1.978531e-02, +2.033967e-06, +4.307051e-05, -2.174195e-09, +6.518191e-15, +1.000000e+07, +9.727450e+03, +4.916502e+05, -6.826801e-01, +5.102197e+02, -7.746323e+02 },
+    { +1.150000e+03, +5.241610e-02, +7.579320e+03, -4.936027e+06, +3.780190e+06, +4.304351e+06, -4.411866e+06, +1.966451e+03, +2.485379e+03, +1.907811e+01, -1.781150e-02, +1.931617e-06, +3.617547e-05, -1.928210e-09, +4.764841e-15, +1.000000e+07, +9.221029e+03, +5.177010e+05, -5.282885e-01, +5.050122e+02, -6.611276e+02 },
+    { +1.200000e+03, +5.485352e-02, +7.685546e+03, -5.342038e+06, +3.880618e+06, +4.429153e+06, -4.793503e+06, +1.995737e+03, +2.506991e+03, +1.823037e+01, -1.614288e-02, +1.840416e-06, +3.078033e-05, -1.726146e-09, +3.452398e-15, +1.000000e+07, +8.771319e+03, +5.433553e+05, -4.155523e-01, +5.006785e+02, -5.538252e+02 },
+    { +1.250000e+03, +5.727438e-02, +7.788351e+03, -5.753108e+06, +3.982331e+06, +4.555075e+06, -5.180364e+06, +2.025147e+03, +2.530089e+03, +1.745981e+01, -1.471533e-02, +1.758448e-06, +2.647752e-05, -1.557441e-09, +2.457518e-15, +1.000000e+07, +8.368360e+03, +5.686832e+05, -3.316364e-01, +4.970265e+02, -4.519684e+02 },
+    { +1.273000e+03, +5.838322e-02, +7.834581e+03, -5.943861e+06, +4.029561e+06, +4.613393e+06, -5.360029e+06, +2.038629e+03, +2.541038e+03, +1.712821e+01, -1.412611e-02, +1.723425e-06, +2.478529e-05, -1.488902e-09, +2.082199e-15, +1.000000e+07, +8.196535e+03, +5.802399e+05, -3.002746e-01, +4.955351e+02, -4.067664e+02 },
+    // P = 12.5 MPa
+    { +2.722180e+02, +9.940031e-04, -1.382333e+01, +3.209191e+01, -3.730868e+03, +8.694172e+03, +1.245713e+04, +4.162470e+03, +4.163227e+03, +1.006033e+03, +3.742364e-02, +4.976562e-07, -1.670597e-02, -3.695714e-09, -1.166103e-15, +1.250000e+07, -7.519979e+04, +2.009420e+06, +3.246564e+04, +1.456836e+04, +9.461258e+03 },
+    { +2.750000e+02, +9.939622e-04, +2.848405e+01, +1.209995e+01, +7.845213e+03, +2.026974e+04, +1.243663e+04, +4.158690e+03, +4.158717e+03, +1.006074e+03, -6.980497e-03, +4.879639e-07, -1.525707e-02, -3.281634e-09, -1.109856e-15, +1.250000e+07, +1.430535e+04, +2.049332e+06, +3.145967e+04, +1.384876e+04, +9.552202e+03 },
+    { +2.800000e+02, +9.941760e-04, +1.033624e+02, -3.207933e+02, +2.862068e+04, +4.104788e+04, +1.210641e+04, +4.149442e+03, +4.152983e+03, +1.005858e+03, -7.781305e-02, +4.731656e-07, -1.317244e-02, -2.660887e-09, -1.033777e-15, +1.250000e+07, +1.644520e+05, +2.113425e+06, +2.974768e+04, +1.264437e+04, +9.758593e+03 },
+    { +2.850000e+02, +9.947166e-04, +1.768350e+02, -1.028611e+03, +4.936936e+04, +6.180332e+04, +1.140535e+04, +4.137606e+03, +4.149507e+03, +1.005311e+03, -1.395093e-01, +4.611588e-07, -1.157315e-02, -2.158459e-09, -9.811050e-16, +1.250000e+07, +3.025190e+05, +2.168450e+06, +2.812239e+04, +1.154507e+04, +1.000377e+04 },
+    { +2.900000e+02, +9.955451e-04, +2.489840e+02, -2.104052e+03, +7.010132e+04, +8.254563e+04, +1.034026e+04, +4.123656e+03, +4.147646e+03, +1.004475e+03, -1.941133e-01, +4.514377e-07, -1.031668e-02, -1.742346e-09, -9.450503e-16, +1.250000e+07, +4.299890e+05, +2.215145e+06, +2.655913e+04, +1.054342e+04, +1.027215e+04 },
+    { +2.950000e+02, +9.966317e-04, +3.198784e+02, -3.540300e+03, +9.082382e+04, +1.032817e+05, +8.917596e+03, +4.107920e+03, +4.146951e+03, +1.003380e+03, -2.430907e-01, +4.436274e-07, -9.309957e-03, -1.391198e-09, -9.212688e-16, +1.250000e+07, +5.479614e+05, +2.254144e+06, +2.504630e+04, +9.633978e+03, +1.055191e+04 },
+    { +3.000000e+02, +9.979527e-04, +3.895769e+02, -5.330938e+03, +1.115421e+05, +1.240166e+05, +7.143471e+03, +4.090639e+03, +4.147102e+03, +1.002051e+03, -2.875230e-01, +4.374425e-07, -8.489932e-03, -1.090151e-09, -9.069111e-16, +1.250000e+07, +6.572818e+05, +2.286015e+06, +2.357981e+04, +8.812100e+03, +1.083433e+04 },
+    { +3.050000e+02, +9.994896e-04, +4.581312e+02, -7.469886e+03, +1.322601e+05, +1.447538e+05, +5.023733e+03, +4.072000e+03, +4.147868e+03, +1.000511e+03, -3.282272e-01, +4.326605e-07, -7.812592e-03, -8.284631e-10, -9.000660e-16, +1.250000e+07, +7.586253e+05, +2.311281e+06, +2.215959e+04, +8.073266e+03, +1.111303e+04 },
+    { +3.100000e+02, +1.001227e-03, +5.255871e+02, -9.951351e+03, +1.529806e+05, +1.654960e+05, +2.563989e+03, +4.052162e+03, +4.149085e+03, +9.987744e+02, -3.658337e-01, +4.291057e-07, -7.246408e-03, -5.981270e-10, -8.994281e-16, +1.250000e+07, +8.525492e+05, +2.330428e+06, +2.078745e+04, +7.412813e+03, +1.138344e+04 },
+    { +3.150000e+02, +1.003153e-03, +5.919859e+02, -1.276979e+04, +1.737058e+05, +1.862452e+05, -2.303759e+02, +4.031267e+03, +4.150645e+03, +9.968567e+02, -4.008377e-01, +4.266372e-07, -6.768307e-03, -3.930159e-10, -9.040952e-16, +1.250000e+07, +9.395282e+05, +2.343912e+06, +1.946586e+04, +6.825862e+03, +1.164228e+04 },
+    { +3.200000e+02, +1.005258e-03, +6.573658e+02, -1.591990e+04, +1.944372e+05, +2.070029e+05, -3.354172e+03, +4.009449e+03, +4.152476e+03, +9.947697e+02, -4.336347e-01, +4.251415e-07, -6.361096e-03, -2.083369e-10, -9.134409e-16, +1.250000e+07, +1.019977e+06, +2.352158e+06, +1.819722e+04, +6.307361e+03, +1.188721e+04 },
+    { +3.250000e+02, +1.007533e-03, +7.217622e+02, -1.939656e+04, +2.151762e+05, +2.277703e+05, -6.802395e+03, +3.986832e+03, +4.154540e+03, +9.925235e+02, -4.645450e-01, +4.245262e-07, -6.011758e-03, -4.026975e-11, -9.270340e-16, +1.250000e+07, +1.094267e+06, +2.355567e+06, +1.698349e+04, +5.852167e+03, +1.211664e+04 },
+    { +3.300000e+02, +1.009972e-03, +7.852086e+02, -2.319486e+04, +2.359240e+05, +2.485486e+05, -1.057021e+04, +3.963538e+03, +4.156820e+03, +9.901269e+02, -4.938320e-01, +4.247163e-07, -5.710310e-03, +1.142810e-10, -9.445857e-16, +1.250000e+07, +1.162734e+06, +2.354513e+06, +1.582606e+04, +5.455145e+03, +1.232947e+04 },
+    { +3.350000e+02, +1.012569e-03, +8.477368e+02, -2.731006e+04, +2.566818e+05, +2.693389e+05, -1.465295e+04, +3.939681e+03, +4.159318e+03, +9.875875e+02, -5.217149e-01, +4.256508e-07, -5.449003e-03, +2.578607e-10, -9.659146e-16, +1.250000e+07, +1.225688e+06, +2.349344e+06, +1.472567e+04, +5.111249e+03, +1.252502e+04 },
+    { +3.400000e+02, +1.015319e-03, +9.093774e+02, -3.173759e+04, +2.774507e+05, +2.901422e+05, -1.904610e+04, +3.915370e+03, +4.162049e+03, +9.849118e+02, -5.483787e-01, +4.272802e-07, -5.221763e-03, +3.925919e-10, -9.909234e-16, +1.250000e+07, +1.283417e+06, +2.340385e+06, +1.368248e+04, +4.815599e+03, +1.270287e+04 },
+    { +3.450000e+02, +1.018221e-03, +9.701597e+02, -3.647305e+04, +2.982320e+05, +3.109598e+05, -2.374529e+04, +3.890707e+03, +4.165035e+03, +9.821055e+02, -5.739812e-01, +4.295650e-07, -5.023787e-03, +5.202679e-10, -1.019583e-15, +1.250000e+07, +1.336192e+06, +2.327937e+06, +1.269611e+04, +4.563533e+03, +1.286282e+04 },
+    { +3.500000e+02, +1.021269e-03, +1.030112e+03, -4.151218e+04, +3.190272e+05, +3.317930e+05, -2.874631e+04, +3.865789e+03, +4.168304e+03, +9.791735e+02, -5.986589e-01, +4.324737e-07, -4.851247e-03, +6.424245e-10, -1.051923e-15, +1.250000e+07, +1.384267e+06, +2.312279e+06, +1.176571e+04, +4.350649e+03, +1.300483e+04 },
+    { +3.550000e+02, +1.024464e-03, +1.089263e+03, -4.685088e+04, +3.398376e+05, +3.526434e+05, -3.404508e+04, +3.840701e+03, +4.171890e+03, +9.761202e+02, -6.225310e-01, +4.359822e-07, -4.701074e-03, +7.603950e-10, -1.088022e-15, +1.250000e+07, +1.427881e+06, +2.293671e+06, +1.089007e+04, +4.172822e+03, +1.312899e+04 },
+    { +3.600000e+02, +1.027803e-03, +1.147639e+03, -5.248519e+04, +3.606650e+05, +3.735125e+05, -3.963766e+04, +3.815526e+03, +4.175824e+03, +9.729494e+02, -6.457028e-01, +4.400726e-07, -4.570793e-03, +8.753533e-10, -1.128009e-15, +1.250000e+07, +1.467264e+06, +2.272352e+06, +1.006764e+04, +4.026221e+03, +1.323547e+04 },
+    { +3.650000e+02, +1.031285e-03, +1.205267e+03, -5.841129e+04, +3.815112e+05, +3.944023e+05, -4.552023e+04, +3.790333e+03, +4.180144e+03, +9.696642e+02, -6.682687e-01, +4.447325e-07, -4.458404e-03, +9.883490e-10, -1.172054e-15, +1.250000e+07, +1.502631e+06, +2.248543e+06, +9.296682e+03, +3.907311e+03, +1.332450e+04 },
+    { +3.700000e+02, +1.034910e-03, +1.262172e+03, -6.462550e+04, +4.023783e+05, +4.153146e+05, -5.168912e+04, +3.765189e+03, +4.184882e+03, +9.662676e+02, -6.903139e-01, +4.499544e-07, -4.362286e-03, +1.100335e-09, -1.220373e-15, +1.250000e+07, +1.534186e+06, +2.222447e+06, +8.575256e+03, +3.812845e+03, +1.339637e+04 },
+    { +3.750000e+02, +1.038679e-03, +1.318380e+03, -7.112427e+04, +4.232684e+05, +4.362518e+05, -5.814079e+04, +3.740151e+03, +4.190074e+03, +9.627618e+02, -7.119165e-01, +4.557356e-07, -4.281125e-03, +1.212191e-09, -1.273227e-15, +1.250000e+07, +1.562126e+06, +2.194255e+06, +7.901316e+03, +3.739859e+03, +1.345138e+04 },
+    { +3.800000e+02, +1.042591e-03, +1.373916e+03, -7.790419e+04, +4.441838e+05, +4.572162e+05, -6.487180e+04, +3.715269e+03, +4.195754e+03, +9.591490e+02, -7.331483e-01, +4.620775e-07, -4.213861e-03, +1.324744e-09, -1.330923e-15, +1.250000e+07, +1.586635e+06, +2.164139e+06, +7.272739e+03, +3.685652e+03, +1.348989e+04 },
+    { +3.850000e+02, +1.046648e-03, +1.428803e+03, -8.496197e+04, +4.651271e+05, +4.782102e+05, -7.187887e+04, +3.690586e+03, +4.201955e+03, +9.554308e+02, -7.540768e-01, +4.689856e-07, -4.159644e-03, +1.438784e-09, -1.393817e-15, +1.250000e+07, +1.607889e+06, +2.132262e+06, +6.687367e+03, +3.647778e+03, +1.351224e+04 },
+    { +3.900000e+02, +1.050852e-03, +1.483065e+03, -9.229444e+04, +4.861010e+05, +4.992367e+05, -7.915879e+04, +3.666142e+03, +4.208709e+03, +9.516086e+02, -7.747654e-01, +4.764691e-07, -4.117801e-03, +1.555081e-09, -1.462322e-15, +1.250000e+07, +1.626056e+06, +2.098772e+06, +6.143038e+03, +3.624025e+03, +1.351882e+04 },
+    { +3.950000e+02, +1.055205e-03, +1.536726e+03, -9.989857e+04, +5.071083e+05, +5.202983e+05, -8.670852e+04, +3.641968e+03, +4.216050e+03, +9.476835e+02, -7.952746e-01, +4.845414e-07, -4.087814e-03, +1.674395e-09, -1.536906e-15, +1.250000e+07, +1.641293e+06, +2.063807e+06, +5.637606e+03, +3.612396e+03, +1.350998e+04 },
+    { +4.000000e+02, +1.059708e-03, +1.589808e+03, -1.077714e+05, +5.281518e+05, +5.413982e+05, -9.452509e+04, +3.618093e+03, +4.224010e+03, +9.436561e+02, -8.156626e-01, +4.932194e-07, -4.069296e-03, +1.797493e-09, -1.618107e-15, +1.250000e+07, +1.653752e+06, +2.027495e+06, +5.168965e+03, +3.611095e+03, +1.348611e+04 },
+    { +4.100000e+02, +1.069180e-03, +1.694325e+03, -1.243123e+05, +5.703608e+05, +5.837256e+05, -1.109475e+05, +3.571323e+03, +4.241920e+03, +9.352963e+02, -8.563009e-01, +5.124800e-07, -4.065717e-03, +2.058214e-09, -1.802877e-15, +1.250000e+07, +1.670896e+06, +1.951296e+06, +4.333899e+03, +3.633195e+03, +1.339477e+04 },
+    { +4.200000e+02, +1.079296e-03, +1.796788e+03, -1.418959e+05, +6.127550e+05, +6.262462e+05, -1.284047e+05, +3.525972e+03, +4.262713e+03, +9.265295e+02, -8.971237e-01, +5.344670e-07, -4.106210e-03, +2.343958e-09, -2.022578e-15, +1.250000e+07, +1.678539e+06, +1.871023e+06, +3.622225e+03, +3.679330e+03, +1.324777e+04 },
+    { +4.300000e+02, +1.090094e-03, +1.897366e+03, -1.605032e+05, +6.553642e+05, +6.689904e+05, -1.468770e+05, +3.482128e+03, +4.286689e+03, +9.173517e+02, -9.385743e-01, +5.594678e-07, -4.191518e-03, +2.662356e-09, -2.284911e-15, +1.250000e+07, +1.677620e+06, +1.787413e+06, +3.019564e+03, +3.740705e+03, +1.304800e+04 },
+    { +4.400000e+02, +1.101620e-03, +1.996223e+03, -1.801166e+05, +6.982215e+05, +7.119917e+05, -1.663463e+05, +3.439844e+03, +4.314190e+03, +9.077544e+02, -9.811110e-01, +5.878528e-07, -4.323982e-03, +3.022443e-09, -2.599908e-15, +1.250000e+07, +1.668974e+06, +1.701106e+06, +2.512872e+03, +3.810317e+03, +1.279829e+04 },
+    { +4.500000e+02, +1.113928e-03, +2.093519e+03, -2.007204e+05, +7.413632e+05, +7.552873e+05, -1.867963e+05, +3.399144e+03, +4.345618e+03, +8.977242e+02, -1.025225e+00, +6.200923e-07, -4.507701e-03, +3.435301e-09, -2.980761e-15, +1.250000e+07, +1.653342e+06, +1.612663e+06, +2.090456e+03, +3.882602e+03, +1.250139e+04 },
+    { +4.600000e+02, +1.127087e-03, +2.189415e+03, -2.223006e+05, +7.848302e+05, +7.989188e+05, -2.082120e+05, +3.360040e+03, +4.381453e+03, +8.872428e+02, -1.071456e+00, +6.567809e-07, -4.748876e-03, +3.914910e-09, -3.445034e-15, +1.250000e+07, +1.631376e+06, +1.522578e+06, +1.741931e+03, +3.953149e+03, +1.215996e+04 },
+    { +4.700000e+02, +1.141180e-03, +2.284071e+03, -2.448452e+05, +8.286683e+05, +8.429330e+05, -2.305804e+05, +3.322532e+03, +4.422288e+03, +8.762860e+02, -1.120423e+00, +6.986726e-07, -5.056388e-03, +4.479363e-09, -4.016445e-15, +1.250000e+07, +1.603645e+06, +1.431285e+06, +1.458152e+03, +4.018466e+03, +1.177662e+04 },
+    { +4.800000e+02, +1.156306e-03, +2.377653e+03, -2.683437e+05, +8.729298e+05, +8.873836e+05, -2.538899e+05, +3.286620e+03, +4.468860e+03, +8.648229e+02, -1.172846e+00, +7.467300e-07, -5.442709e-03, +5.152641e-09, -4.727567e-15, +1.250000e+07, +1.570643e+06, +1.339172e+06, +1.231124e+03, +4.075782e+03, +1.135395e+04 },
+    { +4.900000e+02, +1.172588e-03, +2.470332e+03, -2.927878e+05, +9.176751e+05, +9.323324e+05, -2.781305e+05, +3.252313e+03, +4.522105e+03, +8.528147e+02, -1.229597e+00, +8.021953e-07, -5.925337e-03, +5.967295e-09, -5.624021e-15, +1.250000e+07, +1.532790e+06, +1.246579e+06, +1.053917e+03, +4.122888e+03, +1.089448e+04 },
+    { +5.000000e+02, +1.190175e-03, +2.562292e+03, -3.181713e+05, +9.629747e+05, +9.778519e+05, -3.032941e+05, +3.219631e+03, +4.583225e+03, +8.402129e+02, -1.291755e+00, +8.666961e-07, -6.529048e-03, +6.968640e-09, -6.771154e-15, +1.250000e+07, +1.490436e+06, +1.153807e+06, +9.205831e+02, +4.158005e+03, +1.040069e+04 },
+    { +5.100000e+02, +1.209253e-03, +2.653731e+03, -3.444902e+05, +1.008913e+06, +1.024028e+06, -3.293746e+05, +3.188620e+03, +4.653802e+03, +8.269570e+02, -1.360699e+00, +9.424033e-07, -7.289546e-03, +8.221533e-09, -8.265060e-15, +1.250000e+07, +1.443861e+06, +1.061117e+06, +8.260780e+02, +4.179667e+03, +9.874968e+03 },
+    { +5.200000e+02, +1.230057e-03, +2.744873e+03, -3.717435e+05, +1.055591e+06, +1.070966e+06, -3.563678e+05, +3.159358e+03, +4.735954e+03, +8.129704e+02, -1.438242e+00, +1.032279e-06, -8.259542e-03, +9.821745e-09, -1.025144e-14, +1.250000e+07, +1.393268e+06, +9.687304e+05, +7.662143e+02, +4.186617e+03, +9.319519e+03 },
+    { +5.300000e+02, +1.252889e-03, +2.835977e+03, -3.999330e+05, +1.103135e+06, +1.118796e+06, -3.842719e+05, +3.131977e+03, +4.832601e+03, +7.981554e+02, -1.526851e+00, +1.140475e-06, -9.519292e-03, +1.191589e-08, -1.295934e-14, +1.250000e+07, +1.338784e+06, +8.768274e+05, +7.376388e+02, +4.177701e+03, +8.736252e+03 },
+    { +5.400000e+02, +1.278143e-03, +2.927349e+03, -4.290650e+05, +1.151704e+06, +1.167680e+06, -4.130882e+05, +3.106685e+03, +4.947886e+03, +7.823850e+02, -1.630008e+00, +1.273007e-06, -1.119574e-02, +1.473820e-08, -1.676481e-14, +1.250000e+07, +1.280439e+06, +7.855415e+05, +7.378671e+02, +4.151751e+03, +8.126546e+03 },
+    { +5.500000e+02, +1.306353e-03, +3.019376e+03, -4.591505e+05, +1.201506e+06, +1.217836e+06, -4.428211e+05, +3.083809e+03, +5.087927e+03, +7.654899e+02, -1.752840e+00, +1.438947e-06, -1.349947e-02, +1.868261e-08, -2.231874e-14, +1.250000e+07, +1.218140e+06, +6.949525e+05, +7.654197e+02, +4.107443e+03, +7.490919e+03 },
+    { +5.600000e+02, +1.338264e-03, +3.112557e+03, -4.902078e+05, +1.252824e+06, +1.269552e+06, -4.734795e+05, +3.063867e+03, +5.262189e+03, +7.472367e+02, -1.903290e+00, +1.652686e-06, -1.680147e-02, +2.445552e-08, -3.082472e-14, +1.250000e+07, +1.151634e+06, +6.050754e+05, +8.201692e+02, +4.043126e+03, +6.828538e+03 },
+    { +5.700000e+02, +1.374968e-03, +3.207583e+03, -5.222654e+05, +1.306057e+06, +1.323244e+06, -5.050783e+05, +3.047713e+03, +5.486239e+03, +7.272894e+02, -2.094476e+00, +1.938579e-06, -2.180916e-02, +3.343280e-08, -4.470683e-14, +1.250000e+07, +1.080418e+06, +5.158417e+05, +9.041626e+02, +3.956602e+03, +6.136534e+03 },
+    { +5.800000e+02, +1.418168e-03, +3.305472e+03, -5.553678e+05, +1.361806e+06, +1.379533e+06, -5.376407e+05, +3.036835e+03, +5.787868e+03, +7.051352e+02, -2.349965e+00, +2.341585e-06, -3.002751e-02, +4.861397e-08, -6.944736e-14, +1.250000e+07, +1.003579e+06, +4.270612e+05, +1.023642e+03, +3.844950e+03, +5.409115e+03 },
+    { +5.900000e+02, +1.470755e-03, +3.407867e+03, -5.895871e+05, +1.421054e+06, +1.439439e+06, -5.712026e+05, +3.034116e+03, +6.222943e+03, +6.799228e+02, -2.717586e+00, +2.955755e-06, -4.522968e-02, +7.771961e-08, -1.197340e-13, +1.250000e+07, +9.194220e+05, +3.383230e+05, +1.194624e+03, +3.704747e+03, +4.636735e+03 },
+    { +6.000000e+02, +1.538370e-03, +3.517812e+03, -6.250524e+05, +1.485635e+06, +1.504865e+06, -6.058228e+05, +3.046189e+03, +6.927870e+03, +6.500385e+02, -3.315845e+00, +4.021996e-06, -7.992194e-02, +1.469962e-07, -2.476693e-13, +1.250000e+07, +8.244277e+05, +2.486327e+05, +1.462630e+03, +3.535342e+03, +3.806687e+03 },
+    { +6.009630e+02, +1.546055e-03, +3.528997e+03, -6.285415e+05, +1.492255e+06, +1.511581e+06, -6.092158e+05, +3.048649e+03, +7.021200e+03, +6.468075e+02, -3.395494e+00, +4.169023e-06, -8.560770e-02, +1.585880e-07, -2.697893e-13, +1.250000e+07, +8.144582e+05, +2.398644e+05, +1.497653e+03, +3.517922e+03, +3.723248e+03 },
+    { +6.009630e+02, +1.546055e-03, +3.528997e+03, -6.285415e+05, +1.492255e+06, +1.511581e+06, -6.092158e+05, +3.048649e+03, +7.021200e+03, +6.468075e+02, -3.395494e+00, +4.169023e-06, -8.560770e-02, +1.585880e-07, -2.697893e-13, +1.250000e+07, +8.144582e+05, +2.398644e+05, +1.497653e+03, +3.517922e+03, +3.723248e+03 },
+    { +6.100000e+02, +1.472503e-02, +5.582805e+03, -8.432200e+05, +2.562291e+06, +2.746354e+06, -6.591571e+05, +2.948056e+03, +6.955041e+03, +6.791156e+01, -5.567054e-01, +1.023000e-05, +2.114583e-02, -2.373488e-07, +2.237170e-12, +1.250000e+07, +5.441892e+04, +9.775173e+04, -1.894913e+02, +1.104647e+03, -2.089644e+03 },
+    { +6.200000e+02, +1.582571e-02, +5.684739e+03, -9.133344e+05, +2.611204e+06, +2.809025e+06, -7.155130e+05, +2.701630e+03, +5.706098e+03, +6.318830e+01, -4.044305e-01, +8.453539e-06, +1.101556e-02, -1.342187e-07, +1.284220e-12, +1.250000e+07, +4.784157e+04, +1.182937e+05, -1.315944e+02, +1.018434e+03, -2.125807e+03 },
+    { +6.300000e+02, +1.677525e-02, +5.769697e+03, -9.824868e+05, +2.652422e+06, +2.862113e+06, -7.727961e+05, +2.533872e+03, +4.965603e+03, +5.961163e+01, -3.178141e-01, +7.363923e-06, +6.818679e-03, -8.884645e-08, +8.542601e-13, +1.250000e+07, +4.315825e+04, +1.357972e+05, -1.006174e+02, +9.585212e+02, -2.139254e+03 },
+    { +6.400000e+02, +1.762647e-02, +5.843746e+03, -1.051202e+06, +2.688796e+06, +2.909127e+06, -8.308709e+05, +2.408515e+03, +4.466273e+03, +5.673285e+01, -2.615357e-01, +6.609649e-06, +4.646060e-03, -6.420292e-08, +6.167073e-13, +1.250000e+07, +3.956877e+04, +1.512940e+05, -8.030217e+01, +9.110297e+02, -2.135718e+03 },
+    { +6.500000e+02, +1.840743e-02, +5.910058e+03, -1.119738e+06, +2.721799e+06, +2.951892e+06, -8.896454e+05, +2.310601e+03, +4.104648e+03, +5.432590e+01, -2.219716e-01, +6.048679e-06, +3.369020e-03, -4.910289e-08, +4.692677e-13, +1.250000e+07, +3.669753e+04, +1.653253e+05, -6.564684e+01, +8.714119e+02, -2.120503e+03 },
+    { +6.750000e+02, +2.015125e-02, +6.053025e+03, -1.291131e+06, +2.794661e+06, +3.046551e+06, -1.039240e+06, +2.140875e+03, +3.525659e+03, +4.962472e+01, -1.605778e-01, +5.103837e-06, +1.788997e-03, -2.929861e-08, +2.729840e-13, +1.250000e+07, +3.146217e+04, +1.959310e+05, -4.224660e+01, +7.950332e+02, -2.053274e+03 },
+    { +7.000000e+02, +2.169909e-02, +6.174652e+03, -1.463360e+06, +2.858897e+06, +3.130136e+06, -1.192121e+06, +2.035886e+03, +3.188113e+03, +4.608487e+01, -1.254289e-01, +4.500266e-06, +1.104593e-03, -1.998355e-08, +1.792402e-13, +1.250000e+07, +2.787144e+04, +2.222091e+05, -2.886259e+01, +7.400543e+02, -1.966622e+03 },
+    { +7.250000e+02, +2.312046e-02, +6.282502e+03, -1.636865e+06, +2.917949e+06, +3.206955e+06, -1.347859e+06, +1.968391e+03, +2.972276e+03, +4.325173e+01, -1.026944e-01, +4.071374e-06, +7.486289e-04, -1.477401e-08, +1.264601e-13, +1.250000e+07, +2.522354e+04, +2.456174e+05, -2.057795e+01, +6.988528e+02, -1.873832e+03 },
+    { +7.500000e+02, +2.445349e-02, +6.380655e+03, -1.811834e+06, +2.973657e+06, +3.279325e+06, -1.506166e+06, +1.924398e+03, +2.826307e+03, +4.089396e+01, -8.678924e-02, +3.745519e-06, +5.407161e-04, -1.152571e-08, +9.355787e-14, +1.250000e+07, +2.317148e+04, +2.669857e+05, -1.516842e+01, +6.670389e+02, -1.780510e+03 },
+    { +7.750000e+02, +2.572148e-02, +6.471565e+03, -1.988350e+06, +3.027113e+06, +3.348631e+06, -1.666832e+06, +1.895951e+03, +2.723951e+03, +3.887801e+01, -7.503311e-02, +3.486333e-06, +4.090142e-04, -9.341977e-09, +7.157355e-14, +1.250000e+07, +2.152207e+04, +2.868344e+05, -1.148759e+01, +6.418657e+02, -1.689064e+03 },
+    { +8.000000e+02, +2.693972e-02, +6.556824e+03, -2.166444e+06, +3.079016e+06, +3.415762e+06, -1.829697e+06, +1.878223e+03, +2.650502e+03, +3.711991e+01, -6.598353e-02, +3.273203e-06, +3.204053e-04, -7.790463e-09, +5.612705e-14, +1.250000e+07, +2.015870e+04, +3.055111e+05, -8.897275e+00, +6.215327e+02, -1.600491e+03 },
+    { +8.250000e+02, +2.811880e-02, +6.637524e+03, -2.346120e+06, +3.129837e+06, +3.481322e+06, -1.994635e+06, +1.868138e+03, +2.597105e+03, +3.556340e+01, -5.879690e-02, +3.093489e-06, +2.579445e-04, -6.640438e-09, +4.485355e-14, +1.250000e+07, +1.900666e+04, +3.232596e+05, -7.022134e+00, +6.048190e+02, -1.515134e+03 },
+    { +8.500000e+02, +2.926632e-02, +6.714446e+03, -2.527371e+06, +3.179908e+06, +3.545737e+06, -2.161542e+06, +1.863657e+03, +2.558129e+03, +3.416897e+01, -5.294760e-02, +2.938957e-06, +2.122506e-04, -5.759018e-09, +3.637769e-14, +1.250000e+07, +1.801578e+04, +3.402568e+05, -5.631659e+00, +5.908729e+02, -1.433031e+03 },
+    { +9.000000e+02, +3.148803e-02, +6.859137e+03, -2.894528e+06, +3.278696e+06, +3.672296e+06, -2.500927e+06, +1.866323e+03, +2.509635e+03, +3.175810e+01, -4.399295e-02, +2.684587e-06, +1.511593e-04, -4.506093e-09, +2.472893e-14, +1.250000e+07, +1.638723e+04, +3.724968e+05, -3.767891e+00, +5.690093e+02, -1.278124e+03 },
+    { +9.500000e+02, +3.363624e-02, +6.994123e+03, -3.267747e+06, +3.376669e+06, +3.797122e+06, -2.847294e+06, +1.879166e+03, +2.486700e+03, +2.972984e+01, -3.745238e-02, +2.481571e-06, +1.132181e-04, -3.665543e-09, +1.733664e-14, +1.250000e+07, +1.509221e+04, +4.029706e+05, -2.629267e+00, +5.527425e+02, -1.134448e+03 },
+    { +1.000000e+03, +3.573059e-02, +7.121442e+03, -3.646844e+06, +3.474597e+06, +3.921230e+06, -3.200212e+06, +1.898328e+03, +2.479703e+03, +2.798722e+01, -3.246188e-02, +2.314044e-06, +8.799217e-05, -3.066796e-09, +1.239825e-14, +1.250000e+07, +1.402820e+04, +4.321439e+05, -1.896576e+00, +5.402388e+02, -1.000565e+03 },
+    { +1.050000e+03, +3.778413e-02, +7.242475e+03, -4.031636e+06, +3.572963e+06, +4.045265e+06, -3.559334e+06, +1.921506e+03, +2.483101e+03, +2.646614e+01, -2.852817e-02, +2.172366e-06, +7.033929e-05, -2.620765e-09, +8.972229e-15, +1.250000e+07, +1.313230e+04, +4.603276e+05, -1.405502e+00, +5.303765e+02, -8.751881e+02 },
+    { +1.100000e+03, +3.980591e-02, +7.358206e+03, -4.421945e+06, +3.672081e+06, +4.169655e+06, -3.924371e+06, +1.947228e+03, +2.493467e+03, +2.512189e+01, -2.534858e-02, +2.050277e-06, +5.748523e-05, -2.276804e-09, +6.526240e-15, +1.250000e+07, +1.236349e+04, +4.877390e+05, -1.065377e+00, +5.224327e+02, -7.572257e+02 },
+    { +1.150000e+03, +4.180249e-02, +7.469364e+03, -4.817610e+06, +3.772159e+06, +4.294690e+06, -4.295078e+06, +1.974501e+03, +2.508563e+03, +2.392202e+01, -2.272675e-02, +1.943503e-06, +4.782432e-05, -2.004174e-09, +4.740560e-15, +1.250000e+07, +1.169371e+04, +5.145349e+05, -8.233072e-01, +5.159214e+02, -6.457646e+02 },
+    { +1.200000e+03, +4.377869e-02, +7.576505e+03, -5.218474e+06, +3.873331e+06, +4.420565e+06, -4.671241e+06, +2.002629e+03, +2.526864e+03, +2.284216e+01, -2.052950e-02, +1.849002e-06, +4.037374e-05, -1.783221e-09, +3.413800e-15, +1.250000e+07, +1.110302e+04, +5.408323e+05, -6.470086e-01, +5.105046e+02, -5.400401e+02 },
+    { +1.250000e+03, +4.573818e-02, +7.680065e+03, -5.624397e+06, +3.975684e+06, +4.547412e+06, -5.052669e+06, +2.031113e+03, +2.547299e+03, +2.186357e+01, -1.866315e-02, +1.764540e-06, +3.450376e-05, -1.600831e-09, +2.414147e-15, +1.250000e+07, +1.057678e+04, +5.667200e+05, -5.160306e-01, +5.059405e+02, -4.394093e+02 },
+    { +1.273000e+03, +4.663475e-02, +7.726599e+03, -5.812782e+06, +4.023178e+06, +4.606113e+06, -5.229847e+06, +2.044230e+03, +2.557195e+03, +2.144324e+01, -1.789634e-02, +1.728578e-06, +3.221342e-05, -1.527277e-09, +2.038490e-15, +1.250000e+07, +1.035321e+04, +5.785102e+05, -4.671341e-01, +5.040766e+02, -3.946768e+02 },
+    // P = 15.0 MPa
+    { +2.720250e+02, +9.927847e-04, -1.668731e+01, +4.590048e+01, -4.493466e+03, +1.039830e+04, +1.493767e+04, +4.151895e+03, +4.152429e+03, +1.007268e+03, +3.141264e-02, +4.954576e-07, -1.641851e-02, -3.670122e-09, -1.161447e-15, +1.500000e+07, -6.340127e+04, +2.018336e+06, +3.220820e+04, +1.465093e+04, +9.549490e+03 },
+    { +2.750000e+02, +9.927619e-04, +2.845676e+01, +2.860279e+01, +7.854212e+03, +2.274564e+04, +1.492003e+04, +4.148356e+03, +4.148484e+03, +1.007291e+03, -1.512790e-02, +4.851998e-07, -1.491397e-02, -3.236354e-09, -1.101440e-15, +1.500000e+07, +3.117870e+04, +2.061006e+06, +3.115592e+04, +1.389309e+04, +9.642708e+03 },
+    { +2.800000e+02, +9.930114e-04, +1.031622e+02, -3.047816e+02, +2.858063e+04, +4.347580e+04, +1.459039e+04, +4.139784e+03, +4.143966e+03, +1.007038e+03, -8.442597e-02, +4.705911e-07, -1.289778e-02, -2.629474e-09, -1.025882e-15, +1.500000e+07, +1.794041e+05, +2.124987e+06, +2.948266e+04, +1.270465e+04, +9.843879e+03 },
+    { +2.850000e+02, +9.935801e-04, +1.764836e+02, -1.012987e+03, +4.928485e+04, +6.418855e+04, +1.389071e+04, +4.128535e+03, +4.141409e+03, +1.006461e+03, -1.448783e-01, +4.587158e-07, -1.134769e-02, -2.136716e-09, -9.733334e-16, +1.500000e+07, +3.158345e+05, +2.179999e+06, +2.789195e+04, +1.161546e+04, +1.008395e+04 },
+    { +2.900000e+02, +9.944307e-04, +2.484982e+02, -2.088731e+03, +6.997576e+04, +8.489222e+04, +1.282773e+04, +4.115105e+03, +4.140254e+03, +1.005600e+03, -1.984508e-01, +4.490850e-07, -1.012784e-02, -1.727621e-09, -9.371568e-16, +1.500000e+07, +4.419002e+05, +2.226750e+06, +2.635963e+04, +1.061969e+04, +1.034729e+04 },
+    { +2.950000e+02, +9.955341e-04, +3.192711e+02, -3.525210e+03, +9.065977e+04, +1.055928e+05, +1.140780e+04, +4.099839e+03, +4.140111e+03, +1.004486e+03, -2.465570e-01, +4.413345e-07, -9.149110e-03, -1.381770e-09, -9.130972e-16, +1.500000e+07, +5.586623e+05, +2.265855e+06, +2.487450e+04, +9.713116e+03, +1.062217e+04 },
+    { +3.000000e+02, +9.968676e-04, +3.888585e+02, -5.316019e+03, +1.113415e+05, +1.262945e+05, +9.636994e+03, +4.082987e+03, +4.140695e+03, +1.003142e+03, -2.902418e-01, +4.351859e-07, -8.350942e-03, -1.084874e-09, -8.983563e-16, +1.500000e+07, +6.669375e+05, +2.297868e+06, +2.343279e+04, +8.891968e+03, +1.089994e+04 },
+    { +3.050000e+02, +9.984130e-04, +4.573098e+02, -7.455085e+03, +1.320244e+05, +1.470006e+05, +7.521110e+03, +4.064744e+03, +4.141804e+03, +1.001590e+03, -3.302960e-01, +4.304216e-07, -7.690933e-03, -8.265580e-10, -8.910512e-16, +1.500000e+07, +7.673778e+05, +2.323303e+06, +2.203470e+04, +8.152371e+03, +1.117430e+04 },
+    { +3.100000e+02, +1.000156e-03, +5.246693e+02, -9.936620e+03, +1.527109e+05, +1.677132e+05, +5.065716e+03, +4.045275e+03, +4.143295e+03, +9.998443e+02, -3.673302e-01, +4.268691e-07, -7.138651e-03, -5.990580e-10, -8.898911e-16, +1.500000e+07, +8.605220e+05, +2.342639e+06, +2.068227e+04, +7.490121e+03, +1.144071e+04 },
+    { +3.150000e+02, +1.002084e-03, +5.909773e+02, -1.275509e+04, +1.734028e+05, +1.884340e+05, +2.276169e+03, +4.024725e+03, +4.145070e+03, +9.979205e+02, -4.018246e-01, +4.243897e-07, -6.671794e-03, -3.964099e-10, -8.939801e-16, +1.500000e+07, +9.468293e+05, +2.356325e+06, +1.937818e+04, +6.900671e+03, +1.169589e+04 },
+    { +3.200000e+02, +1.004188e-03, +6.562708e+02, -1.590518e+04, +1.941015e+05, +2.091643e+05, -8.423668e+02, +4.003230e+03, +4.147069e+03, +9.958297e+02, -4.341626e-01, +4.228714e-07, -6.273721e-03, -2.139349e-10, -9.026931e-16, +1.500000e+07, +1.026701e+06, +2.364785e+06, +1.812503e+04, +6.379206e+03, +1.193755e+04 },
+    { +3.250000e+02, +1.006460e-03, +7.205844e+02, -1.938180e+04, +2.148081e+05, +2.299050e+05, -4.284906e+03, +3.980918e+03, +4.149261e+03, +9.935819e+02, -4.646553e-01, +4.222230e-07, -5.931827e-03, -4.789443e-11, -9.155971e-16, +1.500000e+07, +1.100497e+06, +2.368417e+06, +1.692498e+04, +5.920756e+03, +1.216407e+04 },
+    { +3.300000e+02, +1.008893e-03, +7.839510e+02, -2.318002e+04, +2.355238e+05, +2.506572e+05, -8.046633e+03, +3.957911e+03, +4.151637e+03, +9.911858e+02, -4.935583e-01, +4.223702e-07, -5.636438e-03, +1.047461e-10, -9.323992e-16, +1.500000e+07, +1.168544e+06, +2.367592e+06, +1.577958e+04, +5.520307e+03, +1.237435e+04 },
+    { +3.350000e+02, +1.011482e-03, +8.464018e+02, -2.729512e+04, +2.562495e+05, +2.714217e+05, -1.212289e+04, +3.934326e+03, +4.154202e+03, +9.886486e+02, -5.210845e-01, +4.232523e-07, -5.380043e-03, +2.464853e-10, -9.529123e-16, +1.500000e+07, +1.231144e+06, +2.362657e+06, +1.468975e+04, +5.172903e+03, +1.256767e+04 },
+    { +3.400000e+02, +1.014223e-03, +9.079669e+02, -3.172251e+04, +2.769862e+05, +2.921996e+05, -1.650917e+04, +3.910272e+03, +4.156974e+03, +9.859769e+02, -5.474138e-01, +4.248203e-07, -5.156751e-03, +3.794084e-10, -9.770321e-16, +1.500000e+07, +1.288577e+06, +2.353936e+06, +1.365578e+04, +4.873728e+03, +1.274362e+04 },
+    { +3.450000e+02, +1.017112e-03, +9.686753e+02, -3.645781e+04, +2.977352e+05, +3.129918e+05, -2.120113e+04, +3.885854e+03, +4.159977e+03, +9.831762e+02, -5.726994e-01, +4.270347e-07, -4.961903e-03, +5.052778e-10, -1.004722e-15, +1.500000e+07, +1.341108e+06, +2.341730e+06, +1.267743e+04, +4.618164e+03, +1.290198e+04 },
+    { +3.500000e+02, +1.020146e-03, +1.028555e+03, -4.149674e+04, +3.184976e+05, +3.337998e+05, -2.619455e+04, +3.861166e+03, +4.163244e+03, +9.802514e+02, -5.970740e-01, +4.298639e-07, -4.791784e-03, +6.256025e-10, -1.036000e-15, +1.500000e+07, +1.388984e+06, +2.326318e+06, +1.175398e+04, +4.401841e+03, +1.304269e+04 },
+    { +3.550000e+02, +1.023325e-03, +1.087634e+03, -4.683522e+04, +3.392749e+05, +3.546248e+05, -3.148535e+04, +3.836299e+03, +4.166806e+03, +9.772068e+02, -6.206535e-01, +4.332836e-07, -4.643414e-03, +7.416920e-10, -1.070938e-15, +1.500000e+07, +1.432442e+06, +2.307957e+06, +1.088432e+04, +4.220657e+03, +1.316581e+04 },
+    { +3.600000e+02, +1.026646e-03, +1.145939e+03, -5.246928e+04, +3.600687e+05, +3.754684e+05, -3.706960e+04, +3.811332e+03, +4.170700e+03, +9.740461e+02, -6.435404e-01, +4.372757e-07, -4.514389e-03, +8.546978e-10, -1.109649e-15, +1.500000e+07, +1.471704e+06, +2.286887e+06, +1.006703e+04, +4.070797e+03, +1.327149e+04 },
+    { +3.650000e+02, +1.030108e-03, +1.203496e+03, -5.839510e+04, +3.808808e+05, +3.963324e+05, -4.294349e+04, +3.786338e+03, +4.174960e+03, +9.707724e+02, -6.658263e-01, +4.418272e-07, -4.402763e-03, +9.656478e-10, -1.152292e-15, +1.500000e+07, +1.506984e+06, +2.263328e+06, +9.300439e+03, +3.948735e+03, +1.335996e+04 },
+    { +3.700000e+02, +1.033711e-03, +1.260330e+03, -6.460901e+04, +4.017130e+05, +4.172187e+05, -4.910335e+04, +3.761382e+03, +4.179621e+03, +9.673887e+02, -6.875943e-01, +4.469303e-07, -4.306956e-03, +1.075473e-09, -1.199067e-15, +1.500000e+07, +1.538482e+06, +2.237485e+06, +8.582700e+03, +3.851230e+03, +1.343149e+04 },
+    { +3.750000e+02, +1.037455e-03, +1.316467e+03, -7.110745e+04, +4.225675e+05, +4.381293e+05, -5.554562e+04, +3.736523e+03, +4.184719e+03, +9.638972e+02, -7.089201e-01, +4.525815e-07, -4.225687e-03, +1.185032e-09, -1.250218e-15, +1.500000e+07, +1.566392e+06, +2.209547e+06, +7.911840e+03, +3.775322e+03, +1.348638e+04 },
+    { +3.800000e+02, +1.041341e-03, +1.371930e+03, -7.788701e+04, +4.434465e+05, +4.590666e+05, -6.226689e+04, +3.711812e+03, +4.190287e+03, +9.603001e+02, -7.298737e-01, +4.587815e-07, -4.157918e-03, +1.295127e-09, -1.306031e-15, +1.500000e+07, +1.590896e+06, +2.179687e+06, +7.285803e+03, +3.718311e+03, +1.352495e+04 },
+    { +3.850000e+02, +1.045370e-03, +1.426745e+03, -8.494440e+04, +4.643525e+05, +4.800330e+05, -6.926385e+04, +3.687292e+03, +4.196357e+03, +9.565990e+02, -7.505204e-01, +4.655349e-07, -4.102814e-03, +1.406524e-09, -1.366841e-15, +1.500000e+07, +1.612168e+06, +2.148067e+06, +6.702492e+03, +3.677752e+03, +1.354756e+04 },
+    { +3.900000e+02, +1.049543e-03, +1.480934e+03, -9.227645e+04, +4.852879e+05, +5.010311e+05, -7.653330e+04, +3.663002e+03, +4.202964e+03, +9.527953e+02, -7.709218e-01, +4.728501e-07, -4.059710e-03, +1.519964e-09, -1.433033e-15, +1.500000e+07, +1.630372e+06, +2.114835e+06, +6.159795e+03, +3.651429e+03, +1.355456e+04 },
+    { +3.950000e+02, +1.053863e-03, +1.534521e+03, -9.988013e+04, +5.062557e+05, +5.220636e+05, -8.407218e+04, +3.638976e+03, +4.210137e+03, +9.488901e+02, -7.911366e-01, +4.807392e-07, -4.028089e-03, +1.636179e-09, -1.505047e-15, +1.500000e+07, +1.645667e+06, +2.080130e+06, +5.655615e+03, +3.637345e+03, +1.354633e+04 },
+    { +4.000000e+02, +1.058331e-03, +1.587528e+03, -1.077525e+05, +5.272585e+05, +5.431335e+05, -9.187754e+04, +3.615240e+03, +4.217909e+03, +9.448841e+02, -8.112212e-01, +4.892178e-07, -4.007559e-03, +1.755902e-09, -1.583386e-15, +1.500000e+07, +1.658201e+06, +2.044079e+06, +5.187887e+03, +3.633703e+03, +1.352322e+04 },
+    { +4.100000e+02, +1.067724e-03, +1.691888e+03, -1.242923e+05, +5.693818e+05, +5.853977e+05, -1.082764e+05, +3.568730e+03, +4.235379e+03, +9.365719e+02, -8.512174e-01, +5.080250e-07, -3.998773e-03, +2.008887e-09, -1.761392e-15, +1.500000e+07, +1.675542e+06, +1.968407e+06, +4.353775e+03, +3.651444e+03, +1.343386e+04 },
+    { +4.200000e+02, +1.077750e-03, +1.794188e+03, -1.418747e+05, +6.116841e+05, +6.278503e+05, -1.257084e+05, +3.523612e+03, +4.255636e+03, +9.278594e+02, -8.913377e-01, +5.294734e-07, -4.032337e-03, +2.285270e-09, -1.972597e-15, +1.500000e+07, +1.683442e+06, +1.888669e+06, +3.642089e+03, +3.693634e+03, +1.328941e+04 },
+    { +4.300000e+02, +1.088443e-03, +1.894592e+03, -1.604805e+05, +6.541940e+05, +6.705207e+05, -1.441538e+05, +3.479977e+03, +4.278965e+03, +9.187433e+02, -9.320067e-01, +5.538320e-07, -4.108726e-03, +2.592199e-09, -2.224156e-15, +1.500000e+07, +1.682833e+06, +1.805602e+06, +3.038641e+03, +3.751454e+03, +1.309275e+04 },
+    { +4.400000e+02, +1.099849e-03, +1.993262e+03, -1.800922e+05, +6.969432e+05, +7.134409e+05, -1.635945e+05, +3.437879e+03, +4.305688e+03, +9.092160e+02, -9.736612e-01, +5.814470e-07, -4.229881e-03, +2.938067e-09, -2.525348e-15, +1.500000e+07, +1.674549e+06, +1.719847e+06, +2.530529e+03, +3.817876e+03, +1.284668e+04 },
+    { +4.500000e+02, +1.112019e-03, +2.090357e+03, -2.006941e+05, +7.399667e+05, +7.566470e+05, -1.840138e+05, +3.397342e+03, +4.336178e+03, +8.992652e+02, -1.016765e+00, +6.127569e-07, -4.399331e-03, +3.333081e-09, -2.888310e-15, +1.500000e+07, +1.659329e+06, +1.631968e+06, +2.106168e+03, +3.887316e+03, +1.255391e+04 },
+    { +4.600000e+02, +1.125019e-03, +2.186034e+03, -2.222722e+05, +7.833033e+05, +8.001786e+05, -2.053969e+05, +3.358376e+03, +4.370885e+03, +8.888741e+02, -1.061827e+00, +6.483146e-07, -4.622471e-03, +3.790005e-09, -3.329098e-15, +1.500000e+07, +1.637826e+06, +1.542461e+06, +1.755246e+03, +3.955345e+03, +1.221713e+04 },
+    { +4.700000e+02, +1.138926e-03, +2.280449e+03, -2.448142e+05, +8.269966e+05, +8.440805e+05, -2.277303e+05, +3.320981e+03, +4.410352e+03, +8.780203e+02, -1.109419e+00, +6.888174e-07, -4.907038e-03, +4.325212e-09, -3.869236e-15, +1.500000e+07, +1.610614e+06, +1.451764e+06, +1.468664e+03, +4.018454e+03, +1.183894e+04 },
+    { +4.800000e+02, +1.153835e-03, +2.373762e+03, -2.683097e+05, +8.710962e+05, +8.884037e+05, -2.510022e+05, +3.285156e+03, +4.455258e+03, +8.666751e+02, -1.160208e+00, +7.351506e-07, -5.263869e-03, +4.960193e-09, -4.538043e-15, +1.500000e+07, +1.578191e+06, +1.360265e+06, +1.238451e+03, +4.073862e+03, +1.142193e+04 },
+    { +4.900000e+02, +1.169860e-03, +2.466141e+03, -2.927503e+05, +9.156587e+05, +9.332066e+05, -2.752024e+05, +3.250902e+03, +4.506452e+03, +8.548028e+02, -1.214987e+00, +7.884489e-07, -5.708066e-03, +5.723810e-09, -5.376184e-15, +1.500000e+07, +1.540984e+06, +1.268313e+06, +1.057674e+03, +4.119351e+03, +1.096866e+04 },
+    { +5.000000e+02, +1.187143e-03, +2.557760e+03, -3.181296e+05, +9.607501e+05, +9.785573e+05, -3.003225e+05, +3.218236e+03, +4.565020e+03, +8.423589e+02, -1.274730e+00, +8.501862e-07, -6.260822e-03, +6.655766e-09, -6.441258e-15, +1.500000e+07, +1.499354e+06, +1.176213e+06, +9.203536e+02, +4.153141e+03, +1.048162e+04 },
+    { +5.100000e+02, +1.205854e-03, +2.648808e+03, -3.444435e+05, +1.006448e+06, +1.024536e+06, -3.263557e+05, +3.187192e+03, +4.632376e+03, +8.292876e+02, -1.340664e+00, +9.223094e-07, -6.952317e-03, +7.812108e-09, -7.816857e-15, +1.500000e+07, +1.453595e+06, +1.084235e+06, +8.213873e+02, +4.173769e+03, +9.963278e+03 },
+    { +5.200000e+02, +1.226212e-03, +2.739496e+03, -3.716906e+05, +1.052847e+06, +1.071240e+06, -3.532974e+05, +3.157836e+03, +4.710393e+03, +8.155197e+02, -1.414383e+00, +1.007443e-06, -7.826465e-03, +9.274277e-09, -9.627758e-15, +1.500000e+07, +1.403933e+06, +9.926116e+05, +7.564860e+02, +4.179991e+03, +9.415931e+03 },
+    { +5.300000e+02, +1.248491e-03, +2.830063e+03, -3.998726e+05, +1.100061e+06, +1.118788e+06, -3.811452e+05, +3.130276e+03, +4.801616e+03, +8.009670e+02, -1.498017e+00, +1.109215e-06, -8.948923e-03, +1.116459e-08, -1.206647e-14, +1.500000e+07, +1.350521e+06, +9.015387e+05, +7.221337e+02, +4.170676e+03, +8.841648e+03 },
+    { +5.400000e+02, +1.273048e-03, +2.920792e+03, -4.289949e+05, +1.148233e+06, +1.167328e+06, -4.098992e+05, +3.104686e+03, +4.909597e+03, +7.855166e+02, -1.594521e+00, +1.232786e-06, -1.042125e-02, +1.367398e-08, -1.544184e-14, +1.500000e+07, +1.293429e+06, +8.111708e+05, +7.155842e+02, +4.144693e+03, +8.242066e+03 },
+    { +5.500000e+02, +1.300357e-03, +3.012028e+03, -4.590681e+05, +1.197547e+06, +1.217053e+06, -4.395627e+05, +3.081336e+03, +5.039474e+03, +7.690198e+02, -1.708142e+00, +1.385774e-06, -1.240718e-02, +1.711442e-08, -2.027331e-14, +1.500000e+07, +1.232627e+06, +7.216183e+05, +7.349223e+02, +4.100776e+03, +7.618112e+03 },
+    { +5.600000e+02, +1.331069e-03, +3.104213e+03, -4.901090e+05, +1.248250e+06, +1.268216e+06, -4.701429e+05, +3.060646e+03, +5.198986e+03, +7.512757e+02, -1.845280e+00, +1.579928e-06, -1.518486e-02, +2.202505e-08, -2.748651e-14, +1.500000e+07, +1.167952e+06, +6.329404e+05, +7.792510e+02, +4.037341e+03, +6.969605e+03 },
+    { +5.700000e+02, +1.366115e-03, +3.197936e+03, -5.221438e+05, +1.300680e+06, +1.321171e+06, -5.016521e+05, +3.043291e+03, +5.400422e+03, +7.320026e+02, -2.016112e+00, +1.834404e-06, -1.925925e-02, +2.940565e-08, -3.885623e-14, +1.500000e+07, +1.099055e+06, +5.451361e+05, +8.491514e+02, +3.952255e+03, +6.294706e+03 },
+    { +5.800000e+02, +1.406896e-03, +3.294037e+03, -5.552130e+05, +1.355329e+06, +1.376432e+06, -5.341095e+05, +3.030394e+03, +5.664670e+03, +7.107848e+02, -2.238008e+00, +2.182798e-06, -2.563304e-02, +4.129112e-08, -5.812908e-14, +1.500000e+07, +1.025293e+06, +4.581275e+05, +9.477833e+02, +3.842543e+03, +5.589238e+03 },
+    { +5.900000e+02, +1.455674e-03, +3.393805e+03, -5.893801e+05, +1.412965e+06, +1.434800e+06, -5.675450e+05, +3.023989e+03, +6.030769e+03, +6.869671e+02, -2.543627e+00, +2.690206e-06, -3.657056e-02, +6.240239e-08, -9.435104e-14, +1.500000e+07, +9.455140e+05, +3.717188e+05, +1.083715e+03, +3.704170e+03, +4.846076e+03 },
+    { +6.000000e+02, +1.516514e-03, +3.499433e+03, -6.247527e+05, +1.474907e+06, +1.497655e+06, -6.020049e+05, +3.028244e+03, +6.582989e+03, +6.594072e+02, -3.004121e+00, +3.503243e-06, -5.834368e-02, +1.061655e-07, -1.743631e-13, +1.500000e+07, +8.575257e+05, +2.854498e+05, +1.279463e+03, +3.532656e+03, +4.055492e+03 },
+    { +6.100000e+02, +1.598089e-03, +3.615365e+03, -6.615386e+05, +1.543834e+06, +1.567805e+06, -6.375673e+05, +3.053886e+03, +7.556455e+03, +6.257473e+02, -3.821188e+00, +5.052058e-06, -1.161694e-01, +2.278436e-07, -4.136075e-13, +1.500000e+07, +7.563627e+05, +1.979391e+05, +1.607878e+03, +3.330045e+03, +3.207624e+03 },
+    { +6.153050e+02, +1.656946e-03, +3.684553e+03, -6.817812e+05, +1.585343e+06, +1.610197e+06, -6.569270e+05, +3.087310e+03, +8.513126e+03, +6.035198e+02, -4.635510e+00, +6.690172e-06, -2.050117e-01, +4.216040e-07, -8.168695e-13, +1.500000e+07, +6.928835e+05, +1.494730e+05, +1.933521e+03, +3.226017e+03, +2.727978e+03 },
+    { +6.153050e+02, +1.656946e-03, +3.684553e+03, -6.817812e+05, +1.585343e+06, +1.610197e+06, -6.569270e+05, +3.087310e+03, +8.513126e+03, +6.035198e+02, -4.635510e+00, +6.690172e-06, -2.050117e-01, +4.216040e-07, -8.168695e-13, +1.500000e+07, +6.928835e+05, +1.494730e+05, +1.933521e+03, +3.226017e+03, +2.727978e+03 },
+    { +6.200000e+02, +1.106655e-02, +5.396301e+03, -8.480679e+05, +2.497639e+06, +2.663637e+06, -6.820697e+05, +3.281276e+03, +9.968411e+03, +9.036243e+01, -1.136092e+00, +1.465558e-05, +7.269653e-02, -6.320169e-07, +4.941817e-12, +1.500000e+07, +7.751944e+04, +6.823342e+04, -3.006375e+02, +1.158968e+03, -1.569922e+03 },
+    { +6.300000e+02, +1.226193e-02, +5.530755e+03, -9.206711e+05, +2.563705e+06, +2.747634e+06, -7.367422e+05, +2.923974e+03, +7.250644e+03, +8.155325e+01, -6.982422e-01, +1.067373e-05, +2.667333e-02, -2.562541e-07, +2.068302e-12, +1.500000e+07, +6.541686e+04, +9.368792e+04, -1.871587e+02, +1.061649e+03, -1.700845e+03 },
+    { +6.400000e+02, +1.322050e-02, +5.633883e+03, -9.908909e+05, +2.614794e+06, +2.813102e+06, -7.925835e+05, +2.706635e+03, +5.966792e+03, +7.564011e+01, -5.049986e-01, +8.750189e-06, +1.403100e-02, -1.454398e-07, +1.191435e-12, +1.500000e+07, +5.771287e+04, +1.142832e+05, -1.385007e+02, +1.001474e+03, -1.778353e+03 },
+    { +6.500000e+02, +1.404774e-02, +5.719959e+03, -1.060080e+06, +2.657893e+06, +2.868609e+06, -8.493638e+05, +2.551137e+03, +5.190195e+03, +7.118580e+01, -3.946818e-01, +7.571322e-06, +8.676516e-03, -9.590546e-08, +7.906664e-13, +1.500000e+07, +5.212851e+04, +1.320773e+05, -1.091277e+02, +9.540213e+02, -1.821705e+03 },
+    { +6.750000e+02, +1.578854e-02, +5.893280e+03, -1.231454e+06, +2.746510e+06, +2.983338e+06, -9.946255e+05, +2.298122e+03, +4.124292e+03, +6.333709e+01, -2.532846e-01, +5.911042e-06, +3.682442e-03, -4.650830e-08, +3.814851e-13, +1.500000e+07, +4.284940e+04, +1.691749e+05, -6.719133e+01, +8.632378e+02, -1.847079e+03 },
+    { +7.000000e+02, +1.725869e-02, +6.032431e+03, -1.402629e+06, +2.820072e+06, +3.078953e+06, -1.143749e+06, +2.147896e+03, +3.576195e+03, +5.794182e+01, -1.851691e-01, +5.005317e-06, +2.013673e-03, -2.838866e-08, +2.274201e-13, +1.500000e+07, +3.699448e+04, +1.997875e+05, -4.484646e+01, +7.973182e+02, -1.813568e+03 },
+    { +7.250000e+02, +1.857021e-02, +6.151748e+03, -1.574637e+06, +2.885380e+06, +3.163933e+06, -1.296084e+06, +2.052440e+03, +3.247360e+03, +5.384969e+01, -1.452988e-01, +4.417302e-06, +1.262301e-03, -1.956219e-08, +1.512328e-13, +1.500000e+07, +3.289312e+04, +2.263825e+05, -3.146852e+01, +7.476042e+02, -1.754585e+03 },
+    { +7.500000e+02, +1.977689e-02, +6.257983e+03, -1.747881e+06, +2.945606e+06, +3.242260e+06, -1.451228e+06, +1.989852e+03, +3.032878e+03, +5.056406e+01, -1.192042e-01, +3.996369e-06, +8.628535e-04, -1.453178e-08, +1.075027e-13, +1.500000e+07, +2.982813e+04, +2.502271e+05, -2.291795e+01, +7.091105e+02, -1.684312e+03 },
+    { +7.750000e+02, +2.090915e-02, +6.354886e+03, -1.922543e+06, +3.002494e+06, +3.316131e+06, -1.608905e+06, +1.948398e+03, +2.885524e+03, +4.782595e+01, -1.008253e-01, +3.675491e-06, +6.262988e-04, -1.135992e-08, +7.991185e-14, +1.500000e+07, +2.743178e+04, +2.720725e+05, -1.719145e+01, +6.786318e+02, -1.609404e+03 },
+    { +8.000000e+02, +2.198593e-02, +6.444752e+03, -2.098703e+06, +3.057099e+06, +3.386888e+06, -1.768914e+06, +1.921213e+03, +2.780778e+03, +4.548363e+01, -8.718839e-02, +3.419939e-06, +4.750774e-04, -9.212919e-09, +6.132615e-14, +1.500000e+07, +2.549414e+04, +2.924029e+05, -1.321239e+01, +6.540247e+02, -1.533171e+03 },
+    { +8.250000e+02, +2.301987e-02, +6.529096e+03, -2.276395e+06, +3.110109e+06, +3.455407e+06, -1.931097e+06, +1.904036e+03, +2.704650e+03, +4.344073e+01, -7.666879e-02, +3.209767e-06, +3.727067e-04, -7.681086e-09, +4.819175e-14, +1.500000e+07, +2.388609e+04, +3.115491e+05, -1.036213e+01, +6.338177e+02, -1.457311e+03 },
+    { +8.500000e+02, +2.401981e-02, +6.608963e+03, -2.455628e+06, +3.161990e+06, +3.522287e+06, -2.095331e+06, +1.894096e+03, +2.648591e+03, +4.163231e+01, -6.830598e-02, +3.032629e-06, +3.002451e-04, -6.542841e-09, +3.856428e-14, +1.500000e+07, +2.252369e+04, +3.297469e+05, -8.267268e+00, +6.169763e+02, -1.382698e+03 },
+    { +9.000000e+02, +2.594177e-02, +6.758103e+03, -2.818687e+06, +3.263606e+06, +3.652732e+06, -2.429560e+06, +1.889027e+03, +2.576464e+03, +3.854787e+01, -5.584375e-02, +2.747627e-06, +2.069400e-04, -4.981083e-09, +2.569542e-14, +1.500000e+07, +2.032436e+04, +3.639504e+05, -5.488229e+00, +5.906176e+02, -1.238746e+03 },
+    { +9.500000e+02, +2.778673e-02, +6.896265e+03, -3.187760e+06, +3.363691e+06, +3.780492e+06, -2.770959e+06, +1.896755e+03, +2.538239e+03, +3.598840e+01, -4.699622e-02, +2.525451e-06, +1.513208e-04, -3.972548e-09, +1.775935e-14, +1.500000e+07, +1.860904e+04, +3.959688e+05, -3.809301e+00, +5.710439e+02, -1.102580e+03 },
+    { +1.000000e+03, +2.957594e-02, +7.025944e+03, -3.562685e+06, +3.463259e+06, +3.906898e+06, -3.119046e+06, +1.912354e+03, +2.520721e+03, +3.381126e+01, -4.038682e-02, +2.345257e-06, +1.154761e-04, -3.274607e-09, +1.256489e-14, +1.500000e+07, +1.722064e+04, +4.263925e+05, -2.737658e+00, +5.560190e+02, -9.740638e+02 },
+    { +1.050000e+03, +3.132327e-02, +7.148786e+03, -3.943289e+06, +3.562936e+06, +4.032785e+06, -3.473440e+06, +1.932948e+03, +2.516543e+03, +3.192515e+01, -3.526120e-02, +2.194857e-06, +9.100001e-05, -2.766361e-09, +9.015377e-15, +1.500000e+07, +1.606537e+04, +4.556105e+05, -2.023635e+00, +5.441788e+02, -8.526389e+02 },
+    { +1.100000e+03, +3.303822e-02, +7.265936e+03, -4.329403e+06, +3.663126e+06, +4.158700e+06, -3.833830e+06, +1.956737e+03, +2.521256e+03, +3.026797e+01, -3.117110e-02, +2.066578e-06, +7.352685e-05, -2.381540e-09, +6.510383e-15, +1.500000e+07, +1.508344e+04, +4.838918e+05, -1.531222e+00, +5.346472e+02, -7.376514e+02 },
+    { +1.150000e+03, +3.472759e-02, +7.378229e+03, -4.720867e+06, +3.764097e+06, +4.285011e+06, -4.199953e+06, +1.982527e+03, +2.532014e+03, +2.879555e+01, -2.783316e-02, +1.955305e-06, +6.060624e-05, -2.081088e-09, +4.698133e-15, +1.500000e+07, +1.423469e+04, +5.114292e+05, -1.181875e+00, +5.268368e+02, -6.284662e+02 },
+    { +1.200000e+03, +3.639634e-02, +7.486294e+03, -5.117528e+06, +3.866025e+06, +4.411970e+06, -4.571582e+06, +2.009494e+03, +2.546910e+03, +2.747529e+01, -2.505926e-02, +1.857474e-06, +5.077605e-05, -1.840630e-09, +3.361376e-15, +1.500000e+07, +1.349104e+04, +5.383656e+05, -9.280364e-01, +5.203401e+02, -5.245042e+02 },
+    { +1.250000e+03, +3.804826e-02, +7.590615e+03, -5.519244e+06, +3.969025e+06, +4.539749e+06, -4.948520e+06, +2.037052e+03, +2.564620e+03, +2.628241e+01, -2.271950e-02, +1.770510e-06, +4.311947e-05, -1.644239e-09, +2.360156e-15, +1.500000e+07, +1.283218e+04, +5.648090e+05, -7.397723e-01, +5.148659e+02, -4.252511e+02 },
+    { +1.273000e+03, +3.880331e-02, +7.637455e+03, -5.705694e+06, +4.016786e+06, +4.598836e+06, -5.123644e+06, +2.049806e+03, +2.573442e+03, +2.577100e+01, -2.176244e-02, +1.733610e-06, +4.015421e-05, -1.565583e-09, +1.985341e-15, +1.500000e+07, +1.255325e+04, +5.768311e+05, -6.695586e-01, +5.126304e+02, -3.810492e+02 },
+    // P = 17.5 MPa
+    { +2.718300e+02, +9.915735e-04, -1.959125e+01, +6.204394e+01, -5.263445e+03, +1.208909e+04, +1.741458e+04, +4.141451e+03, +4.141802e+03, +1.008498e+03, +2.544371e-02, +4.932727e-07, -1.613624e-02, -3.644122e-09, -1.156964e-15, +1.750000e+07, -5.158142e+04, +2.027276e+06, +3.195673e+04, +1.473152e+04, +9.639593e+03 },
+    { +2.750000e+02, +9.915712e-04, +2.840962e+01, +4.794950e+01, +7.860596e+03, +2.521309e+04, +1.740045e+04, +4.138203e+03, +4.138503e+03, +1.008500e+03, -2.316260e-02, +4.824566e-07, -1.457914e-02, -3.191470e-09, -1.093183e-15, +1.750000e+07, +4.800970e+04, +2.072725e+06, +3.085895e+04, +1.393664e+04, +9.734605e+03 },
+    { +2.800000e+02, +9.918558e-04, +1.029462e+02, -2.860051e+02, +2.853894e+04, +4.589642e+04, +1.707147e+04, +4.130287e+03, +4.135156e+03, +1.008211e+03, -9.096054e-02, +4.680361e-07, -1.262879e-02, -2.598204e-09, -1.018141e-15, +1.750000e+07, +1.943451e+05, +2.136588e+06, +2.922241e+04, +1.276410e+04, +9.930473e+03 },
+    { +2.850000e+02, +9.924523e-04, +1.761199e+02, -9.946619e+02, +4.919952e+04, +6.656743e+04, +1.637325e+04, +4.119606e+03, +4.133484e+03, +1.007605e+03, -1.501929e-01, +4.562920e-07, -1.112627e-02, -2.114964e-09, -9.657139e-16, +1.750000e+07, +3.291595e+05, +2.191579e+06, +2.766480e+04, +1.168497e+04, +1.016529e+04 },
+    { +2.900000e+02, +9.933246e-04, +2.480029e+02, -2.070758e+03, +6.985007e+04, +8.723325e+04, +1.531242e+04, +4.106681e+03, +4.133011e+03, +1.006720e+03, -2.027513e-01, +4.467518e-07, -9.941994e-03, -1.712793e-09, -9.294176e-16, +1.750000e+07, +4.538343e+05, +2.238379e+06, +2.616234e+04, +1.069505e+04, +1.042346e+04 },
+    { +2.950000e+02, +9.944446e-04, +3.186566e+02, -3.507508e+03, +9.049619e+04, +1.078990e+05, +1.389527e+04, +4.091872e+03, +4.133399e+03, +1.005586e+03, -2.499994e-01, +4.390618e-07, -8.990575e-03, -1.372176e-09, -9.050866e-16, +1.750000e+07, +5.693946e+05, +2.277584e+06, +2.470411e+04, +9.791336e+03, +1.069333e+04 },
+    { +3.000000e+02, +9.957904e-04, +3.881348e+02, -5.298516e+03, +1.111419e+05, +1.285683e+05, +1.212782e+04, +4.075438e+03, +4.134403e+03, +1.004227e+03, -2.929472e-01, +4.329505e-07, -8.213798e-03, -1.079387e-09, -8.899727e-16, +1.750000e+07, +6.766297e+05, +2.309733e+06, +2.328659e+04, +8.970941e+03, +1.096634e+04 },
+    { +3.050000e+02, +9.973443e-04, +4.564850e+02, -7.437720e+03, +1.317902e+05, +1.492437e+05, +1.001580e+04, +4.057582e+03, +4.135844e+03, +1.002663e+03, -3.323598e-01, +4.282051e-07, -7.570802e-03, -8.244100e-10, -8.822207e-16, +1.750000e+07, +7.761696e+05, +2.335330e+06, +2.191018e+04, +8.230619e+03, +1.123626e+04 },
+    { +3.100000e+02, +9.990921e-04, +5.237498e+02, -9.919338e+03, +1.524431e+05, +1.699272e+05, +7.564774e+03, +4.038473e+03, +4.137598e+03, +1.000909e+03, -3.688288e-01, +4.246561e-07, -7.032202e-03, -5.997178e-10, -8.805540e-16, +1.750000e+07, +8.685353e+05, +2.354847e+06, +2.057713e+04, +7.566623e+03, +1.149858e+04 },
+    { +3.150000e+02, +1.001022e-03, +5.899684e+02, -1.273784e+04, +1.731022e+05, +1.906201e+05, +4.780050e+03, +4.018260e+03, +4.139581e+03, +9.989787e+02, -4.028195e-01, +4.221672e-07, -6.576433e-03, -3.995062e-10, -8.840829e-16, +1.750000e+07, +9.541707e+05, +2.368730e+06, +1.929030e+04, +6.974731e+03, +1.175005e+04 },
+    { +3.200000e+02, +1.003126e-03, +6.551767e+02, -1.588793e+04, +1.937686e+05, +2.113233e+05, +1.666773e+03, +3.997082e+03, +4.141743e+03, +9.968840e+02, -4.347041e-01, +4.206279e-07, -6.187391e-03, -2.192081e-10, -8.921837e-16, +1.750000e+07, +1.033465e+06, +2.377398e+06, +1.805248e+04, +6.450363e+03, +1.198837e+04 },
+    { +3.250000e+02, +1.005394e-03, +7.194088e+02, -1.936449e+04, +2.144434e+05, +2.320378e+05, -1.770090e+03, +3.975069e+03, +4.144060e+03, +9.946346e+02, -4.647842e-01, +4.199480e-07, -5.852869e-03, -5.516589e-11, -9.044214e-16, +1.750000e+07, +1.106766e+06, +2.381247e+06, +1.686598e+04, +5.988719e+03, +1.221193e+04 },
+    { +3.300000e+02, +1.007822e-03, +7.826967e+02, -2.316262e+04, +2.351273e+05, +2.527642e+05, -5.525741e+03, +3.952344e+03, +4.146528e+03, +9.922388e+02, -4.933079e-01, +4.200541e-07, -5.563493e-03, +9.559526e-11, -9.204993e-16, +1.750000e+07, +1.174391e+06, +2.380646e+06, +1.573252e+04, +5.584906e+03, +1.241961e+04 },
+    { +3.350000e+02, +1.010403e-03, +8.450712e+02, -2.727759e+04, +2.558213e+05, +2.735033e+05, -9.595535e+03, +3.929026e+03, +4.149157e+03, +9.897038e+02, -5.204821e-01, +4.208860e-07, -5.311984e-03, +2.355280e-10, -9.402249e-16, +1.750000e+07, +1.236635e+06, +2.375941e+06, +1.465317e+04, +5.234055e+03, +1.261068e+04 },
+    { +3.400000e+02, +1.013134e-03, +9.065618e+02, -3.170483e+04, +2.765262e+05, +2.942560e+05, -1.397498e+04, +3.905225e+03, +4.151968e+03, +9.870359e+02, -5.464813e-01, +4.223948e-07, -5.092631e-03, +3.666806e-10, -9.634873e-16, +1.750000e+07, +1.293769e+06, +2.367454e+06, +1.362837e+04, +4.931413e+03, +1.278470e+04 },
+    { +3.450000e+02, +1.016012e-03, +9.671973e+02, -3.643993e+04, +2.972431e+05, +3.150233e+05, -1.865973e+04, +3.881046e+03, +4.154989e+03, +9.842407e+02, -5.714544e-01, +4.245410e-07, -4.900916e-03, +4.907852e-10, -9.902416e-16, +1.750000e+07, +1.346052e+06, +2.355485e+06, +1.265802e+04, +4.672408e+03, +1.294143e+04 },
+    { +3.500000e+02, +1.019033e-03, +1.027005e+03, -4.147864e+04, +3.179733e+05, +3.358063e+05, -2.364557e+04, +3.856587e+03, +4.158252e+03, +9.813229e+02, -5.955305e-01, +4.272933e-07, -4.733235e-03, +6.093249e-10, -1.020499e-15, +1.750000e+07, +1.393727e+06, +2.340313e+06, +1.174150e+04, +4.452701e+03, +1.308079e+04 },
+    { +3.550000e+02, +1.022195e-03, +1.086013e+03, -4.681687e+04, +3.387179e+05, +3.566063e+05, -2.892845e+04, +3.831935e+03, +4.161793e+03, +9.782867e+02, -6.188220e-01, +4.306272e-07, -4.586697e-03, +7.235856e-10, -1.054318e-15, +1.750000e+07, +1.437025e+06, +2.322194e+06, +1.087782e+04, +4.268212e+03, +1.320284e+04 },
+    { +3.600000e+02, +1.025498e-03, +1.144248e+03, -5.245064e+04, +3.594786e+05, +3.774248e+05, -3.450442e+04, +3.807174e+03, +4.165646e+03, +9.751358e+02, -6.414287e-01, +4.345240e-07, -4.458967e-03, +8.346973e-10, -1.091804e-15, +1.750000e+07, +1.476164e+06, +2.301369e+06, +1.006567e+04, +4.115142e+03, +1.330771e+04 },
+    { +3.650000e+02, +1.028941e-03, +1.201734e+03, -5.837614e+04, +3.802569e+05, +3.982634e+05, -4.036968e+04, +3.782375e+03, +4.169848e+03, +9.718734e+02, -6.634398e-01, +4.389706e-07, -4.348153e-03, +9.436669e-10, -1.133100e-15, +1.750000e+07, +1.511354e+06, +2.278057e+06, +9.303451e+03, +3.989974e+03, +1.339560e+04 },
+    { +3.700000e+02, +1.032522e-03, +1.258499e+03, -6.458970e+04, +4.010548e+05, +4.191239e+05, -4.652056e+04, +3.757606e+03, +4.174435e+03, +9.685023e+02, -6.849359e-01, +4.439586e-07, -4.252719e-03, +1.051405e-09, -1.178394e-15, +1.750000e+07, +1.542792e+06, +2.252462e+06, +8.589412e+03, +3.889475e+03, +1.346677e+04 },
+    { +3.750000e+02, +1.036243e-03, +1.314565e+03, -7.108775e+04, +4.218742e+05, +4.400084e+05, -5.295350e+04, +3.732924e+03, +4.179441e+03, +9.650248e+02, -7.059906e-01, +4.494840e-07, -4.171414e-03, +1.158749e-09, -1.227912e-15, +1.750000e+07, +1.570669e+06, +2.224773e+06, +7.921649e+03, +3.810687e+03, +1.352150e+04 },
+    { +3.800000e+02, +1.040103e-03, +1.369958e+03, -7.786690e+04, +4.427173e+05, +4.609191e+05, -5.966509e+04, +3.708382e+03, +4.184901e+03, +9.614430e+02, -7.266719e-01, +4.555467e-07, -4.103224e-03, +1.266478e-09, -1.281923e-15, +1.750000e+07, +1.595164e+06, +2.195165e+06, +7.298174e+03, +3.750913e+03, +1.356011e+04 },
+    { +3.850000e+02, +1.044104e-03, +1.424702e+03, -8.492383e+04, +4.635864e+05, +4.818582e+05, -6.665201e+04, +3.684022e+03, +4.190846e+03, +9.577586e+02, -7.470433e-01, +4.621506e-07, -4.047329e-03, +1.375336e-09, -1.340740e-15, +1.750000e+07, +1.616450e+06, +2.163797e+06, +6.716946e+03, +3.707706e+03, +1.358295e+04 },
+    { +3.900000e+02, +1.048248e-03, +1.478819e+03, -9.225540e+04, +4.844841e+05, +5.028284e+05, -7.391106e+04, +3.659886e+03, +4.197308e+03, +9.539730e+02, -7.671646e-01, +4.693031e-07, -4.003074e-03, +1.486037e-09, -1.404724e-15, +1.750000e+07, +1.634689e+06, +2.130819e+06, +6.175908e+03, +3.678851e+03, +1.359035e+04 },
+    { +3.950000e+02, +1.052535e-03, +1.532333e+03, -9.985855e+04, +5.054129e+05, +5.238322e+05, -8.143919e+04, +3.636005e+03, +4.204320e+03, +9.500872e+02, -7.870926e-01, +4.770152e-07, -3.969944e-03, +1.599286e-09, -1.474288e-15, +1.750000e+07, +1.650037e+06, +2.096369e+06, +5.673008e+03, +3.662349e+03, +1.358269e+04 },
+    { +4.000000e+02, +1.056968e-03, +1.585265e+03, -1.077304e+05, +5.263756e+05, +5.448726e+05, -8.923342e+04, +3.612407e+03, +4.211911e+03, +9.461023e+02, -8.068819e-01, +4.853014e-07, -3.947545e-03, +1.715785e-09, -1.549902e-15, +1.750000e+07, +1.662641e+06, +2.060575e+06, +5.206223e+03, +3.656398e+03, +1.356031e+04 },
+    { +4.100000e+02, +1.066284e-03, +1.689472e+03, -1.242689e+05, +5.684148e+05, +5.870748e+05, -1.056089e+05, +3.566154e+03, +4.228957e+03, +9.378365e+02, -8.462549e-01, +5.036717e-07, -3.933896e-03, +1.961400e-09, -1.721482e-15, +1.750000e+07, +1.680172e+06, +1.985420e+06, +4.373130e+03, +3.669845e+03, +1.347286e+04 },
+    { +4.200000e+02, +1.076221e-03, +1.791611e+03, -1.418498e+05, +6.106268e+05, +6.294607e+05, -1.230160e+05, +3.521268e+03, +4.248698e+03, +9.291769e+02, -8.856954e-01, +5.246023e-07, -3.960976e-03, +2.228898e-09, -1.924643e-15, +1.750000e+07, +1.688318e+06, +1.906206e+06, +3.661506e+03, +3.708151e+03, +1.333091e+04 },
+    { +4.300000e+02, +1.086814e-03, +1.891845e+03, -1.604540e+05, +6.530394e+05, +6.720586e+05, -1.414348e+05, +3.477842e+03, +4.271405e+03, +9.201210e+02, -9.256108e-01, +5.483448e-07, -4.029023e-03, +2.524987e-09, -2.166041e-15, +1.750000e+07, +1.688009e+06, +1.823670e+06, +3.057349e+03, +3.762474e+03, +1.313728e+04 },
+    { +4.400000e+02, +1.098103e-03, +1.990333e+03, -1.800639e+05, +6.956829e+05, +7.148997e+05, -1.608471e+05, +3.435928e+03, +4.297381e+03, +9.106618e+02, -9.664176e-01, +5.752232e-07, -4.139623e-03, +2.857477e-09, -2.454268e-15, +1.750000e+07, +1.680074e+06, +1.738456e+06, +2.547906e+03, +3.825763e+03, +1.289475e+04 },
+    { +4.500000e+02, +1.110139e-03, +2.087232e+03, -2.006636e+05, +7.385909e+05, +7.580183e+05, -1.812361e+05, +3.395553e+03, +4.326976e+03, +9.007882e+02, -1.008555e+00, +6.056468e-07, -4.295800e-03, +3.235783e-09, -2.800507e-15, +1.750000e+07, +1.665253e+06, +1.651127e+06, +2.121697e+03, +3.892413e+03, +1.260603e+04 },
+    { +4.600000e+02, +1.122984e-03, +2.182695e+03, -2.222391e+05, +7.818004e+05, +8.014526e+05, -2.025869e+05, +3.356727e+03, +4.360607e+03, +8.904846e+02, -1.052501e+00, +6.401302e-07, -4.502238e-03, +3.671586e-09, -3.219462e-15, +1.750000e+07, +1.644198e+06, +1.562182e+06, +1.768487e+03, +3.957979e+03, +1.227378e+04 },
+    { +4.700000e+02, +1.136712e-03, +2.276875e+03, -2.447782e+05, +8.253531e+05, +8.452455e+05, -2.248858e+05, +3.319448e+03, +4.398777e+03, +8.797304e+02, -1.098789e+00, +6.793192e-07, -4.765678e-03, +4.179732e-09, -3.730708e-15, +1.750000e+07, +1.617486e+06, +1.472062e+06, +1.479229e+03, +4.018936e+03, +1.190062e+04 },
+    { +4.800000e+02, +1.151412e-03, +2.369929e+03, -2.682704e+05, +8.692957e+05, +8.894454e+05, -2.481207e+05, +3.283711e+03, +4.442106e+03, +8.684990e+02, -1.148035e+00, +7.240296e-07, -5.095535e-03, +4.779530e-09, -4.360698e-15, +1.750000e+07, +1.585619e+06, +1.381159e+06, +1.245976e+03, +4.072492e+03, +1.148913e+04 },
+    { +4.900000e+02, +1.167192e-03, +2.462017e+03, -2.927070e+05, +9.136816e+05, +9.341074e+05, -2.722811e+05, +3.249516e+03, +4.491372e+03, +8.567574e+02, -1.200965e+00, +7.752999e-07, -5.504862e-03, +5.496647e-09, -5.145786e-15, +1.750000e+07, +1.549032e+06, +1.289824e+06, +1.061799e+03, +4.116425e+03, +1.104187e+04 },
+    { +5.000000e+02, +1.184182e-03, +2.553308e+03, -3.180815e+05, +9.585726e+05, +9.792958e+05, -2.973584e+05, +3.216874e+03, +4.547555e+03, +8.444645e+02, -1.258457e+00, +8.344685e-07, -6.011821e-03, +6.365990e-09, -6.136923e-15, +1.750000e+07, +1.508094e+06, +1.198368e+06, +9.207018e+02, +4.148950e+03, +1.056138e+04 },
+    { +5.100000e+02, +1.202545e-03, +2.643982e+03, -3.443898e+05, +1.004041e+06, +1.025086e+06, -3.233452e+05, +3.185809e+03, +4.611924e+03, +8.315694e+02, -1.321610e+00, +9.032869e-07, -6.641999e-03, +7.436196e-09, -7.407140e-15, +1.750000e+07, +1.463113e+06, +1.107068e+06, +8.175344e+02, +4.168611e+03, +1.005017e+04 },
+    { +5.200000e+02, +1.222481e-03, +2.734238e+03, -3.716300e+05, +1.050174e+06, +1.071567e+06, -3.502366e+05, +3.156376e+03, +4.686138e+03, +8.180088e+02, -1.391829e+00, +9.840904e-07, -7.432125e-03, +8.776881e-09, -9.063866e-15, +1.750000e+07, +1.414330e+06, +1.016167e+06, +7.479289e+02, +4.174179e+03, +9.510612e+03 },
+    { +5.300000e+02, +1.244240e-03, +2.824298e+03, -3.998035e+05, +1.097075e+06, +1.118849e+06, -3.780293e+05, +3.128665e+03, +4.772428e+03, +8.037032e+02, -1.470963e+00, +1.080063e-06, -8.436208e-03, +1.049076e-08, -1.126998e-14, +1.750000e+07, +1.361924e+06, +9.258721e+05, +7.082435e+02, +4.164550e+03, +8.944915e+03 },
+    { +5.400000e+02, +1.268148e-03, +2.914424e+03, -4.289154e+05, +1.144873e+06, +1.167066e+06, -4.067228e+05, +3.102819e+03, +4.873856e+03, +7.885515e+02, -1.561534e+00, +1.195663e-06, -9.736086e-03, +1.273477e-08, -1.428134e-14, +1.750000e+07, +1.305998e+06, +8.363562e+05, +6.955333e+02, +4.138639e+03, +8.354928e+03 },
+    { +5.500000e+02, +1.294628e-03, +3.004927e+03, -4.589751e+05, +1.193735e+06, +1.216391e+06, -4.363191e+05, +3.079064e+03, +4.994771e+03, +7.724228e+02, -1.667091e+00, +1.337340e-06, -1.146038e-02, +1.575870e-08, -1.851716e-14, +1.750000e+07, +1.246572e+06, +7.477529e+05, +7.075624e+02, +4.095251e+03, +7.741920e+03 },
+    { +5.600000e+02, +1.324253e-03, +3.096198e+03, -4.899983e+05, +1.243873e+06, +1.267047e+06, -4.668239e+05, +3.057742e+03, +5.141567e+03, +7.551427e+02, -1.792845e+00, +1.514795e-06, -1.382054e-02, +1.998026e-08, -2.470030e-14, +1.750000e+07, +1.183556e+06, +6.601553e+05, +7.428900e+02, +4.032906e+03, +7.106250e+03 },
+    { +5.700000e+02, +1.357824e-03, +3.188750e+03, -5.220092e+05, +1.295578e+06, +1.319340e+06, -4.982473e+05, +3.039392e+03, +5.324089e+03, +7.364723e+02, -1.946814e+00, +1.743341e-06, -1.718440e-02, +2.614153e-08, -3.415855e-14, +1.750000e+07, +1.116714e+06, +5.736112e+05, +8.011111e+02, +3.949614e+03, +6.446920e+03 },
+    { +5.800000e+02, +1.396512e-03, +3.283286e+03, -5.550444e+05, +1.349261e+06, +1.373700e+06, -5.306054e+05, +3.024882e+03, +5.558393e+03, +7.160697e+02, -2.142101e+00, +2.048682e-06, -2.224101e-02, +3.566770e-08, -4.953647e-14, +1.750000e+07, +1.045600e+06, +4.881187e+05, +8.834410e+02, +3.842561e+03, +5.761044e+03 },
+    { +5.900000e+02, +1.442132e-03, +3.380840e+03, -5.891603e+05, +1.405535e+06, +1.430772e+06, -5.639230e+05, +3.015694e+03, +5.872755e+03, +6.934177e+02, -2.401852e+00, +2.477623e-06, -3.042030e-02, +5.159958e-08, -7.670586e-14, +1.750000e+07, +9.694180e+05, +4.036127e+05, +9.941565e+02, +3.707752e+03, +5.043395e+03 },
+    { +6.000000e+02, +1.497744e-03, +3.483064e+03, -6.244482e+05, +1.465390e+06, +1.491601e+06, -5.982377e+05, +3.014611e+03, +6.322812e+03, +6.676711e+02, -2.771836e+00, +3.125859e-06, -4.518586e-02, +8.151031e-08, -1.309263e-13, +1.750000e+07, +8.867438e+05, +3.199121e+05, +1.144516e+03, +3.539843e+03, +4.286659e+03 },
+    { +6.100000e+02, +1.569190e-03, +3.592956e+03, -6.610703e+05, +1.530633e+06, +1.558094e+06, -6.336095e+05, +3.027755e+03, +7.039657e+03, +6.372713e+02, -3.360826e+00, +4.228857e-06, -7.741988e-02, +1.497636e-07, -2.634582e-13, +1.750000e+07, +7.947363e+05, +2.364705e+05, +1.365964e+03, +3.333637e+03, +3.483715e+03 },
+    { +6.200000e+02, +1.670519e-03, +3.717326e+03, -6.993778e+05, +1.605365e+06, +1.634599e+06, -6.701437e+05, +3.073363e+03, +8.460200e+03, +5.986163e+02, -4.537855e+00, +6.613966e-06, -1.830559e-01, +3.850558e-07, -7.585768e-13, +1.750000e+07, +6.861019e+05, +1.511952e+05, +1.779576e+03, +3.095361e+03, +2.621885e+03 },
+    { +6.278210e+02, +1.802898e-03, +3.839376e+03, -7.312204e+05, +1.679221e+06, +1.710771e+06, -6.996697e+05, +3.192588e+03, +1.174315e+04, +5.546625e+02, -7.339001e+00, +1.285458e-05, -7.324967e-01, +1.707543e-06, -3.845599e-12, +1.750000e+07, +5.709252e+05, +7.779331e+04, +2.818657e+03, +2.953316e+03, +1.810467e+03 },
+    { +6.278210e+02, +1.802898e-03, +3.839376e+03, -7.312204e+05, +1.679221e+06, +1.710771e+06, -6.996697e+05, +3.192588e+03, +1.174315e+04, +5.546625e+02, -7.339001e+00, +1.285458e-05, -7.324967e-01, +1.707543e-06, -3.845599e-12, +1.750000e+07, +5.709252e+05, +7.779331e+04, +2.818657e+03, +2.953316e+03, +1.810467e+03 },
+    { +6.300000e+02, +8.364023e-03, +5.204836e+03, -8.573170e+05, +2.421729e+06, +2.568100e+06, -7.109465e+05, +3.624898e+03, +1.583337e+04, +1.195597e+02, -2.569617e+00, +2.383674e-05, +3.198908e-01, -2.205551e-06, +1.433223e-11, +1.750000e+07, +1.078007e+05, +4.195205e+04, -4.583453e+02, +1.162511e+03, -1.058213e+03 },
+    { +6.400000e+02, +9.739865e-03, +5.389572e+03, -9.344498e+05, +2.514876e+06, +2.685324e+06, -7.640022e+05, +3.112479e+03, +9.249625e+03, +1.026708e+02, -1.177890e+00, +1.372553e-05, +6.253597e-02, -4.892469e-07, +3.358311e-12, +1.750000e+07, +8.581747e+04, +7.285692e+04, -2.401991e+02, +1.067174e+03, -1.298773e+03 },
+    { +6.500000e+02, +1.072679e-02, +5.514257e+03, -1.006269e+06, +2.577998e+06, +2.765717e+06, -8.185503e+05, +2.848351e+03, +7.098799e+03, +9.322453e+01, -7.685831e-01, +1.039441e-05, +2.688856e-02, -2.294128e-07, +1.615705e-12, +1.750000e+07, +7.394194e+04, +9.620552e+04, -1.727675e+02, +1.017591e+03, -1.438673e+03 },
+    { +6.750000e+02, +1.258307e-02, +5.734788e+03, -1.179548e+06, +2.691434e+06, +2.911638e+06, -9.593443e+05, +2.475752e+03, +4.956764e+03, +7.947183e+01, -4.052019e-01, +7.072800e-06, +7.852216e-03, -7.856315e-08, +5.652961e-13, +1.750000e+07, +5.729017e+04, +1.413867e+05, -9.979344e+01, +9.230924e+02, -1.597724e+03 },
+    { +7.000000e+02, +1.403898e-02, +5.897074e+03, -1.350504e+06, +2.777448e+06, +3.023130e+06, -1.104822e+06, +2.269890e+03, +4.063753e+03, +7.123027e+01, -2.711280e-01, +5.653644e-06, +3.654646e-03, -4.134668e-08, +2.952762e-13, +1.750000e+07, +4.795633e+04, +1.768771e+05, -6.510038e+01, +8.505377e+02, -1.633966e+03 },
+    { +7.250000e+02, +1.529139e-02, +6.030384e+03, -1.521560e+06, +2.850469e+06, +3.118068e+06, -1.253960e+06, +2.142055e+03, +3.573668e+03, +6.539626e+01, -2.020250e-01, +4.833000e-06, +2.087652e-03, -2.618289e-08, +1.825771e-13, +1.750000e+07, +4.180117e+04, +2.069108e+05, -4.504962e+01, +7.942053e+02, -1.617320e+03 },
+    { +7.500000e+02, +1.641838e-02, +6.146031e+03, -1.693517e+06, +2.916006e+06, +3.203328e+06, -1.406195e+06, +2.058634e+03, +3.268977e+03, +6.090735e+01, -1.601673e-01, +4.285101e-06, +1.341740e-03, -1.840293e-08, +1.239310e-13, +1.750000e+07, +3.737771e+04, +2.333667e+05, -3.247618e+01, +7.499513e+02, -1.575058e+03 },
+    { +7.750000e+02, +1.745997e-02, +6.249693e+03, -1.866712e+06, +2.976800e+06, +3.282349e+06, -1.561163e+06, +2.002920e+03, +3.065437e+03, +5.727385e+01, -1.322101e-01, +3.886714e-06, +9.316434e-04, -1.383131e-08, +8.923555e-14, +1.750000e+07, +3.401592e+04, +2.572868e+05, -2.416620e+01, +7.146491e+02, -1.519813e+03 },
+    { +8.000000e+02, +1.843969e-02, +6.344641e+03, -2.041302e+06, +3.034410e+06, +3.357105e+06, -1.718608e+06, +1.965533e+03, +2.923070e+03, +5.423083e+01, -1.122612e-01, +3.580152e-06, +6.832974e-04, -1.089121e-08, +6.690564e-14, +1.750000e+07, +3.135656e+04, +2.793178e+05, -1.845167e+01, +6.860376e+02, -1.458003e+03 },
+    { +8.250000e+02, +1.937259e-02, +6.432934e+03, -2.217360e+06, +3.089811e+06, +3.428831e+06, -1.878339e+06, +1.940798e+03, +2.820386e+03, +5.161932e+01, -9.732929e-02, +3.334550e-06, +5.220264e-04, -8.874086e-09, +5.165237e-14, +1.750000e+07, +2.918813e+04, +2.998905e+05, -1.439341e+01, +6.624966e+02, -1.393087e+03 },
+    { +8.500000e+02, +2.026889e-02, +6.515952e+03, -2.394916e+06, +3.143643e+06, +3.498349e+06, -2.040210e+06, +1.925102e+03, +2.744811e+03, +4.933668e+01, -8.574058e-02, +3.131787e-06, +4.115988e-04, -7.421171e-09, +4.076155e-14, +1.750000e+07, +2.737752e+04, +3.193065e+05, -1.143251e+01, +6.428591e+02, -1.327009e+03 },
+    { +9.000000e+02, +2.197889e-02, +6.669784e+03, -2.754544e+06, +3.248261e+06, +3.632892e+06, -2.369914e+06, +1.911972e+03, +2.646344e+03, +4.549820e+01, -6.893143e-02, +2.813020e-06, +2.745673e-04, -5.495731e-09, +2.660865e-14, +1.750000e+07, +2.450442e+04, +3.554898e+05, -7.538321e+00, +6.121132e+02, -1.195376e+03 },
+    { +9.500000e+02, +2.360833e-02, +6.811247e+03, -3.120130e+06, +3.350555e+06, +3.763701e+06, -2.706984e+06, +1.914438e+03, +2.591505e+03, +4.235792e+01, -5.733007e-02, +2.570322e-06, +1.960747e-04, -4.297481e-09, +1.812787e-14, +1.750000e+07, +2.230462e+04, +3.890562e+05, -5.207869e+00, +5.892851e+02, -1.067539e+03 },
+    { +1.000000e+03, +2.518016e-02, +6.943356e+03, -3.491536e+06, +3.451820e+06, +3.892473e+06, -3.050883e+06, +1.926403e+03, +2.562765e+03, +3.971381e+01, -4.884193e-02, +2.376832e-06, +1.469769e-04, -3.490833e-09, +1.268799e-14, +1.750000e+07, +2.054917e+04, +4.207280e+05, -3.730702e+00, +5.717676e+02, -9.449243e+02 },
+    { +1.050000e+03, +2.670906e-02, +7.068046e+03, -3.868605e+06, +3.552844e+06, +4.020252e+06, -3.401196e+06, +1.944381e+03, +2.550613e+03, +3.744048e+01, -4.236327e-02, +2.217415e-06, +1.142229e-04, -2.915916e-09, +9.025648e-15, +1.750000e+07, +1.910480e+04, +4.509755e+05, -2.751521e+00, +5.579666e+02, -8.278225e+02 },
+    { +1.100000e+03, +2.820498e-02, +7.186639e+03, -4.251174e+06, +3.654129e+06, +4.147716e+06, -3.757586e+06, +1.966223e+03, +2.549438e+03, +3.545473e+01, -3.725777e-02, +2.082809e-06, +9.127327e-05, -2.488057e-09, +6.470093e-15, +1.750000e+07, +1.788823e+04, +4.801209e+05, -2.078789e+00, +5.468577e+02, -7.160815e+02 },
+    { +1.150000e+03, +2.967497e-02, +7.300081e+03, -4.639086e+06, +3.756008e+06, +4.275320e+06, -4.119774e+06, +1.990524e+03, +2.555714e+03, +3.369844e+01, -3.313277e-02, +1.966978e-06, +7.456110e-05, -2.158693e-09, +4.637534e-15, +1.750000e+07, +1.684450e+04, +5.083941e+05, -1.602835e+00, +5.377550e+02, -6.093804e+02 },
+    { +1.200000e+03, +3.112413e-02, +7.409078e+03, -5.032193e+06, +3.858700e+06, +4.403373e+06, -4.487520e+06, +2.016329e+03, +2.567114e+03, +3.212941e+01, -2.973277e-02, +1.865797e-06, +6.200758e-05, -1.898185e-09, +3.295327e-15, +1.750000e+07, +1.593569e+04, +5.359639e+05, -1.257708e+00, +5.301827e+02, -5.073470e+02 },
+    { +1.250000e+03, +3.255633e-02, +7.514165e+03, -5.430353e+06, +3.962354e+06, +4.532089e+06, -4.860617e+06, +2.042963e+03, +2.582042e+03, +3.071600e+01, -2.688424e-02, +1.776332e-06, +5.233463e-05, -1.687527e-09, +2.295835e-15, +1.750000e+07, +1.513469e+04, +5.629578e+05, -1.002119e+00, +5.238016e+02, -4.096078e+02 },
+    { +1.273000e+03, +3.321027e-02, +7.561312e+03, -5.615166e+06, +4.010385e+06, +4.591564e+06, -5.033986e+06, +2.055354e+03, +2.589770e+03, +3.011116e+01, -2.572410e-02, +1.738497e-06, +4.861467e-05, -1.603701e-09, +1.923061e-15, +1.750000e+07, +1.479674e+04, +5.752095e+05, -9.068782e-01, +5.211953e+02, -3.659917e+02 },
+    // P = 20.0 MPa
+    { +2.716330e+02, +9.903695e-04, -2.253498e+01, +8.046815e+01, -6.040776e+03, +1.376661e+04, +1.988786e+04, +4.131132e+03, +4.131339e+03, +1.009724e+03, +1.951775e-02, +4.911010e-07, -1.585924e-02, -3.617714e-09, -1.152642e-15, +2.000000e+07, -3.974284e+04, +2.036241e+06, +3.171140e+04, +1.481011e+04, +9.731543e+03 },
+    { +2.750000e+02, +9.903900e-04, +2.834301e+01, +7.009381e+01, +7.864422e+03, +2.767222e+04, +1.987789e+04, +4.128227e+03, +4.128770e+03, +1.009703e+03, -3.108558e-02, +4.797338e-07, -1.425243e-02, -3.146978e-09, -1.085074e-15, +2.000000e+07, +6.479755e+04, +2.084489e+06, +3.056867e+04, +1.397943e+04, +9.827845e+03 },
+    { +2.800000e+02, +9.907091e-04, +1.027148e+02, -2.645071e+02, +2.849565e+04, +4.830983e+04, +1.954968e+04, +4.120946e+03, +4.126549e+03, +1.009378e+03, -9.741711e-02, +4.655002e-07, -1.236537e-02, -2.567076e-09, -1.010542e-15, +2.000000e+07, +2.092740e+05, +2.148227e+06, +2.896685e+04, +1.282270e+04, +1.001831e+04 },
+    { +2.850000e+02, +9.913330e-04, +1.757440e+02, -9.736759e+02, +4.911337e+04, +6.894003e+04, +1.885298e+04, +4.110817e+03, +4.125728e+03, +1.008743e+03, -1.554531e-01, +4.538871e-07, -1.090885e-02, -2.093204e-09, -9.582349e-16, +2.000000e+07, +3.424928e+05, +2.203191e+06, +2.744088e+04, +1.175356e+04, +1.024775e+04 },
+    { +2.900000e+02, +9.922266e-04, +2.474980e+02, -2.050173e+03, +6.972425e+04, +8.956878e+04, +1.779436e+04, +4.098382e+03, +4.125913e+03, +1.007834e+03, -2.070146e-01, +4.444378e-07, -9.759113e-03, -1.697863e-09, -9.218223e-16, +2.000000e+07, +4.657899e+05, +2.250034e+06, +2.596720e+04, +1.076947e+04, +1.050060e+04 },
+    { +2.950000e+02, +9.933631e-04, +3.180350e+02, -3.487231e+03, +9.033309e+04, +1.102004e+05, +1.638003e+04, +4.084017e+03, +4.126814e+03, +1.006681e+03, -2.534177e-01, +4.368090e-07, -8.834326e-03, -1.362420e-09, -8.972270e-16, +2.000000e+07, +5.801569e+05, +2.289330e+06, +2.453510e+04, +9.868616e+03, +1.076534e+04 },
+    { +3.000000e+02, +9.947210e-04, +3.874061e+02, -5.278467e+03, +1.109434e+05, +1.308378e+05, +1.461595e+04, +4.067990e+03, +4.128223e+03, +1.005307e+03, -2.956386e-01, +4.307359e-07, -8.078483e-03, -1.073696e-09, -8.817507e-16, +2.000000e+07, +6.863569e+05, +2.321608e+06, +2.314119e+04, +9.048997e+03, +1.103348e+04 },
+    { +3.050000e+02, +9.962833e-04, +4.556568e+02, -7.417828e+03, +1.315575e+05, +1.514832e+05, +1.250784e+04, +4.050512e+03, +4.129985e+03, +1.003731e+03, -3.344179e-01, +4.260104e-07, -7.452185e-03, -8.220266e-10, -8.735651e-16, +2.000000e+07, +7.849993e+05, +2.347361e+06, +2.178604e+04, +8.307992e+03, +1.129886e+04 },
+    { +3.100000e+02, +9.980362e-04, +5.228285e+02, -9.899542e+03, +1.521773e+05, +1.721380e+05, +1.006118e+04, +4.031755e+03, +4.131994e+03, +1.001968e+03, -3.703286e-01, +4.224661e-07, -6.927046e-03, -6.001148e-10, -8.714074e-16, +2.000000e+07, +8.765877e+05, +2.367054e+06, +2.047205e+04, +7.642301e+03, +1.155701e+04 },
+    { +3.150000e+02, +9.999687e-04, +5.889591e+02, -1.271809e+04, +1.728040e+05, +1.928034e+05, +7.281287e+03, +4.011872e+03, +4.134177e+03, +1.000031e+03, -4.038219e-01, +4.199691e-07, -6.482212e-03, -4.023141e-10, -8.743940e-16, +2.000000e+07, +9.615514e+05, +2.381127e+06, +1.920225e+04, +7.048025e+03, +1.180470e+04 },
+    { +3.200000e+02, +1.002071e-03, +6.540836e+02, -1.586816e+04, +1.934386e+05, +2.134800e+05, +4.173268e+03, +3.991004e+03, +4.136496e+03, +9.979328e+02, -4.352584e-01, +4.184103e-07, -6.102093e-03, -2.241673e-10, -8.819024e-16, +2.000000e+07, +1.040267e+06, +2.389999e+06, +1.797957e+04, +6.520818e+03, +1.203964e+04 },
+    { +3.250000e+02, +1.004337e-03, +7.182353e+02, -1.934467e+04, +2.140818e+05, +2.341686e+05, +7.420722e+02, +3.969284e+03, +4.138934e+03, +9.956817e+02, -4.649308e-01, +4.177007e-07, -5.774868e-03, -6.209600e-11, -8.934961e-16, +2.000000e+07, +1.113072e+06, +2.394059e+06, +1.680649e+04, +6.056043e+03, +1.226019e+04 },
+    { +3.300000e+02, +1.006759e-03, +7.814457e+02, -2.314270e+04, +2.347344e+05, +2.548696e+05, -3.007516e+03, +3.946836e+03, +4.141490e+03, +9.932861e+02, -4.930800e-01, +4.177674e-07, -5.491458e-03, +8.681535e-11, -9.088744e-16, +2.000000e+07, +1.180274e+06, +2.393676e+06, +1.568488e+04, +5.648928e+03, +1.246523e+04 },
+    { +3.350000e+02, +1.009333e-03, +8.437449e+02, -2.725753e+04, +2.553970e+05, +2.755837e+05, -7.070866e+03, +3.923779e+03, +4.144182e+03, +9.907531e+02, -5.199066e-01, +4.185509e-07, -5.244807e-03, +2.249740e-10, -9.278398e-16, +2.000000e+07, +1.242158e+06, +2.389195e+06, +1.461595e+04, +5.294692e+03, +1.265401e+04 },
+    { +3.400000e+02, +1.012055e-03, +9.051622e+02, -3.168459e+04, +2.760705e+05, +2.963116e+05, -1.144350e+04, +3.900227e+03, +4.147031e+03, +9.880889e+02, -5.455800e-01, +4.200026e-07, -5.029382e-03, +3.543921e-10, -9.502750e-16, +2.000000e+07, +1.298992e+06, +2.380938e+06, +1.360028e+04, +4.988642e+03, +1.282606e+04 },
+    { +3.450000e+02, +1.014920e-03, +9.657257e+02, -3.641947e+04, +2.967559e+05, +3.170543e+05, -1.612107e+04, +3.876284e+03, +4.150068e+03, +9.852990e+02, -5.702451e-01, +4.220831e-07, -4.840803e-03, +4.767721e-10, -9.761280e-16, +2.000000e+07, +1.351025e+06, +2.369201e+06, +1.263788e+04, +4.726253e+03, +1.298114e+04 },
+    { +3.500000e+02, +1.017928e-03, +1.025463e+03, -4.145793e+04, +3.174541e+05, +3.378127e+05, -2.109938e+04, +3.852049e+03, +4.153328e+03, +9.823879e+02, -5.940269e-01, +4.247610e-07, -4.675576e-03, +5.935713e-10, -1.005401e-15, +2.000000e+07, +1.398497e+06, +2.354265e+06, +1.172828e+04, +4.503215e+03, +1.311914e+04 },
+    { +3.550000e+02, +1.021075e-03, +1.084401e+03, -4.679586e+04, +3.381665e+05, +3.585880e+05, -2.637436e+04, +3.827611e+03, +4.156847e+03, +9.793600e+02, -6.170351e-01, +4.280117e-07, -4.530896e-03, +7.060530e-10, -1.038145e-15, +2.000000e+07, +1.441631e+06, +2.336385e+06, +1.087058e+04, +4.315474e+03, +1.324009e+04 },
+    { +3.600000e+02, +1.024361e-03, +1.142566e+03, -5.242931e+04, +3.588944e+05, +3.793817e+05, -3.194210e+04, +3.803052e+03, +4.160661e+03, +9.762187e+02, -6.393663e-01, +4.318162e-07, -4.404497e-03, +8.153261e-10, -1.074451e-15, +2.000000e+07, +1.480645e+06, +2.315800e+06, +1.006356e+04, +4.159242e+03, +1.334412e+04 },
+    { +3.650000e+02, +1.027784e-03, +1.199983e+03, -5.835445e+04, +3.796395e+05, +4.001952e+05, -3.779878e+04, +3.778447e+03, +4.164808e+03, +9.729673e+02, -6.611074e-01, +4.361612e-07, -4.294543e-03, +9.223775e-10, -1.114455e-15, +2.000000e+07, +1.515741e+06, +2.292730e+06, +9.305730e+03, +4.031016e+03, +1.343140e+04 },
+    { +3.700000e+02, +1.031344e-03, +1.256679e+03, -6.456761e+04, +4.004035e+05, +4.210304e+05, -4.394073e+04, +3.753861e+03, +4.169322e+03, +9.696085e+02, -6.823367e-01, +4.410378e-07, -4.199537e-03, +1.028098e-09, -1.158327e-15, +2.000000e+07, +1.547116e+06, +2.267379e+06, +8.595403e+03, +3.927567e+03, +1.350217e+04 },
+    { +3.750000e+02, +1.035042e-03, +1.312676e+03, -7.106523e+04, +4.211882e+05, +4.418891e+05, -5.036440e+04, +3.729354e+03, +4.174240e+03, +9.661447e+02, -7.031257e-01, +4.464414e-07, -4.118263e-03, +1.133304e-09, -1.206280e-15, +2.000000e+07, +1.574956e+06, +2.239936e+06, +7.930754e+03, +3.845942e+03, +1.355673e+04 },
+    { +3.800000e+02, +1.038877e-03, +1.368000e+03, -7.784391e+04, +4.419959e+05, +4.627735e+05, -5.706637e+04, +3.704978e+03, +4.179594e+03, +9.625779e+02, -7.235405e-01, +4.523713e-07, -4.049730e-03, +1.238756e-09, -1.258565e-15, +2.000000e+07, +1.599440e+06, +2.210574e+06, +7.309860e+03, +3.783444e+03, +1.359536e+04 },
+    { +3.850000e+02, +1.042851e-03, +1.422673e+03, -8.490033e+04, +4.628288e+05, +4.836858e+05, -6.404331e+04, +3.680777e+03, +4.185418e+03, +9.589098e+02, -7.436429e-01, +4.588305e-07, -3.993135e-03, +1.345172e-09, -1.315476e-15, +2.000000e+07, +1.620735e+06, +2.179454e+06, +6.730738e+03, +3.737628e+03, +1.361840e+04 },
+    { +3.900000e+02, +1.046965e-03, +1.476719e+03, -9.223135e+04, +4.836892e+05, +5.046285e+05, -7.129205e+04, +3.656792e+03, +4.191742e+03, +9.551419e+02, -7.634907e-01, +4.658257e-07, -3.947832e-03, +1.453246e-09, -1.377351e-15, +2.000000e+07, +1.639005e+06, +2.146726e+06, +6.191384e+03, +3.706277e+03, +1.362618e+04 },
+    { +3.950000e+02, +1.051221e-03, +1.530161e+03, -9.983391e+04, +5.045797e+05, +5.256041e+05, -7.880950e+04, +3.633055e+03, +4.198597e+03, +9.512752e+02, -7.831392e-01, +4.733669e-07, -3.913310e-03, +1.563654e-09, -1.444576e-15, +2.000000e+07, +1.654402e+06, +2.112526e+06, +5.689792e+03, +3.687391e+03, +1.361905e+04 },
+    { +4.000000e+02, +1.055620e-03, +1.583020e+03, -1.077051e+05, +5.255030e+05, +5.466154e+05, -8.659269e+04, +3.609595e+03, +4.206013e+03, +9.473107e+02, -8.026411e-01, +4.814673e-07, -3.889175e-03, +1.677069e-09, -1.517593e-15, +2.000000e+07, +1.667073e+06, +2.076984e+06, +5.223980e+03, +3.679166e+03, +1.359738e+04 },
+    { +4.100000e+02, +1.064860e-03, +1.687077e+03, -1.242422e+05, +5.674594e+05, +5.887566e+05, -1.029450e+05, +3.563596e+03, +4.222649e+03, +9.390903e+02, -8.414089e-01, +4.994163e-07, -3.870986e-03, +1.915658e-09, -1.683065e-15, +2.000000e+07, +1.684785e+06, +2.002337e+06, +4.391970e+03, +3.688382e+03, +1.351179e+04 },
+    { +4.200000e+02, +1.074711e-03, +1.789058e+03, -1.418215e+05, +6.095828e+05, +6.310771e+05, -1.203273e+05, +3.518940e+03, +4.241893e+03, +9.304825e+02, -8.801913e-01, +5.198486e-07, -3.891995e-03, +2.174717e-09, -1.878604e-15, +2.000000e+07, +1.693169e+06, +1.923637e+06, +3.680477e+03, +3.722864e+03, +1.337225e+04 },
+    { +4.300000e+02, +1.085205e-03, +1.889125e+03, -1.604239e+05, +6.518999e+05, +6.736040e+05, -1.387198e+05, +3.475720e+03, +4.264002e+03, +9.214851e+02, -9.193795e-01, +5.429998e-07, -3.952234e-03, +2.460549e-09, -2.110407e-15, +2.000000e+07, +1.693149e+06, +1.841621e+06, +3.075689e+03, +3.773746e+03, +1.318157e+04 },
+    { +4.400000e+02, +1.096380e-03, +1.987435e+03, -1.800316e+05, +6.944400e+05, +7.163676e+05, -1.581040e+05, +3.433991e+03, +4.289262e+03, +9.120922e+02, -9.593709e-01, +5.691730e-07, -4.052974e-03, +2.780435e-09, -2.386443e-15, +2.000000e+07, +1.685552e+06, +1.756935e+06, +2.564998e+03, +3.833955e+03, +1.294251e+04 },
+    { +4.500000e+02, +1.108287e-03, +2.084142e+03, -2.006289e+05, +7.372351e+05, +7.594009e+05, -1.784631e+05, +3.393779e+03, +4.318001e+03, +9.022936e+02, -1.000582e+00, +5.987508e-07, -4.196791e-03, +3.143079e-09, -2.717030e-15, +2.000000e+07, +1.671117e+06, +1.670144e+06, +2.137033e+03, +3.897868e+03, +1.265774e+04 },
+    { +4.600000e+02, +1.120982e-03, +2.179397e+03, -2.222016e+05, +7.803209e+05, +8.027405e+05, -1.997820e+05, +3.355093e+03, +4.350605e+03, +8.920750e+02, -1.043464e+00, +6.322124e-07, -4.387742e-03, +3.559184e-09, -3.115656e-15, +2.000000e+07, +1.650495e+06, +1.581747e+06, +1.781640e+03, +3.961021e+03, +1.232992e+04 },
+    { +4.700000e+02, +1.134537e-03, +2.273349e+03, -2.447374e+05, +8.237367e+05, +8.464274e+05, -2.220467e+05, +3.317930e+03, +4.387541e+03, +8.814171e+02, -1.088514e+00, +6.701572e-07, -4.631694e-03, +4.042245e-09, -3.600158e-15, +2.000000e+07, +1.624266e+06, +1.492187e+06, +1.489822e+03, +4.019878e+03, +1.196166e+04 },
+    { +4.800000e+02, +1.149035e-03, +2.366152e+03, -2.682258e+05, +8.675270e+05, +8.905076e+05, -2.452451e+05, +3.282285e+03, +4.429380e+03, +8.702956e+02, -1.136301e+00, +7.133379e-07, -4.936829e-03, +4.609650e-09, -4.194461e-15, +2.000000e+07, +1.592935e+06, +1.401860e+06, +1.253664e+03, +4.071635e+03, +1.155554e+04 },
+    { +4.900000e+02, +1.164578e-03, +2.457959e+03, -2.926580e+05, +9.117421e+05, +9.350337e+05, -2.693664e+05, +3.248154e+03, +4.476829e+03, +8.586798e+02, -1.187491e+00, +7.627068e-07, -5.314437e-03, +5.284290e-09, -4.931156e-15, +2.000000e+07, +1.556943e+06, +1.311120e+06, +1.066248e+03, +4.114063e+03, +1.111414e+04 },
+    { +5.000000e+02, +1.181291e-03, +2.548935e+03, -3.180273e+05, +9.564401e+05, +9.800659e+05, -2.944015e+05, +3.215542e+03, +4.530779e+03, +8.465318e+02, -1.242883e+00, +8.194825e-07, -5.780109e-03, +6.096956e-09, -5.855462e-15, +2.000000e+07, +1.516668e+06, +1.220282e+06, +9.215645e+02, +4.145378e+03, +1.064001e+04 },
+    { +5.100000e+02, +1.199321e-03, +2.639250e+03, -3.443294e+05, +1.001688e+06, +1.025675e+06, -3.203429e+05, +3.184468e+03, +4.592369e+03, +8.338049e+02, -1.303459e+00, +8.852454e-07, -6.355594e-03, +7.090021e-09, -7.031443e-15, +2.000000e+07, +1.472426e+06, +1.129630e+06, +8.144305e+02, +4.164130e+03, +1.013569e+04 },
+    { +5.200000e+02, +1.218856e-03, +2.729093e+03, -3.715621e+05, +1.047566e+06, +1.071944e+06, -3.471850e+05, +3.154974e+03, +4.663076e+03, +8.204413e+02, -1.370462e+00, +9.620807e-07, -7.071721e-03, +8.323281e-09, -8.552051e-15, +2.000000e+07, +1.424477e+06, +1.039414e+06, +7.404169e+02, +4.169105e+03, +9.603639e+03 },
+    { +5.300000e+02, +1.240127e-03, +2.818674e+03, -3.997265e+05, +1.094171e+06, +1.118973e+06, -3.749239e+05, +3.127135e+03, +4.744861e+03, +8.063689e+02, -1.445508e+00, +1.052796e-06, -7.973129e-03, +9.883504e-09, -1.055595e-14, +2.000000e+07, +1.373018e+06, +9.498514e+05, +6.957842e+02, +4.159227e+03, +9.046161e+03 },
+    { +5.400000e+02, +1.263428e-03, +2.908231e+03, -4.288269e+05, +1.141618e+06, +1.166886e+06, -4.035583e+05, +3.101070e+03, +4.840381e+03, +7.914972e+02, -1.530760e+00, +1.161266e-06, -9.126198e-03, +1.190066e-08, -1.325675e-14, +2.000000e+07, +1.318181e+06, +8.611290e+05, +6.774365e+02, +4.133462e+03, +8.465287e+03 },
+    { +5.500000e+02, +1.289142e-03, +2.998051e+03, -4.588722e+05, +1.190056e+06, +1.215839e+06, -4.330894e+05, +3.076966e+03, +4.953339e+03, +7.757099e+02, -1.629204e+00, +1.292993e-06, -1.063285e-02, +1.457677e-08, -1.699624e-14, +2.000000e+07, +1.260026e+06, +7.733996e+05, +6.829000e+02, +4.090690e+03, +7.862573e+03 },
+    { +5.600000e+02, +1.317775e-03, +3.088483e+03, -4.898769e+05, +1.239673e+06, +1.266029e+06, -4.635214e+05, +3.055106e+03, +5.089068e+03, +7.588550e+02, -1.745126e+00, +1.456066e-06, -1.265581e-02, +1.823971e-08, -2.234661e-14, +2.000000e+07, +1.198521e+06, +6.867818e+05, +7.103461e+02, +4.029551e+03, +7.238824e+03 },
+    { +5.700000e+02, +1.350023e-03, +3.179973e+03, -5.218630e+05, +1.290722e+06, +1.317722e+06, -4.948626e+05, +3.035925e+03, +5.255558e+03, +7.407281e+02, -1.884928e+00, +1.662898e-06, -1.546770e-02, +2.345047e-08, -3.031992e-14, +2.000000e+07, +1.133520e+06, +6.013597e+05, +7.586985e+02, +3.948231e+03, +6.593729e+03 },
+    { +5.800000e+02, +1.386878e-03, +3.273121e+03, -5.548639e+05, +1.343546e+06, +1.371284e+06, -5.271263e+05, +3.020103e+03, +5.465380e+03, +7.210440e+02, -2.058683e+00, +1.933549e-06, -1.955424e-02, +3.123400e-08, -4.283379e-14, +2.000000e+07, +1.064717e+06, +5.171837e+05, +8.279226e+02, +3.844171e+03, +5.925444e+03 },
+    { +5.900000e+02, +1.429825e-03, +3.368773e+03, -5.889298e+05, +1.398646e+06, +1.427243e+06, -5.603333e+05, +3.008749e+03, +5.739608e+03, +6.993864e+02, -2.283286e+00, +2.302709e-06, -2.585532e-02, +4.363105e-08, -6.386141e-14, +2.000000e+07, +9.915652e+05, +4.342711e+05, +9.197382e+02, +3.713685e+03, +5.230235e+03 },
+    { +6.000000e+02, +1.481243e-03, +3.468215e+03, -6.241392e+05, +1.456790e+06, +1.486415e+06, -5.945143e+05, +3.003809e+03, +6.116799e+03, +6.751089e+02, -2.589699e+00, +2.836118e-06, -3.642079e-02, +6.522527e-08, -1.027174e-13, +2.000000e+07, +9.131137e+05, +3.525946e+05, +1.039448e+03, +3.551585e+03, +4.502679e+03 },
+    { +6.100000e+02, +1.545325e-03, +3.573600e+03, -6.606237e+05, +1.519272e+06, +1.550179e+06, -6.297172e+05, +3.009101e+03, +6.677512e+03, +6.471129e+02, -3.042815e+00, +3.676571e-06, -5.666149e-02, +1.084267e-07, -1.857451e-13, +2.000000e+07, +8.276232e+05, +2.719926e+05, +1.201266e+03, +3.351308e+03, +3.737562e+03 },
+    { +6.200000e+02, +1.630712e-03, +3.689121e+03, -6.986338e+05, +1.588621e+06, +1.621236e+06, -6.660196e+05, +3.033744e+03, +7.633594e+03, +6.132290e+02, -3.814687e+00, +5.215795e-06, -1.063822e-01, +2.196574e-07, -4.159138e-13, +2.000000e+07, +7.313721e+05, +1.917253e+05, +1.448295e+03, +3.107218e+03, +2.931176e+03 },
+    { +6.300000e+02, +1.761666e-03, +3.825867e+03, -7.388009e+05, +1.671495e+06, +1.706729e+06, -7.035675e+05, +3.110438e+03, +9.861927e+03, +5.676445e+02, -5.630631e+00, +9.181261e-06, -3.178821e-01, +7.260567e-07, -1.570806e-12, +2.000000e+07, +6.132743e+05, +1.089175e+05, +1.974337e+03, +2.814839e+03, +2.029624e+03 },
+    { +6.388990e+02, +2.040017e-03, +4.015591e+03, -7.791498e+05, +1.786407e+06, +1.827208e+06, -7.383495e+05, +3.518064e+03, +2.299549e+04, +4.901921e+02, -1.672495e+01, +3.818542e-05, -5.742276e+00, +1.610522e-05, -4.458085e-11, +2.000000e+07, +4.379931e+05, +2.618801e+04, +4.887274e+03, +2.346081e+03, +8.006739e+02 },
+    { +6.388990e+02, +2.040017e-03, +4.015591e+03, -7.791498e+05, +1.786407e+06, +1.827208e+06, -7.383495e+05, +3.518064e+03, +2.299549e+04, +4.901921e+02, -1.672495e+01, +3.818542e-05, -5.742276e+00, +1.610522e-05, -4.458085e-11, +2.000000e+07, +4.379931e+05, +2.618801e+04, +4.887274e+03, +2.346081e+03, +8.006739e+02 },
+    { +6.400000e+02, +6.230554e-03, +4.994968e+03, -8.684271e+05, +2.328353e+06, +2.452964e+06, -7.438160e+05, +3.987361e+03, +3.084923e+04, +1.604994e+02, -7.273963e+00, +4.893722e-05, +2.340370e+00, -1.287484e-05, +6.886470e-11, +2.000000e+07, +1.486387e+05, +2.043434e+04, -7.035514e+02, +1.101900e+03, -5.875960e+02 },
+    { +6.500000e+02, +7.905979e-03, +5.262244e+03, -9.534306e+05, +2.467028e+06, +2.625148e+06, -7.953110e+05, +3.248957e+03, +1.164313e+04, +1.264865e+02, -1.906972e+00, +1.760093e-05, +1.355757e-01, -8.844777e-07, +5.192332e-12, +2.000000e+07, +1.083449e+05, +5.681517e+04, -2.766408e+02, +1.039129e+03, -9.522595e+02 },
+    { +6.750000e+02, +1.007854e-02, +5.569777e+03, -1.132702e+06, +2.626898e+06, +2.828469e+06, -9.311309e+05, +2.676146e+03, +6.189282e+03, +9.922069e+01, -6.741154e-01, +8.868964e-06, +1.807485e-02, -1.453736e-07, +9.113082e-13, +2.000000e+07, +7.600836e+04, +1.127527e+05, -1.398702e+02, +9.675569e+02, -1.306311e+03 },
+    { +7.000000e+02, +1.157674e-02, +5.763867e+03, -1.304463e+06, +2.730244e+06, +2.961779e+06, -1.072928e+06, +2.401632e+03, +4.688995e+03, +8.638009e+01, -3.983180e-01, +6.507222e-06, +6.707155e-03, -6.209532e-08, +3.940183e-13, +2.000000e+07, +6.121168e+04, +1.536754e+05, -8.937339e+01, +8.968649e+02, -1.429978e+03 },
+    { +7.250000e+02, +1.280599e-02, +5.914488e+03, -1.475091e+06, +2.812913e+06, +3.069033e+06, -1.218971e+06, +2.236799e+03, +3.963552e+03, +7.808843e+01, -2.784180e-01, +5.337388e-06, +3.420726e-03, -3.546278e-08, +2.225821e-13, +2.000000e+07, +5.216371e+04, +1.873575e+05, -6.119915e+01, +8.372756e+02, -1.463874e+03 },
+    { +7.500000e+02, +1.388374e-02, +6.041141e+03, -1.646130e+06, +2.884726e+06, +3.162401e+06, -1.368455e+06, +2.130386e+03, +3.539371e+03, +7.202671e+01, -2.121601e-01, +4.618437e-06, +2.050348e-03, -2.340608e-08, +1.432537e-13, +2.000000e+07, +4.593763e+04, +2.165235e+05, -4.378360e+01, +7.888128e+02, -1.454189e+03 },
+    { +7.750000e+02, +1.486326e-02, +6.152434e+03, -1.818166e+06, +2.949970e+06, +3.247235e+06, -1.520901e+06, +2.059255e+03, +3.265727e+03, +6.728001e+01, -1.704416e-01, +4.122529e-06, +1.356961e-03, -1.685500e-08, +9.958915e-14, +2.000000e+07, +4.134395e+04, +2.425696e+05, -3.237994e+01, +7.494796e+02, -1.421415e+03 },
+    { +8.000000e+02, +1.577377e-02, +6.252981e+03, -1.991463e+06, +3.010922e+06, +3.326397e+06, -1.675988e+06, +2.010992e+03, +3.078291e+03, +6.339638e+01, -1.418906e-01, +3.754757e-06, +9.606641e-04, -1.286495e-08, +7.283237e-14, +2.000000e+07, +3.778955e+04, +2.663288e+05, -2.459585e+01, +7.173001e+02, -1.375874e+03 },
+    { +8.250000e+02, +1.663318e-02, +6.345550e+03, -2.166147e+06, +3.068932e+06, +3.401595e+06, -1.833484e+06, +1.978289e+03, +2.944728e+03, +6.012079e+01, -1.211799e-01, +3.468097e-06, +7.141733e-04, -1.023585e-08, +5.519409e-14, +2.000000e+07, +3.494132e+04, +2.883426e+05, -1.910300e+01, +6.906808e+02, -1.323180e+03 },
+    { +8.500000e+02, +1.745328e-02, +6.431934e+03, -2.342279e+06, +3.124864e+06, +3.473930e+06, -1.993214e+06, +1.956576e+03, +2.846970e+03, +5.729581e+01, -1.054962e-01, +3.236418e-06, +5.509745e-04, -8.400686e-09, +4.293548e-14, +2.000000e+07, +3.259659e+04, +3.089836e+05, -1.511782e+01, +6.684046e+02, -1.266551e+03 },
+    { +9.000000e+02, +1.900606e-02, +6.590704e+03, -2.698969e+06, +3.232665e+06, +3.612786e+06, -2.318848e+06, +1.935105e+03, +2.719283e+03, +5.261480e+01, -8.335593e-02, +2.880611e-06, +3.557373e-04, -6.050586e-09, +2.745097e-14, +2.000000e+07, +2.893689e+04, +3.471485e+05, -9.912107e+00, +6.334406e+02, -1.148428e+03 },
+    { +9.500000e+02, +2.047472e-02, +6.735594e+03, -3.061549e+06, +3.337266e+06, +3.746760e+06, -2.652054e+06, +1.932183e+03, +2.646469e+03, +4.884072e+01, -6.849810e-02, +2.616039e-06, +2.481795e-04, -4.639768e-09, +1.843392e-14, +2.000000e+07, +2.618390e+04, +3.822574e+05, -6.820714e+00, +6.074377e+02, -1.029640e+03 },
+    { +1.000000e+03, +2.188393e-02, +6.870200e+03, -3.429915e+06, +3.440285e+06, +3.877963e+06, -2.992236e+06, +1.940458e+03, +2.605799e+03, +4.569563e+01, -5.784746e-02, +2.408657e-06, +1.828083e-04, -3.714824e-09, +1.276389e-14, +2.000000e+07, +2.401647e+04, +4.151690e+05, -4.872597e+00, +5.874694e+02, -9.133939e+02 },
+    { +1.050000e+03, +2.324921e-02, +6.996775e+03, -3.803925e+06, +3.542689e+06, +4.007673e+06, -3.338941e+06, +1.955795e+03, +2.585281e+03, +4.301221e+01, -4.984365e-02, +2.239957e-06, +1.401564e-04, -3.068911e-09, +9.001588e-15, +2.000000e+07, +2.225206e+04, +4.464372e+05, -3.586836e+00, +5.717311e+02, -8.009405e+02 },
+    { +1.100000e+03, +2.458095e-02, +7.116833e+03, -4.183425e+06, +3.645091e+06, +4.136710e+06, -3.691806e+06, +1.975679e+03, +2.577988e+03, +4.068191e+01, -4.361256e-02, +2.098908e-06, +1.107968e-04, -2.595973e-09, +6.404950e-15, +2.000000e+07, +2.077869e+04, +4.764383e+05, -2.706321e+00, +5.590592e+02, -6.926849e+02 },
+    { +1.150000e+03, +2.588642e-02, +7.231438e+03, -4.568262e+06, +3.747892e+06, +4.265621e+06, -4.050533e+06, +1.998489e+03, +2.579644e+03, +3.863030e+01, -3.862697e-02, +1.978477e-06, +8.972452e-05, -2.236715e-09, +4.558813e-15, +2.000000e+07, +1.952359e+04, +5.054392e+05, -2.084846e+00, +5.486730e+02, -5.886520e+02 },
+    { +1.200000e+03, +2.717087e-02, +7.341374e+03, -4.958289e+06, +3.851360e+06, +4.394777e+06, -4.414872e+06, +2.023132e+03, +2.587461e+03, +3.680412e+01, -3.455015e-02, +1.873939e-06, +7.408551e-05, -1.955691e-09, +3.215907e-15, +2.000000e+07, +1.843718e+04, +5.336352e+05, -1.634988e+00, +5.400309e+02, -4.886940e+02 },
+    { +1.250000e+03, +2.843823e-02, +7.447232e+03, -5.353368e+06, +3.955673e+06, +4.524438e+06, -4.784603e+06, +2.048843e+03, +2.599551e+03, +3.516393e+01, -3.115691e-02, +1.781981e-06, +6.215698e-05, -1.730554e-09, +2.221511e-15, +2.000000e+07, +1.748443e+04, +5.611733e+05, -1.302266e+00, +5.327462e+02, -3.925901e+02 },
+    { +1.273000e+03, +2.901634e-02, +7.494689e+03, -5.536763e+06, +4.003976e+06, +4.584302e+06, -4.956436e+06, +2.060873e+03, +2.606168e+03, +3.446335e+01, -2.978069e-02, +1.743218e-06, +5.759990e-05, -1.641509e-09, +1.851984e-15, +2.000000e+07, +1.708375e+04, +5.736518e+05, -1.178373e+00, +5.297704e+02, -3.496088e+02 },
+    // P = 22.5 MPa
+    { +2.714350e+02, +9.891726e-04, -2.550317e+01, +1.011452e+02, -6.821307e+03, +1.543508e+04, +2.235753e+04, +4.120935e+03, +4.121036e+03, +1.010946e+03, +1.362014e-02, +4.889383e-07, -1.558704e-02, -3.590748e-09, -1.148444e-15, +2.250000e+07, -2.785655e+04, +2.045248e+06, +3.147203e+04, +1.488641e+04, +9.825337e+03 },
+    { +2.750000e+02, +9.892184e-04, +2.825729e+01, +9.499023e+01, +7.865745e+03, +3.012316e+04, +2.235240e+04, +4.118423e+03, +4.119276e+03, +1.010899e+03, -3.889781e-02, +4.770311e-07, -1.393368e-02, -3.102877e-09, -1.077100e-15, +2.250000e+07, +8.154146e+04, +2.096299e+06, +3.028497e+04, +1.402146e+04, +9.922378e+03 },
+    { +2.800000e+02, +9.895713e-04, +1.024683e+02, -2.403301e+02, +2.845078e+04, +5.071613e+04, +2.202502e+04, +4.111757e+03, +4.118138e+03, +1.010539e+03, -1.037960e-01, +4.629832e-07, -1.210744e-02, -2.536089e-09, -1.003073e-15, +2.250000e+07, +2.241896e+05, +2.159905e+06, +2.871590e+04, +1.288044e+04, +1.010734e+04 },
+    { +2.850000e+02, +9.902220e-04, +1.753561e+02, -9.500699e+02, +4.902643e+04, +7.130643e+04, +2.132993e+04, +4.102163e+03, +4.118139e+03, +1.009875e+03, -1.606589e-01, +4.515008e-07, -1.069534e-02, -2.071435e-09, -9.508856e-16, +2.250000e+07, +3.558330e+05, +2.214836e+06, +2.722014e+04, +1.182122e+04, +1.033125e+04 },
+    { +2.900000e+02, +9.911368e-04, +2.469839e+02, -2.027015e+03, +6.959830e+04, +9.189888e+04, +2.027356e+04, +4.090206e+03, +4.118957e+03, +1.008942e+03, -2.112405e-01, +4.421426e-07, -9.579159e-03, -1.682833e-09, -9.143607e-16, +2.250000e+07, +4.777656e+05, +2.261714e+06, +2.577420e+04, +1.084292e+04, +1.057866e+04 },
+    { +2.950000e+02, +9.922894e-04, +3.174063e+02, -3.464417e+03, +9.017045e+04, +1.124970e+05, +1.886210e+04, +4.076272e+03, +4.120354e+03, +1.007770e+03, -2.568114e-01, +4.345756e-07, -8.680339e-03, -1.352506e-09, -8.895092e-16, +2.250000e+07, +5.909476e+05, +2.301096e+06, +2.436744e+04, +9.944934e+03, +1.083813e+04 },
+    { +3.000000e+02, +9.936593e-04, +3.866722e+02, -5.255909e+03, +1.107458e+05, +1.331031e+05, +1.710143e+04, +4.060643e+03, +4.122154e+03, +1.006381e+03, -2.983155e-01, +4.285417e-07, -7.944980e-03, -1.067807e-09, -8.736815e-16, +2.250000e+07, +6.961178e+05, +2.333495e+06, +2.299657e+04, +9.126117e+03, +1.110130e+04 },
+    { +3.050000e+02, +9.952300e-04, +4.548253e+02, -7.395447e+03, +1.313263e+05, +1.537190e+05, +1.499723e+04, +4.043533e+03, +4.124226e+03, +1.004793e+03, -3.364697e-01, +4.238371e-07, -7.335067e-03, -8.194149e-10, -8.650756e-16, +2.250000e+07, +7.938656e+05, +2.359397e+06, +2.166226e+04, +8.384470e+03, +1.136206e+04 },
+    { +3.100000e+02, +9.969880e-04, +5.219055e+02, -9.877269e+03, +1.519134e+05, +1.743457e+05, +1.255496e+04, +4.025119e+03, +4.126480e+03, +1.003021e+03, -3.718291e-01, +4.202989e-07, -6.823171e-03, -6.002574e-10, -8.624426e-16, +2.250000e+07, +8.846779e+05, +2.379259e+06, +2.036702e+04, +7.717139e+03, +1.161597e+04 },
+    { +3.150000e+02, +9.989226e-04, +5.879494e+02, -1.269586e+04, +1.725082e+05, +1.949840e+05, +9.779900e+03, +4.005559e+03, +4.128858e+03, +1.001079e+03, -4.048309e-01, +4.177950e-07, -6.389117e-03, -4.048430e-10, -8.649044e-16, +2.250000e+07, +9.689701e+05, +2.393518e+06, +1.911401e+04, +7.120540e+03, +1.185983e+04 },
+    { +3.200000e+02, +1.001025e-03, +6.529914e+02, -1.584592e+04, +1.931113e+05, +2.156344e+05, +6.677137e+03, +3.984995e+03, +4.131328e+03, +9.989761e+02, -4.358247e-01, +4.162182e-07, -6.017813e-03, -2.288227e-10, -8.718399e-16, +2.250000e+07, +1.047106e+06, +2.402586e+06, +1.790630e+04, +6.590556e+03, +1.209132e+04 },
+    { +3.250000e+02, +1.003288e-03, +7.170639e+02, -1.932237e+04, +2.137234e+05, +2.362974e+05, +3.251601e+03, +3.963562e+03, +4.133882e+03, +9.967231e+02, -4.650944e-01, +4.154803e-07, -5.697812e-03, -6.869625e-11, -8.828110e-16, +2.250000e+07, +1.119414e+06, +2.406853e+06, +1.674652e+04, +6.122714e+03, +1.230882e+04 },
+    { +3.300000e+02, +1.005705e-03, +7.801979e+02, -2.312029e+04, +2.343450e+05, +2.569734e+05, -4.919378e+02, +3.941385e+03, +4.136525e+03, +9.943276e+02, -4.928735e-01, +4.155095e-07, -5.420318e-03, +7.839362e-11, -8.975135e-16, +2.250000e+07, +1.186191e+06, +2.406684e+06, +1.563667e+04, +5.712361e+03, +1.251118e+04 },
+    { +3.350000e+02, +1.008271e-03, +8.424229e+02, -2.723497e+04, +2.549767e+05, +2.776628e+05, -4.548862e+03, +3.918586e+03, +4.139275e+03, +9.917966e+02, -5.193569e-01, +4.162465e-07, -5.178497e-03, +2.148093e-10, -9.157449e-16, +2.250000e+07, +1.247715e+06, +2.402423e+06, +1.457809e+04, +5.354802e+03, +1.269763e+04 },
+    { +3.400000e+02, +1.010983e-03, +9.037677e+02, -3.166183e+04, +2.756192e+05, +2.983663e+05, -8.914700e+03, +3.895278e+03, +4.142161e+03, +9.891360e+02, -5.447090e-01, +4.176431e-07, -4.966987e-03, +3.425275e-10, -9.373822e-16, +2.250000e+07, +1.304245e+06, +2.394389e+06, +1.357151e+04, +5.045404e+03, +1.286769e+04 },
+    { +3.450000e+02, +1.013838e-03, +9.642603e+02, -3.639647e+04, +2.962733e+05, +3.190847e+05, -1.358512e+04, +3.871568e+03, +4.145214e+03, +9.863511e+02, -5.690702e-01, +4.196601e-07, -4.781545e-03, +4.632210e-10, -9.623660e-16, +2.250000e+07, +1.356026e+06, +2.382881e+06, +1.261705e+04, +4.779688e+03, +1.302109e+04 },
+    { +3.500000e+02, +1.016832e-03, +1.023928e+03, -4.143465e+04, +3.169401e+05, +3.398188e+05, -1.855593e+04, +3.847553e+03, +4.148471e+03, +9.834467e+02, -5.925622e-01, +4.222660e-07, -4.618784e-03, +5.783223e-10, -9.906912e-16, +2.250000e+07, +1.403291e+06, +2.368175e+06, +1.171434e+04, +4.553375e+03, +1.315770e+04 },
+    { +3.550000e+02, +1.019964e-03, +1.082797e+03, -4.677226e+04, +3.376206e+05, +3.605698e+05, -2.382307e+04, +3.823325e+03, +4.151968e+03, +9.804268e+02, -6.152913e-01, +4.254361e-07, -4.475985e-03, +6.890724e-10, -1.022399e-15, +2.250000e+07, +1.446260e+06, +2.350529e+06, +1.086262e+04, +4.362432e+03, +1.327753e+04 },
+    { +3.600000e+02, +1.023233e-03, +1.140893e+03, -5.240534e+04, +3.583162e+05, +3.813390e+05, -2.938261e+04, +3.798966e+03, +4.155745e+03, +9.772949e+02, -6.373516e-01, +4.291513e-07, -4.350951e-03, +7.965599e-10, -1.057571e-15, +2.250000e+07, +1.485144e+06, +2.330180e+06, +1.006073e+04, +4.203089e+03, +1.338069e+04 },
+    { +3.650000e+02, +1.026637e-03, +1.198243e+03, -5.833008e+04, +3.790284e+05, +4.021278e+05, -3.523075e+04, +3.774551e+03, +4.159837e+03, +9.740542e+02, -6.588274e-01, +4.333979e-07, -4.241899e-03, +9.017522e-10, -1.096332e-15, +2.250000e+07, +1.520145e+06, +2.307349e+06, +9.307287e+03, +4.071850e+03, +1.346734e+04 },
+    { +3.700000e+02, +1.030176e-03, +1.254870e+03, -6.454280e+04, +3.997589e+05, +4.229379e+05, -4.136383e+04, +3.750146e+03, +4.164281e+03, +9.707075e+02, -6.797948e-01, +4.381665e-07, -4.147375e-03, +1.005521e-09, -1.138839e-15, +2.250000e+07, +1.551453e+06, +2.282238e+06, +8.600684e+03, +3.965495e+03, +1.353770e+04 },
+    { +3.750000e+02, +1.033851e-03, +1.310799e+03, -7.103994e+04, +4.205096e+05, +4.437712e+05, -4.777829e+04, +3.725812e+03, +4.169113e+03, +9.672570e+02, -7.003234e-01, +4.434520e-07, -4.066195e-03, +1.108664e-09, -1.185291e-15, +2.250000e+07, +1.579254e+06, +2.255035e+06, +7.939166e+03, +3.881074e+03, +1.359205e+04 },
+    { +3.800000e+02, +1.037662e-03, +1.366054e+03, -7.781809e+04, +4.412823e+05, +4.646297e+05, -5.447069e+04, +3.701601e+03, +4.174365e+03, +9.637049e+02, -7.204774e-01, +4.492533e-07, -3.997392e-03, +1.211920e-09, -1.235922e-15, +2.250000e+07, +1.603722e+06, +2.225916e+06, +7.320872e+03, +3.815893e+03, +1.363068e+04 },
+    { +3.850000e+02, +1.041609e-03, +1.420658e+03, -8.487395e+04, +4.620794e+05, +4.855156e+05, -6.143774e+04, +3.677557e+03, +4.180071e+03, +9.600528e+02, -7.403166e-01, +4.555726e-07, -3.940181e-03, +1.315989e-09, -1.291009e-15, +2.250000e+07, +1.625025e+06, +2.195040e+06, +6.743879e+03, +3.767505e+03, +1.365389e+04 },
+    { +3.900000e+02, +1.045695e-03, +1.474635e+03, -9.220436e+04, +4.829031e+05, +5.064313e+05, -6.867623e+04, +3.653721e+03, +4.186260e+03, +9.563021e+02, -7.598974e-01, +4.624156e-07, -3.893927e-03, +1.421539e-09, -1.350867e-15, +2.250000e+07, +1.643321e+06, +2.162557e+06, +6.206232e+03, +3.733694e+03, +1.366202e+04 },
+    { +3.950000e+02, +1.049919e-03, +1.528006e+03, -9.980626e+04, +5.037559e+05, +5.273791e+05, -7.618308e+04, +3.630126e+03, +4.192964e+03, +9.524541e+02, -7.792733e-01, +4.697915e-07, -3.858124e-03, +1.529224e-09, -1.415860e-15, +2.250000e+07, +1.658764e+06, +2.128604e+06, +5.705974e+03, +3.712458e+03, +1.365542e+04 },
+    { +4.000000e+02, +1.054286e-03, +1.580793e+03, -1.076767e+05, +5.246404e+05, +5.483618e+05, -8.395531e+04, +3.606802e+03, +4.200212e+03, +9.485097e+02, -7.984954e-01, +4.777125e-07, -3.832377e-03, +1.639689e-09, -1.486402e-15, +2.250000e+07, +1.671498e+06, +2.093309e+06, +5.241163e+03, +3.701991e+03, +1.363441e+04 },
+    { +4.100000e+02, +1.063452e-03, +1.684702e+03, -1.242123e+05, +5.665154e+05, +5.904431e+05, -1.002846e+05, +3.561055e+03, +4.216453e+03, +9.403336e+02, -8.366752e-01, +4.952552e-07, -3.809949e-03, +1.871574e-09, -1.646062e-15, +2.250000e+07, +1.689382e+06, +2.019161e+06, +4.410298e+03, +3.707039e+03, +1.355062e+04 },
+    { +4.200000e+02, +1.073219e-03, +1.786528e+03, -1.417898e+05, +6.085518e+05, +6.326993e+05, -1.176424e+05, +3.516627e+03, +4.235217e+03, +9.317763e+02, -8.748201e-01, +5.152078e-07, -3.825273e-03, +2.122607e-09, -1.834371e-15, +2.250000e+07, +1.697995e+06, +1.940965e+06, +3.699003e+03, +3.737754e+03, +1.341344e+04 },
+    { +4.300000e+02, +1.083616e-03, +1.886431e+03, -1.603901e+05, +6.507753e+05, +6.751567e+05, -1.360087e+05, +3.473613e+03, +4.256751e+03, +9.228361e+02, -9.133059e-01, +5.377909e-07, -3.878199e-03, +2.398727e-09, -2.057107e-15, +2.250000e+07, +1.698255e+06, +1.859459e+06, +3.093658e+03, +3.785249e+03, +1.322564e+04 },
+    { +4.400000e+02, +1.094681e-03, +1.984567e+03, -1.799955e+05, +6.932141e+05, +7.178444e+05, -1.553651e+05, +3.432067e+03, +4.281323e+03, +9.135078e+02, -9.525126e-01, +5.632884e-07, -3.969719e-03, +2.706727e-09, -2.321668e-15, +2.250000e+07, +1.690986e+06, +1.775289e+06, +2.581800e+03, +3.842430e+03, +1.298995e+04 },
+    { +4.500000e+02, +1.106461e-03, +2.081087e+03, -2.005901e+05, +7.358989e+05, +7.607943e+05, -1.756947e+05, +3.392017e+03, +4.309242e+03, +9.037821e+02, -9.928360e-01, +5.920583e-07, -4.102014e-03, +3.054666e-09, -2.637585e-15, +2.250000e+07, +1.676923e+06, +1.689023e+06, +2.152169e+03, +3.903656e+03, +1.270905e+04 },
+    { +4.600000e+02, +1.119011e-03, +2.176138e+03, -2.221597e+05, +7.788638e+05, +8.040416e+05, -1.969820e+05, +3.353472e+03, +4.340866e+03, +8.936459e+02, -1.034700e+00, +6.245474e-07, -4.278586e-03, +3.452374e-09, -3.017253e-15, +2.250000e+07, +1.656720e+06, +1.601160e+06, +1.794690e+03, +3.964446e+03, +1.238556e+04 },
+    { +4.700000e+02, +1.132398e-03, +2.269869e+03, -2.446920e+05, +8.221464e+05, +8.476254e+05, -2.192131e+05, +3.316428e+03, +4.376628e+03, +8.830814e+02, -1.078572e+00, +6.613123e-07, -4.504532e-03, +3.912140e-09, -3.476958e-15, +2.250000e+07, +1.630957e+06, +1.512145e+06, +1.500423e+03, +4.021250e+03, +1.202208e+04 },
+    { +4.800000e+02, +1.146702e-03, +2.362427e+03, -2.681762e+05, +8.657889e+05, +8.915897e+05, -2.423755e+05, +3.280877e+03, +4.417053e+03, +8.720660e+02, -1.124979e+00, +7.030488e-07, -4.786965e-03, +4.449660e-09, -4.038383e-15, +2.250000e+07, +1.600143e+06, +1.422376e+06, +1.261488e+03, +4.071256e+03, +1.162120e+04 },
+    { +4.900000e+02, +1.162019e-03, +2.453964e+03, -2.926036e+05, +9.098387e+05, +9.359842e+05, -2.664582e+05, +3.246814e+03, +4.462789e+03, +8.605714e+02, -1.174532e+00, +7.506322e-07, -5.135652e-03, +5.085403e-09, -4.730824e-15, +2.250000e+07, +1.564724e+06, +1.332210e+06, +1.070980e+03, +4.112227e+03, +1.118550e+04 },
+    { +5.000000e+02, +1.178464e-03, +2.544635e+03, -3.179673e+05, +9.543504e+05, +9.808658e+05, -2.914518e+05, +3.214238e+03, +4.514644e+03, +8.485625e+02, -1.227957e+00, +8.051741e-07, -5.563998e-03, +5.846612e-09, -5.594542e-15, +2.250000e+07, +1.525083e+06, +1.241967e+06, +9.228852e+02, +4.142381e+03, +1.071754e+04 },
+    { +5.100000e+02, +1.196177e-03, +2.634607e+03, -3.442626e+05, +9.993868e+05, +1.026301e+06, -3.173486e+05, +3.183164e+03, +4.573644e+03, +8.359964e+02, -1.286138e+00, +8.681046e-07, -6.090528e-03, +6.770342e-09, -6.685945e-15, +2.250000e+07, +1.481548e+06, +1.151935e+06, +8.119973e+02, +4.160272e+03, +1.021990e+04 },
+    { +5.200000e+02, +1.215332e-03, +2.724056e+03, -3.714872e+05, +1.045022e+06, +1.072367e+06, -3.441422e+05, +3.153623e+03, +4.641108e+03, +8.228202e+02, -1.350180e+00, +9.412922e-07, -6.741197e-03, +7.908183e-09, -8.085833e-15, +2.250000e+07, +1.434390e+06, +1.062369e+06, +7.338400e+02, +4.164703e+03, +9.695080e+03 },
+    { +5.300000e+02, +1.236142e-03, +2.813180e+03, -3.996418e+05, +1.091344e+06, +1.119157e+06, -3.718286e+05, +3.125677e+03, +4.718765e+03, +8.089686e+02, -1.421498e+00, +1.027224e-06, -7.553061e-03, +9.333839e-09, -9.912928e-15, +2.250000e+07, +1.383825e+06, +9.734976e+05, +6.845986e+02, +4.154627e+03, +9.145483e+03 },
+    { +5.400000e+02, +1.258875e-03, +2.902202e+03, -4.287302e+05, +1.138459e+06, +1.166784e+06, -4.004055e+05, +3.099425e+03, +4.808931e+03, +7.943599e+02, -1.501956e+00, +1.129284e-06, -8.580269e-03, +1.115571e-08, -1.234686e-14, +2.250000e+07, +1.330008e+06, +8.855171e+05, +6.610614e+02, +4.129057e+03, +8.573286e+03 },
+    { +5.500000e+02, +1.283877e-03, +2.991383e+03, -4.587604e+05, +1.186500e+06, +1.215388e+06, -4.298732e+05, +3.075021e+03, +4.914781e+03, +7.788907e+02, -1.594087e+00, +1.252198e-06, -9.904218e-03, +1.353860e-08, -1.566885e-14, +2.250000e+07, +1.273032e+06, +7.985958e+05, +6.605779e+02, +4.086952e+03, +7.980280e+03 },
+    { +5.600000e+02, +1.311600e-03, +3.081038e+03, -4.897457e+05, +1.235635e+06, +1.265146e+06, -4.602347e+05, +3.052701e+03, +5.040798e+03, +7.624276e+02, -1.701443e+00, +1.402776e-06, -1.165147e-02, +1.674295e-08, -2.033729e-14, +2.250000e+07, +1.212912e+06, +7.128723e+05, +6.810407e+02, +4.027074e+03, +7.367639e+03 },
+    { +5.700000e+02, +1.342653e-03, +3.171560e+03, -5.217065e+05, +1.286083e+06, +1.316292e+06, -4.914968e+05, +3.032818e+03, +5.193540e+03, +7.447941e+02, -1.829196e+00, +1.591197e-06, -1.402709e-02, +2.119961e-08, -2.713625e-14, +2.250000e+07, +1.149572e+06, +6.284575e+05, +7.209124e+02, +3.947796e+03, +6.735619e+03 },
+    { +5.800000e+02, +1.377885e-03, +3.263465e+03, -5.546729e+05, +1.338137e+06, +1.369139e+06, -5.236705e+05, +3.015912e+03, +5.383005e+03, +7.257499e+02, -1.985216e+00, +1.833387e-06, -1.738084e-02, +2.766242e-08, -3.748830e-14, +2.250000e+07, +1.082813e+06, +5.454386e+05, +7.793442e+02, +3.846840e+03, +6.083217e+03 },
+    { +5.900000e+02, +1.418531e-03, +3.357458e+03, -5.886900e+05, +1.392210e+06, +1.424127e+06, -5.567730e+05, +3.002834e+03, +5.625270e+03, +7.049544e+02, -2.182136e+00, +2.155702e-06, -2.235074e-02, +3.754734e-08, -5.417437e-14, +2.250000e+07, +1.012262e+06, +4.638860e+05, +8.564977e+02, +3.720928e+03, +5.407889e+03 },
+    { +6.000000e+02, +1.466490e-03, +3.454567e+03, -6.238260e+05, +1.448914e+06, +1.481910e+06, -5.908300e+05, +2.994991e+03, +5.948064e+03, +6.819003e+02, -2.441719e+00, +2.605113e-06, -3.021511e-02, +5.378126e-08, -8.319621e-14, +2.250000e+07, +9.372794e+05, +3.838605e+05, +9.543693e+02, +3.565377e+03, +4.705696e+03 },
+    { +6.100000e+02, +1.524907e-03, +3.556405e+03, -6.601904e+05, +1.509217e+06, +1.543527e+06, -6.258800e+05, +2.994916e+03, +6.404301e+03, +6.557778e+02, -2.805450e+00, +3.274504e-06, -4.393239e-02, +8.332958e-08, -1.394861e-13, +2.250000e+07, +8.567558e+05, +3.053898e+05, +1.079013e+03, +3.373874e+03, +3.972779e+03 },
+    { +6.200000e+02, +1.599619e-03, +3.665807e+03, -6.979744e+05, +1.574826e+06, +1.610817e+06, -6.619830e+05, +3.007824e+03, +7.112821e+03, +6.251489e+02, -3.366634e+00, +4.380300e-06, -7.216461e-02, +1.470136e-07, -2.696430e-13, +2.250000e+07, +7.685853e+05, +2.282949e+05, +1.247427e+03, +3.139105e+03, +3.208319e+03 },
+    { +6.300000e+02, +1.703790e-03, +3.788815e+03, -7.375758e+05, +1.649378e+06, +1.687713e+06, -6.992405e+05, +3.047437e+03, +8.428434e+03, +5.869269e+02, -4.405836e+00, +6.597303e-06, -1.516217e-01, +3.361964e-07, -6.892672e-13, +2.250000e+07, +6.678238e+05, +1.515771e+05, +1.513825e+03, +2.851564e+03, +2.400426e+03 },
+    { +6.400000e+02, +1.881875e-03, +3.944312e+03, -7.802038e+05, +1.744156e+06, +1.786498e+06, -7.378616e+05, +3.172402e+03, +1.214204e+04, +5.313848e+02, -7.348780e+00, +1.364637e-05, -5.762821e-01, +1.468486e-06, -3.564965e-12, +2.250000e+07, +5.385154e+05, +7.327957e+04, +2.089435e+03, +2.423448e+03, +1.402827e+03 },
+    { +6.500000e+02, +4.581306e-03, +4.775328e+03, -8.823417e+05, +2.221622e+06, +2.324701e+06, -7.792623e+05, +4.241171e+03, +6.527169e+04, +2.182784e+02, -2.250569e+01, +1.132217e-04, +1.682560e+01, -7.273250e-05, +3.084103e-10, +2.250000e+07, +1.987754e+05, +8.832230e+03, -8.526477e+02, +8.914868e+02, -2.124907e+02 },
+    { +6.750000e+02, +8.008466e-03, +5.388489e+03, -1.088782e+06, +2.548448e+06, +2.728638e+06, -9.085917e+05, +2.901778e+03, +8.198995e+03, +1.248679e+02, -1.209752e+00, +1.196045e-05, +4.785458e-02, -3.101930e-07, +1.671642e-12, +2.250000e+07, +1.011460e+05, +8.360889e+04, -1.845045e+02, +9.864434e+02, -9.770135e+02 },
+    { +7.000000e+02, +9.613697e-03, +5.628926e+03, -1.262833e+06, +2.677415e+06, +2.893723e+06, -1.046525e+06, +2.542232e+03, +5.511187e+03, +1.040183e+02, -5.930914e-01, +7.665111e-06, +1.262588e-02, -9.681942e-08, +5.428624e-13, +2.250000e+07, +7.737544e+04, +1.304612e+05, -1.165131e+02, +9.329623e+02, -1.205409e+03 },
+    { +7.250000e+02, +1.084862e-02, +5.801305e+03, -1.433587e+06, +2.772359e+06, +3.016453e+06, -1.189493e+06, +2.335919e+03, +4.432953e+03, +9.217763e+01, -3.825713e-01, +5.955335e-06, +5.592297e-03, -4.864142e-08, +2.739134e-13, +2.250000e+07, +6.424010e+04, +1.679167e+05, -7.946160e+01, +8.753507e+02, -1.296865e+03 },
+    { +7.500000e+02, +1.189865e-02, +5.940888e+03, -1.604041e+06, +2.851625e+06, +3.119344e+06, -1.336321e+06, +2.204604e+03, +3.849538e+03, +8.404311e+01, -2.784254e-01, +5.004102e-06, +3.095593e-03, -2.988534e-08, +1.658502e-13, +2.250000e+07, +5.563943e+04, +1.998361e+05, -5.663671e+01, +8.249472e+02, -1.323542e+03 },
+    { +7.750000e+02, +1.283547e-02, +6.060801e+03, -1.775173e+06, +2.921947e+06, +3.210745e+06, -1.486375e+06, +2.117067e+03, +3.488531e+03, +7.790914e+01, -2.170400e-01, +4.385510e-06, +1.944785e-03, -2.054493e-08, +1.109602e-13, +2.250000e+07, +4.949025e+04, +2.280236e+05, -4.173090e+01, +7.827023e+02, -1.315549e+03 },
+    { +8.000000e+02, +1.369539e-02, +6.167510e+03, -1.947398e+06, +2.986610e+06, +3.294756e+06, -1.639252e+06, +2.057363e+03, +3.247327e+03, +7.301728e+01, -1.768667e-01, +3.944548e-06, +1.326590e-03, -1.517556e-08, +7.903856e-14, +2.250000e+07, +4.483827e+04, +2.535145e+05, -3.158864e+01, +7.475589e+02, -1.287797e+03 },
+    { +8.250000e+02, +1.449964e-02, +6.264699e+03, -2.120914e+06, +3.047463e+06, +3.373705e+06, -1.794672e+06, +2.016351e+03, +3.078040e+03, +6.896722e+01, -1.486622e-01, +3.610539e-06, +9.589152e-04, -1.178188e-08, +5.875724e-14, +2.250000e+07, +4.117451e+04, +2.769669e+05, -2.445687e+01, +7.182099e+02, -1.248375e+03 },
+    { +8.500000e+02, +1.526176e-02, +6.354670e+03, -2.295817e+06, +3.105653e+06, +3.449042e+06, -1.952427e+06, +1.988406e+03, +2.955201e+03, +6.552324e+01, -1.278329e-01, +3.346409e-06, +7.236565e-04, -9.486847e-09, +4.504275e-14, +2.250000e+07, +3.820003e+04, +2.988278e+05, -1.930104e+01, +6.935074e+02, -1.201954e+03 },
+    { +9.000000e+02, +1.669368e-02, +6.518628e+03, -2.649944e+06, +3.216821e+06, +3.592429e+06, -2.274337e+06, +1.958366e+03, +2.795266e+03, +5.990292e+01, -9.921774e-02, +2.950199e-06, +4.522555e-04, -6.645470e-09, +2.820259e-14, +2.250000e+07, +3.363086e+04, +3.389602e+05, -1.259841e+01, +6.545502e+02, -1.098335e+03 },
+    { +9.500000e+02, +1.803795e-02, +6.667067e+03, -3.009887e+06, +3.323827e+06, +3.729681e+06, -2.604033e+06, +1.949957e+03, +2.703088e+03, +5.543868e+01, -8.054261e-02, +2.662433e-06, +3.083453e-04, -4.998486e-09, +1.866893e-14, +2.250000e+07, +3.025151e+04, +3.755963e+05, -8.641266e+00, +6.254767e+02, -9.891987e+02 },
+    { +1.000000e+03, +1.932098e-02, +6.804235e+03, -3.375578e+06, +3.428656e+06, +3.863378e+06, -2.940856e+06, +1.954500e+03, +2.649783e+03, +5.175720e+01, -6.742185e-02, +2.440610e-06, +2.232762e-04, -3.945774e-09, +1.278906e-14, +2.250000e+07, +2.762501e+04, +4.097337e+05, -6.159095e+00, +6.031111e+02, -8.797186e+02 },
+    { +1.050000e+03, +2.055913e-02, +6.932732e+03, -3.746893e+06, +3.532476e+06, +3.995057e+06, -3.284313e+06, +1.967177e+03, +2.620512e+03, +4.864018e+01, -5.771020e-02, +2.262394e-06, +1.689399e-04, -3.224754e-09, +8.941895e-15, +2.250000e+07, +2.550847e+04, +4.420097e+05, -4.526669e+00, +5.854652e+02, -7.721916e+02 },
+    { +1.100000e+03, +2.176321e-02, +7.054275e+03, -4.123686e+06, +3.636016e+06, +4.125689e+06, -3.634014e+06, +1.985097e+03, +2.606881e+03, +4.594910e+01, -5.023846e-02, +2.114812e-06, +1.321630e-04, -2.704874e-09, +6.314654e-15, +2.250000e+07, +2.375551e+04, +4.728552e+05, -3.411742e+00, +5.712476e+02, -6.676272e+02 },
+    { +1.150000e+03, +2.294070e-02, +7.170055e+03, -4.505810e+06, +3.739753e+06, +4.255919e+06, -3.989644e+06, +2.006416e+03, +2.603783e+03, +4.359064e+01, -4.431645e-02, +1.989757e-06, +1.061272e-04, -2.314867e-09, +4.462108e-15, +2.250000e+07, +2.227229e+04, +5.025739e+05, -2.626387e+00, +5.595884e+02, -5.664216e+02 },
+    { +1.200000e+03, +2.409701e-02, +7.280938e+03, -4.893121e+06, +3.844005e+06, +4.386187e+06, -4.350938e+06, +2.029899e+03, +2.607936e+03, +4.149893e+01, -3.951101e-02, +1.881866e-06, +8.702360e-05, -2.012945e-09, +3.123423e-15, +2.250000e+07, +2.099566e+04, +5.313874e+05, -2.058739e+00, +5.498829e+02, -4.686673e+02 },
+    { +1.250000e+03, +2.523612e-02, +7.387571e+03, -5.285480e+06, +3.948984e+06, +4.516797e+06, -4.717667e+06, +2.054692e+03, +2.617136e+03, +3.962574e+01, -3.553668e-02, +1.787432e-06, +7.259190e-05, -1.773178e-09, +2.137538e-15, +2.250000e+07, +1.988142e+04, +5.594620e+05, -1.639348e+00, +5.416990e+02, -3.743050e+02 },
+    { +1.273000e+03, +2.575521e-02, +7.435337e+03, -5.467624e+06, +3.997560e+06, +4.577053e+06, -4.888132e+06, +2.066362e+03, +2.622625e+03, +3.882710e+01, -3.393128e-02, +1.747750e-06, +6.711301e-05, -1.678886e-09, +1.772468e-15, +2.250000e+07, +1.941427e+04, +5.721642e+05, -1.483277e+00, +5.383549e+02, -3.320020e+02 },
+    // P = 25.0 MPa
+    { +2.712350e+02, +9.879827e-04, -2.851089e+01, +1.240017e+02, -7.609149e+03, +1.709042e+04, +2.482357e+04, +4.110856e+03, +4.110888e+03, +1.012163e+03, +7.767988e-03, +4.867878e-07, -1.532026e-02, -3.563378e-09, -1.144382e-15, +2.500000e+07, -1.595765e+04, +2.054283e+06, +3.123914e+04, +1.496068e+04, +9.920919e+03 },
+    { +2.750000e+02, +9.880560e-04, +2.815281e+01, +1.225940e+02, +7.864618e+03, +3.256602e+04, +2.482399e+04, +4.108787e+03, +4.110016e+03, +1.012088e+03, -4.660028e-02, +4.743482e-07, -1.362273e-02, -3.059161e-09, -1.069250e-15, +2.500000e+07, +9.824066e+04, +2.108156e+06, +3.000774e+04, +1.406275e+04, +1.001815e+04 },
+    { +2.800000e+02, +9.884422e-04, +1.022067e+02, -2.135160e+02, +2.840437e+04, +5.311542e+04, +2.449754e+04, +4.102718e+03, +4.109919e+03, +1.011693e+03, -1.100977e-01, +4.604848e-07, -1.185489e-02, -2.505240e-09, -9.957242e-16, +2.500000e+07, +2.390908e+05, +2.171624e+06, +2.846949e+04, +1.293731e+04, +1.019749e+04 },
+    { +2.850000e+02, +9.891194e-04, +1.749564e+02, -9.238837e+02, +4.893870e+04, +7.366668e+04, +2.380410e+04, +4.093643e+03, +4.110712e+03, +1.011000e+03, -1.658102e-01, +4.491326e-07, -1.048572e-02, -2.049659e-09, -9.436558e-16, +2.500000e+07, +3.691788e+05, +2.226514e+06, +2.700252e+04, +1.188794e+04, +1.041573e+04 },
+    { +2.900000e+02, +9.900549e-04, +2.464605e+02, -2.001323e+03, +6.947222e+04, +9.422359e+04, +2.275005e+04, +4.082149e+03, +4.112141e+03, +1.010045e+03, -2.154287e-01, +4.398659e-07, -9.402096e-03, -1.667708e-09, -9.070236e-16, +2.500000e+07, +4.897600e+05, +2.273420e+06, +2.558328e+04, +1.091539e+04, +1.065756e+04 },
+    { +2.950000e+02, +9.912236e-04, +3.167707e+02, -3.439104e+03, +9.000825e+04, +1.147888e+05, +2.134148e+04, +4.068636e+03, +4.114017e+03, +1.008854e+03, -2.601801e-01, +4.323613e-07, -8.528591e-03, -1.342441e-09, -8.819244e-16, +2.500000e+07, +6.017655e+05, +2.312880e+06, +2.420111e+04, +1.002027e+04, +1.091166e+04 },
+    { +3.000000e+02, +9.926053e-04, +3.859334e+02, -5.230878e+03, +1.105491e+05, +1.353643e+05, +1.958426e+04, +4.053394e+03, +4.116194e+03, +1.007450e+03, -3.009774e-01, +4.263674e-07, -7.813271e-03, -1.061728e-09, -8.657566e-16, +2.500000e+07, +7.059110e+05, +2.345395e+06, +2.285273e+04, +9.202281e+03, +1.116976e+04 },
+    { +3.050000e+02, +9.941842e-04, +4.539905e+02, -7.370612e+03, +1.310965e+05, +1.559511e+05, +1.748399e+04, +4.036643e+03, +4.118565e+03, +1.005850e+03, -3.385148e-01, +4.216849e-07, -7.219435e-03, -8.165821e-10, -8.567441e-16, +2.500000e+07, +8.027671e+05, +2.371439e+06, +2.153884e+04, +8.460038e+03, +1.142581e+04 },
+    { +3.100000e+02, +9.959474e-04, +5.209806e+02, -9.852555e+03, +1.516514e+05, +1.765501e+05, +1.504613e+04, +4.018566e+03, +4.121056e+03, +1.004069e+03, -3.733297e-01, +4.181538e-07, -6.720565e-03, -6.001538e-10, -8.536511e-16, +2.500000e+07, +8.928048e+05, +2.391465e+06, +2.026204e+04, +7.791121e+03, +1.167541e+04 },
+    { +3.150000e+02, +9.978842e-04, +5.869393e+02, -1.267120e+04, +1.722147e+05, +1.971618e+05, +1.227591e+04, +3.999321e+03, +4.123621e+03, +1.002120e+03, -4.058459e-01, +4.156444e-07, -6.297136e-03, -4.071021e-10, -8.556054e-16, +2.500000e+07, +9.764256e+05, +2.405903e+06, +1.902560e+04, +7.192261e+03, +1.191537e+04 },
+    { +3.200000e+02, +9.999861e-04, +6.519000e+02, -1.582125e+04, +1.927868e+05, +2.177864e+05, +9.178399e+03, +3.979055e+03, +4.126238e+03, +1.000014e+03, -4.364022e-01, +4.140509e-07, -5.934539e-03, -2.331845e-10, -8.619872e-16, +2.500000e+07, +1.053982e+06, +2.415162e+06, +1.783270e+04, +6.659564e+03, +1.214338e+04 },
+    { +3.250000e+02, +1.002246e-03, +7.158945e+02, -1.929763e+04, +2.133681e+05, +2.384242e+05, +5.758517e+03, +3.957902e+03, +4.128903e+03, +9.977591e+02, -4.652740e-01, +4.132864e-07, -5.621687e-03, -7.497777e-11, -8.723566e-16, +2.500000e+07, +1.125791e+06, +2.419629e+06, +1.668609e+04, +6.188721e+03, +1.235778e+04 },
+    { +3.300000e+02, +1.004658e-03, +7.789531e+02, -2.309544e+04, +2.339591e+05, +2.590755e+05, +2.021014e+03, +3.935992e+03, +4.131629e+03, +9.953636e+02, -4.926877e-01, +4.132797e-07, -5.350059e-03, +7.031781e-11, -8.864063e-16, +2.500000e+07, +1.192141e+06, +2.419669e+06, +1.558790e+04, +5.775195e+03, +1.255743e+04 },
+    { +3.350000e+02, +1.007217e-03, +8.411050e+02, -2.720994e+04, +2.545602e+05, +2.797407e+05, -2.029503e+03, +3.913446e+03, +4.134437e+03, +9.928343e+02, -5.188322e-01, +4.139720e-07, -5.113037e-03, +2.050205e-10, -9.039292e-16, +2.500000e+07, +1.253303e+06, +2.415622e+06, +1.453962e+04, +5.414374e+03, +1.274153e+04 },
+    { +3.400000e+02, +1.009920e-03, +9.023784e+02, -3.163658e+04, +2.751721e+05, +3.004201e+05, -6.388572e+03, +3.890378e+03, +4.137358e+03, +9.901772e+02, -5.438670e-01, +4.153155e-07, -4.905428e-03, +3.310716e-10, -9.247963e-16, +2.500000e+07, +1.309528e+06, +2.407808e+06, +1.354207e+04, +5.101689e+03, +1.290957e+04 },
+    { +3.450000e+02, +1.012764e-03, +9.628010e+02, -3.637096e+04, +2.957954e+05, +3.211145e+05, -1.105187e+04, +3.866896e+03, +4.140426e+03, +9.873973e+02, -5.679286e-01, +4.172710e-07, -4.723121e-03, +4.501153e-10, -9.489421e-16, +2.500000e+07, +1.361054e+06, +2.396524e+06, +1.259552e+04, +4.832703e+03, +1.306126e+04 },
+    { +3.500000e+02, +1.015745e-03, +1.022400e+03, -4.140883e+04, +3.164310e+05, +3.418247e+05, -1.601521e+04, +3.843098e+03, +4.143679e+03, +9.844993e+02, -5.911349e-01, +4.198073e-07, -4.562837e-03, +5.635594e-10, -9.763536e-16, +2.500000e+07, +1.408110e+06, +2.382045e+06, +1.169970e+04, +4.603169e+03, +1.319645e+04 },
+    { +3.550000e+02, +1.018862e-03, +1.081201e+03, -4.674609e+04, +3.370801e+05, +3.625516e+05, -2.127454e+04, +3.819077e+03, +4.147155e+03, +9.814872e+02, -6.135893e-01, +4.228993e-07, -4.421940e-03, +6.726232e-10, -1.007063e-15, +2.500000e+07, +1.450911e+06, +2.364629e+06, +1.085393e+04, +4.409076e+03, +1.331514e+04 },
+    { +3.600000e+02, +1.022114e-03, +1.139229e+03, -5.237878e+04, +3.577438e+05, +3.832967e+05, -2.682593e+04, +3.794915e+03, +4.150894e+03, +9.783645e+02, -6.353831e-01, +4.265280e-07, -4.298301e-03, +7.783755e-10, -1.041145e-15, +2.500000e+07, +1.489663e+06, +2.344512e+06, +1.005718e+04, +4.246670e+03, +1.341741e+04 },
+    { +3.650000e+02, +1.025500e-03, +1.196511e+03, -5.830308e+04, +3.784236e+05, +4.040611e+05, -3.266559e+04, +3.770688e+03, +4.154934e+03, +9.751343e+02, -6.565981e-01, +4.306792e-07, -4.190191e-03, +8.817649e-10, -1.078710e-15, +2.500000e+07, +1.524564e+06, +2.321914e+06, +9.308133e+03, +4.112465e+03, +1.350341e+04 },
+    { +3.700000e+02, +1.029019e-03, +1.253071e+03, -6.451531e+04, +3.991211e+05, +4.248465e+05, -3.878984e+04, +3.746462e+03, +4.159310e+03, +9.717994e+02, -6.773085e-01, +4.353431e-07, -4.096198e-03, +9.836449e-10, -1.119907e-15, +2.500000e+07, +1.555804e+06, +2.297039e+06, +8.605267e+03, +4.003248e+03, +1.357334e+04 },
+    { +3.750000e+02, +1.032672e-03, +1.308933e+03, -7.101193e+04, +4.198380e+05, +4.456548e+05, -4.519514e+04, +3.722298e+03, +4.164058e+03, +9.683620e+02, -6.975817e-01, +4.405144e-07, -4.015171e-03, +1.084794e-09, -1.164918e-15, +2.500000e+07, +1.583562e+06, +2.270073e+06, +7.946894e+03, +3.916072e+03, +1.362746e+04 },
+    { +3.800000e+02, +1.036458e-03, +1.364121e+03, -7.778950e+04, +4.405763e+05, +4.664878e+05, -5.187805e+04, +3.698249e+03, +4.169212e+03, +9.648242e+02, -7.174802e-01, +4.461911e-07, -3.946168e-03, +1.185934e-09, -1.213964e-15, +2.500000e+07, +1.608011e+06, +2.241192e+06, +7.331218e+03, +3.848247e+03, +1.366606e+04 },
+    { +3.850000e+02, +1.040380e-03, +1.418657e+03, -8.484474e+04, +4.613382e+05, +4.873477e+05, -5.883526e+04, +3.674361e+03, +4.174803e+03, +9.611877e+02, -7.370621e-01, +4.523748e-07, -3.888420e-03, +1.287743e-09, -1.267303e-15, +2.500000e+07, +1.629317e+06, +2.210556e+06, +6.756375e+03, +3.797325e+03, +1.368942e+04 },
+    { +3.900000e+02, +1.044437e-03, +1.472565e+03, -9.217448e+04, +4.821257e+05, +5.082366e+05, -6.606357e+04, +3.650673e+03, +4.180863e+03, +9.574540e+02, -7.563821e-01, +4.590707e-07, -3.841305e-03, +1.390869e-09, -1.325233e-15, +2.500000e+07, +1.647638e+06, +2.178314e+06, +6.220461e+03, +3.761090e+03, +1.369788e+04 },
+    { +3.950000e+02, +1.048631e-03, +1.525866e+03, -9.977567e+04, +5.029413e+05, +5.291571e+05, -7.355989e+04, +3.627219e+03, +4.187420e+03, +9.536242e+02, -7.754921e-01, +4.662868e-07, -3.804323e-03, +1.495942e-09, -1.388093e-15, +2.500000e+07, +1.663123e+06, +2.144603e+06, +5.721563e+03, +3.737537e+03, +1.369176e+04 },
+    { +4.000000e+02, +1.052965e-03, +1.578582e+03, -1.076454e+05, +5.237876e+05, +5.501117e+05, -8.132125e+04, +3.604029e+03, +4.194504e+03, +9.496993e+02, -7.944416e-01, +4.740344e-07, -3.777081e-03, +1.603582e-09, -1.456273e-15, +2.500000e+07, +1.675916e+06, +2.109552e+06, +5.257780e+03, +3.724861e+03, +1.367141e+04 },
+    { +4.100000e+02, +1.062060e-03, +1.682346e+03, -1.241792e+05, +5.655826e+05, +5.921341e+05, -9.762770e+04, +3.558532e+03, +4.210363e+03, +9.415667e+02, -8.320497e-01, +4.911849e-07, -3.750696e-03, +1.829064e-09, -1.610400e-15, +2.500000e+07, +1.693964e+06, +2.035893e+06, +4.428119e+03, +3.725801e+03, +1.358935e+04 },
+    { +4.200000e+02, +1.071744e-03, +1.784020e+03, -1.417548e+05, +6.075335e+05, +6.343271e+05, -1.149612e+05, +3.514330e+03, +4.228666e+03, +9.330586e+02, -8.695767e-01, +5.106753e-07, -3.760695e-03, +2.072462e-09, -1.791847e-15, +2.500000e+07, +1.702797e+06, +1.958191e+06, +3.717088e+03, +3.752804e+03, +1.345446e+04 },
+    { +4.300000e+02, +1.082047e-03, +1.883763e+03, -1.603528e+05, +6.496652e+05, +6.767163e+05, -1.333017e+05, +3.471520e+03, +4.249646e+03, +9.241742e+02, -9.073838e-01, +5.327124e-07, -3.806767e-03, +2.339373e-09, -2.006006e-15, +2.500000e+07, +1.703328e+06, +1.877185e+06, +3.111256e+03, +3.796965e+03, +1.326948e+04 },
+    { +4.400000e+02, +1.093005e-03, +1.981728e+03, -1.799557e+05, +6.920047e+05, +7.193298e+05, -1.526305e+05, +3.430157e+03, +4.273558e+03, +9.149088e+02, -9.458346e-01, +5.575622e-07, -3.889661e-03, +2.636151e-09, -2.259751e-15, +2.500000e+07, +1.696375e+06, +1.793522e+06, +2.598309e+03, +3.851168e+03, +1.303709e+04 },
+    { +4.500000e+02, +1.104662e-03, +2.078064e+03, -2.005473e+05, +7.345817e+05, +7.621982e+05, -1.729308e+05, +3.390269e+03, +4.300690e+03, +9.052541e+02, -9.853057e-01, +5.855597e-07, -4.011202e-03, +2.970269e-09, -2.561903e-15, +2.500000e+07, +1.682673e+06, +1.707768e+06, +2.167095e+03, +3.909754e+03, +1.275996e+04 },
+    { +4.600000e+02, +1.117071e-03, +2.172918e+03, -2.221137e+05, +7.774286e+05, +8.053554e+05, -1.941869e+05, +3.351864e+03, +4.331378e+03, +8.951979e+02, -1.026197e+00, +6.171220e-07, -4.174406e-03, +3.350770e-09, -2.923866e-15, +2.500000e+07, +1.662876e+06, +1.620425e+06, +1.807625e+03, +3.968227e+03, +1.244069e+04 },
+    { +4.700000e+02, +1.130296e-03, +2.266433e+03, -2.446421e+05, +8.205815e+05, +8.488389e+05, -2.163847e+05, +3.314940e+03, +4.366022e+03, +8.847240e+02, -1.068947e+00, +6.527668e-07, -4.383694e-03, +3.788867e-09, -3.360538e-15, +2.500000e+07, +1.637564e+06, +1.531941e+06, +1.511014e+03, +4.023023e+03, +1.208188e+04 },
+    { +4.800000e+02, +1.144412e-03, +2.358755e+03, -2.681219e+05, +8.640804e+05, +8.926907e+05, -2.395116e+05, +3.279486e+03, +4.405106e+03, +8.738112e+02, -1.114045e+00, +6.931382e-07, -4.645239e-03, +4.298762e-09, -3.891613e-15, +2.500000e+07, +1.607248e+06, +1.442714e+06, +1.269420e+03, +4.071321e+03, +1.168612e+04 },
+    { +4.900000e+02, +1.159510e-03, +2.450029e+03, -2.925440e+05, +9.079701e+05, +9.369578e+05, -2.635563e+05, +3.245494e+03, +4.449223e+03, +8.624334e+02, -1.162054e+00, +7.390419e-07, -4.967500e-03, +4.898801e-09, -4.543492e-15, +2.500000e+07, +1.572379e+06, +1.353103e+06, +1.075958e+03, +4.110879e+03, +1.125596e+04 },
+    { +5.000000e+02, +1.175698e-03, +2.540407e+03, -3.179016e+05, +9.523019e+05, +9.816943e+05, -2.885092e+05, +3.212961e+03, +4.499108e+03, +8.505582e+02, -1.213636e+00, +7.914944e-07, -5.362009e-03, +5.613162e-09, -5.352126e-15, +2.500000e+07, +1.533347e+06, +1.263433e+06, +9.246136e+02, +4.139914e+03, +1.079401e+04 },
+    { +5.100000e+02, +1.193109e-03, +2.630048e+03, -3.441897e+05, +9.971346e+05, +1.026962e+06, -3.143620e+05, +3.181895e+03, +4.555689e+03, +8.381461e+02, -1.269587e+00, +8.517932e-07, -5.844575e-03, +6.474361e-09, -6.367360e-15, +2.500000e+07, +1.490487e+06, +1.173994e+06, +8.101656e+02, +4.156987e+03, +1.030284e+04 },
+    { +5.200000e+02, +1.211903e-03, +2.719120e+03, -3.714058e+05, +1.042537e+06, +1.072834e+06, -3.411082e+05, +3.152320e+03, +4.620144e+03, +8.251486e+02, -1.330893e+00, +9.216181e-07, -6.437110e-03, +7.527097e-09, -7.659737e-15, +2.500000e+07, +1.444083e+06, +1.085048e+06, +7.281023e+02, +4.160914e+03, +9.785002e+03 },
+    { +5.300000e+02, +1.232276e-03, +2.807811e+03, -3.995500e+05, +1.088590e+06, +1.119396e+06, -3.687431e+05, +3.124285e+03, +4.694007e+03, +8.115063e+02, -1.398797e+00, +1.003180e-06, -7.170486e-03, +8.834295e-09, -9.331443e-15, +2.500000e+07, +1.394363e+06, +9.968297e+05, +6.745510e+02, +4.150678e+03, +9.242975e+03 },
+    { +5.400000e+02, +1.254476e-03, +2.896326e+03, -4.286257e+05, +1.135391e+06, +1.166752e+06, -3.972638e+05, +3.097872e+03, +4.779301e+03, +7.971454e+02, -1.474918e+00, +1.099451e-06, -8.089103e-03, +1.048694e-08, -1.153452e-14, +2.500000e+07, +1.341504e+06, +9.095451e+05, +6.462119e+02, +4.125338e+03, +8.679055e+03 },
+    { +5.500000e+02, +1.278816e-03, +2.984908e+03, -4.586402e+05, +1.183059e+06, +1.215030e+06, -4.266698e+05, +3.073211e+03, +4.878766e+03, +7.819735e+02, -1.561411e+00, +1.214515e-06, -9.258410e-03, +1.262057e-08, -1.450231e-14, +2.500000e+07, +1.285626e+06, +8.233743e+05, +6.403024e+02, +4.083927e+03, +8.095229e+03 },
+    { +5.600000e+02, +1.305700e-03, +3.073840e+03, -4.896057e+05, +1.231745e+06, +1.264387e+06, -4.569632e+05, +3.050495e+03, +4.996198e+03, +7.658728e+02, -1.661247e+00, +1.354149e-06, -1.077776e-02, +1.544423e-08, -1.860602e-14, +2.500000e+07, +1.226783e+06, +7.384713e+05, +6.545139e+02, +4.025325e+03, +7.492977e+03 },
+    { +5.700000e+02, +1.335666e-03, +3.163474e+03, -5.215406e+05, +1.281640e+06, +1.315031e+06, -4.881490e+05, +3.030015e+03, +5.137032e+03, +7.486902e+02, -1.778644e+00, +1.526794e-06, -1.280338e-02, +1.929348e-08, -2.446181e-14, +2.500000e+07, +1.164953e+06, +6.549674e+05, +6.869902e+02, +3.948089e+03, +6.873019e+03 },
+    { +5.800000e+02, +1.369448e-03, +3.254257e+03, -5.544727e+05, +1.332996e+06, +1.367233e+06, -5.202365e+05, +3.012205e+03, +5.309328e+03, +7.302210e+02, -1.919837e+00, +1.745275e-06, -1.559172e-02, +2.473347e-08, -3.314593e-14, +2.500000e+07, +1.100020e+06, +5.729757e+05, +7.363475e+02, +3.850222e+03, +6.235035e+03 },
+    { +5.900000e+02, +1.408088e-03, +3.346786e+03, -5.884421e+05, +1.386161e+06, +1.421364e+06, -5.532399e+05, +2.997727e+03, +5.525590e+03, +7.101827e+02, -2.094463e+00, +2.030036e-06, -1.958744e-02, +3.277417e-08, -4.666017e-14, +2.500000e+07, +1.031737e+06, +4.926020e+05, +8.017845e+02, +3.728867e+03, +5.577439e+03 },
+    { +6.000000e+02, +1.453132e-03, +3.441897e+03, -6.235090e+05, +1.441629e+06, +1.477958e+06, -5.871807e+05, +2.987629e+03, +5.806354e+03, +6.881690e+02, -2.318290e+00, +2.415704e-06, -2.562104e-02, +4.536511e-08, -6.904039e-14, +2.500000e+07, +9.596744e+05, +4.139579e+05, +8.834088e+02, +3.579940e+03, +4.897472e+03 },
+    { +6.100000e+02, +1.507017e-03, +3.540843e+03, -6.597660e+05, +1.500148e+06, +1.537824e+06, -6.220906e+05, +2.983672e+03, +6.188117e+03, +6.635626e+02, -2.619213e+00, +2.965889e-06, -3.542516e-02, +6.670125e-08, -1.093748e-13, +2.500000e+07, +8.831124e+05, +3.371671e+05, +9.831222e+02, +3.397834e+03, +4.192305e+03 },
+    { +6.200000e+02, +1.573937e-03, +3.645658e+03, -6.973654e+05, +1.562942e+06, +1.602291e+06, -6.580170e+05, +2.989104e+03, +6.743993e+03, +6.353495e+02, -3.052909e+00, +3.812387e-06, -5.331077e-02, +1.074576e-07, -1.918278e-13, +2.500000e+07, +8.007868e+05, +2.623029e+05, +1.107140e+03, +3.175630e+03, +3.461950e+03 },
+    { +6.300000e+02, +1.662136e-03, +3.760126e+03, -7.365888e+05, +1.632291e+06, +1.673844e+06, -6.950354e+05, +3.010983e+03, +7.652332e+03, +6.016355e+02, -3.755134e+00, +5.287866e-06, -9.322490e-02, +2.030296e-07, -4.002953e-13, +2.500000e+07, +7.101418e+05, +1.891122e+05, +1.273620e+03, +2.905306e+03, +2.707318e+03 },
+    { +6.400000e+02, +1.792180e-03, +3.893113e+03, -7.780840e+05, +1.713508e+06, +1.758313e+06, -7.332795e+05, +3.069585e+03, +9.504195e+03, +5.579797e+02, -5.175918e+00, +8.558461e-06, -2.175216e-01, +5.253978e-07, -1.178598e-12, +2.500000e+07, +6.047720e+05, +1.168434e+05, +1.530784e+03, +2.558258e+03, +1.880091e+03 },
+    { +6.500000e+02, +2.045634e-03, +4.076007e+03, -8.241934e+05, +1.825211e+06, +1.876352e+06, -7.730526e+05, +3.250556e+03, +1.570088e+04, +4.888460e+02, -9.811170e+00, +2.102956e-05, -1.022022e+00, +2.949126e-06, -8.116192e-12, +2.500000e+07, +4.665419e+05, +4.755212e+04, +1.750948e+03, +1.893573e+03, +8.726937e+02 },
+    { +6.750000e+02, +6.188183e-03, +5.174332e+03, -1.045585e+06, +2.447089e+06, +2.601793e+06, -8.908809e+05, +3.152753e+03, +1.203234e+04, +1.615983e+02, -2.505606e+00, +1.827523e-05, +1.631637e-01, -8.384809e-07, +3.765828e-12, +2.500000e+07, +1.371039e+05, +5.471888e+04, -2.207221e+02, +9.646303e+02, -6.169814e+02 },
+    { +7.000000e+02, +7.994117e-03, +5.488525e+03, -1.224428e+06, +2.617540e+06, +2.817393e+06, -1.024575e+06, +2.689449e+03, +6.624380e+03, +1.250920e+02, -9.039790e-01, +9.290064e-06, +2.471225e-02, -1.578124e-07, +7.745686e-13, +2.500000e+07, +9.730601e+04, +1.076419e+05, -1.435985e+02, +9.552391e+02, -9.660592e+02 },
+    { +7.250000e+02, +9.260434e-03, +5.688738e+03, -1.395933e+06, +2.728402e+06, +2.959913e+06, -1.164422e+06, +2.438176e+03, +5.002075e+03, +1.079863e+02, -5.263825e-01, +6.718968e-06, +9.164526e-03, -6.755513e-08, +3.396494e-13, +2.500000e+07, +7.834276e+04, +1.488324e+05, -9.886090e+01, +9.069993e+02, -1.119755e+03 },
+    { +7.500000e+02, +1.029888e-02, +5.843566e+03, -1.566114e+06, +2.816560e+06, +3.074032e+06, -1.308642e+06, +2.280584e+03, +4.205542e+03, +9.709792e+01, -3.631723e-01, +5.450616e-06, +4.632653e-03, -3.826978e-08, +1.919476e-13, +2.500000e+07, +6.662959e+04, +1.834655e+05, -7.063510e+01, +8.576599e+02, -1.185348e+03 },
+    { +7.750000e+02, +1.120671e-02, +5.973210e+03, -1.736561e+06, +2.892677e+06, +3.172845e+06, -1.456393e+06, +2.175933e+03, +3.735981e+03, +8.923224e+01, -2.738257e-01, +4.678089e-06, +2.750916e-03, -2.502621e-08, +1.232377e-13, +2.500000e+07, +5.853365e+04, +2.137625e+05, -5.202990e+01, +8.139386e+02, -1.203755e+03 },
+    { +8.000000e+02, +1.202903e-02, +6.086687e+03, -1.907895e+06, +2.961455e+06, +3.262181e+06, -1.607169e+06, +2.104378e+03, +3.430969e+03, +8.313226e+01, -2.180830e-01, +4.150088e-06, +1.804797e-03, -1.786351e-08, +8.540820e-14, +2.500000e+07, +5.254900e+04, +2.409587e+05, -3.933022e+01, +7.765904e+02, -1.194889e+03 },
+    { +8.250000e+02, +1.279085e-02, +6.188856e+03, -2.080405e+06, +3.025402e+06, +3.345173e+06, -1.760633e+06, +2.054805e+03, +3.220601e+03, +7.818087e+01, -1.802539e-01, +3.761833e-06, +1.267569e-03, -1.352526e-08, +6.225966e-14, +2.500000e+07, +4.791649e+04, +2.658278e+05, -3.039737e+01, +7.449443e+02, -1.169521e+03 },
+    { +8.500000e+02, +1.350765e-02, +6.282640e+03, -2.254233e+06, +3.086010e+06, +3.423701e+06, -1.916542e+06, +2.020471e+03, +3.069577e+03, +7.403213e+01, -1.530223e-01, +3.461531e-06, +9.355155e-04, -1.068316e-08, +4.702971e-14, +2.500000e+07, +4.420653e+04, +2.888895e+05, -2.394632e+01, +7.180768e+02, -1.133881e+03 },
+    { +9.000000e+02, +1.484401e-02, +6.452035e+03, -2.606096e+06, +3.200735e+06, +3.571836e+06, -2.234996e+06, +1.981694e+03, +2.874244e+03, +6.736725e+01, -1.166158e-01, +3.021530e-06, +5.660051e-04, -7.279309e-09, +2.884170e-14, +2.500000e+07, +3.859494e+04, +3.309581e+05, -1.558080e+01, +6.754002e+02, -1.045538e+03 },
+    { +9.500000e+02, +1.608925e-02, +6.604143e+03, -2.963691e+06, +3.310245e+06, +3.712476e+06, -2.561460e+06, +1.967728e+03, +2.761303e+03, +6.215329e+01, -9.350314e-02, +2.709317e-06, +3.772787e-04, -5.372328e-09, +1.882416e-14, +2.500000e+07, +3.451170e+04, +3.690967e+05, -1.066063e+01, +6.433812e+02, -9.465343e+02 },
+    { +1.000000e+03, +1.727155e-02, +6.743934e+03, -3.326995e+06, +3.416940e+06, +3.848729e+06, -2.895206e+06, +1.968509e+03, +2.694666e+03, +5.789868e+01, -7.758132e-02, +2.472558e-06, +2.686728e-04, -4.182709e-09, +1.276012e-14, +2.500000e+07, +3.137695e+04, +4.044395e+05, -7.584837e+00, +6.186815e+02, -8.441421e+02 },
+    { +1.050000e+03, +1.840806e-02, +6.874388e+03, -3.695900e+06, +3.522208e+06, +3.982409e+06, -3.235698e+06, +1.978517e+03, +2.656270e+03, +5.432402e+01, -6.596924e-02, +2.284636e-06, +2.007014e-04, -3.382780e-09, +8.845463e-15, +2.500000e+07, +2.887517e+04, +4.377066e+05, -5.567541e+00, +5.991627e+02, -7.417708e+02 },
+    { +1.100000e+03, +1.951001e-02, +6.997435e+03, -4.070272e+06, +3.626907e+06, +4.114657e+06, -3.582521e+06, +1.994472e+03, +2.636087e+03, +5.125575e+01, -5.713737e-02, +2.130460e-06, +1.554291e-04, -2.814312e-09, +6.199051e-15, +2.500000e+07, +2.681927e+04, +4.693822e+05, -4.192675e+00, +5.834194e+02, -6.410695e+02 },
+    { +1.150000e+03, +2.058508e-02, +7.114401e+03, -4.449968e+06, +3.731593e+06, +4.246220e+06, -3.935341e+06, +2.014301e+03, +2.628110e+03, +4.857886e+01, -5.020116e-02, +2.000773e-06, +1.237943e-04, -2.392847e-09, +4.347646e-15, +2.500000e+07, +2.509088e+04, +4.998068e+05, -3.225770e+00, +5.704992e+02, -5.428261e+02 },
+    { +1.200000e+03, +2.163882e-02, +7.226236e+03, -4.834847e+06, +3.836637e+06, +4.377607e+06, -4.293876e+06, +2.036629e+03, +2.628521e+03, +4.621325e+01, -4.461449e-02, +1.889546e-06, +1.008319e-04, -2.069742e-09, +3.018239e-15, +2.500000e+07, +2.361123e+04, +5.292277e+05, -2.527728e+00, +5.597377e+02, -4.473850e+02 },
+    { +1.250000e+03, +2.267527e-02, +7.333648e+03, -5.224772e+06, +3.942288e+06, +4.509170e+06, -4.657890e+06, +2.060506e+03, +2.634784e+03, +4.410090e+01, -4.002235e-02, +1.792661e-06, +8.364228e-05, -1.815256e-09, +2.044308e-15, +2.500000e+07, +2.232567e+04, +5.578300e+05, -2.012443e+00, +5.506589e+02, -3.548559e+02 },
+    { +1.273000e+03, +2.314712e-02, +7.381726e+03, -5.405797e+06, +3.991140e+06, +4.569818e+06, -4.827119e+06, +2.071818e+03, +2.639128e+03, +4.320192e+01, -3.817466e-02, +1.752073e-06, +7.715503e-05, -1.715711e-09, +1.684899e-15, +2.500000e+07, +2.178828e+04, +5.707524e+05, -1.820778e+00, +5.469481e+02, -3.132687e+02 },
+    // P = 30.0 MPa
+    { +2.708290e+02, +9.856238e-04, -3.464430e+01, +1.760419e+02, -9.206640e+03, +2.036207e+04, +2.974475e+04, +4.091032e+03, +4.091040e+03, +1.014586e+03, -3.795716e-03, +4.825208e-07, -1.480322e-02, -3.507421e-09, -1.136616e-15, +3.000000e+07, +7.866430e+03, +2.072449e+06, +3.079343e+04, +1.510294e+04, +1.011732e+04 },
+    { +2.750000e+02, +9.857589e-04, +2.788901e+01, +1.857487e+02, +7.855227e+03, +3.742799e+04, +2.975852e+04, +4.090001e+03, +4.092168e+03, +1.014447e+03, -6.167974e-02, +4.690405e-07, -1.302357e-02, -2.972874e-09, -1.053880e-15, +3.000000e+07, +1.315019e+05, +2.132012e+06, +2.947223e+04, +1.414307e+04, +1.021316e+04 },
+    { +2.800000e+02, +9.862098e-04, +1.016398e+02, -1.521405e+02, +2.830702e+04, +5.789331e+04, +2.943415e+04, +4.085073e+03, +4.094040e+03, +1.013983e+03, -1.224704e-01, +4.555423e-07, -1.136558e-02, -2.443955e-09, -9.813421e-16, +3.000000e+07, +2.688454e+05, +2.195186e+06, +2.798994e+04, +1.304838e+04, +1.038089e+04 },
+    { +2.850000e+02, +9.869386e-04, +1.741223e+02, -8.639263e+02, +4.876093e+04, +7.836909e+04, +2.874423e+04, +4.076994e+03, +4.096330e+03, +1.013234e+03, -1.759496e-01, +4.444498e-07, -1.007785e-02, -2.006092e-09, -9.295169e-16, +3.000000e+07, +3.958818e+05, +2.249973e+06, +2.657641e+04, +1.201844e+04, +1.058739e+04 },
+    { +2.900000e+02, +9.879148e-04, +2.453867e+02, -1.942483e+03, +6.921966e+04, +9.885711e+04, +2.769496e+04, +4.066388e+03, +4.098918e+03, +1.012233e+03, -2.236911e-01, +4.353668e-07, -9.056508e-03, -1.637185e-09, -8.926882e-16, +3.000000e+07, +5.137992e+05, +2.296914e+06, +2.520757e+04, +1.105730e+04, +1.081767e+04 },
+    { +2.950000e+02, +9.891148e-04, +3.154789e+02, -3.381126e+03, +8.968514e+04, +1.193586e+05, +2.629232e+04, +4.053684e+03, +4.101700e+03, +1.011005e+03, -2.668411e-01, +4.279889e-07, -8.231721e-03, -1.321873e-09, -8.671217e-16, +3.000000e+07, +6.234768e+05, +2.336509e+06, +2.387236e+04, +1.016792e+04, +1.106070e+04 },
+    { +3.000000e+02, +9.905199e-04, +3.844408e+02, -5.173541e+03, +1.101587e+05, +1.398743e+05, +2.454206e+04, +4.039186e+03, +4.104592e+03, +1.009571e+03, -3.062546e-01, +4.220774e-07, -7.555170e-03, -1.049020e-09, -8.503091e-16, +3.000000e+07, +7.255887e+05, +2.369233e+06, +2.256731e+04, +9.351672e+03, +1.130838e+04 },
+    { +3.050000e+02, +9.921151e-04, +4.523110e+02, -7.313723e+03, +1.306411e+05, +1.604046e+05, +2.244973e+04, +4.023128e+03, +4.107531e+03, +1.007948e+03, -3.425823e-01, +4.174419e-07, -6.992575e-03, -8.102828e-10, -8.405246e-16, +3.000000e+07, +8.206704e+05, +2.395543e+06, +2.129307e+04, +8.608376e+03, +1.155479e+04 },
+    { +3.100000e+02, +9.938883e-04, +5.191255e+02, -9.795942e+03, +1.511329e+05, +1.809496e+05, +2.002071e+04, +4.005699e+03, +4.110471e+03, +1.006149e+03, -3.763286e-01, +4.139285e-07, -6.519110e-03, -5.992405e-10, -8.365578e-16, +3.000000e+07, +9.091631e+05, +2.415876e+06, +2.005227e+04, +7.936461e+03, +1.179560e+04 },
+    { +3.150000e+02, +9.958295e-04, +5.849177e+02, -1.261471e+04, +1.716344e+05, +2.015093e+05, +1.726018e+04, +3.987065e+03, +4.113391e+03, +1.004188e+03, -4.078912e-01, +4.114118e-07, -6.116474e-03, -4.108466e-10, -8.375478e-16, +3.000000e+07, +9.914424e+05, +2.430654e+06, +1.884829e+04, +7.333270e+03, +1.202761e+04 },
+    { +3.200000e+02, +9.979308e-04, +6.497196e+02, -1.576474e+04, +1.921455e+05, +2.220835e+05, +1.417318e+04, +3.967375e+03, +4.116284e+03, +1.002074e+03, -4.375883e-01, +4.097891e-07, -5.770963e-03, -2.410664e-10, -8.428774e-16, +3.000000e+07, +1.067838e+06, +2.440280e+06, +1.768451e+04, +6.795347e+03, +1.224851e+04 },
+    { +3.250000e+02, +1.000185e-03, +7.135615e+02, -1.924098e+04, +2.126665e+05, +2.426721e+05, +1.076458e+04, +3.946768e+03, +4.119161e+03, +9.998147e+02, -4.656785e-01, +4.089756e-07, -5.472178e-03, -8.662754e-11, -8.521041e-16, +3.000000e+07, +1.138646e+06, +2.445133e+06, +1.656387e+04, +6.318700e+03, +1.245662e+04 },
+    { +3.300000e+02, +1.002588e-03, +7.764726e+02, -2.303851e+04, +2.331974e+05, +2.632751e+05, +7.039115e+03, +3.925376e+03, +4.122043e+03, +9.974190e+02, -4.923746e-01, +4.089017e-07, -5.212127e-03, +5.515686e-11, -8.649143e-16, +3.000000e+07, +1.204139e+06, +2.445575e+06, +1.548875e+04, +5.899023e+03, +1.265075e+04 },
+    { +3.350000e+02, +1.005133e-03, +8.384812e+02, -2.715264e+04, +2.537386e+05, +2.838926e+05, +3.001360e+03, +3.903322e+03, +4.124959e+03, +9.948930e+02, -5.178539e-01, +4.095099e-07, -4.984606e-03, +1.865182e-10, -8.810925e-16, +3.000000e+07, +1.264570e+06, +2.441944e+06, +1.446086e+04, +5.531869e+03, +1.283005e+04 },
+    { +3.400000e+02, +1.007818e-03, +8.996148e+02, -3.157879e+04, +2.742902e+05, +3.045248e+05, -1.344239e+03, +3.880722e+03, +4.127945e+03, +9.922423e+02, -5.422667e-01, +4.107527e-07, -4.784748e-03, +3.093290e-10, -9.004993e-16, +3.000000e+07, +1.320178e+06, +2.434555e+06, +1.348126e+04, +5.212791e+03, +1.299398e+04 },
+    { +3.450000e+02, +1.010640e-03, +9.599002e+02, -3.631258e+04, +2.948530e+05, +3.251722e+05, -5.993374e+03, +3.857685e+03, +4.131040e+03, +9.894719e+02, -5.657411e-01, +4.125916e-07, -4.608701e-03, +4.251768e-10, -9.230569e-16, +3.000000e+07, +1.371189e+06, +2.423704e+06, +1.255043e+04, +4.937437e+03, +1.314218e+04 },
+    { +3.500000e+02, +1.013596e-03, +1.019364e+03, -4.134975e+04, +3.154276e+05, +3.458354e+05, -1.094187e+04, +3.834312e+03, +4.134285e+03, +9.865862e+02, -5.883882e-01, +4.149951e-07, -4.453393e-03, +5.354216e-10, -9.487385e-16, +3.000000e+07, +1.417820e+06, +2.409667e+06, +1.166832e+04, +4.701625e+03, +1.327448e+04 },
+    { +3.550000e+02, +1.016685e-03, +1.078031e+03, -4.668622e+04, +3.360148e+05, +3.665154e+05, -1.618568e+04, +3.810694e+03, +4.137721e+03, +9.835892e+02, -6.103054e-01, +4.179384e-07, -4.316354e-03, +6.412408e-10, -9.775614e-16, +3.000000e+07, +1.460276e+06, +2.392697e+06, +1.083445e+04, +4.501387e+03, +1.339082e+04 },
+    { +3.600000e+02, +1.019904e-03, +1.135928e+03, -5.231802e+04, +3.566159e+05, +3.872130e+05, -2.172090e+04, +3.786918e+03, +4.141388e+03, +9.804843e+02, -6.315789e-01, +4.214019e-07, -4.195587e-03, +7.436649e-10, -1.009582e-15, +3.000000e+07, +1.498757e+06, +2.373032e+06, +1.004798e+04, +4.333001e+03, +1.349125e+04 },
+    { +3.650000e+02, +1.023254e-03, +1.193078e+03, -5.824134e+04, +3.772321e+05, +4.079297e+05, -2.754372e+04, +3.763058e+03, +4.145326e+03, +9.772744e+02, -6.522857e-01, +4.253709e-07, -4.089469e-03, +8.436068e-10, -1.044891e-15, +3.000000e+07, +1.533452e+06, +2.350889e+06, +9.307742e+03, +4.193002e+03, +1.357587e+04 },
+    { +3.700000e+02, +1.026734e-03, +1.249506e+03, -6.445249e+04, +3.978648e+05, +4.286668e+05, -3.365047e+04, +3.739183e+03, +4.149571e+03, +9.739622e+02, -6.724957e-01, +4.298352e-07, -3.996673e-03, +9.418854e-10, -1.083617e-15, +3.000000e+07, +1.564543e+06, +2.326473e+06, +8.612379e+03, +4.078191e+03, +1.364488e+04 },
+    { +3.750000e+02, +1.030343e-03, +1.305236e+03, -7.094792e+04, +4.185157e+05, +4.494260e+05, -4.003761e+04, +3.715354e+03, +4.154160e+03, +9.705501e+02, -6.922728e-01, +4.347882e-07, -3.916113e-03, +1.039245e-09, -1.125916e-15, +3.000000e+07, +1.592207e+06, +2.299970e+06, +7.960341e+03, +3.985629e+03, +1.369849e+04 },
+    { +3.800000e+02, +1.034083e-03, +1.360291e+03, -7.772421e+04, +4.391865e+05, +4.702090e+05, -4.670171e+04, +3.691624e+03, +4.159125e+03, +9.670401e+02, -7.116758e-01, +4.402272e-07, -3.846897e-03, +1.136371e-09, -1.171983e-15, +3.000000e+07, +1.616610e+06, +2.271554e+06, +7.349957e+03, +3.912630e+03, +1.373696e+04 },
+    { +3.850000e+02, +1.037954e-03, +1.414694e+03, -8.477806e+04, +4.598793e+05, +4.910179e+05, -5.363944e+04, +3.668040e+03, +4.164498e+03, +9.634339e+02, -7.307595e-01, +4.461526e-07, -3.788295e-03, +1.233906e-09, -1.222043e-15, +3.000000e+07, +1.637914e+06, +2.241385e+06, +6.779475e+03, +3.856750e+03, +1.376056e+04 },
+    { +3.900000e+02, +1.041956e-03, +1.468468e+03, -9.210630e+04, +4.805960e+05, +5.118547e+05, -6.084760e+04, +3.644643e+03, +4.170310e+03, +9.597330e+02, -7.495754e-01, +4.525680e-07, -3.739709e-03, +1.332459e-09, -1.276359e-15, +3.000000e+07, +1.656271e+06, +2.209613e+06, +6.247092e+03, +3.815770e+03, +1.376960e+04 },
+    { +3.950000e+02, +1.046092e-03, +1.521633e+03, -9.970587e+04, +5.013390e+05, +5.327218e+05, -6.832310e+04, +3.621466e+03, +4.176588e+03, +9.559385e+02, -7.681724e-01, +4.594799e-07, -3.700655e-03, +1.432617e-09, -1.335231e-15, +3.000000e+07, +1.671830e+06, +2.176374e+06, +5.750987e+03, +3.787685e+03, +1.376439e+04 },
+    { +4.000000e+02, +1.050363e-03, +1.574211e+03, -1.075739e+05, +5.221105e+05, +5.536214e+05, -7.606295e+04, +3.598541e+03, +4.183360e+03, +9.520515e+02, -7.865972e-01, +4.668978e-07, -3.670746e-03, +1.534956e-09, -1.399001e-15, +3.000000e+07, +1.684731e+06, +2.141796e+06, +5.289340e+03, +3.770684e+03, +1.374525e+04 },
+    { +4.100000e+02, +1.059319e-03, +1.677691e+03, -1.241038e+05, +5.637493e+05, +5.955289e+05, -9.232428e+04, +3.553537e+03, +4.198494e+03, +9.440027e+02, -8.231083e-01, +4.833038e-07, -3.637219e-03, +1.748465e-09, -1.542830e-15, +3.000000e+07, +1.703087e+06, +2.069092e+06, +4.462259e+03, +3.763583e+03, +1.366650e+04 },
+    { +4.200000e+02, +1.068844e-03, +1.779068e+03, -1.416751e+05, +6.055336e+05, +6.375990e+05, -1.096098e+05, +3.509782e+03, +4.215920e+03, +9.355899e+02, -8.594543e-01, +5.019194e-07, -3.637551e-03, +1.977660e-09, -1.711562e-15, +3.000000e+07, +1.712335e+06, +1.992352e+06, +3.751943e+03, +3.783328e+03, +1.353601e+04 },
+    { +4.300000e+02, +1.078966e-03, +1.878500e+03, -1.602681e+05, +6.474867e+05, +6.798556e+05, -1.278992e+05, +3.467375e+03, +4.235853e+03, +9.268131e+02, -8.959702e-01, +5.229259e-07, -3.671171e-03, +2.227536e-09, -1.909902e-15, +3.000000e+07, +1.713379e+06, +1.912317e+06, +3.145342e+03, +3.820970e+03, +1.335644e+04 },
+    { +4.400000e+02, +1.089718e-03, +1.976134e+03, -1.798653e+05, +6.896336e+05, +7.223251e+05, -1.471738e+05, +3.426375e+03, +4.258519e+03, +9.176688e+02, -9.329897e-01, +5.465575e-07, -3.738415e-03, +2.503673e-09, -2.143811e-15, +3.000000e+07, +1.707029e+06, +1.829634e+06, +2.630434e+03, +3.869359e+03, +1.313043e+04 },
+    { +4.500000e+02, +1.101139e-03, +2.072116e+03, -2.004505e+05, +7.320018e+05, +7.650360e+05, -1.674163e+05, +3.386810e+03, +4.284174e+03, +9.081505e+02, -9.708546e-01, +5.731083e-07, -3.840521e-03, +2.812529e-09, -2.420865e-15, +3.000000e+07, +1.694016e+06, +1.744871e+06, +2.196296e+03, +3.922798e+03, +1.286058e+04 },
+    { +4.600000e+02, +1.113279e-03, +2.166588e+03, -2.220094e+05, +7.746212e+05, +8.080195e+05, -1.886111e+05, +3.348688e+03, +4.313109e+03, +8.982477e+02, -1.009924e+00, +6.029426e-07, -3.979686e-03, +3.161798e-09, -2.750767e-15, +3.000000e+07, +1.674991e+06, +1.658533e+06, +1.833105e+03, +3.976764e+03, +1.254948e+04 },
+    { +4.700000e+02, +1.126194e-03, +2.259689e+03, -2.445293e+05, +8.175244e+05, +8.513102e+05, -2.107435e+05, +3.312006e+03, +4.345670e+03, +8.879467e+02, -1.050583e+00, +6.365100e-07, -4.159213e-03, +3.560869e-09, -3.146044e-15, +3.000000e+07, +1.650536e+06, +1.571067e+06, +1.532100e+03, +4.027668e+03, +1.219970e+04 },
+    { +4.800000e+02, +1.139953e-03, +2.351556e+03, -2.679993e+05, +8.607478e+05, +8.949464e+05, -2.338007e+05, +3.276752e+03, +4.382268e+03, +8.772294e+02, -1.093258e+00, +6.743647e-07, -4.383739e-03, +4.021439e-09, -3.623043e-15, +3.000000e+07, +1.621167e+06, +1.482877e+06, +1.285518e+03, +4.072668e+03, +1.181378e+04 },
+    { +4.900000e+02, +1.154637e-03, +2.442330e+03, -2.924101e+05, +9.043316e+05, +9.389707e+05, -2.577710e+05, +3.242913e+03, +4.423403e+03, +8.660732e+02, -1.138428e+00, +7.171928e-07, -4.659597e-03, +4.558356e-09, -4.203354e-15, +3.000000e+07, +1.587339e+06, +1.394325e+06, +1.086523e+03, +4.109515e+03, +1.139431e+04 },
+    { +5.000000e+02, +1.170343e-03, +2.532151e+03, -3.177544e+05, +9.483213e+05, +9.834316e+05, -2.826441e+05, +3.210479e+03, +4.469686e+03, +8.544507e+02, -1.186649e+00, +7.658496e-07, -4.995342e-03, +5.190819e-09, -4.915884e-15, +3.000000e+07, +1.549454e+06, +1.305739e+06, +9.291178e+02, +4.136422e+03, +1.094388e+04 },
+    { +5.100000e+02, +1.187186e-03, +2.621168e+03, -3.440269e+05, +9.927685e+05, +1.028384e+06, -3.084113e+05, +3.179451e+03, +4.521877e+03, +8.423279e+02, -1.238573e+00, +8.214110e-07, -5.402530e-03, +5.944110e-09, -5.799945e-15, +3.000000e+07, +1.507860e+06, +1.217417e+06, +8.080671e+02, +4.151962e+03, +1.046508e+04 },
+    { +5.200000e+02, +1.205307e-03, +2.709533e+03, -3.712245e+05, +1.037733e+06, +1.073892e+06, -3.350653e+05, +3.149839e+03, +4.580929e+03, +8.296642e+02, -1.294989e+00, +8.852463e-07, -5.896877e-03, +6.852171e-09, -6.909945e-15, +3.000000e+07, +1.462858e+06, +1.129629e+06, +7.188161e+02, +4.154978e+03, +9.960523e+03 },
+    { +5.300000e+02, +1.224875e-03, +2.797415e+03, -3.993466e+05, +1.083283e+06, +1.120030e+06, -3.626004e+05, +3.121673e+03, +4.648053e+03, +8.164100e+02, -1.356872e+00, +9.591233e-07, -6.500013e-03, +7.961515e-09, -8.322691e-15, +3.000000e+07, +1.414700e+06, +1.042619e+06, +6.574148e+02, +4.144501e+03, +9.432796e+03 },
+    { +5.400000e+02, +1.246099e-03, +2.884996e+03, -4.283956e+05, +1.129502e+06, +1.166885e+06, -3.910126e+05, +3.095009e+03, +4.724819e+03, +8.025045e+02, -1.425452e+00, +1.045362e-06, -7.242170e-03, +9.337339e-09, -1.014908e-14, +3.000000e+07, +1.363596e+06, +9.566066e+05, +6.204454e+02, +4.119676e+03, +8.884369e+03 },
+    { +5.500000e+02, +1.269240e-03, +2.972482e+03, -4.583772e+05, +1.176488e+06, +1.214565e+06, -4.203000e+05, +3.069933e+03, +4.813291e+03, +7.878734e+02, -1.502320e+00, +1.147066e-06, -8.166398e-03, +1.107332e-08, -1.255333e-14, +3.000000e+07, +1.309707e+06, +8.717896e+05, +6.049532e+02, +4.079670e+03, +8.317523e+03 },
+    { +5.600000e+02, +1.294627e-03, +3.060110e+03, -4.893015e+05, +1.224360e+06, +1.263199e+06, -4.504627e+05, +3.046582e+03, +4.916248e+03, +7.724235e+02, -1.589592e+00, +1.268482e-06, -9.335371e-03, +1.330785e-08, -1.578586e-14, +3.000000e+07, +1.253145e+06, +7.883437e+05, +6.083787e+02, +4.023574e+03, +7.734194e+03 },
+    { +5.700000e+02, +1.322686e-03, +3.148165e+03, -5.211842e+05, +1.273270e+06, +1.312951e+06, -4.815036e+05, +3.025152e+03, +5.037514e+03, +7.560373e+02, -1.690150e+00, +1.415575e-06, -1.084268e-02, +1.625184e-08, -2.024142e-14, +3.000000e+07, +1.193967e+06, +7.064269e+05, +6.284913e+02, +3.950274e+03, +7.135801e+03 },
+    { +5.800000e+02, +1.353981e-03, +3.236995e+03, -5.540480e+05, +1.323409e+06, +1.364028e+06, -5.134286e+05, +3.005932e+03, +5.182508e+03, +7.385629e+02, -1.808044e+00, +1.596972e-06, -1.283235e-02, +2.023849e-08, -2.656696e-14, +3.000000e+07, +1.132171e+06, +6.261851e+05, +6.633223e+02, +3.858278e+03, +6.523042e+03 },
+    { +5.900000e+02, +1.389276e-03, +3.327040e+03, -5.879258e+05, +1.375028e+06, +1.416706e+06, -5.462475e+05, +2.989340e+03, +5.359154e+03, +7.197994e+02, -1.949155e+00, +1.825608e-06, -1.553426e-02, +2.581687e-08, -3.587238e-14, +3.000000e+07, +1.067674e+06, +5.477627e+05, +7.111014e+02, +3.745495e+03, +5.895731e+03 },
+    { +6.000000e+02, +1.429647e-03, +3.418886e+03, -6.228648e+05, +1.428467e+06, +1.471356e+06, -5.799754e+05, +2.975995e+03, +5.579505e+03, +6.994734e+02, -2.122354e+00, +2.121706e-06, -1.933286e-02, +3.393959e-08, -5.017056e-14, +3.000000e+07, +1.000305e+06, +4.713187e+05, +7.702080e+02, +3.608972e+03, +5.252827e+03 },
+    { +6.100000e+02, +1.476670e-03, +3.513342e+03, -6.589340e+05, +1.484204e+06, +1.528505e+06, -6.146339e+05, +2.966837e+03, +5.862834e+03, +6.771995e+02, -2.341690e+00, +2.518589e-06, -2.491512e-02, +4.637450e-08, -7.337885e-14, +3.000000e+07, +9.297627e+05, +3.970476e+05, +8.391793e+02, +3.444649e+03, +4.593025e+03 },
+    { +6.200000e+02, +1.532782e-03, +3.611588e+03, -6.962382e+05, +1.542946e+06, +1.588930e+06, -6.502548e+05, +2.963359e+03, +6.242181e+03, +6.524086e+02, -2.630969e+00, +3.075147e-06, -3.364266e-02, +6.673569e-08, -1.138958e-13, +3.000000e+07, +8.555588e+05, +3.251877e+05, +9.168994e+02, +3.247373e+03, +3.916609e+03 },
+    { +6.300000e+02, +1.602044e-03, +3.715484e+03, -7.349457e+05, +1.605809e+06, +1.653871e+06, -6.868844e+05, +2.968111e+03, +6.780507e+03, +6.242028e+02, -3.035032e+00, +3.906768e-06, -4.867316e-02, +1.035730e-07, -1.924893e-13, +3.000000e+07, +7.768650e+05, +2.559660e+05, +1.003305e+03, +3.011577e+03, +3.228150e+03 },
+    { +6.400000e+02, +1.692016e-03, +3.828295e+03, -7.753543e+05, +1.674755e+06, +1.725515e+06, -7.245938e+05, +2.986039e+03, +7.617859e+03, +5.910111e+02, -3.652659e+00, +5.277827e-06, -7.865891e-02, +1.813392e-07, -3.719478e-13, +3.000000e+07, +6.920763e+05, +1.894719e+05, +1.100736e+03, +2.731136e+03, +2.529977e+03 },
+    { +6.500000e+02, +1.819374e-03, +3.956737e+03, -8.180827e+05, +1.753796e+06, +1.808378e+06, -7.635015e+05, +3.028591e+03, +9.119501e+03, +5.496396e+02, -4.735578e+00, +7.921751e-06, -1.479325e-01, +3.810801e-07, -8.877458e-13, +3.000000e+07, +5.977944e+05, +1.262347e+05, +1.206869e+03, +2.384055e+03, +1.785768e+03 },
+    { +6.750000e+02, +3.007412e-03, +4.548759e+03, -9.586018e+05, +2.111810e+06, +2.202033e+06, -8.683794e+05, +3.434128e+03, +2.702994e+04, +3.325118e+02, -1.324111e+01, +4.536319e-05, +4.761334e-01, +3.274368e-07, -7.966817e-12, +3.000000e+07, +2.918911e+05, +2.204430e+04, +2.533104e+02, +9.709339e+02, +8.534421e+01 },
+    { +7.000000e+02, +5.427798e-03, +5.175381e+03, -1.154161e+06, +2.468606e+06, +2.631440e+06, -9.913266e+05, +2.977511e+03, +1.035118e+04, +1.842368e+02, -2.322676e+00, +1.508824e-05, +1.075314e-01, -4.662351e-07, +1.624650e-12, +3.000000e+07, +1.539395e+05, +6.627677e+04, -1.648527e+02, +9.494074e+02, -4.729811e+02 },
+    { +7.250000e+02, +6.825255e-03, +5.459038e+03, -1.329305e+06, +2.628498e+06, +2.833256e+06, -1.124547e+06, +2.643130e+03, +6.538171e+03, +1.465147e+02, -1.009906e+00, +8.843532e-06, +2.487411e-02, -1.334667e-07, +5.202084e-13, +3.000000e+07, +1.141972e+05, +1.130770e+05, -1.328777e+02, +9.469663e+02, -7.521425e+02 },
+    { +7.500000e+02, +7.874315e-03, +5.653075e+03, -1.499793e+06, +2.740013e+06, +2.976243e+06, -1.263564e+06, +2.433693e+03, +5.079507e+03, +1.269952e+02, -6.108979e-01, +6.559408e-06, +1.014436e-02, -6.275592e-08, +2.530569e-13, +3.000000e+07, +9.313308e+04, +1.524528e+05, -9.909653e+01, +9.108004e+02, -8.966526e+02 },
+    { +7.750000e+02, +8.751159e-03, +5.805974e+03, -1.669399e+06, +2.830230e+06, +3.092765e+06, -1.406865e+06, +2.294605e+03, +4.312088e+03, +1.142706e+02, -4.268030e-01, +5.358926e-06, +5.320333e-03, -3.684559e-08, +1.491614e-13, +3.000000e+07, +7.964338e+04, +1.866045e+05, -7.416782e+01, +8.693430e+02, -9.692218e+02 },
+    { +8.000000e+02, +9.523523e-03, +5.934942e+03, -1.839371e+06, +2.908583e+06, +3.194288e+06, -1.553665e+06, +2.199030e+03, +3.844248e+03, +1.050032e+02, -3.232632e-01, +4.608656e-06, +3.215299e-03, -2.449761e-08, +9.782841e-14, +3.000000e+07, +7.014262e+04, +2.169830e+05, -5.640716e+01, +8.303158e+02, -9.994063e+02 },
+    { +8.250000e+02, +1.022537e-02, +6.048186e+03, -2.010243e+06, +2.979511e+06, +3.286271e+06, -1.703482e+06, +2.132067e+03, +3.533928e+03, +9.779601e+01, -2.578005e-01, +4.089539e-06, +2.128913e-03, -1.763167e-08, +6.861589e-14, +3.000000e+07, +6.303902e+04, +2.445264e+05, -4.367756e+01, +7.956188e+02, -1.003233e+03 },
+    { +8.500000e+02, +1.087634e-02, +6.150276e+03, -2.182273e+06, +3.045462e+06, +3.371752e+06, -1.855982e+06, +2.084759e+03, +3.316614e+03, +9.194266e+01, -2.130635e-01, +3.705472e-06, +1.502521e-03, -1.340500e-08, +5.037205e-14, +3.000000e+07, +5.749971e+04, +2.698712e+05, -3.440733e+01, +7.653474e+02, -9.900546e+02 },
+    { +9.000000e+02, +1.207152e-02, +6.331274e+03, -2.530275e+06, +3.167872e+06, +3.530017e+06, -2.168129e+06, +2.028287e+03, +3.040802e+03, +8.283961e+01, -1.563934e-01, +3.168121e-06, +8.528370e-04, -8.653960e-09, +2.968724e-14, +3.000000e+07, +4.936471e+04, +3.156445e+05, -2.234153e+01, +7.161967e+02, -9.336081e+02 },
+    { +9.500000e+02, +1.316903e-02, +6.491061e+03, -2.883830e+06, +3.282677e+06, +3.677748e+06, -2.488759e+06, +2.003119e+03, +2.882197e+03, +7.593573e+01, -1.223103e-01, +2.803691e-06, +5.441441e-04, -6.158028e-09, +1.886076e-14, +3.000000e+07, +4.362476e+04, +3.566727e+05, -1.524899e+01, +6.787238e+02, -8.557935e+02 },
+    { +1.000000e+03, +1.420046e-02, +6.636272e+03, -3.243008e+06, +3.393264e+06, +3.819278e+06, -2.816994e+06, +1.996350e+03, +2.786893e+03, +7.042025e+01, -9.970670e-02, +2.535878e-06, +3.753068e-04, -4.669791e-09, +1.252796e-14, +3.000000e+07, +3.931842e+04, +3.943408e+05, -1.082731e+01, +6.495758e+02, -7.682371e+02 },
+    { +1.050000e+03, +1.518450e-02, +6.770730e+03, -3.607743e+06, +3.501523e+06, +3.957058e+06, -3.152208e+06, +2.001021e+03, +2.729189e+03, +6.585665e+01, -8.368106e-02, +2.328161e-06, +2.735933e-04, -3.702380e-09, +8.539159e-15, +3.000000e+07, +3.594299e+04, +4.295236e+05, -7.935812e+00, +6.264297e+02, -6.766688e+02 },
+    { +1.100000e+03, +1.613310e-02, +6.896836e+03, -3.977921e+06, +3.608598e+06, +4.092591e+06, -3.493928e+06, +2.013060e+03, +2.695313e+03, +6.198437e+01, -7.175609e-02, +2.160730e-06, +2.078411e-04, -3.032885e-09, +5.892101e-15, +3.000000e+07, +3.320919e+04, +4.628066e+05, -5.970143e+00, +6.077026e+02, -5.840754e+02 },
+    { +1.150000e+03, +1.705438e-02, +7.016200e+03, -4.353411e+06, +3.715220e+06, +4.226851e+06, -3.841779e+06, +2.029928e+03, +2.677233e+03, +5.863598e+01, -6.255223e-02, +2.021838e-06, +1.629911e-04, -2.547045e-09, +4.066869e-15, +3.000000e+07, +3.093830e+04, +4.945996e+05, -4.590527e+00, +5.923006e+02, -4.920637e+02 },
+    { +1.200000e+03, +1.795405e-02, +7.129957e+03, -4.734076e+06, +3.821872e+06, +4.360494e+06, -4.195455e+06, +2.049961e+03, +2.669955e+03, +5.569772e+01, -5.524314e-02, +1.904040e-06, +1.310794e-04, -2.181137e-09, +2.771525e-15, +3.000000e+07, +2.901365e+04, +5.251991e+05, -3.596047e+00, +5.794515e+02, -4.015047e+02 },
+    { +1.250000e+03, +1.883633e-02, +7.238934e+03, -5.119785e+06, +3.928882e+06, +4.493972e+06, -4.554696e+06, +2.072025e+03, +2.670216e+03, +5.308891e+01, -4.930490e-02, +1.802365e-06, +1.075879e-04, -1.897213e-09, +1.831805e-15, +3.000000e+07, +2.735567e+04, +5.548266e+05, -2.862735e+00, +5.685982e+02, -3.128606e+02 },
+    { +1.273000e+03, +1.923722e-02, +7.287636e+03, -5.298869e+06, +3.978291e+06, +4.555408e+06, -4.721753e+06, +2.082628e+03, +2.672230e+03, +5.198255e+01, -4.693332e-02, +1.760016e-06, +9.881909e-05, -1.787229e-09, +1.487261e-15, +3.000000e+07, +2.666642e+04, +5.681768e+05, -2.590135e+00, +5.641587e+02, -2.727957e+02 },
+    // P = 40.0 MPa
+    { +2.699970e+02, +9.809869e-04, -4.731844e+01, +3.041546e+02, -1.247168e+04, +2.676779e+04, +3.954363e+04, +4.052609e+03, +4.052990e+03, +1.019382e+03, -2.638405e-02, +4.740978e-07, -1.383541e-02, -3.390111e-09, -1.122110e-15, +4.000000e+07, +5.565108e+04, +2.109270e+06, +2.998583e+04, +1.536049e+04, +1.053008e+04 },
+    { +2.700000e+02, +9.809870e-04, -4.727341e+01, +3.042934e+02, -1.245953e+04, +2.677995e+04, +3.954377e+04, +4.052611e+03, +4.052994e+03, +1.019381e+03, -2.642555e-02, +4.740876e-07, -1.383409e-02, -3.389722e-09, -1.122041e-15, +4.000000e+07, +5.573981e+04, +2.109315e+06, +2.998488e+04, +1.535985e+04, +1.053011e+04 },
+    { +2.750000e+02, +9.812724e-04, +2.715156e+01, +3.426595e+02, +7.809338e+03, +4.706023e+04, +3.959356e+04, +4.054261e+03, +4.058996e+03, +1.019085e+03, -9.056307e-02, +4.586512e-07, -1.191189e-02, -2.804773e-09, -1.024183e-15, +4.000000e+07, +1.974552e+05, +2.180306e+06, +2.847361e+04, +1.429450e+04, +1.061525e+04 },
+    { +2.800000e+02, +9.818459e-04, +1.003378e+02, +4.886113e-01, +2.809507e+04, +6.736890e+04, +3.927432e+04, +4.051431e+03, +4.064389e+03, +1.018490e+03, -1.463035e-01, +4.458686e-07, -1.044761e-02, -2.323037e-09, -9.535872e-16, +4.000000e+07, +3.281315e+05, +2.242813e+06, +2.708154e+04, +1.325933e+04, +1.075820e+04 },
+    { +2.850000e+02, +9.826728e-04, +1.723202e+02, -7.147277e+02, +4.839652e+04, +8.770343e+04, +3.859218e+04, +4.045182e+03, +4.069365e+03, +1.017633e+03, -1.955749e-01, +4.352918e-07, -9.306237e-03, -1.918974e-09, -9.022909e-16, +4.000000e+07, +4.492960e+05, +2.297309e+06, +2.575917e+04, +1.226716e+04, +1.093969e+04 },
+    { +2.900000e+02, +9.837267e-04, +2.431344e+02, -1.795999e+03, +6.871297e+04, +1.080620e+05, +3.755307e+04, +4.036215e+03, +4.074031e+03, +1.016543e+03, -2.397539e-01, +4.265787e-07, -8.398572e-03, -1.575174e-09, -8.651622e-16, +4.000000e+07, +5.620391e+05, +2.344233e+06, +2.447962e+04, +1.132844e+04, +1.114551e+04 },
+    { +2.950000e+02, +9.849868e-04, +3.128156e+02, -3.236745e+03, +8.904385e+04, +1.284433e+05, +3.616273e+04, +4.025004e+03, +4.078441e+03, +1.015242e+03, -2.798479e-01, +4.194606e-07, -7.663890e-03, -1.279150e-09, -8.387878e-16, +4.000000e+07, +6.671613e+05, +2.384014e+06, +2.322992e+04, +1.045061e+04, +1.136524e+04 },
+    { +3.000000e+02, +9.864369e-04, +3.813977e+02, -5.030732e+03, +1.093886e+05, +1.488461e+05, +3.442674e+04, +4.011887e+03, +4.082616e+03, +1.013750e+03, -3.166098e-01, +4.137232e-07, -7.059810e-03, -1.021593e-09, -8.208351e-16, +4.000000e+07, +7.652696e+05, +2.417075e+06, +2.200532e+04, +9.638273e+03, +1.159115e+04 },
+    { +3.050000e+02, +9.880637e-04, +4.489134e+02, -7.172020e+03, +1.297466e+05, +1.692691e+05, +3.235053e+04, +3.997117e+03, +4.086570e+03, +1.012080e+03, -3.506129e-01, +4.091926e-07, -6.556129e-03, -7.953524e-10, -8.096732e-16, +4.000000e+07, +8.568407e+05, +2.443837e+06, +2.080573e+04, +8.893490e+03, +1.181752e+04 },
+    { +3.100000e+02, +9.898566e-04, +5.153938e+02, -9.654929e+03, +1.501171e+05, +1.897114e+05, +2.993934e+04, +3.980898e+03, +4.090315e+03, +1.010247e+03, -3.823016e-01, +4.057269e-07, -6.130929e-03, -5.948117e-10, -8.041402e-16, +4.000000e+07, +9.422633e+05, +2.464712e+06, +1.963348e+04, +8.216318e+03, +1.204011e+04 },
+    { +3.150000e+02, +9.918069e-04, +5.808688e+02, -1.247401e+04, +1.704997e+05, +2.101719e+05, +2.719827e+04, +3.963406e+03, +4.093868e+03, +1.008261e+03, -4.120258e-01, +4.032092e-07, -5.768045e-03, -4.154816e-10, -8.033970e-16, +4.000000e+07, +1.021866e+06, +2.480102e+06, +1.849187e+04, +7.605264e+03, +1.225572e+04 },
+    { +3.200000e+02, +9.939075e-04, +6.453673e+02, -1.562402e+04, +1.908935e+05, +2.306498e+05, +2.413228e+04, +3.944799e+03, +4.097255e+03, +1.006130e+03, -4.400656e-01, +4.015428e-07, -5.455388e-03, -2.537240e-10, -8.068325e-16, +4.000000e+07, +1.095937e+06, +2.490394e+06, +1.738442e+04, +7.057710e+03, +1.246200e+04 },
+    { +3.250000e+02, +9.961523e-04, +7.089172e+02, -1.909992e+04, +2.112982e+05, +2.511443e+05, +2.074617e+04, +3.925220e+03, +4.100508e+03, +1.003863e+03, -4.666480e-01, +4.006477e-07, -5.183798e-03, -1.065567e-10, -8.140004e-16, +4.000000e+07, +1.164734e+06, +2.495959e+06, +1.631433e+04, +6.570274e+03, +1.265718e+04 },
+    { +3.300000e+02, +9.985366e-04, +7.715457e+02, -2.289683e+04, +2.317133e+05, +2.716547e+05, +1.704464e+04, +3.904806e+03, +4.103665e+03, +1.001465e+03, -4.919602e-01, +4.004571e-07, -4.946253e-03, +2.848982e-11, -8.245773e-16, +4.000000e+07, +1.228497e+06, +2.497147e+06, +1.528431e+04, +6.139091e+03, +1.283995e+04 },
+    { +3.350000e+02, +1.001056e-03, +8.332795e+02, -2.701005e+04, +2.521386e+05, +2.921808e+05, +1.303221e+04, +3.883683e+03, +4.106770e+03, +9.989448e+02, -5.161582e-01, +4.009158e-07, -4.737311e-03, +1.534792e-10, -8.383333e-16, +4.000000e+07, +1.287448e+06, +2.494289e+06, +1.429645e+04, +5.760039e+03, +1.300940e+04 },
+    { +3.400000e+02, +1.003708e-03, +8.941445e+02, -3.143503e+04, +2.725741e+05, +3.127224e+05, +8.713292e+03, +3.861971e+03, +4.109868e+03, +9.963056e+02, -5.393738e-01, +4.019780e-07, -4.552713e-03, +2.701509e-10, -8.551114e-16, +4.000000e+07, +1.341799e+06, +2.487698e+06, +1.335223e+04, +5.428906e+03, +1.316484e+04 },
+    { +3.450000e+02, +1.006489e-03, +9.541664e+02, -3.616741e+04, +2.930200e+05, +3.332796e+05, +4.092169e+03, +3.839781e+03, +4.113006e+03, +9.935525e+02, -5.617202e-01, +4.036059e-07, -4.389096e-03, +3.799842e-10, -8.748130e-16, +4.000000e+07, +1.391754e+06, +2.477664e+06, +1.245250e+04, +5.141510e+03, +1.330585e+04 },
+    { +3.500000e+02, +1.009398e-03, +1.013370e+03, -4.120292e+04, +3.134767e+05, +3.538526e+05, -8.270085e+02, +3.817217e+03, +4.116231e+03, +9.906896e+02, -5.832953e-01, +4.057686e-07, -4.243779e-03, +4.842476e-10, -8.973883e-16, +4.000000e+07, +1.437507e+06, +2.464459e+06, +1.159761e+04, +4.893796e+03, +1.343214e+04 },
+    { +3.550000e+02, +1.012432e-03, +1.071781e+03, -4.653749e+04, +3.339448e+05, +3.744421e+05, -6.040213e+03, +3.794372e+03, +4.119587e+03, +9.877207e+02, -6.041849e-01, +4.084410e-07, -4.114609e-03, +5.840395e-10, -9.228281e-16, +4.000000e+07, +1.479247e+06, +2.448334e+06, +1.078745e+04, +4.681884e+03, +1.354356e+04 },
+    { +3.600000e+02, +1.015591e-03, +1.129423e+03, -5.216716e+04, +3.544252e+05, +3.950488e+05, -1.154354e+04, +3.771333e+03, +4.123119e+03, +9.846488e+02, -6.244654e-01, +4.116031e-07, -3.999846e-03, +6.803194e-10, -9.511593e-16, +4.000000e+07, +1.517154e+06, +2.429525e+06, +1.002151e+04, +4.502117e+03, +1.364009e+04 },
+    { +3.650000e+02, +1.018873e-03, +1.186320e+03, -5.808811e+04, +3.749187e+05, +4.156736e+05, -1.733320e+04, +3.748178e+03, +4.126867e+03, +9.814769e+02, -6.442050e-01, +4.152397e-07, -3.898071e-03, +7.739347e-10, -9.824413e-16, +4.000000e+07, +1.551405e+06, +2.408247e+06, +9.298954e+03, +4.351074e+03, +1.372176e+04 },
+    { +3.700000e+02, +1.022278e-03, +1.242496e+03, -6.429666e+04, +3.954268e+05, +4.363179e+05, -2.340554e+04, +3.724977e+03, +4.130870e+03, +9.782075e+02, -6.634658e-01, +4.193393e-07, -3.808125e-03, +8.656417e-10, -1.016763e-15, +4.000000e+07, +1.582169e+06, +2.384704e+06, +8.618711e+03, +4.225586e+03, +1.378870e+04 },
+    { +3.750000e+02, +1.025806e-03, +1.297973e+03, -7.078925e+04, +4.159506e+05, +4.569828e+05, -2.975700e+04, +3.701792e+03, +4.135164e+03, +9.748430e+02, -6.823044e-01, +4.238941e-07, -3.729052e-03, +9.561233e-10, -1.054244e-15, +4.000000e+07, +1.609610e+06, +2.359080e+06, +7.979501e+03, +4.122734e+03, +1.384105e+04 },
+    { +3.800000e+02, +1.029458e-03, +1.352774e+03, -7.756245e+04, +4.364917e+05, +4.776701e+05, -3.638414e+04, +3.678678e+03, +4.139783e+03, +9.713851e+02, -7.007731e-01, +4.288995e-07, -3.660065e-03, +1.046004e-09, -1.095029e-15, +4.000000e+07, +1.633886e+06, +2.331548e+06, +7.379896e+03, +4.039844e+03, +1.387902e+04 },
+    { +3.850000e+02, +1.033233e-03, +1.406922e+03, -8.461297e+04, +4.570519e+05, +4.983813e+05, -4.328365e+04, +3.655682e+03, +4.144757e+03, +9.678358e+02, -7.189207e-01, +4.343541e-07, -3.600510e-03, +1.135862e-09, -1.139294e-15, +4.000000e+07, +1.655149e+06, +2.302269e+06, +6.818362e+03, +3.974475e+03, +1.390285e+04 },
+    { +3.900000e+02, +1.037133e-03, +1.460437e+03, -9.193763e+04, +4.776329e+05, +5.191183e+05, -5.045230e+04, +3.632847e+03, +4.150116e+03, +9.641964e+02, -7.367930e-01, +4.402590e-07, -3.549849e-03, +1.226241e-09, -1.187242e-15, +4.000000e+07, +1.673544e+06, +2.271390e+06, +6.293296e+03, +3.924411e+03, +1.391279e+04 },
+    { +3.950000e+02, +1.041159e-03, +1.513342e+03, -9.953336e+04, +4.982367e+05, +5.398831e+05, -5.788700e+04, +3.610207e+03, +4.155885e+03, +9.604682e+02, -7.544333e-01, +4.466182e-07, -3.507636e-03, +1.317657e-09, -1.239108e-15, +4.000000e+07, +1.689213e+06, +2.239049e+06, +5.803052e+03, +3.887643e+03, +1.390912e+04 },
+    { +4.000000e+02, +1.045312e-03, +1.565656e+03, -1.073972e+05, +5.188654e+05, +5.606778e+05, -6.558474e+04, +3.587795e+03, +4.162092e+03, +9.566524e+02, -7.718828e-01, +4.534382e-07, -3.473506e-03, +1.410611e-09, -1.295159e-15, +4.000000e+07, +1.702289e+06, +2.205372e+06, +5.345971e+03, +3.862357e+03, +1.389213e+04 },
+    { +4.100000e+02, +1.054007e-03, +1.668595e+03, -1.239181e+05, +5.602060e+05, +6.023662e+05, -8.175783e+04, +3.543748e+03, +4.175910e+03, +9.487607e+02, -8.063670e-01, +4.684983e-07, -3.428366e-03, +1.603082e-09, -1.421061e-15, +4.000000e+07, +1.721174e+06, +2.134480e+06, +4.524685e+03, +3.839850e+03, +1.381939e+04 },
+    { +4.200000e+02, +1.063235e-03, +1.769410e+03, -1.414790e+05, +6.016734e+05, +6.442028e+05, -9.894957e+04, +3.500866e+03, +4.191755e+03, +9.405260e+02, -8.405484e-01, +4.855398e-07, -3.412738e-03, +1.807560e-09, -1.567835e-15, +4.000000e+07, +1.731163e+06, +2.059563e+06, +3.816492e+03, +3.845688e+03, +1.369701e+04 },
+    { +4.300000e+02, +1.073019e-03, +1.868252e+03, -1.600602e+05, +6.432879e+05, +6.862087e+05, -1.171395e+05, +3.459250e+03, +4.209805e+03, +9.319498e+02, -8.747171e-01, +5.047029e-07, -3.425716e-03, +2.028090e-09, -1.739102e-15, +4.000000e+07, +1.733133e+06, +1.981364e+06, +3.209100e+03, +3.870856e+03, +1.352750e+04 },
+    { +4.400000e+02, +1.083387e-03, +1.965262e+03, -1.796440e+05, +6.850714e+05, +7.284069e+05, -1.363085e+05, +3.418964e+03, +4.230247e+03, +9.230308e+02, -9.091573e-01, +5.261697e-07, -3.467069e-03, +2.269051e-09, -1.939393e-15, +4.000000e+07, +1.727879e+06, +1.900528e+06, +2.691078e+03, +3.908136e+03, +1.331339e+04 },
+    { +4.500000e+02, +1.094374e-03, +2.060581e+03, -2.002140e+05, +7.270473e+05, +7.708223e+05, -1.564391e+05, +3.380038e+03, +4.253279e+03, +9.137648e+02, -9.441543e-01, +5.501684e-07, -3.537207e-03, +2.535355e-09, -2.174381e-15, +4.000000e+07, +1.716119e+06, +1.817625e+06, +2.251962e+03, +3.951769e+03, +1.305717e+04 },
+    { +4.600000e+02, +1.106017e-03, +2.154341e+03, -2.217556e+05, +7.692411e+05, +8.134818e+05, -1.775149e+05, +3.342483e+03, +4.279126e+03, +9.041449e+02, -9.800008e-01, +5.769801e-07, -3.637179e-03, +2.832681e-09, -2.451200e-15, +4.000000e+07, +1.698500e+06, +1.733162e+06, +1.882276e+03, +3.997174e+03, +1.276134e+04 },
+    { +4.700000e+02, +1.118367e-03, +2.246673e+03, -2.442558e+05, +8.116803e+05, +8.564150e+05, -1.995211e+05, +3.306294e+03, +4.308045e+03, +8.941609e+02, -1.017003e+00, +6.069476e-07, -3.768732e-03, +3.167751e-09, -2.778876e-15, +4.000000e+07, +1.675603e+06, +1.647589e+06, +1.573519e+03, +4.040718e+03, +1.242841e+04 },
+    { +4.800000e+02, +1.131478e-03, +2.337704e+03, -2.677032e+05, +8.543949e+05, +8.996540e+05, -2.224440e+05, +3.271457e+03, +4.340339e+03, +8.837999e+02, -1.055489e+00, +6.404878e-07, -3.934408e-03, +3.548686e-09, -3.168919e-15, +4.000000e+07, +1.647946e+06, +1.561310e+06, +1.318118e+03, +4.079525e+03, +1.206087e+04 },
+    { +4.900000e+02, +1.145416e-03, +2.427562e+03, -2.920879e+05, +8.974176e+05, +9.432342e+05, -2.462713e+05, +3.237953e+03, +4.376367e+03, +8.730450e+02, -1.095817e+00, +6.781072e-07, -4.137706e-03, +3.985468e-09, -3.636139e-15, +4.000000e+07, +1.615993e+06, +1.474693e+06, +1.109358e+03, +4.111322e+03, +1.166126e+04 },
+    { +5.000000e+02, +1.160260e-03, +2.516374e+03, -3.174022e+05, +9.407848e+05, +9.871952e+05, -2.709918e+05, +3.205766e+03, +4.416558e+03, +8.618761e+02, -1.138384e+00, +7.204245e-07, -4.383310e-03, +4.490565e-09, -4.199786e-15, +4.000000e+07, +1.580157e+06, +1.388071e+06, +9.413150e+02, +4.134317e+03, +1.123212e+04 },
+    { +5.100000e+02, +1.176099e-03, +2.604268e+03, -3.436397e+05, +9.845370e+05, +1.031581e+06, -2.965957e+05, +3.174883e+03, +4.461434e+03, +8.502684e+02, -1.183644e+00, +7.681985e-07, -4.677425e-03, +5.079790e-09, -4.885180e-15, +4.000000e+07, +1.540805e+06, +1.301747e+06, +8.087791e+02, +4.147095e+03, +1.077607e+04 },
+    { +5.200000e+02, +1.193043e-03, +2.691377e+03, -3.707963e+05, +1.028720e+06, +1.076442e+06, -3.230745e+05, +3.145296e+03, +4.511629e+03, +8.381925e+02, -1.232121e+00, +8.223679e-07, -5.028252e-03, +5.773513e-09, -5.726056e-15, +4.000000e+07, +1.498260e+06, +1.216001e+06, +7.071779e+02, +4.148537e+03, +1.029573e+04 },
+    { +5.300000e+02, +1.211221e-03, +2.777840e+03, -3.988699e+05, +1.073385e+06, +1.121834e+06, -3.504211e+05, +3.117011e+03, +4.567928e+03, +8.256132e+02, -1.284434e+00, +8.841049e-07, -5.446666e-03, +6.598390e-09, -6.768018e-15, +4.000000e+07, +1.452807e+06, +1.131087e+06, +6.325032e+02, +4.137749e+03, +9.793774e+03 },
+    { +5.400000e+02, +1.230787e-03, +2.863803e+03, -4.278611e+05, +1.118592e+06, +1.167824e+06, -3.786297e+05, +3.090047e+03, +4.631307e+03, +8.124885e+02, -1.341328e+00, +9.548897e-07, -5.947188e-03, +7.589882e-09, -8.073704e-15, +4.000000e+07, +1.404694e+06, +1.047241e+06, +5.812376e+02, +4.113997e+03, +9.272849e+03 },
+    { +5.500000e+02, +1.251927e-03, +2.949425e+03, -4.577731e+05, +1.164411e+06, +1.214488e+06, -4.076960e+05, +3.064442e+03, +4.703000e+03, +7.987683e+02, -1.403716e+00, +1.036616e-06, -6.549393e-03, +8.795997e-09, -9.730691e-15, +4.000000e+07, +1.354133e+06, +9.646774e+05, +5.502828e+02, +4.076648e+03, +8.735544e+03 },
+    { +5.600000e+02, +1.274873e-03, +3.034883e+03, -4.886125e+05, +1.210922e+06, +1.261917e+06, -4.376176e+05, +3.040260e+03, +4.784585e+03, +7.843921e+02, -1.472742e+00, +1.131743e-06, -7.279960e-03, +1.028295e-08, -1.186383e-14, +4.000000e+07, +1.301305e+06, +8.835930e+05, +5.368851e+02, +4.025102e+03, +8.184305e+03 },
+    { +5.700000e+02, +1.299906e-03, +3.120374e+03, -5.203900e+05, +1.258223e+06, +1.310219e+06, -4.683938e+05, +3.017592e+03, +4.878111e+03, +7.692865e+02, -1.549864e+00, +1.243517e-06, -8.175696e-03, +1.214385e-08, -1.465501e-14, +4.000000e+07, +1.246355e+06, +8.041707e+05, +5.385568e+02, +3.958716e+03, +7.621332e+03 },
+    { +5.800000e+02, +1.327384e-03, +3.206127e+03, -5.531213e+05, +1.306432e+06, +1.359528e+06, -5.000260e+05, +2.996573e+03, +4.986288e+03, +7.533616e+02, -1.636976e+00, +1.376305e-06, -9.288030e-03, +1.451247e-08, -1.837551e-14, +4.000000e+07, +1.189399e+06, +7.265829e+05, +5.529861e+02, +3.876715e+03, +7.048469e+03 },
+    { +5.900000e+02, +1.357763e-03, +3.292413e+03, -5.868286e+05, +1.355695e+06, +1.410006e+06, -5.325181e+05, +2.977389e+03, +5.112756e+03, +7.365055e+02, -1.736586e+00, +1.536103e-06, -1.068982e-02, +1.758523e-08, -2.344068e-14, +4.000000e+07, +1.130514e+06, +6.509981e+05, +5.779318e+02, +3.778076e+03, +6.467096e+03 },
+    { +6.000000e+02, +1.391639e-03, +3.379562e+03, -6.215427e+05, +1.406195e+06, +1.461860e+06, -5.658771e+05, +2.960294e+03, +5.262509e+03, +7.185771e+02, -1.852081e+00, +1.731325e-06, -1.248582e-02, +2.165776e-08, -3.050512e-14, +4.000000e+07, +1.069748e+06, +5.775922e+05, +6.110899e+02, +3.661409e+03, +5.878098e+03 },
+    { +6.100000e+02, +1.429806e-03, +3.467984e+03, -6.573058e+05, +1.458164e+06, +1.515357e+06, -6.001136e+05, +2.945631e+03, +5.442544e+03, +6.993956e+02, -1.988120e+00, +1.974085e-06, -1.482957e-02, +2.718727e-08, -4.063472e-14, +4.000000e+07, +1.007110e+06, +5.065637e+05, +6.499256e+02, +3.524837e+03, +5.282013e+03 },
+    { +6.200000e+02, +1.473352e-03, +3.558206e+03, -6.941768e+05, +1.511911e+06, +1.570845e+06, -6.352427e+05, +2.933864e+03, +5.662926e+03, +6.787247e+02, -2.151257e+00, +2.282314e-06, -1.795293e-02, +3.490557e-08, -5.563341e-14, +4.000000e+07, +9.425769e+05, +4.381517e+05, +6.914627e+02, +3.365969e+03, +4.679606e+03 },
+    { +6.300000e+02, +1.523812e-03, +3.650928e+03, -7.322385e+05, +1.567846e+06, +1.628799e+06, -6.712860e+05, +2.925615e+03, +5.938640e+03, +6.562490e+02, -2.350985e+00, +2.683491e-06, -2.222669e-02, +4.604292e-08, -7.871074e-14, +4.000000e+07, +8.760919e+05, +3.726489e+05, +7.320460e+02, +3.182131e+03, +4.073179e+03 },
+    { +6.400000e+02, +1.583441e-03, +3.747112e+03, -7.716104e+05, +1.626541e+06, +1.689879e+06, -7.082728e+05, +2.921725e+03, +6.293158e+03, +6.315359e+02, -2.601730e+00, +3.221765e-06, -2.830031e-02, +6.282400e-08, -1.159855e-13, +4.000000e+07, +8.075480e+05, +3.103889e+05, +7.671585e+02, +2.971153e+03, +3.468345e+03 },
+    { +6.500000e+02, +1.655717e-03, +3.848148e+03, -8.124730e+05, +1.688823e+06, +1.755052e+06, -7.462443e+05, +2.923351e+03, +6.765724e+03, +6.039681e+02, -2.926867e+00, +3.972755e-06, -3.736005e-02, +8.957053e-08, -1.801168e-13, +4.000000e+07, +7.367349e+05, +2.517145e+05, +7.914093e+02, +2.732586e+03, +2.872625e+03 },
+    { +6.750000e+02, +1.939934e-03, +4.138779e+03, -9.235302e+05, +1.870145e+06, +1.947743e+06, -8.459329e+05, +2.963902e+03, +8.965217e+03, +5.154816e+02, -4.316734e+00, +7.887541e-06, -7.519315e-02, +2.515552e-07, -6.880286e-13, +4.000000e+07, +5.472851e+05, +1.267822e+05, +7.514825e+02, +2.009098e+03, +1.402109e+03 },
+    { +7.000000e+02, +2.610821e-03, +4.538790e+03, -1.058531e+06, +2.118621e+06, +2.223054e+06, -9.540986e+05, +3.048808e+03, +1.307881e+04, +3.830212e+02, -5.962411e+00, +1.691201e-05, +3.083466e-02, +2.485736e-07, -1.698155e-12, +4.000000e+07, +3.525549e+05, +5.912958e+04, +2.936207e+02, +1.224124e+03, +3.510683e+02 },
+    { +7.250000e+02, +3.778581e-03, +4.972455e+03, -1.224360e+06, +2.380670e+06, +2.531813e+06, -1.073217e+06, +2.918563e+03, +1.065253e+04, +2.646496e+02, -3.277197e+00, +1.437468e-05, +1.038711e-01, -2.476502e-07, +1.907733e-13, +4.000000e+07, +2.279841e+05, +6.956679e+04, -6.026031e+01, +9.880254e+02, -6.422787e+01 },
+    { +7.500000e+02, +4.831318e-03, +5.274199e+03, -1.394801e+06, +2.560848e+06, +2.754101e+06, -1.201548e+06, +2.695603e+03, +7.450295e+03, +2.069828e+02, -1.607711e+00, +9.516696e-06, +3.908846e-02, -1.364974e-07, +2.854345e-13, +4.000000e+07, +1.689358e+05, +1.050785e+05, -1.172631e+02, +9.747127e+02, -3.311676e+02 },
+    { +7.750000e+02, +5.680721e-03, +5.488345e+03, -1.563436e+06, +2.690031e+06, +2.917260e+06, -1.336208e+06, +2.513374e+03, +5.778653e+03, +1.760340e+02, -9.587432e-01, +7.040328e-06, +1.685012e-02, -7.093492e-08, +1.742568e-13, +4.000000e+07, +1.361788e+05, +1.420388e+05, -1.082325e+02, +9.523593e+02, -4.993570e+02 },
+    { +8.000000e+02, +6.398084e-03, +5.655764e+03, -1.731505e+06, +2.793107e+06, +3.049030e+06, -1.475581e+06, +2.378956e+03, +4.843728e+03, +1.562968e+02, -6.533189e-01, +5.671051e-06, +8.777265e-03, -4.221229e-08, +1.096194e-13, +4.000000e+07, +1.152025e+05, +1.763342e+05, -8.925535e+01, +9.198730e+02, -6.010309e+02 },
+    { +8.250000e+02, +7.029081e-03, +5.795289e+03, -1.899929e+06, +2.881185e+06, +3.162348e+06, -1.618766e+06, +2.281053e+03, +4.263486e+03, +1.422661e+02, -4.838283e-01, +4.813212e-06, +5.211652e-03, -2.790194e-08, +7.357025e-14, +4.000000e+07, +1.005209e+05, +2.077615e+05, -7.179894e+01, +8.851637e+02, -6.597772e+02 },
+    { +8.500000e+02, +7.599966e-03, +5.916448e+03, -2.069193e+06, +2.959788e+06, +3.263787e+06, -1.765194e+06, +2.209605e+03, +3.875649e+03, +1.315795e+02, -3.786408e-01, +4.224842e-06, +3.387091e-03, -1.986746e-08, +5.201711e-14, +4.000000e+07, +8.962247e+04, +2.366952e+05, -5.769685e+01, +8.518858e+02, -6.897866e+02 },
+    { +9.000000e+02, +8.620071e-03, +6.123191e+03, -2.411149e+06, +3.099723e+06, +3.444526e+06, -2.066346e+06, +2.119252e+03, +3.403140e+03, +1.160083e+02, -2.578974e-01, +3.464426e-06, +1.711051e-03, -1.168279e-08, +2.894454e-14, +4.000000e+07, +7.444160e+04, +2.886481e+05, -3.812376e+01, +7.938608e+02, -6.961018e+02 },
+    { +9.500000e+02, +9.532626e-03, +6.299469e+03, -2.758316e+06, +3.226179e+06, +3.607484e+06, -2.377011e+06, +2.072293e+03, +3.138553e+03, +1.049029e+02, -1.920990e-01, +2.987692e-06, +1.008967e-03, -7.804493e-09, +1.762562e-14, +4.000000e+07, +6.429678e+04, +3.347065e+05, -2.618244e+01, +7.473665e+02, -6.609015e+02 },
+    { +1.000000e+03, +1.037458e-02, +6.456072e+03, -3.110951e+06, +3.345122e+06, +3.760105e+06, -2.695967e+06, +2.050774e+03, +2.979045e+03, +9.638941e+01, -1.513472e-01, +2.655923e-06, +6.572349e-04, -5.654657e-09, +1.130845e-14, +4.000000e+07, +5.698478e+04, +3.765170e+05, -1.863670e+01, +7.102778e+02, -6.036106e+02 },
+    { +1.050000e+03, +1.116696e-02, +6.598819e+03, -3.469067e+06, +3.459693e+06, +3.906371e+06, -3.022389e+06, +2.045011e+03, +2.879206e+03, +8.954988e+01, -1.238783e-01, +2.408698e-06, +4.587325e-04, -4.331556e-09, +7.466928e-15, +4.000000e+07, +5.142958e+04, +4.151620e+05, -1.367639e+01, +6.803952e+02, -5.343119e+02 },
+    { +1.100000e+03, +1.192282e-02, +6.731190e+03, -3.832590e+06, +3.571719e+06, +4.048632e+06, -3.355677e+06, +2.049398e+03, +2.816028e+03, +8.387274e+01, -1.042190e-01, +2.215435e-06, +3.367741e-04, -3.454297e-09, +4.986425e-15, +4.000000e+07, +4.704222e+04, +4.513786e+05, -1.029741e+01, +6.559953e+02, -4.585770e+02 },
+    { +1.150000e+03, +1.265084e-02, +6.855427e+03, -4.201406e+06, +3.682335e+06, +4.188368e+06, -3.695373e+06, +2.060486e+03, +2.776654e+03, +7.904615e+01, -8.950789e-02, +2.058940e-06, +2.569231e-04, -2.839367e-09, +3.313509e-15, +4.000000e+07, +4.347279e+04, +4.856867e+05, -7.923896e+00, +6.358033e+02, -3.796267e+02 },
+    { +1.200000e+03, +1.335702e-02, +6.973061e+03, -4.575391e+06, +3.792283e+06, +4.326563e+06, -4.041110e+06, +2.076044e+03, +2.753362e+03, +7.486698e+01, -7.811536e-02, +1.928772e-06, +2.019960e-04, -2.389348e-09, +2.148176e-15, +4.000000e+07, +4.050006e+04, +5.184647e+05, -6.212294e+00, +6.188837e+02, -2.993832e+02 },
+    { +1.250000e+03, +1.404573e-02, +7.085181e+03, -4.954416e+06, +3.902061e+06, +4.463890e+06, -4.392587e+06, +2.094573e+03, +2.741244e+03, +7.119602e+01, -6.904991e-02, +1.818197e-06, +1.626952e-04, -2.048525e-09, +1.316439e-15, +4.000000e+07, +3.797713e+04, +5.499953e+05, -4.949787e+00, +6.045451e+02, -2.190170e+02 },
+    { +1.273000e+03, +1.435759e-02, +7.135135e+03, -5.130426e+06, +3.952600e+06, +4.526904e+06, -4.556122e+06, +2.103794e+03, +2.738482e+03, +6.964959e+01, -6.547726e-02, +1.772603e-06, +1.482958e-04, -1.918579e-09, +1.014903e-15, +4.000000e+07, +3.693847e+04, +5.641420e+05, -4.480339e+00, +5.986685e+02, -1.822174e+02 },
+    // P = 50.0 MPa
+    { +2.691340e+02, +9.764545e-04, -6.059258e+01, +4.614757e+02, -1.584605e+04, +3.297667e+04, +4.928420e+04, +4.015577e+03, +4.016853e+03, +1.024113e+03, -4.811756e-02, +4.658176e-07, -1.296228e-02, -3.266314e-09, -1.108505e-15, +5.000000e+07, +1.032970e+05, +2.146763e+06, +2.930098e+04, +1.558082e+04, +1.096706e+04 },
+    { +2.700000e+02, +9.764988e-04, -4.768503e+01, +5.061411e+02, -1.236882e+04, +3.645612e+04, +4.933108e+04, +4.016864e+03, +4.018812e+03, +1.024067e+03, -5.919069e-02, +4.630329e-07, -1.261375e-02, -3.165278e-09, -1.089034e-15, +5.000000e+07, +1.278326e+05, +2.159674e+06, +2.902774e+04, +1.541278e+04, +1.096998e+04 },
+    { +2.750000e+02, +9.769243e-04, +2.615179e+01, +5.382127e+02, +7.729954e+03, +5.657617e+04, +4.938443e+04, +4.020763e+03, +4.028882e+03, +1.023621e+03, -1.177946e-01, +4.485538e-07, -1.090778e-02, -2.642488e-09, -9.954251e-16, +5.000000e+07, +2.626097e+05, +2.229387e+06, +2.756484e+04, +1.443285e+04, +1.102973e+04 },
+    { +2.800000e+02, +9.776115e-04, +9.882407e+01, +1.909308e+02, +2.786167e+04, +7.674224e+04, +4.907150e+04, +4.019827e+03, +4.037325e+03, +1.022901e+03, -1.689387e-01, +4.364674e-07, -9.605967e-03, -2.204385e-09, -9.267722e-16, +5.000000e+07, +3.870591e+05, +2.291122e+06, +2.623624e+04, +1.345433e+04, +1.114596e+04 },
+    { +2.850000e+02, +9.785301e-04, +1.703489e+02, -5.284066e+02, +4.802102e+04, +9.694752e+04, +4.839810e+04, +4.015228e+03, +4.044627e+03, +1.021941e+03, -2.143298e-01, +4.264006e-07, -8.590754e-03, -1.832073e-09, -8.761065e-16, +5.000000e+07, +5.026490e+05, +2.345213e+06, +2.498563e+04, +1.249851e+04, +1.130065e+04 },
+    { +2.900000e+02, +9.796569e-04, +2.407491e+02, -1.612957e+03, +6.820428e+04, +1.171871e+05, +4.736989e+04, +4.007737e+03, +4.051092e+03, +1.020765e+03, -2.551912e-01, +4.180596e-07, -7.783314e-03, -1.512149e-09, -8.388356e-16, +5.000000e+07, +6.104183e+05, +2.392004e+06, +2.378121e+04, +1.158177e+04, +1.148054e+04 },
+    { +2.950000e+02, +9.809739e-04, +3.100506e+02, -3.056257e+03, +8.840866e+04, +1.374574e+05, +4.599244e+04, +3.997873e+03, +4.056905e+03, +1.019395e+03, -2.924182e-01, +4.112085e-07, -7.129524e-03, -1.234635e-09, -8.118429e-16, +5.000000e+07, +7.111189e+05, +2.431856e+06, +2.260656e+04, +1.071575e+04, +1.167577e+04 },
+    { +3.000000e+02, +9.824667e-04, +3.782804e+02, -4.852163e+03, +1.086320e+05, +1.577553e+05, +4.427117e+04, +3.986004e+03, +4.062185e+03, +1.017846e+03, -3.266787e-01, +4.056554e-07, -6.591464e-03, -9.918418e-10, -7.929590e-16, +5.000000e+07, +8.053109e+05, +2.465146e+06, +2.145466e+04, +9.907978e+03, +1.187897e+04 },
+    { +3.050000e+02, +9.841237e-04, +4.454658e+02, -6.994810e+03, +1.288723e+05, +1.780784e+05, +4.221138e+04, +3.972403e+03, +4.067010e+03, +1.016132e+03, -3.584802e-01, +4.012424e-07, -6.142098e-03, -7.776968e-10, -7.806419e-16, +5.000000e+07, +8.934255e+05, +2.492259e+06, +2.032398e+04, +9.162631e+03, +1.208457e+04 },
+    { +3.100000e+02, +9.859357e-04, +5.116339e+02, -9.478579e+03, +1.491279e+05, +1.984247e+05, +3.981821e+04, +3.957287e+03, +4.071442e+03, +1.014265e+03, -3.882146e-01, +3.978389e-07, -5.761836e-03, -5.873214e-10, -7.737765e-16, +5.000000e+07, +9.758086e+05, +2.513580e+06, +1.921595e+04, +8.481267e+03, +1.228836e+04 },
+    { +3.150000e+02, +9.878951e-04, +5.768115e+02, -1.229807e+04, +1.693975e+05, +2.187923e+05, +3.709669e+04, +3.940840e+03, +4.075534e+03, +1.012253e+03, -4.161896e-01, +3.953362e-07, -5.436280e-03, -4.167449e-10, -7.715459e-16, +5.000000e+07, +1.052748e+06, +2.529492e+06, +1.813348e+04, +7.863476e+03, +1.248711e+04 },
+    { +3.200000e+02, +9.899956e-04, +6.410246e+02, -1.544808e+04, +1.896798e+05, +2.391796e+05, +3.405170e+04, +3.923226e+03, +4.079338e+03, +1.010106e+03, -4.426506e-01, +3.936439e-07, -5.154708e-03, -2.627029e-10, -7.733466e-16, +5.000000e+07, +1.124495e+06, +2.540367e+06, +1.707993e+04, +7.307433e+03, +1.267837e+04 },
+    { +3.250000e+02, +9.922319e-04, +7.042993e+02, -1.892359e+04, +2.099737e+05, +2.595853e+05, +3.068800e+04, +3.904595e+03, +4.082906e+03, +1.007829e+03, -4.677964e-01, +3.926862e-07, -4.909030e-03, -1.224882e-10, -7.787312e-16, +5.000000e+07, +1.191273e+06, +2.546563e+06, +1.605859e+04, +6.810330e+03, +1.286029e+04 },
+    { +3.300000e+02, +9.945998e-04, +7.666609e+02, -2.271976e+04, +2.302783e+05, +2.800083e+05, +2.701023e+04, +3.885085e+03, +4.086292e+03, +1.005429e+03, -4.917903e-01, +3.923998e-07, -4.693078e-03, +6.160711e-12, -7.873696e-16, +5.000000e+07, +1.253289e+06, +2.548421e+06, +1.507234e+04, +6.368726e+03, +1.303144e+04 },
+    { +3.350000e+02, +9.970958e-04, +8.281347e+02, -2.683191e+04, +2.505932e+05, +3.004480e+05, +2.302287e+04, +3.864828e+03, +4.089550e+03, +1.002913e+03, -5.147687e-01, +3.927317e-07, -4.502093e-03, +1.251467e-10, -7.990209e-16, +5.000000e+07, +1.310739e+06, +2.546268e+06, +1.412356e+04, +5.978810e+03, +1.319077e+04 },
+    { +3.400000e+02, +9.997168e-04, +8.887453e+02, -3.125552e+04, +2.709179e+05, +3.209037e+05, +1.873032e+04, +3.843943e+03, +4.092736e+03, +1.000283e+03, -5.368466e-01, +3.936378e-07, -4.332368e-03, +2.360822e-10, -8.135143e-16, +5.000000e+07, +1.363809e+06, +2.540406e+06, +1.321403e+04, +5.636601e+03, +1.333751e+04 },
+    { +3.450000e+02, +1.002460e-03, +9.485174e+02, -3.598621e+04, +2.912523e+05, +3.413753e+05, +1.413682e+04, +3.822546e+03, +4.095901e+03, +9.975455e+02, -5.581229e-01, +3.950814e-07, -4.180984e-03, +3.403429e-10, -8.307352e-16, +5.000000e+07, +1.412678e+06, +2.531124e+06, +1.234494e+04, +5.338087e+03, +1.347109e+04 },
+    { +3.500000e+02, +1.005325e-03, +1.007475e+03, -4.101974e+04, +3.115965e+05, +3.618628e+05, +9.246504e+03, +3.800740e+03, +4.099098e+03, +9.947032e+02, -5.786832e-01, +3.970321e-07, -4.045625e-03, +4.391114e-10, -8.506150e-16, +5.000000e+07, +1.457522e+06, +2.518688e+06, +1.151700e+04, +5.079338e+03, +1.359115e+04 },
+    { +3.550000e+02, +1.008309e-03, +1.065642e+03, -4.635205e+04, +3.319510e+05, +3.823664e+05, +4.063386e+03, +3.778622e+03, +4.102375e+03, +9.917598e+02, -5.986027e-01, +3.994651e-07, -3.924435e-03, +5.334118e-10, -8.731238e-16, +5.000000e+07, +1.498511e+06, +2.503348e+06, +1.073039e+04, +4.856565e+03, +1.369744e+04 },
+    { +3.600000e+02, +1.011411e-03, +1.123043e+03, -5.197917e+04, +3.523162e+05, +4.028867e+05, -1.408641e+03, +3.756279e+03, +4.105779e+03, +9.887182e+02, -6.179486e-01, +4.023603e-07, -3.815915e-03, +6.241387e-10, -8.982652e-16, +5.000000e+07, +1.535809e+06, +2.485335e+06, +9.984947e+03, +4.666177e+03, +1.378984e+04 },
+    { +3.650000e+02, +1.014630e-03, +1.179699e+03, -5.789729e+04, +3.726930e+05, +4.234245e+05, -7.165801e+03, +3.733791e+03, +4.109353e+03, +9.855812e+02, -6.367810e-01, +4.057018e-07, -3.718845e-03, +7.120802e-10, -9.260725e-16, +5.000000e+07, +1.569579e+06, +2.464864e+06, +9.280126e+03, +4.504803e+03, +1.386833e+04 },
+    { +3.700000e+02, +1.017966e-03, +1.235635e+03, -6.410273e+04, +3.930823e+05, +4.439806e+05, -1.320443e+04, +3.711228e+03, +4.113135e+03, +9.823511e+02, -6.551545e-01, +4.094776e-07, -3.632224e-03, +7.979372e-10, -9.566061e-16, +5.000000e+07, +1.599976e+06, +2.442136e+06, +8.615128e+03, +4.369305e+03, +1.393294e+04 },
+    { +3.750000e+02, +1.021419e-03, +1.290873e+03, -7.059193e+04, +4.134853e+05, +4.645563e+05, -1.952099e+04, +3.688655e+03, +4.117164e+03, +9.790303e+02, -6.731192e-01, +4.136788e-07, -3.555228e-03, +8.823397e-10, -9.899519e-16, +5.000000e+07, +1.627154e+06, +2.417334e+06, +7.988928e+03, +4.256789e+03, +1.398377e+04 },
+    { +3.800000e+02, +1.024989e-03, +1.345434e+03, -7.736147e+04, +4.339033e+05, +4.851527e+05, -2.611203e+04, +3.666126e+03, +4.121471e+03, +9.756205e+02, -6.907216e-01, +4.182995e-07, -3.487172e-03, +9.658599e-10, -1.026220e-15, +5.000000e+07, +1.651261e+06, +2.390631e+06, +7.400330e+03, +4.164592e+03, +1.402098e+04 },
+    { +3.850000e+02, +1.028676e-03, +1.399340e+03, -8.440802e+04, +4.543377e+05, +5.057715e+05, -3.297423e+04, +3.643691e+03, +4.126088e+03, +9.721236e+02, -7.080049e-01, +4.233368e-07, -3.427485e-03, +1.049023e-09, -1.065546e-15, +5.000000e+07, +1.672439e+06, +2.362185e+06, +6.848013e+03, +4.090285e+03, +1.404475e+04 },
+    { +3.900000e+02, +1.032481e-03, +1.452612e+03, -9.172841e+04, +4.747901e+05, +5.264142e+05, -4.010437e+04, +3.621393e+03, +4.131043e+03, +9.685410e+02, -7.250096e-01, +4.287900e-07, -3.375691e-03, +1.132320e-09, -1.108087e-15, +5.000000e+07, +1.690827e+06, +2.332144e+06, +6.330564e+03, +4.031654e+03, +1.405529e+04 },
+    { +3.950000e+02, +1.036405e-03, +1.505270e+03, -9.931957e+04, +4.952623e+05, +5.470825e+05, -4.749933e+04, +3.599268e+03, +4.136361e+03, +9.648739e+02, -7.417743e-01, +4.346610e-07, -3.331391e-03, +1.216209e-09, -1.154027e-15, +5.000000e+07, +1.706558e+06, +2.300644e+06, +5.846510e+03, +3.986691e+03, +1.405284e+04 },
+    { +4.000000e+02, +1.040449e-03, +1.557336e+03, -1.071785e+05, +5.157560e+05, +5.677784e+05, -5.515609e+04, +3.577348e+03, +4.142065e+03, +9.611236e+02, -7.583355e-01, +4.409538e-07, -3.294252e-03, +1.301131e-09, -1.203577e-15, +5.000000e+07, +1.719762e+06, +2.267811e+06, +5.394346e+03, +3.953578e+03, +1.403766e+04 },
+    { +4.100000e+02, +1.048904e-03, +1.659767e+03, -1.236886e+05, +5.568157e+05, +6.092609e+05, -7.124345e+04, +3.534223e+03, +4.154724e+03, +9.533765e+02, -7.909865e-01, +4.548320e-07, -3.240393e-03, +1.475764e-09, -1.314482e-15, +5.000000e+07, +1.739074e+06, +2.198614e+06, +4.579619e+03, +3.916510e+03, +1.397016e+04 },
+    { +4.200000e+02, +1.057859e-03, +1.760055e+03, -1.412373e+05, +5.979859e+05, +6.508789e+05, -8.834428e+04, +3.492183e+03, +4.169182e+03, +9.453052e+02, -8.232296e-01, +4.704996e-07, -3.212437e-03, +1.659543e-09, -1.443066e-15, +5.000000e+07, +1.749693e+06, +2.125400e+06, +3.874381e+03, +3.909202e+03, +1.385506e+04 },
+    { +4.300000e+02, +1.067336e-03, +1.858346e+03, -1.598047e+05, +6.392843e+05, +6.926511e+05, -1.064379e+05, +3.451336e+03, +4.185593e+03, +9.369124e+02, -8.553180e-01, +4.880645e-07, -3.209314e-03, +1.855809e-09, -1.592151e-15, +5.000000e+07, +1.752469e+06, +2.048909e+06, +3.267089e+03, +3.922582e+03, +1.369470e+04 },
+    { +4.400000e+02, +1.077356e-03, +1.954779e+03, -1.793728e+05, +6.807300e+05, +7.345978e+05, -1.255050e+05, +3.411747e+03, +4.204109e+03, +9.281985e+02, -8.874968e-01, +5.076690e-07, -3.230469e-03, +2.068070e-09, -1.765227e-15, +5.000000e+07, +1.748180e+06, +1.969787e+06, +2.746906e+03, +3.949375e+03, +1.349145e+04 },
+    { +4.500000e+02, +1.087948e-03, +2.049486e+03, -1.999251e+05, +7.223434e+05, +7.767408e+05, -1.455277e+05, +3.373452e+03, +4.224889e+03, +9.191614e+02, -9.200079e-01, +5.294919e-07, -3.275800e-03, +2.300151e-09, -1.966612e-15, +5.000000e+07, +1.737530e+06, +1.888603e+06, +2.303829e+03, +3.983768e+03, +1.324771e+04 },
+    { +4.600000e+02, +1.099147e-03, +2.142594e+03, -2.214468e+05, +7.641463e+05, +8.191037e+05, -1.664894e+05, +3.336461e+03, +4.248106e+03, +9.097964e+02, -9.530945e-01, +5.537524e-07, -3.345649e-03, +2.556344e-09, -2.201654e-15, +5.000000e+07, +1.721156e+06, +1.805861e+06, +1.928742e+03, +4.021130e+03, +1.296589e+04 },
+    { +4.700000e+02, +1.110992e-03, +2.234226e+03, -2.439243e+05, +8.061621e+05, +8.617117e+05, -1.883747e+05, +3.300771e+03, +4.273955e+03, +9.000967e+02, -9.870052e-01, +5.807156e-07, -3.440804e-03, +2.841587e-09, -2.476999e-15, +5.000000e+07, +1.699636e+06, +1.722013e+06, +1.613419e+03, +4.057786e+03, +1.264839e+04 },
+    { +4.800000e+02, +1.123529e-03, +2.324504e+03, -2.673459e+05, +8.484158e+05, +9.045923e+05, -2.111694e+05, +3.266366e+03, +4.302660e+03, +8.900527e+02, -1.021999e+00, +6.107001e-07, -3.562542e-03, +3.161676e-09, -2.800958e-15, +5.000000e+07, +1.673488e+06, +1.637465e+06, +1.350492e+03, +4.090827e+03, +1.229766e+04 },
+    { +4.900000e+02, +1.136813e-03, +2.413543e+03, -2.917013e+05, +8.909346e+05, +9.477753e+05, -2.348606e+05, +3.233227e+03, +4.334482e+03, +8.796522e+02, -1.058351e+00, +6.440881e-07, -3.712693e-03, +3.523527e-09, -3.183990e-15, +5.000000e+07, +1.643177e+06, +1.552583e+06, +1.133396e+03, +4.117956e+03, +1.191615e+04 },
+    { +5.000000e+02, +1.150907e-03, +2.501460e+03, -3.169819e+05, +9.337480e+05, +9.912933e+05, -2.594365e+05, +3.201331e+03, +4.369729e+03, +8.688802e+02, -1.096356e+00, +6.813376e-07, -3.893735e-03, +3.935517e-09, -3.639355e-15, +5.000000e+07, +1.609123e+06, +1.467701e+06, +9.563110e+02, +4.137367e+03, +1.150635e+04 },
+    { +5.100000e+02, +1.165884e-03, +2.588370e+03, -3.431806e+05, +9.768883e+05, +1.035182e+06, -2.848865e+05, +3.170657e+03, +4.408765e+03, +8.577185e+02, -1.136339e+00, +7.229996e-07, -4.108937e-03, +4.407927e-09, -4.184015e-15, +5.000000e+07, +1.571701e+06, +1.383127e+06, +8.140935e+02, +4.147649e+03, +1.107080e+04 },
+    { +5.200000e+02, +1.181830e-03, +2.674392e+03, -3.702924e+05, +1.020391e+06, +1.079483e+06, -3.112010e+05, +3.141189e+03, +4.452024e+03, +8.461456e+02, -1.178662e+00, +7.697398e-07, -4.362550e-03, +4.953535e-09, -4.839871e-15, +5.000000e+07, +1.531248e+06, +1.299140e+06, +7.022054e+02, +4.147699e+03, +1.061212e+04 },
+    { +5.300000e+02, +1.198845e-03, +2.759642e+03, -3.983140e+05, +1.064297e+06, +1.124239e+06, -3.383717e+05, +3.112918e+03, +4.500030e+03, +8.341361e+02, -1.223736e+00, +8.223674e-07, -4.660075e-03, +5.588426e-09, -5.635508e-15, +5.000000e+07, +1.488065e+06, +1.216002e+06, +6.166471e+02, +4.136665e+03, +1.013294e+04 },
+    { +5.400000e+02, +1.217048e-03, +2.844246e+03, -4.272441e+05, +1.108649e+06, +1.169501e+06, -3.663917e+05, +3.085841e+03, +4.553416e+03, +8.216602e+02, -1.272034e+00, +8.818736e-07, -5.008617e-03, +6.333101e-09, -6.608659e-15, +5.000000e+07, +1.442422e+06, +1.133949e+06, +5.538897e+02, +4.113887e+03, +9.635946e+03 },
+    { +5.500000e+02, +1.236579e-03, +2.928332e+03, -4.570839e+05, +1.153499e+06, +1.215328e+06, -3.952549e+05, +3.059969e+03, +4.612952e+03, +8.086829e+02, -1.324109e+00, +9.494827e-07, -5.417373e-03, +7.214021e-09, -7.809765e-15, +5.000000e+07, +1.394558e+06, +1.053205e+06, +5.108082e+02, +4.078848e+03, +9.123822e+03 },
+    { +5.600000e+02, +1.257603e-03, +3.012037e+03, -4.878372e+05, +1.198904e+06, +1.261784e+06, -4.249570e+05, +3.035328e+03, +4.679592e+03, +7.951632e+02, -1.380621e+00, +1.026722e-06, -5.898275e-03, +8.265779e-09, -9.307161e-15, +5.000000e+07, +1.344688e+06, +9.739733e+05, +4.846152e+02, +4.031131e+03, +8.599206e+03 },
+    { +5.700000e+02, +1.280323e-03, +3.095512e+03, -5.195110e+05, +1.244931e+06, +1.308947e+06, -4.554949e+05, +3.011957e+03, +4.754518e+03, +7.810530e+02, -1.442366e+00, +1.115519e-06, -6.466845e-03, +9.534181e-09, -1.119476e-14, +5.000000e+07, +1.293001e+06, +8.964440e+05, +4.727916e+02, +3.970365e+03, +8.064627e+03 },
+    { +5.800000e+02, +1.304980e-03, +3.178920e+03, -5.521160e+05, +1.291658e+06, +1.356907e+06, -4.868670e+05, +2.989919e+03, +4.839218e+03, +7.662952e+02, -1.510317e+00, +1.218330e-06, -7.143294e-03, +1.108063e-08, -1.360359e-14, +5.000000e+07, +1.239662e+06, +8.207955e+05, +4.730126e+02, +3.896180e+03, +7.522434e+03 },
+    { +5.900000e+02, +1.331874e-03, +3.262447e+03, -5.856674e+05, +1.339176e+06, +1.405770e+06, -5.190737e+05, +2.969301e+03, +4.935577e+03, +7.508220e+02, -1.585679e+00, +1.338332e-06, -7.953913e-03, +1.298844e-08, -1.671932e-14, +5.000000e+07, +1.184817e+06, +7.471985e+05, +4.830641e+02, +3.808141e+03, +6.974717e+03 },
+    { +6.000000e+02, +1.361374e-03, +3.346304e+03, -6.201858e+05, +1.387596e+06, +1.455665e+06, -5.521171e+05, +2.950218e+03, +5.046010e+03, +7.345520e+02, -1.669955e+00, +1.479680e-06, -8.932734e-03, +1.537184e-08, -2.080935e-14, +5.000000e+07, +1.128592e+06, +6.758220e+05, +5.007466e+02, +3.705691e+03, +6.423261e+03 },
+    { +6.100000e+02, +1.393948e-03, +3.430736e+03, -6.556991e+05, +1.437050e+06, +1.506748e+06, -5.860017e+05, +2.932819e+03, +5.173638e+03, +7.173869e+02, -1.765038e+00, +1.647875e-06, -1.012342e-02, +1.838906e-08, -2.626506e-14, +5.000000e+07, +1.071099e+06, +6.068421e+05, +5.237614e+02, +3.588090e+03, +5.869558e+03 },
+    { +6.200000e+02, +1.430191e-03, +3.516038e+03, -6.922443e+05, +1.487699e+06, +1.559209e+06, -6.207347e+05, +2.917290e+03, +5.322527e+03, +6.992073e+02, -1.873312e+00, +1.850300e-06, -1.158123e-02, +2.226106e-08, -3.366882e-14, +5.000000e+07, +1.012437e+06, +5.404529e+05, +5.495776e+02, +3.454392e+03, +5.314977e+03 },
+    { +6.300000e+02, +1.470876e-03, +3.602560e+03, -7.298703e+05, +1.539743e+06, +1.613287e+06, -6.563265e+05, +2.903854e+03, +5.498013e+03, +6.798668e+02, -1.997782e+00, +2.096971e-06, -1.337545e-02, +2.729974e-08, -4.390286e-14, +5.000000e+07, +9.526991e+05, +4.768784e+05, +5.752878e+02, +3.303508e+03, +4.761192e+03 },
+    { +6.400000e+02, +1.517024e-03, +3.690738e+03, -7.686426e+05, +1.593430e+06, +1.669281e+06, -6.927914e+05, +2.892768e+03, +5.707181e+03, +6.591852e+02, -2.142233e+00, +2.401654e-06, -1.559409e-02, +3.395318e-08, -5.833363e-14, +5.000000e+07, +8.919822e+05, +4.163797e+05, +5.974851e+02, +3.134460e+03, +4.211023e+03 },
+    { +6.500000e+02, +1.570007e-03, +3.781112e+03, -8.086489e+05, +1.649074e+06, +1.727574e+06, -7.301486e+05, +2.884307e+03, +5.959595e+03, +6.369397e+02, -2.311465e+00, +2.783592e-06, -1.835435e-02, +4.288526e-08, -7.914306e-14, +5.000000e+07, +8.303892e+05, +3.592480e+05, +6.122433e+02, +2.946973e+03, +3.669408e+03 },
+    { +6.750000e+02, +1.746730e-03, +4.021668e+03, -9.149671e+05, +1.799659e+06, +1.886995e+06, -8.276306e+05, +2.876192e+03, +6.875869e+03, +5.724984e+02, -2.884759e+00, +4.284985e-06, -2.803210e-02, +8.212775e-08, -1.877069e-13, +5.000000e+07, +6.732249e+05, +2.333730e+05, +5.894887e+02, +2.409509e+03, +2.385791e+03 },
+    { +7.000000e+02, +2.036524e-03, +4.296423e+03, -1.033344e+06, +1.974152e+06, +2.075978e+06, -9.315180e+05, +2.884615e+03, +8.313134e+03, +4.910329e+02, -3.628517e+00, +7.041315e-06, -2.673821e-02, +1.356371e-07, -4.374071e-13, +5.000000e+07, +5.153180e+05, +1.420189e+05, +4.403107e+02, +1.810538e+03, +1.252923e+03 },
+    { +7.250000e+02, +2.532604e-03, +4.614100e+03, -1.169453e+06, +2.175769e+06, +2.302399e+06, -1.042823e+06, +2.875748e+03, +9.605710e+03, +3.948506e+02, -3.870777e+00, +1.035276e-05, +2.064096e-02, +8.287587e-08, -6.046539e-13, +5.000000e+07, +3.738885e+05, +9.659262e+04, +1.847334e+02, +1.336049e+03, +5.449274e+02 },
+    { +7.500000e+02, +3.226495e-03, +4.931538e+03, -1.323550e+06, +2.375103e+06, +2.536428e+06, -1.162226e+06, +2.792952e+03, +8.801094e+03, +3.099338e+02, -2.807437e+00, +1.024244e-05, +4.965901e-02, -6.586305e-08, -1.785956e-13, +5.000000e+07, +2.740986e+05, +9.763303e+04, -1.319717e+01, +1.094449e+03, +1.662115e+02 },
+    { +7.750000e+02, +3.940790e-03, +5.193437e+03, -1.485958e+06, +2.538957e+06, +2.735996e+06, -1.288918e+06, +2.655263e+03, +7.175797e+03, +2.537562e+02, -1.762314e+00, +8.268856e-06, +3.234834e-02, -7.786569e-08, +3.462801e-14, +5.000000e+07, +2.131267e+05, +1.209357e+05, -8.837022e+01, +1.030882e+03, -6.124791e+01 },
+    { +8.000000e+02, +4.585677e-03, +5.399906e+03, -1.650716e+06, +2.669209e+06, +2.898492e+06, -1.421433e+06, +2.519674e+03, +5.904149e+03, +2.180703e+02, -1.153062e+00, +6.608623e-06, +1.781384e-02, -5.474430e-08, +6.408954e-14, +5.000000e+07, +1.744784e+05, +1.513175e+05, -1.000966e+02, +9.974394e+02, -2.220518e+02 },
+    { +8.250000e+02, +5.157609e-03, +5.567669e+03, -1.816473e+06, +2.776854e+06, +3.034734e+06, -1.558592e+06, +2.407745e+03, +5.052936e+03, +1.938883e+02, -8.126521e-01, +5.479021e-06, +1.027522e-02, -3.695627e-08, +5.400120e-14, +5.000000e+07, +1.483207e+05, +1.825144e+05, -9.133693e+01, +9.642604e+02, -3.283179e+02 },
+    { +8.500000e+02, +5.671707e-03, +5.709452e+03, -1.983186e+06, +2.869848e+06, +3.153433e+06, -1.699601e+06, +2.320508e+03, +4.478840e+03, +1.763137e+02, -6.093624e-01, +4.704133e-06, +6.393089e-03, -2.592681e-08, +4.120398e-14, +5.000000e+07, +1.295377e+05, +2.125790e+05, -7.812186e+01, +9.304291e+02, -3.958224e+02 },
+    { +9.000000e+02, +6.577465e-03, +5.943749e+03, -2.320023e+06, +3.029351e+06, +3.358224e+06, -1.991150e+06, +2.203440e+03, +3.786935e+03, +1.520343e+02, -3.895911e-01, +3.732167e-06, +2.984549e-03, -1.456027e-08, +2.377614e-14, +5.000000e+07, +1.043874e+05, +2.679409e+05, -5.461027e+01, +8.671320e+02, -4.573600e+02 },
+    { +9.500000e+02, +7.373771e-03, +6.137346e+03, -2.661995e+06, +3.168483e+06, +3.537172e+06, -2.293307e+06, +2.137453e+03, +3.405360e+03, +1.356158e+02, -2.780440e-01, +3.149508e-06, +1.658055e-03, -9.341262e-09, +1.439490e-14, +5.000000e+07, +8.828172e+04, +3.175099e+05, -3.839298e+01, +8.136033e+02, -4.607661e+02 },
+    { +1.000000e+03, +8.098427e-03, +6.305726e+03, -3.009390e+06, +3.296337e+06, +3.701258e+06, -2.604468e+06, +2.102515e+03, +3.176293e+03, +1.234808e+02, -2.125207e-01, +2.758603e-06, +1.032518e-03, -6.555202e-09, +9.061949e-15, +5.000000e+07, +7.703922e+04, +3.625023e+05, -2.765384e+01, +7.696661e+02, -4.316719e+02 },
+    { +1.050000e+03, +8.773086e-03, +6.456938e+03, -3.362249e+06, +3.417536e+06, +3.856190e+06, -2.923595e+06, +2.087069e+03, +3.031589e+03, +1.139850e+02, -1.700970e-01, +2.475573e-06, +6.959386e-04, -4.896119e-09, +5.819733e-15, +5.000000e+07, +6.871012e+04, +4.039468e+05, -2.043489e+01, +7.336659e+02, -3.835973e+02 },
+    { +1.100000e+03, +9.411153e-03, +6.595646e+03, -3.720512e+06, +3.534698e+06, +4.005256e+06, -3.249955e+06, +2.084275e+03, +2.937661e+03, +1.062569e+02, -1.406766e-01, +2.259315e-06, +4.968980e-04, -3.826160e-09, +3.739203e-15, +5.000000e+07, +6.226516e+04, +4.426120e+05, -1.545677e+01, +7.039543e+02, -3.242266e+02 },
+    { +1.150000e+03, +1.002146e-02, +6.724777e+03, -4.084073e+06, +3.649421e+06, +4.150494e+06, -3.583000e+06, +2.089903e+03, +2.876212e+03, +9.978590e+01, -1.192119e-01, +2.087398e-06, +3.705906e-04, -3.093471e-09, +2.347955e-15, +5.000000e+07, +5.711027e+04, +4.790652e+05, -1.193383e+01, +6.791879e+02, -2.581509e+02 },
+    { +1.200000e+03, +1.061009e-02, +6.846285e+03, -4.452810e+06, +3.762732e+06, +4.293237e+06, -3.922305e+06, +2.101216e+03, +2.836483e+03, +9.424991e+01, -1.029308e-01, +1.946547e-06, +2.859464e-04, -2.567841e-09, +1.388179e-15, +5.000000e+07, +5.287865e+04, +5.137302e+05, -9.380702e+00, +6.583285e+02, -1.882136e+02 },
+    { +1.250000e+03, +1.118143e-02, +6.961532e+03, -4.826596e+06, +3.875319e+06, +4.434391e+06, -4.267525e+06, +2.116379e+03, +2.811762e+03, +8.943402e+01, -9.019749e-02, +1.828391e-06, +2.267103e-04, -2.176527e-09, +7.103885e-16, +5.000000e+07, +4.933162e+04, +5.469289e+05, -7.490712e+00, +6.405843e+02, -1.162220e+02 },
+    { +1.273000e+03, +1.143936e-02, +7.012726e+03, -5.000199e+06, +3.927002e+06, +4.498970e+06, -4.428231e+06, +2.124282e+03, +2.804164e+03, +8.741749e+01, -8.523503e-02, +1.780061e-06, +2.053222e-04, -2.029022e-09, +4.667686e-16, +5.000000e+07, +4.788321e+04, +5.617785e+05, -6.786430e+00, +6.332957e+02, -8.275553e+01 },
+    // P = 75.0 MPa
+    { +2.668430e+02, +9.655543e-04, -9.629542e+01, +9.618772e+02, -2.473388e+04, +4.768269e+04, +7.337845e+04, +3.927095e+03, +3.932467e+03, +1.035674e+03, -9.809272e-02, +4.456234e-07, -1.122958e-02, -2.930222e-09, -1.074653e-15, +7.500000e+07, +2.201247e+05, +2.244047e+06, +2.821145e+04, +1.594711e+04, +1.214407e+04 },
+    { +2.700000e+02, +9.658936e-04, -4.995839e+01, +1.167196e+03, -1.232157e+04, +6.012045e+04, +7.360921e+04, +3.936601e+03, +3.946616e+03, +1.035311e+03, -1.317852e-01, +4.368155e-07, -1.015027e-02, -2.653737e-09, -1.008613e-15, +7.500000e+07, +3.016953e+05, +2.289296e+06, +2.711284e+04, +1.550267e+04, +1.210125e+04 },
+    { +2.750000e+02, +9.666217e-04, +2.263232e+01, +1.180490e+03, +7.404379e+03, +7.990100e+04, +7.367711e+04, +3.945472e+03, +3.964870e+03, +1.034531e+03, -1.790245e-01, +4.245484e-07, -8.811042e-03, -2.261936e-09, -9.252019e-16, +7.500000e+07, +4.216823e+05, +2.355444e+06, +2.563475e+04, +1.471403e+04, +1.209080e+04 },
+    { +2.800000e+02, +9.675576e-04, +9.420857e+01, +8.177604e+02, +2.719616e+04, +9.976298e+04, +7.338458e+04, +3.948646e+03, +3.979407e+03, +1.033530e+03, -2.204451e-01, +4.141148e-07, -7.803047e-03, -1.919020e-09, -8.617440e-16, +7.500000e+07, +5.323284e+05, +2.414789e+06, +2.436605e+04, +1.386516e+04, +1.213434e+04 },
+    { +2.850000e+02, +9.686789e-04, +1.647507e+02, +8.583507e+01, +4.703978e+04, +1.196907e+05, +7.273675e+04, +3.947578e+03, +3.991310e+03, +1.032334e+03, -2.574419e-01, +4.052886e-07, -7.028202e-03, -1.617918e-09, -8.133426e-16, +7.500000e+07, +6.352063e+05, +2.467378e+06, +2.322246e+04, +1.299509e+04, +1.221745e+04 },
+    { +2.900000e+02, +9.699684e-04, +2.342555e+02, -1.008822e+03, +6.692526e+04, +1.396729e+05, +7.173881e+04, +3.943218e+03, +4.001289e+03, +1.030961e+03, -2.910034e-01, +3.978759e-07, -6.419799e-03, -1.352690e-09, -7.765564e-16, +7.500000e+07, +7.313923e+05, +2.513347e+06, +2.215239e+04, +1.213262e+04, +1.232907e+04 },
+    { +2.950000e+02, +9.714129e-04, +3.027297e+02, -2.460055e+03, +8.684521e+04, +1.597012e+05, +7.039592e+04, +3.936202e+03, +4.009813e+03, +1.029428e+03, -3.218401e-01, +3.917104e-07, -5.932009e-03, -1.118228e-09, -7.489174e-16, +7.500000e+07, +8.216276e+05, +2.552906e+06, +2.112560e+04, +1.129818e+04, +1.246059e+04 },
+    { +3.000000e+02, +9.730024e-04, +3.701864e+02, -4.261973e+03, +1.067939e+05, +1.797691e+05, +6.871321e+04, +3.926970e+03, +4.017197e+03, +1.027747e+03, -3.504709e-01, +3.866497e-07, -5.533018e-03, -9.101116e-10, -7.286252e-16, +7.500000e+07, +9.064301e+05, +2.586320e+06, +2.012564e+04, +1.050555e+04, +1.260524e+04 },
+    { +3.050000e+02, +9.747286e-04, +4.366423e+02, -6.408922e+03, +1.267670e+05, +1.998716e+05, +6.669572e+04, +3.915844e+03, +4.023660e+03, +1.025927e+03, -3.772807e-01, +3.825718e-07, -5.200501e-03, -7.245206e-10, -7.143477e-16, +7.500000e+07, +9.861698e+05, +2.613888e+06, +1.914471e+04, +9.763441e+03, +1.275765e+04 },
+    { +3.100000e+02, +9.765850e-04, +5.021163e+02, -8.895452e+03, +1.467606e+05, +2.200045e+05, +6.434842e+04, +3.903072e+03, +4.029365e+03, +1.023976e+03, -4.025601e-01, +3.793725e-07, -4.918616e-03, -5.581648e-10, -7.050874e-16, +7.500000e+07, +1.061121e+06, +2.635932e+06, +1.818026e+04, +9.076683e+03, +1.291355e+04 },
+    { +3.150000e+02, +9.785662e-04, +5.666287e+02, -1.171631e+04, +1.667717e+05, +2.401642e+05, +6.167616e+04, +3.888861e+03, +4.034439e+03, +1.021903e+03, -4.265322e-01, +3.769628e-07, -4.675992e-03, -4.082174e-10, -7.000904e-16, +7.500000e+07, +1.131497e+06, +2.652782e+06, +1.723273e+04, +8.447284e+03, +1.306949e+04 },
+    { +3.200000e+02, +9.806681e-04, +6.302009e+02, -1.486641e+04, +1.867979e+05, +2.603480e+05, +5.868370e+04, +3.873386e+03, +4.038988e+03, +1.019713e+03, -4.493716e-01, +3.752670e-07, -4.464378e-03, -2.722544e-10, -6.987832e-16, +7.500000e+07, +1.197472e+06, +2.664769e+06, +1.630419e+04, +7.875199e+03, +1.322274e+04 },
+    { +3.250000e+02, +9.828868e-04, +6.928544e+02, -1.834083e+04, +2.068369e+05, +2.805534e+05, +5.537568e+04, +3.856808e+03, +4.043105e+03, +1.017411e+03, -4.712174e-01, +3.742204e-07, -4.277714e-03, -1.481987e-10, -7.007281e-16, +7.500000e+07, +1.259197e+06, +2.672222e+06, +1.539733e+04, +7.358946e+03, +1.337110e+04 },
+    { +3.300000e+02, +9.852194e-04, +7.546115e+02, -2.213481e+04, +2.268870e+05, +3.007784e+05, +5.175665e+04, +3.839272e+03, +4.046874e+03, +1.015002e+03, -4.921827e-01, +3.737682e-07, -4.111500e-03, -3.426958e-11, -7.055906e-16, +7.500000e+07, +1.316813e+06, +2.675455e+06, +1.451500e+04, +6.896079e+03, +1.351282e+04 },
+    { +3.350000e+02, +9.876634e-04, +8.154944e+02, -2.624373e+04, +2.469469e+05, +3.210217e+05, +4.783102e+04, +3.820913e+03, +4.050370e+03, +1.012491e+03, -5.123608e-01, +3.738634e-07, -3.962358e-03, +7.106206e-11, -7.131166e-16, +7.500000e+07, +1.370449e+06, +2.674773e+06, +1.365983e+04, +6.483530e+03, +1.364651e+04 },
+    { +3.400000e+02, +9.902168e-04, +8.755256e+02, -3.066313e+04, +2.670156e+05, +3.412818e+05, +4.360312e+04, +3.801856e+03, +4.053666e+03, +1.009880e+03, -5.318304e-01, +3.744667e-07, -3.827718e-03, +1.691120e-10, -7.231155e-16, +7.500000e+07, +1.420234e+06, +2.670465e+06, +1.283407e+04, +6.117881e+03, +1.377109e+04 },
+    { +3.450000e+02, +9.928777e-04, +9.347274e+02, -3.538868e+04, +2.870923e+05, +3.615581e+05, +3.907715e+04, +3.782218e+03, +4.056827e+03, +1.007173e+03, -5.506589e-01, +3.755443e-07, -3.705609e-03, +2.610162e-10, -7.354470e-16, +7.500000e+07, +1.466295e+06, +2.662802e+06, +1.203955e+04, +5.795546e+03, +1.388570e+04 },
+    { +3.500000e+02, +9.956448e-04, +9.931222e+02, -4.041616e+04, +3.071766e+05, +3.818500e+05, +3.425720e+04, +3.762106e+03, +4.059914e+03, +1.004374e+03, -5.689048e-01, +3.770682e-07, -3.594497e-03, +3.477591e-10, -7.500124e-16, +7.500000e+07, +1.508758e+06, +2.652040e+06, +1.127759e+04, +5.512913e+03, +1.398971e+04 },
+    { +3.550000e+02, +9.985170e-04, +1.050732e+03, -4.574153e+04, +3.272684e+05, +4.021572e+05, +2.914724e+04, +3.741619e+03, +4.062983e+03, +1.001485e+03, -5.866202e-01, +3.790147e-07, -3.493174e-03, +4.301976e-10, -7.667471e-16, +7.500000e+07, +1.547750e+06, +2.638420e+06, +1.054910e+04, +5.266439e+03, +1.408263e+04 },
+    { +3.600000e+02, +1.001493e-03, +1.107580e+03, -5.136086e+04, +3.473678e+05, +4.224798e+05, +2.375114e+04, +3.720845e+03, +4.066083e+03, +9.985089e+02, -6.038513e-01, +3.813643e-07, -3.400681e-03, +5.090816e-10, -7.856153e-16, +7.500000e+07, +1.583398e+06, +2.622165e+06, +9.854561e+03, +5.052711e+03, +1.416413e+04 },
+    { +3.650000e+02, +1.004573e-03, +1.163686e+03, -5.727033e+04, +3.674752e+05, +4.428182e+05, +1.807267e+04, +3.699867e+03, +4.069262e+03, +9.954475e+02, -6.206404e-01, +3.841007e-07, -3.316243e-03, +5.850712e-10, -8.066066e-16, +7.500000e+07, +1.615827e+06, +2.603484e+06, +9.194105e+03, +4.868495e+03, +1.423398e+04 },
+    { +3.700000e+02, +1.007757e-03, +1.219073e+03, -6.346626e+04, +3.875909e+05, +4.631727e+05, +1.211548e+04, +3.678757e+03, +4.072561e+03, +9.923031e+02, -6.370261e-01, +3.872111e-07, -3.239231e-03, +6.587511e-10, -8.297323e-16, +7.500000e+07, +1.645165e+06, +2.582570e+06, +8.567546e+03, +4.710755e+03, +1.429205e+04 },
+    { +3.750000e+02, +1.011043e-03, +1.273762e+03, -6.994511e+04, +4.077158e+05, +4.835440e+05, +5.883103e+03, +3.657581e+03, +4.076016e+03, +9.890778e+02, -6.530442e-01, +3.906853e-07, -3.169125e-03, +7.306428e-10, -8.550236e-16, +7.500000e+07, +1.671535e+06, +2.559605e+06, +7.974439e+03, +4.576666e+03, +1.433828e+04 },
+    { +3.800000e+02, +1.014432e-03, +1.327774e+03, -7.670342e+04, +4.278507e+05, +5.039331e+05, -6.210164e+02, +3.636396e+03, +4.079662e+03, +9.857733e+02, -6.687281e-01, +3.945154e-07, -3.105489e-03, +8.012154e-10, -8.825302e-16, +7.500000e+07, +1.695062e+06, +2.534755e+06, +7.414127e+03, +4.463619e+03, +1.437268e+04 },
+    { +3.850000e+02, +1.017925e-03, +1.381129e+03, -8.373789e+04, +4.479967e+05, +5.243410e+05, -7.393543e+03, +3.615252e+03, +4.083527e+03, +9.823910e+02, -6.841093e-01, +3.986959e-07, -3.047959e-03, +8.708940e-10, -9.123191e-16, +7.500000e+07, +1.715867e+06, +2.508177e+06, +6.885780e+03, +4.369220e+03, +1.439532e+04 },
+    { +3.900000e+02, +1.021521e-03, +1.433846e+03, -9.104530e+04, +4.681548e+05, +5.447688e+05, -1.443124e+04, +3.594195e+03, +4.087638e+03, +9.789326e+02, -6.992174e-01, +4.032235e-07, -2.996224e-03, +9.400676e-10, -9.444736e-16, +7.500000e+07, +1.734069e+06, +2.480014e+06, +6.388436e+03, +4.291275e+03, +1.440630e+04 },
+    { +3.950000e+02, +1.025221e-03, +1.485946e+03, -9.862257e+04, +4.883263e+05, +5.652179e+05, -2.173098e+04, +3.573262e+03, +4.092019e+03, +9.753993e+02, -7.140807e-01, +4.080964e-07, -2.950014e-03, +1.009095e-09, -9.790936e-16, +7.500000e+07, +1.749785e+06, +2.450402e+06, +5.921032e+03, +4.227792e+03, +1.440576e+04 },
+    { +4.000000e+02, +1.029027e-03, +1.537448e+03, -1.064667e+05, +5.085125e+05, +5.856895e+05, -2.928971e+04, +3.552486e+03, +4.096690e+03, +9.717922e+02, -7.287263e-01, +4.133147e-07, -2.909099e-03, +1.078312e-09, -1.016295e-15, +7.500000e+07, +1.763127e+06, +2.419464e+06, +5.482431e+03, +4.176957e+03, +1.439386e+04 },
+    { +4.100000e+02, +1.036956e-03, +1.638730e+03, -1.229442e+05, +5.489350e+05, +6.267067e+05, -4.517247e+04, +3.511516e+03, +4.106975e+03, +9.643607e+02, -7.574673e-01, +4.247964e-07, -2.842364e-03, +1.218560e-09, -1.098992e-15, +7.500000e+07, +1.783130e+06, +2.354069e+06, +4.686872e+03, +4.106832e+03, +1.433679e+04 },
+    { +4.200000e+02, +1.045320e-03, +1.737835e+03, -1.404561e+05, +5.894345e+05, +6.678335e+05, -6.205705e+04, +3.471458e+03, +4.118622e+03, +9.566447e+02, -7.856371e-01, +4.377005e-07, -2.794677e-03, +1.363175e-09, -1.193835e-15, +7.500000e+07, +1.794919e+06, +2.284667e+06, +3.992041e+03, +4.069605e+03, +1.423682e+04 },
+    { +4.300000e+02, +1.054130e-03, +1.834899e+03, -1.589821e+05, +6.300243e+05, +7.090841e+05, -7.992236e+04, +3.432431e+03, +4.131742e+03, +9.486492e+02, -8.134208e-01, +4.520819e-07, -2.764994e-03, +1.514389e-09, -1.302396e-15, +7.500000e+07, +1.799277e+06, +2.211989e+06, +3.388228e+03, +4.056121e+03, +1.409586e+04 },
+    { +4.400000e+02, +1.063403e-03, +1.930051e+03, -1.785039e+05, +6.707184e+05, +7.504736e+05, -9.874865e+04, +3.394510e+03, +4.146431e+03, +9.403770e+02, -8.409943e-01, +4.680176e-07, -2.752507e-03, +1.674394e-09, -1.426589e-15, +7.500000e+07, +1.796929e+06, +2.136672e+06, +2.866057e+03, +4.059003e+03, +1.391594e+04 },
+    { +4.500000e+02, +1.073158e-03, +2.023413e+03, -1.990042e+05, +7.115314e+05, +7.920183e+05, -1.185174e+05, +3.357736e+03, +4.162783e+03, +9.318294e+02, -8.685262e-01, +4.856065e-07, -2.756603e-03, +1.845418e-09, -1.568727e-15, +7.500000e+07, +1.788539e+06, +2.059280e+06, +2.416681e+03, +4.072333e+03, +1.369916e+04 },
+    { +4.600000e+02, +1.083416e-03, +2.115101e+03, -2.204676e+05, +7.524789e+05, +8.337351e+05, -1.392113e+05, +3.322128e+03, +4.180891e+03, +9.230061e+02, -8.961801e-01, +5.049705e-07, -2.776841e-03, +2.029801e-09, -1.731590e-15, +7.500000e+07, +1.774718e+06, +1.980314e+06, +2.031899e+03, +4.091381e+03, +1.344767e+04 },
+    { +4.700000e+02, +1.094206e-03, +2.205227e+03, -2.428797e+05, +7.935768e+05, +8.756423e+05, -1.608142e+05, +3.287683e+03, +4.200854e+03, +9.139049e+02, -9.241159e-01, +5.262554e-07, -2.812940e-03, +2.230059e-09, -1.918519e-15, +7.500000e+07, +1.756022e+06, +1.900218e+06, +1.704199e+03, +4.112378e+03, +1.316365e+04 },
+    { +4.800000e+02, +1.105556e-03, +2.293895e+03, -2.662277e+05, +8.348420e+05, +9.177587e+05, -1.833110e+05, +3.254388e+03, +4.222780e+03, +9.045223e+02, -9.524913e-01, +5.496337e-07, -2.864766e-03, +2.448955e-09, -2.133535e-15, +7.500000e+07, +1.732956e+06, +1.819393e+06, +1.426768e+03, +4.132337e+03, +1.284931e+04 },
+    { +4.900000e+02, +1.117502e-03, +2.381209e+03, -2.905002e+05, +8.762922e+05, +9.601048e+05, -2.066876e+05, +3.222223e+03, +4.246792e+03, +8.948531e+02, -9.814636e-01, +5.753069e-07, -2.932336e-03, +2.689576e-09, -2.381483e-15, +7.500000e+07, +1.705983e+06, +1.738203e+06, +1.193469e+03, +4.148897e+03, +1.250688e+04 },
+    { +5.000000e+02, +1.130083e-03, +2.467266e+03, -3.156872e+05, +9.179457e+05, +1.002702e+06, -2.309310e+05, +3.191161e+03, +4.273027e+03, +8.848905e+02, -1.011191e+00, +6.035092e-07, -3.015815e-03, +2.955411e-09, -2.668221e-15, +7.500000e+07, +1.675519e+06, +1.656975e+06, +9.988062e+02, +4.160205e+03, +1.213864e+04 },
+    { +5.100000e+02, +1.143346e-03, +2.552161e+03, -3.417800e+05, +9.598224e+05, +1.045573e+06, -2.560291e+05, +3.161176e+03, +4.301642e+03, +8.746262e+02, -1.041834e+00, +6.345124e-07, -3.115528e-03, +3.250453e-09, -3.000853e-15, +7.500000e+07, +1.641944e+06, +1.576013e+06, +8.378790e+02, +4.164817e+03, +1.174693e+04 },
+    { +5.200000e+02, +1.157340e-03, +2.635988e+03, -3.687712e+05, +1.001943e+06, +1.088743e+06, -2.819707e+05, +3.132240e+03, +4.332815e+03, +8.640502e+02, -1.073557e+00, +6.686309e-07, -3.231964e-03, +3.579312e-09, -3.388030e-15, +7.500000e+07, +1.605605e+06, +1.495593e+06, +7.063286e+02, +4.161626e+03, +1.133412e+04 },
+    { +5.300000e+02, +1.172126e-03, +2.718838e+03, -3.966550e+05, +1.044329e+06, +1.132239e+06, -3.087456e+05, +3.104327e+03, +4.366753e+03, +8.531509e+02, -1.106531e+00, +7.062291e-07, -3.365793e-03, +3.947350e-09, -3.840335e-15, +7.500000e+07, +1.566816e+06, +1.415971e+06, +6.002857e+02, +4.149795e+03, +1.090265e+04 },
+    { +5.400000e+02, +1.187769e-03, +2.800802e+03, -4.254271e+05, +1.087006e+06, +1.176088e+06, -3.363445e+05, +3.077414e+03, +4.403690e+03, +8.419148e+02, -1.140934e+00, +7.477293e-07, -3.517882e-03, +4.360847e-09, -4.370773e-15, +7.500000e+07, +1.525865e+06, +1.337382e+06, +5.163180e+02, +4.128716e+03, +1.045502e+04 },
+    { +5.500000e+02, +1.204345e-03, +2.881968e+03, -4.550848e+05, +1.129998e+06, +1.220324e+06, -3.647589e+05, +3.051483e+03, +4.443900e+03, +8.303268e+02, -1.176953e+00, +7.936221e-07, -3.689313e-03, +4.827209e-09, -4.995404e-15, +7.500000e+07, +1.483015e+06, +1.260045e+06, +4.513785e+02, +4.097968e+03, +9.993768e+03 },
+    { +5.600000e+02, +1.221942e-03, +2.962428e+03, -4.856271e+05, +1.173333e+06, +1.264978e+06, -3.939815e+05, +3.026521e+03, +4.487695e+03, +8.183697e+02, -1.214789e+00, +8.444788e-07, -3.881397e-03, +5.355204e-09, -5.734162e-15, +7.500000e+07, +1.438508e+06, +1.184162e+06, +4.027559e+02, +4.057287e+03, +9.521464e+03 },
+    { +5.700000e+02, +1.240657e-03, +3.042274e+03, -5.170548e+05, +1.217041e+06, +1.310091e+06, -4.240055e+05, +3.002519e+03, +4.535437e+03, +8.060243e+02, -1.254655e+00, +9.009662e-07, -4.095672e-03, +5.955260e-09, -6.611915e-15, +7.500000e+07, +1.392566e+06, +1.109920e+06, +3.680269e+02, +4.006542e+03, +9.040694e+03 },
+    { +5.800000e+02, +1.260606e-03, +3.121598e+03, -5.493707e+05, +1.261156e+06, +1.355702e+06, -4.548252e+05, +2.979474e+03, +4.587544e+03, +7.932691e+02, -1.296782e+00, +9.638653e-07, -4.333882e-03, +6.639803e-09, -7.659826e-15, +7.500000e+07, +1.345398e+06, +1.037489e+06, +3.450095e+02, +3.945711e+03, +8.554010e+03 },
+    { +5.900000e+02, +1.281919e-03, +3.200498e+03, -5.825800e+05, +1.305714e+06, +1.401858e+06, -4.864360e+05, +2.957392e+03, +4.644499e+03, +7.800803e+02, -1.341419e+00, +1.034093e-06, -4.597894e-03, +7.423635e-09, -8.917107e-15, +7.500000e+07, +1.297194e+06, +9.670311e+05, +3.317183e+02, +3.874866e+03, +8.063903e+03 },
+    { +6.000000e+02, +1.304748e-03, +3.279073e+03, -6.166902e+05, +1.350754e+06, +1.448610e+06, -5.188341e+05, +2.936281e+03, +4.706861e+03, +7.664315e+02, -1.388832e+00, +1.112727e-06, -4.889536e-03, +8.324328e-09, -1.043325e-14, +7.500000e+07, +1.248134e+06, +8.986928e+05, +3.263190e+02, +3.794146e+03, +7.572750e+03 },
+    { +6.100000e+02, +1.329269e-03, +3.357429e+03, -6.517119e+05, +1.396320e+06, +1.496015e+06, -5.520167e+05, +2.916159e+03, +4.775270e+03, +7.522934e+02, -1.439307e+00, +1.201038e-06, -5.210275e-03, +9.362562e-09, -1.227083e-14, +7.500000e+07, +1.198386e+06, +8.326134e+05, +3.270842e+02, +3.703750e+03, +7.082785e+03 },
+    { +6.200000e+02, +1.355686e-03, +3.435677e+03, -6.876587e+05, +1.442461e+06, +1.544138e+06, -5.859823e+05, +2.897046e+03, +4.850455e+03, +7.376341e+02, -1.493137e+00, +1.300517e-06, -5.560671e-03, +1.056231e-08, -1.450884e-14, +7.500000e+07, +1.148111e+06, +7.689253e+05, +3.323501e+02, +3.603912e+03, +6.596070e+03 },
+    { +6.300000e+02, +1.384239e-03, +3.513936e+03, -7.245482e+05, +1.489231e+06, +1.593049e+06, -6.207303e+05, +2.878967e+03, +4.933229e+03, +7.224185e+02, -1.550615e+00, +1.412912e-06, -5.939496e-03, +1.195065e-08, -1.724672e-14, +7.500000e+07, +1.097460e+06, +7.077581e+05, +3.404758e+02, +3.494905e+03, +6.114503e+03 },
+    { +6.400000e+02, +1.415210e-03, +3.592331e+03, -7.624023e+05, +1.536690e+06, +1.642830e+06, -6.562615e+05, +2.861945e+03, +5.024481e+03, +7.066088e+02, -1.612008e+00, +1.540256e-06, -6.342415e-03, +1.355696e-08, -2.060858e-14, +7.500000e+07, +1.046584e+06, +6.492428e+05, +3.498091e+02, +3.377044e+03, +5.639873e+03 },
+    { +6.500000e+02, +1.448930e-03, +3.670997e+03, -8.012476e+05, +1.584901e+06, +1.693570e+06, -6.925778e+05, +2.846000e+03, +5.125144e+03, +6.901646e+02, -1.677514e+00, +1.684878e-06, -6.760178e-03, +1.541108e-08, -2.474743e-14, +7.500000e+07, +9.956295e+05, +5.935149e+05, +3.586672e+02, +3.250723e+03, +5.173985e+03 },
+    { +6.750000e+02, +1.547971e-03, +3.869799e+03, -9.029278e+05, +1.709186e+06, +1.825284e+06, -7.868300e+05, +2.810823e+03, +5.423735e+03, +6.460069e+02, -1.859222e+00, +2.139770e-06, -7.738565e-03, +2.128938e-08, -3.979547e-14, +7.500000e+07, +8.688888e+05, +4.673401e+05, +3.676360e+02, +2.902288e+03, +4.061932e+03 },
+    { +7.000000e+02, +1.674920e-03, +4.073537e+03, -1.011728e+06, +1.839748e+06, +1.965367e+06, -8.861090e+05, +2.781517e+03, +5.794620e+03, +5.970433e+02, -2.059349e+00, +2.763964e-06, -8.065818e-03, +2.884976e-08, -6.460521e-14, +7.500000e+07, +7.450710e+05, +3.617993e+05, +3.400642e+02, +2.524475e+03, +3.059641e+03 },
+    { +7.250000e+02, +1.841045e-03, +4.284104e+03, -1.128643e+06, +1.977333e+06, +2.115411e+06, -9.905644e+05, +2.755063e+03, +6.208967e+03, +5.431697e+02, -2.241239e+00, +3.573821e-06, -5.780446e-03, +3.510852e-08, -9.971290e-14, +7.500000e+07, +6.271268e+05, +2.798126e+05, +2.689974e+02, +2.147173e+03, +2.184505e+03 },
+    { +7.500000e+02, +2.057921e-03, +4.500673e+03, -1.254710e+06, +2.120795e+06, +2.275139e+06, -1.100366e+06, +2.725212e+03, +6.541929e+03, +4.859274e+02, -2.310763e+00, +4.443646e-06, +7.062257e-04, +3.270830e-08, -1.311684e-13, +7.500000e+07, +5.200152e+05, +2.250405e+05, +1.679159e+02, +1.797898e+03, +1.494896e+03 },
+    { +7.750000e+02, +2.330029e-03, +4.717703e+03, -1.390355e+06, +2.265865e+06, +2.440617e+06, -1.215603e+06, +2.684064e+03, +6.648664e+03, +4.291793e+02, -2.196812e+00, +5.121659e-06, +8.408895e-03, +1.967197e-08, -1.393489e-13, +7.500000e+07, +4.289259e+05, +1.952493e+05, +6.883049e+01, +1.528642e+03, +1.037222e+03 },
+    { +8.000000e+02, +2.648563e-03, +4.926347e+03, -1.534823e+06, +2.406254e+06, +2.604897e+06, -1.336181e+06, +2.628077e+03, +6.442248e+03, +3.775633e+02, -1.910259e+00, +5.369020e-06, +1.368382e-02, +2.979900e-10, -1.095274e-13, +7.500000e+07, +3.557929e+05, +1.862537e+05, -5.763695e+00, +1.341518e+03, +7.076814e+02 },
+    { +8.250000e+02, +2.992023e-03, +5.118240e+03, -1.686181e+06, +2.536367e+06, +2.760769e+06, -1.461779e+06, +2.560086e+03, +6.002774e+03, +3.342221e+02, -1.556119e+00, +5.194833e-06, +1.395711e-02, -1.266913e-08, -6.782799e-14, +7.500000e+07, +2.995513e+05, +1.924990e+05, -5.404078e+01, +1.222365e+03, +4.838316e+02 },
+    { +8.500000e+02, +3.339232e-03, +5.289851e+03, -1.842365e+06, +2.654009e+06, +2.904451e+06, -1.591923e+06, +2.488289e+03, +5.490855e+03, +2.994701e+02, -1.233990e+00, +4.806655e-06, +1.160652e-02, -1.725276e-08, -3.607579e-14, +7.500000e+07, +2.567254e+05, +2.080449e+05, -7.705960e+01, +1.147612e+03, +3.248532e+02 },
+    { +9.000000e+02, +3.999997e-03, +5.577329e+03, -2.163881e+06, +2.855715e+06, +3.155715e+06, -1.863881e+06, +2.361338e+03, +4.608679e+03, +2.500002e+02, -7.871566e-01, +3.970225e-06, +6.574824e-03, -1.500386e-08, -7.825347e-15, +7.500000e+07, +1.982650e+05, +2.518749e+05, -8.003074e+01, +1.050287e+03, +1.250426e+02 },
+    { +9.500000e+02, +4.598638e-03, +5.809538e+03, -2.493636e+06, +3.025426e+06, +3.370323e+06, -2.148738e+06, +2.271367e+03, +4.019368e+03, +2.174557e+02, -5.384575e-01, +3.332291e-06, +3.695395e-03, -1.067188e-08, -1.093315e-15, +7.500000e+07, +1.615878e+05, +3.000938e+05, -6.540774e+01, +9.769799e+02, +2.954722e+01 },
+    { +1.000000e+03, +5.142993e-03, +6.005399e+03, -2.829958e+06, +3.175441e+06, +3.561165e+06, -2.444234e+06, +2.213991e+03, +3.641723e+03, +1.944393e+02, -3.943100e-01, +2.880454e-06, +2.229995e-03, -7.620062e-09, +1.194520e-16, +7.500000e+07, +1.368916e+05, +3.471676e+05, -5.068214e+01, +9.164396e+02, -4.998166e+00 },
+    { +1.050000e+03, +5.645388e-03, +6.176688e+03, -3.172275e+06, +3.313247e+06, +3.736651e+06, -2.748871e+06, +2.180256e+03, +3.394538e+03, +1.771357e+02, -3.043244e-01, +2.552296e-06, +1.445667e-03, -5.648039e-09, +6.120606e-17, +7.500000e+07, +1.192355e+05, +3.918041e+05, -3.904072e+01, +8.659126e+02, -3.681301e+00 },
+    { +1.100000e+03, +6.115688e-03, +6.330519e+03, -3.520289e+06, +3.443281e+06, +3.901958e+06, -3.061613e+06, +2.162988e+03, +3.228373e+03, +1.635139e+02, -2.442889e-01, +2.304540e-06, +9.944220e-04, -4.348126e-09, -2.414646e-16, +7.500000e+07, +1.060033e+05, +4.339261e+05, -3.032152e+01, +8.235362e+02, +1.972880e+01 },
+    { +1.150000e+03, +6.561095e-03, +6.471356e+03, -3.873789e+06, +3.568270e+06, +4.060353e+06, -3.381707e+06, +2.157164e+03, +3.114413e+03, +1.524136e+02, -2.020235e-01, +2.110713e-06, +7.172178e-04, -3.458024e-09, -5.386293e-16, +7.500000e+07, +9.571339e+04, +4.737735e+05, -2.384260e+01, +7.877648e+02, +5.727992e+01 },
+    { +1.200000e+03, +6.986839e-03, +6.602133e+03, -4.232594e+06, +3.689965e+06, +4.213978e+06, -3.708581e+06, +2.159336e+03, +3.035374e+03, +1.431262e+02, -1.709647e-01, +1.954485e-06, +5.373087e-04, -2.825075e-09, -7.771461e-16, +7.500000e+07, +8.747298e+04, +5.116436e+05, -1.899576e+01, +7.573414e+02, +1.040891e+02 },
+    { +1.250000e+03, +7.396778e-03, +6.724861e+03, -4.596545e+06, +3.809532e+06, +4.364290e+06, -4.041786e+06, +2.167118e+03, +2.980455e+03, +1.351940e+02, -1.473400e-01, +1.825433e-06, +4.151175e-04, -2.359636e-09, -9.550490e-16, +7.500000e+07, +8.071510e+04, +5.478154e+05, -1.532731e+01, +7.312645e+02, +1.570103e+02 },
+    { +1.273000e+03, +7.580868e-03, +6.779023e+03, -4.765649e+06, +3.864048e+06, +4.432613e+06, -4.197084e+06, +2.172100e+03, +2.961261e+03, +1.319110e+02, -1.383021e-01, +1.773200e-06, +3.719120e-04, -2.185945e-09, -1.019180e-15, +7.500000e+07, +7.799576e+04, +5.639522e+05, -1.394270e+01, +7.205041e+02, +1.828007e+02 },
+    // P = 100 MPa
+    { +2.643470e+02, +9.552289e-04, -1.356276e+02, +1.574816e+03, -3.427794e+04, +6.124495e+04, +9.709771e+04, +3.840063e+03, +3.851197e+03, +1.046869e+03, -1.402366e-01, +4.260788e-07, -1.022539e-02, -2.565171e-09, -1.036340e-15, +1.000000e+08, +3.291331e+05, +2.346984e+06, +2.822535e+04, +1.600867e+04, +1.339777e+04 },
+    { +2.650000e+02, +9.553144e-04, -1.261198e+02, +1.651722e+03, -3.177001e+04, +6.376143e+04, +9.718317e+04, +3.843935e+03, +3.856220e+03, +1.046776e+03, -1.468301e-01, +4.244176e-07, -9.971022e-03, -2.522534e-09, -1.022319e-15, +1.000000e+08, +3.459567e+05, +2.356170e+06, +2.789411e+04, +1.596739e+04, +1.337229e+04 },
+    { +2.700000e+02, +9.560922e-04, -5.371964e+01, +2.023238e+03, -1.248107e+04, +8.312815e+04, +9.763246e+04, +3.866739e+03, +3.888889e+03, +1.045924e+03, -1.924304e-01, +4.125992e-07, -8.360913e-03, -2.208638e-09, -9.286950e-16, +1.000000e+08, +4.663857e+05, +2.423659e+06, +2.574671e+04, +1.551808e+04, +1.322172e+04 },
+    { +2.750000e+02, +9.570635e-04, +1.787436e+01, +2.015363e+03, +6.930812e+03, +1.026372e+05, +9.772171e+04, +3.880152e+03, +3.913622e+03, +1.044863e+03, -2.312014e-01, +4.022914e-07, -7.210302e-03, -1.918623e-09, -8.553682e-16, +1.000000e+08, +5.747113e+05, +2.485761e+06, +2.410724e+04, +1.489272e+04, +1.313805e+04 },
+    { +2.800000e+02, +9.582028e-04, +8.857144e+01, +1.634928e+03, +2.643493e+04, +1.222552e+05, +9.745521e+04, +3.886921e+03, +3.932835e+03, +1.043620e+03, -2.650551e-01, +3.933714e-07, -6.374237e-03, -1.653506e-09, -7.978597e-16, +1.000000e+08, +6.738037e+05, +2.542127e+06, +2.278954e+04, +1.415983e+04, +1.310745e+04 },
+    { +2.850000e+02, +9.594920e-04, +1.583209e+02, +8.883810e+02, +4.600983e+04, +1.419590e+05, +9.683758e+04, +3.888825e+03, +3.948144e+03, +1.042218e+03, -2.953021e-01, +3.857154e-07, -5.754234e-03, -1.412917e-09, -7.528202e-16, +1.000000e+08, +7.655960e+05, +2.592585e+06, +2.167126e+04, +1.337090e+04, +1.311869e+04 },
+    { +2.900000e+02, +9.609177e-04, +2.270977e+02, -2.181457e+02, +6.564019e+04, +1.617320e+05, +9.587362e+04, +3.887025e+03, +3.960626e+03, +1.040672e+03, -3.228452e-01, +3.792035e-07, -5.283594e-03, -1.195545e-09, -7.177230e-16, +1.000000e+08, +8.513772e+05, +2.637106e+06, +2.067373e+04, +1.256368e+04, +1.316254e+04 },
+    { +2.950000e+02, +9.624702e-04, +2.948934e+02, -1.678784e+03, +8.531477e+04, +1.815618e+05, +9.456823e+04, +3.882290e+03, +3.971001e+03, +1.038993e+03, -3.483109e-01, +3.737243e-07, -4.917136e-03, -9.995481e-10, -6.906493e-16, +1.000000e+08, +9.319997e+05, +2.675769e+06, +1.974773e+04, +1.176512e+04, +1.323133e+04 },
+    { +3.000000e+02, +9.641421e-04, +3.617099e+02, -3.487892e+03, +1.050251e+05, +2.014393e+05, +9.292632e+04, +3.875149e+03, +3.979760e+03, +1.037191e+03, -3.721386e-01, +3.691759e-07, -4.624175e-03, -8.228505e-10, -6.701329e-16, +1.000000e+08, +1.008025e+06, +2.708736e+06, +1.886368e+04, +1.099385e+04, +1.331867e+04 },
+    { +3.050000e+02, +9.659278e-04, +4.275558e+02, -5.640028e+03, +1.247645e+05, +2.213573e+05, +9.095275e+04, +3.865978e+03, +3.987245e+03, +1.035274e+03, -3.946399e-01, +3.654671e-07, -4.383778e-03, -6.633415e-10, -6.550467e-16, +1.000000e+08, +1.079823e+06, +2.736224e+06, +1.800479e+04, +1.026215e+04, +1.341922e+04 },
+    { +3.100000e+02, +9.678229e-04, +4.924441e+02, -8.129928e+03, +1.445277e+05, +2.413100e+05, +8.865236e+04, +3.855063e+03, +3.993705e+03, +1.033247e+03, -4.160398e-01, +3.625172e-07, -4.181585e-03, -5.189923e-10, -6.445197e-16, +1.000000e+08, +1.147641e+06, +2.758490e+06, +1.716251e+04, +9.577552e+03, +1.352852e+04 },
+    { +3.150000e+02, +9.698237e-04, +5.563906e+02, -1.095249e+04, +1.643106e+05, +2.612929e+05, +8.602988e+04, +3.842630e+03, +3.999327e+03, +1.031115e+03, -4.365028e-01, +3.602551e-07, -4.007683e-03, -3.879200e-10, -6.378756e-16, +1.000000e+08, +1.211649e+06, +2.775811e+06, +1.633340e+04, +8.944121e+03, +1.364287e+04 },
+    { +3.200000e+02, +9.719276e-04, +6.194130e+02, -1.410277e+04, +1.841094e+05, +2.813022e+05, +8.308999e+04, +3.828872e+03, +4.004262e+03, +1.028883e+03, -4.561522e-01, +3.586187e-07, -3.855181e-03, -2.684156e-10, -6.345873e-16, +1.000000e+08, +1.271970e+06, +2.788477e+06, +1.551708e+04, +8.363371e+03, +1.375918e+04 },
+    { +3.250000e+02, +9.741320e-04, +6.815303e+02, -1.757594e+04, +2.039214e+05, +3.013346e+05, +7.983726e+04, +3.813955e+03, +4.008632e+03, +1.026555e+03, -4.750821e-01, +3.575542e-07, -3.719254e-03, -1.589501e-10, -6.342429e-16, +1.000000e+08, +1.328700e+06, +2.796779e+06, +1.471488e+04, +7.835021e+03, +1.387490e+04 },
+    { +3.300000e+02, +9.764352e-04, +7.427623e+02, -2.136735e+04, +2.237442e+05, +3.213877e+05, +7.627616e+04, +3.798031e+03, +4.012544e+03, +1.024134e+03, -4.933666e-01, +3.570148e-07, -3.596496e-03, -5.816836e-11, -6.365204e-16, +1.000000e+08, +1.381922e+06, +2.801004e+06, +1.392893e+04, +7.357549e+03, +1.398794e+04 },
+    { +3.350000e+02, +9.788354e-04, +8.031294e+02, -2.547246e+04, +2.435759e+05, +3.414594e+05, +7.241108e+04, +3.781238e+03, +4.016091e+03, +1.021622e+03, -5.110650e-01, +3.569601e-07, -3.484485e-03, +3.512382e-11, -6.411686e-16, +1.000000e+08, +1.431715e+06, +2.801434e+06, +1.316165e+04, +6.928609e+03, +1.409657e+04 },
+    { +3.400000e+02, +9.813314e-04, +8.626526e+02, -2.988686e+04, +2.634150e+05, +3.615482e+05, +6.824628e+04, +3.763702e+03, +4.019354e+03, +1.019024e+03, -5.282264e-01, +3.573553e-07, -3.381482e-03, +1.219754e-10, -6.479926e-16, +1.000000e+08, +1.478155e+06, +2.798336e+06, +1.241541e+04, +6.545338e+03, +1.419938e+04 },
+    { +3.450000e+02, +9.839220e-04, +9.213528e+02, -3.460627e+04, +2.832604e+05, +3.816526e+05, +6.378592e+04, +3.745541e+03, +4.022409e+03, +1.016341e+03, -5.448927e-01, +3.581706e-07, -3.286226e-03, +2.033066e-10, -6.568430e-16, +1.000000e+08, +1.521322e+06, +2.791965e+06, +1.169232e+04, +6.204587e+03, +1.429525e+04 },
+    { +3.500000e+02, +9.866062e-04, +9.792512e+02, -3.962654e+04, +3.031114e+05, +4.017720e+05, +5.903409e+04, +3.726863e+03, +4.025320e+03, +1.013576e+03, -5.611000e-01, +3.593805e-07, -3.197791e-03, +2.799246e-10, -6.676070e-16, +1.000000e+08, +1.561298e+06, +2.782566e+06, +1.099418e+04, +5.903083e+03, +1.438326e+04 },
+    { +3.550000e+02, +9.893835e-04, +1.036369e+03, -4.494363e+04, +3.229674e+05, +4.219057e+05, +5.399471e+04, +3.707767e+03, +4.028148e+03, +1.010730e+03, -5.768808e-01, +3.609632e-07, -3.115490e-03, +3.525390e-10, -6.802028e-16, +1.000000e+08, +1.598171e+06, +2.770366e+06, +1.032237e+04, +5.637548e+03, +1.446271e+04 },
+    { +3.600000e+02, +9.922530e-04, +1.092727e+03, -5.055364e+04, +3.428281e+05, +4.420534e+05, +4.867166e+04, +3.688343e+03, +4.030946e+03, +1.007807e+03, -5.922643e-01, +3.629003e-07, -3.038804e-03, +4.217742e-10, -6.945736e-16, +1.000000e+08, +1.632030e+06, +2.755578e+06, +9.677921e+03, +5.404779e+03, +1.453304e+04 },
+    { +3.650000e+02, +9.952146e-04, +1.148347e+03, -5.645278e+04, +3.626937e+05, +4.622152e+05, +4.306867e+04, +3.668673e+03, +4.033761e+03, +1.004808e+03, -6.072775e-01, +3.651762e-07, -2.967333e-03, +4.881822e-10, -7.106847e-16, +1.000000e+08, +1.662971e+06, +2.738404e+06, +9.061505e+03, +5.201700e+03, +1.459384e+04 },
+    { +3.700000e+02, +9.982678e-04, +1.203248e+03, -6.263738e+04, +3.825644e+05, +4.823912e+05, +3.718939e+04, +3.648829e+03, +4.036635e+03, +1.001735e+03, -6.219458e-01, +3.677782e-07, -2.900763e-03, +5.522523e-10, -7.285198e-16, +1.000000e+08, +1.691089e+06, +2.719030e+06, +8.473464e+03, +5.025401e+03, +1.464480e+04 },
+    { +3.750000e+02, +1.001412e-03, +1.257452e+03, -6.910389e+04, +4.024405e+05, +5.025817e+05, +3.103736e+04, +3.628878e+03, +4.039606e+03, +9.985895e+02, -6.362929e-01, +3.706956e-07, -2.838841e-03, +6.144204e-10, -7.480792e-16, +1.000000e+08, +1.716484e+06, +2.697631e+06, +7.913862e+03, +4.873153e+03, +1.468572e+04 },
+    { +3.800000e+02, +1.004649e-03, +1.310977e+03, -7.584886e+04, +4.223226e+05, +5.227874e+05, +2.461601e+04, +3.608878e+03, +4.042705e+03, +9.953728e+02, -6.503416e-01, +3.739199e-07, -2.781359e-03, +6.750770e-10, -7.693781e-16, +1.000000e+08, +1.739254e+06, +2.674370e+06, +7.382519e+03, +4.742421e+03, +1.471649e+04 },
+    { +3.850000e+02, +1.007977e-03, +1.363845e+03, -8.286898e+04, +4.422114e+05, +5.430090e+05, +1.792868e+04, +3.588880e+03, +4.045961e+03, +9.920866e+02, -6.641136e-01, +3.774444e-07, -2.728141e-03, +7.345737e-10, -7.924447e-16, +1.000000e+08, +1.759500e+06, +2.649397e+06, +6.879051e+03, +4.630866e+03, +1.473703e+04 },
+    { +3.900000e+02, +1.011396e-03, +1.416074e+03, -9.016101e+04, +4.621077e+05, +5.632473e+05, +1.097862e+04, +3.568929e+03, +4.049399e+03, +9.887321e+02, -6.776299e-01, +3.812642e-07, -2.679035e-03, +7.932293e-10, -8.173199e-16, +1.000000e+08, +1.777323e+06, +2.622853e+06, +6.402906e+03, +4.536335e+03, +1.474735e+04 },
+    { +3.950000e+02, +1.014908e-03, +1.467682e+03, -9.772186e+04, +4.820125e+05, +5.835033e+05, +3.768977e+03, +3.549064e+03, +4.053040e+03, +9.853107e+02, -6.909106e-01, +3.853758e-07, -2.633903e-03, +8.513346e-10, -8.440565e-16, +1.000000e+08, +1.792823e+06, +2.594870e+06, +5.953400e+03, +4.456865e+03, +1.474749e+04 },
+    { +4.000000e+02, +1.018513e-03, +1.518688e+03, -1.055485e+05, +5.019268e+05, +6.037781e+05, -3.697196e+03, +3.529319e+03, +4.056904e+03, +9.818234e+02, -7.039753e-01, +3.897771e-07, -2.592623e-03, +9.091571e-10, -8.727182e-16, +1.000000e+08, +1.806097e+06, +2.565569e+06, +5.529740e+03, +4.390664e+03, +1.473754e+04 },
+    { +4.100000e+02, +1.026004e-03, +1.618966e+03, -1.219877e+05, +5.417882e+05, +6.443886e+05, -1.938736e+04, +3.490302e+03, +4.065360e+03, +9.746552e+02, -7.295322e-01, +3.994469e-07, -2.521172e-03, +1.024927e-09, -9.361284e-16, +1.000000e+08, +1.826356e+06, +2.503462e+06, +4.756414e+03, +4.291713e+03, +1.468786e+04 },
+    { +4.200000e+02, +1.033875e-03, +1.717043e+03, -1.394567e+05, +5.817013e+05, +6.850888e+05, -3.606918e+04, +3.452058e+03, +4.074874e+03, +9.672349e+02, -7.544458e-01, +4.102811e-07, -2.463856e-03, +1.142341e-09, -1.008283e-15, +1.000000e+08, +1.838851e+06, +2.437353e+06, +4.075371e+03, +4.228234e+03, +1.459949e+04 },
+    { +4.300000e+02, +1.042136e-03, +1.813049e+03, -1.579349e+05, +6.216763e+05, +7.258899e+05, -5.372131e+04, +3.414713e+03, +4.085529e+03, +9.595680e+02, -7.788539e-01, +4.223046e-07, -2.419932e-03, +1.263018e-09, -1.090095e-15, +1.000000e+08, +1.844294e+06, +2.367959e+06, +3.478656e+03, +4.191060e+03, +1.447395e+04 },
+    { +4.400000e+02, +1.050797e-03, +1.907107e+03, -1.774033e+05, +6.617238e+05, +7.668034e+05, -7.232367e+04, +3.378348e+03, +4.097389e+03, +9.516590e+02, -8.028868e-01, +4.355574e-07, -2.388715e-03, +1.388465e-09, -1.182671e-15, +1.000000e+08, +1.843355e+06, +2.295909e+06, +2.958309e+03, +4.172771e+03, +1.431290e+04 },
+    { +4.500000e+02, +1.059871e-03, +1.999332e+03, -1.978444e+05, +7.018548e+05, +8.078418e+05, -9.185734e+04, +3.343012e+03, +4.110510e+03, +9.435111e+02, -8.266685e-01, +4.500946e-07, -2.369571e-03, +1.520129e-09, -1.287329e-15, +1.000000e+08, +1.836655e+06, +2.221755e+06, +2.506618e+03, +4.167386e+03, +1.411817e+04 },
+    { +4.600000e+02, +1.069374e-03, +2.089832e+03, -2.192420e+05, +7.420806e+05, +8.490180e+05, -1.123046e+05, +3.308725e+03, +4.124944e+03, +9.351261e+02, -8.503165e-01, +4.659855e-07, -2.361909e-03, +1.659437e-09, -1.405626e-15, +1.000000e+08, +1.824771e+06, +2.145990e+06, +2.116289e+03, +4.170108e+03, +1.389161e+04 },
+    { +4.700000e+02, +1.079325e-03, +2.178710e+03, -2.415811e+05, +7.824127e+05, +8.903453e+05, -1.336486e+05, +3.275493e+03, +4.140739e+03, +9.265048e+02, -8.739431e-01, +4.833136e-07, -2.365181e-03, +1.807834e-09, -1.539388e-15, +1.000000e+08, +1.808232e+06, +2.069050e+06, +1.780532e+03, +4.177097e+03, +1.363519e+04 },
+    { +4.800000e+02, +1.089744e-03, +2.266065e+03, -2.648480e+05, +8.228631e+05, +9.318375e+05, -1.558737e+05, +3.243305e+03, +4.157948e+03, +9.176470e+02, -8.976549e-01, +5.021774e-07, -2.378871e-03, +1.966811e-09, -1.690756e-15, +1.000000e+08, +1.787525e+06, +1.991328e+06, +1.493105e+03, +4.185298e+03, +1.335086e+04 },
+    { +4.900000e+02, +1.100654e-03, +2.351988e+03, -2.890305e+05, +8.634438e+05, +9.735091e+05, -1.789651e+05, +3.212143e+03, +4.176625e+03, +9.085511e+02, -9.215536e-01, +5.226903e-07, -2.402500e-03, +2.137933e-09, -1.862228e-15, +1.000000e+08, +1.763097e+06, +1.913179e+06, +1.248326e+03, +4.192289e+03, +1.304066e+04 },
+    { +5.000000e+02, +1.112081e-03, +2.436568e+03, -3.141171e+05, +9.041670e+05, +1.015375e+06, -2.029090e+05, +3.181983e+03, +4.196831e+03, +8.992149e+02, -9.457365e-01, +5.449821e-07, -2.435612e-03, +2.322866e-09, -2.056728e-15, +1.000000e+08, +1.735353e+06, +1.834923e+06, +1.041059e+03, +4.196160e+03, +1.270662e+04 },
+    { +5.100000e+02, +1.124056e-03, +2.519889e+03, -3.400979e+05, +9.450454e+05, +1.057451e+06, -2.276923e+05, +3.152796e+03, +4.218632e+03, +8.896351e+02, -9.702960e-01, +5.691996e-07, -2.477775e-03, +2.523399e-09, -2.277667e-15, +1.000000e+08, +1.704667e+06, +1.756853e+06, +8.666834e+02, +4.195417e+03, +1.235084e+04 },
+    { +5.200000e+02, +1.136612e-03, +2.602031e+03, -3.669640e+05, +9.860921e+05, +1.099753e+06, -2.533028e+05, +3.124554e+03, +4.242102e+03, +8.798075e+02, -9.953208e-01, +5.955085e-07, -2.528571e-03, +2.741466e-09, -2.529037e-15, +1.000000e+08, +1.671380e+06, +1.679237e+06, +7.210659e+02, +4.188912e+03, +1.197544e+04 },
+    { +5.300000e+02, +1.149786e-03, +2.683072e+03, -3.947078e+05, +1.027320e+06, +1.142299e+06, -2.797292e+05, +3.097228e+03, +4.267325e+03, +8.697269e+02, -1.020895e+00, +6.240944e-07, -2.587588e-03, +2.979174e-09, -2.815507e-15, +1.000000e+08, +1.635802e+06, +1.602322e+06, +6.005155e+02, +4.175772e+03, +1.158259e+04 },
+    { +5.400000e+02, +1.163619e-03, +2.763087e+03, -4.233228e+05, +1.068744e+06, +1.185106e+06, -3.069608e+05, +3.070789e+03, +4.294391e+03, +8.593875e+02, -1.047099e+00, +6.551651e-07, -2.654412e-03, +3.238824e-09, -3.142542e-15, +1.000000e+08, +1.598221e+06, +1.526333e+06, +5.017451e+02, +4.155360e+03, +1.117452e+04 },
+    { +5.500000e+02, +1.178158e-03, +2.842147e+03, -4.528036e+05, +1.110377e+06, +1.228193e+06, -3.349878e+05, +3.045212e+03, +4.323402e+03, +8.487826e+02, -1.074008e+00, +6.889524e-07, -2.728612e-03, +3.522933e-09, -3.516549e-15, +1.000000e+08, +1.558900e+06, +1.451479e+06, +4.218300e+02, +4.127236e+03, +1.075348e+04 },
+    { +5.600000e+02, +1.193453e-03, +2.920324e+03, -4.831461e+05, +1.152236e+06, +1.271581e+06, -3.638008e+05, +3.020472e+03, +4.354469e+03, +8.379047e+02, -1.101694e+00, +7.257145e-07, -2.809728e-03, +3.834258e-09, -3.945042e-15, +1.000000e+08, +1.518082e+06, +1.377952e+06, +3.581692e+02, +4.091126e+03, +1.032177e+04 },
+    { +5.700000e+02, +1.209562e-03, +2.997687e+03, -5.143477e+05, +1.194334e+06, +1.315290e+06, -3.933915e+05, +2.996549e+03, +4.387716e+03, +8.267459e+02, -1.130224e+00, +7.657383e-07, -2.897247e-03, +4.175815e-09, -4.436838e-15, +1.000000e+08, +1.475992e+06, +1.305929e+06, +3.084474e+02, +4.046902e+03, +9.881718e+03 },
+    { +5.800000e+02, +1.226547e-03, +3.074302e+03, -5.464067e+05, +1.236688e+06, +1.359343e+06, -4.237521e+05, +2.973424e+03, +4.423277e+03, +8.152972e+02, -1.159658e+00, +8.093425e-07, -2.990565e-03, +4.550890e-09, -5.002283e-15, +1.000000e+08, +1.432840e+06, +1.235571e+06, +2.706002e+02, +3.994564e+03, +9.435638e+03 },
+    { +5.900000e+02, +1.244478e-03, +3.150235e+03, -5.793231e+05, +1.279316e+06, +1.403764e+06, -4.548753e+05, +2.951082e+03, +4.461297e+03, +8.035495e+02, -1.190052e+00, +8.568796e-07, -3.088943e-03, +4.963034e-09, -5.653511e-15, +1.000000e+08, +1.388820e+06, +1.167025e+06, +2.427809e+02, +3.934227e+03, +8.985843e+03 },
+    { +6.000000e+02, +1.263435e-03, +3.225554e+03, -6.130983e+05, +1.322234e+06, +1.448578e+06, -4.867547e+05, +2.929509e+03, +4.501934e+03, +7.914928e+02, -1.221451e+00, +9.087393e-07, -3.191428e-03, +5.416038e-09, -6.404729e-15, +1.000000e+08, +1.344116e+06, +1.100426e+06, +2.233298e+02, +3.866106e+03, +8.534592e+03 },
+    { +6.100000e+02, +1.283504e-03, +3.300321e+03, -6.477350e+05, +1.365461e+06, +1.493812e+06, -5.193845e+05, +2.908696e+03, +4.545356e+03, +7.791170e+02, -1.253890e+00, +9.653498e-07, -3.296747e-03, +5.913862e-09, -7.272509e-15, +1.000000e+08, +1.298897e+06, +1.035894e+06, +2.107464e+02, +3.790511e+03, +8.084072e+03 },
+    { +6.200000e+02, +1.304782e-03, +3.374603e+03, -6.832377e+05, +1.409016e+06, +1.539494e+06, -5.527595e+05, +2.888633e+03, +4.591737e+03, +7.664115e+02, -1.287389e+00, +1.027179e-06, -3.403149e-03, +6.460503e-09, -8.276086e-15, +1.000000e+08, +1.253325e+06, +9.735399e+05, +2.036630e+02, +3.707829e+03, +7.636357e+03 },
+    { +6.300000e+02, +1.327377e-03, +3.448463e+03, -7.196129e+05, +1.452919e+06, +1.585657e+06, -5.868752e+05, +2.869313e+03, +4.641252e+03, +7.533657e+02, -1.321948e+00, +1.094735e-06, -3.508198e-03, +7.059763e-09, -9.437589e-15, +1.000000e+08, +1.207551e+06, +9.134628e+05, +2.008217e+02, +3.618525e+03, +7.193391e+03 },
+    { +6.400000e+02, +1.351408e-03, +3.521966e+03, -7.568684e+05, +1.497190e+06, +1.632331e+06, -6.217276e+05, +2.850728e+03, +4.694067e+03, +7.399691e+02, -1.357538e+00, +1.168561e-06, -3.608482e-03, +7.714871e-09, -1.078216e-14, +1.000000e+08, +1.161717e+06, +8.557535e+05, +2.010546e+02, +3.523125e+03, +6.756965e+03 },
+    { +6.500000e+02, +1.377009e-03, +3.595174e+03, -7.950144e+05, +1.541849e+06, +1.679550e+06, -6.573135e+05, +2.832870e+03, +4.750326e+03, +7.262117e+02, -1.394087e+00, +1.249226e-06, -3.699269e-03, +8.427924e-09, -1.233782e-14, +1.000000e+08, +1.115960e+06, +8.004956e+05, +2.032682e+02, +3.422215e+03, +6.328711e+03 },
+    { +6.750000e+02, +1.448887e-03, +3.777311e+03, -8.943604e+05, +1.655325e+06, +1.800214e+06, -7.494716e+05, +2.791311e+03, +4.906489e+03, +6.901849e+02, -1.488644e+00, +1.484595e-06, -3.836936e-03, +1.045735e-08, -1.735308e-14, +1.000000e+08, +1.002728e+06, +6.735846e+05, +2.108745e+02, +3.150180e+03, +5.303382e+03 },
+    { +7.000000e+02, +1.534275e-03, +3.958889e+03, -9.996020e+05, +1.771620e+06, +1.925047e+06, -8.461745e+05, +2.753802e+03, +5.083219e+03, +6.517738e+02, -1.583710e+00, +1.774222e-06, -3.704563e-03, +1.273371e-08, -2.435035e-14, +1.000000e+08, +8.926219e+05, +5.636272e+05, +2.105194e+02, +2.859698e+03, +4.359944e+03 },
+    { +7.250000e+02, +1.636461e-03, +4.140541e+03, -1.111063e+06, +1.890829e+06, +2.054476e+06, -9.474169e+05, +2.719433e+03, +5.271632e+03, +6.110746e+02, -1.669511e+00, +2.120379e-06, -3.045995e-03, +1.488631e-08, -3.355891e-14, +1.000000e+08, +7.873642e+05, +4.716137e+05, +1.927484e+02, +2.566005e+03, +3.520199e+03 },
+    { +7.500000e+02, +1.758964e-03, +4.322330e+03, -1.229099e+06, +2.012648e+06, +2.188544e+06, -1.053203e+06, +2.686614e+03, +5.449168e+03, +5.685166e+02, -1.728809e+00, +2.510490e-06, -1.525122e-03, +1.604772e-08, -4.421767e-14, +1.000000e+08, +6.886344e+05, +3.983287e+05, +1.560986e+02, +2.285118e+03, +2.794606e+03 },
+    { +7.750000e+02, +1.904544e-03, +4.503268e+03, -1.353981e+06, +2.136052e+06, +2.326506e+06, -1.163527e+06, +2.653185e+03, +5.575329e+03, +5.250600e+02, -1.737219e+00, +2.903294e-06, +9.792518e-04, +1.492174e-08, -5.347225e-14, +1.000000e+08, +5.983611e+05, +3.444363e+05, +1.062828e+02, +2.025595e+03, +2.185019e+03 },
+    { +8.000000e+02, +2.073719e-03, +4.681108e+03, -1.485713e+06, +2.259174e+06, +2.466545e+06, -1.278341e+06, +2.616851e+03, +5.610832e+03, +4.822255e+02, -1.678210e+00, +3.236183e-06, +3.684214e-03, +1.139274e-08, -5.826125e-14, +1.000000e+08, +5.185768e+05, +3.090060e+05, +5.175571e+01, +1.797040e+03, +1.719018e+03 },
+    { +8.250000e+02, +2.264183e-03, +4.852989e+03, -1.623951e+06, +2.379765e+06, +2.606184e+06, -1.397532e+06, +2.576171e+03, +5.543171e+03, +4.416603e+02, -1.558257e+00, +3.461286e-06, +5.778892e-03, +6.458050e-09, -5.724597e-14, +1.000000e+08, +4.501958e+05, +2.889099e+05, +2.522993e+00, +1.612106e+03, +1.380487e+03 },
+    { +8.500000e+02, +2.471222e-03, +5.016262e+03, -1.768041e+06, +2.495782e+06, +2.742905e+06, -1.520918e+06, +2.531505e+03, +5.380336e+03, +4.046580e+02, -1.397077e+00, +3.556450e-06, +6.940669e-03, +1.227225e-09, -5.042125e-14, +1.000000e+08, +3.928291e+05, +2.811792e+05, -3.489633e+01, +1.468945e+03, +1.120891e+03 },
+    { +9.000000e+02, +2.910245e-03, +5.310449e+03, -2.070299e+06, +2.709105e+06, +3.000129e+06, -1.779274e+06, +2.438624e+03, +4.887888e+03, +3.436137e+02, -1.048638e+00, +3.422296e-06, +6.522620e-03, -5.529952e-09, -3.072349e-14, +1.000000e+08, +3.064137e+05, +2.922015e+05, -7.278860e+01, +1.275949e+03, +7.665103e+02 },
+    { +9.500000e+02, +3.348900e-03, +5.560848e+03, -2.386118e+06, +2.896688e+06, +3.231578e+06, -2.051228e+06, +2.356682e+03, +4.382336e+03, +2.986055e+02, -7.670056e-01, +3.094281e-06, +4.710819e-03, -6.972301e-09, -1.654452e-14, +1.000000e+08, +2.478784e+05, +3.231768e+05, -7.681780e+01, +1.156535e+03, +5.584378e+02 },
+    { +1.000000e+03, +3.767250e-03, +5.774875e+03, -2.711478e+06, +3.063398e+06, +3.440123e+06, -2.334753e+06, +2.295015e+03, +3.978760e+03, +2.654456e+02, -5.722645e-01, +2.760363e-06, +3.168105e-03, -6.226441e-09, -9.307052e-15, +1.000000e+08, +2.073149e+05, +3.622712e+05, -6.753645e+01, +1.070388e+03, +4.425001e+02 },
+    { +1.050000e+03, +4.161176e-03, +5.961455e+03, -3.044377e+06, +3.215151e+06, +3.631269e+06, -2.628259e+06, +2.253260e+03, +3.683269e+03, +2.403167e+02, -4.414121e-01, +2.477259e-06, +2.142903e-03, -5.101196e-09, -5.880684e-15, +1.000000e+08, +1.781857e+05, +4.036720e+05, -5.581542e+01, +1.001995e+03, +3.868243e+02 },
+    { +1.100000e+03, +4.532618e-03, +6.127638e+03, -3.383821e+06, +3.356581e+06, +3.809842e+06, -2.930559e+06, +2.227633e+03, +3.471460e+03, +2.206230e+02, -3.517201e-01, +2.247633e-06, +1.493958e-03, -4.119921e-09, -4.198011e-15, +1.000000e+08, +1.564847e+05, +4.449125e+05, -4.527011e+01, +9.455628e+02, +3.697153e+02 },
+    { +1.150000e+03, +4.884904e-03, +6.278413e+03, -3.729257e+06, +3.490918e+06, +3.979408e+06, -3.240767e+06, +2.214206e+03, +3.319502e+03, +2.047123e+02, -2.881627e-01, +2.061613e-06, +1.078092e-03, -3.355188e-09, -3.306607e-15, +1.000000e+08, +1.397754e+05, +4.850572e+05, -3.664344e+01, +8.981527e+02, +3.773648e+02 },
+    { +1.200000e+03, +5.221228e-03, +6.417247e+03, -4.080325e+06, +3.620371e+06, +4.142494e+06, -3.558202e+06, +2.209782e+03, +3.209828e+03, +1.915258e+02, -2.415778e-01, +1.909066e-06, +8.034562e-04, -2.773214e-09, -2.791617e-15, +1.000000e+08, +1.265424e+05, +5.238165e+05, -2.980274e+01, +8.578530e+02, +4.012299e+02 },
+    { +1.250000e+03, +5.544285e-03, +6.546580e+03, -4.436762e+06, +3.746463e+06, +4.300891e+06, -3.882333e+06, +2.211936e+03, +3.130295e+03, +1.803659e+02, -2.063766e-01, +1.782007e-06, +6.159734e-04, -2.328650e-09, -2.466945e-15, +1.000000e+08, +1.158113e+05, +5.611652e+05, -2.442078e+01, +8.232754e+02, +4.359448e+02 },
+    { +1.273000e+03, +5.689055e-03, +6.603385e+03, -4.602467e+06, +3.803643e+06, +4.372548e+06, -4.033561e+06, +2.214621e+03, +3.101430e+03, +1.757761e+02, -1.929912e-01, +1.730428e-06, +5.497074e-04, -2.159746e-09, -2.355286e-15, +1.000000e+08, +1.115281e+05, +5.778918e+05, -2.234519e+01, +8.089909e+02, +4.545516e+02 },
+    // P = 200 MPa
+    { +2.524620e+02, +9.191374e-04, -3.186753e+02, +4.205521e+03, -7.624788e+04, +1.075796e+05, +1.880330e+05, +3.334600e+03, +3.355034e+03, +1.087977e+03, -1.842675e-01, +3.543971e-07, -1.565362e-02, -1.145227e-09, -8.042841e-16, +2.000000e+08, +5.199466e+05, +2.821694e+06, +4.814366e+04, +1.244782e+04, +1.806921e+04 },
+    { +2.550000e+02, +9.195730e-04, -2.846702e+02, +4.884171e+03, -6.770674e+04, +1.162079e+05, +1.887988e+05, +3.411813e+03, +3.441706e+03, +1.087461e+03, -2.207429e-01, +3.514889e-07, -1.316390e-02, -1.145167e-09, -7.763480e-16, +2.000000e+08, +6.280224e+05, +2.845040e+06, +4.241524e+04, +1.321574e+04, +1.787811e+04 },
+    { +2.600000e+02, +9.206322e-04, -2.164858e+02, +5.925730e+03, -5.036058e+04, +1.337659e+05, +1.900522e+05, +3.525127e+03, +3.573885e+03, +1.086210e+03, -2.766085e-01, +3.458059e-07, -9.411922e-03, -1.123559e-09, -7.238989e-16, +2.000000e+08, +7.998952e+05, +2.891795e+06, +3.375464e+04, +1.423798e+04, +1.750575e+04 },
+    { +2.650000e+02, +9.218959e-04, -1.474712e+02, +6.583077e+03, -3.249680e+04, +1.518824e+05, +1.909623e+05, +3.600901e+03, +3.667335e+03, +1.084721e+03, -3.168231e-01, +3.402934e-07, -6.839615e-03, -1.077931e-09, -6.759969e-16, +2.000000e+08, +9.310292e+05, +2.938641e+06, +2.771946e+04, +1.474361e+04, +1.715474e+04 },
+    { +2.700000e+02, +9.233103e-04, -7.826891e+01, +6.864523e+03, -1.426808e+04, +1.703940e+05, +1.915266e+05, +3.651105e+03, +3.733539e+03, +1.083060e+03, -3.464029e-01, +3.350572e-07, -5.109090e-03, -1.013957e-09, -6.333533e-16, +2.000000e+08, +1.033862e+06, +2.984565e+06, +2.352627e+04, +1.486467e+04, +1.683795e+04 },
+    { +2.750000e+02, +9.248393e-04, -9.305770e+00, +6.777489e+03, +4.218402e+03, +1.891863e+05, +1.917453e+05, +3.683818e+03, +3.780761e+03, +1.081269e+03, -3.688893e-01, +3.301751e-07, -3.966065e-03, -9.371634e-10, -5.961429e-16, +2.000000e+08, +1.117253e+06, +3.028696e+06, +2.060816e+04, +1.470621e+04, +1.656217e+04 },
+    { +2.800000e+02, +9.264592e-04, +5.914004e+01, +6.328663e+03, +2.288787e+04, +2.081797e+05, +1.916205e+05, +3.704445e+03, +3.814805e+03, +1.079378e+03, -3.867311e-01, +3.256987e-07, -3.225317e-03, -8.524379e-10, -5.641908e-16, +2.000000e+08, +1.187389e+06, +3.070322e+06, +1.856046e+04, +1.435103e+04, +1.632969e+04 },
+    { +2.850000e+02, +9.281547e-04, +1.268912e+02, +5.524162e+03, +4.168816e+04, +2.273191e+05, +1.911551e+05, +3.716586e+03, +3.839687e+03, +1.077407e+03, -4.015914e-01, +3.216573e-07, -2.755261e-03, -7.637717e-10, -5.371243e-16, +2.000000e+08, +1.248507e+06, +3.108899e+06, +1.709790e+04, +1.386360e+04, +1.613967e+04 },
+    { +2.900000e+02, +9.299164e-04, +1.938380e+02, +4.369662e+03, +6.058268e+04, +2.465660e+05, +1.903529e+05, +3.722642e+03, +3.858158e+03, +1.075366e+03, -4.145805e-01, +3.180624e-07, -2.464226e-03, -6.742079e-10, -5.144798e-16, +2.000000e+08, +1.303456e+06, +3.144037e+06, +1.602178e+04, +1.329340e+04, +1.598936e+04 },
+    { +2.950000e+02, +9.317384e-04, +2.599152e+02, +2.870504e+03, +7.954549e+04, +2.658932e+05, +1.892182e+05, +3.724216e+03, +3.872095e+03, +1.073263e+03, -4.264262e-01, +3.149130e-07, -2.289360e-03, -5.859260e-10, -4.957727e-16, +2.000000e+08, +1.354108e+06, +3.175480e+06, +1.519539e+04, +1.267776e+04, +1.587489e+04 },
+    { +3.000000e+02, +9.336176e-04, +3.250874e+02, +1.031778e+03, +9.855799e+04, +2.852815e+05, +1.877553e+05, +3.722393e+03, +3.882782e+03, +1.071102e+03, -4.375961e-01, +3.121986e-07, -2.188153e-03, -5.003881e-10, -4.805379e-16, +2.000000e+08, +1.401659e+06, +3.203090e+06, +1.452597e+04, +1.204435e+04, +1.579192e+04 },
+    { +3.050000e+02, +9.355523e-04, +3.893384e+02, -1.141620e+03, +1.176066e+05, +3.047171e+05, +1.859688e+05, +3.717918e+03, +3.891102e+03, +1.068887e+03, -4.483826e-01, +3.099030e-07, -2.132221e-03, -4.184962e-10, -4.683502e-16, +2.000000e+08, +1.446848e+06, +3.226816e+06, +1.395163e+04, +1.141326e+04, +1.573596e+04 },
+    { +3.100000e+02, +9.375420e-04, +4.526651e+02, -3.644949e+03, +1.366812e+05, +3.241896e+05, +1.838635e+05, +3.711317e+03, +3.897670e+03, +1.066619e+03, -4.589622e-01, +3.080067e-07, -2.102862e-03, -3.407365e-10, -4.588334e-16, +2.000000e+08, +1.490105e+06, +3.246682e+06, +1.343194e+04, +1.079863e+04, +1.570271e+04 },
+    { +3.150000e+02, +9.395866e-04, +5.150725e+02, -6.473592e+03, +1.557742e+05, +3.436916e+05, +1.814437e+05, +3.702970e+03, +3.902920e+03, +1.064298e+03, -4.694351e-01, +3.064884e-07, -2.087947e-03, -2.672987e-10, -4.516612e-16, +2.000000e+08, +1.531657e+06, +3.262766e+06, +1.294127e+04, +1.021011e+04, +1.568811e+04 },
+    { +3.200000e+02, +9.416864e-04, +5.765716e+02, -9.623044e+03, +1.748799e+05, +3.632171e+05, +1.787142e+05, +3.693166e+03, +3.907166e+03, +1.061925e+03, -4.798527e-01, +3.053265e-07, -2.079768e-03, -1.981693e-10, -4.465543e-16, +2.000000e+08, +1.571605e+06, +3.275182e+06, +1.246410e+04, +9.653881e+03, +1.568847e+04 },
+    { +3.250000e+02, +9.438420e-04, +6.371768e+02, -1.308890e+04, +1.939936e+05, +3.827619e+05, +1.756795e+05, +3.682130e+03, +3.910640e+03, +1.059499e+03, -4.902360e-01, +3.044998e-07, -2.073571e-03, -1.332023e-10, -4.432761e-16, +2.000000e+08, +1.609971e+06, +3.284074e+06, +1.199163e+04, +9.133552e+03, +1.570049e+04 },
+    { +3.300000e+02, +9.460538e-04, +6.969049e+02, -1.686683e+04, +2.131118e+05, +4.023226e+05, +1.723439e+05, +3.670045e+03, +3.913516e+03, +1.057022e+03, -5.005870e-01, +3.039880e-07, -2.066547e-03, -7.216954e-11, -4.416278e-16, +2.000000e+08, +1.646733e+06, +3.289604e+06, +1.151957e+04, +8.650840e+03, +1.572126e+04 },
+    { +3.350000e+02, +9.483225e-04, +7.557745e+02, -2.095262e+04, +2.322318e+05, +4.218963e+05, +1.687119e+05, +3.657066e+03, +3.915933e+03, +1.054494e+03, -5.108974e-01, +3.037720e-07, -2.057163e-03, -1.479742e-11, -4.414428e-16, +2.000000e+08, +1.681845e+06, +3.291943e+06, +1.104645e+04, +8.206078e+03, +1.574821e+04 },
+    { +3.400000e+02, +9.506486e-04, +8.138050e+02, -2.534213e+04, +2.513516e+05, +4.414813e+05, +1.647876e+05, +3.643325e+03, +3.917996e+03, +1.051913e+03, -5.211535e-01, +3.038344e-07, -2.044706e-03, +3.920876e-11, -4.425822e-16, +2.000000e+08, +1.715255e+06, +3.291267e+06, +1.057261e+04, +7.798625e+03, +1.577914e+04 },
+    { +3.450000e+02, +9.530325e-04, +8.710164e+02, -3.003130e+04, +2.704694e+05, +4.610759e+05, +1.605752e+05, +3.628940e+03, +3.919796e+03, +1.049282e+03, -5.313390e-01, +3.041590e-07, -2.028977e-03, +9.014800e-11, -4.449308e-16, +2.000000e+08, +1.746912e+06, +3.287754e+06, +1.009936e+04, +7.427166e+03, +1.581214e+04 },
+    { +3.500000e+02, +9.554747e-04, +9.274291e+02, -3.501619e+04, +2.895840e+05, +4.806789e+05, +1.560788e+05, +3.614015e+03, +3.921402e+03, +1.046600e+03, -5.414380e-01, +3.047312e-07, -2.010090e-03, +1.383130e-10, -4.483935e-16, +2.000000e+08, +1.776772e+06, +3.281580e+06, +9.628586e+03, +7.089943e+03, +1.584559e+04 },
+    { +3.550000e+02, +9.579756e-04, +9.830633e+02, -4.029291e+04, +3.086946e+05, +5.002897e+05, +1.513022e+05, +3.598641e+03, +3.922877e+03, +1.043868e+03, -5.514352e-01, +3.055380e-07, -1.988338e-03, +1.839834e-10, -4.528920e-16, +2.000000e+08, +1.804801e+06, +3.272916e+06, +9.162329e+03, +6.784929e+03, +1.587812e+04 },
+    { +3.600000e+02, +9.605354e-04, +1.037939e+03, -4.585770e+04, +3.278005e+05, +5.199076e+05, +1.462494e+05, +3.582902e+03, +3.924268e+03, +1.041086e+03, -5.613172e-01, +3.065673e-07, -1.964107e-03, +2.274225e-10, -4.583625e-16, +2.000000e+08, +1.830975e+06, +3.261926e+06, +8.702637e+03, +6.509948e+03, +1.590858e+04 },
+    { +3.650000e+02, +9.631545e-04, +1.092077e+03, -5.170687e+04, +3.469014e+05, +5.395323e+05, +1.409240e+05, +3.566873e+03, +3.925619e+03, +1.038255e+03, -5.710728e-01, +3.078089e-07, -1.937820e-03, +2.688749e-10, -4.647534e-16, +2.000000e+08, +1.855284e+06, +3.248769e+06, +8.251415e+03, +6.262774e+03, +1.593600e+04 },
+    { +3.700000e+02, +9.658331e-04, +1.145497e+03, -5.783682e+04, +3.659971e+05, +5.591637e+05, +1.353298e+05, +3.550621e+03, +3.926964e+03, +1.035376e+03, -5.806927e-01, +3.092532e-07, -1.909899e-03, +3.085665e-10, -4.720237e-16, +2.000000e+08, +1.877726e+06, +3.233597e+06, +7.810362e+03, +6.041193e+03, +1.595958e+04 },
+    { +3.750000e+02, +9.685715e-04, +1.198218e+03, -6.424407e+04, +3.850877e+05, +5.788020e+05, +1.294702e+05, +3.534204e+03, +3.928334e+03, +1.032448e+03, -5.901697e-01, +3.108919e-07, -1.880749e-03, +3.467046e-10, -4.801411e-16, +2.000000e+08, +1.898311e+06, +3.216552e+06, +7.380931e+03, +5.843048e+03, +1.597866e+04 },
+    { +3.800000e+02, +9.713698e-04, +1.250259e+03, -7.092519e+04, +4.041732e+05, +5.984472e+05, +1.233488e+05, +3.517677e+03, +3.929752e+03, +1.029474e+03, -5.994988e-01, +3.127179e-07, -1.850742e-03, +3.834787e-10, -4.890813e-16, +2.000000e+08, +1.917059e+06, +3.197770e+06, +6.964327e+03, +5.666273e+03, +1.599273e+04 },
+    { +3.850000e+02, +9.742282e-04, +1.301639e+03, -7.787689e+04, +4.232540e+05, +6.180996e+05, +1.169687e+05, +3.501085e+03, +3.931239e+03, +1.026454e+03, -6.086763e-01, +3.147247e-07, -1.820215e-03, +4.190618e-10, -4.988266e-16, +2.000000e+08, +1.933996e+06, +3.177380e+06, +6.561506e+03, +5.508909e+03, +1.600136e+04 },
+    { +3.900000e+02, +9.771469e-04, +1.352375e+03, -8.509593e+04, +4.423303e+05, +6.377597e+05, +1.103334e+05, +3.484470e+03, +3.932811e+03, +1.023388e+03, -6.177005e-01, +3.169068e-07, -1.789463e-03, +4.536115e-10, -5.093651e-16, +2.000000e+08, +1.949155e+06, +3.155502e+06, +6.173193e+03, +5.369118e+03, +1.600422e+04 },
+    { +3.950000e+02, +9.801262e-04, +1.402486e+03, -9.257919e+04, +4.614027e+05, +6.574279e+05, +1.034460e+05, +3.467869e+03, +3.934483e+03, +1.020277e+03, -6.265710e-01, +3.192594e-07, -1.758742e-03, +4.872712e-10, -5.206904e-16, +2.000000e+08, +1.962577e+06, +3.132249e+06, +5.799907e+03, +5.245184e+03, +1.600105e+04 },
+    { +4.000000e+02, +9.831661e-04, +1.451988e+03, -1.003236e+05, +4.804715e+05, +6.771047e+05, +9.630960e+04, +3.451311e+03, +3.936263e+03, +1.017122e+03, -6.352884e-01, +3.217783e-07, -1.728273e-03, +5.201718e-10, -5.328003e-16, +2.000000e+08, +1.974305e+06, +3.107730e+06, +5.441973e+03, +5.135521e+03, +1.599169e+04 },
+    { +4.100000e+02, +9.894291e-04, +1.549232e+03, -1.165842e+05, +5.186007e+05, +7.164865e+05, +8.130159e+04, +3.418436e+03, +3.940185e+03, +1.010684e+03, -6.522718e-01, +3.273017e-07, -1.668799e-03, +5.841615e-10, -5.593859e-16, +2.000000e+08, +1.992876e+06, +3.055285e+06, +4.772684e+03, +4.953263e+03, +1.595389e+04 },
+    { +4.200000e+02, +9.959379e-04, +1.644233e+03, -1.338551e+05, +5.567225e+05, +7.559101e+05, +6.533245e+04, +3.386017e+03, +3.944621e+03, +1.004079e+03, -6.686739e-01, +3.334557e-07, -1.612161e-03, +6.464145e-10, -5.891812e-16, +2.000000e+08, +2.005285e+06, +2.998899e+06, +4.165072e+03, +4.812022e+03, +1.589038e+04 },
+    { +4.300000e+02, +1.002695e-03, +1.737109e+03, -1.521150e+05, +5.948417e+05, +7.953808e+05, +4.842402e+04, +3.354180e+03, +3.949594e+03, +9.973122e+02, -6.845269e-01, +3.402266e-07, -1.559076e-03, +7.076292e-10, -6.222954e-16, +2.000000e+08, +2.011974e+06, +2.939218e+06, +3.617262e+03, +4.703183e+03, +1.580127e+04 },
+    { +4.400000e+02, +1.009703e-03, +1.827970e+03, -1.713437e+05, +6.329631e+05, +8.349038e+05, +3.059699e+04, +3.323011e+03, +3.955110e+03, +9.903898e+02, -6.998686e-01, +3.476068e-07, -1.509942e-03, +7.683939e-10, -6.588809e-16, +2.000000e+08, +2.013391e+06, +2.876813e+06, +3.126294e+03, +4.619620e+03, +1.568708e+04 },
+    { +4.500000e+02, +1.016967e-03, +1.916919e+03, -1.915223e+05, +6.710914e+05, +8.744847e+05, +1.187099e+04, +3.292564e+03, +3.961164e+03, +9.833164e+02, -7.147394e-01, +3.555946e-07, -1.464919e-03, +8.292087e-10, -6.991287e-16, +2.000000e+08, +2.009984e+06, +2.812191e+06, +2.688542e+03, +4.555476e+03, +1.554861e+04 },
+    { +4.600000e+02, +1.024489e-03, +2.004053e+03, -2.126331e+05, +7.092311e+05, +9.141289e+05, -7.735346e+03, +3.262871e+03, +3.967745e+03, +9.760964e+02, -7.291806e-01, +3.641926e-07, -1.423986e-03, +8.905005e-10, -7.432656e-16, +2.000000e+08, +2.002184e+06, +2.745800e+06, +2.300027e+03, +4.505962e+03, +1.538688e+04 },
+    { +4.700000e+02, +1.032275e-03, +2.089459e+03, -2.346593e+05, +7.473863e+05, +9.538413e+05, -2.820431e+04, +3.233947e+03, +3.974839e+03, +9.687341e+02, -7.432323e-01, +3.734074e-07, -1.386991e-03, +9.526368e-10, -7.915516e-16, +2.000000e+08, +1.990406e+06, +2.678040e+06, +1.956645e+03, +4.467174e+03, +1.520304e+04 },
+    { +4.800000e+02, +1.040331e-03, +2.173221e+03, -2.575852e+05, +7.855612e+05, +9.936273e+05, -4.951904e+04, +3.205792e+03, +3.982428e+03, +9.612330e+02, -7.569327e-01, +3.832492e-07, -1.353687e-03, +1.015934e-09, -8.442790e-16, +2.000000e+08, +1.975041e+06, +2.609268e+06, +1.654320e+03, +4.435945e+03, +1.499831e+04 },
+    { +4.900000e+02, +1.048662e-03, +2.255418e+03, -2.813958e+05, +8.237592e+05, +1.033491e+06, -7.166352e+04, +3.178400e+03, +3.990495e+03, +9.535965e+02, -7.703173e-01, +3.937309e-07, -1.323757e-03, +1.080665e-09, -9.017712e-16, +2.000000e+08, +1.956456e+06, +2.539806e+06, +1.389117e+03, +4.409710e+03, +1.477399e+04 },
+    { +5.000000e+02, +1.057275e-03, +2.336122e+03, -3.060775e+05, +8.619837e+05, +1.073439e+06, -9.462244e+04, +3.151757e+03, +3.999022e+03, +9.458276e+02, -7.834179e-01, +4.048681e-07, -1.296836e-03, +1.147064e-09, -9.643818e-16, +2.000000e+08, +1.934995e+06, +2.469940e+06, +1.157306e+03, +4.386402e+03, +1.453143e+04 },
+    { +5.100000e+02, +1.066179e-03, +2.415401e+03, -3.316170e+05, +9.002377e+05, +1.113473e+06, -1.183812e+05, +3.125844e+03, +4.007993e+03, +9.379289e+02, -7.962627e-01, +4.166784e-07, -1.272527e-03, +1.215328e-09, -1.032494e-15, +2.000000e+08, +1.910977e+06, +2.399932e+06, +9.553990e+02, +4.364360e+03, +1.427200e+04 },
+    { +5.200000e+02, +1.075381e-03, +2.493319e+03, -3.580021e+05, +9.385238e+05, +1.153600e+06, -1.429259e+05, +3.100639e+03, +4.017389e+03, +9.299031e+02, -8.088757e-01, +4.291814e-07, -1.250412e-03, +1.285624e-09, -1.106521e-15, +2.000000e+08, +1.884694e+06, +2.330017e+06, +7.801753e+02, +4.342256e+03, +1.399706e+04 },
+    { +5.300000e+02, +1.084890e-03, +2.569936e+03, -3.852213e+05, +9.768445e+05, +1.193823e+06, -1.682433e+05, +3.076123e+03, +4.027195e+03, +9.217521e+02, -8.212768e-01, +4.423981e-07, -1.230059e-03, +1.358084e-09, -1.186902e-15, +2.000000e+08, +1.856420e+06, +2.260408e+06, +6.286808e+02, +4.319039e+03, +1.370803e+04 },
+    { +5.400000e+02, +1.094717e-03, +2.645307e+03, -4.132639e+05, +1.015202e+06, +1.234145e+06, -1.943205e+05, +3.052270e+03, +4.037393e+03, +9.134782e+02, -8.334813e-01, +4.563506e-07, -1.211029e-03, +1.432805e-09, -1.274105e-15, +2.000000e+08, +1.826406e+06, +2.191298e+06, +4.982258e+02, +4.293883e+03, +1.340631e+04 },
+    { +5.500000e+02, +1.104871e-03, +2.719486e+03, -4.421196e+05, +1.053598e+06, +1.274572e+06, -2.211454e+05, +3.029060e+03, +4.047969e+03, +9.050831e+02, -8.455003e-01, +4.710620e-07, -1.192882e-03, +1.509855e-09, -1.368620e-15, +2.000000e+08, +1.794881e+06, +2.122863e+06, +3.863736e+02, +4.266149e+03, +1.309329e+04 },
+    { +5.600000e+02, +1.115363e-03, +2.792522e+03, -4.717791e+05, +1.092033e+06, +1.315106e+06, -2.487064e+05, +3.006471e+03, +4.058905e+03, +8.965688e+02, -8.573405e-01, +4.865556e-07, -1.175181e-03, +1.589265e-09, -1.470964e-15, +2.000000e+08, +1.762061e+06, +2.055264e+06, +2.909262e+02, +4.235356e+03, +1.277040e+04 },
+    { +5.700000e+02, +1.126206e-03, +2.864462e+03, -5.022334e+05, +1.130510e+06, +1.355751e+06, -2.769922e+05, +2.984480e+03, +4.070184e+03, +8.879369e+02, -8.690040e-01, +5.028551e-07, -1.157491e-03, +1.671029e-09, -1.581669e-15, +2.000000e+08, +1.728140e+06, +1.988644e+06, +2.099073e+02, +4.201153e+03, +1.243905e+04 },
+    { +5.800000e+02, +1.137411e-03, +2.935349e+03, -5.334744e+05, +1.169028e+06, +1.396511e+06, -3.059921e+05, +2.963070e+03, +4.081789e+03, +8.791893e+02, -8.804889e-01, +5.199839e-07, -1.139390e-03, +1.755102e-09, -1.701287e-15, +2.000000e+08, +1.693300e+06, +1.923137e+06, +1.415449e+02, +4.163302e+03, +1.210063e+04 },
+    { +5.900000e+02, +1.148992e-03, +3.005226e+03, -5.654943e+05, +1.207589e+06, +1.437388e+06, -3.356958e+05, +2.942221e+03, +4.093702e+03, +8.703277e+02, -8.917890e-01, +5.379646e-07, -1.120462e-03, +1.841401e-09, -1.830377e-15, +2.000000e+08, +1.657710e+06, +1.858858e+06, +8.425370e+01, +4.121660e+03, +1.175654e+04 },
+    { +6.000000e+02, +1.160963e-03, +3.074132e+03, -5.982859e+05, +1.246193e+06, +1.478386e+06, -3.660934e+05, +2.921916e+03, +4.105904e+03, +8.613542e+02, -9.028941e-01, +5.568189e-07, -1.100305e-03, +1.929794e-09, -1.969507e-15, +2.000000e+08, +1.621522e+06, +1.795916e+06, +3.661793e+01, +4.076170e+03, +1.140816e+04 },
+    { +6.100000e+02, +1.173336e-03, +3.142102e+03, -6.318426e+05, +1.284839e+06, +1.519507e+06, -3.971753e+05, +2.902139e+03, +4.118375e+03, +8.522706e+02, -9.137897e-01, +5.765669e-07, -1.078526e-03, +2.020105e-09, -2.119243e-15, +2.000000e+08, +1.584881e+06, +1.734404e+06, -2.624717e+00, +4.026845e+03, +1.105685e+04 },
+    { +6.200000e+02, +1.186128e-03, +3.209171e+03, -6.661581e+05, +1.323528e+06, +1.560754e+06, -4.289324e+05, +2.882875e+03, +4.131092e+03, +8.430791e+02, -9.244579e-01, +5.972266e-07, -1.054745e-03, +2.112106e-09, -2.280138e-15, +2.000000e+08, +1.547918e+06, +1.674406e+06, -3.459836e+01, +3.973765e+03, +1.070394e+04 },
+    { +6.300000e+02, +1.199354e-03, +3.275373e+03, -7.012267e+05, +1.362259e+06, +1.602129e+06, -4.613559e+05, +2.864110e+03, +4.144034e+03, +8.337822e+02, -9.348767e-01, +6.188137e-07, -1.028591e-03, +2.205510e-09, -2.452728e-15, +2.000000e+08, +1.510756e+06, +1.615995e+06, -6.030291e+01, +3.917070e+03, +1.035070e+04 },
+    { +6.400000e+02, +1.213029e-03, +3.340738e+03, -7.370429e+05, +1.401029e+06, +1.643635e+06, -4.944371e+05, +2.845832e+03, +4.157175e+03, +8.243825e+02, -9.450206e-01, +6.413404e-07, -9.996984e-04, +2.299971e-09, -2.637515e-15, +2.000000e+08, +1.473509e+06, +1.559234e+06, -8.062682e+01, +3.856950e+03, +9.998372e+03 },
+    { +6.500000e+02, +1.227170e-03, +3.405294e+03, -7.736020e+05, +1.439839e+06, +1.685273e+06, -5.281679e+05, +2.828028e+03, +4.170489e+03, +8.148828e+02, -9.548604e-01, +6.648152e-07, -9.677051e-04, +2.395072e-09, -2.834953e-15, +2.000000e+08, +1.436279e+06, +1.504177e+06, -9.635880e+01, +3.793643e+03, +9.648125e+03 },
+    { +6.750000e+02, +1.264673e-03, +3.563322e+03, -8.682200e+05, +1.537023e+06, +1.789957e+06, -6.152854e+05, +2.785522e+03, +4.204326e+03, +7.907183e+02, -9.779045e-01, +7.276636e-07, -8.717205e-04, +2.632171e-09, -3.386213e-15, +2.000000e+08, +1.343896e+06, +1.374261e+06, -1.199942e+02, +3.623359e+03, +8.788652e+03 },
+    { +7.000000e+02, +1.305465e-03, +3.716841e+03, -9.673896e+05, +1.634399e+06, +1.895492e+06, -7.062965e+05, +2.745752e+03, +4.238462e+03, +7.660104e+02, -9.982146e-01, +7.963449e-07, -7.478920e-04, +2.859648e-09, -4.021825e-15, +2.000000e+08, +1.253495e+06, +1.255737e+06, -1.279907e+02, +3.440256e+03, +7.963787e+03 },
+    { +7.250000e+02, +1.349825e-03, +3.866163e+03, -1.071058e+06, +1.731911e+06, +2.001876e+06, -8.010925e+05, +2.708568e+03, +4.272046e+03, +7.408368e+02, -1.015009e+00, +8.704444e-07, -5.892110e-04, +3.062749e-09, -4.738530e-15, +2.000000e+08, +1.166081e+06, +1.148839e+06, -1.268570e+02, +3.250427e+03, +7.184897e+03 },
+    { +7.500000e+02, +1.398020e-03, +4.011535e+03, -1.179176e+06, +1.829475e+06, +2.109079e+06, -8.995718e+05, +2.673822e+03, +4.303802e+03, +7.152972e+02, -1.027321e+00, +9.491142e-07, -3.881089e-04, +3.221515e-09, -5.523046e-15, +2.000000e+08, +1.082400e+06, +1.053614e+06, -1.212515e+02, +3.060143e+03, +6.459862e+03 },
+    { +7.750000e+02, +1.450289e-03, +4.153127e+03, -1.291696e+06, +1.926978e+06, +2.217036e+06, -1.001638e+06, +2.641353e+03, +4.331882e+03, +6.895176e+02, -1.034008e+00, +1.030947e-06, -1.384143e-04, +3.311430e-09, -6.348444e-15, +2.000000e+08, +1.002969e+06, +9.699822e+05, -1.143708e+02, +2.875157e+03, +5.793734e+03 },
+    { +8.000000e+02, +1.506809e-03, +4.291025e+03, -1.408559e+06, +2.024261e+06, +2.325623e+06, -1.107197e+06, +2.610991e+03, +4.353830e+03, +6.636541e+02, -1.033827e+00, +1.113897e-06, +1.607197e-04, +3.306885e-09, -7.172644e-15, +2.000000e+08, +9.281174e+05, +8.977491e+05, -1.082191e+02, +2.700082e+03, +5.189723e+03 },
+    { +8.250000e+02, +1.567661e-03, +4.425225e+03, -1.529690e+06, +2.121120e+06, +2.434652e+06, -1.216158e+06, +2.582556e+03, +4.366791e+03, +6.378931e+02, -1.025632e+00, +1.195334e-06, +5.002212e-04, +3.187935e-09, -7.941717e-15, +2.000000e+08, +8.580298e+05, +8.365864e+05, -1.038154e+02, +2.537961e+03, +4.649935e+03 },
+    { +8.500000e+02, +1.632797e-03, +4.555636e+03, -1.654987e+06, +2.217304e+06, +2.543864e+06, -1.328427e+06, +2.555877e+03, +4.367984e+03, +6.124458e+02, -1.008653e+00, +1.272281e-06, +8.590053e-04, +2.948095e-09, -8.598727e-15, +2.000000e+08, +7.927909e+05, +7.859898e+05, -1.013936e+02, +2.390127e+03, +4.175273e+03 },
+    { +9.000000e+02, +1.775013e-03, +4.804451e+03, -1.917501e+06, +2.406505e+06, +2.761508e+06, -1.562498e+06, +2.507228e+03, +4.328016e+03, +5.633760e+02, -9.486640e-01, +1.401559e-06, +1.512020e-03, +2.169669e-09, -9.402325e-15, +2.000000e+08, +6.768636e+05, +7.134914e+05, -1.009865e+02, +2.135255e+03, +3.415085e+03 },
+    { +9.500000e+02, +1.930391e-03, +5.036138e+03, -2.194664e+06, +2.589666e+06, +2.975744e+06, -1.808586e+06, +2.464384e+03, +4.233493e+03, +5.180297e+02, -8.619205e-01, +1.486600e-06, +1.903814e-03, +1.232558e-09, -9.461949e-15, +2.000000e+08, +5.797931e+05, +6.726759e+05, -1.024770e+02, +1.924640e+03, +2.880037e+03 },
+    { +1.000000e+03, +2.094778e-03, +5.250065e+03, -2.484771e+06, +2.765294e+06, +3.184250e+06, -2.065815e+06, +2.427404e+03, +4.102612e+03, +4.773775e+02, -7.634617e-01, +1.526799e-06, +1.990228e-03, +4.072421e-10, -8.966546e-15, +2.000000e+08, +5.000406e+05, +6.549649e+05, -1.018488e+02, +1.748688e+03, +2.519296e+03 },
+    { +1.050000e+03, +2.264192e-03, +5.446743e+03, -2.786143e+06, +2.932937e+06, +3.385776e+06, -2.333305e+06, +2.396745e+03, +3.957704e+03, +4.416587e+02, -6.662825e-01, +1.530880e-06, +1.873145e-03, -2.078462e-10, -8.146030e-15, +2.000000e+08, +4.352285e+05, +6.532193e+05, -9.744151e+01, +1.601486e+03, +2.270507e+03 },
+    { +1.100000e+03, +2.435440e-03, +5.627537e+03, -3.097312e+06, +3.092978e+06, +3.580066e+06, -2.610224e+06, +2.372749e+03, +3.815348e+03, +4.106034e+02, -5.777082e-01, +1.509451e-06, +1.660985e-03, -6.176596e-10, -7.185086e-15, +2.000000e+08, +3.827273e+05, +6.624924e+05, -8.991490e+01, +1.478021e+03, +2.089174e+03 },
+    { +1.150000e+03, +2.606233e-03, +5.794208e+03, -3.417070e+06, +3.246270e+06, +3.767516e+06, -2.895823e+06, +2.355332e+03, +3.685158e+03, +3.836956e+02, -5.005846e-01, +1.471920e-06, +1.423681e-03, -8.593484e-10, -6.227372e-15, +2.000000e+08, +3.400896e+05, +6.793848e+05, -8.078339e+01, +1.374174e+03, +1.952776e+03 },
+    { +1.200000e+03, +2.775082e-03, +5.948582e+03, -3.744457e+06, +3.393842e+06, +3.948858e+06, -3.189440e+06, +2.343993e+03, +3.571388e+03, +3.603498e+02, -4.351294e-01, +1.425559e-06, +1.198313e-03, -9.783246e-10, -5.360046e-15, +2.000000e+08, +3.052342e+05, +7.014793e+05, -7.133501e+01, +1.286473e+03, +1.850176e+03 },
+    { +1.250000e+03, +2.941128e-03, +6.092359e+03, -4.078730e+06, +3.536718e+06, +4.124944e+06, -3.490505e+06, +2.337979e+03, +3.474870e+03, +3.400056e+02, -3.802868e-01, +1.375440e-06, +1.000553e-03, -1.015819e-09, -4.618618e-15, +2.000000e+08, +2.764838e+05, +7.270402e+05, -6.236271e+01, +1.211941e+03, +1.774955e+03 },
+    { +1.273000e+03, +3.016442e-03, +6.155357e+03, -4.234645e+06, +3.601124e+06, +4.204412e+06, -3.631357e+06, +2.336769e+03, +3.436024e+03, +3.315164e+02, -3.582115e-01, +1.352070e-06, +9.201521e-04, -1.014837e-09, -4.321167e-15, +2.000000e+08, +2.649357e+05, +7.396068e+05, -5.851214e+01, +1.181378e+03, +1.748251e+03 },
+    // P = 400 MPa
+    { +2.598200e+02, +8.737718e-04, -2.740952e+02, +1.960414e+04, -5.161128e+04, +2.978974e+05, +3.691128e+05, +3.056663e+03, +3.176793e+03, +1.144464e+03, -3.886201e-01, +2.493841e-07, -8.806517e-03, -2.966392e-10, -3.166819e-16, +4.000000e+08, +1.558319e+06, +4.009878e+06, +4.210393e+04, +1.270461e+04, +2.041817e+04 },
+    { +2.600000e+02, +8.738253e-04, -2.718922e+02, +1.963187e+04, -5.106009e+04, +2.984700e+05, +3.691620e+05, +3.064106e+03, +3.185335e+03, +1.144394e+03, -3.901950e-01, +2.493309e-07, -8.692371e-03, -2.953451e-10, -3.164978e-16, +4.000000e+08, +1.564969e+06, +4.010735e+06, +4.167926e+04, +1.271846e+04, +2.041938e+04 },
+    { +2.650000e+02, +8.753915e-04, -2.092117e+02, +2.020923e+04, -3.523188e+04, +3.149247e+05, +3.703658e+05, +3.236117e+03, +3.385154e+03, +1.142346e+03, -4.265663e-01, +2.479302e-07, -6.003100e-03, -2.671520e-10, -3.107162e-16, +4.000000e+08, +1.720509e+06, +4.033393e+06, +3.163044e+04, +1.304295e+04, +2.038804e+04 },
+    { +2.700000e+02, +8.770800e-04, -1.445428e+02, +2.041881e+04, -1.860773e+04, +3.322243e+05, +3.712508e+05, +3.354742e+03, +3.526409e+03, +1.140147e+03, -4.514987e-01, +2.466430e-07, -4.079608e-03, -2.488630e-10, -3.040628e-16, +4.000000e+08, +1.830576e+06, +4.054443e+06, +2.436579e+04, +1.324078e+04, +2.026549e+04 },
+    { +2.750000e+02, +8.788547e-04, -7.887644e+01, +2.026773e+04, -1.423288e+03, +3.501186e+05, +3.718096e+05, +3.435586e+03, +3.625388e+03, +1.137845e+03, -4.683116e-01, +2.454344e-07, -2.727171e-03, -2.349721e-10, -2.970402e-16, +4.000000e+08, +1.908093e+06, +4.074409e+06, +1.917147e+04, +1.330974e+04, +2.009134e+04 },
+    { +2.800000e+02, +8.806902e-04, -1.289730e+01, +1.976300e+04, +1.615176e+04, +3.684278e+05, +3.720391e+05, +3.489691e+03, +3.694065e+03, +1.135473e+03, -4.794737e-01, +2.442917e-07, -1.797828e-03, -2.220780e-10, -2.900217e-16, +4.000000e+08, +1.962710e+06, +4.093467e+06, +1.550117e+04, +1.325951e+04, +1.989319e+04 },
+    { +2.850000e+02, +8.825688e-04, +5.292819e+01, +1.891133e+04, +3.399586e+04, +3.870234e+05, +3.719389e+05, +3.524846e+03, +3.741149e+03, +1.133056e+03, -4.868051e-01, +2.432151e-07, -1.178507e-03, -2.083019e-10, -2.832755e-16, +4.000000e+08, +2.001541e+06, +4.111586e+06, +1.294001e+04, +1.310638e+04, +1.968962e+04 },
+    { +2.900000e+02, +8.844789e-04, +1.182873e+02, +1.771901e+04, +5.202234e+04, +4.058139e+05, +3.715106e+05, +3.546538e+03, +3.772928e+03, +1.130609e+03, -4.916308e-01, +2.422116e-07, -7.831154e-04, -1.927883e-10, -2.769837e-16, +4.000000e+08, +2.029757e+06, +4.128622e+06, +1.117573e+04, +1.286933e+04, +1.949259e+04 },
+    { +2.950000e+02, +8.864129e-04, +1.829750e+02, +1.619193e+04, +7.016957e+04, +4.247347e+05, +3.707571e+05, +3.558628e+03, +3.793910e+03, +1.128142e+03, -4.949003e-01, +2.412905e-07, -5.466816e-04, -1.753189e-10, -2.712613e-16, +4.000000e+08, +2.051056e+06, +4.144382e+06, +9.975565e+03, +1.256745e+04, +1.930933e+04 },
+    { +3.000000e+02, +8.883664e-04, +2.468609e+02, +1.433561e+04, +8.839387e+04, +4.437404e+05, +3.696822e+05, +3.563834e+03, +3.807314e+03, +1.125662e+03, -4.972811e-01, +2.404614e-07, -4.207490e-04, -1.560380e-10, -2.661723e-16, +4.000000e+08, +2.068028e+06, +4.158671e+06, +9.167712e+03, +1.221842e+04, +1.914373e+04 },
+    { +3.050000e+02, +8.903369e-04, +3.098660e+02, +1.215519e+04, +1.066643e+05, +4.627991e+05, +3.682900e+05, +3.564074e+03, +3.815428e+03, +1.123170e+03, -4.992319e-01, +2.397326e-07, -3.696457e-04, -1.352676e-10, -2.617438e-16, +4.000000e+08, +2.082453e+06, +4.171314e+06, +8.626707e+03, +1.183776e+04, +1.899743e+04 },
+    { +3.100000e+02, +8.923237e-04, +3.719470e+02, +9.655565e+03, +1.249591e+05, +4.818886e+05, +3.665850e+05, +3.560706e+03, +3.819876e+03, +1.120670e+03, -5.010587e-01, +2.391106e-07, -3.674757e-04, -1.133927e-10, -2.579767e-16, +4.000000e+08, +2.095510e+06, +4.182165e+06, +8.261968e+03, +1.143853e+04, +1.887052e+04 },
+    { +3.150000e+02, +8.943267e-04, +4.330845e+02, +6.841377e+03, +1.432630e+05, +5.009937e+05, +3.645721e+05, +3.554696e+03, +3.821809e+03, +1.118160e+03, -5.029571e-01, +2.385999e-07, -3.957177e-04, -9.079385e-11, -2.548550e-16, +4.000000e+08, +2.107952e+06, +4.191117e+06, +8.008946e+03, +1.103139e+04, +1.876214e+04 },
+    { +3.200000e+02, +8.963468e-04, +4.932753e+02, +3.717073e+03, +1.615652e+05, +5.201039e+05, +3.622558e+05, +3.546736e+03, +3.822041e+03, +1.115640e+03, -5.050446e-01, +2.382033e-07, -4.413436e-04, -6.781266e-11, -2.523520e-16, +4.000000e+08, +2.120225e+06, +4.198095e+06, +7.822359e+03, +1.062473e+04, +1.867083e+04 },
+    { +3.250000e+02, +8.983848e-04, +5.525272e+02, +2.869414e+02, +1.798583e+05, +5.392122e+05, +3.596409e+05, +3.537326e+03, +3.821149e+03, +1.113109e+03, -5.073843e-01, +2.379219e-07, -4.953658e-04, -4.473675e-11, -2.504352e-16, +4.000000e+08, +2.132566e+06, +4.203059e+06, +7.671060e+03, +1.022503e+04, +1.859482e+04 },
+    { +3.300000e+02, +9.004423e-04, +6.108550e+02, -3.444866e+03, +1.981373e+05, +5.583142e+05, +3.567320e+05, +3.526832e+03, +3.819542e+03, +1.110565e+03, -5.100021e-01, +2.377557e-07, -5.517346e-04, -2.179702e-11, -2.490694e-16, +4.000000e+08, +2.145068e+06, +4.205998e+06, +7.534177e+03, +9.837071e+03, +1.853223e+04 },
+    { +3.350000e+02, +9.025204e-04, +6.682779e+02, -7.474312e+03, +2.163988e+05, +5.774069e+05, +3.535338e+05, +3.515522e+03, +3.817508e+03, +1.108008e+03, -5.128989e-01, +2.377034e-07, -6.065102e-04, +8.288529e-13, -2.482189e-16, +4.000000e+08, +2.157726e+06, +4.206923e+06, +7.398239e+03, +9.464283e+03, +1.848113e+04 },
+    { +3.400000e+02, +9.046205e-04, +7.248181e+02, -1.179746e+04, +2.346407e+05, +5.964889e+05, +3.500507e+05, +3.503598e+03, +3.815249e+03, +1.105436e+03, -5.160604e-01, +2.377632e-07, -6.572508e-04, +2.300996e-11, -2.478494e-16, +4.000000e+08, +2.170480e+06, +4.205865e+06, +7.255032e+03, +9.108966e+03, +1.843969e+04 },
+    { +3.450000e+02, +9.067439e-04, +7.804992e+02, -1.641047e+04, +2.528617e+05, +6.155593e+05, +3.462871e+05, +3.491215e+03, +3.812908e+03, +1.102847e+03, -5.194624e-01, +2.379326e-07, -7.025616e-04, +4.465465e-11, -2.479282e-16, +4.000000e+08, +2.183233e+06, +4.202870e+06, +7.100034e+03, +8.772538e+03, +1.840619e+04 },
+    { +3.500000e+02, +9.088918e-04, +8.353454e+02, -2.130959e+04, +2.710613e+05, +6.346180e+05, +3.422471e+05, +3.478490e+03, +3.810586e+03, +1.100241e+03, -5.230758e-01, +2.382088e-07, -7.417688e-04, +6.570323e-11, -2.484253e-16, +4.000000e+08, +2.195871e+06, +4.197998e+06, +6.931259e+03, +8.455724e+03, +1.837903e+04 },
+    { +3.550000e+02, +9.110653e-04, +8.893812e+02, -2.649113e+04, +2.892392e+05, +6.536653e+05, +3.379350e+05, +3.465515e+03, +3.808349e+03, +1.097616e+03, -5.268695e-01, +2.385886e-07, -7.746836e-04, +8.612130e-11, -2.493133e-16, +4.000000e+08, +2.208276e+06, +4.191315e+06, +6.748421e+03, +8.158719e+03, +1.835677e+04 },
+    { +3.600000e+02, +9.132653e-04, +9.426308e+02, -3.195151e+04, +3.073956e+05, +6.727017e+05, +3.333546e+05, +3.452365e+03, +3.806245e+03, +1.094972e+03, -5.308123e-01, +2.390689e-07, -8.014342e-04, +1.058941e-10, -2.505673e-16, +4.000000e+08, +2.220332e+06, +4.182894e+06, +6.552333e+03, +7.881317e+03, +1.833813e+04 },
+    { +3.650000e+02, +9.154928e-04, +9.951180e+02, -3.768718e+04, +3.255309e+05, +6.917280e+05, +3.285099e+05, +3.439098e+03, +3.804302e+03, +1.092308e+03, -5.348741e-01, +2.396465e-07, -8.223471e-04, +1.250216e-10, -2.521652e-16, +4.000000e+08, +2.231930e+06, +4.172813e+06, +6.344479e+03, +7.623022e+03, +1.832196e+04 },
+    { +3.700000e+02, +9.177485e-04, +1.046866e+03, -4.369472e+04, +3.436456e+05, +7.107450e+05, +3.234047e+05, +3.425763e+03, +3.802539e+03, +1.089623e+03, -5.390268e-01, +2.403181e-07, -8.378635e-04, +1.435147e-10, -2.540874e-16, +4.000000e+08, +2.242972e+06, +4.161152e+06, +6.126710e+03, +7.383130e+03, +1.830728e+04 },
+    { +3.750000e+02, +9.200331e-04, +1.097897e+03, -4.997074e+04, +3.617405e+05, +7.297537e+05, +3.180425e+05, +3.412397e+03, +3.800965e+03, +1.086917e+03, -5.432446e-01, +2.410806e-07, -8.484828e-04, +1.613923e-10, -2.563165e-16, +4.000000e+08, +2.253373e+06, +4.147990e+06, +5.901033e+03, +7.160796e+03, +1.829320e+04 },
+    { +3.800000e+02, +9.223470e-04, +1.148232e+03, -5.651194e+04, +3.798162e+05, +7.487550e+05, +3.124269e+05, +3.399035e+03, +3.799584e+03, +1.084191e+03, -5.475044e-01, +2.419310e-07, -8.547234e-04, +1.786785e-10, -2.588372e-16, +4.000000e+08, +2.263060e+06, +4.133410e+06, +5.669476e+03, +6.955087e+03, +1.827898e+04 },
+    { +3.850000e+02, +9.246910e-04, +1.197892e+03, -6.331509e+04, +3.978735e+05, +7.677499e+05, +3.065613e+05, +3.385702e+03, +3.798395e+03, +1.081442e+03, -5.517854e-01, +2.428664e-07, -8.570975e-04, +1.954011e-10, -2.616363e-16, +4.000000e+08, +2.271971e+06, +4.117489e+06, +5.433990e+03, +6.765024e+03, +1.826398e+04 },
+    { +3.900000e+02, +9.270652e-04, +1.246898e+03, -7.037705e+04, +4.159132e+05, +7.867393e+05, +3.004490e+05, +3.372421e+03, +3.797393e+03, +1.078673e+03, -5.560697e-01, +2.438841e-07, -8.560948e-04, +2.115899e-10, -2.647022e-16, +4.000000e+08, +2.280057e+06, +4.100308e+06, +5.196392e+03, +6.589605e+03, +1.824765e+04 },
+    { +3.950000e+02, +9.294702e-04, +1.295268e+03, -7.769471e+04, +4.339360e+05, +8.057241e+05, +2.940934e+05, +3.359210e+03, +3.796571e+03, +1.075882e+03, -5.603415e-01, +2.449815e-07, -8.521730e-04, +2.272755e-10, -2.680249e-16, +4.000000e+08, +2.287281e+06, +4.081941e+06, +4.958336e+03, +6.427838e+03, +1.822952e+04 },
+    { +4.000000e+02, +9.319062e-04, +1.343020e+03, -8.526508e+04, +4.519428e+05, +8.247053e+05, +2.874974e+05, +3.346085e+03, +3.795923e+03, +1.073069e+03, -5.645873e-01, +2.461561e-07, -8.457525e-04, +2.424891e-10, -2.715959e-16, +4.000000e+08, +2.293615e+06, +4.062463e+06, +4.721293e+03, +6.278749e+03, +1.820922e+04 },
+    { +4.100000e+02, +9.368721e-04, +1.436740e+03, -1.011522e+05, +4.879110e+05, +8.626599e+05, +2.735967e+05, +3.320139e+03, +3.795106e+03, +1.067382e+03, -5.729565e-01, +2.487280e-07, -8.269020e-04, +2.716211e-10, -2.794541e-16, +4.000000e+08, +2.303546e+06, +4.020456e+06, +4.255220e+03, +6.014877e+03, +1.816085e+04 },
+    { +4.200000e+02, +9.419646e-04, +1.528188e+03, -1.180157e+05, +5.238234e+05, +9.006093e+05, +2.587702e+05, +3.294659e+03, +3.794862e+03, +1.061611e+03, -5.811056e-01, +2.515834e-07, -8.021327e-04, +2.992185e-10, -2.882309e-16, +4.000000e+08, +2.309793e+06, +3.974825e+06, +3.806374e+03, +5.790976e+03, +1.810066e+04 },
+    { +4.300000e+02, +9.471847e-04, +1.617485e+03, -1.358338e+05, +5.596849e+05, +9.385588e+05, +2.430401e+05, +3.269693e+03, +3.795111e+03, +1.055760e+03, -5.889862e-01, +2.547080e-07, -7.734667e-04, +3.254934e-10, -2.978948e-16, +4.000000e+08, +2.312398e+06, +3.926064e+06, +3.380436e+03, +5.600790e+03, +1.802749e+04 },
+    { +4.400000e+02, +9.525331e-04, +1.704740e+03, -1.545860e+05, +5.954997e+05, +9.765129e+05, +2.264273e+05, +3.245269e+03, +3.795774e+03, +1.049832e+03, -5.965672e-01, +2.580895e-07, -7.424410e-04, +3.506344e-10, -3.084255e-16, +4.000000e+08, +2.311474e+06, +3.874625e+06, +2.981007e+03, +5.438853e+03, +1.794069e+04 },
+    { +4.500000e+02, +9.580104e-04, +1.790053e+03, -1.742524e+05, +6.312712e+05, +1.014475e+06, +2.089517e+05, +3.221402e+03, +3.796777e+03, +1.043830e+03, -6.038310e-01, +2.617175e-07, -7.101955e-04, +3.748058e-10, -3.198118e-16, +4.000000e+08, +2.307186e+06, +3.820914e+06, +2.610047e+03, +5.300448e+03, +1.784006e+04 },
+    { +4.600000e+02, +9.636170e-04, +1.873515e+03, -1.948144e+05, +6.670026e+05, +1.052449e+06, +1.906324e+05, +3.198095e+03, +3.798054e+03, +1.037757e+03, -6.107698e-01, +2.655829e-07, -6.775539e-04, +3.981493e-10, -3.320498e-16, +4.000000e+08, +2.299733e+06, +3.765303e+06, +2.268279e+03, +5.181550e+03, +1.772569e+04 },
+    { +4.700000e+02, +9.693532e-04, +1.955213e+03, -2.162540e+05, +7.026959e+05, +1.090437e+06, +1.714873e+05, +3.175343e+03, +3.799545e+03, +1.031616e+03, -6.173827e-01, +2.696781e-07, -6.450932e-04, +4.207849e-10, -3.451411e-16, +4.000000e+08, +2.289332e+06, +3.708125e+06, +1.955514e+03, +5.078738e+03, +1.759785e+04 },
+    { +4.800000e+02, +9.752195e-04, +2.035223e+03, -2.385541e+05, +7.383530e+05, +1.128441e+06, +1.515338e+05, +3.153139e+03, +3.801200e+03, +1.025410e+03, -6.236735e-01, +2.739965e-07, -6.132003e-04, +4.428138e-10, -3.590918e-16, +4.000000e+08, +2.276209e+06, +3.649681e+06, +1.670924e+03, +4.989128e+03, +1.745702e+04 },
+    { +4.900000e+02, +9.812163e-04, +2.113619e+03, -2.616983e+05, +7.739751e+05, +1.166462e+06, +1.307882e+05, +3.131470e+03, +3.802972e+03, +1.019143e+03, -6.296494e-01, +2.785326e-07, -5.821181e-04, +4.643195e-10, -3.739113e-16, +4.000000e+08, +2.260595e+06, +3.590244e+06, +1.413252e+03, +4.910293e+03, +1.730376e+04 },
+    { +5.000000e+02, +9.873440e-04, +2.190468e+03, -2.856711e+05, +8.095629e+05, +1.204501e+06, +1.092665e+05, +3.110322e+03, +3.804822e+03, +1.012818e+03, -6.353191e-01, +2.832814e-07, -5.519818e-04, +4.853699e-10, -3.896118e-16, +4.000000e+08, +2.242713e+06, +3.530059e+06, +1.180966e+03, +4.840194e+03, +1.713870e+04 },
+    { +5.100000e+02, +9.936033e-04, +2.265832e+03, -3.104575e+05, +8.451169e+05, +1.242558e+06, +8.698382e+04, +3.089679e+03, +3.806719e+03, +1.006438e+03, -6.406924e-01, +2.882387e-07, -5.228470e-04, +5.060192e-10, -4.062069e-16, +4.000000e+08, +2.222784e+06, +3.469347e+06, +9.723839e+02, +4.777127e+03, +1.696253e+04 },
+    { +5.200000e+02, +9.999947e-04, +2.339770e+03, -3.360432e+05, +8.806371e+05, +1.280635e+06, +6.395464e+04, +3.069528e+03, +3.808633e+03, +1.000005e+03, -6.457793e-01, +2.934006e-07, -4.947122e-04, +5.263091e-10, -4.237118e-16, +4.000000e+08, +2.201016e+06, +3.408309e+06, +7.857594e+02, +4.719665e+03, +1.677596e+04 },
+    { +5.300000e+02, +1.006519e-03, +2.412336e+03, -3.624146e+05, +9.161232e+05, +1.318731e+06, +4.019300e+04, +3.049852e+03, +3.810540e+03, +9.935232e+02, -6.505898e-01, +2.987638e-07, -4.675353e-04, +5.462699e-10, -4.421420e-16, +4.000000e+08, +2.177606e+06, +3.347126e+06, +6.193438e+02, +4.666617e+03, +1.657975e+04 },
+    { +5.400000e+02, +1.013177e-03, +2.483580e+03, -3.895585e+05, +9.515748e+05, +1.356846e+06, +1.571234e+04, +3.030638e+03, +3.812420e+03, +9.869944e+02, -6.551330e-01, +3.043250e-07, -4.412469e-04, +5.659221e-10, -4.615132e-16, +4.000000e+08, +2.152742e+06, +3.285961e+06, +4.714297e+02, +4.616991e+03, +1.637462e+04 },
+    { +5.500000e+02, +1.019970e-03, +2.553552e+03, -4.174622e+05, +9.869912e+05, +1.394979e+06, -9.474365e+03, +3.011871e+03, +3.814255e+03, +9.804214e+02, -6.594174e-01, +3.100812e-07, -4.157607e-04, +5.852772e-10, -4.818406e-16, +4.000000e+08, +2.126596e+06, +3.224962e+06, +3.403804e+02, +4.569958e+03, +1.616133e+04 },
+    { +5.600000e+02, +1.026898e-03, +2.622295e+03, -4.461137e+05, +1.022371e+06, +1.433131e+06, -3.535460e+04, +2.993540e+03, +3.816032e+03, +9.738069e+02, -6.634506e-01, +3.160295e-07, -3.909805e-04, +6.043385e-10, -5.031387e-16, +4.000000e+08, +2.099331e+06, +3.164261e+06, +2.246476e+02, +4.524832e+03, +1.594060e+04 },
+    { +5.700000e+02, +1.033962e-03, +2.689852e+03, -4.755012e+05, +1.057715e+06, +1.471299e+06, -6.191631e+04, +2.975631e+03, +3.817736e+03, +9.671532e+02, -6.672391e-01, +3.221670e-07, -3.668066e-04, +6.231024e-10, -5.254204e-16, +4.000000e+08, +2.071097e+06, +3.103980e+06, +1.227821e+02, +4.481040e+03, +1.571317e+04 },
+    { +5.800000e+02, +1.041165e-03, +2.756264e+03, -5.056137e+05, +1.093019e+06, +1.509485e+06, -8.914783e+04, +2.958136e+03, +3.819358e+03, +9.604629e+02, -6.707884e-01, +3.284906e-07, -3.431402e-04, +6.415585e-10, -5.486971e-16, +4.000000e+08, +2.042032e+06, +3.044227e+06, +3.343840e+01, +4.438110e+03, +1.547975e+04 },
+    { +5.900000e+02, +1.048506e-03, +2.821566e+03, -5.364402e+05, +1.128284e+06, +1.547686e+06, -1.170379e+05, +2.941043e+03, +3.820887e+03, +9.537382e+02, -6.741032e-01, +3.349971e-07, -3.198866e-04, +6.596909e-10, -5.729781e-16, +4.000000e+08, +2.012266e+06, +2.985101e+06, -4.462498e+01, +4.395652e+03, +1.524105e+04 },
+    { +6.000000e+02, +1.055987e-03, +2.885797e+03, -5.679703e+05, +1.163508e+06, +1.585902e+06, -1.455756e+05, +2.924344e+03, +3.822315e+03, +9.469816e+02, -6.771872e-01, +3.416832e-07, -2.969575e-04, +6.774789e-10, -5.982703e-16, +4.000000e+08, +1.981915e+06, +2.926687e+06, -1.125473e+02, +4.353347e+03, +1.499776e+04 },
+    { +6.100000e+02, +1.063609e-03, +2.948988e+03, -6.001939e+05, +1.198689e+06, +1.624132e+06, -1.747504e+05, +2.908031e+03, +3.823634e+03, +9.401953e+02, -6.800432e-01, +3.485454e-07, -2.742732e-04, +6.948973e-10, -6.245775e-16, +4.000000e+08, +1.951089e+06, +2.869066e+06, -1.713698e+02, +4.310934e+03, +1.475055e+04 },
+    { +6.200000e+02, +1.071373e-03, +3.011172e+03, -6.331013e+05, +1.233825e+06, +1.662375e+06, -2.045520e+05, +2.892097e+03, +3.824840e+03, +9.333815e+02, -6.826733e-01, +3.555799e-07, -2.517638e-04, +7.119174e-10, -6.519009e-16, +4.000000e+08, +1.919887e+06, +2.812308e+06, -2.220410e+02, +4.268203e+03, +1.450007e+04 },
+    { +6.300000e+02, +1.079281e-03, +3.072380e+03, -6.666831e+05, +1.268916e+06, +1.700629e+06, -2.349705e+05, +2.876534e+03, +3.825924e+03, +9.265425e+02, -6.850789e-01, +3.627824e-07, -2.293694e-04, +7.285076e-10, -6.802380e-16, +4.000000e+08, +1.888402e+06, +2.756474e+06, -2.654223e+02, +4.224987e+03, +1.424697e+04 },
+    { +6.400000e+02, +1.087334e-03, +3.132639e+03, -7.009300e+05, +1.303959e+06, +1.738893e+06, -2.659964e+05, +2.861338e+03, +3.826884e+03, +9.196806e+02, -6.872609e-01, +3.701485e-07, -2.070411e-04, +7.446339e-10, -7.095826e-16, +4.000000e+08, +1.856717e+06, +2.701619e+06, -3.022947e+02, +4.181160e+03, +1.399185e+04 },
+    { +6.500000e+02, +1.095533e-03, +3.191979e+03, -7.358333e+05, +1.338953e+06, +1.777166e+06, -2.976203e+05, +2.846501e+03, +3.827714e+03, +9.127981e+02, -6.892198e-01, +3.776734e-07, -1.847407e-04, +7.602602e-10, -7.399250e-16, +4.000000e+08, +1.824910e+06, +2.647791e+06, -3.333644e+02, +4.136622e+03, +1.373532e+04 },
+    { +6.750000e+02, +1.116675e-03, +3.336468e+03, -8.259071e+05, +1.426209e+06, +1.872879e+06, -3.792371e+05, +2.810957e+03, +3.829200e+03, +8.955156e+02, -6.931412e-01, +3.971454e-07, -1.289525e-04, +7.968932e-10, -8.200430e-16, +4.000000e+08, +1.745308e+06, +2.517970e+06, -3.896860e+02, +4.021791e+03, +1.309146e+04 },
+    { +7.000000e+02, +1.138754e-03, +3.475741e+03, -9.199019e+05, +1.513117e+06, +1.968619e+06, -4.644002e+05, +2.777569e+03, +3.829818e+03, +8.781526e+02, -6.956660e-01, +4.174851e-07, -7.300434e-05, +8.295697e-10, -9.059558e-16, +4.000000e+08, +1.666325e+06, +2.395295e+06, -4.219272e+02, +3.901732e+03, +1.245043e+04 },
+    { +7.250000e+02, +1.161786e-03, +3.610133e+03, -1.017698e+06, +1.599648e+06, +2.064363e+06, -5.529835e+05, +2.746280e+03, +3.829559e+03, +8.607440e+02, -6.967908e-01, +4.385859e-07, -1.698802e-05, +8.576848e-10, -9.971348e-16, +4.000000e+08, +1.588722e+06, +2.280055e+06, -4.365221e+02, +3.776741e+03, +1.181925e+04 },
+    { +7.500000e+02, +1.185783e-03, +3.739944e+03, -1.119182e+06, +1.685776e+06, +2.160089e+06, -6.448687e+05, +2.717038e+03, +3.828434e+03, +8.433248e+02, -6.965168e-01, +4.603262e-07, +3.885823e-05, +8.806324e-10, -1.092843e-15, +4.000000e+08, +1.513094e+06, +2.172372e+06, -4.383948e+02, +3.647667e+03, +1.120368e+04 },
+    { +7.750000e+02, +1.210757e-03, +3.865448e+03, -1.224247e+06, +1.771475e+06, +2.255777e+06, -7.399448e+05, +2.689792e+03, +3.826476e+03, +8.259298e+02, -6.948514e-01, +4.825692e-07, +9.429071e-05, +8.977892e-10, -1.192108e-15, +4.000000e+08, +1.439900e+06, +2.072241e+06, -4.313013e+02, +3.515764e+03, +1.060808e+04 },
+    { +8.000000e+02, +1.236715e-03, +3.986892e+03, -1.332793e+06, +1.856720e+06, +2.351406e+06, -8.381073e+05, +2.664490e+03, +3.823717e+03, +8.085937e+02, -6.918069e-01, +5.051619e-07, +1.491767e-04, +9.084850e-10, -1.293689e-15, +4.000000e+08, +1.369476e+06, +1.979563e+06, -4.180950e+02, +3.382562e+03, +1.003548e+04 },
+    { +8.250000e+02, +1.263662e-03, +4.104502e+03, -1.444722e+06, +1.941492e+06, +2.446957e+06, -9.392575e+05, +2.641078e+03, +3.820180e+03, +7.913508e+02, -6.873968e-01, +5.279335e-07, +2.035561e-04, +9.119763e-10, -1.396046e-15, +4.000000e+08, +1.302052e+06, +1.894178e+06, -4.009331e+02, +3.249742e+03, +9.487724e+03 },
+    { +8.500000e+02, +1.291597e-03, +4.218484e+03, -1.559941e+06, +2.025770e+06, +2.542409e+06, -1.043302e+06, +2.619493e+03, +3.815855e+03, +7.742351e+02, -6.816316e-01, +5.506938e-07, +2.576289e-04, +9.074449e-10, -1.497313e-15, +4.000000e+08, +1.237769e+06, +1.815891e+06, -3.814330e+02, +3.119008e+03, +8.965651e+03 },
+    { +9.000000e+02, +1.350401e-03, +4.436290e+03, -1.799887e+06, +2.192775e+06, +2.732935e+06, -1.259726e+06, +2.581545e+03, +3.804557e+03, +7.405206e+02, -6.660469e-01, +5.953154e-07, +3.658667e-04, +8.709873e-10, -1.687625e-15, +4.000000e+08, +1.118813e+06, +1.679782e+06, -3.398824e+02, +2.870060e+03, +7.998980e+03 },
+    { +9.500000e+02, +1.412986e-03, +4.641592e+03, -2.051918e+06, +2.357595e+06, +2.922790e+06, -1.486723e+06, +2.550072e+03, +3.788740e+03, +7.077209e+02, -6.450400e-01, +6.371150e-07, +4.742007e-04, +7.940876e-10, -1.845120e-15, +4.000000e+08, +1.012439e+06, +1.569575e+06, -2.995103e+02, +2.645832e+03, +7.134626e+03 },
+    { +1.000000e+03, +1.479059e-03, +4.835401e+03, -2.315317e+06, +2.520083e+06, +3.111707e+06, -1.723694e+06, +2.524457e+03, +3.766799e+03, +6.761056e+02, -6.187083e-01, +6.740645e-07, +5.774291e-04, +6.779520e-10, -1.952104e-15, +4.000000e+08, +9.178770e+05, +1.483538e+06, -2.630880e+02, +2.451431e+03, +6.373803e+03 },
+    { +1.050000e+03, +1.548154e-03, +5.018505e+03, -2.589346e+06, +2.680084e+06, +3.299345e+06, -1.970085e+06, +2.504079e+03, +3.737438e+03, +6.459306e+02, -5.875650e-01, +7.044330e-07, +6.645553e-04, +5.334622e-10, -2.000015e-15, +4.000000e+08, +8.340963e+05, +1.419581e+06, -2.314334e+02, +2.286747e+03, +5.721556e+03 },
+    { +1.100000e+03, +1.619666e-03, +5.191546e+03, -2.873243e+06, +2.837458e+06, +3.485324e+06, -2.225377e+06, +2.488347e+03, +3.700545e+03, +6.174111e+02, -5.527205e-01, +7.272462e-07, +7.238176e-04, +3.791210e-10, -1.993507e-15, +4.000000e+08, +7.600184e+05, +1.375050e+06, -2.043191e+02, +2.147870e+03, +5.182905e+03 },
+    { +1.150000e+03, +1.692924e-03, +5.355111e+03, -3.166251e+06, +2.992127e+06, +3.669296e+06, -2.489081e+06, +2.476714e+03, +3.657478e+03, +5.906939e+02, -5.157561e-01, +7.425029e-07, +7.489947e-04, +2.340255e-10, -1.947493e-15, +4.000000e+08, +6.946182e+05, +1.346796e+06, -1.810860e+02, +2.029235e+03, +4.757528e+03 },
+    { +1.200000e+03, +1.767276e-03, +5.509791e+03, -3.467650e+06, +3.144099e+06, +3.851009e+06, -2.760740e+06, +2.468681e+03, +3.610641e+03, +5.658425e+02, -4.783630e-01, +7.510247e-07, +7.418521e-04, +1.111961e-10, -1.879651e-15, +4.000000e+08, +6.369471e+05, +1.331514e+06, -1.610157e+02, +1.925476e+03, +4.437256e+03 },
+    { +1.250000e+03, +1.842162e-03, +5.656212e+03, -3.776788e+06, +3.293477e+06, +4.030342e+06, -3.039923e+06, +2.463790e+03, +3.562707e+03, +5.428404e+02, -4.419851e-01, +7.540771e-07, +7.099101e-04, +1.542514e-11, -1.804075e-15, +4.000000e+08, +5.861272e+05, +1.326124e+06, -1.435015e+02, +1.832454e+03, +4.207337e+03 },
+    { +1.273000e+03, +1.876663e-03, +5.720972e+03, -3.921428e+06, +3.361369e+06, +4.112034e+06, -3.170763e+06, +2.462478e+03, +3.540948e+03, +5.328608e+02, -4.258868e-01, +7.540166e-07, +6.894751e-04, -1.981187e-11, -1.769190e-15, +4.000000e+08, +5.648241e+05, +1.326231e+06, -1.361727e+02, +1.792471e+03, +4.126975e+03 },
+    // P = 600 MPa
+    { +2.716910e+02, +8.448830e-04, -1.928926e+02, +3.664727e+04, -1.575991e+04, +4.911699e+05, +5.435771e+05, +3.187056e+03, +3.420156e+03, +1.183596e+03, -4.902903e-01, +2.000015e-07, -2.657690e-03, -1.188051e-10, -1.783410e-16, +6.000000e+08, +2.451433e+06, +4.999963e+06, +2.155944e+04, +1.389970e+04, +2.229213e+04 },
+    { +2.750000e+02, +8.460522e-04, -1.509263e+02, +3.651474e+04, -4.989998e+03, +5.026413e+05, +5.441461e+05, +3.265388e+03, +3.509923e+03, +1.181960e+03, -4.980030e-01, +1.996413e-07, -2.023983e-03, -9.984831e-11, -1.776701e-16, +6.000000e+08, +2.494489e+06, +5.008985e+06, +1.817096e+04, +1.362495e+04, +2.232870e+04 },
+    { +2.800000e+02, +8.478541e-04, -8.671543e+01, +3.602799e+04, +1.174767e+04, +5.204601e+05, +5.447405e+05, +3.352694e+03, +3.611567e+03, +1.179448e+03, -5.061539e-01, +1.991957e-07, -1.274786e-03, -7.978043e-11, -1.763388e-16, +6.000000e+08, +2.540988e+06, +5.020189e+06, +1.415082e+04, +1.330317e+04, +2.231044e+04 },
+    { +2.850000e+02, +8.496870e-04, -2.213120e+01, +3.520041e+04, +2.889301e+04, +5.387052e+05, +5.450126e+05, +3.411731e+03, +3.682051e+03, +1.176904e+03, -5.110946e-01, +1.988326e-07, -7.321219e-04, -6.625135e-11, -1.747680e-16, +6.000000e+08, +2.570477e+06, +5.029356e+06, +1.120274e+04, +1.303898e+04, +2.223305e+04 },
+    { +2.900000e+02, +8.515414e-04, +4.234790e+01, +3.403712e+04, +4.631801e+04, +5.572428e+05, +5.449620e+05, +3.450212e+03, +3.729780e+03, +1.174341e+03, -5.137467e-01, +1.985272e-07, -3.526444e-04, -5.636005e-11, -1.730842e-16, +6.000000e+08, +2.587790e+06, +5.037094e+06, +9.084027e+03, +1.279439e+04, +2.212063e+04 },
+    { +2.950000e+02, +8.534105e-04, +1.063922e+02, +3.254359e+04, +6.392930e+04, +5.759756e+05, +5.445899e+05, +3.473765e+03, +3.760989e+03, +1.171769e+03, -5.148316e-01, +1.982661e-07, -9.966685e-05, -4.825732e-11, -1.713836e-16, +6.000000e+08, +2.596670e+06, +5.043727e+06, +7.595199e+03, +1.254874e+04, +2.198993e+04 },
+    { +3.000000e+02, +8.552897e-04, +1.697794e+02, +3.072528e+04, +8.165910e+04, +5.948330e+05, +5.438991e+05, +3.486501e+03, +3.780291e+03, +1.169194e+03, -5.149031e-01, +1.980435e-07, +5.727139e-05, -4.080953e-11, -1.697382e-16, +6.000000e+08, +2.599949e+06, +5.049395e+06, +6.575925e+03, +1.229232e+04, +2.185232e+04 },
+    { +3.050000e+02, +8.571764e-04, +2.323638e+02, +2.858759e+04, +9.945854e+04, +6.137644e+05, +5.428934e+05, +3.491418e+03, +3.791093e+03, +1.166621e+03, -5.143773e-01, +1.978580e-07, +1.429518e-04, -3.336176e-11, -1.682005e-16, +6.000000e+08, +2.599730e+06, +5.054129e+06, +5.899739e+03, +1.202207e+04, +2.171533e+04 },
+    { +3.100000e+02, +8.590688e-04, +2.940546e+02, +2.613571e+04, +1.172926e+05, +6.327339e+05, +5.415770e+05, +3.490707e+03, +3.795896e+03, +1.164051e+03, -5.135592e-01, +1.977105e-07, +1.771364e-04, -2.557205e-11, -1.668073e-16, +6.000000e+08, +2.597531e+06, +5.057900e+06, +5.468546e+03, +1.173870e+04, +2.158370e+04 },
+    { +3.150000e+02, +8.609664e-04, +3.547999e+02, +2.337463e+04, +1.351366e+05, +6.517164e+05, +5.399544e+05, +3.485967e+03, +3.796536e+03, +1.161486e+03, -5.126658e-01, +1.976031e-07, +1.752857e-04, -1.729665e-11, -1.655829e-16, +6.000000e+08, +2.594422e+06, +5.060649e+06, +5.207441e+03, +1.144489e+04, +2.146022e+04 },
+    { +3.200000e+02, +8.628691e-04, +4.145750e+02, +2.030914e+04, +1.529731e+05, +6.706946e+05, +5.380306e+05, +3.478364e+03, +3.794350e+03, +1.158924e+03, -5.118464e-01, +1.975384e-07, +1.492714e-04, -8.512020e-12, -1.645422e-16, +6.000000e+08, +2.591124e+06, +5.062307e+06, +5.060098e+03, +1.114417e+04, +2.134631e+04 },
+    { +3.250000e+02, +8.647775e-04, +4.733739e+02, +1.694383e+04, +1.707904e+05, +6.896569e+05, +5.358103e+05, +3.468752e+03, +3.790312e+03, +1.156367e+03, -5.111984e-01, +1.975188e-07, +1.080425e-04, +7.371095e-13, -1.636928e-16, +6.000000e+08, +2.588100e+06, +5.062810e+06, +4.984842e+03, +1.084021e+04, +2.124245e+04 },
+    { +3.300000e+02, +8.666923e-04, +5.312040e+02, +1.328307e+04, +1.885804e+05, +7.085958e+05, +5.332985e+05, +3.457752e+03, +3.785125e+03, +1.153812e+03, -5.107803e-01, +1.975464e-07, +5.821393e-05, +1.037151e-11, -1.630373e-16, +6.000000e+08, +2.585622e+06, +5.062102e+06, +4.951388e+03, +1.053647e+04, +2.114851e+04 },
+    { +3.350000e+02, +8.686146e-04, +5.880811e+02, +9.331117e+03, +2.063383e+05, +7.275070e+05, +5.304999e+05, +3.445818e+03, +3.779292e+03, +1.151259e+03, -5.106225e-01, +1.976230e-07, +4.571184e-06, +2.029860e-11, -1.625743e-16, +6.000000e+08, +2.583822e+06, +5.060141e+06, +4.938195e+03, +1.023598e+04, +2.106394e+04 },
+    { +3.400000e+02, +8.705453e-04, +6.440266e+02, +5.092039e+03, +2.240611e+05, +7.463882e+05, +5.274192e+05, +3.433282e+03, +3.773171e+03, +1.148705e+03, -5.107352e-01, +1.977497e-07, -4.951221e-05, +3.042522e-11, -1.622998e-16, +6.000000e+08, +2.582736e+06, +5.056897e+06, +4.930354e+03, +9.941255e+03, +2.098797e+04 },
+    { +3.450000e+02, +8.724856e-04, +6.990654e+02, +5.697853e+02, +2.417474e+05, +7.652387e+05, +5.240611e+05, +3.420384e+03, +3.767014e+03, +1.146151e+03, -5.111145e-01, +1.979274e-07, -1.017358e-04, +4.066475e-11, -1.622082e-16, +6.000000e+08, +2.582333e+06, +5.052357e+06, +4.917925e+03, +9.654329e+03, +2.091968e+04 },
+    { +3.500000e+02, +8.744364e-04, +7.532245e+02, -4.231816e+03, +2.593968e+05, +7.840586e+05, +5.204300e+05, +3.407299e+03, +3.760993e+03, +1.143594e+03, -5.117469e-01, +1.981564e-07, -1.506027e-04, +5.094066e-11, -1.622928e-16, +6.000000e+08, +2.582540e+06, +5.046518e+06, +4.894640e+03, +9.376749e+03, +2.085811e+04 },
+    { +3.550000e+02, +8.763989e-04, +8.065317e+02, -9.309049e+03, +2.770097e+05, +8.028490e+05, +5.165303e+05, +3.394153e+03, +3.755222e+03, +1.141033e+03, -5.126134e-01, +1.984368e-07, -1.952088e-04, +6.118782e-11, -1.625464e-16, +6.000000e+08, +2.583258e+06, +5.039389e+06, +4.856909e+03, +9.109638e+03, +2.080228e+04 },
+    { +3.600000e+02, +8.783740e-04, +8.590147e+02, -1.465830e+04, +2.945870e+05, +8.216114e+05, +5.123661e+05, +3.381037e+03, +3.749776e+03, +1.138467e+03, -5.136911e-01, +1.987682e-07, -2.350794e-04, +7.135253e-11, -1.629616e-16, +6.000000e+08, +2.584373e+06, +5.030987e+06, +4.803056e+03, +8.853757e+03, +2.075128e+04 },
+    { +3.650000e+02, +8.803625e-04, +9.107012e+02, -2.027604e+04, +3.121299e+05, +8.403474e+05, +5.079415e+05, +3.368015e+03, +3.744698e+03, +1.135896e+03, -5.149560e-01, +1.991501e-07, -2.700455e-04, +8.139170e-11, -1.635311e-16, +6.000000e+08, +2.585768e+06, +5.021339e+06, +4.732745e+03, +8.609564e+03, +2.070422e+04 },
+    { +3.700000e+02, +8.823653e-04, +9.616180e+02, -2.615884e+04, +3.296398e+05, +8.590590e+05, +5.032604e+05, +3.355131e+03, +3.740008e+03, +1.133317e+03, -5.163835e-01, +1.995818e-07, -3.001494e-04, +9.127174e-11, -1.642476e-16, +6.000000e+08, +2.587327e+06, +5.010477e+06, +4.646548e+03, +8.377262e+03, +2.066028e+04 },
+    { +3.750000e+02, +8.843831e-04, +1.011791e+03, -3.230336e+04, +3.471183e+05, +8.777482e+05, +4.983265e+05, +3.342416e+03, +3.735714e+03, +1.130732e+03, -5.179497e-01, +2.000625e-07, -3.255749e-04, +1.009673e-10, -1.651045e-16, +6.000000e+08, +2.588939e+06, +4.998438e+06, +4.545625e+03, +8.156858e+03, +2.061873e+04 },
+    { +3.800000e+02, +8.864166e-04, +1.061245e+03, -3.870631e+04, +3.645668e+05, +8.964168e+05, +4.931436e+05, +3.329890e+03, +3.731810e+03, +1.128138e+03, -5.196319e-01, +2.005911e-07, -3.465961e-04, +1.104602e-10, -1.660953e-16, +6.000000e+08, +2.590503e+06, +4.985265e+06, +4.431491e+03, +7.948199e+03, +2.057890e+04 },
+    { +3.850000e+02, +8.884663e-04, +1.110004e+03, -4.536451e+04, +3.819871e+05, +9.150669e+05, +4.877152e+05, +3.317566e+03, +3.728283e+03, +1.125535e+03, -5.214088e-01, +2.011667e-07, -3.635393e-04, +1.197377e-10, -1.672141e-16, +6.000000e+08, +2.591924e+06, +4.971001e+06, +4.305847e+03, +7.751015e+03, +2.054019e+04 },
+    { +3.900000e+02, +8.905326e-04, +1.158091e+03, -5.227484e+04, +3.993807e+05, +9.337002e+05, +4.820447e+05, +3.305449e+03, +3.725117e+03, +1.122924e+03, -5.232611e-01, +2.017882e-07, -3.767565e-04, +1.287923e-10, -1.684554e-16, +6.000000e+08, +2.593121e+06, +4.955692e+06, +4.170458e+03, +7.564944e+03, +2.050208e+04 },
+    { +3.950000e+02, +8.926161e-04, +1.205527e+03, -5.943424e+04, +4.167490e+05, +9.523186e+05, +4.761354e+05, +3.293542e+03, +3.722289e+03, +1.120302e+03, -5.251708e-01, +2.024543e-07, -3.866064e-04, +1.376200e-10, -1.698140e-16, +6.000000e+08, +2.594022e+06, +4.939387e+06, +4.027072e+03, +7.389560e+03, +2.046410e+04 },
+    { +4.000000e+02, +8.947171e-04, +1.252333e+03, -6.683975e+04, +4.340934e+05, +9.709237e+05, +4.699905e+05, +3.281846e+03, +3.719778e+03, +1.117672e+03, -5.271221e-01, +2.031640e-07, -3.934415e-04, +1.462200e-10, -1.712855e-16, +6.000000e+08, +2.594565e+06, +4.922133e+06, +3.877364e+03, +7.224396e+03, +2.042587e+04 },
+    { +4.100000e+02, +8.989728e-04, +1.344130e+03, -8.237747e+04, +4.687160e+05, +1.008100e+06, +4.570062e+05, +3.259069e+03, +3.715612e+03, +1.112381e+03, -5.310942e-01, +2.047095e-07, -3.993981e-04, +1.627455e-10, -1.745502e-16, +6.000000e+08, +2.594379e+06, +4.884970e+06, +3.565119e+03, +6.922729e+03, +2.034726e+04 },
+    { +4.200000e+02, +9.033017e-04, +1.433628e+03, -9.886548e+04, +5.032581e+05, +1.045239e+06, +4.431156e+05, +3.237083e+03, +3.712433e+03, +1.107050e+03, -5.350825e-01, +2.064160e-07, -3.970711e-04, +1.784009e-10, -1.782201e-16, +6.000000e+08, +2.592253e+06, +4.844586e+06, +3.244659e+03, +6.655876e+03, +2.026407e+04 },
+    { +4.300000e+02, +9.077052e-04, +1.520954e+03, -1.162822e+05, +5.377279e+05, +1.082351e+06, +4.283409e+05, +3.215839e+03, +3.710062e+03, +1.101679e+03, -5.390149e-01, +2.082748e-07, -3.885239e-04, +1.932356e-10, -1.822712e-16, +6.000000e+08, +2.587998e+06, +4.801348e+06, +2.924700e+03, +6.419829e+03, +2.017473e+04 },
+    { +4.400000e+02, +9.121842e-04, +1.606226e+03, -1.346072e+05, +5.721321e+05, +1.119443e+06, +4.127033e+05, +3.195286e+03, +3.708341e+03, +1.096270e+03, -5.428379e-01, +2.102781e-07, -3.754381e-04, +2.073063e-10, -1.866839e-16, +6.000000e+08, +2.581523e+06, +4.755606e+06, +2.611859e+03, +6.210807e+03, +2.007819e+04 },
+    { +4.500000e+02, +9.167390e-04, +1.689548e+03, -1.538205e+05, +6.064761e+05, +1.156520e+06, +3.962229e+05, +3.175373e+03, +3.707129e+03, +1.090823e+03, -5.465130e-01, +2.124186e-07, -3.591511e-04, +2.206720e-10, -1.914425e-16, +6.000000e+08, +2.572812e+06, +4.707686e+06, +2.310922e+03, +6.025342e+03, +1.997380e+04 },
+    { +4.600000e+02, +9.213701e-04, +1.771017e+03, -1.739035e+05, +6.407644e+05, +1.193586e+06, +3.789185e+05, +3.156051e+03, +3.706304e+03, +1.085340e+03, -5.500137e-01, +2.146894e-07, -3.407052e-04, +2.333902e-10, -1.965341e-16, +6.000000e+08, +2.561904e+06, +4.657891e+06, +2.025163e+03, +5.860320e+03, +1.986122e+04 },
+    { +4.700000e+02, +9.260774e-04, +1.850719e+03, -1.948380e+05, +6.750001e+05, +1.230647e+06, +3.608084e+05, +3.137277e+03, +3.705764e+03, +1.079823e+03, -5.533226e-01, +2.170844e-07, -3.208984e-04, +2.455148e-10, -2.019483e-16, +6.000000e+08, +2.548882e+06, +4.606503e+06, +1.756643e+03, +5.712976e+03, +1.974032e+04 },
+    { +4.800000e+02, +9.308609e-04, +1.928735e+03, -2.166067e+05, +7.091859e+05, +1.267702e+06, +3.419098e+05, +3.119010e+03, +3.705422e+03, +1.074274e+03, -5.564292e-01, +2.195979e-07, -3.003314e-04, +2.570949e-10, -2.076769e-16, +6.000000e+08, +2.533855e+06, +4.553777e+06, +1.506490e+03, +5.580881e+03, +1.961117e+04 },
+    { +4.900000e+02, +9.357203e-04, +2.005135e+03, -2.391931e+05, +7.433233e+05, +1.304755e+06, +3.222391e+05, +3.101217e+03, +3.705207e+03, +1.068695e+03, -5.593282e-01, +2.222247e-07, -2.794478e-04, +2.681747e-10, -2.137130e-16, +6.000000e+08, +2.516949e+06, +4.499951e+06, +1.275119e+03, +5.461916e+03, +1.947396e+04 },
+    { +5.000000e+02, +9.406554e-04, +2.079989e+03, -2.625810e+05, +7.774135e+05, +1.341807e+06, +3.018122e+05, +3.083866e+03, +3.705059e+03, +1.063089e+03, -5.620182e-01, +2.249599e-07, -2.585680e-04, +2.787928e-10, -2.200511e-16, +6.000000e+08, +2.498304e+06, +4.445237e+06, +1.062428e+03, +5.354240e+03, +1.932895e+04 },
+    { +5.100000e+02, +9.456660e-04, +2.153358e+03, -2.867553e+05, +8.114571e+05, +1.378857e+06, +2.806443e+05, +3.066930e+03, +3.704932e+03, +1.057456e+03, -5.645003e-01, +2.277991e-07, -2.379169e-04, +2.889829e-10, -2.266864e-16, +6.000000e+08, +2.478062e+06, +4.389833e+06, +8.679393e+02, +5.256260e+03, +1.917651e+04 },
+    { +5.200000e+02, +9.507518e-04, +2.225299e+03, -3.117012e+05, +8.454542e+05, +1.415905e+06, +2.587498e+05, +3.050386e+03, +3.704786e+03, +1.051799e+03, -5.667778e-01, +2.307382e-07, -2.176462e-04, +2.987737e-10, -2.336149e-16, +6.000000e+08, +2.456367e+06, +4.333916e+06, +6.909222e+02, +5.166601e+03, +1.901701e+04 },
+    { +5.300000e+02, +9.559125e-04, +2.295867e+03, -3.374046e+05, +8.794048e+05, +1.452952e+06, +2.361429e+05, +3.034214e+03, +3.704593e+03, +1.046121e+03, -5.688548e-01, +2.337733e-07, -1.978520e-04, +3.081895e-10, -2.408332e-16, +6.000000e+08, +2.433361e+06, +4.277648e+06, +5.304788e+02, +5.084076e+03, +1.885088e+04 },
+    { +5.400000e+02, +9.611477e-04, +2.365111e+03, -3.638517e+05, +9.133083e+05, +1.489997e+06, +2.128369e+05, +3.018398e+03, +3.704327e+03, +1.040423e+03, -5.707366e-01, +2.369008e-07, -1.785890e-04, +3.172503e-10, -2.483378e-16, +6.000000e+08, +2.409180e+06, +4.221176e+06, +3.856135e+02, +5.007665e+03, +1.867855e+04 },
+    { +5.500000e+02, +9.664574e-04, +2.433079e+03, -3.910295e+05, +9.471641e+05, +1.527038e+06, +1.888449e+05, +3.002923e+03, +3.703971e+03, +1.034707e+03, -5.724285e-01, +2.401172e-07, -1.598813e-04, +3.259724e-10, -2.561256e-16, +6.000000e+08, +2.383955e+06, +4.164633e+06, +2.552824e+02, +4.936487e+03, +1.850049e+04 },
+    { +5.600000e+02, +9.718411e-04, +2.499815e+03, -4.189252e+05, +9.809713e+05, +1.564076e+06, +1.641794e+05, +2.987778e+03, +3.703511e+03, +1.028975e+03, -5.739361e-01, +2.434192e-07, -1.417312e-04, +3.343688e-10, -2.641934e-16, +6.000000e+08, +2.357810e+06, +4.108140e+06, +1.384309e+02, +4.869787e+03, +1.831714e+04 },
+    { +5.700000e+02, +9.772987e-04, +2.565361e+03, -4.475266e+05, +1.014729e+06, +1.601108e+06, +1.388526e+05, +2.972952e+03, +3.702937e+03, +1.023229e+03, -5.752649e-01, +2.468035e-07, -1.241255e-04, +3.424494e-10, -2.725378e-16, +6.000000e+08, +2.330862e+06, +4.051806e+06, +3.401931e+01, +4.806912e+03, +1.812895e+04 },
+    { +5.800000e+02, +9.828299e-04, +2.629756e+03, -4.768219e+05, +1.048436e+06, +1.638134e+06, +1.128760e+05, +2.958437e+03, +3.702243e+03, +1.017470e+03, -5.764203e-01, +2.502671e-07, -1.070412e-04, +3.502216e-10, -2.811552e-16, +6.000000e+08, +2.303220e+06, +3.995731e+06, -5.895857e+01, +4.747300e+03, +1.793638e+04 },
+    { +5.900000e+02, +9.884345e-04, +2.693037e+03, -5.067995e+05, +1.082092e+06, +1.675153e+06, +8.626117e+04, +2.944226e+03, +3.701423e+03, +1.011701e+03, -5.774074e-01, +2.538069e-07, -9.044875e-05, +3.576906e-10, -2.900417e-16, +6.000000e+08, +2.274987e+06, +3.940003e+06, -1.414637e+02, +4.690468e+03, +1.773985e+04 },
+    { +6.000000e+02, +9.941124e-04, +2.755239e+03, -5.374485e+05, +1.115695e+06, +1.712162e+06, +5.901891e+04, +2.930314e+03, +3.700476e+03, +1.005922e+03, -5.782308e-01, +2.574199e-07, -7.431570e-05, +3.648593e-10, -2.991930e-16, +6.000000e+08, +2.246255e+06, +3.884703e+06, -2.144041e+02, +4.635997e+03, +1.753981e+04 },
+    { +6.100000e+02, +9.998633e-04, +2.816397e+03, -5.687581e+05, +1.149244e+06, +1.749162e+06, +3.115987e+04, +2.916695e+03, +3.699401e+03, +1.000137e+03, -5.788951e-01, +2.611031e-07, -5.860855e-05, +3.717294e-10, -3.086043e-16, +6.000000e+08, +2.217113e+06, +3.829904e+06, -2.786309e+02, +4.583527e+03, +1.733668e+04 },
+    { +6.200000e+02, +1.005687e-03, +2.876541e+03, -6.007179e+05, +1.182738e+06, +1.786150e+06, +2.694352e+03, +2.903366e+03, +3.698197e+03, +9.943451e+02, -5.794043e-01, +2.648535e-07, -4.329460e-05, +3.783011e-10, -3.182705e-16, +6.000000e+08, +2.187641e+06, +3.775672e+06, -3.349369e+02, +4.532747e+03, +1.713086e+04 },
+    { +6.300000e+02, +1.011583e-03, +2.935703e+03, -6.333178e+05, +1.216175e+06, +1.823125e+06, -2.636768e+04, +2.890323e+03, +3.696866e+03, +9.885492e+02, -5.797622e-01, +2.686681e-07, -2.834315e-05, +3.845734e-10, -3.281857e-16, +6.000000e+08, +2.157912e+06, +3.722064e+06, -3.840564e+02, +4.483387e+03, +1.692276e+04 },
+    { +6.400000e+02, +1.017552e-03, +2.993912e+03, -6.665480e+05, +1.249555e+06, +1.860087e+06, -5.601653e+04, +2.877565e+03, +3.695411e+03, +9.827504e+02, -5.799723e-01, +2.725440e-07, -1.372638e-05, +3.905448e-10, -3.383436e-16, +6.000000e+08, +2.127995e+06, +3.669132e+06, -4.266668e+02, +4.435216e+03, +1.671276e+04 },
+    { +6.500000e+02, +1.023594e-03, +3.051194e+03, -7.003990e+05, +1.282877e+06, +1.897033e+06, -8.624282e+04, +2.865088e+03, +3.693832e+03, +9.769502e+02, -5.800378e-01, +2.764780e-07, +5.800837e-07, +3.962129e-10, -3.487374e-16, +6.000000e+08, +2.097952e+06, +3.616924e+06, -4.633910e+02, +4.388032e+03, +1.650124e+04 },
+    { +6.750000e+02, +1.039012e-03, +3.190519e+03, -7.876826e+05, +1.365918e+06, +1.989325e+06, -1.642755e+05, +2.835118e+03, +3.689371e+03, +9.624531e+02, -5.795881e-01, +2.865477e-07, +3.511410e-05, +4.090401e-10, -3.757036e-16, +6.000000e+08, +2.022658e+06, +3.489820e+06, -5.330774e+02, +4.273312e+03, +1.596815e+04 },
+    { +7.000000e+02, +1.054877e-03, +3.324602e+03, -8.786513e+05, +1.448570e+06, +2.081496e+06, -2.457251e+05, +2.806873e+03, +3.684219e+03, +9.479778e+02, -5.782954e-01, +2.969138e-07, +6.804117e-05, +4.199168e-10, -4.039649e-16, +6.000000e+08, +1.947688e+06, +3.367981e+06, -5.770665e+02, +4.161637e+03, +1.543308e+04 },
+    { +7.250000e+02, +1.071186e-03, +3.453787e+03, -9.731762e+05, +1.530819e+06, +2.173530e+06, -3.304648e+05, +2.780335e+03, +3.678444e+03, +9.335450e+02, -5.761988e-01, +3.075271e-07, +9.943283e-05, +4.288148e-10, -4.333702e-16, +6.000000e+08, +1.873652e+06, +3.251746e+06, -6.014266e+02, +4.051586e+03, +1.490078e+04 },
+    { +7.500000e+02, +1.087933e-03, +3.578386e+03, -1.071136e+06, +1.612654e+06, +2.265414e+06, -4.183762e+05, +2.755483e+03, +3.672119e+03, +9.191742e+02, -5.733369e-01, +3.183380e-07, +1.292466e-04, +4.357262e-10, -4.637509e-16, +6.000000e+08, +1.801032e+06, +3.141316e+06, -6.109346e+02, +3.942252e+03, +1.437539e+04 },
+    { +7.750000e+02, +1.105114e-03, +3.698685e+03, -1.172417e+06, +1.694064e+06, +2.357133e+06, -5.093483e+05, +2.732290e+03, +3.665324e+03, +9.048842e+02, -5.697506e-01, +3.292970e-07, +1.573672e-04, +4.406678e-10, -4.949236e-16, +6.000000e+08, +1.730203e+06, +3.036773e+06, -6.093358e+02, +3.833124e+03, +1.386038e+04 },
+    { +8.000000e+02, +1.122722e-03, +3.814942e+03, -1.276910e+06, +1.775043e+06, +2.448677e+06, -6.032768e+05, +2.710729e+03, +3.658149e+03, +8.906924e+02, -5.654838e-01, +3.403553e-07, +1.836526e-04, +4.436785e-10, -5.266914e-16, +6.000000e+08, +1.661452e+06, +2.938107e+06, -5.995582e+02, +3.723995e+03, +1.335854e+04 },
+    { +8.250000e+02, +1.140751e-03, +3.927395e+03, -1.384514e+06, +1.855587e+06, +2.540038e+06, -7.000637e+05, +2.690765e+03, +3.650685e+03, +8.766153e+02, -5.605843e-01, +3.514652e-07, +2.079769e-04, +4.448104e-10, -5.588440e-16, +6.000000e+08, +1.594992e+06, +2.845232e+06, -5.838867e+02, +3.614907e+03, +1.287193e+04 },
+    { +8.500000e+02, +1.159194e-03, +4.036266e+03, -1.495133e+06, +1.935693e+06, +2.631209e+06, -7.996167e+05, +2.672355e+03, +3.643027e+03, +8.626680e+02, -5.551020e-01, +3.625806e-07, +2.302662e-04, +4.441178e-10, -5.911556e-16, +6.000000e+08, +1.530976e+06, +2.758008e+06, -5.641002e+02, +3.506090e+03, +1.240190e+04 },
+    { +9.000000e+02, +1.197293e-03, +4.244056e+03, -1.725054e+06, +2.094597e+06, +2.812972e+06, -1.006678e+06, +2.640005e+03, +3.627481e+03, +8.352176e+02, -5.425921e-01, +3.846481e-07, +2.688302e-04, +4.374080e-10, -6.552501e-16, +6.000000e+08, +1.410620e+06, +2.599779e+06, -5.173945e+02, +3.290889e+03, +1.151374e+04 },
+    { +9.500000e+02, +1.236953e-03, +4.439770e+03, -1.965993e+06, +2.251788e+06, +2.993961e+06, -1.223821e+06, +2.613243e+03, +3.612114e+03, +8.084379e+02, -5.283372e-01, +4.062030e-07, +3.003304e-04, +4.235773e-10, -7.166891e-16, +6.000000e+08, +1.300673e+06, +2.461823e+06, -4.671125e+02, +3.082414e+03, +1.069305e+04 },
+    { +1.000000e+03, +1.278106e-03, +4.624667e+03, -2.217338e+06, +2.407329e+06, +3.174192e+06, -1.450475e+06, +2.591565e+03, +3.597248e+03, +7.824078e+02, -5.126448e-01, +4.268800e-07, +3.266885e-04, +4.021878e-10, -7.726910e-16, +6.000000e+08, +1.200911e+06, +2.342579e+06, -4.176982e+02, +2.885120e+03, +9.933184e+03 },
+    { +1.050000e+03, +1.320666e-03, +4.799828e+03, -2.478525e+06, +2.561294e+06, +3.353693e+06, -1.686126e+06, +2.574438e+03, +3.582846e+03, +7.571939e+02, -4.957200e-01, +4.462848e-07, +3.499218e-04, +3.725928e-10, -8.200860e-16, +6.000000e+08, +1.110771e+06, +2.240722e+06, -3.715579e+02, +2.702889e+03, +9.226206e+03 },
+    { +1.100000e+03, +1.364528e-03, +4.966172e+03, -2.749027e+06, +2.713762e+06, +3.532479e+06, -1.930311e+06, +2.561322e+03, +3.568537e+03, +7.328543e+02, -4.776835e-01, +4.639973e-07, +3.712608e-04, +3.345129e-10, -8.557609e-16, +6.000000e+08, +1.029496e+06, +2.155185e+06, -3.298108e+02, +2.538348e+03, +8.566554e+03 },
+    { +1.150000e+03, +1.409557e-03, +5.124477e+03, -3.028343e+06, +2.864805e+06, +3.710539e+06, -2.182609e+06, +2.551695e+03, +3.553759e+03, +7.094426e+02, -4.586256e-01, +4.796057e-07, +3.906609e-04, +2.886532e-10, -8.773771e-16, +6.000000e+08, +9.562555e+05, +2.085046e+06, -2.927782e+02, +2.392573e+03, +7.953044e+03 },
+    { +1.200000e+03, +1.455590e-03, +5.275394e+03, -3.315989e+06, +3.014483e+06, +3.887837e+06, -2.442635e+06, +2.545075e+03, +3.537948e+03, +6.870068e+02, -4.386696e-01, +4.927657e-07, +4.069097e-04, +2.370187e-10, -8.840919e-16, +6.000000e+08, +8.902194e+05, +2.029362e+06, -2.603111e+02, +2.265141e+03, +7.388836e+03 },
+    { +1.250000e+03, +1.502433e-03, +5.419476e+03, -3.611494e+06, +3.162851e+06, +4.064310e+06, -2.710034e+06, +2.541024e+03, +3.520723e+03, +6.655873e+02, -4.180168e-01, +5.032628e-07, +4.182361e-04, +1.827143e-10, -8.769195e-16, +6.000000e+08, +8.306133e+05, +1.987034e+06, -2.320120e+02, +2.154457e+03, +6.879792e+03 },
+    { +1.273000e+03, +1.524196e-03, +5.483592e+03, -3.749940e+06, +3.230673e+06, +4.145191e+06, -2.835422e+06, +2.539916e+03, +3.512289e+03, +6.560838e+02, -4.083589e-01, +5.071782e-07, +4.213412e-04, +1.578208e-10, -8.696437e-16, +6.000000e+08, +8.051585e+05, +1.971693e+06, -2.202577e+02, +2.108544e+03, +6.665912e+03 },
+    // P = 800 MPa
+    { +2.867250e+02, +8.246141e-04, -7.226961e+01, +5.274030e+04, +3.201880e+04, +6.917101e+05, +7.124316e+05, +3.357523e+03, +3.668480e+03, +1.212689e+03, -5.202322e-01, +1.696919e-07, -9.047420e-05, -2.554037e-11, -1.214841e-16, +8.000000e+08, +3.065745e+06, +5.893033e+06, +8.184710e+03, +1.382098e+04, +2.486200e+04 },
+    { +2.900000e+02, +8.257744e-04, -3.039141e+01, +5.198013e+04, +4.316662e+04, +7.037861e+05, +7.125996e+05, +3.389070e+03, +3.704682e+03, +1.210985e+03, -5.203054e-01, +1.696228e-07, +4.187596e-05, -1.701986e-11, -1.211739e-16, +8.000000e+08, +3.067426e+06, +5.895433e+06, +7.090297e+03, +1.351012e+04, +2.482884e+04 },
+    { +2.950000e+02, +8.275514e-04, +3.329883e+01, +5.055112e+04, +6.037427e+04, +7.224154e+05, +7.125922e+05, +3.422408e+03, +3.744183e+03, +1.208384e+03, -5.196794e-01, +1.695630e-07, +1.998724e-04, -7.465620e-12, -1.206321e-16, +8.000000e+08, +3.064815e+06, +5.897512e+06, +5.773649e+03, +1.311859e+04, +2.474396e+04 },
+    { +3.000000e+02, +8.293326e-04, +9.645358e+01, +4.880146e+04, +7.773754e+04, +7.412036e+05, +7.122676e+05, +3.441997e+03, +3.769042e+03, +1.205789e+03, -5.183887e-01, +1.695437e-07, +3.087494e-04, -5.952341e-13, -1.200465e-16, +8.000000e+08, +3.057552e+06, +5.898184e+06, +4.819760e+03, +1.278980e+04, +2.463227e+04 },
+    { +3.050000e+02, +8.311163e-04, +1.588821e+02, +4.673585e+04, +9.519489e+04, +7.600879e+05, +7.116289e+05, +3.451468e+03, +3.783154e+03, +1.203201e+03, -5.166621e-01, +1.695546e-07, +3.754990e-04, +4.749088e-12, -1.194526e-16, +8.000000e+08, +3.047173e+06, +5.897807e+06, +4.156229e+03, +1.249598e+04, +2.450570e+04 },
+    { +3.100000e+02, +8.329012e-04, +2.204583e+02, +4.435920e+04, +1.127013e+05, +7.790222e+05, +7.106802e+05, +3.453553e+03, +3.789477e+03, +1.200623e+03, -5.146909e-01, +1.695899e-07, +4.079468e-04, +9.317944e-12, -1.188778e-16, +8.000000e+08, +3.034914e+06, +5.896576e+06, +3.717456e+03, +1.222034e+04, +2.437253e+04 },
+    { +3.150000e+02, +8.346867e-04, +2.811035e+02, +4.167649e+04, +1.302241e+05, +7.979735e+05, +7.094259e+05, +3.450297e+03, +3.790246e+03, +1.198054e+03, -5.126272e-01, +1.696472e-07, +4.136827e-04, +1.358344e-11, -1.183432e-16, +8.000000e+08, +3.021724e+06, +5.894584e+06, +3.447131e+03, +1.195326e+04, +2.423834e+04 },
+    { +3.200000e+02, +8.364727e-04, +3.407735e+02, +3.869260e+04, +1.477401e+05, +8.169183e+05, +7.078708e+05, +3.443233e+03, +3.787144e+03, +1.195496e+03, -5.105872e-01, +1.697257e-07, +3.995154e-04, +1.782896e-11, -1.178644e-16, +8.000000e+08, +3.008307e+06, +5.891858e+06, +3.298713e+03, +1.168970e+04, +2.410679e+04 },
+    { +3.250000e+02, +8.382593e-04, +3.994486e+02, +3.541231e+04, +1.652331e+05, +8.358406e+05, +7.060198e+05, +3.433504e+03, +3.781428e+03, +1.192948e+03, -5.086554e-01, +1.698258e-07, +3.712467e-04, +2.221189e-11, -1.174526e-16, +8.000000e+08, +2.995161e+06, +5.888388e+06, +3.234863e+03, +1.142748e+04, +2.398016e+04 },
+    { +3.300000e+02, +8.400471e-04, +4.571268e+02, +3.184025e+04, +1.826921e+05, +8.547298e+05, +7.038779e+05, +3.421959e+03, +3.774031e+03, +1.190409e+03, -5.068902e-01, +1.699482e-07, +3.336342e-04, +2.680716e-11, -1.171158e-16, +8.000000e+08, +2.982616e+06, +5.884145e+06, +3.226372e+03, +1.116611e+04, +2.385973e+04 },
+    { +3.350000e+02, +8.418366e-04, +5.138182e+02, +2.798089e+04, +2.001100e+05, +8.735792e+05, +7.014502e+05, +3.409227e+03, +3.765644e+03, +1.187879e+03, -5.053283e-01, +1.700942e-07, +2.904579e-04, +3.163737e-11, -1.168587e-16, +8.000000e+08, +2.970873e+06, +5.879094e+06, +3.250939e+03, +1.090607e+04, +2.374610e+04 },
+    { +3.400000e+02, +8.436286e-04, +5.695412e+02, +2.383852e+04, +2.174825e+05, +8.923854e+05, +6.987414e+05, +3.395772e+03, +3.756766e+03, +1.185356e+03, -5.039900e-01, +1.702650e-07, +2.446340e-04, +3.669327e-11, -1.166843e-16, +8.000000e+08, +2.960033e+06, +5.873199e+06, +3.291950e+03, +1.064831e+04, +2.363941e+04 },
+    { +3.450000e+02, +8.454238e-04, +6.243199e+02, +1.941728e+04, +2.348077e+05, +9.111467e+05, +6.957563e+05, +3.381934e+03, +3.747760e+03, +1.182839e+03, -5.028827e-01, +1.704615e-07, +1.983480e-04, +4.194760e-11, -1.165937e-16, +8.000000e+08, +2.950125e+06, +5.866427e+06, +3.337373e+03, +1.039396e+04, +2.353945e+04 },
+    { +3.500000e+02, +8.472231e-04, +6.781815e+02, +1.472118e+04, +2.520847e+05, +9.298632e+05, +6.924997e+05, +3.367957e+03, +3.738881e+03, +1.180327e+03, -5.020046e-01, +1.706847e-07, +1.531844e-04, +4.736415e-11, -1.165868e-16, +8.000000e+08, +2.941122e+06, +5.858755e+06, +3.378789e+03, +1.014414e+04, +2.344583e+04 },
+    { +3.550000e+02, +8.490274e-04, +7.311550e+02, +9.754070e+03, +2.693141e+05, +9.485360e+05, +6.889760e+05, +3.354017e+03, +3.730302e+03, +1.177818e+03, -5.013472e-01, +1.709353e-07, +1.102464e-04, +5.290358e-11, -1.166626e-16, +8.000000e+08, +2.932964e+06, +5.850165e+06, +3.410584e+03, +9.899888e+03, +2.335803e+04 },
+    { +3.600000e+02, +8.508373e-04, +7.832704e+02, +4.519693e+03, +2.864970e+05, +9.671669e+05, +6.851896e+05, +3.340238e+03, +3.722141e+03, +1.175313e+03, -5.008972e-01, +1.712139e-07, +7.025968e-05, +5.852708e-11, -1.168195e-16, +8.000000e+08, +2.925564e+06, +5.840648e+06, +3.429281e+03, +9.662074e+03, +2.327547e+04 },
+    { +3.650000e+02, +8.526538e-04, +8.345577e+02, -9.783405e+02, +3.036352e+05, +9.857582e+05, +6.811447e+05, +3.326702e+03, +3.714469e+03, +1.172809e+03, -5.006389e-01, +1.715207e-07, +3.365964e-05, +6.419841e-11, -1.170554e-16, +8.000000e+08, +2.918825e+06, +5.830200e+06, +3.432999e+03, +9.431404e+03, +2.319753e+04 },
+    { +3.700000e+02, +8.544773e-04, +8.850464e+02, -6.736523e+03, +3.207306e+05, +1.004312e+06, +6.768453e+05, +3.313465e+03, +3.707324e+03, +1.170306e+03, -5.005546e-01, +1.718559e-07, +6.632001e-07, +6.988505e-11, -1.173678e-16, +8.000000e+08, +2.912641e+06, +5.818828e+06, +3.421031e+03, +9.208411e+03, +2.312362e+04 },
+    { +3.750000e+02, +8.563087e-04, +9.347651e+02, -1.275145e+04, +3.377855e+05, +1.022832e+06, +6.722955e+05, +3.300561e+03, +3.700723e+03, +1.167803e+03, -5.006262e-01, +1.722195e-07, -2.867356e-05, +7.555862e-11, -1.177544e-16, +8.000000e+08, +2.906907e+06, +5.806543e+06, +3.393501e+03, +8.993471e+03, +2.305313e+04 },
+    { +3.800000e+02, +8.581484e-04, +9.837414e+02, -1.901982e+04, +3.548019e+05, +1.041321e+06, +6.674989e+05, +3.288007e+03, +3.694664e+03, +1.165300e+03, -5.008353e-01, +1.726114e-07, -5.440978e-05, +8.119496e-11, -1.182124e-16, +8.000000e+08, +2.901519e+06, +5.793359e+06, +3.351114e+03, +8.786818e+03, +2.298553e+04 },
+    { +3.850000e+02, +8.599971e-04, +1.032002e+03, -2.553840e+04, +3.717823e+05, +1.059780e+06, +6.624593e+05, +3.275811e+03, +3.689134e+03, +1.162795e+03, -5.011645e-01, +1.730314e-07, -7.668438e-05, +8.677390e-11, -1.187394e-16, +8.000000e+08, +2.896379e+06, +5.779299e+06, +3.294952e+03, +8.588562e+03, +2.292029e+04 },
+    { +3.900000e+02, +8.618551e-04, +1.079571e+03, -3.230407e+04, +3.887287e+05, +1.078213e+06, +6.571800e+05, +3.263970e+03, +3.684111e+03, +1.160288e+03, -5.015967e-01, +1.734790e-07, -9.568876e-05, +9.227898e-11, -1.193326e-16, +8.000000e+08, +2.891397e+06, +5.764385e+06, +3.226327e+03, +8.398710e+03, +2.285695e+04 },
+    { +3.950000e+02, +8.637230e-04, +1.126474e+03, -3.931378e+04, +4.056434e+05, +1.096622e+06, +6.516647e+05, +3.252478e+03, +3.679568e+03, +1.157779e+03, -5.021163e-01, +1.739540e-07, -1.116462e-04, +9.769704e-11, -1.199898e-16, +8.000000e+08, +2.886489e+06, +5.748646e+06, +3.146672e+03, +8.217187e+03, +2.279507e+04 },
+    { +4.000000e+02, +8.656011e-04, +1.172732e+03, -4.656453e+04, +4.225283e+05, +1.115009e+06, +6.459164e+05, +3.241323e+03, +3.675475e+03, +1.155267e+03, -5.027085e-01, +1.744558e-07, -1.247968e-04, +1.030178e-10, -1.207084e-16, +8.000000e+08, +2.881580e+06, +5.732109e+06, +3.057459e+03, +8.043845e+03, +2.273427e+04 },
+    { +4.100000e+02, +8.693892e-04, +1.263400e+03, -6.177766e+04, +4.562165e+05, +1.151728e+06, +6.337337e+05, +3.219968e+03, +3.668510e+03, +1.150233e+03, -5.040585e-01, +1.755380e-07, -1.436558e-04, +1.133384e-10, -1.223212e-16, +8.000000e+08, +2.871507e+06, +5.696772e+06, +2.856120e+03, +7.720873e+03, +2.261457e+04 },
+    { +4.200000e+02, +8.732215e-04, +1.351733e+03, -7.792103e+04, +4.898070e+05, +1.188384e+06, +6.206562e+05, +3.199782e+03, +3.662956e+03, +1.145185e+03, -5.055538e-01, +1.767211e-07, -1.541667e-04, +1.232021e-10, -1.241544e-16, +8.000000e+08, +2.860744e+06, +5.658634e+06, +2.633130e+03, +7.427776e+03, +2.249557e+04 },
+    { +4.300000e+02, +8.770995e-04, +1.437871e+03, -9.497324e+04, +5.233113e+05, +1.224991e+06, +6.067064e+05, +3.180635e+03, +3.658567e+03, +1.140122e+03, -5.071198e-01, +1.780005e-07, -1.580543e-04, +1.325942e-10, -1.261933e-16, +8.000000e+08, +2.848980e+06, +5.617963e+06, +2.397801e+03, +7.162193e+03, +2.237552e+04 },
+    { +4.400000e+02, +8.810243e-04, +1.521939e+03, -1.129138e+05, +5.567392e+05, +1.261559e+06, +5.919056e+05, +3.162404e+03, +3.655118e+03, +1.135042e+03, -5.086978e-01, +1.793714e-07, -1.568065e-04, +1.415166e-10, -1.284252e-16, +8.000000e+08, +2.836003e+06, +5.575025e+06, +2.157734e+03, +6.921639e+03, +2.225310e+04 },
+    { +4.500000e+02, +8.849967e-04, +1.604048e+03, -1.317233e+05, +5.900983e+05, +1.298096e+06, +5.762741e+05, +3.144975e+03, +3.652411e+03, +1.129948e+03, -5.102430e-01, +1.808293e-07, -1.516649e-04, +1.499812e-10, -1.308387e-16, +8.000000e+08, +2.821684e+06, +5.530078e+06, +1.918883e+03, +6.703651e+03, +2.212738e+04 },
+    { +4.600000e+02, +8.890171e-04, +1.684300e+03, -1.513828e+05, +6.233951e+05, +1.334609e+06, +5.598309e+05, +3.128249e+03, +3.650276e+03, +1.124838e+03, -5.117215e-01, +1.823696e-07, -1.436410e-04, +1.580064e-10, -1.334243e-16, +8.000000e+08, +2.805959e+06, +5.483371e+06, +1.685729e+03, +6.505877e+03, +2.199773e+04 },
+    { +4.700000e+02, +8.930856e-04, +1.762784e+03, -1.718744e+05, +6.566342e+05, +1.371103e+06, +5.425940e+05, +3.112140e+03, +3.648570e+03, +1.119714e+03, -5.131089e-01, +1.839880e-07, -1.335441e-04, +1.656138e-10, -1.361735e-16, +8.000000e+08, +2.788817e+06, +5.435137e+06, +1.461514e+03, +6.326124e+03, +2.186373e+04 },
+    { +4.800000e+02, +8.972022e-04, +1.839584e+03, -1.931810e+05, +6.898194e+05, +1.407581e+06, +5.245808e+05, +3.096573e+03, +3.647173e+03, +1.114576e+03, -5.143877e-01, +1.856805e-07, -1.220117e-04, +1.728261e-10, -1.390790e-16, +8.000000e+08, +2.770283e+06, +5.385594e+06, +1.248460e+03, +6.162386e+03, +2.172514e+04 },
+    { +4.900000e+02, +9.013669e-04, +1.914774e+03, -2.152858e+05, +7.229534e+05, +1.444047e+06, +5.058077e+05, +3.081486e+03, +3.645986e+03, +1.109426e+03, -5.155460e-01, +1.874433e-07, -1.095388e-04, +1.796664e-10, -1.421343e-16, +8.000000e+08, +2.750411e+06, +5.334947e+06, +1.047985e+03, +6.012847e+03, +2.158188e+04 },
+    { +5.000000e+02, +9.055793e-04, +1.988422e+03, -2.381730e+05, +7.560379e+05, +1.480501e+06, +4.862905e+05, +3.066827e+03, +3.644929e+03, +1.104265e+03, -5.165766e-01, +1.892727e-07, -9.650478e-05, +1.861566e-10, -1.453336e-16, +8.000000e+08, +2.729272e+06, +5.283382e+06, +8.608733e+02, +5.875877e+03, +2.143395e+04 },
+    { +5.100000e+02, +9.098394e-04, +2.060591e+03, -2.618273e+05, +7.890741e+05, +1.516946e+06, +4.660442e+05, +3.052553e+03, +3.643937e+03, +1.099095e+03, -5.174752e-01, +1.911653e-07, -8.319584e-05, +1.923174e-10, -1.486719e-16, +8.000000e+08, +2.706951e+06, +5.231074e+06, +6.874350e+02, +5.750027e+03, +2.128146e+04 },
+    { +5.200000e+02, +9.141466e-04, +2.131340e+03, -2.862339e+05, +8.220628e+05, +1.553380e+06, +4.450834e+05, +3.038627e+03, +3.642958e+03, +1.093916e+03, -5.182403e-01, +1.931180e-07, -6.982451e-05, +1.981677e-10, -1.521443e-16, +8.000000e+08, +2.683542e+06, +5.178181e+06, +5.276225e+02, +5.634010e+03, +2.112455e+04 },
+    { +5.300000e+02, +9.185008e-04, +2.200722e+03, -3.113787e+05, +8.550041e+05, +1.589805e+06, +4.234219e+05, +3.025022e+03, +3.641953e+03, +1.088731e+03, -5.188720e-01, +1.951277e-07, -5.654530e-05, +2.037248e-10, -1.557467e-16, +8.000000e+08, +2.659141e+06, +5.124849e+06, +3.811307e+02, +5.526688e+03, +2.096342e+04 },
+    { +5.400000e+02, +9.229014e-04, +2.268788e+03, -3.372478e+05, +8.878979e+05, +1.626219e+06, +4.010733e+05, +3.011713e+03, +3.640890e+03, +1.083539e+03, -5.193719e-01, +1.971916e-07, -4.346756e-05, +2.090040e-10, -1.594751e-16, +8.000000e+08, +2.633844e+06, +5.071211e+06, +2.474746e+02, +5.427058e+03, +2.079830e+04 },
+    { +5.500000e+02, +9.273481e-04, +2.335585e+03, -3.638281e+05, +9.207438e+05, +1.662622e+06, +3.780504e+05, +2.998682e+03, +3.639747e+03, +1.078344e+03, -5.197423e-01, +1.993069e-07, -3.066581e-05, +2.140190e-10, -1.633256e-16, +8.000000e+08, +2.607749e+06, +5.017388e+06, +1.260481e+02, +5.334236e+03, +2.062943e+04 },
+    { +5.600000e+02, +9.318405e-04, +2.401157e+03, -3.911067e+05, +9.535412e+05, +1.699014e+06, +3.543657e+05, +2.985914e+03, +3.638506e+03, +1.073145e+03, -5.199863e-01, +2.014711e-07, -1.818804e-05, +2.187817e-10, -1.672947e-16, +8.000000e+08, +2.580947e+06, +4.963491e+06, +1.617090e+01, +5.247445e+03, +2.045709e+04 },
+    { +5.700000e+02, +9.363783e-04, +2.465545e+03, -4.190715e+05, +9.862893e+05, +1.735392e+06, +3.300312e+05, +2.973396e+03, +3.637156e+03, +1.067944e+03, -5.201072e-01, +2.036817e-07, -6.062209e-06, +2.233027e-10, -1.713787e-16, +8.000000e+08, +2.553529e+06, +4.909621e+06, -8.287748e+01, +5.165999e+03, +2.028153e+04 },
+    { +5.800000e+02, +9.409611e-04, +2.528789e+03, -4.477102e+05, +1.018987e+06, +1.771756e+06, +3.050586e+05, +2.961121e+03, +3.635690e+03, +1.062743e+03, -5.201087e-01, +2.059364e-07, +5.698565e-06, +2.275909e-10, -1.755743e-16, +8.000000e+08, +2.525580e+06, +4.855868e+06, -1.718318e+02, +5.089296e+03, +2.010304e+04 },
+    { +5.900000e+02, +9.455884e-04, +2.590926e+03, -4.770116e+05, +1.051635e+06, +1.808105e+06, +2.794591e+05, +2.949080e+03, +3.634102e+03, +1.057543e+03, -5.199945e-01, +2.082328e-07, +1.709193e-05, +2.316541e-10, -1.798779e-16, +8.000000e+08, +2.497179e+06, +4.802317e+06, -2.514223e+02, +5.016806e+03, +1.992189e+04 },
+    { +6.000000e+02, +9.502599e-04, +2.651991e+03, -5.069642e+05, +1.084230e+06, +1.844438e+06, +2.532437e+05, +2.937270e+03, +3.632393e+03, +1.052344e+03, -5.197681e-01, +2.105687e-07, +2.812313e-05, +2.354991e-10, -1.842861e-16, +8.000000e+08, +2.468401e+06, +4.749043e+06, -3.223616e+02, +4.948061e+03, +1.973836e+04 },
+    { +6.100000e+02, +9.549752e-04, +2.712017e+03, -5.375574e+05, +1.116773e+06, +1.880753e+06, +2.264228e+05, +2.925686e+03, +3.630561e+03, +1.047148e+03, -5.194332e-01, +2.129421e-07, +3.880256e-05, +2.391314e-10, -1.887954e-16, +8.000000e+08, +2.439317e+06, +4.696113e+06, -3.853351e+02, +4.882648e+03, +1.955271e+04 },
+    { +6.200000e+02, +9.597340e-04, +2.771036e+03, -5.687805e+05, +1.149262e+06, +1.917049e+06, +1.990067e+05, +2.914327e+03, +3.628610e+03, +1.041955e+03, -5.189932e-01, +2.153507e-07, +4.914384e-05, +2.425559e-10, -1.934021e-16, +8.000000e+08, +2.409991e+06, +4.643589e+06, -4.409954e+02, +4.820204e+03, +1.936522e+04 },
+    { +6.300000e+02, +9.645358e-04, +2.829078e+03, -6.006234e+05, +1.181696e+06, +1.953325e+06, +1.710053e+05, +2.903190e+03, +3.626543e+03, +1.036768e+03, -5.184514e-01, +2.177925e-07, +5.916238e-05, +2.457767e-10, -1.981026e-16, +8.000000e+08, +2.380483e+06, +4.591526e+06, -4.899586e+02, +4.760406e+03, +1.917615e+04 },
+    { +6.400000e+02, +9.693805e-04, +2.886173e+03, -6.330761e+05, +1.214075e+06, +1.989579e+06, +1.424283e+05, +2.892275e+03, +3.624364e+03, +1.031587e+03, -5.178109e-01, +2.202655e-07, +6.887425e-05, +2.487975e-10, -2.028931e-16, +8.000000e+08, +2.350849e+06, +4.539975e+06, -5.328022e+02, +4.702970e+03, +1.898575e+04 },
+    { +6.500000e+02, +9.742674e-04, +2.942349e+03, -6.661291e+05, +1.246398e+06, +2.025812e+06, +1.132849e+05, +2.881581e+03, +3.622079e+03, +1.026412e+03, -5.170749e-01, +2.227678e-07, +7.829540e-05, +2.516212e-10, -2.077699e-16, +8.000000e+08, +2.321138e+06, +4.488979e+06, -5.700650e+02, +4.647641e+03, +1.879427e+04 },
+    { +6.750000e+02, +9.866680e-04, +3.078934e+03, -7.513267e+05, +1.326954e+06, +2.116288e+06, +3.800765e+04, +2.855814e+03, +3.615935e+03, +1.013512e+03, -5.148344e-01, +2.291385e-07, +1.006731e-04, +2.578355e-10, -2.203130e-16, +8.000000e+08, +2.246826e+06, +4.364173e+06, -6.419965e+02, +4.517130e+03, +1.831242e+04 },
+    { +7.000000e+02, +9.993255e-04, +3.210318e+03, -8.400788e+05, +1.407143e+06, +2.206604e+06, -4.061846e+04, +2.831435e+03, +3.609250e+03, +1.000675e+03, -5.120539e-01, +2.356498e-07, +1.215260e-04, +2.628718e-10, -2.333062e-16, +8.000000e+08, +2.172945e+06, +4.243586e+06, -6.888972e+02, +4.395573e+03, +1.782893e+04 },
+    { +7.250000e+02, +1.012234e-03, +3.336848e+03, -9.322551e+05, +1.486959e+06, +2.296747e+06, -1.224678e+05, +2.808449e+03, +3.602116e+03, +9.879137e+02, -5.087696e-01, +2.422726e-07, +1.409917e-04, +2.667657e-10, -2.466831e-16, +8.000000e+08, +2.099989e+06, +4.127582e+06, -7.163039e+02, +4.280804e+03, +1.734709e+04 },
+    { +7.500000e+02, +1.025388e-03, +3.458840e+03, -1.027734e+06, +1.566396e+06, +2.386707e+06, -2.074230e+05, +2.786860e+03, +3.594623e+03, +9.752404e+02, -5.050152e-01, +2.489789e-07, +1.591435e-04, +2.695570e-10, -2.603752e-16, +8.000000e+08, +2.028346e+06, +4.016405e+06, -7.286598e+02, +4.171189e+03, +1.686989e+04 },
+    { +7.750000e+02, +1.038781e-03, +3.576581e+03, -1.126399e+06, +1.645451e+06, +2.476476e+06, -2.953744e+05, +2.766662e+03, +3.586858e+03, +9.626666e+02, -5.008232e-01, +2.557416e-07, +1.759998e-04, +2.712943e-10, -2.743139e-16, +8.000000e+08, +1.958317e+06, +3.910196e+06, -7.295062e+02, +4.065502e+03, +1.639999e+04 },
+    { +8.000000e+02, +1.052407e-03, +3.690333e+03, -1.228145e+06, +1.724122e+06, +2.566048e+06, -3.862188e+05, +2.747846e+03, +3.578900e+03, +9.502026e+02, -4.962262e-01, +2.625353e-07, +1.915393e-04, +2.720365e-10, -2.884315e-16, +8.000000e+08, +1.890132e+06, +3.809012e+06, -7.216527e+02, +3.962828e+03, +1.593969e+04 },
+    { +8.250000e+02, +1.066259e-03, +3.800339e+03, -1.332867e+06, +1.802412e+06, +2.655420e+06, -4.798598e+05, +2.730391e+03, +3.570825e+03, +9.378583e+02, -4.912576e-01, +2.693357e-07, +2.057191e-04, +2.718524e-10, -3.026628e-16, +8.000000e+08, +1.823960e+06, +3.712838e+06, -7.073225e+02, +3.862500e+03, +1.549092e+04 },
+    { +8.500000e+02, +1.080331e-03, +3.906818e+03, -1.440471e+06, +1.880324e+06, +2.744589e+06, -5.762064e+05, +2.714270e+03, +3.562707e+03, +9.256426e+02, -4.859520e-01, +2.761208e-07, +2.184911e-04, +2.708186e-10, -3.169453e-16, +8.000000e+08, +1.759925e+06, +3.621603e+06, -6.882700e+02, +3.764051e+03, +1.505521e+04 },
+    { +9.000000e+02, +1.109105e-03, +4.109999e+03, -1.663963e+06, +2.035036e+06, +2.922320e+06, -7.766790e+05, +2.685891e+03, +3.546616e+03, +9.016275e+02, -4.744733e-01, +2.895658e-07, +2.396855e-04, +2.665233e-10, -3.454275e-16, +8.000000e+08, +1.638568e+06, +3.453446e+06, -6.412317e+02, +3.571721e+03, +1.422705e+04 },
+    { +9.500000e+02, +1.138679e-03, +4.301336e+03, -1.897952e+06, +2.188317e+06, +3.099261e+06, -9.870090e+05, +2.662372e+03, +3.531134e+03, +8.782105e+02, -4.620794e-01, +3.027321e-07, +2.551394e-04, +2.597601e-10, -3.734201e-16, +8.000000e+08, +1.526364e+06, +3.303251e+06, -5.883980e+02, +3.384900e+03, +1.345929e+04 },
+    { +1.000000e+03, +1.169002e-03, +4.482087e+03, -2.141838e+06, +2.340249e+06, +3.275451e+06, -1.206636e+06, +2.643306e+03, +3.516683e+03, +8.554302e+02, -4.490463e-01, +3.155085e-07, +2.653905e-04, +2.509856e-10, -4.004498e-16, +8.000000e+08, +1.423246e+06, +3.169487e+06, -5.345532e+02, +3.204090e+03, +1.275014e+04 },
+    { +1.050000e+03, +1.200030e-03, +4.653344e+03, -2.395084e+06, +2.490927e+06, +3.450951e+06, -1.435060e+06, +2.628248e+03, +3.503554e+03, +8.333125e+02, -4.356104e-01, +3.278008e-07, +2.714468e-04, +2.404103e-10, -4.259664e-16, +8.000000e+08, +1.328888e+06, +3.050633e+06, -4.825229e+02, +3.030627e+03, +1.209331e+04 },
+    { +1.100000e+03, +1.231720e-03, +4.816054e+03, -2.657204e+06, +2.640455e+06, +3.625831e+06, -1.671828e+06, +2.616739e+03, +3.491875e+03, +8.118729e+02, -4.219505e-01, +3.395189e-07, +2.745713e-04, +2.279919e-10, -4.492992e-16, +8.000000e+08, +1.242789e+06, +2.945344e+06, -4.338762e+02, +2.866171e+03, +1.148005e+04 },
+    { +1.150000e+03, +1.264032e-03, +4.971042e+03, -2.927762e+06, +2.788937e+06, +3.800162e+06, -1.916536e+06, +2.608324e+03, +3.481599e+03, +7.911193e+02, -4.081813e-01, +3.505657e-07, +2.760087e-04, +2.135169e-10, -4.696605e-16, +8.000000e+08, +1.164350e+06, +2.852532e+06, -3.893747e+02, +2.712306e+03, +1.090123e+04 },
+    { +1.200000e+03, +1.296923e-03, +5.119022e+03, -3.206355e+06, +2.936472e+06, +3.974011e+06, -2.168816e+06, +2.602575e+03, +3.472521e+03, +7.710556e+02, -3.943610e-01, +3.608322e-07, +2.767471e-04, +1.967412e-10, -4.862098e-16, +8.000000e+08, +1.092921e+06, +2.771372e+06, -3.492656e+02, +2.570262e+03, +1.034923e+04 },
+    { +1.250000e+03, +1.330347e-03, +5.260609e+03, -3.492609e+06, +3.083151e+06, +4.147429e+06, -2.428332e+06, +2.599092e+03, +3.464323e+03, +7.516837e+02, -3.805082e-01, +3.701994e-07, +2.773720e-04, +1.775467e-10, -4.981733e-16, +8.000000e+08, +1.027847e+06, +2.701247e+06, -3.134770e+02, +2.440751e+03, +9.819138e+03 },
+    { +1.273000e+03, +1.345885e-03, +5.323740e+03, -3.626763e+06, +3.150359e+06, +4.227067e+06, -2.550054e+06, +2.598150e+03, +3.460743e+03, +7.430054e+02, -3.741252e-01, +3.741733e-07, +2.776773e-04, +1.679301e-10, -5.019707e-16, +8.000000e+08, +9.998714e+05, +2.672559e+06, -2.983983e+02, +2.385447e+03, +9.582085e+03 },
+    // P = 1000 MPa
+    { +3.002430e+02, +8.081520e-04, +3.014136e+01, +6.778406e+04, +7.683379e+04, +8.849858e+05, +8.759360e+05, +3.417881e+03, +3.769726e+03, +1.237391e+03, -5.165677e-01, +1.487173e-07, +5.609229e-04, +1.552293e-11, -9.049171e-17, +1.000000e+09, +3.473489e+06, +6.724169e+06, +2.844548e+03, +1.351003e+04, +2.751216e+04 },
+    { +3.050000e+02, +8.097559e-04, +8.952776e+01, +6.589524e+04, +9.320120e+04, +9.029571e+05, +8.756511e+05, +3.429605e+03, +3.784525e+03, +1.234940e+03, -5.138889e-01, +1.488046e-07, +5.646725e-04, +2.088574e-11, -9.024253e-17, +1.000000e+09, +3.453449e+06, +6.720225e+06, +2.468554e+03, +1.313123e+04, +2.738815e+04 },
+    { +3.100000e+02, +8.114395e-04, +1.511345e+02, +6.360955e+04, +1.104613e+05, +9.219008e+05, +8.750491e+05, +3.433742e+03, +3.791739e+03, +1.232378e+03, -5.110681e-01, +1.489198e-07, +5.622843e-04, +2.501796e-11, -8.997243e-17, +1.000000e+09, +3.431835e+06, +6.715024e+06, +2.186747e+03, +1.279484e+04, +2.724282e+04 },
+    { +3.150000e+02, +8.131209e-04, +2.118181e+02, +6.102037e+04, +1.277431e+05, +9.408640e+05, +8.741413e+05, +3.431675e+03, +3.792658e+03, +1.229829e+03, -5.082805e-01, +1.490532e-07, +5.512792e-04, +2.823700e-11, -8.970743e-17, +1.000000e+09, +3.410061e+06, +6.709013e+06, +2.008042e+03, +1.249820e+04, +2.708971e+04 },
+    { +3.200000e+02, +8.148002e-04, +2.715229e+02, +5.813236e+04, +1.450197e+05, +9.598199e+05, +8.729325e+05, +3.425115e+03, +3.789065e+03, +1.227295e+03, -5.055697e-01, +1.492014e-07, +5.317306e-04, +3.096984e-11, -8.945857e-17, +1.000000e+09, +3.388505e+06, +6.702351e+06, +1.913836e+03, +1.222588e+04, +2.693417e+04 },
+    { +3.250000e+02, +8.164775e-04, +3.302206e+02, +5.495024e+04, +1.622719e+05, +9.787495e+05, +8.714278e+05, +3.415371e+03, +3.782335e+03, +1.224773e+03, -5.029755e-01, +1.493626e-07, +5.048552e-04, +3.349340e-11, -8.923456e-17, +1.000000e+09, +3.367480e+06, +6.695118e+06, +1.884548e+03, +1.196827e+04, +2.677982e+04 },
+    { +3.300000e+02, +8.181533e-04, +3.879022e+02, +5.147869e+04, +1.794864e+05, +9.976398e+05, +8.696320e+05, +3.403437e+03, +3.773519e+03, +1.222265e+03, -5.005305e-01, +1.495363e-07, +4.723342e-04, +3.598077e-11, -8.904205e-17, +1.000000e+09, +3.347219e+06, +6.687342e+06, +1.901951e+03, +1.171957e+04, +2.662905e+04 },
+    { +3.350000e+02, +8.198281e-04, +4.445734e+02, +4.772230e+04, +1.966544e+05, +1.016483e+06, +8.675504e+05, +3.390065e+03, +3.763412e+03, +1.219768e+03, -4.982586e-01, +1.497225e-07, +4.359247e-04, +3.853395e-11, -8.888604e-17, +1.000000e+09, +3.327881e+06, +6.679023e+06, +1.950253e+03, +1.147657e+04, +2.648332e+04 },
+    { +3.400000e+02, +8.215024e-04, +5.002494e+02, +4.368554e+04, +2.137703e+05, +1.035273e+06, +8.651880e+05, +3.375817e+03, +3.752609e+03, +1.217282e+03, -4.961750e-01, +1.499218e-07, +3.972522e-04, +4.120697e-11, -8.877009e-17, +1.000000e+09, +3.309559e+06, +6.670144e+06, +2.016444e+03, +1.123762e+04, +2.634343e+04 },
+    { +3.450000e+02, +8.231769e-04, +5.549525e+02, +3.937271e+04, +2.308313e+05, +1.054008e+06, +8.625496e+05, +3.361113e+03, +3.741550e+03, +1.214806e+03, -4.942875e-01, +1.501348e-07, +3.577136e-04, +4.402217e-11, -8.869662e-17, +1.000000e+09, +3.292291e+06, +6.660681e+06, +2.090238e+03, +1.100212e+04, +2.620975e+04 },
+    { +3.500000e+02, +8.248520e-04, +6.087096e+02, +3.478798e+04, +2.478363e+05, +1.072688e+06, +8.596400e+05, +3.346259e+03, +3.730555e+03, +1.212339e+03, -4.925974e-01, +1.503623e-07, +3.184454e-04, +4.698161e-11, -8.866712e-17, +1.000000e+09, +3.276071e+06, +6.650605e+06, +2.163819e+03, +1.077006e+04, +2.608231e+04 },
+    { +3.550000e+02, +8.265286e-04, +6.615499e+02, +2.993539e+04, +2.647856e+05, +1.091314e+06, +8.564640e+05, +3.331477e+03, +3.719848e+03, +1.209879e+03, -4.911011e-01, +1.506048e-07, +2.803295e-04, +5.007489e-11, -8.868235e-17, +1.000000e+09, +3.260859e+06, +6.639893e+06, +2.231491e+03, +1.054173e+04, +2.596094e+04 },
+    { +3.600000e+02, +8.282072e-04, +7.135044e+02, +2.481880e+04, +2.816804e+05, +1.109888e+06, +8.530260e+05, +3.316925e+03, +3.709587e+03, +1.207427e+03, -4.897911e-01, +1.508632e-07, +2.440170e-04, +5.328461e-11, -8.874249e-17, +1.000000e+09, +3.246591e+06, +6.628522e+06, +2.289316e+03, +1.031762e+04, +2.584531e+04 },
+    { +3.650000e+02, +8.298884e-04, +7.646044e+02, +1.944196e+04, +2.985226e+05, +1.128411e+06, +8.493304e+05, +3.302710e+03, +3.699872e+03, +1.204981e+03, -4.886572e-01, +1.511378e-07, +2.099612e-04, +5.658990e-11, -8.884729e-17, +1.000000e+09, +3.233189e+06, +6.616476e+06, +2.334776e+03, +1.009822e+04, +2.573502e+04 },
+    { +3.700000e+02, +8.315728e-04, +8.148811e+02, +1.380849e+04, +3.153145e+05, +1.146887e+06, +8.453813e+05, +3.288903e+03, +3.690763e+03, +1.202540e+03, -4.876873e-01, +1.514292e-07, +1.784512e-04, +5.996888e-11, -8.899614e-17, +1.000000e+09, +3.220562e+06, +6.603745e+06, +2.366464e+03, +9.884028e+03, +2.562962e+04 },
+    { +3.750000e+02, +8.332610e-04, +8.643648e+02, +7.921872e+03, +3.320587e+05, +1.165320e+06, +8.411829e+05, +3.275546e+03, +3.682291e+03, +1.200104e+03, -4.868682e-01, +1.517376e-07, +1.496449e-04, +6.340009e-11, -8.918822e-17, +1.000000e+09, +3.208619e+06, +6.590323e+06, +2.383820e+03, +9.675466e+03, +2.552864e+04 },
+    { +3.800000e+02, +8.349534e-04, +9.130852e+02, +1.785505e+03, +3.487579e+05, +1.183711e+06, +8.367389e+05, +3.262661e+03, +3.674464e+03, +1.197672e+03, -4.861862e-01, +1.520633e-07, +1.235976e-04, +6.686345e-11, -8.942252e-17, +1.000000e+09, +3.197262e+06, +6.576210e+06, +2.386921e+03, +9.472887e+03, +2.543161e+04 },
+    { +3.850000e+02, +8.366506e-04, +9.610705e+02, -4.597337e+03, +3.654148e+05, +1.202065e+06, +8.320533e+05, +3.250256e+03, +3.667272e+03, +1.195242e+03, -4.856276e-01, +1.524063e-07, +1.002871e-04, +7.034071e-11, -8.969792e-17, +1.000000e+09, +3.186402e+06, +6.561409e+06, +2.376295e+03, +9.276558e+03, +2.533808e+04 },
+    { +3.900000e+02, +8.383529e-04, +1.008348e+03, -1.122347e+04, +3.820322e+05, +1.220385e+06, +8.271294e+05, +3.238327e+03, +3.660697e+03, +1.192815e+03, -4.851789e-01, +1.527667e-07, +7.963438e-05, +7.381568e-11, -9.001321e-17, +1.000000e+09, +3.175947e+06, +6.545930e+06, +2.352785e+03, +9.086667e+03, +2.524762e+04 },
+    { +3.950000e+02, +8.400607e-04, +1.054943e+03, -1.808981e+04, +3.986126e+05, +1.238673e+06, +8.219709e+05, +3.226860e+03, +3.654710e+03, +1.190390e+03, -4.848270e-01, +1.531444e-07, +6.152024e-05, +7.727431e-11, -9.036717e-17, +1.000000e+09, +3.165816e+06, +6.529784e+06, +2.317437e+03, +8.903324e+03, +2.515980e+04 },
+    { +4.000000e+02, +8.417744e-04, +1.100880e+03, -2.519335e+04, +4.151586e+05, +1.256933e+06, +8.165811e+05, +3.215840e+03, +3.649278e+03, +1.187967e+03, -4.845597e-01, +1.535394e-07, +4.579907e-05, +8.070456e-11, -9.075856e-17, +1.000000e+09, +3.155931e+06, +6.512987e+06, +2.271412e+03, +8.726574e+03, +2.507427e+04 },
+    { +4.100000e+02, +8.452207e-04, +1.190871e+03, -4.010041e+04, +4.481568e+05, +1.293378e+06, +8.051203e+05, +3.195055e+03, +3.639933e+03, +1.183123e+03, -4.842332e-01, +1.543803e-07, +2.088067e-05, +8.744125e-11, -9.164866e-17, +1.000000e+09, +3.136626e+06, +6.477512e+06, +2.152197e+03, +8.392739e+03, +2.490869e+04 },
+    { +4.200000e+02, +8.486937e-04, +1.278491e+03, -5.592218e+04, +4.810439e+05, +1.329738e+06, +7.927716e+05, +3.175786e+03, +3.632364e+03, +1.178281e+03, -4.841169e-01, +1.552875e-07, +3.523686e-06, +9.396466e-11, -9.267395e-17, +1.000000e+09, +3.117553e+06, +6.439669e+06, +2.004716e+03, +8.084499e+03, +2.474847e+04 },
+    { +4.300000e+02, +8.521952e-04, +1.363888e+03, -7.263728e+04, +5.138346e+05, +1.366030e+06, +7.795579e+05, +3.157843e+03, +3.626276e+03, +1.173440e+03, -4.841419e-01, +1.562587e-07, -7.598257e-06, +1.002358e-10, -9.382544e-17, +1.000000e+09, +3.098336e+06, +6.399643e+06, +1.837751e+03, +7.800656e+03, +2.459167e+04 },
+    { +4.400000e+02, +8.557261e-04, +1.447196e+03, -9.022534e+04, +5.465411e+05, +1.402267e+06, +7.655008e+05, +3.141045e+03, +3.621398e+03, +1.168598e+03, -4.842521e-01, +1.572913e-07, -1.369354e-05, +1.062323e-10, -9.509491e-17, +1.000000e+09, +3.078696e+06, +6.357631e+06, +1.658861e+03, +7.539689e+03, +2.443674e+04 },
+    { +4.500000e+02, +8.592874e-04, +1.528534e+03, -1.086669e+05, +5.791735e+05, +1.438461e+06, +7.506205e+05, +3.125227e+03, +3.617488e+03, +1.163755e+03, -4.844026e-01, +1.583824e-07, -1.581539e-05, +1.119440e-10, -9.647487e-17, +1.000000e+09, +3.058437e+06, +6.313833e+06, +1.474262e+03, +7.299915e+03, +2.428250e+04 },
+    { +4.600000e+02, +8.628797e-04, +1.608007e+03, -1.279434e+05, +6.117398e+05, +1.474619e+06, +7.349363e+05, +3.110246e+03, +3.614338e+03, +1.158910e+03, -4.845582e-01, +1.595292e-07, -1.485456e-05, +1.173693e-10, -9.795859e-17, +1.000000e+09, +3.037426e+06, +6.268445e+06, +1.288886e+03, +7.079595e+03, +2.412803e+04 },
+    { +4.700000e+02, +8.665032e-04, +1.685709e+03, -1.480369e+05, +6.442465e+05, +1.510750e+06, +7.184663e+05, +3.095976e+03, +3.611770e+03, +1.154064e+03, -4.846919e-01, +1.607288e-07, -1.154809e-05, +1.225122e-10, -9.954000e-17, +1.000000e+09, +3.015587e+06, +6.221658e+06, +1.106515e+03, +6.877020e+03, +2.397265e+04 },
+    { +4.800000e+02, +8.701581e-04, +1.761726e+03, -1.689304e+05, +6.766982e+05, +1.546856e+06, +7.012277e+05, +3.082313e+03, +3.609635e+03, +1.149216e+03, -4.847833e-01, +1.619785e-07, -6.495492e-06, +1.273806e-10, -1.012136e-16, +1.000000e+09, +2.992886e+06, +6.173657e+06, +9.299491e+02, +6.690550e+03, +2.381588e+04 },
+    { +4.900000e+02, +8.738445e-04, +1.836135e+03, -1.906074e+05, +7.090989e+05, +1.582943e+06, +6.832371e+05, +3.069168e+03, +3.607809e+03, +1.144368e+03, -4.848176e-01, +1.632756e-07, -1.775954e-07, +1.319846e-10, -1.029746e-16, +1.000000e+09, +2.969321e+06, +6.124615e+06, +7.611774e+02, +6.518646e+03, +2.365737e+04 },
+    { +5.000000e+02, +8.775622e-04, +1.909006e+03, -2.130521e+05, +7.414510e+05, +1.619013e+06, +6.645101e+05, +3.056467e+03, +3.606194e+03, +1.139520e+03, -4.847839e-01, +1.646174e-07, +7.024683e-06, +1.363354e-10, -1.048184e-16, +1.000000e+09, +2.944913e+06, +6.074693e+06, +6.015341e+02, +6.359886e+03, +2.349690e+04 },
+    { +5.100000e+02, +8.813112e-04, +1.980403e+03, -2.362493e+05, +7.737564e+05, +1.655068e+06, +6.450619e+05, +3.044151e+03, +3.604706e+03, +1.134673e+03, -4.846751e-01, +1.660015e-07, +1.481309e-05, +1.404447e-10, -1.067410e-16, +1.000000e+09, +2.919704e+06, +6.024043e+06, +4.518365e+02, +6.212967e+03, +2.333434e+04 },
+    { +5.200000e+02, +8.850912e-04, +2.050386e+03, -2.601844e+05, +8.060164e+05, +1.691108e+06, +6.249068e+05, +3.032169e+03, +3.603281e+03, +1.129827e+03, -4.844865e-01, +1.674255e-07, +2.295685e-05, +1.443241e-10, -1.087388e-16, +1.000000e+09, +2.893744e+06, +5.972805e+06, +3.125008e+02, +6.076706e+03, +2.316965e+04 },
+    { +5.300000e+02, +8.889019e-04, +2.119009e+03, -2.848432e+05, +8.382314e+05, +1.727133e+06, +6.040587e+05, +3.020484e+03, +3.601869e+03, +1.124984e+03, -4.842154e-01, +1.688872e-07, +3.127962e-05, +1.479850e-10, -1.108082e-16, +1.000000e+09, +2.867093e+06, +5.921111e+06, +1.836392e+02, +5.950035e+03, +2.300283e+04 },
+    { +5.400000e+02, +8.927431e-04, +2.186322e+03, -3.102121e+05, +8.704017e+05, +1.763145e+06, +5.825310e+05, +3.009063e+03, +3.600430e+03, +1.120143e+03, -4.838608e-01, +1.703845e-07, +3.964863e-05, +1.514381e-10, -1.129460e-16, +1.000000e+09, +2.839816e+06, +5.869078e+06, +6.513744e+01, +5.831992e+03, +2.283392e+04 },
+    { +5.500000e+02, +8.966145e-04, +2.252373e+03, -3.362780e+05, +9.025273e+05, +1.799142e+06, +5.603365e+05, +2.997881e+03, +3.598935e+03, +1.115307e+03, -4.834226e-01, +1.719153e-07, +4.796561e-05, +1.546932e-10, -1.151494e-16, +1.000000e+09, +2.811981e+06, +5.816817e+06, -4.328212e+01, +5.721715e+03, +2.266301e+04 },
+    { +5.600000e+02, +9.005156e-04, +2.317207e+03, -3.630281e+05, +9.346076e+05, +1.835123e+06, +5.374876e+05, +2.986919e+03, +3.597361e+03, +1.110475e+03, -4.829019e-01, +1.734778e-07, +5.615951e-05, +1.577595e-10, -1.174153e-16, +1.000000e+09, +2.783653e+06, +5.764428e+06, -1.420117e+02, +5.618431e+03, +2.249021e+04 },
+    { +5.700000e+02, +9.044463e-04, +2.380864e+03, -3.904501e+05, +9.666423e+05, +1.871089e+06, +5.139963e+05, +2.976162e+03, +3.595694e+03, +1.105649e+03, -4.823000e-01, +1.750699e-07, +6.418045e-05, +1.606455e-10, -1.197413e-16, +1.000000e+09, +2.754899e+06, +5.712003e+06, -2.315195e+02, +5.521451e+03, +2.231563e+04 },
+    { +5.800000e+02, +9.084062e-04, +2.443384e+03, -4.185321e+05, +9.986306e+05, +1.907037e+06, +4.898741e+05, +2.965600e+03, +3.593923e+03, +1.100829e+03, -4.816189e-01, +1.766901e-07, +7.199495e-05, +1.633588e-10, -1.221245e-16, +1.000000e+09, +2.725784e+06, +5.659627e+06, -3.123202e+02, +5.430158e+03, +2.213942e+04 },
+    { +5.900000e+02, +9.123949e-04, +2.504804e+03, -4.472626e+05, +1.030572e+06, +1.942967e+06, +4.651323e+05, +2.955223e+03, +3.592043e+03, +1.096017e+03, -4.808609e-01, +1.783365e-07, +7.958205e-05, +1.659063e-10, -1.245626e-16, +1.000000e+09, +2.696367e+06, +5.607376e+06, -3.849529e+02, +5.344001e+03, +2.196173e+04 },
+    { +6.000000e+02, +9.164121e-04, +2.565160e+03, -4.766305e+05, +1.062465e+06, +1.978877e+06, +4.397816e+05, +2.945028e+03, +3.590050e+03, +1.091212e+03, -4.800281e-01, +1.800077e-07, +8.693027e-05, +1.682942e-10, -1.270530e-16, +1.000000e+09, +2.666709e+06, +5.555318e+06, -4.499639e+02, +5.262488e+03, +2.178270e+04 },
+    { +6.100000e+02, +9.204574e-04, +2.624483e+03, -5.066249e+05, +1.094310e+06, +2.014767e+06, +4.138325e+05, +2.935009e+03, +3.587946e+03, +1.086416e+03, -4.791231e-01, +1.817019e-07, +9.403518e-05, +1.705282e-10, -1.295933e-16, +1.000000e+09, +2.636863e+06, +5.503519e+06, -5.078946e+02, +5.185179e+03, +2.160251e+04 },
+    { +6.200000e+02, +9.245306e-04, +2.682807e+03, -5.372354e+05, +1.126105e+06, +2.050636e+06, +3.872952e+05, +2.925164e+03, +3.585733e+03, +1.081630e+03, -4.781482e-01, +1.834177e-07, +1.008975e-04, +1.726132e-10, -1.321812e-16, +1.000000e+09, +2.606881e+06, +5.452035e+06, -5.592729e+02, +5.111681e+03, +2.142130e+04 },
+    { +6.300000e+02, +9.286313e-04, +2.740162e+03, -5.684517e+05, +1.157850e+06, +2.086482e+06, +3.601796e+05, +2.915494e+03, +3.583414e+03, +1.076854e+03, -4.771059e-01, +1.851537e-07, +1.075214e-04, +1.745538e-10, -1.348143e-16, +1.000000e+09, +2.576810e+06, +5.400918e+06, -6.046069e+02, +5.041642e+03, +2.123923e+04 },
+    { +6.400000e+02, +9.327592e-04, +2.796576e+03, -6.002641e+05, +1.189545e+06, +2.122304e+06, +3.324951e+05, +2.905997e+03, +3.580994e+03, +1.072088e+03, -4.759985e-01, +1.869084e-07, +1.139137e-04, +1.763542e-10, -1.374902e-16, +1.000000e+09, +2.546695e+06, +5.350216e+06, -6.443809e+02, +4.974747e+03, +2.105647e+04 },
+    { +6.500000e+02, +9.369140e-04, +2.852077e+03, -6.326628e+05, +1.221187e+06, +2.158101e+06, +3.042511e+05, +2.896675e+03, +3.578479e+03, +1.067334e+03, -4.748284e-01, +1.886803e-07, +1.200826e-04, +1.780180e-10, -1.402066e-16, +1.000000e+09, +2.516576e+06, +5.299969e+06, -6.790529e+02, +4.910711e+03, +2.087318e+04 },
+    { +6.750000e+02, +9.474163e-04, +2.987007e+03, -7.161649e+05, +1.300065e+06, +2.247481e+06, +2.312514e+05, +2.874141e+03, +3.571819e+03, +1.055502e+03, -4.716424e-01, +1.931773e-07, +1.345880e-04, +1.816016e-10, -1.471594e-16, +1.000000e+09, +2.441500e+06, +5.176593e+06, -7.461675e+02, +4.761529e+03, +2.041362e+04 },
+    { +7.000000e+02, +9.580796e-04, +3.116778e+03, -8.031358e+05, +1.378609e+06, +2.336688e+06, +1.549437e+05, +2.852727e+03, +3.564711e+03, +1.043755e+03, -4.681089e-01, +1.977539e-07, +1.478972e-04, +1.843989e-10, -1.543140e-16, +1.000000e+09, +2.367129e+06, +5.056791e+06, -7.899781e+02, +4.625369e+03, +1.995403e+04 },
+    { +7.250000e+02, +9.688989e-04, +3.241739e+03, -8.934463e+05, +1.456815e+06, +2.425714e+06, +7.545260e+04, +2.832460e+03, +3.557262e+03, +1.032099e+03, -4.642564e-01, +2.023910e-07, +1.601357e-04, +1.864510e-10, -1.616342e-16, +1.000000e+09, +2.293859e+06, +4.940931e+06, -8.154271e+02, +4.499648e+03, +1.949664e+04 },
+    { +7.500000e+02, +9.798693e-04, +3.362207e+03, -9.869751e+05, +1.534680e+06, +2.514550e+06, -7.105784e+03, +2.813359e+03, +3.549572e+03, +1.020544e+03, -4.601103e-01, +2.070705e-07, +1.713982e-04, +1.877969e-10, -1.690839e-16, +1.000000e+09, +2.221998e+06, +4.829273e+06, -8.265448e+02, +4.382349e+03, +1.904353e+04 },
+    { +7.750000e+02, +9.909858e-04, +3.478469e+03, -1.083609e+06, +1.612205e+06, +2.603191e+06, -9.262272e+04, +2.795438e+03, +3.541729e+03, +1.009096e+03, -4.556941e-01, +2.117753e-07, +1.817463e-04, +1.884767e-10, -1.766282e-16, +1.000000e+09, +2.151781e+06, +4.721986e+06, -8.265848e+02, +4.271881e+03, +1.859663e+04 },
+    { +8.000000e+02, +1.002243e-03, +3.590790e+03, -1.183240e+06, +1.689392e+06, +2.691635e+06, -1.809964e+05, +2.778701e+03, +3.533814e+03, +9.977616e+02, -4.510303e-01, +2.164892e-07, +1.912119e-04, +1.885334e-10, -1.842337e-16, +1.000000e+09, +2.083385e+06, +4.619169e+06, -8.181568e+02, +4.166984e+03, +1.815769e+04 },
+    { +8.250000e+02, +1.013637e-03, +3.699410e+03, -1.285768e+06, +1.766245e+06, +2.779882e+06, -2.721314e+05, +2.763142e+03, +3.525893e+03, +9.865465e+02, -4.461408e-01, +2.211972e-07, +1.998037e-04, +1.880138e-10, -1.918690e-16, +1.000000e+09, +2.016937e+06, +4.520854e+06, -8.033440e+02, +4.066656e+03, +1.772827e+04 },
+    { +8.500000e+02, +1.025161e-03, +3.804551e+03, -1.391099e+06, +1.842769e+06, +2.867930e+06, -3.659379e+05, +2.748745e+03, +3.518028e+03, +9.754563e+02, -4.410475e-01, +2.258855e-07, +2.075148e-04, +1.869686e-10, -1.995056e-16, +1.000000e+09, +1.952527e+06, +4.427022e+06, -7.838040e+02, +3.970101e+03, +1.730972e+04 },
+    { +9.000000e+02, +1.048582e-03, +4.005198e+03, -1.609815e+06, +1.994863e+06, +3.043445e+06, -5.612331e+05, +2.723345e+03, +3.502662e+03, +9.536690e+02, -4.303385e-01, +2.351546e-07, +2.202376e-04, +1.835210e-10, -2.146828e-16, +1.000000e+09, +1.830024e+06, +4.252521e+06, -7.355302e+02, +3.785937e+03, +1.650961e+04 },
+    { +9.500000e+02, +1.072465e-03, +4.194182e+03, -1.838728e+06, +2.145745e+06, +3.218209e+06, -7.662634e+05, +2.702242e+03, +3.488063e+03, +9.324315e+02, -4.190849e-01, +2.442137e-07, +2.292954e-04, +1.786407e-10, -2.295967e-16, +1.000000e+09, +1.716058e+06, +4.094774e+06, -6.808872e+02, +3.610988e+03, +1.576361e+04 },
+    { +1.000000e+03, +1.096772e-03, +4.372747e+03, -2.077250e+06, +2.295497e+06, +3.392269e+06, -9.804777e+05, +2.685103e+03, +3.474504e+03, +9.117665e+02, -4.074690e-01, +2.530020e-07, +2.347567e-04, +1.727560e-10, -2.441193e-16, +1.000000e+09, +1.610537e+06, +3.952538e+06, -6.245513e+02, +3.443323e+03, +1.507406e+04 },
+    { +1.050000e+03, +1.121469e-03, +4.541965e+03, -2.324851e+06, +2.444212e+06, +3.565681e+06, -1.203382e+06, +2.671550e+03, +3.462195e+03, +8.916878e+02, -3.956643e-01, +2.614784e-07, +2.369202e-04, +1.662157e-10, -2.581430e-16, +1.000000e+09, +1.513181e+06, +3.824407e+06, -5.693570e+02, +3.282116e+03, +1.443952e+04 },
+    { +1.100000e+03, +1.146525e-03, +4.702769e+03, -2.581059e+06, +2.591986e+06, +3.738512e+06, -1.434534e+06, +2.661188e+03, +3.451277e+03, +8.722007e+02, -3.838234e-01, +2.696165e-07, +2.363036e-04, +1.592484e-10, -2.715536e-16, +1.000000e+09, +1.423590e+06, +3.708971e+06, -5.169550e+02, +3.127294e+03, +1.385530e+04 },
+    { +1.150000e+03, +1.171915e-03, +4.855970e+03, -2.845448e+06, +2.738917e+06, +3.910833e+06, -1.673533e+06, +2.653620e+03, +3.441817e+03, +8.533039e+02, -3.720692e-01, +2.773978e-07, +2.335730e-04, +1.519471e-10, -2.842039e-16, +1.000000e+09, +1.341284e+06, +3.604931e+06, -4.682318e+02, +2.979239e+03, +1.331438e+04 },
+    { +1.200000e+03, +1.197618e-03, +5.002278e+03, -3.117634e+06, +2.885099e+06, +4.082717e+06, -1.920016e+06, +2.648467e+03, +3.433802e+03, +8.349908e+02, -3.604894e-01, +2.848052e-07, +2.294457e-04, +1.442832e-10, -2.958982e-16, +1.000000e+09, +1.265740e+06, +3.511171e+06, -4.235807e+02, +2.838558e+03, +1.280850e+04 },
+    { +1.250000e+03, +1.223614e-03, +5.142313e+03, -3.397270e+06, +3.030622e+06, +4.254236e+06, -2.173656e+06, +2.645373e+03, +3.427140e+03, +8.172512e+02, -3.491366e-01, +2.918182e-07, +2.245953e-04, +1.361420e-10, -3.063895e-16, +1.000000e+09, +1.196418e+06, +3.426791e+06, -3.830799e+02, +2.705893e+03, +1.232926e+04 },
+    { +1.273000e+03, +1.235666e-03, +5.204775e+03, -3.528316e+06, +3.097363e+06, +4.333029e+06, -2.292650e+06, +2.644551e+03, +3.424489e+03, +8.092803e+02, -3.439975e-01, +2.949043e-07, +2.222805e-04, +1.321946e-10, -3.107342e-16, +1.000000e+09, +1.166472e+06, +3.390930e+06, -3.658156e+02, +2.647716e+03, +1.211562e+04 },
+};
+
+} // namespace detail
+} // namespace Reaktoro
@@ -0,0 +1,45 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+namespace detail {
+
+/// The number of rows in the table of pre-computed water properties used for interpolation.
+constexpr Index waterThermoPropsWagnerPrussInterpNumRows = 2180;
+
+/// The number of columns in the table of pre-computed water properties used for interpolation.
+constexpr Index waterThermoPropsWagnerPrussInterpNumCols = 21;
+
+/// The table of pre-computed thermodynamic properties of water using Wagner and Pruss (2002) equation of state used for interpolation.
+/// Each row contains, in this order, the values of T, V, S, A, U, H, G, Cv, Cp,
+/// D, DT, DP, DTT, DTP, DPP, P, PT, PD, PTT, PTD, PDD in WaterThermoProps. The
+/// rows are sorted by pressure first and then by temperature, following the
+/// pressures and temperatures used in Table 13.2 of *Wagner, W., Pruss, A.
+/// (2002). The IAPWS Formulation 1995 for the Thermodynamic Properties of
+/// Ordinary Water Substance for General and Scientific Use. Journal of
+/// Physical and Chemical Reference Data, 31(2), 387.
+/// https://doi.org/10.1063/1.1461829*. This table is compiled into the
+/// library, so that no parsing is needed at runtime.
+extern const double waterThermoPropsWagnerPrussInterpTable[waterThermoPropsWagnerPrussInterpNumRows][waterThermoPropsWagnerPrussInterpNumCols];
+
+} // namespace detail
+} // namespace Reaktoro
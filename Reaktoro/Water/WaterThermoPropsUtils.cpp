@@ -24,6 +24,7 @@ using std::sqrt;
 // Reaktoro includes
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Common/Memoization.hpp>
+#include <Reaktoro/Water/WaterConstants.hpp>
 #include <Reaktoro/Water/WaterHelmholtzProps.hpp>
 #include <Reaktoro/Water/WaterHelmholtzPropsHGK.hpp>
 #include <Reaktoro/Water/WaterHelmholtzPropsWagnerPruss.hpp>
@@ -75,7 +76,7 @@ auto waterThermoPropsHGK(real const& T, real const& P, StateOfMatter som) -> Wat
 
 auto waterThermoPropsHGKMemoized(real const& T, real const& P, StateOfMatter som) -> WaterThermoProps
 {
-    static thread_local auto fn = createMemoizedWaterThermoPropsFnHGK();
+    static const auto fn = createMemoizedWaterThermoPropsFnHGK();
     return fn(T, P, som);
 }
 
@@ -88,16 +89,46 @@ auto waterThermoPropsWagnerPruss(real const& T, real const& P, StateOfMatter som
 
 auto waterThermoPropsWagnerPrussMemoized(real const& T, real const& P, StateOfMatter som) -> WaterThermoProps
 {
-    static thread_local auto fn = createMemoizedWaterThermoPropsFnWagnerPruss();
+    static const auto fn = createMemoizedWaterThermoPropsFnWagnerPruss();
     return fn(T, P, som);
 }
 
 auto waterThermoPropsWagnerPrussInterpMemoized(real const& T, real const& P, StateOfMatter som) -> WaterThermoProps
 {
-    static thread_local auto fn = createMemoizedWaterThermoPropsFnWagnerPrussInterp();
+    static const auto fn = createMemoizedWaterThermoPropsFnWagnerPrussInterp();
     return fn(T, P, som);
 }
 
+WaterThermoPropsEvaluator::WaterThermoPropsEvaluator(WaterHelmholtzPropsFn const& model)
+: model(model)
+{
+    errorif(!model, "Expecting a non-empty Helmholtz free energy model of water in WaterThermoPropsEvaluator.");
+}
+
+auto WaterThermoPropsEvaluator::eval(real const& T, real const& P, StateOfMatter som) -> WaterThermoProps
+{
+    // Check if (T, P) is above the saturation curve, or above the critical pressure if T is above the critical temperature
+    const auto liquid = T < waterCriticalTemperature ? P > waterSaturationPressureWagnerPruss(T) : P > waterCriticalPressure;
+    const auto D0 = (som == somlast && liquid == liquidlast) ? Dlast : 0.0; // a non-positive initial guess causes the density calculation to start from an interpolated density
+    const real D = waterDensity(T, P, model, som, D0, iters);
+    const WaterHelmholtzProps whp = model(T, D);
+    Dlast = D.val();
+    somlast = som;
+    liquidlast = liquid;
+    return waterThermoProps(T, P, whp);
+}
+
+auto WaterThermoPropsEvaluator::iterations() const -> Index
+{
+    return iters;
+}
+
+auto WaterThermoPropsEvaluator::reset() -> void
+{
+    Dlast = 0.0;
+    iters = 0;
+}
+
 auto waterThermoProps(real const& T, real const& P, WaterHelmholtzProps const& whp) -> WaterThermoProps
 {
     WaterThermoProps wt;
@@ -20,12 +20,13 @@
 // Reaktoro includes
 #include <Reaktoro/Common/Real.hpp>
 #include <Reaktoro/Core/StateOfMatter.hpp>
+#include <Reaktoro/Water/WaterHelmholtzProps.hpp>
+#include <Reaktoro/Water/WaterUtils.hpp>
 
 namespace Reaktoro {
 
 // Forward declarations
 struct WaterThermoProps;
-struct WaterHelmholtzProps;
 
 /// Calculate the thermodynamic properties of water using the Haar-Gallagher-Kell (1984) equation of state.
 /// **References:**
@@ -77,4 +78,49 @@ auto waterThermoPropsWagnerPrussInterpMemoized(real const& T, real const& P, Sta
 /// @see WaterHelmholtzProps, WaterThermoProps
 auto waterThermoProps(real const& T, real const& P, WaterHelmholtzProps const& whp) -> WaterThermoProps;
 
+/// Used to calculate the thermodynamic properties of water at consecutive temperatures and pressures.
+/// The density calculation in each evaluation starts its Newton iterations from the density
+/// converged in the previous evaluation, which is an excellent initial guess when consecutive
+/// evaluations are performed at nearby temperatures and pressures (e.g., along a reactive
+/// transport simulation). The first evaluation, as well as any evaluation with a different
+/// desired state of matter than the previous one or at a temperature and pressure on the other
+/// side of the saturation curve (or of the critical pressure above the critical temperature),
+/// starts from an interpolated density instead, so that the Newton iterations do not converge
+/// to the density of the other state of matter of water.
+class WaterThermoPropsEvaluator
+{
+public:
+    /// Construct a WaterThermoPropsEvaluator object with given Helmholtz free energy model of water.
+    /// @param model The Helmholtz free energy model of water (e.g., waterHelmholtzPropsWagnerPruss or waterHelmholtzPropsHGK)
+    explicit WaterThermoPropsEvaluator(WaterHelmholtzPropsFn const& model);
+
+    /// Calculate the thermodynamic properties of water.
+    /// @param T The temperature of water (in units of K)
+    /// @param P The pressure of water (in units of Pa)
+    /// @param som The desired state of matter for water (the actual state of matter may end up being different!)
+    auto eval(real const& T, real const& P, StateOfMatter som) -> WaterThermoProps;
+
+    /// Return the number of Newton iterations performed in the density calculation of the last evaluation.
+    auto iterations() const -> Index;
+
+    /// Reset this evaluator so that its next evaluation does not start from the last converged density.
+    auto reset() -> void;
+
+private:
+    /// The Helmholtz free energy model of water.
+    WaterHelmholtzPropsFn model;
+
+    /// The density of water converged in the last evaluation (in kg/m3).
+    double Dlast = 0.0;
+
+    /// The desired state of matter for water in the last evaluation.
+    StateOfMatter somlast = StateOfMatter::Liquid;
+
+    /// True if the temperature and pressure in the last evaluation were above the saturation curve (or the critical pressure above the critical temperature).
+    bool liquidlast = true;
+
+    /// The number of Newton iterations performed in the last evaluation.
+    Index iters = 0;
+};
+
 } // namespace Reaktoro
@@ -32,4 +32,11 @@ void exportWaterThermoPropsUtils(py::module& m)
     m.def("waterThermoPropsWagnerPrussMemoized", waterThermoPropsWagnerPrussMemoized, "Calculate the thermodynamic properties of water using the Wagner and Pruss (1995) equation of state.");
     m.def("waterThermoPropsWagnerPrussInterpMemoized", waterThermoPropsWagnerPrussInterpMemoized, "Calculate the thermodynamic properties of water using interpolation of pre-computed properties using the Wagner and Pruss (1995) equation of state.");
     m.def("waterThermoProps", waterThermoProps, "Calculate the thermodynamic properties of water.");
+
+    py::class_<WaterThermoPropsEvaluator>(m, "WaterThermoPropsEvaluator")
+        .def(py::init<WaterHelmholtzPropsFn const&>())
+        .def("eval", &WaterThermoPropsEvaluator::eval, "Calculate the thermodynamic properties of water starting the density calculation from the last converged density.")
+        .def("iterations", &WaterThermoPropsEvaluator::iterations, "Return the number of Newton iterations performed in the density calculation of the last evaluation.")
+        .def("reset", &WaterThermoPropsEvaluator::reset, "Reset this evaluator so that its next evaluation does not start from the last converged density.")
+        ;
 }
@@ -34,29 +34,27 @@ using std::pow;
 
 namespace Reaktoro {
 
-template<typename HelmholtsModel>
-auto waterDensity(real const& T, real const& P, HelmholtsModel const& model, StateOfMatter stateofmatter) -> real
+/// Perform Newton iterations on the values of temperature, pressure and density until the density of water converges.
+/// @return True if the calculation converged, false otherwise.
+template<typename HelmholtzModel>
+auto waterDensityNewton(double T, double P, HelmholtzModel const& model, double& D, Index& iterations) -> bool
 {
     // Auxiliary constants for the Newton's iterations
     const auto max_iters = 100;
     const auto tolerance = 1.0e-06;
 
-    // Determine an adequate initial guess for density based on the desired physical state of water
-    real D = waterDensityWagnerPrussInterp(T, P, stateofmatter);
-
     for(int i = 1; i <= max_iters; ++i)
     {
         WaterHelmholtzProps h = model(T, D);
 
-        const auto AD = h.helmholtzD;
-        const auto ADD = h.helmholtzDD;
-        const auto ADDD = h.helmholtzDDD;
+        const double AD = h.helmholtzD.val();
+        const double ADD = h.helmholtzDD.val();
+        const double ADDD = h.helmholtzDDD.val();
 
         const auto F = D*D*AD/P - 1;
         const auto FD = (2*D*AD + D*D*ADD)/P;
         const auto FDD = (2*AD + 2*D*ADD + 2*D*ADD + D*D*ADDD)/P;
 
-        const auto f = 0.5 * F*F;
         const auto g = F*FD;
         const auto H = FD*FD + F*FDD;
 
@@ -66,13 +64,66 @@ auto waterDensity(real const& T, real const& P, HelmholtsModel const& model, Sta
             D -= F/FD;
         else D *= 0.1;
 
+        iterations += 1;
+
         if(abs(F) < tolerance || abs(g) < tolerance)
-            return D;
+            return true;
     }
 
-    errorif(true, "Unable to calculate the density of water because the calculations did not converge at temperature ", T, " K and pressure ", P, " Pa.");
+    return false;
+}
+
+/// Return the converged density of water with its derivatives with respect to temperature and pressure.
+/// These derivatives are computed with the implicit function theorem applied to P = D*D*AD(T, D), where
+/// AD is the partial derivative of the specific Helmholtz free energy of water with respect to density.
+template<typename HelmholtzModel>
+auto waterDensityWithImplicitDerivatives(real const& T, real const& P, HelmholtzModel const& model, double D) -> real
+{
+    WaterHelmholtzProps h = model(T.val(), D);
+
+    const double AD = h.helmholtzD.val();
+    const double ADD = h.helmholtzDD.val();
+    const double ATD = h.helmholtzTD.val();
+
+    const double PD = 2*D*AD + D*D*ADD; // the partial derivative of pressure with respect to density
+    const double PT = D*D*ATD;          // the partial derivative of pressure with respect to temperature
+
+    real res = D;
+    res[1] = (P[1] - PT*T[1])/PD;
+    return res;
+}
+
+template<typename HelmholtzModel>
+auto waterDensity(real const& T, real const& P, HelmholtzModel const& model, StateOfMatter stateofmatter, double D0, Index& iterations) -> real
+{
+    iterations = 0;
 
-    return {};
+    double D = D0;
+
+    // Start from given initial guess, and if that fails, from an adequate initial guess based on the desired physical state of water
+    bool converged = D0 > 0.0 && waterDensityNewton(T.val(), P.val(), model, D, iterations);
+
+    if(!converged)
+    {
+        D = waterDensityWagnerPrussInterp(T.val(), P.val(), stateofmatter).val();
+        converged = waterDensityNewton(T.val(), P.val(), model, D, iterations);
+    }
+
+    errorif(!converged, "Unable to calculate the density of water because the calculations did not converge at temperature ", T, " K and pressure ", P, " Pa.");
+
+    return waterDensityWithImplicitDerivatives(T, P, model, D);
+}
+
+template<typename HelmholtzModel>
+auto waterDensity(real const& T, real const& P, HelmholtzModel const& model, StateOfMatter stateofmatter) -> real
+{
+    Index iterations = 0;
+    return waterDensity(T, P, model, stateofmatter, NaN, iterations);
+}
+
+auto waterDensity(real const& T, real const& P, WaterHelmholtzPropsFn const& model, StateOfMatter stateofmatter, double D0, Index& iterations) -> real
+{
+    return waterDensity<WaterHelmholtzPropsFn>(T, P, model, stateofmatter, D0, iterations);
 }
 
 auto waterDensityHGK(real const& T, real const& P, StateOfMatter stateofmatter) -> real
@@ -19,10 +19,32 @@
 
 // Reaktoro includes
 #include <Reaktoro/Common/Real.hpp>
+#include <Reaktoro/Common/Types.hpp>
 #include <Reaktoro/Core/StateOfMatter.hpp>
 
 namespace Reaktoro {
 
+// Forward declarations
+struct WaterHelmholtzProps;
+
+/// The function type for the calculation of Helmholtz free energy properties of water at given temperature (in K) and density (in kg/m3).
+using WaterHelmholtzPropsFn = Fn<WaterHelmholtzProps(real const& T, real const& D)>;
+
+/// Calculate the density of water using a given Helmholtz free energy model of water and an initial guess for density.
+/// The Newton iterations are performed on the values of temperature, pressure and density only. The
+/// derivatives of density with respect to temperature and pressure are then computed with the implicit
+/// function theorem applied to \f$P=\rho^{2}(\partial a/\partial\rho)_{T}\f$ at the converged density. If the
+/// iterations do not converge from the given initial guess (or if it is not positive), they are restarted
+/// from an interpolated density based on the desired state of matter of water.
+/// @param T The temperature of water (in K)
+/// @param P The pressure of water (in Pa)
+/// @param model The Helmholtz free energy model of water (e.g., waterHelmholtzPropsWagnerPruss)
+/// @param stateofmatter The state of matter of water
+/// @param D0 The initial guess for the density of water (in kg/m3)
+/// @param[out] iterations The number of Newton iterations performed
+/// @return The density of water (in kg/m3)
+auto waterDensity(real const& T, real const& P, WaterHelmholtzPropsFn const& model, StateOfMatter stateofmatter, double D0, Index& iterations) -> real;
+
 /// Calculate the density of water using the Haar--Gallagher--Kell (1984) equation of state
 /// @param T The temperature of water (in K)
 /// @param P The pressure of water (in Pa)
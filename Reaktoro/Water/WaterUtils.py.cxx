@@ -19,11 +19,18 @@
 #include <Reaktoro/pybind11.hxx>
 
 // Reaktoro includes
+#include <Reaktoro/Water/WaterHelmholtzProps.hpp>
 #include <Reaktoro/Water/WaterUtils.hpp>
 using namespace Reaktoro;
 
 void exportWaterUtils(py::module& m)
 {
+    m.def("waterDensity", [](real const& T, real const& P, WaterHelmholtzPropsFn const& model, StateOfMatter som, double D0)
+    {
+        Index iterations = 0;
+        const real D = waterDensity(T, P, model, som, D0, iterations);
+        return py::make_tuple(D, iterations);
+    }, "Calculate the density of water with given Helmholtz free energy model and initial guess for density, returning also the number of Newton iterations.");
     m.def("waterDensityHGK", waterDensityHGK);
     m.def("waterDensityWagnerPruss", waterDensityWagnerPruss);
     m.def("waterLiquidDensityHGK", waterLiquidDensityHGK);
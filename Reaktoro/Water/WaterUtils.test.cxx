@@ -19,6 +19,9 @@
 #include <catch2/catch.hpp>
 
 // Reaktoro includes
+#include <Reaktoro/Water/WaterHelmholtzPropsWagnerPruss.hpp>
+#include <Reaktoro/Water/WaterThermoProps.hpp>
+#include <Reaktoro/Water/WaterThermoPropsUtils.hpp>
 #include <Reaktoro/Water/WaterUtils.hpp>
 using namespace Reaktoro;
 
@@ -41,3 +44,94 @@ TEST_CASE("Testing water utility methods", "[WaterUtils]")
     CHECK( waterDensityWagnerPruss(T + 400, P, StateOfMatter::Liquid) == Approx(0.322301) );
     CHECK( waterDensityWagnerPruss(T + 500, P, StateOfMatter::Liquid) == Approx(0.280463) );
 }
+
+TEST_CASE("Testing water density derivatives and warm-started calculations", "[WaterUtils]")
+{
+    const auto T = 350.0;
+    const auto P = 10.0e5;
+    const auto dT = 1e-3;
+    const auto dP = 1.0;
+
+    const auto Dfn = [](double T, double P) { return waterDensityWagnerPruss(T, P, StateOfMatter::Liquid).val(); };
+
+    SECTION("Checking derivatives of density computed with the implicit function theorem")
+    {
+        real Tr = T;
+        real Pr = P;
+
+        Tr[1] = 1.0;
+        CHECK( waterDensityWagnerPruss(Tr, Pr, StateOfMatter::Liquid)[1] == Approx((Dfn(T + dT, P) - Dfn(T - dT, P))/(2*dT)).epsilon(1e-5) );
+        Tr[1] = 0.0;
+
+        Pr[1] = 1.0;
+        CHECK( waterDensityWagnerPruss(Tr, Pr, StateOfMatter::Liquid)[1] == Approx((Dfn(T, P + dP) - Dfn(T, P - dP))/(2*dP)).epsilon(1e-5) );
+        Pr[1] = 0.0;
+    }
+
+    SECTION("Checking density calculation starting from given initial guess")
+    {
+        Index iters1 = 0, iters2 = 0;
+
+        const auto D1 = waterDensity(T, P, waterHelmholtzPropsWagnerPruss, StateOfMatter::Liquid, 0.0, iters1); // non-positive guess: start from interpolated density
+        const auto D2 = waterDensity(T, P, waterHelmholtzPropsWagnerPruss, StateOfMatter::Liquid, D1.val(), iters2); // start from converged density
+
+        CHECK( D1.val() == Approx(Dfn(T, P)) );
+        CHECK( D2.val() == Approx(D1.val()) );
+        CHECK( iters1 > 0 );
+        CHECK( iters2 <= iters1 );
+    }
+
+    SECTION("Checking warm-started calculation of water properties along consecutive temperatures and pressures")
+    {
+        WaterThermoPropsEvaluator evaluator(waterHelmholtzPropsWagnerPruss);
+
+        for(auto i = 0; i < 10; ++i)
+        {
+            const auto Ti = T + 0.1*i;
+            const auto Pi = P + 100.0*i;
+
+            const auto actual = evaluator.eval(Ti, Pi, StateOfMatter::Liquid);
+            const auto expected = waterThermoPropsWagnerPruss(Ti, Pi, StateOfMatter::Liquid);
+
+            CHECK( actual.D.val() == Approx(expected.D.val()) );
+            CHECK( actual.H.val() == Approx(expected.H.val()) );
+            CHECK( actual.Cp.val() == Approx(expected.Cp.val()) );
+            CHECK( evaluator.iterations() > 0 );
+        }
+
+        evaluator.reset();
+
+        const auto props = evaluator.eval(T + 400.0, 1e5, StateOfMatter::Gas);
+
+        CHECK( props.D.val() == Approx(waterDensityWagnerPruss(T + 400.0, 1e5, StateOfMatter::Gas).val()) );
+    }
+
+    SECTION("Checking warm-started calculation of water properties alternating between liquid and vapor")
+    {
+        WaterThermoPropsEvaluator evaluator(waterHelmholtzPropsWagnerPruss);
+
+        // The steps below alternate between liquid-like states (at pressures
+        // above the saturation pressure, or above the critical pressure at
+        // 650 K) and vapor states, with the same or a different desired state
+        // of matter. Starting from the density converged in the previous step,
+        // the Newton iterations would converge to the liquid density of water
+        // at the vapor states (e.g., about 577 instead of 3.7 kg/m3 at 600 K and 10 bar).
+        const auto Ts = { 650.0, 600.0, 650.0, 640.0, 400.0, 400.0, 400.0 };
+        const auto Ps = { 1000.0e5, 10.0e5, 1000.0e5, 100.0e5, 10.0e5, 1.0e5, 10.0e5 };
+        const auto soms = { StateOfMatter::Gas, StateOfMatter::Gas, StateOfMatter::Gas, StateOfMatter::Gas, StateOfMatter::Liquid, StateOfMatter::Gas, StateOfMatter::Liquid };
+
+        auto Ti = Ts.begin();
+        auto Pi = Ps.begin();
+        auto somi = soms.begin();
+
+        for(; Ti != Ts.end(); ++Ti, ++Pi, ++somi)
+        {
+            const auto actual = evaluator.eval(*Ti, *Pi, *somi);
+            const auto expected = waterThermoPropsWagnerPruss(*Ti, *Pi, *somi);
+
+            INFO("T = " << *Ti << " K, P = " << *Pi << " Pa");
+            CHECK( actual.D.val() == Approx(expected.D.val()) );
+            CHECK( actual.H.val() == Approx(expected.H.val()) );
+        }
+    }
+}
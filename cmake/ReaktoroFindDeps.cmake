@@ -39,6 +39,9 @@ ReaktoroFindPackage(ThermoFun 0.4.3 REQUIRED)
 ReaktoroFindPackage(tsl-ordered-map 1.0.0 REQUIRED)
 ReaktoroFindPackage(yaml-cpp 0.6.3 REQUIRED)
 
+# Thread support (used for parallel execution of per-cell calculations)
+find_package(Threads REQUIRED)
+
 # Optional dependencies
 ReaktoroFindPackage(reaktplot 0.4.1)
 ReaktoroFindPackage(pybind11 2.10.0)
@@ -0,0 +1,88 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include <iostream>
+using namespace std;
+
+#include <Reaktoro/Reaktoro.hpp>
+using namespace Reaktoro;
+
+// The number of times each benchmark is repeated.
+const auto repetitions = 10;
+
+/// Return the average time (in seconds) spent in the execution of a function.
+template<typename Fn>
+auto benchmark(Fn const& fn) -> double
+{
+    const auto begin = time();
+    for(auto i = 0; i < repetitions; ++i)
+        fn();
+    return elapsed(begin) / repetitions;
+}
+
+/// Return the average time (in seconds) spent in the lookup of each species in a system by name.
+auto benchmarkSpeciesLookups(ChemicalSystem const& system) -> double
+{
+    const auto names = vectorize(system.species(), RKT_LAMBDA(s, s.name()));
+    Index sum = 0;
+    const auto seconds = benchmark([&] {
+        for(auto const& name : names)
+            sum += system.species().index(name);
+    });
+    errorif(sum == 0 && names.size() > 1, "Unexpected species indices in the benchmark of species lookups.");
+    return seconds / names.size();
+}
+
+int main()
+{
+    cout << "LOADING DATABASES..." << endl;
+
+    SupcrtDatabase supcrtbl("supcrtbl");
+    NasaDatabase nasacea("nasa-cea");
+
+    const auto supcrtbl_time = benchmark([&] {
+        AqueousPhase solution(speciate("H O C Na Cl Ca Mg Si Al K Fe S"));
+        GaseousPhase gases(speciate("H O C S"));
+        MineralPhases minerals;
+        ChemicalSystem system(supcrtbl, solution, gases, minerals);
+    });
+
+    const auto nasacea_time = benchmark([&] {
+        GaseousPhase gases(speciate("H O C N Ar"));
+        CondensedPhases condensed(speciate("H O C N Ar"));
+        ChemicalSystem system(nasacea, gases, condensed);
+    });
+
+    ChemicalSystem supcrtbl_system(supcrtbl,
+        AqueousPhase(speciate("H O C Na Cl Ca Mg Si Al K Fe S")),
+        GaseousPhase(speciate("H O C S")),
+        MineralPhases());
+
+    ChemicalSystem nasacea_system(nasacea,
+        GaseousPhase(speciate("H O C N Ar")),
+        CondensedPhases(speciate("H O C N Ar")));
+
+    cout << "SUPCRTBL SYSTEM WITH " << supcrtbl_system.species().size() << " SPECIES" << endl;
+    cout << "  construction time (ms)      : " << supcrtbl_time * 1e3 << endl;
+    cout << "  species lookup by name (ns) : " << benchmarkSpeciesLookups(supcrtbl_system) * 1e9 << endl;
+
+    cout << "NASA-CEA SYSTEM WITH " << nasacea_system.species().size() << " SPECIES" << endl;
+    cout << "  construction time (ms)      : " << nasacea_time * 1e3 << endl;
+    cout << "  species lookup by name (ns) : " << benchmarkSpeciesLookups(nasacea_system) * 1e9 << endl;
+
+    return 0;
+}
@@ -0,0 +1,142 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+
+#include <Reaktoro/Common/Algorithms.hpp>
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/InterpolationUtils.hpp>
+#include <Reaktoro/Common/TimeUtils.hpp>
+#include <Reaktoro/Water/WaterInterpolation.hpp>
+#include <Reaktoro/Water/WaterThermoProps.hpp>
+#include <Reaktoro/Water/WaterThermoPropsUtils.hpp>
+using namespace Reaktoro;
+
+// The number of times each benchmark is repeated.
+const auto repetitions = 10;
+
+/// Return the average time (in seconds) spent in the execution of a function.
+template<typename Fn>
+auto benchmark(Fn const& fn) -> double
+{
+    const auto begin = time();
+    for(auto i = 0; i < repetitions; ++i)
+        fn();
+    return elapsed(begin) / repetitions;
+}
+
+/// Interpolate the thermodynamic properties of water as done before the interpolation cells were located in constant time.
+/// The nodes are found with binary searches over the pressures and the temperatures of each
+/// pressure row, and WaterThermoProps objects are interpolated along temperature at three
+/// pressures and then along pressure. Only valid at supercritical pressures (above 22.5 MPa),
+/// where the interpolation rows have no phase transitions.
+auto waterThermoPropsInterpBinarySearch(real const& T, real const& P) -> WaterThermoProps
+{
+    auto const& data = waterThermoPropsWagnerPrussInterpData(StateOfMatter::Liquid);
+
+    static const auto pressures = vectorize(data, RKT_LAMBDA(row, row.front().P.val()));
+    static const auto temperatures = vectorize(data, RKT_LAMBDA(row, vectorize(row, RKT_LAMBDA(props, props.T.val()))));
+
+    const Index iP = std::lower_bound(pressures.begin(), pressures.end(), P) - pressures.begin();
+    const Index iP0 = std::min(pressures.size() - 3, iP);
+
+    auto interpolateAtT = [&](Index indexP)
+    {
+        auto const& Ts = temperatures[indexP];
+        auto const& Ds = data[indexP];
+        const Index iT = std::lower_bound(Ts.begin(), Ts.end(), T) - Ts.begin();
+        const Index iT0 = std::min(Ts.size() - 3, iT);
+        return interpolateQuadratic(T, Ts[iT0], Ts[iT0 + 1], Ts[iT0 + 2], Ds[iT0], Ds[iT0 + 1], Ds[iT0 + 2]);
+    };
+
+    const auto W0 = interpolateAtT(iP0);
+    const auto W1 = interpolateAtT(iP0 + 1);
+    const auto W2 = interpolateAtT(iP0 + 2);
+
+    return interpolateQuadratic(P, pressures[iP0], pressures[iP0 + 1], pressures[iP0 + 2], W0, W1, W2);
+}
+
+int main()
+{
+    // The (T, P) points used in the benchmarks, at supercritical pressures
+    const auto numpoints = 10000;
+
+    Vec<real> Ts(numpoints), Ps(numpoints);
+
+    // Points along a path of slowly varying temperature and pressure (e.g., a sequence of equilibrium calculations)
+    for(auto i = 0; i < numpoints; ++i)
+    {
+        Ts[i] = 400.0 + 700.0 * i / numpoints;   // from 400 K to 1100 K
+        Ps[i] = 30.0e6 + 800.0e6 * i / numpoints; // from 30 MPa to 830 MPa
+    }
+
+    // The same points in random order (e.g., independent calculations in many cells of a mesh)
+    auto Tsrandom = Ts;
+    auto Psrandom = Ps;
+    std::mt19937 generator(0);
+    std::shuffle(Tsrandom.begin(), Tsrandom.end(), generator);
+    std::shuffle(Psrandom.begin(), Psrandom.end(), generator);
+
+    waterThermoPropsWagnerPrussInterp(Ts[0], Ps[0], StateOfMatter::Liquid); // force the creation of the interpolation data before the benchmarks
+
+    double sum = 0.0;
+
+    auto benchmarkPoints = [&](Vec<real> const& Ts, Vec<real> const& Ps, auto const& fn)
+    {
+        return benchmark([&] {
+            for(auto i = 0; i < numpoints; ++i)
+                sum += fn(Ts[i], Ps[i]).D.val();
+        }) / numpoints;
+    };
+
+    auto interp = [](real const& T, real const& P) { return waterThermoPropsWagnerPrussInterp(T, P, StateOfMatter::Liquid); };
+    auto binary = [](real const& T, real const& P) { return waterThermoPropsInterpBinarySearch(T, P); };
+    auto exact  = [](real const& T, real const& P) { return waterThermoPropsWagnerPruss(T, P, StateOfMatter::Liquid); };
+
+    const auto interp_path_time   = benchmarkPoints(Ts, Ps, interp);
+    const auto interp_random_time = benchmarkPoints(Tsrandom, Psrandom, interp);
+    const auto binary_path_time   = benchmarkPoints(Ts, Ps, binary);
+    const auto binary_random_time = benchmarkPoints(Tsrandom, Psrandom, binary);
+    const auto exact_random_time  = benchmarkPoints(Tsrandom, Psrandom, exact);
+
+    // The largest difference between both interpolation schemes, which should be at round-off level
+    double maxdiff = 0.0;
+    for(auto i = 0; i < numpoints; ++i)
+    {
+        const auto D0 = binary(Tsrandom[i], Psrandom[i]).D.val();
+        const auto D1 = interp(Tsrandom[i], Psrandom[i]).D.val();
+        maxdiff = std::max(maxdiff, std::abs(D1 - D0)/D0);
+    }
+
+    errorif(sum == 0.0, "Unexpected water densities in the benchmark of water interpolation.");
+
+    std::cout << "WATER PROPERTIES AT " << numpoints << " POINTS (time per evaluation in ns)" << std::endl;
+    std::cout << "  interpolation along path           : " << interp_path_time * 1e9 << std::endl;
+    std::cout << "  interpolation at random points     : " << interp_random_time * 1e9 << std::endl;
+    std::cout << "  binary search along path           : " << binary_path_time * 1e9 << std::endl;
+    std::cout << "  binary search at random points     : " << binary_random_time * 1e9 << std::endl;
+    std::cout << "  Wagner and Pruss (2002) equation   : " << exact_random_time * 1e9 << std::endl;
+    std::cout << "SPEEDUP OF INTERPOLATION" << std::endl;
+    std::cout << "  over binary search along path      : " << binary_path_time / interp_path_time << std::endl;
+    std::cout << "  over binary search at random points: " << binary_random_time / interp_random_time << std::endl;
+    std::cout << "  over Wagner and Pruss (2002)       : " << exact_random_time / interp_random_time << std::endl;
+    std::cout << "LARGEST RELATIVE DIFFERENCE IN DENSITY BETWEEN BOTH INTERPOLATION SCHEMES: " << maxdiff << std::endl;
+
+    return 0;
+}
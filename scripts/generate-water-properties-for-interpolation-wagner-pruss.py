@@ -18,7 +18,7 @@
 # ---------------------------------------------------------------------------------------------------------------------------
 # Execute this script using:
 #
-# python /path/to/scripts/generate-water-properties-for-interpolation-wagner-pruss.py > WaterThermoPropsWagnerPruss.txt
+# python /path/to/scripts/generate-water-properties-for-interpolation-wagner-pruss.py > Reaktoro/Water/WaterInterpolationData.cpp
 # ---------------------------------------------------------------------------------------------------------------------------
 
 from reaktoro import *
@@ -103,14 +103,46 @@ def tolist(props: WaterThermoProps):
 
 def printprops(props: WaterThermoProps):
     props = tolist(props)
-    s = ""
-    for x in props:
-        s += f"{x:+.6e} "
-    print(s)
+    s = ", ".join(f"{x:+.6e}" for x in props)
+    print(f"    {{ {s} }},")
 
 
+print('''// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2022 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// ---------------------------------------------------------------------------------------------------------------------------
+// THIS FILE WAS GENERATED BY scripts/generate-water-properties-for-interpolation-wagner-pruss.py -- DO NOT EDIT IT MANUALLY
+// ---------------------------------------------------------------------------------------------------------------------------
+
+#include "WaterInterpolationData.hpp"
+
+namespace Reaktoro {
+namespace detail {
+
+const double waterThermoPropsWagnerPrussInterpTable[waterThermoPropsWagnerPrussInterpNumRows][waterThermoPropsWagnerPrussInterpNumCols] =
+{''')
+
 for [i, P] in enumerate(pressures):
-    print(f"P = {P} MPa")
+    print(f"    // P = {P} MPa")
     for [j, T] in enumerate(temperatures[i]):
         props = waterThermoPropsWagnerPruss(T, P * 1e6)  # from MPa to Pa
         printprops(props)
+
+print('''};
+
+} // namespace detail
+} // namespace Reaktoro''')